@@ -116,6 +116,7 @@ list (APPEND MAIN_SOURCE_FILES
   opm/models/nonlinear/newtonmethodparams.cpp
   opm/models/parallel/tasklets.cpp
   opm/models/parallel/threadmanager.cpp
+  opm/models/utils/hugepages.cpp
   opm/models/utils/parametersystem.cpp
   opm/models/utils/simulatorutils.cpp
   opm/models/utils/terminal.cpp
@@ -125,6 +126,7 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/flow/BioeffectsContainer.cpp
   opm/simulators/flow/BlackoilModelParameters.cpp
   opm/simulators/flow/BlackoilModelConvergenceMonitor.cpp
+  opm/simulators/flow/BlackoilModelTolerancePolicy.cpp
   opm/simulators/flow/CO2H2Container.cpp
   opm/simulators/flow/CollectDataOnIORank.cpp
   opm/simulators/flow/CompositionalContainer.cpp
@@ -162,11 +164,13 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/flow/SimulatorReportBanners.cpp
   opm/simulators/flow/SimulatorSerializer.cpp
   opm/simulators/flow/SolutionContainers.cpp
+  opm/simulators/flow/StepTelemetry.cpp
   opm/simulators/flow/TracerContainer.cpp
   opm/simulators/flow/Transmissibility.cpp
   opm/simulators/flow/ValidationFunctions.cpp
   opm/simulators/flow/equil/EquilibrationHelpers.cpp
   opm/simulators/flow/equil/InitStateEquil.cpp
+  opm/simulators/linalg/DILUKernels.cpp
   opm/simulators/linalg/ExtractParallelGridInformationToISTL.cpp
   opm/simulators/linalg/FlexibleSolver1.cpp
   opm/simulators/linalg/FlexibleSolver2.cpp
@@ -198,13 +202,17 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/timestepping/SimulatorTimerInterface.cpp
   opm/simulators/timestepping/TimeStepControl.cpp
   opm/simulators/timestepping/gatherConvergenceReport.cpp
+  opm/simulators/utils/AllocationTracker.cpp
   opm/simulators/utils/ComponentName.cpp
   opm/simulators/utils/DeferredLogger.cpp
+  opm/simulators/utils/EventProfiler.cpp
   opm/simulators/utils/FullySupportedFlowKeywords.cpp
+  opm/simulators/utils/MemoryBudget.cpp
   opm/simulators/utils/ParallelFileMerger.cpp
   opm/simulators/utils/ParallelRestart.cpp
   opm/simulators/utils/PartiallySupportedFlowKeywords.cpp
   opm/simulators/utils/PressureAverage.cpp
+  opm/simulators/utils/RooflineCounters.cpp
   opm/simulators/utils/SerializationPackers.cpp
   opm/simulators/utils/UnsupportedFlowKeywords.cpp
   opm/simulators/utils/compressPartition.cpp
@@ -246,7 +254,9 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/wells/MultisegmentWellEval.cpp
   opm/simulators/wells/MultisegmentWellGeneric.cpp
   opm/simulators/wells/MultisegmentWellPrimaryVariables.cpp
-  opm/simulators/wells/MultisegmentWellSegments.cpp
+  opm/simulators/wells/MultisegmentWellSegments1.cpp
+  opm/simulators/wells/MultisegmentWellSegments2.cpp
+  opm/simulators/wells/MultisegmentWellSegments3.cpp
   opm/simulators/wells/ParallelPAvgCalculator.cpp
   opm/simulators/wells/ParallelPAvgDynamicSourceData.cpp
   opm/simulators/wells/ParallelWBPCalculation.cpp
@@ -257,7 +267,9 @@ list (APPEND MAIN_SOURCE_FILES
   opm/simulators/wells/SegmentState.cpp
   opm/simulators/wells/SingleWellState.cpp
   opm/simulators/wells/StandardWellAssemble.cpp
-  opm/simulators/wells/StandardWellConnections.cpp
+  opm/simulators/wells/StandardWellConnections1.cpp
+  opm/simulators/wells/StandardWellConnections2.cpp
+  opm/simulators/wells/StandardWellConnections3.cpp
   opm/simulators/wells/StandardWellEquations.cpp
   opm/simulators/wells/StandardWellEval.cpp
   opm/simulators/wells/StandardWellPrimaryVariables.cpp
@@ -314,6 +326,7 @@ if(CUDA_FOUND OR hip_FOUND)
   ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg detail/CuBlasHandle.cpp)
   ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg detail/gpusparse_matrix_operations.cu)
   ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg detail/CuSparseHandle.cpp)
+  ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg detail/gpu_memory_pool.cpp)
   ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg detail/preconditionerKernels/DILUKernels.cu)
   ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg detail/preconditionerKernels/ILU_variants_helper_kernels.cu)
   ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg detail/preconditionerKernels/ILU0Kernels.cu)
@@ -322,7 +335,9 @@ if(CUDA_FOUND OR hip_FOUND)
   ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg GpuVector.cpp)
   ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg GpuView.cpp)
   ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg detail/cpr_amg_operations.cu)
+  ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg detail/spmvBlockKernels.cu)
   ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg detail/vector_operations.cu)
+  ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg detail/wellContributionKernels.cu)
   ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg GpuSparseMatrix.cpp)
   ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg GpuSparseMatrixGeneric.cpp)
   ADD_CUDA_OR_HIP_FILE(MAIN_SOURCE_FILES opm/simulators/linalg GpuDILU.cpp)
@@ -338,6 +353,7 @@ if(CUDA_FOUND OR hip_FOUND)
   # HEADERS
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/autotuner.hpp)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/coloringAndReorderingUtils.hpp)
+  ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/gpu_memory_pool.hpp)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/gpu_safe_call.hpp)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/gpusparse_matrix_operations.hpp)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/gpusparse_matrix_utilities.hpp)
@@ -369,7 +385,11 @@ if(CUDA_FOUND OR hip_FOUND)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/cublas_wrapper.hpp)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/cusparse_wrapper.hpp)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/gpu_constants.hpp)
+  ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/tpfaAssemblyKernels.hpp)
+  ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/spmvBlockKernels.hpp)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/vector_operations.hpp)
+  ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/wellContributionKernels.hpp)
+  ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg GpuWellContributions.hpp)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/cpr_amg_operations.hpp)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/has_function.hpp)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/preconditioner_should_call_post_pre.hpp)
@@ -399,6 +419,7 @@ if(CUDA_FOUND OR hip_FOUND)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg hypreinterface/HypreUtils.hpp)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg PinnedMemoryHolder.hpp)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg GpuPressureTransferPolicy.hpp)
+  ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg GpuToCpuPressureTransferPolicy.hpp)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg detail/gpu_preconditioner_utils.hpp)
   ADD_CUDA_OR_HIP_FILE(PUBLIC_HEADER_FILES opm/simulators/linalg MiniVector.hpp)
 
@@ -475,6 +496,7 @@ list (APPEND TEST_SOURCE_FILES
   tests/models/test_tasklets.cpp
   tests/models/test_tasklets_failure.cpp
   tests/test_ALQState.cpp
+  tests/test_allocationtracker.cpp
   tests/test_aquifergridutils.cpp
   tests/test_blackoil_amg.cpp
   tests/test_convergenceoutputconfiguration.cpp
@@ -483,6 +505,7 @@ list (APPEND TEST_SOURCE_FILES
   tests/test_dilu.cpp
   tests/test_group_higher_constraints.cpp
   tests/test_equil.cpp
+  tests/test_eventprofiler.cpp
   tests/test_extractMatrix.cpp
   tests/test_flexiblesolver.cpp
   tests/test_GasSatfuncConsistencyChecks.cpp
@@ -494,6 +517,8 @@ list (APPEND TEST_SOURCE_FILES
   tests/test_invert.cpp
   tests/test_keyword_validator.cpp
   tests/test_LogOutputHelper.cpp
+  tests/test_matrixfreeoperator.cpp
+  tests/test_memorybudget.cpp
   tests/test_milu.cpp
   tests/test_multmatrixtransposed.cpp
   tests/test_nonnc.cpp
@@ -517,6 +542,7 @@ list (APPEND TEST_SOURCE_FILES
   tests/test_SatfuncConsistencyChecks.cpp
   tests/test_SatfuncConsistencyChecks_parallel.cpp
   tests/test_SatfuncConsistencyCheckManager.cpp
+  tests/test_sellcsigmamatrix.cpp
   tests/test_stoppedwells.cpp
   tests/test_ThreePointHorizontalSatfuncConsistencyChecks.cpp
   tests/test_timer.cpp
@@ -557,6 +583,8 @@ if(CUDA_FOUND OR hip_FOUND)
   ADD_CUDA_OR_HIP_FILE(TEST_SOURCE_FILES tests test_cuSparse_matrix_operations.cpp)
   ADD_CUDA_OR_HIP_FILE(TEST_SOURCE_FILES tests test_GpuSparseMatrix.cu)
   ADD_CUDA_OR_HIP_FILE(TEST_SOURCE_FILES tests test_GpuSparseTable.cu)
+  ADD_CUDA_OR_HIP_FILE(TEST_SOURCE_FILES tests test_tpfaAssemblyKernels.cu)
+  ADD_CUDA_OR_HIP_FILE(TEST_SOURCE_FILES tests test_spmvBlockKernels.cu)
   ADD_CUDA_OR_HIP_FILE(TEST_SOURCE_FILES tests test_GpuVector.cpp)
   ADD_CUDA_OR_HIP_FILE(TEST_SOURCE_FILES tests test_cuVector_operations.cpp)
   ADD_CUDA_OR_HIP_FILE(TEST_SOURCE_FILES tests test_safe_conversion.cpp)
@@ -900,6 +928,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/models/utils/basicparameters.hh
   opm/models/utils/basicproperties.hh
   opm/models/utils/genericguard.hh
+  opm/models/utils/hugepages.hpp
   opm/models/utils/parametersystem.hpp
   opm/models/utils/pffgridvector.hh
   opm/models/utils/prefetch.hh
@@ -910,6 +939,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/models/utils/simulatorutils.hpp
   opm/models/utils/start.hh
   opm/models/utils/terminal.hpp
+  opm/models/utils/threadarena.hh
   opm/models/utils/timer.hpp
   opm/models/utils/timerguard.hh
   opm/simulators/flow/ActionHandler.hpp
@@ -925,6 +955,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/flow/BlackoilModelNldd.hpp
   opm/simulators/flow/BlackoilModelParameters.hpp
   opm/simulators/flow/BlackoilModelProperties.hpp
+  opm/simulators/flow/BlackoilModelTolerancePolicy.hpp
   opm/simulators/flow/CO2H2Container.hpp
   opm/simulators/flow/CollectDataOnIORank.hpp
   opm/simulators/flow/CollectDataOnIORank_impl.hpp
@@ -993,6 +1024,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/flow/SimulatorReportBanners.hpp
   opm/simulators/flow/SimulatorSerializer.hpp
   opm/simulators/flow/SolutionContainers.hpp
+  opm/simulators/flow/StepTelemetry.hpp
   opm/simulators/flow/SubDomain.hpp
   opm/simulators/flow/TTagFlowProblemTPFA.hpp
   opm/simulators/flow/TTagFlowProblemGasWater.hpp
@@ -1002,6 +1034,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/flow/TracerModel.hpp
   opm/simulators/flow/Transmissibility.hpp
   opm/simulators/flow/Transmissibility_impl.hpp
+  opm/simulators/flow/TransportTopology.hpp
   opm/simulators/flow/ValidationFunctions.hpp
   opm/simulators/flow/VtkTracerModule.hpp
   opm/simulators/flow/equil/EquilibrationHelpers.hpp
@@ -1026,8 +1059,10 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/bicgstabsolver.hh
   opm/simulators/linalg/blacklist.hh
   opm/simulators/linalg/combinedcriterion.hh
+  opm/simulators/linalg/CommOverlapSchwarzOperator.hpp
   opm/simulators/linalg/convergencecriterion.hh
   opm/simulators/linalg/DILU.hpp
+  opm/simulators/linalg/DILUKernels.hpp
   opm/simulators/linalg/domesticoverlapfrombcrsmatrix.hh
   opm/simulators/linalg/elementborderlistfromgrid.hh
   opm/simulators/linalg/exportSystem.hpp
@@ -1055,7 +1090,9 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/LinearSolverAcceleratorType.hpp
   opm/simulators/linalg/linearsolverreport.hh
   opm/simulators/linalg/matrixblock.hh
+  opm/simulators/linalg/MatrixFreeOperator.hpp
   opm/simulators/linalg/MatrixMarketSpecializations.hpp
+  opm/simulators/linalg/MulticolorGaussSeidel.hpp
   opm/simulators/linalg/nullborderlistmanager.hh
   opm/simulators/linalg/overlappingbcrsmatrix.hh
   opm/simulators/linalg/overlappingblockvector.hh
@@ -1087,6 +1124,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/linalg/PressureSolverPolicy.hpp
   opm/simulators/linalg/PressureTransferPolicy.hpp
   opm/simulators/linalg/PropertyTree.hpp
+  opm/simulators/linalg/SellCSigmaMatrix.hpp
   opm/simulators/linalg/residreductioncriterion.hh
   opm/simulators/linalg/SmallDenseMatrixUtils.hpp
   opm/simulators/linalg/setupPropertyTree.hpp
@@ -1107,22 +1145,28 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/timestepping/SimulatorReport.hpp
   opm/simulators/timestepping/SimulatorTimerInterface.hpp
   opm/simulators/timestepping/gatherConvergenceReport.hpp
+  opm/simulators/utils/AllocationTracker.hpp
   opm/simulators/utils/ComponentName.hpp
   opm/simulators/utils/DeferredLogger.hpp
   opm/simulators/utils/DeferredLoggingErrorHelpers.hpp
+  opm/simulators/utils/EventProfiler.hpp
+  opm/simulators/utils/MemoryBudget.hpp
   opm/simulators/utils/ParallelEclipseState.hpp
   opm/simulators/utils/ParallelFileMerger.hpp
   opm/simulators/utils/ParallelNLDDPartitioningZoltan.hpp
   opm/simulators/utils/ParallelRestart.hpp
   opm/simulators/utils/PressureAverage.hpp
   opm/simulators/utils/PropsDataHandle.hpp
+  opm/simulators/utils/RooflineCounters.hpp
   opm/simulators/utils/SerializationPackers.hpp
+  opm/simulators/utils/TargetClones.hpp
   opm/simulators/utils/VectorVectorDataHandle.hpp
   opm/simulators/utils/compressPartition.hpp
   opm/simulators/utils/gatherDeferredLogger.hpp
   opm/simulators/utils/moduleVersion.hpp
   opm/simulators/utils/ParallelCommunication.hpp
   opm/simulators/utils/ParallelSerialization.hpp
+  opm/simulators/utils/ReproducibleReduction.hpp
   opm/simulators/utils/readDeck.hpp
   opm/simulators/utils/satfunc/GasPhaseConsistencyChecks.hpp
   opm/simulators/utils/satfunc/OilPhaseConsistencyChecks.hpp
@@ -1175,6 +1219,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/wells/MultisegmentWellGeneric.hpp
   opm/simulators/wells/MultisegmentWellPrimaryVariables.hpp
   opm/simulators/wells/MultisegmentWellSegments.hpp
+  opm/simulators/wells/MultisegmentWellSegments_impl.hpp
   opm/simulators/wells/ParallelPAvgCalculator.hpp
   opm/simulators/wells/ParallelPAvgDynamicSourceData.hpp
   opm/simulators/wells/ParallelWBPCalculation.hpp
@@ -1192,6 +1237,7 @@ list (APPEND PUBLIC_HEADER_FILES
   opm/simulators/wells/StandardWell_impl.hpp
   opm/simulators/wells/StandardWellAssemble.hpp
   opm/simulators/wells/StandardWellConnections.hpp
+  opm/simulators/wells/StandardWellConnections_impl.hpp
   opm/simulators/wells/StandardWellEquations.hpp
   opm/simulators/wells/StandardWellEval.hpp
   opm/simulators/wells/StandardWellPrimaryVariables.hpp
@@ -1295,6 +1341,7 @@ endif()
 
 list (APPEND EXAMPLE_SOURCE_FILES
   examples/art2dgf.cpp
+  examples/bench_linalg_kernels.cpp
   examples/co2injection_flash_ecfv.cpp
   examples/co2injection_flash_ni_ecfv.cpp
   examples/co2injection_flash_ni_vcfv.cpp
@@ -1338,6 +1385,7 @@ list (APPEND EXAMPLE_SOURCE_FILES
   examples/reservoir_ncp_ecfv.cpp
   examples/reservoir_ncp_vcfv.cpp
   examples/printvfp.cpp
+  examples/solve_replay.cpp
   examples/tutorial1.cpp
   examples/waterair_pvs_ni.cpp
 )
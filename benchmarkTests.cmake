@@ -0,0 +1,81 @@
+# Performance regression benchmarks
+#
+# `make benchmark` runs a set of well-known decks from opm-tests through
+# flow and compares the timing trailer (assembly, linear solve, well
+# assembly, output, ...) against JSON baselines via
+# tests/run_performance_benchmark.py.  The target fails when a timing
+# regresses by more than BENCHMARK_REGRESSION_THRESHOLD percent.
+#
+# Baselines are machine specific and therefore not checked in; create or
+# refresh them on the benchmark machine with `make benchmark-baseline`.
+
+set(BENCHMARK_REGRESSION_THRESHOLD 10 CACHE STRING
+    "Allowed slowdown in percent before the benchmark target fails")
+set(BENCHMARK_REPEATS 3 CACHE STRING
+    "Repetitions per benchmark case; the fastest one is compared")
+set(BENCHMARK_BASELINE_DIR ${PROJECT_BINARY_DIR}/benchmarks/baselines CACHE PATH
+    "Directory holding the JSON timing baselines")
+
+set(BENCHMARK_RESULT_PATH ${PROJECT_BINARY_DIR}/benchmarks/results)
+
+set(_benchmark_commands "")
+set(_benchmark_baseline_commands "")
+
+# Register one deck with both the benchmark and benchmark-baseline
+# targets.  DIR/FILENAME follow the conventions of compareECLFiles.cmake.
+function(add_benchmark_case)
+  set(oneValueArgs CASENAME FILENAME DIR SIMULATOR)
+  set(multiValueArgs TEST_ARGS)
+  cmake_parse_arguments(PARAM "" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
+  if(NOT PARAM_DIR)
+    set(PARAM_DIR ${PARAM_CASENAME})
+  endif()
+
+  set(_common_args
+      --simulator $<TARGET_FILE:${PARAM_SIMULATOR}>
+      --deck ${OPM_TESTS_ROOT}/${PARAM_DIR}/${PARAM_FILENAME}.DATA
+      --output-dir ${BENCHMARK_RESULT_PATH}/${PARAM_SIMULATOR}+${PARAM_CASENAME}
+      --baseline ${BENCHMARK_BASELINE_DIR}/${PARAM_SIMULATOR}+${PARAM_CASENAME}.json
+      --repeats ${BENCHMARK_REPEATS})
+
+  list(APPEND _benchmark_commands COMMAND
+       ${PROJECT_SOURCE_DIR}/tests/run_performance_benchmark.py
+       ${_common_args}
+       --threshold ${BENCHMARK_REGRESSION_THRESHOLD}
+       ${PARAM_TEST_ARGS})
+  set(_benchmark_commands ${_benchmark_commands} PARENT_SCOPE)
+
+  list(APPEND _benchmark_baseline_commands COMMAND
+       ${PROJECT_SOURCE_DIR}/tests/run_performance_benchmark.py
+       ${_common_args}
+       --update
+       ${PARAM_TEST_ARGS})
+  set(_benchmark_baseline_commands ${_benchmark_baseline_commands} PARENT_SCOPE)
+endfunction()
+
+add_benchmark_case(CASENAME spe1
+                   FILENAME SPE1CASE2
+                   SIMULATOR flow)
+
+add_benchmark_case(CASENAME spe9
+                   FILENAME SPE9_CP_SHORT
+                   SIMULATOR flow)
+
+# Norne stands in for an SPE10-class workload: a full-field model with
+# realistic well counts whose runtime is dominated by the linear solver.
+add_benchmark_case(CASENAME norne
+                   FILENAME NORNE_ATW2013
+                   SIMULATOR flow
+                   TEST_ARGS --tolerance-wells=1e-6)
+
+add_custom_target(benchmark
+                  ${_benchmark_commands}
+                  USES_TERMINAL
+                  COMMENT "Running performance regression benchmarks")
+add_dependencies(benchmark flow)
+
+add_custom_target(benchmark-baseline
+                  ${_benchmark_baseline_commands}
+                  USES_TERMINAL
+                  COMMENT "Recording performance benchmark baselines")
+add_dependencies(benchmark-baseline flow)
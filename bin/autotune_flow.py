@@ -0,0 +1,224 @@
+#!/usr/bin/env python3
+"""Autotuning harness for flow's performance parameters.
+
+Probes a window of the simulation -- by default the first report steps,
+optionally replayed from a state snapshot recorded with flow's
+--save-file / --save-step support -- once per combination of the swept
+parameters, picks the fastest configuration by measured wall time and
+then runs the full simulation with it.  The winning configuration is
+persisted in a cache file keyed by the hash of the deck, so later runs
+of the same deck skip the probing phase entirely.
+
+Typical usage, probing the first 30 days of a deck:
+
+  autotune_flow.py --flow=build/bin/flow --deck=CASE.DATA \\
+      --probe-end-time=30 \\
+      --sweep threads-per-process=1,2,4,8 \\
+      --sweep linear-solver=ilu0,cprw
+
+With a snapshot, so every probe warm starts at report step 10:
+
+  autotune_flow.py --flow=build/bin/flow --deck=CASE.DATA \\
+      --snapshot-step=10 --probe-end-time=400 --probe-budget=1800 \\
+      --sweep num-local-domains=25,50,100
+
+If no --sweep is given a small built-in sweep over threads-per-process
+and the linear solver choice is used.  --probe-budget stops launching
+new probes once the given number of seconds has been spent; the best
+configuration found so far wins.  Use --probe-only to skip the final
+full run and just print (and cache) the winner.
+"""
+
+import argparse
+import hashlib
+import itertools
+import json
+import os
+import shutil
+import subprocess
+import sys
+import time
+
+DEFAULT_SWEEPS = [
+    ('threads-per-process', ['1', '2', '4', '8']),
+    ('linear-solver', ['ilu0', 'cprw']),
+]
+
+
+def parse_sweep(spec):
+    """Split 'name=v1,v2,v3' into (name, [v1, v2, v3])."""
+    name, _, values = spec.partition('=')
+    if not values:
+        sys.exit(f"malformed --sweep '{spec}', expected name=value[,value...]")
+    return name.lstrip('-'), values.split(',')
+
+
+def deck_hash(deck):
+    """Content hash of the deck file, used as the cache key.
+
+    Only the top-level .DATA file is hashed; INCLUDE files are not
+    chased, so editing only an include file keeps the cached choice.
+    """
+    h = hashlib.sha256()
+    with open(deck, 'rb') as f:
+        for chunk in iter(lambda: f.read(1 << 20), b''):
+            h.update(chunk)
+    return h.hexdigest()
+
+
+def load_cache(path):
+    try:
+        with open(path) as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        return {}
+
+
+def store_cache(path, cache):
+    os.makedirs(os.path.dirname(path) or '.', exist_ok=True)
+    tmp = path + '.tmp'
+    with open(tmp, 'w') as f:
+        json.dump(cache, f, indent=2, sort_keys=True)
+    os.replace(tmp, path)
+
+
+def run_case(flow, deck, extra_args, rundir, mpi_procs, capture=True):
+    os.makedirs(rundir, exist_ok=True)
+    cmd = []
+    if mpi_procs > 1:
+        cmd += ['mpirun', '-np', str(mpi_procs)]
+    cmd += [flow, deck, f'--output-dir={rundir}'] + extra_args
+    out = subprocess.DEVNULL if capture else None
+    start = time.monotonic()
+    result = subprocess.run(cmd, stdout=out, stderr=subprocess.STDOUT)
+    elapsed = time.monotonic() - start
+    return elapsed, result.returncode
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--flow', required=True, help='path to the flow binary')
+    parser.add_argument('--deck', required=True, help='input deck (.DATA)')
+    parser.add_argument('--flow-args', default='',
+                        help='extra arguments passed to every run, probes '
+                             'and the final one alike')
+    parser.add_argument('--sweep', action='append', default=[],
+                        metavar='NAME=V1,V2,...',
+                        help='parameter to sweep (without leading --); may be '
+                             'given multiple times, the cross product is run')
+    parser.add_argument('--probe-end-time', type=float, default=None,
+                        help='end time in days for the probe runs, passed as '
+                             '--end-time; probes run the whole deck if unset')
+    parser.add_argument('--probe-budget', type=float, default=None,
+                        help='stop launching probes after this many seconds; '
+                             'the best configuration found so far wins')
+    parser.add_argument('--snapshot-step', type=int, default=None,
+                        help='record a snapshot at this report step with the '
+                             'default configuration first and warm start '
+                             'every probe from it')
+    parser.add_argument('--mpi-procs', type=int, default=1)
+    parser.add_argument('--output-dir', default='autotune',
+                        help='scratch directory for probe output')
+    parser.add_argument('--cache-file',
+                        default=os.path.expanduser('~/.cache/opm/flow_autotune.json'),
+                        help='where the winning configuration is persisted, '
+                             'keyed by the deck hash')
+    parser.add_argument('--retune', action='store_true',
+                        help='probe again even if the cache has an entry '
+                             'for this deck')
+    parser.add_argument('--probe-only', action='store_true',
+                        help='print and cache the winner, do not run the '
+                             'full simulation')
+    parser.add_argument('--keep-run-output', action='store_true',
+                        help='keep the per-probe output directories '
+                             '(deleted by default to save space)')
+    args = parser.parse_args()
+
+    base_args = args.flow_args.split()
+    key = deck_hash(args.deck)
+    cache = load_cache(args.cache_file)
+
+    winner = None
+    if not args.retune and key in cache:
+        winner = cache[key]['params']
+        print(f'cached configuration for this deck: {winner}')
+
+    if winner is None:
+        sweeps = [parse_sweep(s) for s in args.sweep] or DEFAULT_SWEEPS
+        os.makedirs(args.output_dir, exist_ok=True)
+
+        probe_args = list(base_args)
+        if args.snapshot_step is not None:
+            snap = os.path.abspath(os.path.join(args.output_dir, 'snapshot.hdf5'))
+            print(f'recording snapshot at report step {args.snapshot_step} ...',
+                  end=' ', flush=True)
+            elapsed, rc = run_case(
+                args.flow, args.deck,
+                base_args + [f'--save-file={snap}',
+                             f'--save-step={args.snapshot_step}'],
+                os.path.join(args.output_dir, 'snapshot_run'), args.mpi_procs)
+            print(f'{elapsed:.1f}s')
+            if rc != 0:
+                sys.exit(f'snapshot run failed with rc={rc}')
+            probe_args += [f'--load-file={snap}',
+                           f'--load-step={args.snapshot_step}']
+        if args.probe_end_time is not None:
+            probe_args += [f'--end-time={args.probe_end_time}']
+
+        combos = [dict(zip((name for name, _ in sweeps), combo))
+                  for combo in itertools.product(*(v for _, v in sweeps))]
+
+        best = None
+        spent = 0.0
+        for idx, params in enumerate(combos):
+            if args.probe_budget is not None and spent >= args.probe_budget:
+                print(f'probe budget of {args.probe_budget:.0f}s exhausted, '
+                      f'skipping the remaining {len(combos) - idx} probes')
+                break
+
+            tag = '_'.join(f'{k}_{v}' for k, v in params.items())
+            rundir = os.path.join(args.output_dir, f'probe{idx:03d}_{tag}')
+            extra = probe_args + [f'--{k}={v}' for k, v in params.items()]
+
+            print(f'[{idx + 1}/{len(combos)}] {params} ...', end=' ', flush=True)
+            elapsed, rc = run_case(args.flow, args.deck, extra,
+                                   rundir, args.mpi_procs)
+            spent += elapsed
+            print(f'{elapsed:.1f}s' + ('' if rc == 0 else f' (FAILED rc={rc})'))
+
+            if rc == 0 and (best is None or elapsed < best[0]):
+                best = (elapsed, params)
+
+            if not args.keep_run_output:
+                shutil.rmtree(rundir, ignore_errors=True)
+
+        if best is None:
+            sys.exit('no probe run succeeded, nothing to tune')
+
+        winner = best[1]
+        cache[key] = {
+            'deck': os.path.abspath(args.deck),
+            'params': winner,
+            'probe_wall_time': round(best[0], 3),
+            'mpi_procs': args.mpi_procs,
+        }
+        store_cache(args.cache_file, cache)
+        print(f'best configuration: {winner} ({best[0]:.1f}s), '
+              f'cached in {args.cache_file}')
+
+    if args.probe_only:
+        return
+
+    final = base_args + [f'--{k}={v}' for k, v in winner.items()]
+    print(f'running full simulation with {winner}')
+    elapsed, rc = run_case(args.flow, args.deck, final,
+                           os.path.join(os.path.dirname(args.deck) or '.',
+                                        'autotuned_run'),
+                           args.mpi_procs, capture=False)
+    print(f'full run finished in {elapsed:.1f}s (rc={rc})')
+    sys.exit(rc)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+"""Parameter-sweep harness for tuning NLDD against global Newton.
+
+Replays the same simulation window -- typically restored from a state
+snapshot recorded with flow's --save-file / --save-step support -- once
+with the global Newton solver and once per combination of the swept NLDD
+parameters, then aggregates the wall time and the per-domain cost
+breakdown CSVs written by flow at the end of an NLDD run
+(nldd_domain_costs_<rank>.csv, see NlddReporting.hpp).
+
+Typical usage, replaying report steps 10-15 of a recorded run:
+
+  flow CASE.DATA --save-file=snap.hdf5 --save-step=10
+  nldd_bench.py --flow=build/bin/flow --deck=CASE.DATA \\
+      --flow-args='--load-file=snap.hdf5 --load-step=10 --end-time=...' \\
+      --sweep num-local-domains=25,50,100 \\
+      --sweep local-tolerance-scaling-cnv=0.1,1,10 \\
+      --output-dir=nldd_sweep
+
+The summary CSV has one row per run with the wall time and, for NLDD
+runs, the totals and the min/max/mean spread of the per-domain costs --
+a large spread indicates an unbalanced partition and is usually the
+first thing to fix.
+"""
+
+import argparse
+import csv
+import glob
+import itertools
+import os
+import shutil
+import subprocess
+import sys
+import time
+
+
+def parse_sweep(spec):
+    """Split 'name=v1,v2,v3' into (name, [v1, v2, v3])."""
+    name, _, values = spec.partition('=')
+    if not values:
+        sys.exit(f"malformed --sweep '{spec}', expected name=value[,value...]")
+    return name.lstrip('-'), values.split(',')
+
+
+def domain_cost_summary(rundir):
+    """Aggregate the nldd_domain_costs_<rank>.csv files of one run."""
+    rows = []
+    for fname in sorted(glob.glob(os.path.join(rundir, 'nldd_domain_costs_*.csv'))):
+        with open(fname, newline='') as f:
+            rows.extend(csv.DictReader(f))
+    if not rows:
+        return {}
+
+    def col(name):
+        return [float(r[name]) for r in rows]
+
+    times = col('total_time')
+    summary = {
+        'num_domains': len(rows),
+        'newton_iterations': sum(col('newton_iterations')),
+        'linear_iterations': sum(col('linear_iterations')),
+        'assemble_time': sum(col('assemble_time')),
+        'linear_solve_time': sum(col('linear_solve_time')),
+        'domain_time_total': sum(times),
+        'domain_time_min': min(times),
+        'domain_time_max': max(times),
+        'domain_time_mean': sum(times) / len(times),
+    }
+    return summary
+
+
+def run_case(flow, deck, extra_args, rundir, mpi_procs):
+    os.makedirs(rundir, exist_ok=True)
+    cmd = []
+    if mpi_procs > 1:
+        cmd += ['mpirun', '-np', str(mpi_procs)]
+    cmd += [flow, deck, f'--output-dir={rundir}'] + extra_args
+    start = time.monotonic()
+    result = subprocess.run(cmd, stdout=subprocess.DEVNULL,
+                            stderr=subprocess.STDOUT)
+    elapsed = time.monotonic() - start
+    return elapsed, result.returncode
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--flow', required=True, help='path to the flow binary')
+    parser.add_argument('--deck', required=True, help='input deck (.DATA)')
+    parser.add_argument('--flow-args', default='',
+                        help='extra arguments passed to every run, e.g. '
+                             '--load-file/--load-step to replay a snapshot')
+    parser.add_argument('--sweep', action='append', default=[],
+                        metavar='NAME=V1,V2,...',
+                        help='NLDD parameter to sweep (without leading --); '
+                             'may be given multiple times, the cross product is run')
+    parser.add_argument('--mpi-procs', type=int, default=1)
+    parser.add_argument('--output-dir', default='nldd_sweep')
+    parser.add_argument('--keep-run-output', action='store_true',
+                        help='keep the per-run output directories '
+                             '(deleted by default to save space)')
+    parser.add_argument('--skip-global', action='store_true',
+                        help='do not run the global Newton baseline')
+    args = parser.parse_args()
+
+    base_args = args.flow_args.split()
+    sweeps = [parse_sweep(s) for s in args.sweep]
+    os.makedirs(args.output_dir, exist_ok=True)
+
+    runs = []
+    if not args.skip_global:
+        runs.append(('newton', {}))
+    for combo in itertools.product(*(values for _, values in sweeps)):
+        params = dict(zip((name for name, _ in sweeps), combo))
+        runs.append(('nldd', params))
+
+    summary_fields = ['run', 'nonlinear_solver', 'returncode', 'wall_time',
+                      'num_domains', 'newton_iterations', 'linear_iterations',
+                      'assemble_time', 'linear_solve_time', 'domain_time_total',
+                      'domain_time_min', 'domain_time_max', 'domain_time_mean']
+    summary_fields += [name for name, _ in sweeps]
+
+    summary_path = os.path.join(args.output_dir, 'summary.csv')
+    with open(summary_path, 'w', newline='') as f:
+        writer = csv.DictWriter(f, fieldnames=summary_fields)
+        writer.writeheader()
+
+        for idx, (solver, params) in enumerate(runs):
+            tag = '_'.join([solver] + [f'{k}_{v}' for k, v in params.items()])
+            rundir = os.path.join(args.output_dir, f'run{idx:03d}_{tag}')
+            extra = base_args + [f'--nonlinear-solver={solver}']
+            extra += [f'--{k}={v}' for k, v in params.items()]
+
+            print(f'[{idx + 1}/{len(runs)}] {solver} {params} ...',
+                  end=' ', flush=True)
+            elapsed, rc = run_case(args.flow, args.deck, extra,
+                                   rundir, args.mpi_procs)
+            print(f'{elapsed:.1f}s' + ('' if rc == 0 else f' (FAILED rc={rc})'))
+
+            row = {'run': tag, 'nonlinear_solver': solver,
+                   'returncode': rc, 'wall_time': f'{elapsed:.3f}'}
+            row.update(params)
+            if solver == 'nldd' and rc == 0:
+                row.update(domain_cost_summary(rundir))
+            writer.writerow(row)
+            f.flush()
+
+            if not args.keep_run_output:
+                shutil.rmtree(rundir, ignore_errors=True)
+
+    print(f'wrote {summary_path}')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+"""Decode and summarize flow's per-rank step telemetry logs.
+
+When flow runs with --enable-step-telemetry=true, every rank writes one
+fixed-width binary record per report step to CASENAME.TELEMETRY.<rank>
+(see StepTelemetry.hpp for the producer). This script decodes one or
+more such files and either dumps them as CSV or prints a per-step
+summary across ranks, highlighting imbalance: for each report step the
+min/max/mean of the step wall work (assembly + linear solve) and the
+rank holding the maximum.
+
+Typical usage:
+
+  step_telemetry.py CASE.TELEMETRY.*            # per-step summary
+  step_telemetry.py --csv CASE.TELEMETRY.* > telemetry.csv
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = b"OPMSTEP1"
+
+# Keep in sync with StepTelemetryWriter::Record.
+RECORD_FORMAT = "<8i8d"
+RECORD_FIELDS = [
+    "report_step",
+    "newton_iterations",
+    "linear_iterations",
+    "linearizations",
+    "well_iterations",
+    "wasted_linearizations",
+    "wasted_linear_iterations",
+    "unused",
+    "timestep_length",
+    "assemble_time",
+    "assemble_time_well",
+    "linear_solve_time",
+    "linear_solve_setup_time",
+    "update_time",
+    "pre_post_time",
+    "memory_highwater_bytes",
+]
+
+
+def read_file(path):
+    """Return (rank, comm_size, records) for one telemetry file."""
+    with open(path, "rb") as f:
+        header = f.read(len(MAGIC) + 4 + 4 + 4)
+        if header[: len(MAGIC)] != MAGIC:
+            raise ValueError(f"{path}: not a telemetry log (bad magic)")
+        record_size, rank, comm_size = struct.unpack_from("<Iii", header, len(MAGIC))
+        if record_size != struct.calcsize(RECORD_FORMAT):
+            raise ValueError(
+                f"{path}: record size {record_size} does not match this "
+                f"script ({struct.calcsize(RECORD_FORMAT)}); version mismatch?"
+            )
+        records = []
+        while True:
+            data = f.read(record_size)
+            if len(data) < record_size:
+                break
+            records.append(dict(zip(RECORD_FIELDS, struct.unpack(RECORD_FORMAT, data))))
+        return rank, comm_size, records
+
+
+def dump_csv(files, out):
+    out.write("rank," + ",".join(f for f in RECORD_FIELDS if f != "unused") + "\n")
+    for path in files:
+        rank, _, records = read_file(path)
+        for rec in records:
+            row = [str(rank)] + [
+                str(rec[f]) for f in RECORD_FIELDS if f != "unused"
+            ]
+            out.write(",".join(row) + "\n")
+
+
+def step_work(rec):
+    return rec["assemble_time"] + rec["assemble_time_well"] + rec["linear_solve_time"]
+
+
+def summarize(files, out):
+    by_step = {}
+    for path in files:
+        rank, _, records = read_file(path)
+        for rec in records:
+            by_step.setdefault(rec["report_step"], []).append((rank, rec))
+
+    out.write(
+        f"{'step':>5} {'ranks':>5} {'newton':>6} {'linear':>7} "
+        f"{'work min':>9} {'work max':>9} {'work mean':>9} "
+        f"{'max rank':>8} {'mem max (GB)':>12}\n"
+    )
+    for step in sorted(by_step):
+        entries = by_step[step]
+        work = [step_work(rec) for _, rec in entries]
+        max_rank = max(entries, key=lambda e: step_work(e[1]))[0]
+        mem_max = max(rec["memory_highwater_bytes"] for _, rec in entries)
+        newton = max(rec["newton_iterations"] for _, rec in entries)
+        linear = max(rec["linear_iterations"] for _, rec in entries)
+        out.write(
+            f"{step:>5} {len(entries):>5} {newton:>6} {linear:>7} "
+            f"{min(work):>9.3f} {max(work):>9.3f} {sum(work) / len(work):>9.3f} "
+            f"{max_rank:>8} {mem_max / 1e9:>12.3f}\n"
+        )
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter
+    )
+    parser.add_argument("files", nargs="+", help="CASENAME.TELEMETRY.<rank> files")
+    parser.add_argument(
+        "--csv", action="store_true", help="dump all records as CSV instead of summarizing"
+    )
+    args = parser.parse_args()
+
+    if args.csv:
+        dump_csv(args.files, sys.stdout)
+    else:
+        summarize(args.files, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
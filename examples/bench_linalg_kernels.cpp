@@ -0,0 +1,272 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// \file
+///
+/// Microbenchmark for the sequential linear algebra kernels.
+///
+/// Loads a matrix and right-hand side in MatrixMarket format -- as
+/// written by the --write-system-matrix support in
+/// WriteSystemMatrixHelper.hpp or by test data in tests/ -- and times
+/// SpMV plus the apply() of preconditioners created through
+/// PreconditionerFactory (ILU0, DILU, AMG, CPR, ...).  This makes it
+/// possible to evaluate preconditioner changes on matrices from real
+/// runs without rerunning the full field case.
+///
+/// Usage:
+///   bench_linalg_kernels -m MATRIX -r RHS [-b BLOCKSIZE] [-n REPS]
+///                        [-p PREC[,PREC...]] [-c CONFIG.json]
+///
+/// The block size (1-4) must match the one the matrix was dumped with.
+/// With -c, the named JSON file is used as the preconditioner
+/// configuration (same format as --linear-solver=FILE.json) instead of
+/// the built-in list.
+
+#include <config.h>
+
+#include <opm/simulators/linalg/matrixblock.hh>
+#include <opm/simulators/linalg/ilufirstelement.hh>
+
+#include <opm/simulators/linalg/FlexibleSolver.hpp>
+#include <opm/simulators/linalg/PreconditionerFactory_impl.hpp>
+#include <opm/simulators/linalg/PropertyTree.hpp>
+#include <opm/simulators/linalg/SellCSigmaMatrix.hpp>
+#include <opm/simulators/linalg/getQuasiImpesWeights.hpp>
+
+#include <dune/common/fvector.hh>
+#include <dune/common/timer.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+#include <dune/istl/matrixmarket.hh>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+struct Options
+{
+    std::string matrixFile{};
+    std::string rhsFile{};
+    std::string configFile{};
+    std::vector<std::string> preconditioners{"ILU0", "DILU", "amg", "cpr"};
+    int blockSize = 3;
+    int repetitions = 100;
+};
+
+void usage(const char* argv0)
+{
+    std::cerr << "Usage: " << argv0
+              << " -m MATRIX -r RHS [-b BLOCKSIZE] [-n REPS]"
+              << " [-p PREC[,PREC...]] [-c CONFIG.json]\n";
+    std::exit(EXIT_FAILURE);
+}
+
+Options parseOptions(int argc, char** argv)
+{
+    Options opts;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+        }
+        const std::string value = argv[++i];
+        if (arg == "-m") {
+            opts.matrixFile = value;
+        } else if (arg == "-r") {
+            opts.rhsFile = value;
+        } else if (arg == "-c") {
+            opts.configFile = value;
+        } else if (arg == "-b") {
+            opts.blockSize = std::stoi(value);
+        } else if (arg == "-n") {
+            opts.repetitions = std::stoi(value);
+        } else if (arg == "-p") {
+            opts.preconditioners.clear();
+            std::istringstream ss(value);
+            std::string name;
+            while (std::getline(ss, name, ',')) {
+                opts.preconditioners.push_back(name);
+            }
+        } else {
+            usage(argv[0]);
+        }
+    }
+
+    if (opts.matrixFile.empty() || opts.rhsFile.empty()
+        || opts.blockSize < 1 || opts.blockSize > 4)
+    {
+        usage(argv[0]);
+    }
+
+    return opts;
+}
+
+//! Default factory configuration for one preconditioner type.
+Opm::PropertyTree defaultConfig(const std::string& type)
+{
+    Opm::PropertyTree prm;
+    prm.put("type", type);
+    if (type == "cpr" || type == "cprt") {
+        prm.put("weight_type", std::string("quasiimpes"));
+        prm.put("finesmoother.type", std::string("ParOverILU0"));
+    }
+    return prm;
+}
+
+//! Time \p reps calls of \p op and report the fastest one.
+template <class Callable>
+void timeKernel(const std::string& label,
+                const int reps,
+                const std::size_t dofs,
+                Callable&& op)
+{
+    // one untimed call to warm caches and finish lazy setup
+    op();
+
+    double best = std::numeric_limits<double>::max();
+    Dune::Timer timer(false);
+    for (int rep = 0; rep < reps; ++rep) {
+        timer.reset();
+        timer.start();
+        op();
+        best = std::min(best, timer.stop());
+    }
+
+    std::cout << fmt::format("  {:24s} {:10.3f} ms/apply  {:8.2f} MDof/s\n",
+                             label, 1e3 * best, dofs / best / 1e6);
+}
+
+template <int bz>
+void benchBlockSize(const Options& opts)
+{
+    using Matrix = Dune::BCRSMatrix<Opm::MatrixBlock<double, bz, bz>>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<double, bz>>;
+
+    Matrix matrix;
+    {
+        std::ifstream mfile(opts.matrixFile);
+        if (!mfile) {
+            throw std::runtime_error("Could not read matrix file " + opts.matrixFile);
+        }
+        using M = Dune::BCRSMatrix<Dune::FieldMatrix<double, bz, bz>>;
+        readMatrixMarket(reinterpret_cast<M&>(matrix), mfile); // Hack to avoid hassle
+    }
+    Vector rhs;
+    {
+        std::ifstream rhsfile(opts.rhsFile);
+        if (!rhsfile) {
+            throw std::runtime_error("Could not read rhs file " + opts.rhsFile);
+        }
+        readMatrixMarket(rhs, rhsfile);
+    }
+    if (rhs.size() != matrix.N()) {
+        throw std::runtime_error(
+            fmt::format("Matrix ({} rows) and rhs ({} entries) do not match; "
+                        "check the block size (-b {})",
+                        matrix.N(), rhs.size(), bz));
+    }
+
+    const std::size_t dofs = matrix.N() * bz;
+    std::cout << fmt::format("{} rows, block size {}, {} nonzero blocks, {} repetitions\n",
+                             matrix.N(), bz, matrix.nonzeroes(), opts.repetitions);
+
+    Vector x(rhs.size());
+    x = 0.0;
+
+    timeKernel("SpMV (BCRS)", opts.repetitions, dofs,
+               [&matrix, &x, &rhs]() { matrix.mv(rhs, x); });
+
+    const Opm::SellCSigmaMatrix<Matrix> sell(matrix);
+    timeKernel("SpMV (SELL-C-sigma)", opts.repetitions, dofs,
+               [&sell, &x, &rhs]() { sell.mv(rhs, x); });
+
+    using Operator = Dune::MatrixAdapter<Matrix, Vector, Vector>;
+    Operator op(matrix);
+    using PrecFactory = Opm::PreconditionerFactory<Operator, Dune::Amg::SequentialInformation>;
+
+    std::vector<Opm::PropertyTree> configs;
+    if (!opts.configFile.empty()) {
+        // accept both a bare preconditioner configuration and a full
+        // --linear-solver style file with a "preconditioner" subtree
+        const Opm::PropertyTree prm(opts.configFile);
+        if (const auto child = prm.get_child_optional("preconditioner")) {
+            configs.push_back(*child);
+        } else {
+            configs.push_back(prm);
+        }
+    } else {
+        for (const auto& type : opts.preconditioners) {
+            configs.push_back(defaultConfig(type));
+        }
+    }
+
+    for (const auto& prm : configs) {
+        const auto type = prm.get<std::string>("type");
+
+        std::function<Vector()> wc{};
+        if constexpr (bz > 1) {
+            const bool transpose = (type == "cprt");
+            wc = [&matrix, transpose]()
+            {
+                return Opm::Amg::getQuasiImpesWeights<Matrix, Vector>(matrix, 1, transpose, false);
+            };
+        }
+
+        try {
+            auto prec = PrecFactory::create(op, prm, wc, 1);
+            prec->pre(x, rhs);
+            timeKernel(type + "::apply", opts.repetitions, dofs,
+                       [&prec, &x, &rhs]() { prec->apply(x, rhs); });
+            prec->post(x);
+        } catch (const std::exception& e) {
+            std::cout << fmt::format("  {:24s} skipped ({})\n", type, e.what());
+        }
+    }
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+try {
+    const Options opts = parseOptions(argc, argv);
+
+    switch (opts.blockSize) {
+    case 1: benchBlockSize<1>(opts); break;
+    case 2: benchBlockSize<2>(opts); break;
+    case 3: benchBlockSize<3>(opts); break;
+    case 4: benchBlockSize<4>(opts); break;
+    }
+
+    return EXIT_SUCCESS;
+}
+catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << '\n';
+    return EXIT_FAILURE;
+}
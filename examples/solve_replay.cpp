@@ -0,0 +1,298 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// \file
+///
+/// Replay exported linear systems through the flow solver stack.
+///
+/// Loads matrix/right-hand-side pairs in MatrixMarket format -- as
+/// written to <case>/reports/ by WriteSystemMatrixHelper.hpp when the
+/// linear solver verbosity exceeds 10 -- and solves them with a
+/// FlexibleSolver configured from the same JSON files that
+/// --linear-solver=FILE.json accepts.  Every preconditioner known to
+/// PreconditionerFactory is available, including the gpuistl backends
+/// (gpuilu0, gpudilu, opmgpuilu0, ...) in CUDA/HIP builds, and the tool
+/// reports a per-phase breakdown: solver setup, preconditioner update,
+/// a single preconditioner application, and the iterative solve itself.
+/// This replaces rerunning a full field case when triaging solver
+/// behaviour on a problematic system.
+///
+/// Usage:
+///   solve_replay -c CONFIG.json (-m MATRIX -r RHS | -d DUMPDIR)
+///                [-b BLOCKSIZE] [-i PRESSUREINDEX]
+///
+/// With -d, every "*_matrix_istl.mm" file in the directory is replayed
+/// against its matching "*_vector_istl.mm" companion.  The block size
+/// (1-6) must match the one the system was dumped with.  Note that the
+/// dumped Jacobian already carries the well contributions the simulator
+/// had assembled into the reservoir rows at dump time; the Schur
+/// complement operator of the well model is not part of the export.
+
+#include <config.h>
+
+#include <opm/simulators/linalg/matrixblock.hh>
+#include <opm/simulators/linalg/ilufirstelement.hh>
+
+#include <opm/simulators/linalg/FlexibleSolver.hpp>
+#include <opm/simulators/linalg/MatrixMarketSpecializations.hpp>
+#include <opm/simulators/linalg/PropertyTree.hpp>
+#include <opm/simulators/linalg/getQuasiImpesWeights.hpp>
+
+#include <dune/common/fvector.hh>
+#include <dune/common/timer.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+#include <dune/istl/matrixmarket.hh>
+#include <dune/istl/operators.hh>
+#include <dune/istl/solver.hh>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+struct Options
+{
+    std::string configFile{};
+    std::string dumpDir{};
+    std::vector<std::pair<std::string, std::string>> systems{};
+    int blockSize = 3;
+    std::size_t pressureIndex = 1;
+};
+
+void usage(const char* argv0)
+{
+    std::cerr << "Usage: " << argv0
+              << " -c CONFIG.json (-m MATRIX -r RHS | -d DUMPDIR)"
+              << " [-b BLOCKSIZE] [-i PRESSUREINDEX]\n";
+    std::exit(EXIT_FAILURE);
+}
+
+Options parseOptions(int argc, char** argv)
+{
+    Options opts;
+    std::string matrixFile;
+    std::string rhsFile;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+        }
+        const std::string value = argv[++i];
+        if (arg == "-c") {
+            opts.configFile = value;
+        } else if (arg == "-m") {
+            matrixFile = value;
+        } else if (arg == "-r") {
+            rhsFile = value;
+        } else if (arg == "-d") {
+            opts.dumpDir = value;
+        } else if (arg == "-b") {
+            opts.blockSize = std::stoi(value);
+        } else if (arg == "-i") {
+            opts.pressureIndex = std::stoul(value);
+        } else {
+            usage(argv[0]);
+        }
+    }
+
+    if (!matrixFile.empty() && !rhsFile.empty()) {
+        opts.systems.emplace_back(matrixFile, rhsFile);
+    }
+
+    if (opts.configFile.empty()
+        || (opts.systems.empty() == opts.dumpDir.empty())
+        || opts.blockSize < 1 || opts.blockSize > 6)
+    {
+        usage(argv[0]);
+    }
+
+    return opts;
+}
+
+//! Pair every "*_matrix_istl.mm" in \p dir with its "*_vector_istl.mm" companion.
+std::vector<std::pair<std::string, std::string>>
+findDumpedSystems(const std::string& dir)
+{
+    namespace fs = std::filesystem;
+    const std::string matrixTag = "_matrix_istl";
+    const std::string vectorTag = "_vector_istl";
+
+    std::vector<std::pair<std::string, std::string>> systems;
+    for (const auto& entry : fs::directory_iterator(dir)) {
+        const auto name = entry.path().filename().string();
+        const auto pos = name.find(matrixTag);
+        if (!entry.is_regular_file() || pos == std::string::npos) {
+            continue;
+        }
+        auto rhsName = name;
+        rhsName.replace(pos, matrixTag.size(), vectorTag);
+        const auto rhsPath = entry.path().parent_path() / rhsName;
+        if (fs::exists(rhsPath)) {
+            systems.emplace_back(entry.path().string(), rhsPath.string());
+        } else {
+            std::cerr << "Warning: no companion " << rhsName
+                      << " for " << name << ", skipping.\n";
+        }
+    }
+    std::sort(systems.begin(), systems.end());
+    if (systems.empty()) {
+        throw std::runtime_error("No '*" + matrixTag + "*' files found in " + dir);
+    }
+    return systems;
+}
+
+//! Run \p op once and return the wall time spent in it.
+template <class Callable>
+double timePhase(Callable&& op)
+{
+    Dune::Timer timer;
+    op();
+    return timer.stop();
+}
+
+template <int bz>
+void replaySystem(const Options& opts,
+                  const Opm::PropertyTree& prm,
+                  const std::string& matrixFile,
+                  const std::string& rhsFile)
+{
+    using Matrix = Dune::BCRSMatrix<Opm::MatrixBlock<double, bz, bz>>;
+    using Vector = Dune::BlockVector<Dune::FieldVector<double, bz>>;
+
+    Matrix matrix;
+    {
+        std::ifstream mfile(matrixFile);
+        if (!mfile) {
+            throw std::runtime_error("Could not read matrix file " + matrixFile);
+        }
+        using M = Dune::BCRSMatrix<Dune::FieldMatrix<double, bz, bz>>;
+        readMatrixMarket(reinterpret_cast<M&>(matrix), mfile); // Hack to avoid hassle
+    }
+    Vector rhs;
+    {
+        std::ifstream rhsfile(rhsFile);
+        if (!rhsfile) {
+            throw std::runtime_error("Could not read rhs file " + rhsFile);
+        }
+        readMatrixMarket(rhs, rhsfile);
+    }
+    if (rhs.size() != matrix.N()) {
+        throw std::runtime_error(
+            fmt::format("Matrix ({} rows) and rhs ({} entries) do not match; "
+                        "check the block size (-b {})",
+                        matrix.N(), rhs.size(), bz));
+    }
+
+    std::cout << fmt::format("=== {}\n    {} rows, block size {}, {} nonzero blocks\n",
+                             std::filesystem::path(matrixFile).filename().string(),
+                             matrix.N(), bz, matrix.nonzeroes());
+
+    using Operator = Dune::MatrixAdapter<Matrix, Vector, Vector>;
+    using Solver = Dune::FlexibleSolver<Operator>;
+    Operator op(matrix);
+
+    std::function<Vector()> weightsCalculator{};
+    if constexpr (bz > 1) {
+        const bool transpose =
+            prm.get<std::string>("preconditioner.type", "") == "cprt";
+        const auto pidx = opts.pressureIndex;
+        weightsCalculator = [&matrix, transpose, pidx]()
+        {
+            return Opm::Amg::getQuasiImpesWeights<Matrix, Vector>(matrix, pidx, transpose, false);
+        };
+    }
+
+    std::unique_ptr<Solver> solver;
+    const double setupTime = timePhase([&]() {
+        solver = std::make_unique<Solver>(op, prm, weightsCalculator, opts.pressureIndex);
+    });
+    std::cout << fmt::format("    setup       {:10.3f} ms   (operator + preconditioner creation)\n",
+                             1e3 * setupTime);
+
+    // The simulator refreshes an existing preconditioner far more often
+    // than it creates one, so report that phase separately.
+    const double updateTime = timePhase([&]() { solver->preconditioner().update(); });
+    std::cout << fmt::format("    update      {:10.3f} ms   (preconditioner refresh)\n",
+                             1e3 * updateTime);
+
+    Vector x(rhs.size());
+    x = 0.0;
+    const double applyTime = timePhase([&]() { solver->preconditioner().apply(x, rhs); });
+    std::cout << fmt::format("    prec apply  {:10.3f} ms   (single application)\n",
+                             1e3 * applyTime);
+
+    x = 0.0;
+    auto b = rhs; // the solve consumes the right-hand side
+    Dune::InverseOperatorResult result;
+    const double solveTime = timePhase([&]() { solver->apply(x, b, result); });
+    std::cout << fmt::format("    solve       {:10.3f} ms   ({} iterations, {:.3f} ms/iteration)\n",
+                             1e3 * solveTime, result.iterations,
+                             1e3 * solveTime / std::max(result.iterations, 1));
+    std::cout << fmt::format("    {}   (defect reduction {:.2e}, convergence rate {:.3f})\n",
+                             result.converged ? "converged    " : "NOT converged",
+                             result.reduction, result.conv_rate);
+}
+
+template <int bz>
+void replayAll(const Options& opts)
+{
+    const Opm::PropertyTree prm(opts.configFile);
+
+    auto systems = opts.systems;
+    if (!opts.dumpDir.empty()) {
+        systems = findDumpedSystems(opts.dumpDir);
+    }
+
+    for (const auto& [matrixFile, rhsFile] : systems) {
+        replaySystem<bz>(opts, prm, matrixFile, rhsFile);
+    }
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+try {
+    const Options opts = parseOptions(argc, argv);
+
+    switch (opts.blockSize) {
+    case 1: replayAll<1>(opts); break;
+    case 2: replayAll<2>(opts); break;
+    case 3: replayAll<3>(opts); break;
+    case 4: replayAll<4>(opts); break;
+    case 5: replayAll<5>(opts); break;
+    case 6: replayAll<6>(opts); break;
+    }
+
+    return EXIT_SUCCESS;
+}
+catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << '\n';
+    return EXIT_FAILURE;
+}
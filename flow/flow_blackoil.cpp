@@ -80,4 +80,13 @@ int flowBlackoilTpfaMainStandalone(int argc, char** argv)
     return ret;
 }
 
+int flowBlackoilTpfaMainEnsemble(int argc, char** argv)
+{
+    using TypeTag = Properties::TTag::FlowProblemTPFA;
+    // The ensemble driver initializes and finalizes MPI itself, so this
+    // Main object must not take ownership of it.
+    Opm::Main mainObject(argc, argv, /*ownMPI=*/false);
+    return mainObject.runStatic<TypeTag>();
+}
+
 } // namespace Opm
@@ -35,6 +35,10 @@ flowBlackoilTpfaMainInit(int argc, char** argv, bool outputCout, bool outputFile
 //! \brief Main function used in flow_brine binary.
 int flowBlackoilTpfaMainStandalone(int argc, char** argv);
 
+//! \brief Main function used in the flow_blackoil_ensemble driver.
+//! Does not take ownership of MPI, so several runs can share one process.
+int flowBlackoilTpfaMainEnsemble(int argc, char** argv);
+
 }
 
 #endif // FLOW_BLACKOIL_TPFA_HPP
@@ -0,0 +1,153 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <flow/flow_blackoil.hpp>
+
+#include <opm/simulators/flow/FlowGenericVanguard.hpp>
+#include <opm/simulators/flow/Main.hpp>
+
+#include <opm/models/utils/parametersystem.hpp>
+
+#if HAVE_MPI
+#include <mpi.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+void printUsage(const char* prog)
+{
+    std::cerr << "Usage: " << prog
+              << " [--ensemble-group-size=N] [flow options...] CASE1 CASE2 [CASE3 ...]\n"
+              << "\n"
+              << "Runs the given realizations within a single process per rank,\n"
+              << "amortizing process startup, MPI initialization and simulator\n"
+              << "dispatch over the whole ensemble. When more MPI ranks than\n"
+              << "--ensemble-group-size are available, the ranks are split into\n"
+              << "groups of that size and the realizations are distributed\n"
+              << "round-robin over the groups, so several realizations run\n"
+              << "concurrently on one node. All flow options are passed on to\n"
+              << "every realization; make sure the cases use distinct output\n"
+              << "directories.\n";
+}
+
+} // anonymous namespace
+
+int main(int argc, char** argv)
+{
+    // Separate the driver option and the input decks from the flow options.
+    int groupSize = 0;
+    std::vector<std::string> options;
+    std::vector<std::string> decks;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        constexpr std::string_view groupSizeOpt = "--ensemble-group-size=";
+        if (arg.rfind(groupSizeOpt, 0) == 0) {
+            groupSize = std::stoi(arg.substr(groupSizeOpt.size()));
+        }
+        else if (!arg.empty() && arg[0] == '-') {
+            options.push_back(arg);
+        }
+        else {
+            decks.push_back(arg);
+        }
+    }
+
+    if (decks.empty()) {
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // This object initializes MPI and the accelerator runtimes and finalizes
+    // them when it goes out of scope at the end of main(); the individual
+    // realizations below run with ownMPI=false.
+    Opm::Main mpiGuard(argc, argv, /*ownMPI=*/true);
+
+    // Keep a handle to the world communicator; the vanguard communication
+    // may be replaced by a group communicator below.
+    const auto worldComm = Opm::FlowGenericVanguard::comm();
+    const int worldSize = worldComm.size();
+    const int worldRank = worldComm.rank();
+
+    // With more ranks than the requested group size, split the world
+    // communicator into groups of that size; every group then runs its
+    // round-robin share of the realizations concurrently and independently.
+    int numGroups = 1;
+    int myGroup = 0;
+#if HAVE_MPI
+    if (groupSize > 0 && worldSize > groupSize) {
+        numGroups = (worldSize + groupSize - 1) / groupSize;
+        myGroup = worldRank / groupSize;
+        MPI_Comm groupComm;
+        MPI_Comm_split(worldComm, myGroup, worldRank, &groupComm);
+        Opm::FlowGenericVanguard::setCommunication(
+            std::make_unique<Opm::Parallel::Communication>(groupComm));
+    }
+#endif
+
+    int exitCode = EXIT_SUCCESS;
+    bool first = true;
+    for (std::size_t i = 0; i < decks.size(); ++i) {
+        if (static_cast<int>(i % numGroups) != myGroup) {
+            continue;
+        }
+
+        // the parameter registry still holds the registrations of the
+        // previous realization
+        if (!first) {
+            Opm::Parameters::reset();
+        }
+        first = false;
+
+        std::vector<std::string> args;
+        args.reserve(options.size() + 2);
+        args.push_back(argv[0]);
+        args.insert(args.end(), options.begin(), options.end());
+        args.push_back(decks[i]);
+        std::vector<char*> argPointers;
+        argPointers.reserve(args.size() + 1);
+        for (auto& arg : args) {
+            argPointers.push_back(arg.data());
+        }
+        argPointers.push_back(nullptr);
+
+        const int ret = Opm::flowBlackoilTpfaMainEnsemble(static_cast<int>(args.size()),
+                                                          argPointers.data());
+        if (Opm::FlowGenericVanguard::comm().rank() == 0) {
+            std::cout << "=== Ensemble realization " << i + 1 << '/' << decks.size()
+                      << " (" << decks[i] << ") finished with exit code "
+                      << ret << " ===" << std::endl;
+        }
+        exitCode = std::max(exitCode, ret);
+    }
+
+    // report a failure of any realization in the exit code of every rank
+    exitCode = worldComm.max(exitCode);
+    return exitCode;
+}
@@ -62,6 +62,7 @@ class BlackOilFoamModule
     using Evaluation = GetPropType<TypeTag, Properties::Evaluation>;
     using PrimaryVariables = GetPropType<TypeTag, Properties::PrimaryVariables>;
     using IntensiveQuantities = GetPropType<TypeTag, Properties::IntensiveQuantities>;
+    using ExtensiveQuantities = GetPropType<TypeTag, Properties::ExtensiveQuantities>;
     using ElementContext = GetPropType<TypeTag, Properties::ElementContext>;
     using FluidSystem = GetPropType<TypeTag, Properties::FluidSystem>;
     using Model = GetPropType<TypeTag, Properties::Model>;
@@ -221,17 +222,7 @@ public:
                 case Phase::WATER: {
                     const unsigned upIdx = extQuants.upstreamIndex(waterPhaseIdx);
                     const auto& up = elemCtx.intensiveQuantities(upIdx, timeIdx);
-                    if (upIdx == inIdx) {
-                        flux[contiFoamEqIdx] =
-                            extQuants.volumeFlux(waterPhaseIdx) *
-                            up.fluidState().invB(waterPhaseIdx) *
-                            up.foamConcentration();
-                    } else {
-                        flux[contiFoamEqIdx] =
-                            extQuants.volumeFlux(waterPhaseIdx) *
-                            decay<Scalar>(up.fluidState().invB(waterPhaseIdx)) *
-                            decay<Scalar>(up.foamConcentration());
-                    }
+                    addFoamFluxes_(flux, extQuants, up, upIdx == inIdx);
                     break;
                 }
                 case Phase::GAS: {
@@ -275,6 +266,37 @@ public:
         }
     }
 
+    /*!
+     * \brief Like computeFlux() for foam transported in the water
+     *        phase, with the upstream quantities already resolved by
+     *        the caller.
+     *
+     * Must only be called when transportPhase() is Phase::WATER; the
+     * gas and solvent transport phases resolve their own upstream
+     * direction in computeFlux().
+     */
+    static void addFoamFluxes_([[maybe_unused]] RateVector& flux,
+                               [[maybe_unused]] const ExtensiveQuantities& extQuants,
+                               [[maybe_unused]] const IntensiveQuantities& up,
+                               [[maybe_unused]] const bool upIsInterior)
+    {
+        if constexpr (enableFoam) {
+            assert(transportPhase() == Phase::WATER);
+
+            if (upIsInterior) {
+                flux[contiFoamEqIdx] =
+                    extQuants.volumeFlux(waterPhaseIdx) *
+                    up.fluidState().invB(waterPhaseIdx) *
+                    up.foamConcentration();
+            } else {
+                flux[contiFoamEqIdx] =
+                    extQuants.volumeFlux(waterPhaseIdx) *
+                    decay<Scalar>(up.fluidState().invB(waterPhaseIdx)) *
+                    decay<Scalar>(up.foamConcentration());
+            }
+        }
+    }
+
     /*!
      * \brief Return how much a Newton-Raphson update is considered an error
      */
@@ -275,14 +275,12 @@ public:
             asImp_().solventPreSatFuncUpdate_(priVars, timeIdx, lintype);
         }
 
-        // Phase relperms.
-        problem.template updateRelperms<FluidState, Args...>(mobility_, dirMob_, fluidState_, globalSpaceIdx);
-
-        // now we compute all phase pressures
+        // Phase relperms and capillary pressures, sharing the material law
+        // parameter lookup between the two evaluations.
         using EvalArr = std::array<Evaluation, numPhases>;
         EvalArr pC;
-        const auto& materialParams = problem.materialLawParams(globalSpaceIdx);
-        MaterialLaw::template capillaryPressures<EvalArr, FluidState, Args...>(pC, materialParams, fluidState_);
+        problem.template updateRelpermsAndCapillaryPressures<FluidState, Args...>(
+            mobility_, dirMob_, pC, fluidState_, globalSpaceIdx);
 
         // scaling the capillary pressure due to porosity changes
         if constexpr (enableBrine) {
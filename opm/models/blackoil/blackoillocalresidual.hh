@@ -86,6 +86,9 @@ class BlackOilLocalResidual : public GetPropType<TypeTag, Properties::DiscLocalR
     static constexpr bool enableFullyImplicitThermal = (getPropValue<TypeTag, Properties::EnergyModuleType>() == EnergyModules::FullyImplicitThermal);
     static constexpr bool enableDiffusion = getPropValue<TypeTag, Properties::EnableDiffusion>();
     static constexpr bool enableConvectiveMixing = getPropValue<TypeTag, Properties::EnableConvectiveMixing>();
+    static constexpr bool enablePolymer = getPropValue<TypeTag, Properties::EnablePolymer>();
+    static constexpr bool enableFoam = getPropValue<TypeTag, Properties::EnableFoam>();
+    static constexpr bool enableBrine = getPropValue<TypeTag, Properties::EnableBrine>();
 
     using Toolbox = MathToolbox<Evaluation>;
     using SolventModule = BlackOilSolventModule<TypeTag>;
@@ -230,17 +233,49 @@ public:
         // deal with zFracton (if present)
         ExtboModule::computeFlux(flux, elemCtx, scvfIdx, timeIdx);
 
-        // deal with polymer (if present)
-        PolymerModule::computeFlux(flux, elemCtx, scvfIdx, timeIdx);
+        // deal with polymer, foam and salt (if present). These are all
+        // transported in the water phase, so resolve the water-phase
+        // upstream quantities once and hand them to each enabled module
+        // instead of having every module repeat the lookup.
+        if constexpr (enablePolymer || enableFoam || enableBrine) {
+            if (FluidSystem::phaseIsActive(waterPhaseIdx)) {
+                const unsigned upIdx = static_cast<unsigned>(extQuants.upstreamIndex(waterPhaseIdx));
+                const IntensiveQuantities& up = elemCtx.intensiveQuantities(upIdx, timeIdx);
+                const bool upIsInterior = upIdx == extQuants.interiorIndex();
+
+                if constexpr (enablePolymer) {
+                    PolymerModule::addPolymerFluxes_(flux, extQuants, up, upIsInterior);
+                }
 
-        // deal with energy (if present)
-        EnergyModule::computeFlux(flux, elemCtx, scvfIdx, timeIdx);
+                if constexpr (enableFoam) {
+                    if (FoamModule::transportPhase() == Phase::WATER) {
+                        FoamModule::addFoamFluxes_(flux, extQuants, up, upIsInterior);
+                    }
+                    else {
+                        // gas or solvent transport resolves its own
+                        // upstream direction
+                        FoamModule::computeFlux(flux, elemCtx, scvfIdx, timeIdx);
+                    }
+                }
 
-        // deal with foam (if present)
-        FoamModule::computeFlux(flux, elemCtx, scvfIdx, timeIdx);
+                if constexpr (enableBrine) {
+                    if (upIdx == focusDofIdx) {
+                        BrineModule::template addBrineFluxes_<Evaluation>(
+                            flux, waterPhaseIdx, extQuants.volumeFlux(waterPhaseIdx), up.fluidState());
+                    }
+                    else {
+                        BrineModule::template addBrineFluxes_<Scalar>(
+                            flux, waterPhaseIdx, extQuants.volumeFlux(waterPhaseIdx), up.fluidState());
+                    }
+                }
+            }
+            else if constexpr (enableFoam) {
+                FoamModule::computeFlux(flux, elemCtx, scvfIdx, timeIdx);
+            }
+        }
 
-        // deal with salt (if present)
-        BrineModule::computeFlux(flux, elemCtx, scvfIdx, timeIdx);
+        // deal with energy (if present)
+        EnergyModule::computeFlux(flux, elemCtx, scvfIdx, timeIdx);
 
         // deal with bioeffects (if present)
         BioeffectsModule::computeFlux(flux, elemCtx, scvfIdx, timeIdx);
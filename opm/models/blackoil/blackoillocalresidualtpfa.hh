@@ -101,6 +101,20 @@ class BlackOilLocalResidualTPFA : public GetPropType<TypeTag, Properties::DiscLo
     static constexpr bool oilEnabled = Indices::oilEnabled;
     static constexpr bool compositionSwitchEnabled = compositionSwitchIdx >= 0;
 
+    //! \brief Whether a canonical phase can be active at all with the index set
+    //!        this residual was instantiated for.
+    //!
+    //! For the specialized one- and two-phase type tags this is a compile-time
+    //! constant, so checking it before the runtime phaseIsActive() query lets
+    //! the optimizer drop the bodies of statically disabled phases from the
+    //! fully unrolled phase loops.
+    OPM_HOST_DEVICE static constexpr bool phaseMayBeActive(const unsigned phaseIdx)
+    {
+        return (phaseIdx == waterPhaseIdx && waterEnabled)
+            || (phaseIdx == gasPhaseIdx && gasEnabled)
+            || (phaseIdx == oilPhaseIdx && oilEnabled);
+    }
+
     static constexpr bool blackoilConserveSurfaceVolume
         = getPropValue<TypeTag, Properties::BlackoilConserveSurfaceVolume>();
 
@@ -177,7 +191,7 @@ public:
         const FluidSystem& fsys = intQuants.getFluidSystem();
 
         for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
-            if (!fsys.phaseIsActive(phaseIdx)) {
+            if (!phaseMayBeActive(phaseIdx) || !fsys.phaseIsActive(phaseIdx)) {
                 continue;
             }
             unsigned activeCompIdx
@@ -189,7 +203,7 @@ public:
             storage[conti0EqIdx + activeCompIdx] += surfaceVolume;
 
             // account for dissolved gas
-            if (phaseIdx == oilPhaseIdx && fsys.enableDissolvedGas()) {
+            if (gasEnabled && phaseIdx == oilPhaseIdx && fsys.enableDissolvedGas()) {
                 unsigned activeGasCompIdx = fsys.canonicalToActiveCompIdx(gasCompIdx);
                 storage[conti0EqIdx + activeGasCompIdx]
                     += Toolbox::template decay<LhsEval>(intQuants.fluidState().Rs())
@@ -197,7 +211,7 @@ public:
             }
 
             // account for dissolved gas in water
-            if (phaseIdx == waterPhaseIdx && fsys.enableDissolvedGasInWater()) {
+            if (gasEnabled && phaseIdx == waterPhaseIdx && fsys.enableDissolvedGasInWater()) {
                 unsigned activeGasCompIdx = fsys.canonicalToActiveCompIdx(gasCompIdx);
                 storage[conti0EqIdx + activeGasCompIdx]
                     += Toolbox::template decay<LhsEval>(intQuants.fluidState().Rsw())
@@ -205,7 +219,7 @@ public:
             }
 
             // account for vaporized oil
-            if (phaseIdx == gasPhaseIdx && fsys.enableVaporizedOil()) {
+            if (oilEnabled && phaseIdx == gasPhaseIdx && fsys.enableVaporizedOil()) {
                 unsigned activeOilCompIdx = fsys.canonicalToActiveCompIdx(oilCompIdx);
                 storage[conti0EqIdx + activeOilCompIdx]
                     += Toolbox::template decay<LhsEval>(intQuants.fluidState().Rv())
@@ -213,7 +227,7 @@ public:
             }
 
             // account for vaporized water
-            if (phaseIdx == gasPhaseIdx && fsys.enableVaporizedWater()) {
+            if (waterEnabled && phaseIdx == gasPhaseIdx && fsys.enableVaporizedWater()) {
                 unsigned activeWaterCompIdx = fsys.canonicalToActiveCompIdx(waterCompIdx);
                 storage[conti0EqIdx + activeWaterCompIdx]
                     += Toolbox::template decay<LhsEval>(intQuants.fluidState().Rvw())
@@ -378,7 +392,7 @@ public:
         const FluidSystem& fsys = intQuantsIn.getFluidSystem();
 
         for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
-            if (!fsys.phaseIsActive(phaseIdx)) {
+            if (!phaseMayBeActive(phaseIdx) || !fsys.phaseIsActive(phaseIdx)) {
                 continue;
             }
             // darcy flux calculation
@@ -647,7 +661,7 @@ public:
         ////////
         bdyFlux = 0.0;
         for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
-            if (!FluidSystem::phaseIsActive(phaseIdx)) {
+            if (!phaseMayBeActive(phaseIdx) || !FluidSystem::phaseIsActive(phaseIdx)) {
                 continue;
             }
             const auto& pBoundary = bdyInfo.exFluidState.pressure(phaseIdx);
@@ -871,9 +885,9 @@ public:
                 += surfaceVolumeFlux * fsys.referenceDensity(phaseIdx, pvtRegionIdx);
         }
 
-        if (phaseIdx == oilPhaseIdx) {
+        if (oilEnabled && phaseIdx == oilPhaseIdx) {
             // dissolved gas (in the oil phase).
-            if (fsys.enableDissolvedGas()) {
+            if (gasEnabled && fsys.enableDissolvedGas()) {
                 const auto& Rs
                     = BlackOil::getRs_<FluidSystem, FluidState, UpEval>(upFs, pvtRegionIdx);
 
@@ -885,9 +899,9 @@ public:
                         * fsys.referenceDensity(gasPhaseIdx, pvtRegionIdx);
                 }
             }
-        } else if (phaseIdx == waterPhaseIdx) {
+        } else if (waterEnabled && phaseIdx == waterPhaseIdx) {
             // dissolved gas (in the water phase).
-            if (fsys.enableDissolvedGasInWater()) {
+            if (gasEnabled && fsys.enableDissolvedGasInWater()) {
                 const auto& Rsw
                     = BlackOil::getRsw_<FluidSystem, FluidState, UpEval>(upFs, pvtRegionIdx);
 
@@ -899,9 +913,9 @@ public:
                         * fsys.referenceDensity(gasPhaseIdx, pvtRegionIdx);
                 }
             }
-        } else if (phaseIdx == gasPhaseIdx) {
+        } else if (gasEnabled && phaseIdx == gasPhaseIdx) {
             // vaporized oil (in the gas phase).
-            if (fsys.enableVaporizedOil()) {
+            if (oilEnabled && fsys.enableVaporizedOil()) {
                 const auto& Rv
                     = BlackOil::getRv_<FluidSystem, FluidState, UpEval>(upFs, pvtRegionIdx);
 
@@ -914,7 +928,7 @@ public:
                 }
             }
             // vaporized water (in the gas phase).
-            if (fsys.enableVaporizedWater()) {
+            if (waterEnabled && fsys.enableVaporizedWater()) {
                 const auto& Rvw
                     = BlackOil::getRvw_<FluidSystem, FluidState, UpEval>(upFs, pvtRegionIdx);
 
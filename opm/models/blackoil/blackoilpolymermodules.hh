@@ -67,6 +67,7 @@ class BlackOilPolymerModule
     using Evaluation = GetPropType<TypeTag, Properties::Evaluation>;
     using PrimaryVariables = GetPropType<TypeTag, Properties::PrimaryVariables>;
     using IntensiveQuantities = GetPropType<TypeTag, Properties::IntensiveQuantities>;
+    using ExtensiveQuantities = GetPropType<TypeTag, Properties::ExtensiveQuantities>;
     using ElementContext = GetPropType<TypeTag, Properties::ElementContext>;
     using FluidSystem = GetPropType<TypeTag, Properties::FluidSystem>;
     using Model = GetPropType<TypeTag, Properties::Model>;
@@ -284,12 +285,30 @@ public:
             const auto& extQuants = elemCtx.extensiveQuantities(scvfIdx, timeIdx);
 
             const unsigned upIdx = extQuants.upstreamIndex(FluidSystem::waterPhaseIdx);
-            const unsigned inIdx = extQuants.interiorIndex();
             const auto& up = elemCtx.intensiveQuantities(upIdx, timeIdx);
+
+            addPolymerFluxes_(flux, extQuants, up,
+                              upIdx == extQuants.interiorIndex());
+        }
+    }
+
+    /*!
+     * \brief Like computeFlux(), but with the water-phase upstream
+     *        quantities already resolved by the caller.
+     *
+     * Lets the local residual evaluate all water-transported modules
+     * from a single upstream lookup per face.
+     */
+    static void addPolymerFluxes_([[maybe_unused]] RateVector& flux,
+                                  [[maybe_unused]] const ExtensiveQuantities& extQuants,
+                                  [[maybe_unused]] const IntensiveQuantities& up,
+                                  [[maybe_unused]] const bool upIsInterior)
+    {
+        if constexpr (enablePolymer) {
             const unsigned contiWaterEqIdx =
                 Indices::conti0EqIdx + FluidSystem::canonicalToActiveCompIdx(FluidSystem::waterCompIdx);
 
-            if (upIdx == inIdx) {
+            if (upIsInterior) {
                 flux[contiPolymerEqIdx] =
                         extQuants.volumeFlux(waterPhaseIdx) *
                         up.fluidState().invB(waterPhaseIdx) *
@@ -314,7 +333,7 @@ public:
 
             // flux related to transport of polymer molecular weight
             if constexpr (enablePolymerMolarWeight) {
-                if (upIdx == inIdx) {
+                if (upIsInterior) {
                     flux[contiPolymerMolarWeightEqIdx] =
                         flux[contiPolymerEqIdx] * up.polymerMoleWeight();
                 }
@@ -374,6 +393,9 @@ public:
         return params_.plyrockDeadPoreVolume_[satnumRegionIdx];
     }
 
+    static Scalar plyrockDeadPoreVolume(const unsigned satnumRegionIdx)
+    { return params_.plyrockDeadPoreVolume_[satnumRegionIdx]; }
+
     static Scalar plyrockResidualResistanceFactor(const ElementContext& elemCtx,
                                                   unsigned scvIdx,
                                                   unsigned timeIdx)
@@ -382,6 +404,9 @@ public:
         return params_.plyrockResidualResistanceFactor_[satnumRegionIdx];
     }
 
+    static Scalar plyrockResidualResistanceFactor(const unsigned satnumRegionIdx)
+    { return params_.plyrockResidualResistanceFactor_[satnumRegionIdx]; }
+
     static Scalar plyrockRockDensityFactor(const ElementContext& elemCtx,
                                            unsigned scvIdx,
                                            unsigned timeIdx)
@@ -390,6 +415,9 @@ public:
         return params_.plyrockRockDensityFactor_[satnumRegionIdx];
     }
 
+    static Scalar plyrockRockDensityFactor(const unsigned satnumRegionIdx)
+    { return params_.plyrockRockDensityFactor_[satnumRegionIdx]; }
+
     static Scalar plyrockAdsorbtionIndex(const ElementContext& elemCtx,
                                          unsigned scvIdx,
                                          unsigned timeIdx)
@@ -398,6 +426,9 @@ public:
         return params_.plyrockAdsorbtionIndex_[satnumRegionIdx];
     }
 
+    static Scalar plyrockAdsorbtionIndex(const unsigned satnumRegionIdx)
+    { return params_.plyrockAdsorbtionIndex_[satnumRegionIdx]; }
+
     static Scalar plyrockMaxAdsorbtion(const ElementContext& elemCtx,
                                        unsigned scvIdx,
                                        unsigned timeIdx)
@@ -406,6 +437,9 @@ public:
         return params_.plyrockMaxAdsorbtion_[satnumRegionIdx];
     }
 
+    static Scalar plyrockMaxAdsorbtion(const unsigned satnumRegionIdx)
+    { return params_.plyrockMaxAdsorbtion_[satnumRegionIdx]; }
+
     static const TabulatedFunction&
     plyadsAdsorbedPolymer(const ElementContext& elemCtx,
                           unsigned scvIdx,
@@ -415,6 +449,10 @@ public:
         return params_.plyadsAdsorbedPolymer_[satnumRegionIdx];
     }
 
+    static const TabulatedFunction&
+    plyadsAdsorbedPolymer(const unsigned satnumRegionIdx)
+    { return params_.plyadsAdsorbedPolymer_[satnumRegionIdx]; }
+
     static const TabulatedFunction&
     plyviscViscosityMultiplierTable(const ElementContext& elemCtx,
                                     unsigned scvIdx,
@@ -438,6 +476,9 @@ public:
         return params_.plymaxMaxConcentration_[polymerMixRegionIdx];
     }
 
+    static Scalar plymaxMaxConcentration(const unsigned polymerMixRegionIdx)
+    { return params_.plymaxMaxConcentration_[polymerMixRegionIdx]; }
+
     static Scalar plymixparToddLongstaff(const ElementContext& elemCtx,
                                          unsigned scvIdx,
                                          unsigned timeIdx)
@@ -447,6 +488,9 @@ public:
         return params_.plymixparToddLongstaff_[polymerMixRegionIdx];
     }
 
+    static Scalar plymixparToddLongstaff(const unsigned polymerMixRegionIdx)
+    { return params_.plymixparToddLongstaff_[polymerMixRegionIdx]; }
+
     static const typename BlackOilPolymerParams<Scalar>::PlyvmhCoefficients&
     plyvmhCoefficients(const ElementContext& elemCtx,
                        const unsigned scvIdx,
@@ -457,6 +501,10 @@ public:
         return params_.plyvmhCoefficients_[polymerMixRegionIdx];
     }
 
+    static const typename BlackOilPolymerParams<Scalar>::PlyvmhCoefficients&
+    plyvmhCoefficients(const unsigned polymerMixRegionIdx)
+    { return params_.plyvmhCoefficients_[polymerMixRegionIdx]; }
+
     static bool hasPlyshlog()
     { return params_.hasPlyshlog_; }
 
@@ -611,11 +659,17 @@ public:
             polymerMoleWeight_ = priVars.makeEvaluation(polymerMoleWeightIdx, timeIdx, linearizationType);
         }
 
+        // resolve the region indices once per cell instead of once per property lookup
+        const unsigned satnumRegionIdx =
+            elemCtx.problem().satnumRegionIndex(elemCtx, dofIdx, timeIdx);
+        const unsigned polymerMixRegionIdx =
+            elemCtx.problem().plmixnumRegionIndex(elemCtx, dofIdx, timeIdx);
+
         // permeability reduction due to polymer
-        const Scalar& maxAdsorbtion = PolymerModule::plyrockMaxAdsorbtion(elemCtx, dofIdx, timeIdx);
-        const auto& plyadsAdsorbedPolymer = PolymerModule::plyadsAdsorbedPolymer(elemCtx, dofIdx, timeIdx);
+        const Scalar maxAdsorbtion = PolymerModule::plyrockMaxAdsorbtion(satnumRegionIdx);
+        const auto& plyadsAdsorbedPolymer = PolymerModule::plyadsAdsorbedPolymer(satnumRegionIdx);
         polymerAdsorption_ = plyadsAdsorbedPolymer.eval(polymerConcentration_, /*extrapolate=*/true);
-        if (static_cast<int>(PolymerModule::plyrockAdsorbtionIndex(elemCtx, dofIdx, timeIdx)) ==
+        if (static_cast<int>(PolymerModule::plyrockAdsorbtionIndex(satnumRegionIdx)) ==
             BlackOilPolymerParams<Scalar>::NoDesorption)
         {
             const auto maxPolymerAdsorption =
@@ -624,23 +678,24 @@ public:
         }
 
         // compute resitanceFactor
-        const Scalar& residualResistanceFactor =
-            PolymerModule::plyrockResidualResistanceFactor(elemCtx, dofIdx, timeIdx);
+        const Scalar residualResistanceFactor =
+            PolymerModule::plyrockResidualResistanceFactor(satnumRegionIdx);
         const Evaluation resistanceFactor = 1.0 + (residualResistanceFactor - 1.0) *
                                                    polymerAdsorption_ / maxAdsorbtion;
 
         // compute effective viscosities
         if constexpr (!enablePolymerMolarWeight) {
-            const Scalar cmax = PolymerModule::plymaxMaxConcentration(elemCtx, dofIdx, timeIdx);
+            const Scalar cmax = PolymerModule::plymaxMaxConcentration(polymerMixRegionIdx);
             const auto& fs = asImp_().fluidState_;
             const Evaluation& muWater = fs.viscosity(waterPhaseIdx);
             const auto& viscosityMultiplier =
-                PolymerModule::plyviscViscosityMultiplierTable(elemCtx, dofIdx, timeIdx);
+                PolymerModule::plyviscViscosityMultiplierTable(
+                    elemCtx.problem().pvtRegionIndex(elemCtx, dofIdx, timeIdx));
             const Evaluation viscosityMixture =
                 viscosityMultiplier.eval(polymerConcentration_, /*extrapolate=*/true) * muWater;
 
             // Do the Todd-Longstaff mixing
-            const Scalar plymixparToddLongstaff = PolymerModule::plymixparToddLongstaff(elemCtx, dofIdx, timeIdx);
+            const Scalar plymixparToddLongstaff = PolymerModule::plymixparToddLongstaff(polymerMixRegionIdx);
             const Evaluation viscosityPolymer = viscosityMultiplier.eval(cmax, /*extrapolate=*/true) * muWater;
             const Evaluation viscosityPolymerEffective =
                 pow(viscosityMixture, plymixparToddLongstaff) * pow(viscosityPolymer, 1.0 - plymixparToddLongstaff);
@@ -654,7 +709,7 @@ public:
             polymerViscosityCorrection_ =  (muWater / waterViscosityCorrection_) / viscosityPolymerEffective;
         }
         else { // based on PLYVMH
-            const auto& plyvmhCoefficients = PolymerModule::plyvmhCoefficients(elemCtx, dofIdx, timeIdx);
+            const auto& plyvmhCoefficients = PolymerModule::plyvmhCoefficients(polymerMixRegionIdx);
             const Scalar k_mh = plyvmhCoefficients.k_mh;
             const Scalar a_mh = plyvmhCoefficients.a_mh;
             const Scalar gamma = plyvmhCoefficients.gamma;
@@ -672,8 +727,8 @@ public:
         asImp_().mobility_[waterPhaseIdx] *= waterViscosityCorrection_ / resistanceFactor;
 
         // update rock properties
-        polymerDeadPoreVolume_ = PolymerModule::plyrockDeadPoreVolume(elemCtx, dofIdx, timeIdx);
-        polymerRockDensity_ = PolymerModule::plyrockRockDensityFactor(elemCtx, dofIdx, timeIdx);
+        polymerDeadPoreVolume_ = PolymerModule::plyrockDeadPoreVolume(satnumRegionIdx);
+        polymerRockDensity_ = PolymerModule::plyrockRockDensityFactor(satnumRegionIdx);
     }
 
     const Evaluation& polymerConcentration() const
@@ -419,6 +419,11 @@ public:
         return params_.sof2Krn_[satnumRegionIdx];
     }
 
+    static const TabulatedFunction& sof2Krn(const unsigned satnumRegionIdx)
+    {
+        return params_.sof2Krn_[satnumRegionIdx];
+    }
+
     template <class ElemContext>
     static const TabulatedFunction& misc(const ElemContext& elemCtx,
                                          unsigned scvIdx,
@@ -429,6 +434,11 @@ public:
         return params_.misc_[miscnumRegionIdx];
     }
 
+    static const TabulatedFunction& misc(const unsigned miscnumRegionIdx)
+    {
+        return params_.misc_[miscnumRegionIdx];
+    }
+
     template <class ElemContext>
     static const TabulatedFunction& pmisc(const ElemContext& elemCtx,
                                           unsigned scvIdx,
@@ -439,6 +449,11 @@ public:
         return params_.pmisc_[miscnumRegionIdx];
     }
 
+    static const TabulatedFunction& pmisc(const unsigned miscnumRegionIdx)
+    {
+        return params_.pmisc_[miscnumRegionIdx];
+    }
+
     template <class ElemContext>
     static const TabulatedFunction& msfnKrsg(const ElemContext& elemCtx,
                                              unsigned scvIdx,
@@ -449,6 +464,11 @@ public:
         return params_.msfnKrsg_[satnumRegionIdx];
     }
 
+    static const TabulatedFunction& msfnKrsg(const unsigned satnumRegionIdx)
+    {
+        return params_.msfnKrsg_[satnumRegionIdx];
+    }
+
     template <class ElemContext>
     static const TabulatedFunction& msfnKro(const ElemContext& elemCtx,
                                             unsigned scvIdx,
@@ -459,6 +479,11 @@ public:
         return params_.msfnKro_[satnumRegionIdx];
     }
 
+    static const TabulatedFunction& msfnKro(const unsigned satnumRegionIdx)
+    {
+        return params_.msfnKro_[satnumRegionIdx];
+    }
+
     template <class ElemContext>
     static const TabulatedFunction& sorwmis(const ElemContext& elemCtx,
                                             unsigned scvIdx,
@@ -469,6 +494,11 @@ public:
         return params_.sorwmis_[miscnumRegionIdx];
     }
 
+    static const TabulatedFunction& sorwmis(const unsigned miscnumRegionIdx)
+    {
+        return params_.sorwmis_[miscnumRegionIdx];
+    }
+
     template <class ElemContext>
     static const TabulatedFunction& sgcwmis(const ElemContext& elemCtx,
                                             unsigned scvIdx,
@@ -479,6 +509,11 @@ public:
         return params_.sgcwmis_[miscnumRegionIdx];
     }
 
+    static const TabulatedFunction& sgcwmis(const unsigned miscnumRegionIdx)
+    {
+        return params_.sgcwmis_[miscnumRegionIdx];
+    }
+
     template <class ElemContext>
     static const TabulatedFunction& tlPMixTable(const ElemContext& elemCtx,
                                             unsigned scvIdx,
@@ -489,6 +524,11 @@ public:
         return params_.tlPMixTable_[miscnumRegionIdx];
     }
 
+    static const TabulatedFunction& tlPMixTable(const unsigned miscnumRegionIdx)
+    {
+        return params_.tlPMixTable_[miscnumRegionIdx];
+    }
+
     template <class ElemContext>
     static Scalar tlMixParamViscosity(const ElemContext& elemCtx,
                                       unsigned scvIdx,
@@ -499,6 +539,10 @@ public:
         return params_.tlMixParamViscosity_[miscnumRegionIdx];
     }
 
+    static Scalar tlMixParamViscosity(const unsigned miscnumRegionIdx)
+    {
+        return params_.tlMixParamViscosity_[miscnumRegionIdx];
+    }
 
     template <class ElemContext>
     static Scalar tlMixParamDensity(const ElemContext& elemCtx,
@@ -510,6 +554,11 @@ public:
         return params_.tlMixParamDensity_[miscnumRegionIdx];
     }
 
+    static Scalar tlMixParamDensity(const unsigned miscnumRegionIdx)
+    {
+        return params_.tlMixParamDensity_[miscnumRegionIdx];
+    }
+
     static bool isMiscible()
     { return params_.isMiscible_; }
 
@@ -687,6 +736,15 @@ public:
         ProblemAndCellIndexOnlyContext<Problem> elemCtx{problem, globalSpaceIdx};
         unsigned dofIdx = 0; // Dummy
 
+        // resolve the region indices once per cell; the table accessors below
+        // would otherwise re-derive them for every lookup
+        const unsigned satnumRegionIdx =
+            problem.satnumRegionIndex(elemCtx, dofIdx, timeIdx);
+        const unsigned miscnumRegionIdx =
+            SolventModule::isMiscible()
+                ? problem.miscnumRegionIndex(elemCtx, dofIdx, timeIdx)
+                : 0;
+
         // Pressure effects on capillary pressure miscibility
         if (SolventModule::isMiscible()) {
             const Evaluation& p =
@@ -694,7 +752,7 @@ public:
                     ? fs.pressure(oilPhaseIdx)
                     : fs.pressure(gasPhaseIdx);
             const Evaluation pmisc =
-                SolventModule::pmisc(elemCtx, dofIdx, timeIdx).eval(p, /*extrapolate=*/true);
+                SolventModule::pmisc(miscnumRegionIdx).eval(p, /*extrapolate=*/true);
             const Evaluation& pgImisc = fs.pressure(gasPhaseIdx);
 
             // compute capillary pressure for miscible fluid
@@ -729,8 +787,8 @@ public:
 
         // account for miscibility of oil and solvent
         if (SolventModule::isMiscible() && FluidSystem::phaseIsActive(oilPhaseIdx)) {
-            const auto& misc = SolventModule::misc(elemCtx, dofIdx, timeIdx);
-            const auto& pmisc = SolventModule::pmisc(elemCtx, dofIdx, timeIdx);
+            const auto& misc = SolventModule::misc(miscnumRegionIdx);
+            const auto& pmisc = SolventModule::pmisc(miscnumRegionIdx);
             const Evaluation& p =
                 FluidSystem::phaseIsActive(oilPhaseIdx)
                     ? fs.pressure(oilPhaseIdx)
@@ -749,7 +807,7 @@ public:
             Evaluation sor = sogcr;
             if (FluidSystem::phaseIsActive(waterPhaseIdx)) {
                 const Evaluation& sw = fs.saturation(waterPhaseIdx);
-                const auto& sorwmis = SolventModule::sorwmis(elemCtx, dofIdx, timeIdx);
+                const auto& sorwmis = SolventModule::sorwmis(miscnumRegionIdx);
                 sor = miscibility *
                       sorwmis.eval(sw,  /*extrapolate=*/true) + (1.0 - miscibility) * sogcr;
             }
@@ -757,7 +815,7 @@ public:
             Evaluation sgc = sgcr;
             if (FluidSystem::phaseIsActive(waterPhaseIdx)) {
                 const Evaluation& sw = fs.saturation(waterPhaseIdx);
-                const auto& sgcwmis = SolventModule::sgcwmis(elemCtx, dofIdx, timeIdx);
+                const auto& sgcwmis = SolventModule::sgcwmis(miscnumRegionIdx);
                 sgc = miscibility * sgcwmis.eval(sw,  /*extrapolate=*/true) + (1.0 - miscibility) * sgcr;
             }
 
@@ -773,9 +831,9 @@ public:
                 const Evaluation gasSolventEffSat = std::max(gasSolventSat - sgc, zero);
                 F_totalGas = gasSolventEffSat / oilGasSolventEffSat;
             }
-            const auto& msfnKro = SolventModule::msfnKro(elemCtx, dofIdx, timeIdx);
-            const auto& msfnKrsg = SolventModule::msfnKrsg(elemCtx, dofIdx, timeIdx);
-            const auto& sof2Krn = SolventModule::sof2Krn(elemCtx, dofIdx, timeIdx);
+            const auto& msfnKro = SolventModule::msfnKro(satnumRegionIdx);
+            const auto& msfnKrsg = SolventModule::msfnKrsg(satnumRegionIdx);
+            const auto& sof2Krn = SolventModule::sof2Krn(satnumRegionIdx);
 
             const Evaluation mkrgt = msfnKrsg.eval(F_totalGas, /*extrapolate=*/true) *
                                      sof2Krn.eval(oilGasSolventSat, /*extrapolate=*/true);
@@ -793,8 +851,8 @@ public:
         }
 
         // compute the mobility of the solvent "phase" and modify the gas phase
-        const auto& ssfnKrg = SolventModule::ssfnKrg(elemCtx, dofIdx, timeIdx);
-        const auto& ssfnKrs = SolventModule::ssfnKrs(elemCtx, dofIdx, timeIdx);
+        const auto& ssfnKrg = SolventModule::ssfnKrg(satnumRegionIdx);
+        const auto& ssfnKrs = SolventModule::ssfnKrs(satnumRegionIdx);
 
         Evaluation& krg = asImp_().mobility_[gasPhaseIdx];
         solventMobility_ = krg * ssfnKrs.eval(Fsolgas, /*extrapolate=*/true);
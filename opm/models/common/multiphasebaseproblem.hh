@@ -268,6 +268,26 @@ public:
                         [[maybe_unused]] unsigned globalSpaceIdx) const
     {}
 
+    /*!
+     * \brief Variant of updateRelperms() that also evaluates the capillary
+     *        pressures.
+     *
+     * Problem implementations can overload this to share the material law
+     * parameter lookup between the two evaluations.
+     */
+    template <class FluidState, class ...Args>
+    void updateRelpermsAndCapillaryPressures(std::array<Evaluation,numPhases>& mobility,
+                                             DirectionalMobilityPtr& dirMob,
+                                             std::array<Evaluation,numPhases>& pC,
+                                             FluidState& fluidState,
+                                             unsigned globalSpaceIdx) const
+    {
+        using MaterialLaw = GetPropType<TypeTag, Properties::MaterialLaw>;
+        asImp_().template updateRelperms<FluidState, Args...>(mobility, dirMob, fluidState, globalSpaceIdx);
+        MaterialLaw::template capillaryPressures<std::array<Evaluation,numPhases>, FluidState, Args...>(
+            pC, asImp_().materialLawParams(globalSpaceIdx), fluidState);
+    }
+
     /*!
      * \brief Returns the temperature \f$\mathrm{[K]}\f$ within a control volume.
      *
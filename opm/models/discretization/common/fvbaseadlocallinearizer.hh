@@ -41,6 +41,7 @@
 
 #include <opm/simulators/linalg/linalgproperties.hh>
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 
@@ -253,8 +254,15 @@ protected:
         const std::size_t numPrimaryDof = elemCtx.numPrimaryDof(/*timeIdx=*/0);
 
         residual_.resize(numDof);
-        if (jacobian_.N() != numDof || jacobian_.M() != numPrimaryDof) {
-            jacobian_.setSize(numDof, numPrimaryDof);
+        // Dune::Matrix::setSize() discards the old allocation, so the local
+        // Jacobian is only ever enlarged and keeps the largest stencil size
+        // encountered so far. This avoids re-allocating it on every element
+        // visit when the stencil size varies (e.g. at domain boundaries or
+        // on mixed-geometry grids); nothing reads beyond the dimensions of
+        // the current element.
+        if (jacobian_.N() < numDof || jacobian_.M() < numPrimaryDof) {
+            jacobian_.setSize(std::max<std::size_t>(jacobian_.N(), numDof),
+                              std::max<std::size_t>(jacobian_.M(), numPrimaryDof));
         }
     }
 
@@ -59,6 +59,7 @@
 #include <opm/models/parallel/threadmanager.hpp>
 
 #include <opm/models/utils/alignedallocator.hh>
+#include <opm/models/utils/hugepages.hpp>
 #include <opm/models/utils/simulator.hh>
 #include <opm/models/utils/timer.hpp>
 #include <opm/models/utils/timerguard.hh>
@@ -400,6 +401,7 @@ public:
         , linearizer_(std::make_unique<Linearizer>())
         , enableGridAdaptation_(Parameters::Get<Parameters::EnableGridAdaptation>() )
         , enableIntensiveQuantityCache_(Parameters::Get<Parameters::EnableIntensiveQuantityCache>())
+        , enableIntensiveQuantitySoACache_(Parameters::Get<Parameters::EnableIntensiveQuantitySoACache>())
         , enableStorageCache_(Parameters::Get<Parameters::EnableStorageCache>())
         , enableThermodynamicHints_(Parameters::Get<Parameters::EnableThermodynamicHints>())
         , cachedIntensiveQuantityHistorySize_(static_cast<unsigned>(-1))
@@ -411,6 +413,8 @@ public:
                                         Dune::className<Discretization>() + ")");
         }
 
+        HugePages::setEnabled(Parameters::Get<Parameters::EnableHugePages>());
+
         PrimaryVariables::init();
         // Setting up the intensive quantities cache and storage cache is done in finishInit()
         // and applyInitialSolution() to ensure that the history size is correct.
@@ -443,8 +447,14 @@ public:
             ("Global switch for turning on writing VTK files");
         Parameters::Register<Parameters::EnableThermodynamicHints>
             ("Enable thermodynamic hints");
+        Parameters::Register<Parameters::EnableHugePages>
+            ("Advise the kernel to back large long-lived arrays with "
+             "transparent huge pages");
         Parameters::Register<Parameters::EnableIntensiveQuantityCache>
             ("Turn on caching of intensive quantities");
+        Parameters::Register<Parameters::EnableIntensiveQuantitySoACache>
+            ("Maintain a structure-of-arrays mirror of the hot intensive "
+             "quantities fields next to the cache");
         Parameters::Register<Parameters::EnableStorageCache>
             ("Store previous storage terms and avoid re-calculating them.");
         Parameters::Register<Parameters::OutputDir>
@@ -678,6 +688,63 @@ public:
 
         intensiveQuantityCache_[timeIdx][globalIdx] = intQuants;
         intensiveQuantityCacheUpToDate_[timeIdx][globalIdx] = true;
+
+        if constexpr (providesSoACacheFields_()) {
+            if (enableIntensiveQuantitySoACache_ && timeIdx < intensiveQuantitySoACache_.size()) {
+                auto& soa = intensiveQuantitySoACache_[timeIdx];
+                const auto& fs = intQuants.fluidState();
+                for (unsigned phaseIdx = 0; phaseIdx < soaNumPhases_(); ++phaseIdx) {
+                    const std::size_t pos = phaseIdx * soa.numDof + globalIdx;
+                    soa.pressure[pos] = fs.pressure(phaseIdx);
+                    soa.density[pos] = fs.density(phaseIdx);
+                    soa.invB[pos] = fs.invB(phaseIdx);
+                    soa.mobility[pos] = intQuants.mobility(phaseIdx);
+                }
+            }
+        }
+    }
+
+    /*!
+     * \brief Returns true if the structure-of-arrays mirror of the intensive
+     *        quantities cache is maintained.
+     */
+    bool enableIntensiveQuantitySoACache() const
+    { return enableIntensiveQuantitySoACache_ && !intensiveQuantitySoACache_.empty(); }
+
+    /*!
+     * \brief Access the cached phase pressure of a degree of freedom from the
+     *        structure-of-arrays mirror.
+     *
+     * The entries are only meaningful if enableIntensiveQuantitySoACache()
+     * returns true and the corresponding cache entry is up to date.
+     */
+    const Evaluation& cachedPressure(unsigned globalIdx, unsigned phaseIdx, unsigned timeIdx) const
+    {
+        const auto& soa = intensiveQuantitySoACache_[timeIdx];
+        return soa.pressure[phaseIdx * soa.numDof + globalIdx];
+    }
+
+    //! \copydoc cachedPressure
+    const Evaluation& cachedDensity(unsigned globalIdx, unsigned phaseIdx, unsigned timeIdx) const
+    {
+        const auto& soa = intensiveQuantitySoACache_[timeIdx];
+        return soa.density[phaseIdx * soa.numDof + globalIdx];
+    }
+
+    //! \copydoc cachedPressure
+    const Evaluation& cachedInverseFormationVolumeFactor(unsigned globalIdx,
+                                                         unsigned phaseIdx,
+                                                         unsigned timeIdx) const
+    {
+        const auto& soa = intensiveQuantitySoACache_[timeIdx];
+        return soa.invB[phaseIdx * soa.numDof + globalIdx];
+    }
+
+    //! \copydoc cachedPressure
+    const Evaluation& cachedMobility(unsigned globalIdx, unsigned phaseIdx, unsigned timeIdx) const
+    {
+        const auto& soa = intensiveQuantitySoACache_[timeIdx];
+        return soa.mobility[phaseIdx * soa.numDof + globalIdx];
     }
 
     /*!
@@ -799,6 +866,9 @@ public:
         for (unsigned timeIdx = 0; timeIdx < intensiveHistorySize - numSlots; ++timeIdx) {
             intensiveQuantityCache_[timeIdx + numSlots] = intensiveQuantityCache_[timeIdx];
             intensiveQuantityCacheUpToDate_[timeIdx + numSlots] = intensiveQuantityCacheUpToDate_[timeIdx];
+            if (!intensiveQuantitySoACache_.empty()) {
+                intensiveQuantitySoACache_[timeIdx + numSlots] = intensiveQuantitySoACache_[timeIdx];
+            }
         }
 
         // the cache for the most recent time indices do not need to be invalidated
@@ -1935,6 +2005,15 @@ protected:
                 intensiveQuantityCacheUpToDate_[timeIdx].resize(numDof);
                 invalidateIntensiveQuantitiesCache(timeIdx);
             }
+
+            if constexpr (providesSoACacheFields_()) {
+                if (enableIntensiveQuantitySoACache_) {
+                    intensiveQuantitySoACache_.resize(intensiveHistorySize);
+                    for (unsigned timeIdx = 0; timeIdx < intensiveHistorySize; ++timeIdx) {
+                        intensiveQuantitySoACache_[timeIdx].resize(numDof, soaNumPhases_());
+                    }
+                }
+            }
         }
     }
 
@@ -1976,6 +2055,25 @@ protected:
     const Implementation& asImp_() const
     { return *static_cast<const Implementation*>(this); }
 
+    // whether the intensive quantities provide the fields mirrored by the
+    // structure-of-arrays cache; models without them keep the mirror disabled
+    static constexpr bool providesSoACacheFields_()
+    {
+        return requires(const IntensiveQuantities& iq) {
+            iq.fluidState().pressure(0);
+            iq.fluidState().density(0);
+            iq.fluidState().invB(0);
+            iq.mobility(0);
+        };
+    }
+
+    // only valid for intensive quantities satisfying providesSoACacheFields_()
+    static constexpr unsigned soaNumPhases_()
+    {
+        using FluidState = std::decay_t<decltype(std::declval<const IntensiveQuantities&>().fluidState())>;
+        return FluidState::numPhases;
+    }
+
     // the problem we want to solve. defines the constitutive
     // relations, matxerial laws, etc.
     Simulator& simulator_;
@@ -2007,6 +2105,28 @@ protected:
     // solution of the previous time step
     mutable std::vector<IntensiveQuantitiesVector> intensiveQuantityCache_;
 
+    // structure-of-arrays mirror of the hot intensive quantities fields,
+    // indexed [phaseIdx*numDof + globalIdx] (see
+    // EnableIntensiveQuantitySoACache)
+    struct IntensiveQuantitySoA
+    {
+        std::vector<Evaluation> pressure;
+        std::vector<Evaluation> density;
+        std::vector<Evaluation> invB;
+        std::vector<Evaluation> mobility;
+        std::size_t numDof = 0;
+
+        void resize(std::size_t nDof, unsigned numPhases)
+        {
+            numDof = nDof;
+            pressure.resize(numPhases * nDof);
+            density.resize(numPhases * nDof);
+            invB.resize(numPhases * nDof);
+            mobility.resize(numPhases * nDof);
+        }
+    };
+    mutable std::vector<IntensiveQuantitySoA> intensiveQuantitySoACache_;
+
     // while these are logically bools, concurrent writes to vector<bool> are not thread safe.
     mutable std::vector<std::vector<unsigned char>> intensiveQuantityCacheUpToDate_;
 
@@ -2025,6 +2145,7 @@ protected:
 
     bool enableGridAdaptation_;
     bool enableIntensiveQuantityCache_;
+    bool enableIntensiveQuantitySoACache_;
     bool enableStorageCache_;
     bool enableThermodynamicHints_;
 
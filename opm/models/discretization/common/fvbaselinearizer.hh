@@ -49,6 +49,10 @@
 #include <opm/models/discretization/common/fvbaseproperties.hh>
 #include <opm/models/discretization/common/linearizationtype.hh>
 
+#include <opm/models/utils/threadarena.hh>
+
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <exception>   // current_exception, rethrow_exception
 #include <iostream>
@@ -56,8 +60,20 @@
 #include <memory>
 #include <mutex>
 #include <set>
+#include <type_traits>
 #include <vector>
 
+namespace Opm::Parameters {
+
+struct EnableColoredLinearization { static constexpr bool value = false; };
+
+struct EnableIncrementalLinearization { static constexpr bool value = false; };
+
+template<class Scalar>
+struct IncrementalLinearizationTolerance { static constexpr Scalar value = 0.0; };
+
+} // namespace Opm::Parameters
+
 namespace Opm {
 
 // forward declarations
@@ -102,6 +118,7 @@ class FvBaseLinearizer
 
     using Element = typename GridView::template Codim<0>::Entity;
     using ElementIterator = typename GridView::template Codim<0>::Iterator;
+    using ElementSeed = typename GridView::Grid::template Codim<0>::EntitySeed;
 
     using Vector = GlobalEqVector;
 
@@ -127,7 +144,20 @@ public:
      * \brief Register all run-time parameters for the Jacobian linearizer.
      */
     static void registerParameters()
-    {}
+    {
+        Parameters::Register<Parameters::EnableColoredLinearization>
+            ("Group the elements into colors with disjoint write regions and "
+             "assemble the colors one after the other, so that threads never "
+             "scatter into the same rows of the linear system concurrently.");
+        Parameters::Register<Parameters::EnableIncrementalLinearization>
+            ("Only reset and reassemble the Jacobian rows whose degrees of freedom "
+             "changed since the previous linearization, keeping the rest of the "
+             "linear system from the previous Newton iteration.");
+        Parameters::Register<Parameters::IncrementalLinearizationTolerance<Scalar>>
+            ("Relative change of a primary variable below which a degree of freedom "
+             "is considered unchanged by the incremental linearization. A positive "
+             "value trades linearization accuracy for assembly speed.");
+    }
 
     /*!
      * \brief Initialize the linearizer.
@@ -141,6 +171,11 @@ public:
     void init(Simulator& simulator)
     {
         simulatorPtr_ = &simulator;
+        coloredLinearization_ = Parameters::Get<Parameters::EnableColoredLinearization>();
+        incrementalLinearization_ = Parameters::Get<Parameters::EnableIncrementalLinearization>();
+        incrementalTolerance_ = Parameters::Get<Parameters::IncrementalLinearizationTolerance<Scalar>>();
+        usePartialRelinearization_ = false;
+        haveLastSolution_ = false;
         eraseMatrix();
         elementCtx_.clear();
         fullDomain_ = std::make_unique<FullDomain>(simulator.gridView());
@@ -185,7 +220,23 @@ public:
      */
     void linearizeDomain()
     {
-        linearizeDomain(*fullDomain_);
+        if (incrementalLinearization_) {
+            updateRecalculationFlags_();
+        }
+
+        try {
+            linearizeDomain(*fullDomain_);
+        }
+        catch (...) {
+            usePartialRelinearization_ = false;
+            throw;
+        }
+
+        if (incrementalLinearization_) {
+            lastSolution_ = model_().solution(/*timeIdx=*/0);
+            haveLastSolution_ = true;
+        }
+        usePartialRelinearization_ = false;
     }
 
     template <class SubDomainType>
@@ -414,11 +465,93 @@ private:
         residual_.resize(model_().numTotalDof());
         resetSystem_();
 
-        // create the per-thread context objects
-        elementCtx_.clear();
-        elementCtx_.reserve(ThreadManager::maxThreads());
-        for (unsigned threadId = 0; threadId != ThreadManager::maxThreads(); ++ threadId) {
-            elementCtx_.push_back(std::make_unique<ElementContext>(simulator_()));
+        // create the per-thread context objects. If they already exist (i.e.,
+        // the matrix is re-created after a grid change), keep them so that
+        // the capacity of their internal arrays is retained.
+        if (elementCtx_.size() != ThreadManager::maxThreads()) {
+            elementCtx_.clear();
+            elementCtx_.reserve(ThreadManager::maxThreads());
+            for (unsigned threadId = 0; threadId != ThreadManager::maxThreads(); ++ threadId) {
+                elementCtx_.push_back(std::make_unique<ElementContext>(simulator_()));
+            }
+        }
+
+        if (coloredLinearization_) {
+            updateColoring_();
+        }
+    }
+
+    // Group the elements into colors such that no two elements of the same
+    // color write to a common row of the global system.  An element's
+    // scatter touches the rows of every degree of freedom in its stencil,
+    // so two elements conflict exactly when their stencils intersect.  The
+    // grouping is recomputed together with the matrix, i.e. whenever the
+    // sparsity pattern may have changed.
+    void updateColoring_()
+    {
+        const auto& elemMapper = elementMapper_();
+        const std::size_t numElems = gridView_().size(/*codim=*/0);
+
+        // the rows written by each element, and for each row the elements
+        // writing to it
+        Stencil stencil(gridView_(), model_().dofMapper());
+        std::vector<ElementSeed> seeds(numElems);
+        std::vector<std::vector<unsigned>> writtenRows(numElems);
+        std::vector<std::vector<unsigned>> rowWriters(model_().numTotalDof());
+        for (const auto& elem : elements(gridView_())) {
+            stencil.update(elem);
+
+            const unsigned elemIdx = elemMapper.index(elem);
+            seeds[elemIdx] = elem.seed();
+
+            auto& rows = writtenRows[elemIdx];
+            rows.reserve(stencil.numDof());
+            for (unsigned dofIdx = 0; dofIdx < stencil.numDof(); ++dofIdx) {
+                const unsigned globJ = stencil.globalSpaceIndex(dofIdx);
+                rows.push_back(globJ);
+                rowWriters[globJ].push_back(elemIdx);
+            }
+        }
+
+        // greedy first-fit coloring: for each element, forbid the colors of
+        // all elements sharing one of its rows and take the smallest color
+        // that remains
+        std::vector<int> color(numElems, -1);
+        std::vector<long> forbiddenBy;
+        int numColors = 0;
+        for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
+            for (const unsigned globJ : writtenRows[elemIdx]) {
+                for (const unsigned other : rowWriters[globJ]) {
+                    if (color[other] >= 0) {
+                        forbiddenBy[color[other]] = elemIdx;
+                    }
+                }
+            }
+
+            int c = 0;
+            while (c < numColors && forbiddenBy[c] == static_cast<long>(elemIdx)) {
+                ++c;
+            }
+            if (c == numColors) {
+                ++numColors;
+                forbiddenBy.push_back(-1);
+            }
+            color[elemIdx] = c;
+        }
+
+        // store the element seeds grouped by color
+        colorGroupOffsets_.assign(numColors + 1, 0);
+        for (const int c : color) {
+            ++colorGroupOffsets_[c + 1];
+        }
+        for (int c = 0; c < numColors; ++c) {
+            colorGroupOffsets_[c + 1] += colorGroupOffsets_[c];
+        }
+
+        coloredElementSeeds_.resize(numElems);
+        auto fillIdx = colorGroupOffsets_;
+        for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx) {
+            coloredElementSeeds_[fillIdx[color[elemIdx]]++] = seeds[elemIdx];
         }
     }
 
@@ -463,11 +596,83 @@ private:
     // reset the global linear system of equations.
     void resetSystem_()
     {
+        if (usePartialRelinearization_) {
+            // only reset the rows that will be reassembled below; the
+            // remaining rows keep their values from the previous iteration
+            const unsigned numDof = model_().numTotalDof();
+            for (unsigned globI = 0; globI < numDof; ++globI) {
+                if (rowNeedsRecalculation_[globI]) {
+                    residual_[globI] = 0.0;
+                    jacobian_->clearRow(globI, 0.0);
+                }
+            }
+            return;
+        }
+
         residual_ = 0.0;
         // zero all matrix entries
         jacobian_->clear();
     }
 
+    // Determine which rows of the linear system have to be recalculated because
+    // a degree of freedom in their stencil changed since the last linearization,
+    // and decide whether a partial relinearization can be used at all.
+    void updateRecalculationFlags_()
+    {
+        usePartialRelinearization_ = false;
+        if (!jacobian_ ||
+            !haveLastSolution_ ||
+            problem_().iterationContext().isFirstGlobalIteration() ||
+            problem_().iterationContext().inLocalSolve())
+        {
+            return;
+        }
+
+        // the auxiliary modules (e.g. the well model) add their contributions
+        // into the residual and the Jacobian anew in every iteration, on top of
+        // whatever the rows already contain. A row kept from the previous
+        // iteration thus still holds last iteration's auxiliary terms and would
+        // accumulate the current ones on top, so partial relinearization cannot
+        // be used as soon as auxiliary equations are present.
+        if (model_().numAuxiliaryModules() > 0) {
+            return;
+        }
+
+        const auto& sol = model_().solution(/*timeIdx=*/0);
+        const unsigned numDof = model_().numTotalDof();
+        if (lastSolution_.size() != sol.size() || sparsityPattern_.size() != numDof) {
+            return;
+        }
+
+        // flag the degrees of freedom whose primary variables changed
+        std::vector<bool> dofChanged(numDof, false);
+        for (unsigned globI = 0; globI < numDof; ++globI) {
+            for (unsigned pvIdx = 0; pvIdx < sol[globI].size(); ++pvIdx) {
+                const Scalar cur = sol[globI][pvIdx];
+                const Scalar old = lastSolution_[globI][pvIdx];
+                const Scalar scale = std::max(std::abs(cur), std::abs(old));
+                if (std::abs(cur - old) > incrementalTolerance_ * scale) {
+                    dofChanged[globI] = true;
+                    break;
+                }
+            }
+        }
+
+        // the residual of a row depends on all degrees of freedom in its
+        // stencil, so a row must be reassembled as soon as any of them changed
+        rowNeedsRecalculation_.assign(numDof, false);
+        for (unsigned globI = 0; globI < numDof; ++globI) {
+            for (const unsigned globJ : sparsityPattern_[globI]) {
+                if (dofChanged[globJ]) {
+                    rowNeedsRecalculation_[globI] = true;
+                    break;
+                }
+            }
+        }
+
+        usePartialRelinearization_ = true;
+    }
+
     // query the problem for all constraint degrees of freedom. note that this method is
     // quite involved and is thus relatively slow.
     void updateConstraintsMap_()
@@ -534,6 +739,18 @@ private:
 
         applyConstraintsToSolution_();
 
+        // with colored linearization the elements of the full domain are
+        // visited color group by color group instead of through the
+        // work-sharing iterator, and the scatter into the global system
+        // needs no lock
+        if constexpr (std::is_same_v<std::remove_cvref_t<SubDomainType>, FullDomain>) {
+            if (coloredLinearization_) {
+                linearizeColoredElements_();
+                applyConstraintsToLinearization_();
+                return;
+            }
+        }
+
         // to avoid a race condition if two threads handle an exception at the same time,
         // we use an explicit lock to control access to the exception storage object
         // amongst thread-local handlers
@@ -572,6 +789,10 @@ private:
                         continue;
                     }
 
+                    if (usePartialRelinearization_ && !elementNeedsRelinearization_(elem)) {
+                        continue;
+                    }
+
                     linearizeElement_(elem);
                 }
             }
@@ -601,10 +822,56 @@ private:
         applyConstraintsToLinearization_();
     }
 
+    // linearize the full domain by sweeping the element color groups one
+    // after the other; elements within a group never write to the same rows
+    // of the global system, so their scatter can proceed without a lock
+    void linearizeColoredElements_()
+    {
+        std::mutex exceptionLock;
+        std::exception_ptr exceptionPtr = nullptr;
+
+        const auto& grid = gridView_().grid();
+        const std::size_t numGroups = colorGroupOffsets_.size() - 1;
+        for (std::size_t group = 0; group < numGroups; ++group) {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (std::size_t i = colorGroupOffsets_[group]; i < colorGroupOffsets_[group + 1]; ++i) {
+                try {
+                    const Element elem = grid.entity(coloredElementSeeds_[i]);
+                    if (!linearizeNonLocalElements && elem.partitionType() != Dune::InteriorEntity) {
+                        continue;
+                    }
+
+                    if (usePartialRelinearization_ && !elementNeedsRelinearization_(elem)) {
+                        continue;
+                    }
+
+                    linearizeElement_(elem, /*useLock=*/false);
+                }
+                // as in the work-sharing loop below, exceptions must not
+                // escape the parallel region; tuck one of them away and
+                // rethrow it once all threads have finished
+                catch (...) {
+                    std::lock_guard<std::mutex> take(exceptionLock);
+                    exceptionPtr = std::current_exception();
+                }
+            }
+
+            if (exceptionPtr) {
+                std::rethrow_exception(exceptionPtr);
+            }
+        }
+    }
+
     // linearize an element in the interior of the process' grid partition
     template <class ElementType>
-    void linearizeElement_(const ElementType& elem)
+    void linearizeElement_(const ElementType& elem,
+                           const bool useLock = getPropValue<TypeTag, Properties::UseLinearizationLock>())
     {
+        // reclaim all arena temporaries of this element when leaving the scope
+        const ThreadArena::Scope arenaScope;
+
         const unsigned threadId = ThreadManager::threadId();
 
         ElementContext& elementCtx = *elementCtx_[threadId];
@@ -614,7 +881,7 @@ private:
         localLinearizer.linearize(elementCtx, elem);
 
         // update the right hand side and the Jacobian matrix
-        if (getPropValue<TypeTag, Properties::UseLinearizationLock>()) {
+        if (getPropValue<TypeTag, Properties::UseLinearizationLock>() && useLock) {
             globalMatrixMutex_.lock();
         }
 
@@ -622,22 +889,45 @@ private:
         for (unsigned primaryDofIdx = 0; primaryDofIdx < numPrimaryDof; ++primaryDofIdx) {
             const unsigned globI = elementCtx.globalSpaceIndex(/*spaceIdx=*/primaryDofIdx, /*timeIdx=*/0);
 
-            // update the right hand side
-            residual_[globI] += localLinearizer.residual(primaryDofIdx);
+            // update the right hand side. in the partial relinearization case,
+            // rows which were not reset must not be touched.
+            if (!usePartialRelinearization_ || rowNeedsRecalculation_[globI]) {
+                residual_[globI] += localLinearizer.residual(primaryDofIdx);
+            }
 
             // update the global Jacobian matrix
             for (unsigned dofIdx = 0; dofIdx < elementCtx.numDof(/*timeIdx=*/0); ++dofIdx) {
                 const unsigned globJ = elementCtx.globalSpaceIndex(/*spaceIdx=*/dofIdx, /*timeIdx=*/0);
 
+                if (usePartialRelinearization_ && !rowNeedsRecalculation_[globJ]) {
+                    continue;
+                }
+
                 jacobian_->addToBlock(globJ, globI, localLinearizer.jacobian(dofIdx, primaryDofIdx));
             }
         }
 
-        if (getPropValue<TypeTag, Properties::UseLinearizationLock>()) {
+        if (getPropValue<TypeTag, Properties::UseLinearizationLock>() && useLock) {
             globalMatrixMutex_.unlock();
         }
     }
 
+    // returns true if any row written by the element's linearization is
+    // flagged for recalculation; elements for which this is false can be
+    // skipped entirely by a partial relinearization
+    template <class ElementType>
+    bool elementNeedsRelinearization_(const ElementType& elem)
+    {
+        ElementContext& elemCtx = *elementCtx_[ThreadManager::threadId()];
+        elemCtx.updateStencil(elem);
+        for (unsigned dofIdx = 0; dofIdx < elemCtx.numDof(/*timeIdx=*/0); ++dofIdx) {
+            if (rowNeedsRecalculation_[elemCtx.globalSpaceIndex(dofIdx, /*timeIdx=*/0)]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     // apply the constraints to the solution. (i.e., the solution of constraint degrees
     // of freedom is set to the value of the constraint.)
     void applyConstraintsToSolution_()
@@ -712,6 +1002,22 @@ private:
 
     std::vector<std::set<unsigned int>> sparsityPattern_;
 
+    // element color groups for lock-free scatter (see
+    // EnableColoredLinearization); the seeds are stored in color-major
+    // order with colorGroupOffsets_ delimiting the groups
+    bool coloredLinearization_ = false;
+    std::vector<std::size_t> colorGroupOffsets_;
+    std::vector<ElementSeed> coloredElementSeeds_;
+
+    // state of the incremental linearization mode (see
+    // EnableIncrementalLinearization)
+    bool incrementalLinearization_ = false;
+    bool usePartialRelinearization_ = false;
+    bool haveLastSolution_ = false;
+    Scalar incrementalTolerance_ = 0.0;
+    std::vector<bool> rowNeedsRecalculation_;
+    SolutionVector lastSolution_;
+
     struct FullDomain
     {
         explicit FullDomain(const GridView& v) : view (v) {}
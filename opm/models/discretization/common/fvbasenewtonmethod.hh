@@ -32,6 +32,8 @@
 #include <opm/models/nonlinear/newtonmethod.hh>
 #include <opm/models/utils/propertysystem.hh>
 
+#include <algorithm>
+
 namespace Opm {
 
 template <class TypeTag>
@@ -102,6 +104,62 @@ public:
 protected:
     friend class NewtonMethod<TypeTag>;
 
+    /*!
+     * \brief Called before the Newton method is applied.
+     *
+     * If the predictor is enabled, the initial guess is obtained by linearly
+     * extrapolating the solution trajectory of the previously solved time
+     * step, scaled by the ratio of the time-step sizes. For smooth transients
+     * this moves the starting point considerably closer to the solution of
+     * the current time step, which typically saves one Newton iteration. The
+     * extrapolated state is only used as an initial guess; the first Newton
+     * iteration evaluates the exact residual and Jacobian there, so the
+     * converged result is unaffected.
+     */
+    void begin_(const SolutionVector& u)
+    {
+        ParentType::begin_(u);
+
+        if (this->params_.predictor_) {
+            applyPredictor_();
+        }
+    }
+
+    /*!
+     * \brief Called if the Newton method was successful.
+     *
+     * Records the solution trajectory of the time step which was just
+     * solved. It serves as the basis for the predictor of the next time
+     * step.
+     */
+    void succeeded_()
+    {
+        ParentType::succeeded_();
+
+        if (this->params_.predictor_) {
+            // at this point the time level has not been advanced yet, i.e.,
+            // solution(1) still holds the converged solution of the previous
+            // time step
+            previousSolution_ = model_().solution(/*historyIdx=*/1);
+            previousTimeStepSize_ = this->simulator_.timeStepSize();
+            predictorBasisValid_ = true;
+        }
+    }
+
+    /*!
+     * \brief Called if the Newton method broke down.
+     *
+     * The time step will be retried with a reduced size, so the recorded
+     * trajectory no longer corresponds to the solution history and must not
+     * be used for extrapolation.
+     */
+    void failed_()
+    {
+        predictorBasisValid_ = false;
+
+        ParentType::failed_();
+    }
+
     /*!
      * \brief Update the current solution with a delta vector.
      *
@@ -147,6 +205,51 @@ protected:
         ParentType::beginIteration_();
     }
 
+    /*!
+     * \brief Extrapolate the recorded solution trajectory to obtain the
+     *        initial guess for the current time step.
+     */
+    void applyPredictor_()
+    {
+        auto& nextSolution = model_().solution(/*historyIdx=*/0);
+
+        if (!predictorBasisValid_
+            || previousSolution_.size() != nextSolution.size()
+            || previousTimeStepSize_ <= 0.0)
+        {
+            return;
+        }
+
+        // limit the extrapolation distance if the time-step size grew
+        // strongly, e.g. after the beginning of an episode
+        const Scalar ratio =
+            std::min(this->simulator_.timeStepSize() / previousTimeStepSize_,
+                     Scalar{2.0});
+        if (ratio <= 0.0) {
+            return;
+        }
+
+        // only extrapolate the degrees of freedom of the spatial domain; the
+        // auxiliary DOFs are managed by their respective modules
+        const unsigned numGridDof = model_().numGridDof();
+        for (unsigned dofIdx = 0; dofIdx < numGridDof; ++dofIdx) {
+            auto delta = nextSolution[dofIdx];
+            delta -= previousSolution_[dofIdx];
+            delta *= ratio;
+            nextSolution[dofIdx] += delta;
+        }
+
+        // the intensive quantities of the current time index need to be
+        // recalculated at the extrapolated solution
+        if (model_().storeIntensiveQuantities()) {
+            for (unsigned dofIdx = 0; dofIdx < numGridDof; ++dofIdx) {
+                model_().setIntensiveQuantitiesCacheEntryValidity(dofIdx,
+                                                                  /*timeIdx=*/0,
+                                                                  /*valid=*/false);
+            }
+        }
+    }
+
     /*!
      * \brief Returns a reference to the model.
      */
@@ -159,6 +262,12 @@ protected:
     const Model& model_() const
     { return ParentType::model(); }
 
+    // basis for the predictor: the converged solution and the size of the
+    // most recently solved time step
+    SolutionVector previousSolution_{};
+    Scalar previousTimeStepSize_ = 0.0;
+    bool predictorBasisValid_ = false;
+
 private:
     Implementation& asImp_()
     { return *static_cast<Implementation*>(this); }
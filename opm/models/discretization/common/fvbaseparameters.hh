@@ -60,6 +60,17 @@ struct EnableAsyncVtkOutput { static constexpr bool value = true; };
  */
 struct EnableGridAdaptation { static constexpr bool value = false; };
 
+/*!
+ * \brief Switch to request huge page backing for large, long-lived arrays.
+ *
+ * When enabled, allocations such as the Jacobian matrix values and the
+ * intensive quantities cache advise the kernel to back them with
+ * transparent huge pages, reducing TLB pressure during the linear sweeps
+ * of the linearization. The advice is best effort: if huge pages are
+ * unavailable the allocations stay on regular pages.
+ */
+struct EnableHugePages { static constexpr bool value = false; };
+
 /*!
  * \brief Specify whether all intensive quantities for the grid should be
  *        cached in the discretization.
@@ -71,6 +82,18 @@ struct EnableGridAdaptation { static constexpr bool value = false; };
  */
 struct EnableIntensiveQuantityCache { static constexpr bool value = false; };
 
+/*!
+ * \brief Specify whether a structure-of-arrays mirror of the hot intensive
+ *        quantities fields (pressure, mobility, density, inverse formation
+ *        volume factors) should be maintained next to the cache.
+ *
+ * The mirror stores each field contiguously over all degrees of freedom, so
+ * flux kernels touching only a few fields do not drag whole intensive
+ * quantities objects through the cache. It has no effect for models whose
+ * intensive quantities do not provide these fields.
+ */
+struct EnableIntensiveQuantitySoACache { static constexpr bool value = false; };
+
 /*!
  * \brief Specify whether the storage terms for previous solutions should be cached.
  *
@@ -32,6 +32,8 @@
 #include <dune/common/fvector.hh>
 #include <dune/common/fmatrix.hh>
 
+#include <dune/grid/common/gridenums.hh>
+
 #include <opm/common/Exceptions.hpp>
 #include <opm/common/TimingMacros.hpp>
 
@@ -47,8 +49,11 @@
 #include <opm/models/discretization/common/baseauxiliarymodule.hh>
 #include <opm/models/discretization/common/fvbaseproperties.hh>
 #include <opm/models/discretization/common/linearizationtype.hh>
+#include <opm/models/utils/prefetch.hh>
+#include <opm/models/utils/threadarena.hh>
 #include <opm/simulators/linalg/exportSystem.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <exception>   // current_exception, rethrow_exception
@@ -81,6 +86,8 @@
 namespace Opm::Parameters {
 
 struct SeparateSparseSourceTerms { static constexpr bool value = false; };
+struct BatchedCellAssembly { static constexpr bool value = false; };
+struct SkipGhostCellAssembly { static constexpr bool value = false; };
 
 } // namespace Opm::Parameters
 
@@ -239,6 +246,8 @@ public:
     {
         simulatorPtr_ = nullptr;
         separateSparseSourceTerms_ = Parameters::Get<Parameters::SeparateSparseSourceTerms>();
+        batchedCellAssembly_ = Parameters::Get<Parameters::BatchedCellAssembly>();
+        skipGhostCellAssembly_ = Parameters::Get<Parameters::SkipGhostCellAssembly>();
         exportIndex_=-1;
         exportCount_=-1;
     }
@@ -250,6 +259,14 @@ public:
     {
         Parameters::Register<Parameters::SeparateSparseSourceTerms>
             ("Treat well source terms all in one go, instead of on a cell by cell basis.");
+        Parameters::Register<Parameters::BatchedCellAssembly>
+            ("Assemble cells in fixed-width batches with gathered intensive quantities, "
+             "to improve locality and vectorization of the assembly loop.");
+        Parameters::Register<Parameters::SkipGhostCellAssembly>
+            ("Do not assemble storage, source and boundary terms of overlap/ghost "
+             "cells, whose matrix rows are overwritten with identity by the linear "
+             "solver anyway. Only the flux coupling blocks into interior rows are "
+             "computed for such cells.");
     }
 
     /*!
@@ -364,6 +381,52 @@ public:
         linearize_(domain);
     }
 
+    /*!
+     * \brief Evaluate the residual for the current solution without assembling
+     *        the Jacobian.
+     *
+     * All derivative bookkeeping and matrix updates are compiled out of this
+     * code path, making it considerably cheaper than linearizeDomain().  It is
+     * intended for callers that only need an updated residual, e.g. for
+     * re-checking convergence after a damped update or a chopped time step.
+     *
+     * The storage cache is left untouched, so this must not be called before
+     * the first full linearization of a time step.  When sparse source terms
+     * are assembled separately, the well contributions are scattered into the
+     * Jacobian diagonal as a side effect; the Jacobian must in any case be
+     * considered stale until the next call to linearizeDomain().
+     */
+    void evaluateResidual()
+    {
+        int succeeded;
+        try {
+            OPM_TIMEBLOCK(evaluateResidual);
+            if (!jacobian_) {
+                initFirstIteration_();
+            }
+            residual_ = 0.0;
+            linearize_</*residualOnly=*/true>(fullDomain_);
+            succeeded = 1;
+        }
+        catch (const std::exception& e) {
+            std::cout << "rank " << simulator_().gridView().comm().rank()
+                      << " caught an exception while evaluating the residual:" << e.what()
+                      << "\n"  << std::flush;
+            succeeded = 0;
+        }
+        catch (...) {
+            std::cout << "rank " << simulator_().gridView().comm().rank()
+                      << " caught an exception while evaluating the residual"
+                      << "\n"  << std::flush;
+            succeeded = 0;
+        }
+        succeeded = simulator_().gridView().comm().min(succeeded);
+
+        if (!succeeded) {
+            throw NumericalProblem("A process did not succeed in evaluating the residual");
+        }
+    }
+
     void finalize()
     { jacobian_->finalize(); }
 
@@ -571,11 +634,26 @@ private:
         unsigned numCells = model.numTotalDof();
         neighborInfo_.reserve(numCells, 6 * numCells);
         std::vector<NeighborInfoCPU> loc_nbinfo;
+
+        // Ghost-row suppression only makes sense for parallel runs.  It is
+        // also incompatible with dispersion and bioeffects: those modules
+        // read the per-cell filter velocities of overlap cells from
+        // velocityInfo_, which the ghost fast path does not fill.
+        const bool dispersionActive =
+            simulator_().vanguard().eclState().getSimulationConfig().rock_config().dispersion();
+        skipGhostCellAssembly_ = skipGhostCellAssembly_ && (gridView_().comm().size() > 1)
+            && !dispersionActive && !enableBioeffects;
+        cellIsGhost_.assign(skipGhostCellAssembly_ ? numCells : 0, false);
+
         for (const auto& elem : elements(gridView_())) {
             stencil.update(elem);
+            const bool elemIsGhost = elem.partitionType() != Dune::InteriorEntity;
 
             for (unsigned primaryDofIdx = 0; primaryDofIdx < stencil.numPrimaryDof(); ++primaryDofIdx) {
                 const unsigned myIdx = stencil.globalSpaceIndex(primaryDofIdx);
+                if (skipGhostCellAssembly_) {
+                    cellIsGhost_[myIdx] = elemIsGhost;
+                }
                 loc_nbinfo.resize(stencil.numDof() - 1); // Do not include the primary dof in neighborInfo_
 
                 for (unsigned dofIdx = 0; dofIdx < stencil.numDof(); ++dofIdx) {
@@ -650,6 +728,20 @@ private:
         diagMatAddress_.resize(numCells);
         // create matrix structure based on sparsity pattern
         jacobian_->reserve(sparsityPattern);
+
+#ifdef _OPENMP
+        // First-touch initialization of the freshly allocated matrix
+        // storage: zero each row from the thread that assembles the
+        // corresponding cell in linearize_(), using the same default
+        // schedule as the assembly loops. On NUMA machines this places the
+        // matrix pages on the memory domain of the thread that writes them
+        // instead of on the domain of the allocating (main) thread.
+#pragma omp parallel for
+        for (unsigned globI = 0; globI < numCells; ++globI) {
+            jacobian_->clearRow(globI, 0.0);
+        }
+#endif
+
         for (unsigned globI = 0; globI < numCells; globI++) {
             const auto& nbInfos = neighborInfo_[globI];
             diagMatAddress_[globI] = jacobian_->blockAddress(globI, globI);
@@ -666,9 +758,22 @@ private:
     // reset the global linear system of equations.
     void resetSystem_()
     {
+#ifdef _OPENMP
+        // Zero the system row-by-row with the same default schedule as the
+        // assembly loops. Besides parallelizing the reset itself, this keeps
+        // the memory pages of the linear system on the NUMA domain of the
+        // threads that assemble into them (see createMatrix_()).
+        const unsigned numCells = model_().numTotalDof();
+#pragma omp parallel for
+        for (unsigned globI = 0; globI < numCells; ++globI) {
+            residual_[globI] = 0.0;
+            jacobian_->clearRow(globI, 0.0);
+        }
+#else
         residual_ = 0.0;
         // zero all matrix entries
         jacobian_->clear();
+#endif
     }
 
     // Initialize the flows, flores, and velocity sparse tables
@@ -814,6 +919,13 @@ public:
         }
     }
 
+    void setResidual(VectorBlock& res, const ADVectorBlock& resid) const
+    {
+        for (unsigned eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+            res[eqIdx] = resid[eqIdx].value();
+        }
+    }
+
     void updateFlowsInfo()
     {
         OPM_TIMEBLOCK(updateFlows);
@@ -830,6 +942,13 @@ public:
 #pragma omp parallel for
 #endif
         for (unsigned globI = 0; globI < numCells; ++globI) {
+            // When the last linearization covered the full domain, the
+            // assembly loop already scattered the face fluxes into the
+            // flows/flores tables as they were computed, so only ghost
+            // rows -- which skip assembly -- are left to recompute.
+            if (fluxCaptureValid_ && !(skipGhostCellAssembly_ && cellIsGhost_[globI])) {
+                continue;
+            }
             OPM_TIMEBLOCK_LOCAL(linearizationForEachCell, Subsystem::Assembly);
             const auto& nbInfos = neighborInfo_[globI];
             ADVectorBlock adres(0.0);
@@ -877,6 +996,9 @@ public:
             if (bdyInfo.bcdata.type == BCType::NONE) {
                 continue;
             }
+            if (fluxCaptureValid_ && !(skipGhostCellAssembly_ && cellIsGhost_[bdyInfo.cell])) {
+                continue;
+            }
 
             ADVectorBlock adres(0.0);
             const unsigned globI = bdyInfo.cell;
@@ -895,7 +1017,10 @@ public:
     }
 
 private:
-    template <class SubDomainType>
+    // Assemble residual and Jacobian on the given subdomain.  When
+    // 'residualOnly' is set, all Jacobian updates are compiled out and only
+    // the residual is evaluated; see evaluateResidual().
+    template <bool residualOnly = false, class SubDomainType>
     void linearize_(const SubDomainType& domain)
     {
         // This check should be removed once this is addressed by
@@ -913,56 +1038,237 @@ private:
         // the full system to zero, not just our part.
         // Instead, that must be called before starting the linearization.
         const bool dispersionActive = simulator_().vanguard().eclState().getSimulationConfig().rock_config().dispersion();
-        const auto& blockVelocity = simulator_().problem().eclWriter().outputModule().getFlows().blockVelocity();
+        const auto& flowsOutput = simulator_().problem().eclWriter().outputModule().getFlows();
+        const auto& blockVelocity = flowsOutput.blockVelocity();
         const unsigned int numCells = domain.cells.size();
 
+        // FLOWS/FLORES consumers receive the face fluxes while they are
+        // being assembled (and still in registers), mirroring the
+        // conditions of updateFlowsInfo() so that the separate face sweep
+        // there collapses to the ghost rows after a full-domain
+        // linearization.
+        const auto& blockFlows = flowsOutput.blockFlows();
+        const bool isTemp = simulator_().vanguard().eclState().getSimulationConfig().isTemp();
+        const bool captureFlows = flowsOutput.hasFlows();
+        const bool captureFlores = flowsOutput.hasFlores() || isTemp;
+        fluxCaptureValid_ = false;
+
         // Fetch timestepsize used later in accumulation term.
         const double dt = simulator_().timeStepSize();
 
+        if (batchedCellAssembly_) {
+            // Process the cells in fixed-width batches. The intensive
+            // quantities of a whole batch are gathered up front, so the
+            // per-lane assembly below works on data that is already hot in
+            // cache and the tight lane loop is amenable to vectorization.
+            const unsigned numBatches = (numCells + cellBatchSize_ - 1) / cellBatchSize_;
 #ifdef _OPENMP
 #pragma omp parallel for
 #endif
-        for (unsigned ii = 0; ii < numCells; ++ii) {
-            OPM_TIMEBLOCK_LOCAL(linearizationForEachCell, Subsystem::Assembly);
-            const unsigned globI = domain.cells[ii];
-            const auto& nbInfos = neighborInfo_[globI];
+            for (unsigned batch = 0; batch < numBatches; ++batch) {
+                OPM_TIMEBLOCK_LOCAL(linearizationForEachBatch, Subsystem::Assembly);
+                const unsigned begin = batch * cellBatchSize_;
+                const unsigned end = std::min(begin + cellBatchSize_, numCells);
+                // Gather pass: touch the intensive quantities of all lanes
+                // before any of them is assembled.
+                for (unsigned ii = begin; ii < end; ++ii) {
+                    model_().intensiveQuantities(domain.cells[ii], /*timeIdx*/ 0);
+                }
+                for (unsigned ii = begin; ii < end; ++ii) {
+                    linearizeCell_<residualOnly>(domain.cells[ii], dt, dispersionActive, blockVelocity,
+                                                 captureFlows, captureFlores, blockFlows);
+                }
+            }
+        }
+        else {
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+            for (unsigned ii = 0; ii < numCells; ++ii) {
+                OPM_TIMEBLOCK_LOCAL(linearizationForEachCell, Subsystem::Assembly);
+                linearizeCell_<residualOnly>(domain.cells[ii], dt, dispersionActive, blockVelocity,
+                                                 captureFlows, captureFlores, blockFlows);
+            }
+        }
+
+        // Add sparse source terms from wells and aquifers.  The well residual
+        // contributions are needed in residual-only mode as well; the
+        // derivatives scattered into the (stale) Jacobian diagonal in that
+        // mode are discarded at the next full linearization.
+        if (separateSparseSourceTerms_) {
+            problem_().wellModel().addReservoirSourceTerms(residual_, diagMatAddress_);
+            problem_().aquiferModel().addReservoirSourceTerms(residual_, diagMatAddress_);
+        }
+
+        // Boundary terms. Only looping over cells with nontrivial bcs.
+        for (const auto& bdyInfo : boundaryInfo_) {
+            if (bdyInfo.bcdata.type == BCType::NONE) {
+                continue;
+            }
+            if (skipGhostCellAssembly_ && cellIsGhost_[bdyInfo.cell]) {
+                continue;
+            }
+
             VectorBlock res(0.0);
             MatrixBlock bMat(0.0);
             ADVectorBlock adres(0.0);
-            ADVectorBlock darcyFlux(0.0);
-            const IntensiveQuantities& intQuantsIn = model_().intensiveQuantities(globI, /*timeIdx*/ 0);
+            const unsigned globI = bdyInfo.cell;
+            const IntensiveQuantities& insideIntQuants = model_().intensiveQuantities(globI, /*timeIdx*/ 0);
+            LocalResidual::computeBoundaryFlux(adres, problem_(), bdyInfo.bcdata, insideIntQuants, globI);
+            adres *= bdyInfo.bcdata.faceArea;
+            if (captureFlows) {
+                const auto numNeighbors = neighborInfo_[globI].size();
+                for (unsigned eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+                    flowsInfo_[globI][numNeighbors + bdyInfo.bfIndex].flow[eqIdx] = adres[eqIdx].value();
+                }
+            }
+            if constexpr (residualOnly) {
+                setResidual(res, adres);
+                residual_[globI] += res;
+            }
+            else {
+                setResAndJacobi(res, bMat, adres);
+                residual_[globI] += res;
+                ////SparseAdapter syntax: jacobian_->addToBlock(globI, globI, bMat);
+                *diagMatAddress_[globI] += bMat;
+            }
+        }
 
-            // Flux term.
+        // The flows/flores tables now hold the fluxes of this
+        // linearization; updateFlowsInfo() only needs to fill in the ghost
+        // rows if this pass covered the full domain.
+        fluxCaptureValid_ = (captureFlows || captureFlores || !blockFlows.empty())
+            && (numCells == model_().numTotalDof());
+    }
+
+    // Assemble flux, accumulation and source terms of a single cell.
+    template <bool residualOnly = false, class BlockVelocityContainer, class BlockFlowsContainer>
+    void linearizeCell_(const unsigned globI,
+                        const double dt,
+                        const bool dispersionActive,
+                        const BlockVelocityContainer& blockVelocity,
+                        const bool captureFlows,
+                        const bool captureFlores,
+                        const BlockFlowsContainer& blockFlows)
+    {
+        // reclaim all arena temporaries of this cell when leaving the scope
+        const ThreadArena::Scope arenaScope;
+
+        const auto& nbInfos = neighborInfo_[globI];
+        VectorBlock res(0.0);
+        MatrixBlock bMat(0.0);
+        ADVectorBlock adres(0.0);
+        ADVectorBlock darcyFlux(0.0);
+        const IntensiveQuantities& intQuantsIn = model_().intensiveQuantities(globI, /*timeIdx*/ 0);
+
+        if (skipGhostCellAssembly_ && cellIsGhost_[globI]) {
+            if constexpr (residualOnly) {
+                // Ghost rows only contribute coupling blocks to the matrix.
+                return;
+            }
+
+            // The row of this cell is overwritten with an identity row by
+            // the linear solver before solving, so its residual, diagonal,
+            // storage, source and boundary terms are never used.  Only the
+            // coupling blocks this cell scatters into the rows of its
+            // interior neighbours are needed.
+            OPM_TIMEBLOCK_LOCAL(fluxCalculationForEachCell, Subsystem::Assembly);
+            for (const auto& nbInfo : nbInfos) {
+                const unsigned globJ = nbInfo.neighbor;
+                assert(globJ != globI);
+                if (cellIsGhost_[globJ]) {
+                    continue;
+                }
+                adres = 0.0;
+                darcyFlux = 0.0;
+                const IntensiveQuantities& intQuantsEx = model_().intensiveQuantities(globJ, /*timeIdx*/ 0);
+                LocalResidual::computeFlux(adres, darcyFlux, globI, globJ, intQuantsIn, intQuantsEx,
+                                           nbInfo.res_nbinfo, problem_().moduleParams());
+                adres *= nbInfo.res_nbinfo.faceArea;
+                setResAndJacobi(res, bMat, adres);
+                bMat *= -1.0;
+                *nbInfo.matBlockAddress += bMat;
+            }
+            return;
+        }
+
+        // Flux term.
+        {
+            OPM_TIMEBLOCK_LOCAL(fluxCalculationForEachCell, Subsystem::Assembly);
+            // Software-prefetch the intensive quantities gathered a couple
+            // of faces ahead of the one being assembled.  The neighbor
+            // indices are indirect, so the hardware prefetchers cannot
+            // follow them, and the gathers otherwise stall on memory.
+            constexpr unsigned prefetchDistance = 2;
+            const auto nbBegin = nbInfos.begin();
+            const auto numNb = static_cast<unsigned>(nbInfos.size());
+            auto prefetchNeighborIntQuants = [&](const unsigned nbIdx)
             {
-                OPM_TIMEBLOCK_LOCAL(fluxCalculationForEachCell, Subsystem::Assembly);
-                short loc = 0;
-                for (const auto& nbInfo : nbInfos) {
-                    OPM_TIMEBLOCK_LOCAL(fluxCalculationForEachFace, Subsystem::Assembly);
-                    const unsigned globJ = nbInfo.neighbor;
-                    assert(globJ != globI);
-                    res = 0.0;
-                    bMat = 0.0;
-                    adres = 0.0;
-                    darcyFlux = 0.0;
-                    const IntensiveQuantities& intQuantsEx = model_().intensiveQuantities(globJ, /*timeIdx*/ 0);
-                    LocalResidual::computeFlux(adres, darcyFlux, globI, globJ, intQuantsIn, intQuantsEx,
-                                               nbInfo.res_nbinfo, problem_().moduleParams());
-                    adres *= nbInfo.res_nbinfo.faceArea;
-                    if (dispersionActive || enableBioeffects) {
+                if (nbIdx < numNb) {
+                    if (const auto* iq = model_().cachedIntensiveQuantities(nbBegin[nbIdx].neighbor, /*timeIdx=*/0)) {
+                        prefetch(*iq);
+                    }
+                }
+            };
+            for (unsigned nbIdx = 0; nbIdx < std::min(prefetchDistance, numNb); ++nbIdx) {
+                prefetchNeighborIntQuants(nbIdx);
+            }
+
+            short loc = 0;
+            for (const auto& nbInfo : nbInfos) {
+                OPM_TIMEBLOCK_LOCAL(fluxCalculationForEachFace, Subsystem::Assembly);
+                prefetchNeighborIntQuants(static_cast<unsigned>(loc) + prefetchDistance);
+                const unsigned globJ = nbInfo.neighbor;
+                assert(globJ != globI);
+                res = 0.0;
+                bMat = 0.0;
+                adres = 0.0;
+                darcyFlux = 0.0;
+                const IntensiveQuantities& intQuantsEx = model_().intensiveQuantities(globJ, /*timeIdx*/ 0);
+                LocalResidual::computeFlux(adres, darcyFlux, globI, globJ, intQuantsIn, intQuantsEx,
+                                           nbInfo.res_nbinfo, problem_().moduleParams());
+                adres *= nbInfo.res_nbinfo.faceArea;
+                if (dispersionActive || enableBioeffects) {
+                    for (unsigned phaseIdx = 0; phaseIdx < numEq; ++phaseIdx) {
+                        velocityInfo_[globI][loc].velocity[phaseIdx] =
+                            darcyFlux[phaseIdx].value() / nbInfo.res_nbinfo.faceArea;
+                    }
+                }
+                else if (!blockVelocity.empty()) {
+                    if (std::ranges::binary_search(blockVelocity,
+                                                   simulator_().vanguard().cartesianIndex(globI))) {
                         for (unsigned phaseIdx = 0; phaseIdx < numEq; ++phaseIdx) {
                             velocityInfo_[globI][loc].velocity[phaseIdx] =
                                 darcyFlux[phaseIdx].value() / nbInfo.res_nbinfo.faceArea;
                         }
                     }
-                    else if (!blockVelocity.empty()) {
-                        if (std::ranges::binary_search(blockVelocity,
-                                                       simulator_().vanguard().cartesianIndex(globI))) {
-                            for (unsigned phaseIdx = 0; phaseIdx < numEq; ++phaseIdx) {
-                                velocityInfo_[globI][loc].velocity[phaseIdx] =
-                                    darcyFlux[phaseIdx].value() / nbInfo.res_nbinfo.faceArea;
-                            }
+                }
+                // Hand the just-computed face fluxes to the FLOWS/FLORES
+                // output tables while they are still in registers.  The
+                // conditions mirror updateFlowsInfo().
+                if (!blockFlows.empty()) {
+                    if (std::ranges::binary_search(blockFlows,
+                                                   simulator_().vanguard().cartesianIndex(globI))) {
+                        for (unsigned eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+                            flowsInfo_[globI][loc].flow[eqIdx] = adres[eqIdx].value();
                         }
                     }
+                }
+                else if (captureFlows) {
+                    for (unsigned eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+                        flowsInfo_[globI][loc].flow[eqIdx] = adres[eqIdx].value();
+                    }
+                }
+                if (captureFlores) {
+                    for (unsigned eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+                        floresInfo_[globI][loc].flow[eqIdx] = darcyFlux[eqIdx].value();
+                    }
+                }
+                if constexpr (residualOnly) {
+                    setResidual(res, adres);
+                    residual_[globI] += res;
+                }
+                else {
                     setResAndJacobi(res, bMat, adres);
                     residual_[globI] += res;
                     //SparseAdapter syntax:  jacobian_->addToBlock(globI, globI, bMat);
@@ -970,21 +1276,28 @@ private:
                     bMat *= -1.0;
                     //SparseAdapter syntax: jacobian_->addToBlock(globJ, globI, bMat);
                     *nbInfo.matBlockAddress += bMat;
-                    ++loc;
                 }
+                ++loc;
             }
+        }
 
-            // Accumulation term.
-            const double volume = model_().dofTotalVolume(globI);
-            const Scalar storefac = volume / dt;
-            adres = 0.0;
-            {
-                OPM_TIMEBLOCK_LOCAL(computeStorage, Subsystem::Assembly);
-                LocalResidual::template computeStorage<Evaluation>(adres, intQuantsIn);
-            }
+        // Accumulation term.
+        const double volume = model_().dofTotalVolume(globI);
+        const Scalar storefac = volume / dt;
+        adres = 0.0;
+        {
+            OPM_TIMEBLOCK_LOCAL(computeStorage, Subsystem::Assembly);
+            LocalResidual::template computeStorage<Evaluation>(adres, intQuantsIn);
+        }
+        if constexpr (residualOnly) {
+            setResidual(res, adres);
+        }
+        else {
             setResAndJacobi(res, bMat, adres);
-            // Either use cached storage term, or compute it on the fly.
-            if (model_().enableStorageCache()) {
+        }
+        // Either use cached storage term, or compute it on the fly.
+        if (model_().enableStorageCache()) {
+            if constexpr (!residualOnly) {
                 // The cached storage for timeIdx 0 (current time) is not
                 // used, but after storage cache is shifted at the end of the
                 // timestep, it will become cached storage for timeIdx 1.
@@ -1009,61 +1322,45 @@ private:
                         model_().updateCachedStorage(globI, /*timeIdx=*/1, tmp);
                     }
                 }
-                res -= model_().cachedStorage(globI, 1);
-            }
-            else {
-                OPM_TIMEBLOCK_LOCAL(computeStorage0, Subsystem::Assembly);
-                Dune::FieldVector<Scalar, numEq> tmp;
-                const IntensiveQuantities intQuantOld = model_().intensiveQuantities(globI, 1);
-                LocalResidual::template computeStorage<Scalar>(tmp, intQuantOld);
-                // assume volume do not change
-                res -= tmp;
             }
-            res *= storefac;
+            res -= model_().cachedStorage(globI, 1);
+        }
+        else {
+            OPM_TIMEBLOCK_LOCAL(computeStorage0, Subsystem::Assembly);
+            Dune::FieldVector<Scalar, numEq> tmp;
+            const IntensiveQuantities intQuantOld = model_().intensiveQuantities(globI, 1);
+            LocalResidual::template computeStorage<Scalar>(tmp, intQuantOld);
+            // assume volume do not change
+            res -= tmp;
+        }
+        res *= storefac;
+        residual_[globI] += res;
+        if constexpr (!residualOnly) {
             bMat *= storefac;
-            residual_[globI] += res;
-            //SparseAdapter syntax: jacobian_->addToBlock(globI, globI, bMat);
-            *diagMatAddress_[globI] += bMat;
-
-            // Cell-wise source terms.
-            // This will include well sources if SeparateSparseSourceTerms is false.
-            res = 0.0;
-            bMat = 0.0;
-            adres = 0.0;
-            if (separateSparseSourceTerms_) {
-                LocalResidual::computeSourceDense(adres, problem_(), intQuantsIn, globI, 0);
-            }
-            else {
-                LocalResidual::computeSource(adres, problem_(), intQuantsIn, globI, 0);
-            }
-            adres *= -volume;
-            setResAndJacobi(res, bMat, adres);
-            residual_[globI] += res;
             //SparseAdapter syntax: jacobian_->addToBlock(globI, globI, bMat);
             *diagMatAddress_[globI] += bMat;
-        } // end of loop for cell globI.
+        }
 
-        // Add sparse source terms. For now only wells.
+        // Cell-wise source terms.
+        // This will include well sources if SeparateSparseSourceTerms is false.
+        res = 0.0;
+        bMat = 0.0;
+        adres = 0.0;
         if (separateSparseSourceTerms_) {
-            problem_().wellModel().addReservoirSourceTerms(residual_, diagMatAddress_);
+            LocalResidual::computeSourceDense(adres, problem_(), intQuantsIn, globI, 0);
         }
-
-        // Boundary terms. Only looping over cells with nontrivial bcs.
-        for (const auto& bdyInfo : boundaryInfo_) {
-            if (bdyInfo.bcdata.type == BCType::NONE) {
-                continue;
-            }
-
-            VectorBlock res(0.0);
-            MatrixBlock bMat(0.0);
-            ADVectorBlock adres(0.0);
-            const unsigned globI = bdyInfo.cell;
-            const IntensiveQuantities& insideIntQuants = model_().intensiveQuantities(globI, /*timeIdx*/ 0);
-            LocalResidual::computeBoundaryFlux(adres, problem_(), bdyInfo.bcdata, insideIntQuants, globI);
-            adres *= bdyInfo.bcdata.faceArea;
+        else {
+            LocalResidual::computeSource(adres, problem_(), intQuantsIn, globI, 0);
+        }
+        adres *= -volume;
+        if constexpr (residualOnly) {
+            setResidual(res, adres);
+            residual_[globI] += res;
+        }
+        else {
             setResAndJacobi(res, bMat, adres);
             residual_[globI] += res;
-            ////SparseAdapter syntax: jacobian_->addToBlock(globI, globI, bMat);
+            //SparseAdapter syntax: jacobian_->addToBlock(globI, globI, bMat);
             *diagMatAddress_[globI] += bMat;
         }
     }
@@ -1144,6 +1441,21 @@ private:
     std::vector<BoundaryInfo> boundaryInfo_;
 
     bool separateSparseSourceTerms_ = false;
+    bool batchedCellAssembly_ = false;
+    bool skipGhostCellAssembly_ = false;
+
+    // Marks overlap/ghost cells when SkipGhostCellAssembly is active,
+    // empty otherwise.  Filled in createMatrix_().
+    std::vector<bool> cellIsGhost_;
+
+    // True when the last linearization covered the full domain and wrote
+    // the face fluxes into the flows/flores tables along the way, so that
+    // updateFlowsInfo() can skip its recompute sweep for assembled cells.
+    bool fluxCaptureValid_ = false;
+
+    // Number of cells assembled together when BatchedCellAssembly is
+    // active. Chosen to match common SIMD register widths for double.
+    static constexpr unsigned cellBatchSize_ = 8;
 
     FullDomain<> fullDomain_;
 
@@ -41,6 +41,9 @@ void NewtonMethodParams<Scalar>::registerParameters()
     Parameters::Register<Parameters::NewtonWriteConvergence>
         ("Write the convergence behaviour of the Newton "
          "method to a VTK file");
+    Parameters::Register<Parameters::NewtonPredictor>
+        ("Extrapolate the solution of the previous time step forward "
+         "in time to obtain the initial guess for the Newton method");
     Parameters::Register<Parameters::NewtonTargetIterations>
         ("The 'optimum' number of Newton iterations per time step");
     Parameters::Register<Parameters::NewtonMaxIterations>
@@ -58,6 +61,7 @@ void NewtonMethodParams<Scalar>::read()
 {
     verbose_ = Parameters::Get<Parameters::NewtonVerbose>();
     writeConvergence_ = Parameters::Get<Parameters::NewtonWriteConvergence>();
+    predictor_ = Parameters::Get<Parameters::NewtonPredictor>();
     targetIterations_ = Parameters::Get<Parameters::NewtonTargetIterations>();
     maxIterations_ = Parameters::Get<Parameters::NewtonMaxIterations>();
     tolerance_ = Parameters::Get<Parameters::NewtonTolerance<Scalar>>();
@@ -52,6 +52,17 @@ struct NewtonTargetIterations { static constexpr int value = 10; };
 template<class Scalar>
 struct NewtonTolerance { static constexpr Scalar value = 1e-8; };
 
+/*!
+ * \brief Specifies whether the solution of the previous time step should be
+ *        extrapolated forward in time to obtain the initial guess for the
+ *        Newton method.
+ *
+ * If enabled, the first Newton iteration starts from a linear extrapolation
+ * of the solution trajectory instead of from the old solution, which tends
+ * to reduce the number of iterations required for smooth transients.
+ */
+struct NewtonPredictor { static constexpr bool value = false; };
+
 //! Specifies whether the Newton method should print messages or not
 struct NewtonVerbose { static constexpr bool value = true; };
 
@@ -77,6 +88,7 @@ struct NewtonMethodParams
 
     bool verbose_;
     bool writeConvergence_;
+    bool predictor_; //!< Extrapolate the previous solution trajectory to obtain the initial guess
     int targetIterations_; //!< Optimal number of iterations we want to achieve
     int maxIterations_; //!< Maximum number of iterations we do before giving up
     Scalar tolerance_;
@@ -125,6 +125,7 @@ void TaskletRunner::dispatch(std::shared_ptr<TaskletInterface> tasklet)
 
         // add the tasklet to the queue
         taskletQueue_.push(tasklet);
+        pendingTasklets_ += 1;
 
         taskletQueueMutex_.unlock();
 
@@ -146,6 +147,21 @@ void TaskletRunner::barrier()
     barrierTasklet->wait();
 }
 
+void TaskletRunner::waitForPending(unsigned maxPending)
+{
+    if (threads_.empty())
+        // in synchronous mode, tasklets are run immediately by dispatch()
+        return;
+
+    std::unique_lock<std::mutex> lock(taskletQueueMutex_);
+
+    const auto& fewEnoughPending =
+        [this, maxPending]() -> bool
+        { return pendingTasklets_ <= maxPending; };
+
+    taskletFinishedCondition_.wait(lock, /*predicate=*/fewEnoughPending);
+}
+
 void TaskletRunner::startWorkerThread_(TaskletRunner* taskletRunner, int workerThreadIndex)
 {
     TaskletRunner::taskletRunner_ = taskletRunner;
@@ -182,7 +198,8 @@ void TaskletRunner::run_()
         }
 
         tasklet->dereference();
-        if (tasklet->referenceCount() == 0)
+        const bool lastRun = (tasklet->referenceCount() == 0);
+        if (lastRun)
             // remove tasklets from the queue as soon as their reference count
             // reaches zero, i.e. the tasklet has been run often enough.
             taskletQueue_.pop();
@@ -200,6 +217,13 @@ void TaskletRunner::run_()
             std::cerr << "ERROR: Uncaught exception when running tasklet.\n";
             failureFlag_.store(true, std::memory_order_relaxed);
         }
+
+        if (lastRun) {
+            lock.lock();
+            pendingTasklets_ -= 1;
+            lock.unlock();
+            taskletFinishedCondition_.notify_all();
+        }
     }
 }
 
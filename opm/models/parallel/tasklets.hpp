@@ -181,6 +181,16 @@ public:
      */
     void barrier();
 
+    /*!
+     * \brief Wait until at most maxPending dispatched tasklets have not yet finished.
+     *
+     * With maxPending == 0 this is equivalent to a barrier; larger values
+     * allow a bounded number of tasklets to stay in flight, which can be used
+     * to overlap their execution with the caller while still applying
+     * backpressure when the queue grows. In synchronous mode this is a no-op.
+     */
+    void waitForPending(unsigned maxPending);
+
 private:
     // Atomic flag that is set to failure if any of the tasklets run by the TaskletRunner fails.
     // This flag is checked before new tasklets run or get dispatched and in case it is true, the
@@ -203,6 +213,10 @@ protected:
     std::queue<std::shared_ptr<TaskletInterface> > taskletQueue_;
     std::mutex taskletQueueMutex_;
     std::condition_variable workAvailableCondition_;
+    std::condition_variable taskletFinishedCondition_;
+    // number of dispatched tasklets that have not finished yet, protected by
+    // taskletQueueMutex_
+    unsigned pendingTasklets_ = 0;
 
     static thread_local TaskletRunner* taskletRunner_;
     static thread_local int workerThreadIndex_;
@@ -27,7 +27,13 @@
 #ifndef EWOMS_THREADED_ENTITY_ITERATOR_HH
 #define EWOMS_THREADED_ENTITY_ITERATOR_HH
 
+#include <opm/models/parallel/threadmanager.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <mutex>
+#include <vector>
 
 namespace Opm {
 
@@ -35,6 +41,12 @@ namespace Opm {
  * \brief Provides an STL-iterator like interface to iterate over the enties of a
  *        GridView in OpenMP threaded applications
  *
+ * Work is handed out in chunks of elements rather than one element per
+ * mutex acquisition. The chunks shrink as the loop progresses (guided
+ * scheduling): early chunks amortize the lock over many elements while
+ * the final ones stay small enough to balance heterogeneous per-element
+ * costs -- wells, three-phase cells -- at the tail of the loop.
+ *
  * ATTENTION: This class must be instantiated in a sequential context!
  */
 template <class GridView, int codim>
@@ -46,22 +58,16 @@ public:
     explicit ThreadedEntityIterator(const GridView& gridView)
         : sequentialIt_(gridView.template begin<codim>())
         , sequentialEnd_(gridView.template end<codim>())
+        , elementsLeft_(static_cast<std::size_t>(gridView.size(codim)))
+        , chunkState_(std::max<std::size_t>(ThreadManager::maxThreads(), 1),
+                      ChunkState{sequentialEnd_, 0})
     {}
 
     ThreadedEntityIterator(const ThreadedEntityIterator& other) = default;
 
     // begin iterating over the grid in parallel
     EntityIterator beginParallel()
-    {
-        mutex_.lock();
-        auto tmp = sequentialIt_;
-        if (sequentialIt_ != sequentialEnd_) {
-            ++sequentialIt_; // make the next thread look at the next element
-        }
-        mutex_.unlock();
-
-        return tmp;
-    }
+    { return fetchNext_(); }
 
     // returns true if the last element was reached
     bool isFinished(const EntityIterator& it) const
@@ -70,6 +76,8 @@ public:
     // make sure that the loop over the grid is finished
     void setFinished()
     {
+        finished_.store(true, std::memory_order_relaxed);
+
         mutex_.lock();
         sequentialIt_ = sequentialEnd_;
         mutex_.unlock();
@@ -78,21 +86,69 @@ public:
     // prefix increment: goes to the next element which is not yet worked on by any
     // thread
     EntityIterator increment()
+    { return fetchNext_(); }
+
+private:
+    // per-thread chunk of consecutive elements; aligned to a cache line
+    // since every thread updates its state once per element
+    struct alignas(64) ChunkState
     {
-        mutex_.lock();
-        auto tmp = sequentialIt_;
-        if (sequentialIt_ != sequentialEnd_) {
-            ++sequentialIt_;
+        EntityIterator next;
+        std::size_t remaining;
+    };
+
+    EntityIterator fetchNext_()
+    {
+        if (finished_.load(std::memory_order_relaxed)) {
+            return sequentialEnd_;
+        }
+
+        auto& state = chunkState_[ThreadManager::threadId()];
+        if (state.remaining == 0) {
+            refillChunk_(state);
+            if (state.remaining == 0) {
+                return sequentialEnd_;
+            }
+        }
+
+        auto tmp = state.next;
+        if (--state.remaining > 0) {
+            ++state.next;
         }
-        mutex_.unlock();
 
         return tmp;
     }
 
-private:
+    void refillChunk_(ChunkState& state)
+    {
+        const std::lock_guard<std::mutex> guard(mutex_);
+
+        // hand out a shrinking share of the remaining elements, but
+        // never less than a few elements per lock acquisition. The
+        // element count only tunes the chunk size; termination is
+        // governed by the end iterator.
+        const std::size_t chunk =
+            std::max<std::size_t>(elementsLeft_ / (4 * chunkState_.size()), 4);
+
+        state.next = sequentialIt_;
+
+        std::size_t granted = 0;
+        while (granted < chunk && sequentialIt_ != sequentialEnd_) {
+            ++sequentialIt_;
+            ++granted;
+        }
+
+        state.remaining = granted;
+        elementsLeft_ -= std::min(elementsLeft_, granted);
+    }
+
     EntityIterator sequentialIt_;
     EntityIterator sequentialEnd_;
 
+    std::size_t elementsLeft_;
+    std::vector<ChunkState> chunkState_;
+    std::atomic<bool> finished_{false};
+
     std::mutex mutex_;
 };
 
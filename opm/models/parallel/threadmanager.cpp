@@ -90,4 +90,14 @@ unsigned ThreadManager::threadId()
 #endif
 }
 
+bool ThreadManager::threadsBound()
+{
+#ifdef _OPENMP
+    return omp_get_proc_bind() != omp_proc_bind_false;
+#else
+    // without OpenMP there is only the main thread and nothing can migrate
+    return true;
+#endif
+}
+
 } // namespace Opm
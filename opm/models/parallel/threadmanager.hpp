@@ -71,6 +71,18 @@ public:
      */
     static unsigned threadId();
 
+    /*!
+     * \brief Return whether the OpenMP threads are bound to processors.
+     *
+     * Thread binding matters on multi-socket machines: with unbound
+     * threads the first-touch memory placement done when allocating the
+     * linear system is lost as soon as the threads migrate to another
+     * NUMA domain. Binding cannot be enabled programmatically after the
+     * OpenMP runtime has started, so this only reports the policy
+     * selected via OMP_PROC_BIND/OMP_PLACES.
+     */
+    static bool threadsBound();
+
 private:
     static int numThreads_;
 };
@@ -43,7 +43,9 @@
 #include <opm/models/ptflash/flashindices.hh>
 #include <opm/models/ptflash/flashparameters.hh>
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <iostream>
 #include <string>
 
@@ -117,9 +119,13 @@ public:
         const auto& priVars = elemCtx.primaryVars(dofIdx, timeIdx);
         const auto& problem = elemCtx.problem();
 
-        const Scalar flashTolerance = Parameters::Get<Parameters::FlashTolerance<Scalar>>();
-        const int flashVerbosity = Parameters::Get<Parameters::FlashVerbosity>();
-        const std::string flashTwoPhaseMethod = Parameters::Get<Parameters::FlashTwoPhaseMethod>();
+        // the flash parameters are fixed for the entire run, so look them up
+        // only once instead of for every cell and iteration
+        static const Scalar flashTolerance = Parameters::Get<Parameters::FlashTolerance<Scalar>>();
+        static const int flashVerbosity = Parameters::Get<Parameters::FlashVerbosity>();
+        static const std::string flashTwoPhaseMethod = Parameters::Get<Parameters::FlashTwoPhaseMethod>();
+        static const Scalar flashPreScreenTolerance =
+            Parameters::Get<Parameters::FlashPreScreenTolerance<Scalar>>();
         // TODO: the formulation here is still to begin with XMF and YMF values to derive ZMF value
         // TODO: we should check how we update ZMF in the newton update, since it is the primary variables.
 
@@ -187,7 +193,79 @@ public:
             std::cout << " updating the intensive quantities for Cell " << spatialIdx << std::endl;
         }
         const auto& eos_type = problem.getEosType();
-        FlashSolver::solve(fluidState_, flashTwoPhaseMethod, flashTolerance, eos_type, flashVerbosity);
+
+        // Cheap pre-screen: if the cell hardly moved in pressure and total
+        // composition since the last full flash, the phase state and the
+        // K-values of the hint are still (approximately) valid and the phase
+        // split can be reconstructed directly instead of running the full
+        // stability test and flash iteration. The K-values and the
+        // vapor-liquid fraction are then frozen at their hinted values, so
+        // the Jacobian is slightly approximate; this is controlled by an
+        // opt-in tolerance parameter.
+        bool skipFlash = false;
+        if (flashPreScreenTolerance > 0.0 && hint && hint->flashInputPressure_ > 0.0) {
+            Scalar delta = std::abs(getValue(p) - hint->flashInputPressure_) /
+                           hint->flashInputPressure_;
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                delta = std::max(delta, std::abs(getValue(z[compIdx]) -
+                                                 hint->flashInputZ_[compIdx]));
+            }
+            skipFlash = delta < flashPreScreenTolerance;
+        }
+
+        if (skipFlash) {
+            // reconstruct the phase split from the hinted K-values and
+            // vapor-liquid fraction, treated as constants
+            const Scalar L = getValue(hint->fluidState().L());
+            fluidState_.setLvalue(Evaluation(L));
+            constexpr Scalar singlePhaseEps = 1e-8;
+            if (L <= singlePhaseEps || L >= 1.0 - singlePhaseEps) {
+                // single phase: both phase compositions equal the total one
+                for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    fluidState_.setKvalue(compIdx, Evaluation(getValue(fluidState_.K(compIdx))));
+                    fluidState_.setMoleFraction(FluidSystem::oilPhaseIdx, compIdx, z[compIdx]);
+                    fluidState_.setMoleFraction(FluidSystem::gasPhaseIdx, compIdx, z[compIdx]);
+                }
+            }
+            else {
+                Evaluation sumx = 0.0;
+                Evaluation sumy = 0.0;
+                for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    const Scalar K = getValue(fluidState_.K(compIdx));
+                    fluidState_.setKvalue(compIdx, Evaluation(K));
+                    const Evaluation x = z[compIdx] / (L + (1.0 - L) * K);
+                    sumx += x;
+                    sumy += K * x;
+                    fluidState_.setMoleFraction(FluidSystem::oilPhaseIdx, compIdx, x);
+                    fluidState_.setMoleFraction(FluidSystem::gasPhaseIdx, compIdx, K * x);
+                }
+                // the current composition differs slightly from the one the
+                // hinted split was solved for, so re-normalize
+                for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                    fluidState_.setMoleFraction(FluidSystem::oilPhaseIdx, compIdx,
+                                                fluidState_.moleFraction(FluidSystem::oilPhaseIdx, compIdx) / sumx);
+                    fluidState_.setMoleFraction(FluidSystem::gasPhaseIdx, compIdx,
+                                                fluidState_.moleFraction(FluidSystem::gasPhaseIdx, compIdx) / sumy);
+                }
+            }
+            if (flashVerbosity >= 3) {
+                const int spatialIdx = elemCtx.globalSpaceIndex(dofIdx, timeIdx);
+                std::cout << " skipping flash for cell " << spatialIdx
+                          << " (pre-screen passed)" << std::endl;
+            }
+            // keep comparing against the state of the last full flash so
+            // that the drift since then stays bounded by the tolerance
+            flashInputPressure_ = hint->flashInputPressure_;
+            flashInputZ_ = hint->flashInputZ_;
+        }
+        else {
+            FlashSolver::solve(fluidState_, flashTwoPhaseMethod, flashTolerance, eos_type, flashVerbosity);
+
+            flashInputPressure_ = getValue(p);
+            for (unsigned compIdx = 0; compIdx < numComponents; ++compIdx) {
+                flashInputZ_[compIdx] = getValue(z[compIdx]);
+            }
+        }
 
         if (flashVerbosity >= 5) {
             // printing of flash result after solve
@@ -339,6 +417,12 @@ private:
     Evaluation porosity_;
     std::array<Evaluation,numPhases> relativePermeability_;
     std::array<Evaluation,numPhases> mobility_;
+
+    // pressure and total composition for which the last full flash was
+    // solved; used by the pre-screen to decide whether the phase split of
+    // the thermodynamic hint may be reused
+    Scalar flashInputPressure_ = 0.0;
+    std::array<Scalar,numComponents> flashInputZ_{};
 };
 
 } // namespace Opm
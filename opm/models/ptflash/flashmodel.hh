@@ -239,6 +239,10 @@ public:
         Parameters::Register<Parameters::FlashTwoPhaseMethod>
             ("Method for solving vapor-liquid composition. Available options include: "
              "ssi, newton, ssi+newton");
+        Parameters::Register<Parameters::FlashPreScreenTolerance<Scalar>>
+            ("Skip the full flash and reuse the phase split of the thermodynamic "
+             "hint when pressure and total composition moved less than this "
+             "relative amount since the last full flash (non-positive: disabled)");
 
         Parameters::SetDefault<Parameters::FlashTolerance<Scalar>>(1.e-8);
         Parameters::SetDefault<Parameters::EnableIntensiveQuantityCache>(true);
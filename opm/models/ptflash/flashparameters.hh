@@ -40,6 +40,13 @@ struct FlashTwoPhaseMethod { static constexpr auto value = "ssi"; };
 //! The verbosity level of the flash solver
 struct FlashVerbosity { static constexpr int value = 0; };
 
+//! Skip the full flash and reconstruct the phase split from the K-values
+//! and vapor-liquid fraction of the thermodynamic hint when pressure and
+//! total composition moved less than this (relative) amount since the last
+//! full flash. Non-positive values disable the bypass.
+template<class Scalar>
+struct FlashPreScreenTolerance { static constexpr Scalar value = -1.0; };
+
 } // namespace Opm::Parameters
 
 #endif
@@ -21,6 +21,8 @@
 #ifndef EWOMS_ALIGNED_ALLOCATOR_HH
 #define EWOMS_ALIGNED_ALLOCATOR_HH
 
+#include <opm/models/utils/hugepages.hpp>
+
 #include <cassert>
 #include <cstdlib>
 #include <memory>
@@ -83,6 +85,12 @@ inline void* aligned_alloc(std::size_t alignment,
     if (::posix_memalign(&p, alignment, size) != 0) {
         p = 0;
     }
+    else {
+        // large long-lived arrays such as the intensive quantities cache
+        // benefit from huge page backing; this is a no-op unless enabled
+        // at runtime and the allocation spans at least one huge page.
+        HugePages::advise(p, size);
+    }
     return p;
 }
 
@@ -0,0 +1,78 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+#include <config.h>
+#include <opm/models/utils/hugepages.hpp>
+
+#include <cstdint>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace {
+
+bool hugePagesEnabled = false;
+
+} // anonymous namespace
+
+namespace Opm::HugePages {
+
+void setEnabled(const bool enabled)
+{
+    hugePagesEnabled = enabled;
+}
+
+bool enabled()
+{
+    return hugePagesEnabled;
+}
+
+void advise([[maybe_unused]] void* ptr,
+            [[maybe_unused]] std::size_t size) noexcept
+{
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (!hugePagesEnabled) {
+        return;
+    }
+
+    // madvise() operates on whole pages, so round the region inward to the
+    // enclosed 2 MiB aligned range.  Allocations smaller than a huge page
+    // cost nothing beyond this arithmetic.
+    constexpr std::uintptr_t hugePageSize = std::uintptr_t{2} << 20;
+
+    const auto addr = reinterpret_cast<std::uintptr_t>(ptr);
+    const std::uintptr_t begin = (addr + hugePageSize - 1) & ~(hugePageSize - 1);
+    const std::uintptr_t end = (addr + size) & ~(hugePageSize - 1);
+
+    if (begin >= end) {
+        return;
+    }
+
+    // Best effort only: if transparent huge pages are disabled system-wide
+    // the call fails and the region stays on regular pages.
+    ::madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+#endif
+}
+
+} // namespace Opm::HugePages
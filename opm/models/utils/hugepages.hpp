@@ -0,0 +1,72 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+#ifndef OPM_HUGEPAGES_HPP
+#define OPM_HUGEPAGES_HPP
+
+#include <cstddef>
+
+namespace Opm {
+
+/*!
+ * \brief Best-effort transparent huge page backing for large, long-lived
+ *        allocations.
+ *
+ * Arrays that dominate the memory traffic of a simulation -- the Jacobian
+ * matrix values and the intensive quantities cache -- span many megabytes
+ * and are traversed linearly on every linearization.  Backing them with
+ * 2 MiB pages instead of 4 KiB ones reduces TLB misses and page walk
+ * overhead during these sweeps.
+ *
+ * The advice is purely a hint to the kernel (madvise(MADV_HUGEPAGE)); if
+ * transparent huge pages are unavailable or disabled system-wide the
+ * allocation simply stays on regular pages.  On non-Linux platforms all
+ * functions are no-ops.
+ */
+namespace HugePages {
+
+/*!
+ * \brief Globally enable or disable huge page advice.
+ *
+ * This is set once during startup from the EnableHugePages runtime
+ * parameter so that individual allocations do not need to consult the
+ * parameter system.
+ */
+void setEnabled(bool enabled);
+
+//! \brief Returns whether huge page advice is currently enabled.
+bool enabled();
+
+/*!
+ * \brief Advise the kernel to back the given memory region with huge pages.
+ *
+ * The region is shrunk to the enclosed 2 MiB aligned range; if no full huge
+ * page fits (i.e. for small allocations) no system call is issued.  Failures
+ * are silently ignored since the advice is only an optimization hint.
+ */
+void advise(void* ptr, std::size_t size) noexcept;
+
+} // namespace HugePages
+
+} // namespace Opm
+
+#endif // OPM_HUGEPAGES_HPP
@@ -0,0 +1,197 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \brief A thread-local bump ("arena") allocator for short-lived temporaries
+ *        on the assembly hot path.
+ *
+ * Allocations are simple pointer bumps inside a thread-local buffer and are
+ * never freed individually; instead, the arena is rewound wholesale once the
+ * temporaries go out of scope. This avoids malloc/free traffic for the small
+ * dynamic containers created per cell per Newton iteration.
+ */
+#ifndef EWOMS_THREAD_ARENA_HH
+#define EWOMS_THREAD_ARENA_HH
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief A growable thread-local bump allocator.
+ *
+ * Use ThreadArena::instance() to obtain the arena of the calling thread.
+ * Memory is handed out by bumping an offset; deallocation is only possible
+ * by rewinding the whole arena to an earlier mark. The capacity acquired by
+ * a thread is retained across rewinds, so a steady-state simulation stops
+ * touching the system allocator after the first few sweeps.
+ */
+class ThreadArena
+{
+public:
+    //! \brief Return the arena of the calling thread.
+    static ThreadArena& instance()
+    {
+        static thread_local ThreadArena arena;
+        return arena;
+    }
+
+    // the arena hands out pointers into its own storage, so it must stay put
+    ThreadArena(const ThreadArena&) = delete;
+    ThreadArena& operator=(const ThreadArena&) = delete;
+
+    /*!
+     * \brief Allocate size bytes with the given alignment.
+     *
+     * Falls back to growing the arena if the current block is exhausted.
+     */
+    void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+    {
+        const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(block_.get());
+        std::uintptr_t cur = base + offset_;
+        cur = (cur + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+        if (cur + size > base + capacity_) {
+            grow_(size + alignment);
+            return allocate(size, alignment);
+        }
+        offset_ = cur + size - base;
+        return reinterpret_cast<void*>(cur);
+    }
+
+    /*!
+     * \brief Rewind the arena to the given mark, reclaiming everything
+     *        allocated after it. The capacity is retained.
+     */
+    void rewind(std::size_t mark = 0) noexcept
+    {
+        offset_ = mark;
+        // overflow blocks from a growth episode can only be dropped once
+        // nothing points into them anymore, i.e. at a full rewind
+        if (mark == 0 && !retired_.empty()) {
+            retired_.clear();
+        }
+    }
+
+    //! \brief Return the current allocation mark.
+    std::size_t mark() const noexcept
+    { return offset_; }
+
+    //! \brief Number of bytes currently handed out.
+    std::size_t used() const noexcept
+    { return offset_; }
+
+    //! \brief Number of bytes the arena can hand out before growing.
+    std::size_t capacity() const noexcept
+    { return capacity_; }
+
+    /*!
+     * \brief RAII helper that rewinds the arena of the constructing thread
+     *        to the state it had at construction time.
+     */
+    class Scope
+    {
+    public:
+        Scope()
+            : arena_(ThreadArena::instance())
+            , mark_(arena_.mark())
+        {}
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        ~Scope()
+        { arena_.rewind(mark_); }
+
+    private:
+        ThreadArena& arena_;
+        std::size_t mark_;
+    };
+
+private:
+    ThreadArena() = default;
+
+    void grow_(std::size_t minBytes)
+    {
+        // the old block must survive until the next full rewind since
+        // live temporaries may still point into it
+        std::size_t newCapacity = capacity_ < initialCapacity_ ? initialCapacity_ : 2 * capacity_;
+        while (newCapacity < minBytes) {
+            newCapacity *= 2;
+        }
+        if (block_) {
+            retired_.push_back(std::move(block_));
+        }
+        block_.reset(new char[newCapacity]);
+        capacity_ = newCapacity;
+        offset_ = 0;
+    }
+
+    static constexpr std::size_t initialCapacity_ = 64 * 1024;
+
+    std::unique_ptr<char[]> block_{};
+    std::vector<std::unique_ptr<char[]>> retired_{};
+    std::size_t capacity_ = 0;
+    std::size_t offset_ = 0;
+};
+
+/*!
+ * \brief An STL-compatible allocator drawing from the thread-local arena.
+ *
+ * deallocate() is a no-op; memory is reclaimed when the surrounding
+ * ThreadArena::Scope rewinds the arena. Containers using this allocator
+ * must therefore not outlive the enclosing scope.
+ */
+template <class T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    ArenaAllocator() noexcept = default;
+
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>&) noexcept
+    {}
+
+    T* allocate(std::size_t n)
+    { return static_cast<T*>(ThreadArena::instance().allocate(n * sizeof(T), alignof(T))); }
+
+    void deallocate(T*, std::size_t) noexcept
+    {}
+
+    template <class U>
+    bool operator==(const ArenaAllocator<U>&) const noexcept
+    { return true; }
+
+    template <class U>
+    bool operator!=(const ArenaAllocator<U>&) const noexcept
+    { return false; }
+};
+
+} // namespace Opm
+
+#endif // EWOMS_THREAD_ARENA_HH
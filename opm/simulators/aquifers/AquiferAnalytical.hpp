@@ -144,24 +144,30 @@ public:
 
     void beginTimeStep() override
     {
-        ElementContext elemCtx(this->simulator_);
-        OPM_BEGIN_PARALLEL_TRY_CATCH();
-
-        for (const auto& elem : elements(this->simulator_.gridView())) {
-            elemCtx.updatePrimaryStencil(elem);
+        // The previous connection pressures are sampled by
+        // BlackoilAquiferModel::beginTimeStep() in a single grid sweep
+        // shared between all analytic aquifers.  See capturePreviousPressure().
+    }
 
-            const int cellIdx = elemCtx.globalSpaceIndex(0, 0);
-            const int idx = cellToConnectionIdx_[cellIdx];
-            if (idx < 0)
-                continue;
+    // Whether 'cellIdx' is one of this aquifer's connected cells on this process.
+    bool connectsToCell(const unsigned cellIdx) const
+    {
+        return this->cellToConnectionIdx_[cellIdx] >= 0;
+    }
 
-            elemCtx.updateIntensiveQuantities(0);
-            const auto& iq = elemCtx.intensiveQuantities(0, 0);
-            pressure_previous_[idx] = getValue(iq.fluidState().pressure(this->phaseIdx_()));
-        }
+    // Record the water pressure of connected cell 'cellIdx' at the start of
+    // a time step.  Called from BlackoilAquiferModel::beginTimeStep(), which
+    // visits every grid cell once on behalf of all analytic aquifers instead
+    // of having each aquifer traverse the grid on its own.
+    void capturePreviousPressure(const unsigned cellIdx,
+                                 const IntensiveQuantities& intQuants)
+    {
+        const int idx = this->cellToConnectionIdx_[cellIdx];
+        if (idx < 0)
+            return;
 
-        OPM_END_PARALLEL_TRY_CATCH("AquiferAnalytical::beginTimeStep() failed: ",
-                                   this->simulator_.vanguard().grid().comm());
+        this->pressure_previous_[idx] =
+            getValue(intQuants.fluidState().pressure(this->phaseIdx_()));
     }
 
     void addToSource(RateVector& rates,
@@ -207,6 +213,11 @@ public:
         return this->connections_.size();
     }
 
+    const std::vector<int>& connectionCells() const override
+    {
+        return this->connectionCells_;
+    }
+
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
@@ -286,6 +297,7 @@ protected:
         // total_face_area_ is the sum of the areas connected to an aquifer
         this->total_face_area_ = Scalar{0};
         this->cellToConnectionIdx_.resize(this->simulator_.gridView().size(/*codim=*/0), -1);
+        this->connectionCells_.clear();
         const auto& gridView = this->simulator_.vanguard().gridView();
         for (std::size_t idx = 0; idx < this->size(); ++idx) {
             const auto global_index = this->connections_[idx].global_index;
@@ -303,6 +315,7 @@ protected:
             }
 
             this->cellToConnectionIdx_[cell_index] = idx;
+            this->connectionCells_.push_back(cell_index);
         }
 
         // Translate the C face tag into the enum used by opm-parser's TransMult class
@@ -431,6 +444,7 @@ protected:
     // Grid variables
     std::vector<Scalar> faceArea_connected_;
     std::vector<int> cellToConnectionIdx_;
+    std::vector<int> connectionCells_;
 
     // Quantities at each grid id
     std::vector<Scalar> cell_depth_;
@@ -144,6 +144,11 @@ public:
                 += this->connection_flux_[idx] / model.dofTotalVolume(cellIdx);
     }
 
+    const std::vector<int>& connectionCells() const override
+    {
+        return this->connectionCells_;
+    }
+
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
@@ -161,6 +166,7 @@ private:
     SingleAquiferFlux aquifer_data_;
     std::vector<Eval> connection_flux_{};
     std::vector<int> cellToConnectionIdx_{};
+    std::vector<int> connectionCells_{};
     Scalar flux_rate_{};
     Scalar cumulative_flux_{};
     Scalar total_face_area_{0.0};
@@ -172,6 +178,7 @@ private:
 
         this->cellToConnectionIdx_
             .resize(this->simulator_.gridView().size(/*codim=*/0), -1);
+        this->connectionCells_.clear();
 
         for (std::size_t idx = 0; idx < this->connections_.size(); ++idx) {
             const auto global_index = this->connections_[idx].global_index;
@@ -183,6 +190,7 @@ private:
             }
 
             this->cellToConnectionIdx_[cell_index] = idx;
+            this->connectionCells_.push_back(cell_index);
 
             connected_face_area += this->connections_[idx].effective_facearea;
         }
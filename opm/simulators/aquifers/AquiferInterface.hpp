@@ -27,6 +27,8 @@
 
 #include <opm/output/data/Aquifer.hpp>
 
+#include <vector>
+
 namespace Opm
 {
 
@@ -76,6 +78,16 @@ public:
                              const unsigned cellIdx,
                              const unsigned timeIdx) = 0;
 
+    /// Compressed indices of the interior cells which receive source-term
+    /// contributions from this aquifer.  Used by the batched sparse
+    /// source-term assembly; aquifer types without cell source terms
+    /// return an empty range.
+    virtual const std::vector<int>& connectionCells() const
+    {
+        static const std::vector<int> empty{};
+        return empty;
+    }
+
     int aquiferID() const { return this->aquiferID_; }
 
 protected:
@@ -50,6 +50,8 @@ class BlackoilAquiferModel
 {
     using Simulator = GetPropType<TypeTag, Properties::Simulator>;
     using RateVector = GetPropType<TypeTag, Properties::RateVector>;
+    using GlobalEqVector = GetPropType<TypeTag, Properties::GlobalEqVector>;
+    using SparseMatrixAdapter = GetPropType<TypeTag, Properties::SparseMatrixAdapter>;
 
 
 public:
@@ -65,6 +67,14 @@ public:
     template <class Context>
     void addToSource(RateVector& rates, const Context& context, unsigned spaceIdx, unsigned timeIdx) const;
     void addToSource(RateVector& rates, unsigned globalSpaceIdx, unsigned timeIdx) const;
+
+    // Add the aquifer source terms directly to the residual and the
+    // diagonal Jacobian blocks of the connected cells.  Counterpart of
+    // BlackoilWellModel::addReservoirSourceTerms, used when the linearizer
+    // assembles sparse source terms separately from the element loop.
+    void addReservoirSourceTerms(GlobalEqVector& residual,
+                                 const std::vector<typename SparseMatrixAdapter::MatrixBlock*>& diagMatAddress) const;
+
     void endIteration();
     void endTimeStep();
     void endEpisode();
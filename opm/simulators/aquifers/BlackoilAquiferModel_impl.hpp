@@ -96,9 +96,47 @@ template <typename TypeTag>
 void
 BlackoilAquiferModel<TypeTag>::beginTimeStep()
 {
+    // Collect the analytic aquifers so that their previous connection
+    // pressures can be sampled in a single sweep over the grid below.
+    // Sweeping per aquifer updates the primary stencil of every element
+    // once per aquifer, which dominates the aquifer update cost when many
+    // analytic aquifers are present.
+    auto analytic = std::vector<AquiferAnalytical<TypeTag>*>{};
     for (auto& aquifer : this->aquifers) {
         aquifer->beginTimeStep();
+
+        if (auto* analyticAqu = dynamic_cast<AquiferAnalytical<TypeTag>*>(aquifer.get())) {
+            analytic.push_back(analyticAqu);
+        }
+    }
+
+    if (analytic.empty()) {
+        return;
+    }
+
+    ElementContext elemCtx(this->simulator_);
+    OPM_BEGIN_PARALLEL_TRY_CATCH();
+
+    for (const auto& elem : elements(this->simulator_.gridView())) {
+        elemCtx.updatePrimaryStencil(elem);
+
+        const int cellIdx = elemCtx.globalSpaceIndex(0, 0);
+        const auto connected =
+            std::ranges::any_of(analytic, [cellIdx](const auto* aquifer)
+                                { return aquifer->connectsToCell(cellIdx); });
+        if (! connected) {
+            continue;
+        }
+
+        elemCtx.updateIntensiveQuantities(0);
+        const auto& iq = elemCtx.intensiveQuantities(0, 0);
+        for (auto* aquifer : analytic) {
+            aquifer->capturePreviousPressure(cellIdx, iq);
+        }
     }
+
+    OPM_END_PARALLEL_TRY_CATCH("BlackoilAquiferModel::beginTimeStep() failed: ",
+                               this->simulator_.vanguard().grid().comm());
 }
 
 template <typename TypeTag>
@@ -125,6 +163,34 @@ BlackoilAquiferModel<TypeTag>::addToSource(RateVector& rates,
     }
 }
 
+template <typename TypeTag>
+void
+BlackoilAquiferModel<TypeTag>::
+addReservoirSourceTerms(GlobalEqVector& residual,
+                        const std::vector<typename SparseMatrixAdapter::MatrixBlock*>& diagMatAddress) const
+{
+    // NB this loop may write multiple times to the same element if a
+    // cell is connected to more than one aquifer, so it should not be
+    // OpenMP-parallelized.
+    for (const auto& aquifer : this->aquifers) {
+        for (const int cellIdx : aquifer->connectionCells()) {
+            RateVector rate(0.0);
+            aquifer->addToSource(rate, cellIdx, /*timeIdx=*/0);
+
+            // addToSource() computes rates per total cell volume, while the
+            // residual holds plain surface-volume rates.  This is the same
+            // scaling the dense source-term assembly applies.
+            rate *= -this->simulator_.model().dofTotalVolume(cellIdx);
+
+            typename GlobalEqVector::block_type res(0.0);
+            typename SparseMatrixAdapter::MatrixBlock bMat(0.0);
+            this->simulator_.model().linearizer().setResAndJacobi(res, bMat, rate);
+            residual[cellIdx] += res;
+            *diagMatAddress[cellIdx] += bMat;
+        }
+    }
+}
+
 template <typename TypeTag>
 void
 BlackoilAquiferModel<TypeTag>::endIteration()
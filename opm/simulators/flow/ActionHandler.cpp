@@ -32,6 +32,7 @@
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
 #include <opm/input/eclipse/Schedule/Action/Actions.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionX.hpp>
 #include <opm/input/eclipse/Schedule/Action/SimulatorUpdate.hpp>
@@ -53,6 +54,7 @@
 #include <ctime>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <fmt/chrono.h>
@@ -184,6 +186,42 @@ ActionHandler(EclipseState& ecl_state,
     , comm_(comm)
 {}
 
+template<typename Scalar, typename IndexTraits>
+typename ActionHandler<Scalar, IndexTraits>::ActionEvaluation
+ActionHandler<Scalar, IndexTraits>::
+evaluateActions(const int reportStep,
+                const double sim_time) const
+{
+    OPM_TIMEBLOCK(evaluateActions);
+
+    ActionEvaluation eval;
+
+    const auto& actions = schedule_[reportStep].actions();
+    if (actions.empty()) {
+        return eval;
+    }
+
+    eval.pendingPyActions = ! actions.pending_python(actionState_).empty();
+
+    const Action::Context context{ summaryState_, schedule_[reportStep].wlist_manager() };
+
+    const auto now = TimeStampUTC{ schedule_.getStartTime() } + std::chrono::duration<double>(sim_time);
+    const auto ts  = formatActionDate(now, reportStep);
+
+    for (const auto& action : actions.pending(this->actionState_, asTimeT(now))) {
+        auto actionResult = action->eval(context);
+        if (actionResult.conditionSatisfied()) {
+            eval.triggered.emplace_back(action, std::move(actionResult));
+        }
+        else {
+            ++eval.nonTriggered;
+            logInactiveAction(action->name(), ts);
+        }
+    }
+
+    return eval;
+}
+
 template<typename Scalar, typename IndexTraits>
 void ActionHandler<Scalar, IndexTraits>::
 applyActions(const int reportStep,
@@ -196,11 +234,20 @@ applyActions(const int reportStep,
         return;
     }
 
-    const Action::Context context{ summaryState_, schedule_[reportStep].wlist_manager() };
+    const auto eval = this->evaluateActions(reportStep, sim_time);
 
     const auto now = TimeStampUTC{ schedule_.getStartTime() } + std::chrono::duration<double>(sim_time);
     const auto ts  = formatActionDate(now, reportStep);
 
+    if (eval.nonTriggered > 0) {
+        logInactiveActions(eval.nonTriggered, ts);
+    }
+
+    // Common case: no action triggered.  Leave the schedule, the well
+    // model and the transmissibilities untouched.
+    if (eval.triggered.empty() && ! eval.pendingPyActions) {
+        return;
+    }
 
     SimulatorUpdate sim_update;
     for (const auto& pyaction : actions.pending_python(actionState_)) {
@@ -209,6 +256,11 @@ applyActions(const int reportStep,
         // affected by the PyAction, thus we get the production indices for all wells.
         const std::vector<std::string> wellpi_wells = schedule_[reportStep].well_order().names();
         const auto wellpi = fetchWellPI<Scalar>(this->wellModel_, wellpi_wells, this->comm_);
+
+        // The action may modify the schedule, so a pending background well
+        // prefetch must be joined first and its result thrown away.
+        this->wellModel_.discardPrefetchedLocalWells();
+
         auto sim_update_current = schedule_.runPyAction(reportStep, *pyaction, actionState_,
                                                 ecl_state_, summaryState_, wellpi);
 
@@ -225,16 +277,8 @@ applyActions(const int reportStep,
         sim_update.append(sim_update_current);
     }
 
-    auto non_triggered = 0;
     const auto simTime = asTimeT(now);
-    for (const auto& action : actions.pending(this->actionState_, simTime)) {
-        const auto actionResult = action->eval(context);
-        if (! actionResult.conditionSatisfied()) {
-            ++non_triggered;
-            logInactiveAction(action->name(), ts);
-            continue;
-        }
-
+    for (const auto& [action, actionResult] : eval.triggered) {
         const auto& matches = actionResult.matches();
 
         logActiveAction(action->name(), matches.wells(), ts);
@@ -245,6 +289,10 @@ applyActions(const int reportStep,
         const std::vector<std::string> wellpi_wells = action->wellpi_wells(schedule_.wellMatcher(reportStep), matches);
         const auto wellpi = fetchWellPI<Scalar>(this->wellModel_, wellpi_wells, this->comm_);
 
+        // The action modifies the schedule, so a pending background well
+        // prefetch must be joined first and its result thrown away.
+        this->wellModel_.discardPrefetchedLocalWells();
+
         const auto sim_update_current = this->schedule_
             .applyAction(reportStep, *action, matches, wellpi, true);
 
@@ -252,10 +300,6 @@ applyActions(const int reportStep,
         this->actionState_.add_run(*action, simTime, actionResult);
     }
 
-    if (non_triggered > 0) {
-        logInactiveActions(non_triggered, ts);
-    }
-
     bool commit_wellstate = false;
     this->applySimulatorUpdate(reportStep, sim_update, transUp, commit_wellstate);
     // The well state has been stored in a previous object when the time
@@ -297,12 +341,18 @@ void ActionHandler<Scalar, IndexTraits>::
 evalUDQAssignments(const unsigned episodeIdx,
                    UDQState& udq_state)
 {
-    this->schedule_[episodeIdx].udq()
-        .eval_assign(this->schedule_.wellMatcher(episodeIdx),
-                     this->schedule_[episodeIdx].group_order(),
-                     this->schedule_.segmentMatcherFactory(episodeIdx),
-                     this->summaryState_,
-                     udq_state);
+    // Skip the UDQ machinery, including the well matcher construction,
+    // when the run defines no UDQs.
+    const auto& udqConfig = this->schedule_[episodeIdx].udq();
+    if (udqConfig.size() == 0) {
+        return;
+    }
+
+    udqConfig.eval_assign(this->schedule_.wellMatcher(episodeIdx),
+                          this->schedule_[episodeIdx].group_order(),
+                          this->schedule_.segmentMatcherFactory(episodeIdx),
+                          this->summaryState_,
+                          udq_state);
 }
 
 template class ActionHandler<double, BlackOilDefaultFluidSystemIndices>;
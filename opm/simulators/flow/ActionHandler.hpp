@@ -29,9 +29,12 @@
 #include <functional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm::Action {
+    class ActionX;
+    class Result;
     class State;
 } // namespace Opm::Action
 
@@ -77,8 +80,43 @@ public:
                   BlackoilWellModelGeneric<Scalar, IndexTraits>& wellModel,
                   Parallel::Communication comm);
 
+    /// Outcome of evaluating the conditions of all pending actions.
+    ///
+    /// Produced by evaluateActions() and consumed by applyActions().
+    struct ActionEvaluation
+    {
+        /// Triggered actions along with their match sets.
+        std::vector<std::pair<const Action::ActionX*, Action::Result>> triggered;
+
+        /// Number of pending actions whose condition was not satisfied.
+        int nonTriggered = 0;
+
+        /// Whether any Python actions are pending.  Python actions cannot
+        /// be pre-evaluated since running them may mutate the schedule.
+        bool pendingPyActions = false;
+    };
+
+    /// Evaluate the conditions of all pending actions.
+    ///
+    /// Read-only with respect to the simulator state; only inspects the
+    /// summary and action state objects.  In particular this part of the
+    /// action processing does not need to run on the critical path as
+    /// long as the results are applied before the next time step begins.
+    ///
+    /// \param[in] reportStep Zero-based report step index.
+    ///
+    /// \param[in] sim_time Elapsed time since simulation start.
+    ///
+    /// \return Triggered actions and their match sets.
+    ActionEvaluation evaluateActions(int reportStep,
+                                     double sim_time) const;
+
     /// Run all pending actions.
     ///
+    /// Evaluates all pending action conditions and applies the triggered
+    /// actions.  When no action triggers and no Python actions are
+    /// pending, the schedule and the well model are left untouched.
+    ///
     /// \param[in] reportStep Zero-based report step index.
     ///
     /// \param[in] sim_time Elapsed time since simulation start.
@@ -25,6 +25,8 @@
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 
+#include <opm/models/parallel/threadmanager.hpp>
+
 #include <opm/simulators/timestepping/SimulatorReport.hpp>
 
 #include <fmt/format.h>
@@ -86,7 +88,12 @@ void printPRTHeader(const int nprocs, const int nthreads,
        ss << "User             =  " << user << std::endl;
     }
     ss << "Simulation started on " << tmstr << " hrs\n";
-    ss << "Using "<< nprocs << " MPI processes with "<< nthreads <<" OMP threads on each \n";
+    ss << "Using "<< nprocs << " MPI processes with "<< nthreads <<" OMP threads on each";
+    if (nthreads > 1) {
+        ss << (ThreadManager::threadsBound() ? " (threads bound to processors)"
+                                             : " (thread binding disabled)");
+    }
+    ss << " \n";
     ss << "Parameters used by Flow:\n" << parameters;
 
     OpmLog::note(ss.str());
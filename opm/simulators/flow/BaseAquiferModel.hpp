@@ -114,6 +114,18 @@ public:
                      unsigned) const
     { }
 
+    /*!
+     * \brief Add the aquifer source terms directly to the residual and the
+     *        diagonal Jacobian blocks of the connected cells.
+     *
+     * Used when the linearizer assembles sparse source terms separately
+     * from the element loop.
+     */
+    template <class GlobalEqVector, class MatrixBlockPtrVector>
+    void addReservoirSourceTerms(GlobalEqVector&,
+                                 const MatrixBlockPtrVector&) const
+    { }
+
 
     /*!
      * \brief This method is called after each Newton-Raphson successful iteration.
@@ -27,6 +27,7 @@
 #include <opm/simulators/aquifers/BlackoilAquiferModel.hpp>
 
 #include <opm/simulators/flow/BlackoilModelConvergenceMonitor.hpp>
+#include <opm/simulators/flow/BlackoilModelTolerancePolicy.hpp>
 #include <opm/simulators/flow/BlackoilModelNldd.hpp>
 #include <opm/simulators/flow/BlackoilModelProperties.hpp>
 #include <opm/simulators/flow/FlowProblemBlackoilProperties.hpp>
@@ -42,6 +43,7 @@
 
 #include <opm/simulators/wells/BlackoilWellModel.hpp>
 
+#include <limits>
 #include <memory>
 #include <tuple>
 #include <vector>
@@ -144,6 +146,8 @@ public:
                   BlackoilWellModel<TypeTag>& well_model,
                   const bool terminal_output);
 
+    ~BlackoilModel();
+
     bool isParallel() const
     { return grid_.comm().size() > 1; }
 
@@ -159,6 +163,12 @@ public:
                               const int maxIter,
                               const SimulatorTimerInterface& timer);
 
+    /// After a failed time step, blend the restored step-start state with
+    /// the last Newton iterate of the failed attempt, weighted by the
+    /// fraction of the failed step the chopped step covers.
+    /// \param[in] new_dt  length of the chopped time step
+    void applyTimeStepChopWarmStart(const double new_dt);
+
     /// Called once per nonlinear iteration.
     /// This model will perform a Newton-Raphson update, changing reservoir_state
     /// and well_state. It will also use the nonlinear_solver to do relaxation of
@@ -221,6 +231,15 @@ public:
                          std::vector<Scalar>& B_avg,
                          std::vector<int>& maxCoeffCell);
 
+    /// \brief Residual-only variant of localConvergenceData() that reuses
+    /// the cell lists, pore-volume sums and B averages cached by the most
+    /// recent full sweep of the time step.
+    std::pair<Scalar,Scalar>
+    residualOnlyConvergenceData(std::vector<Scalar>& R_sum,
+                                std::vector<Scalar>& maxCoeff,
+                                std::vector<Scalar>& B_avg,
+                                std::vector<int>& maxCoeffCell) const;
+
     /// \brief Compute pore-volume/cell count split among "converged",
     /// "relaxed converged", "unconverged" cells based on CNV point
     /// measures. Also returns list of cells where CNV is greater than
@@ -287,6 +306,9 @@ public:
     /// Write the number of nonlinear iterations per cell to a file in ResInsight compatible format
     void writeNonlinearIterationsPerCell(const std::filesystem::path& odir) const;
 
+    /// Write the accumulated per-domain cost breakdown to a CSV file per rank
+    void writeDomainCostBreakdown(const std::filesystem::path& odir) const;
+
     const std::vector<StepReport>& stepReports() const
     { return convergence_reports_; }
 
@@ -366,20 +388,62 @@ protected:
     Scalar current_relaxation_;
     BVector dx_old_;
 
+    /// \brief Initial guess for the linear solver when warm starts are
+    /// enabled; holds the Newton update of the previous iteration.
+    BVector warm_start_x_;
+
     SolutionVector solUpd_;
 
+    /// \brief Last Newton iterate of the current time step attempt; used to
+    /// warm start the retry after a chop when enabled.
+    SolutionVector chop_warm_start_iterate_;
+    double chop_warm_start_dt_ = 0.0;
+    bool chop_warm_start_valid_ = false;
+
     std::vector<StepReport> convergence_reports_;
     ComponentName compNames_{};
 
     std::unique_ptr<BlackoilModelNldd<TypeTag>> nlddSolver_; //!< Non-linear DD solver
     BlackoilModelConvergenceMonitor<Scalar> conv_monitor_;
+    BlackoilModelTolerancePolicy<Scalar> tolerance_policy_;
+
+    //! Handle for the solver hierarchy cache in the memory budget registry.
+    std::size_t memory_budget_handle_ = 0;
 
 private:
     Scalar dpMaxRel() const { return param_.dp_max_rel_; }
     Scalar dsMax() const { return param_.ds_max_; }
     Scalar drMaxRel() const { return param_.dr_max_rel_; }
     Scalar maxResidualAllowed() const { return param_.max_residual_allowed_; }
+
+    /// \brief Whether to re-run the linear solver speed test at this solve.
+    ///
+    /// Retests at the fixed interval and, when degradation-triggered
+    /// switching is enabled, as soon as the recent solve times have
+    /// degraded relative to the best time since the last test.  The
+    /// decision is made on rank 0 and broadcast for consistency.
+    bool shouldRetestLinearSolvers(int solveCount);
+
     double linear_solve_setup_time_;
+
+    /// Solve-time statistics driving degradation-triggered linear solver
+    /// retests; only maintained when several solvers are configured.
+    double linear_solve_best_time_{std::numeric_limits<double>::max()};
+    double linear_solve_recent_time_{0.0};
+    int linear_solves_since_test_{0};
+
+    /// Per-time-step cache for the convergence sweeps; only maintained
+    /// when --cache-convergence-sweep is enabled.  Cell indices of the
+    /// interior partition (numerical-aquifer cells kept separately), the
+    /// local pore-volume sums and the per-equation B averages of the full
+    /// sweep at the first Newton iteration.
+    bool conv_cache_valid_{false};
+    std::vector<int> conv_cells_;
+    std::vector<int> conv_aquifer_cells_;
+    Scalar conv_pv_sum_local_{0};
+    Scalar conv_aquifer_pv_sum_local_{0};
+    std::vector<Scalar> conv_B_avg_;
+
     std::vector<bool> wasSwitched_;
 };
 
@@ -35,12 +35,14 @@ BlackoilModelConvergenceMonitor(const MonitorParams& param)
     : param_(param)
     , prev_distance_(std::numeric_limits<double>::infinity())
     , prev_above_tolerance_(0)
+    , avg_contraction_(0.0)
+    , doomed_count_(0)
 {
 }
 
 template<class Scalar>
 void BlackoilModelConvergenceMonitor<Scalar>::
-checkPenaltyCard(ConvergenceReport& report, int iteration)
+checkPenaltyCard(ConvergenceReport& report, int iteration, int maxIter)
 {
     const auto& current_metrics = report.reservoirConvergence();
     auto distances = std::vector<double>(current_metrics.size(), 0.0);
@@ -67,6 +69,36 @@ checkPenaltyCard(ConvergenceReport& report, int iteration)
         if (current_distance > param_.decay_factor_ * prev_distance_) {
             report.addDistanceDecayPenalty();
         }
+
+        // Smoothed contraction per iteration of the log10 distance to
+        // tolerance; this is what one iteration is expected to gain.
+        const double contraction = prev_distance_ - current_distance;
+        avg_contraction_ = (iteration == 1)
+            ? contraction
+            : 0.5 * (avg_contraction_ + contraction);
+    }
+
+    if (param_.prediction_enabled_ && !report.converged() &&
+        iteration >= param_.prediction_warmup_)
+    {
+        // Project the remaining iterations from the smoothed contraction
+        // rate. A non-positive rate means the residuals are stagnating or
+        // growing, so the projection is unbounded.
+        const double remaining_budget =
+            param_.prediction_slack_ * (maxIter - iteration);
+        const bool doomed = (avg_contraction_ <= 0.0) ||
+            (current_distance > avg_contraction_ * remaining_budget);
+
+        // Require two consecutive doomed projections before aborting, so a
+        // single slow iteration (e.g. a well switching control) does not
+        // chop a step that would still converge.
+        doomed_count_ = doomed ? doomed_count_ + 1 : 0;
+        if (doomed_count_ >= 2) {
+            report.setReservoirFailed(
+                {ConvergenceReport::ReservoirFailure::Type::ConvergenceMonitorFailure,
+                 ConvergenceReport::Severity::ConvergenceMonitorFailure,
+                 -1});
+        }
     }
 
     prev_distance_ = current_distance;
@@ -93,6 +125,8 @@ reset()
     total_penaltyCard_.reset();
     prev_above_tolerance_ = 0;
     prev_distance_ = std::numeric_limits<double>::infinity();
+    avg_contraction_ = 0.0;
+    doomed_count_ = 0;
 }
 
 template class BlackoilModelConvergenceMonitor<double>;
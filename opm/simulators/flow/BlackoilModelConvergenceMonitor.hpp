@@ -37,7 +37,7 @@ public:
     using MonitorParams = typename BlackoilModelParameters<Scalar>::ConvergenceMonitorParams;
     explicit BlackoilModelConvergenceMonitor(const MonitorParams& param);
 
-    void checkPenaltyCard(ConvergenceReport& report, int iteration);
+    void checkPenaltyCard(ConvergenceReport& report, int iteration, int maxIter);
 
     void reset();
 
@@ -46,6 +46,8 @@ private:
     ConvergenceReport::PenaltyCard total_penaltyCard_;
     double prev_distance_;
     int prev_above_tolerance_;
+    double avg_contraction_;
+    int doomed_count_;
 };
 
 } // namespace Opm
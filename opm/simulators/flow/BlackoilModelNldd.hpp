@@ -24,11 +24,16 @@
 #ifndef OPM_BLACKOILMODEL_NLDD_HEADER_INCLUDED
 #define OPM_BLACKOILMODEL_NLDD_HEADER_INCLUDED
 
+#include <dune/common/fvector.hh>
 #include <dune/common/timer.hh>
+#include <dune/istl/bvector.hh>
 #include <dune/istl/istlexception.hh>
 
 #include <opm/common/Exceptions.hpp>
 
+#include <opm/input/eclipse/Schedule/Events.hpp>
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+
 #include <opm/grid/common/SubGridPart.hpp>
 
 #include <opm/simulators/aquifers/AquiferGridUtils.hpp>
@@ -55,6 +60,7 @@
 
 #include <opm/simulators/utils/ComponentName.hpp>
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
+#include <opm/simulators/utils/MemoryBudget.hpp>
 
 #include <opm/simulators/wells/BlackoilWellModelNldd.hpp>
 
@@ -68,6 +74,7 @@
 #include <filesystem>
 #include <memory>
 #include <numeric>
+#include <queue>
 #include <set>
 #include <sstream>
 #include <string>
@@ -108,12 +115,64 @@ public:
         , wellModel_(model.wellModel())
         , rank_(model_.simulator().vanguard().grid().comm().rank())
     {
+        // Set nldd handler in main well model
+        model.wellModel().setNlddAdapter(&wellModel_);
+
         // Create partitions.
-        const auto& [partition_vector_initial, num_domains_initial] = this->partitionCells();
+        const auto& [partition_vector, num_domains] = this->partitionCells({});
+        this->setupDomains(partition_vector, num_domains);
+
+        // Subdomain matrices and solver hierarchies are rebuilt lazily by
+        // solveDomain(), so they can be dropped when memory gets tight.
+        memory_budget_handle_ = MemoryBudget::instance().registerCache(
+            "NLDD subdomain systems", /*priority=*/1,
+            [this]()
+            {
+                std::size_t bytes = 0;
+                for (const auto& mat : domain_matrices_) {
+                    if (mat) {
+                        bytes += mat->nonzeroes() * sizeof(typename Mat::block_type);
+                    }
+                }
+                for (const auto& linsolver : domain_linsolvers_) {
+                    bytes += linsolver.solverHierarchyBytes();
+                }
+                return bytes;
+            },
+            [this]()
+            {
+                for (auto& mat : domain_matrices_) {
+                    mat.reset();
+                }
+                for (auto& linsolver : domain_linsolvers_) {
+                    linsolver.releaseSolverHierarchy();
+                }
+            });
+    }
+
+    ~BlackoilModelNldd()
+    {
+        MemoryBudget::instance().unregisterCache(memory_budget_handle_);
+    }
 
+    //! \brief Build the subdomains and their supporting structures from a
+    //! partition vector.
+    //!
+    //! Called from the constructor and again whenever the domains are
+    //! repartitioned; any existing per-domain state is discarded.
+    void setupDomains(const std::vector<int>& partition_vector_initial,
+                      const int num_domains_initial)
+    {
         int num_domains = num_domains_initial;
         std::vector<int> partition_vector = partition_vector_initial;
 
+        this->domains_.clear();
+        this->domain_matrices_.clear();
+        this->domain_rhs_.clear();
+        this->domain_x_.clear();
+        this->domain_linsolvers_.clear();
+        this->domain_reports_accumulated_.clear();
+
         // Fix-up for an extreme case: Interior cells who do not have any on-rank
         // neighbours. Move all such cells into a single domain on this rank,
         // and mark the domain for skipping. For what it's worth, we've seen this
@@ -129,9 +188,6 @@ public:
             num_domains++;
         }
 
-        // Set nldd handler in main well model
-        model.wellModel().setNlddAdapter(&wellModel_);
-
         // Scan through partitioning to get correct size for each.
         std::vector<int> sizes(num_domains, 0);
         for (const auto& p : partition_vector) {
@@ -182,6 +238,36 @@ public:
                                         skip);
         }
 
+        // Record which domains share a grid face. The dynamic residual
+        // ordering promotes the neighbors of a just-solved domain, so that
+        // its update can propagate onwards within the same sweep.
+        domain_neighbors_.assign(num_domains, std::vector<int>{});
+        if (model_.param().local_domains_ordering_ == DomainOrderingMeasure::DynamicResidual) {
+            const auto& elemMapper = model_.simulator().model().elementMapper();
+            int cellIdx = 0;
+            for (auto it = beg; it != end; ++it, ++cellIdx) {
+                const int p = partition_vector[cellIdx];
+                for (const auto& intersection : intersections(gridView, *it)) {
+                    if (!intersection.neighbor()) {
+                        continue;
+                    }
+                    const auto nbIdx = static_cast<std::size_t>(elemMapper.index(intersection.outside()));
+                    if (nbIdx >= partition_vector.size()) {
+                        // Overlap cell owned by another rank; domains are per rank.
+                        continue;
+                    }
+                    const int q = partition_vector[nbIdx];
+                    if (q != p) {
+                        domain_neighbors_[p].push_back(q);
+                    }
+                }
+            }
+            for (auto& neighbors : domain_neighbors_) {
+                std::sort(neighbors.begin(), neighbors.end());
+                neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+            }
+        }
+
         // Initialize storage for previous mobilities in a single flat vector
         const auto numCells = grid.size(0);
         previousMobilities_.resize(numCells * FluidSystem::numActivePhases(), 0.0);
@@ -190,11 +276,24 @@ public:
         }
 
         // Initialize domain_needs_solving_ to true for all domains
-        domain_needs_solving_.resize(num_domains, true);
+        domain_needs_solving_.assign(num_domains, true);
+
+        // Reset the per-domain work recorded for dynamic repartitioning.
+        domain_work_.assign(num_domains, 0.0);
+
+        // Reset the quiescent-domain tracking.
+        domain_quiescent_count_.assign(num_domains, 0);
+        domain_skip_remaining_.assign(num_domains, 0);
 
         // Set up container for the local system matrices.
         domain_matrices_.resize(num_domains);
 
+        // Set up containers for the local right-hand sides and solutions.
+        // These are kept across domain visits so that each visit only
+        // refreshes their values instead of allocating fresh vectors.
+        domain_rhs_.resize(num_domains);
+        domain_x_.resize(num_domains);
+
         // Set up container for the local linear solvers.
         for (int index = 0; index < num_domains; ++index) {
             // TODO: The ISTLSolver constructor will make
@@ -231,8 +330,105 @@ public:
     //! \brief Called before starting a time step.
     void prepareStep()
     {
+        maybeRepartitionDomains();
+
         // Setup domain->well mapping.
         wellModel_.setupDomains(domains_);
+
+        detectWellEventDomains();
+    }
+
+    //! \brief Collect the subdomains holding wells with structural schedule
+    //! events at the start of a report step.
+    //!
+    //! After a workover -- new completions, newly drilled or reopened
+    //! wells -- the solution transient is confined to the near-well region,
+    //! but it can still force repeated global time step cuts. The affected
+    //! subdomains are given extra local passes ahead of the first regular
+    //! NLDD sweep, so the global Newton starts from a locally equilibrated
+    //! state.
+    void detectWellEventDomains()
+    {
+        event_resolve_domains_.clear();
+        pending_event_resolve_ = false;
+        if (model_.param().nldd_well_event_resolve_passes_ <= 0) {
+            return;
+        }
+
+        // Only trigger on the first time step of a report step; retries
+        // after a time step cut keep the same episode index and do not
+        // re-trigger.
+        const int episode = model_.simulator().episodeIndex();
+        if (episode < 0 || episode == last_event_episode_) {
+            return;
+        }
+        last_event_episode_ = episode;
+
+        constexpr auto event_mask = ScheduleEvents::NEW_WELL
+            + ScheduleEvents::COMPLETION_CHANGE
+            + ScheduleEvents::WELL_STATUS_CHANGE;
+        const auto& events =
+            model_.simulator().vanguard().schedule()[episode].wellgroup_events();
+        std::set<int> affected;
+        for (const auto& [wname, domain] : wellModel_.well_domain()) {
+            if (events.hasEvent(wname, event_mask)) {
+                affected.insert(domain);
+            }
+        }
+        event_resolve_domains_.assign(affected.begin(), affected.end());
+
+        // The resolve contains collective operations, so all ranks must
+        // agree on whether it runs, even those without affected wells.
+        const auto& comm = model_.simulator().vanguard().grid().comm();
+        pending_event_resolve_ =
+            comm.max(static_cast<int>(!event_resolve_domains_.empty())) > 0;
+    }
+
+    //! \brief Repartition the subdomains when the measured nonlinear work
+    //! has become too imbalanced across the MPI ranks.
+    //!
+    //! The Newton and linear iterations recorded for the local solves since
+    //! the last (re)partitioning are fed back to the partitioner as cell
+    //! weights, so that regions which have become expensive -- e.g. around
+    //! an advancing flood front -- end up in smaller domains.
+    void maybeRepartitionDomains()
+    {
+        const Scalar imbalance_tol = model_.param().nldd_dynamic_repartition_imbalance_;
+        if (imbalance_tol <= 1.0) {
+            return;
+        }
+
+        // The decision must be collective; measure the imbalance as the
+        // ratio between the most loaded rank and the mean.
+        const auto& comm = model_.simulator().vanguard().grid().comm();
+        const double rank_work =
+            std::accumulate(domain_work_.begin(), domain_work_.end(), 0.0);
+        const double max_work = comm.max(rank_work);
+        const double avg_work = comm.sum(rank_work) / comm.size();
+        if (!(avg_work > 0.0) || max_work <= imbalance_tol * avg_work) {
+            return;
+        }
+
+        // Per-cell weight is the average work of the cell's current domain,
+        // offset by one so that cheap regions retain a nonzero weight.
+        const auto num_interior = detail::countLocalInteriorCellsGridView(
+            model_.simulator().vanguard().grid().leafGridView());
+        std::vector<double> cell_weights(num_interior, 1.0);
+        for (const auto& domain : domains_) {
+            const double weight = 1.0 + domain_work_[domain.index] / domain.cells.size();
+            for (const int cell : domain.cells) {
+                cell_weights[cell] = weight;
+            }
+        }
+
+        const auto& [partition_vector, num_domains] = this->partitionCells(cell_weights);
+        this->setupDomains(partition_vector, num_domains);
+
+        if (rank_ == 0) {
+            OpmLog::info(fmt::format("NLDD: measured work imbalance {:.2f} exceeded {:.2f}, "
+                                     "repartitioned into {} local domains.",
+                                     max_work / avg_work, imbalance_tol, domains_.size()));
+        }
     }
 
     //! \brief Do one non-linear NLDD iteration.
@@ -273,31 +469,106 @@ public:
         auto initial_solution = solution;
         auto locally_solved = initial_solution;
 
+        // -----------   Event-triggered near-well resolve   -----------
+        // On the first NLDD iteration after a workover, give the affected
+        // subdomains extra local passes before the regular sweep.
+        if (pending_event_resolve_) {
+            pending_event_resolve_ = false;
+            resolveWellEventDomains(solution, locally_solved, timer);
+        }
+
         // -----------   Decide on an ordering for the domains   -----------
-        const auto domain_order = this->getSubdomainOrder();
+        // With the dynamic residual ordering the sweep is scheduled through
+        // a priority queue instead of a precomputed order, so only the
+        // measures are needed up front.
+        const bool dynamic_order =
+            model_.param().local_solve_approach_ == DomainSolveApproach::GaussSeidel
+            && model_.param().local_domains_ordering_ == DomainOrderingMeasure::DynamicResidual;
+        auto domain_measure = dynamic_order
+            ? this->computeDomainMeasures() : std::vector<Scalar>{};
+        const auto domain_order = dynamic_order
+            ? std::vector<int>{} : this->getSubdomainOrder();
         local_reports_accumulated_.success.pre_post_time += detailTimer.stop();
 
+        // -----------   Screen the domains for work   -----------
+        // The mobility-change screening only touches the cells of its own
+        // domain, so the domains are screened thread parallel.  Dynamic
+        // scheduling lets idle threads pick up the remaining domains, which
+        // evens out the load when domain sizes differ; using more domains
+        // than threads (--num-local-domains) improves the balance further.
+        // The solves themselves share the global linearizer and well model
+        // and must remain sequential within a rank.
+        {
+            detailTimer.reset();
+            detailTimer.start();
+            const int num_domains = static_cast<int>(domains_.size());
+            std::vector<int> needs_solving(num_domains, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int i = 0; i < num_domains; ++i) {
+                needs_solving[i] = checkIfSubdomainNeedsSolving(domains_[i]);
+                updateMobilities(domains_[i]);
+            }
+            for (int i = 0; i < num_domains; ++i) {
+                domain_needs_solving_[i] = static_cast<bool>(needs_solving[i]);
+            }
+            local_reports_accumulated_.success.pre_post_time += detailTimer.stop();
+        }
+
         // -----------   Solve each domain separately   -----------
         DeferredLogger logger;
         std::vector<SimulatorReportSingle> domain_reports(domains_.size());
 
         OPM_BEGIN_PARALLEL_TRY_CATCH()
-        for (const int domain_index : domain_order) {
+        // Returns whether the domain did local work, i.e. was neither
+        // skipped nor converged already.
+        auto solveSingleDomain = [&](const int domain_index) -> bool {
             const auto& domain = domains_[domain_index];
             SimulatorReportSingle local_report;
             detailTimer.reset();
             detailTimer.start();
 
-            domain_needs_solving_[domain_index] = checkIfSubdomainNeedsSolving(domain);
-
-            updateMobilities(domain);
-
             if (domain.skip || !domain_needs_solving_[domain_index]) {
                 local_report.skipped_domains = true;
                 local_report.converged = true;
                 domain_reports[domain.index] = local_report;
-                continue;
+                return false;
+            }
+
+            const int max_quiescent_skip = model_.param().nldd_quiescent_domain_max_skip_;
+            if (max_quiescent_skip > 0) {
+                // Quiescent domains -- repeatedly converged without local
+                // work -- are skipped for a number of passes that doubles
+                // with each converged check, up to the cap.
+                if (domain_skip_remaining_[domain_index] > 0) {
+                    --domain_skip_remaining_[domain_index];
+                    local_report.skipped_domains = true;
+                    local_report.converged = true;
+                    domain_reports[domain.index] = local_report;
+                    return false;
+                }
+
+                // Cheap pre-check on the residual of the current
+                // linearization.  The rows of this domain are unchanged
+                // since the last global assembly, so this matches the check
+                // a local solve would start with, without the per-domain
+                // assembly.
+                std::vector<Scalar> resnorms;
+                const auto convrep = this->getDomainConvergence(domain, timer, logger, resnorms);
+                if (convrep.converged()) {
+                    ++domain_quiescent_count_[domain_index];
+                    domain_skip_remaining_[domain_index] =
+                        std::min(1 << std::min(domain_quiescent_count_[domain_index] - 1, 16),
+                                 max_quiescent_skip);
+                    local_report.converged = true;
+                    local_report.update_time += detailTimer.stop();
+                    domain_reports[domain.index] = local_report;
+                    return false;
+                }
+                domain_quiescent_count_[domain_index] = 0;
             }
+
             switch (model_.param().local_solve_approach_) {
             case DomainSolveApproach::Jacobi:
                 solveDomainJacobi(solution, locally_solved, local_report, logger,
@@ -318,6 +589,43 @@ public:
             }
             local_report.solver_time += detailTimer.stop();
             domain_reports[domain.index] = local_report;
+            return local_report.total_newton_iterations > 0;
+        };
+
+        if (dynamic_order) {
+            // Schedule the sweep through a max-heap keyed by the residual
+            // measure, so the most nonlinear domain solves first.  Whenever
+            // a domain did local work its update changed the boundary values
+            // of its neighbors, so promote the unsolved ones to at least the
+            // solved domain's key; recomputing their true residual would
+            // require a fresh linearization.  Promotions only raise keys, so
+            // queue entries whose key no longer matches are stale and are
+            // dropped when popped.
+            std::priority_queue<std::pair<Scalar, int>> queue;
+            for (const auto& domain : domains_) {
+                queue.emplace(domain_measure[domain.index], domain.index);
+            }
+            std::vector<bool> solved(domains_.size(), false);
+            while (!queue.empty()) {
+                const auto [measure, domain_index] = queue.top();
+                queue.pop();
+                if (solved[domain_index] || measure != domain_measure[domain_index]) {
+                    continue;
+                }
+                solved[domain_index] = true;
+                if (solveSingleDomain(domain_index)) {
+                    for (const int neighbor : domain_neighbors_[domain_index]) {
+                        if (!solved[neighbor] && domain_measure[neighbor] < measure) {
+                            domain_measure[neighbor] = measure;
+                            queue.emplace(measure, neighbor);
+                        }
+                    }
+                }
+            }
+        } else {
+            for (const int domain_index : domain_order) {
+                solveSingleDomain(domain_index);
+            }
         }
         OPM_END_PARALLEL_TRY_CATCH("Unexpected exception in local domain solve: ", model_.simulator().vanguard().grid().comm());
 
@@ -357,6 +665,8 @@ public:
                     ++num_skipped;
                 }
                 step_newtons += dr.total_newton_iterations;
+                // Record work done in this domain for dynamic repartitioning
+                domain_work_[i] += dr.total_newton_iterations + dr.total_linear_iterations;
                 // Accumulate local reports per domain
                 domain_reports_accumulated_[i] += dr;
                 // Accumulate local reports per rank
@@ -382,18 +692,26 @@ public:
         if (comm.size() > 1) {
             const auto* ccomm = model_.simulator().model().newtonMethod().linearSolver().comm();
 
-            // Copy numerical values from primary vars.
-            ccomm->copyOwnerToAll(solution, solution);
-
-            // Copy flags from primary vars.
+            // Copy numerical values and flags from primary vars in a
+            // single exchange.  The packed meanings fit in 20 bits and
+            // are therefore exactly representable as a Scalar, so they
+            // ride along as an extra vector component instead of paying
+            // the latency of a second exchange.
             const std::size_t num = solution.size();
-            Dune::BlockVector<std::size_t> allmeanings(num);
+            Dune::BlockVector<Dune::FieldVector<Scalar, numEq + 1>> combined(num);
             for (std::size_t ii = 0; ii < num; ++ii) {
-                allmeanings[ii] = PVUtil::pack(solution[ii]);
+                for (int eq = 0; eq < numEq; ++eq) {
+                    combined[ii][eq] = solution[ii][eq];
+                }
+                combined[ii][numEq] = static_cast<Scalar>(PVUtil::pack(solution[ii]));
             }
-            ccomm->copyOwnerToAll(allmeanings, allmeanings);
+            ccomm->copyOwnerToAll(combined, combined);
             for (std::size_t ii = 0; ii < num; ++ii) {
-                PVUtil::unPack(solution[ii], allmeanings[ii]);
+                for (int eq = 0; eq < numEq; ++eq) {
+                    solution[ii][eq] = combined[ii][eq];
+                }
+                PVUtil::unPack(solution[ii],
+                               static_cast<std::size_t>(combined[ii][numEq]));
             }
 
             // Update intensive quantities for our overlap values.
@@ -412,6 +730,8 @@ public:
         auto total_local_solve_time = localSolveTimer.stop();
         report.local_solve_time += total_local_solve_time;
         local_reports_accumulated_.success.total_time += total_local_solve_time;
+        // Each NLDD iteration performs one convergence sweep over the domains.
+        ++local_reports_accumulated_.success.convergence_sweeps;
         local_reports_accumulated_.success.pre_post_time += detailTimer.stop();
 
         // Finish with a global Newton step.
@@ -478,6 +798,18 @@ public:
             cartMapper);
     }
 
+    /// Write the accumulated per-domain cost breakdown to a CSV file per rank
+    void writeDomainCostBreakdown(const std::filesystem::path& odir) const
+    {
+        const auto& grid = this->model_.simulator().vanguard().grid();
+
+        ::Opm::writeDomainCostBreakdown(
+            odir,
+            domains_,
+            domain_reports_accumulated_,
+            grid.comm());
+    }
+
 private:
     //! \brief Solve the equation system for a single domain.
     ConvergenceReport
@@ -665,9 +997,11 @@ private:
             domain_matrices_[domain.index] = std::make_unique<Mat>(Details::extractMatrix(main_matrix, domain.cells));
         }
         auto& jac = *domain_matrices_[domain.index];
-        auto res = Details::extractVector(modelSimulator.model().linearizer().residual(),
-                                          domain.cells);
-        auto x = res;
+        auto& res = domain_rhs_[domain.index];
+        Details::extractVector(modelSimulator.model().linearizer().residual(),
+                               domain.cells, res);
+        auto& x = domain_x_[domain.index];
+        x.resize(domain.cells.size());
 
         // set initial guess
         global_x = 0.0;
@@ -923,12 +1257,59 @@ private:
         return report;
     }
 
-    //! \brief Returns subdomain ordered according to method and ordering measure.
-    std::vector<int> getSubdomainOrder()
+    //! \brief Returns the per-domain value of the configured ordering measure.
+    std::vector<Scalar> computeDomainMeasures()
     {
         const auto& modelSimulator = model_.simulator();
         const auto& solution = modelSimulator.model().solution(0);
 
+        std::vector<Scalar> measure_per_domain(domains_.size());
+        switch (model_.param().local_domains_ordering_) {
+        case DomainOrderingMeasure::AveragePressure: {
+            // Use average pressures to order domains.
+            for (const auto& domain : domains_) {
+                const Scalar press_sum =
+                    std::accumulate(domain.cells.begin(), domain.cells.end(), Scalar{0},
+                                    [&solution](const auto acc, const auto c)
+                                    { return acc + solution[c][Indices::pressureSwitchIdx]; });
+                const Scalar avgpress = press_sum / domain.cells.size();
+                measure_per_domain[domain.index] = avgpress;
+            }
+            break;
+        }
+        case DomainOrderingMeasure::MaxPressure: {
+            // Use max pressures to order domains.
+            for (const auto& domain : domains_) {
+                measure_per_domain[domain.index] =
+                    std::accumulate(domain.cells.begin(), domain.cells.end(), Scalar{0},
+                                    [&solution](const auto acc, const auto c)
+                                    { return std::max(acc, solution[c][Indices::pressureSwitchIdx]); });
+            }
+            break;
+        }
+        case DomainOrderingMeasure::Residual:
+        case DomainOrderingMeasure::DynamicResidual: {
+            // Use maximum residual to order domains.
+            const auto& residual = modelSimulator.model().linearizer().residual();
+            const int num_vars = residual[0].size();
+            for (const auto& domain : domains_) {
+                Scalar maxres = 0.0;
+                for (const int c : domain.cells) {
+                    for (int ii = 0; ii < num_vars; ++ii) {
+                        maxres = std::max(maxres, std::fabs(residual[c][ii]));
+                    }
+                }
+                measure_per_domain[domain.index] = maxres;
+            }
+            break;
+        }
+        } // end of switch (model_.param().local_domains_ordering_)
+        return measure_per_domain;
+    }
+
+    //! \brief Returns subdomain ordered according to method and ordering measure.
+    std::vector<int> getSubdomainOrder()
+    {
         std::vector<int> domain_order(domains_.size());
         std::iota(domain_order.begin(), domain_order.end(), 0);
 
@@ -937,46 +1318,7 @@ private:
             return domain_order;
         } else if (model_.param().local_solve_approach_ == DomainSolveApproach::GaussSeidel) {
             // Calculate the measure used to order the domains.
-            std::vector<Scalar> measure_per_domain(domains_.size());
-            switch (model_.param().local_domains_ordering_) {
-            case DomainOrderingMeasure::AveragePressure: {
-                // Use average pressures to order domains.
-                for (const auto& domain : domains_) {
-                    const Scalar press_sum =
-                        std::accumulate(domain.cells.begin(), domain.cells.end(), Scalar{0},
-                                        [&solution](const auto acc, const auto c)
-                                        { return acc + solution[c][Indices::pressureSwitchIdx]; });
-                    const Scalar avgpress = press_sum / domain.cells.size();
-                    measure_per_domain[domain.index] = avgpress;
-                }
-                break;
-            }
-            case DomainOrderingMeasure::MaxPressure: {
-                // Use max pressures to order domains.
-                for (const auto& domain : domains_) {
-                    measure_per_domain[domain.index] =
-                        std::accumulate(domain.cells.begin(), domain.cells.end(), Scalar{0},
-                                        [&solution](const auto acc, const auto c)
-                                        { return std::max(acc, solution[c][Indices::pressureSwitchIdx]); });
-                }
-                break;
-            }
-            case DomainOrderingMeasure::Residual: {
-                // Use maximum residual to order domains.
-                const auto& residual = modelSimulator.model().linearizer().residual();
-                const int num_vars = residual[0].size();
-                for (const auto& domain : domains_) {
-                    Scalar maxres = 0.0;
-                    for (const int c : domain.cells) {
-                        for (int ii = 0; ii < num_vars; ++ii) {
-                            maxres = std::max(maxres, std::fabs(residual[c][ii]));
-                        }
-                    }
-                    measure_per_domain[domain.index] = maxres;
-                }
-                break;
-            }
-            } // end of switch (model_.param().local_domains_ordering_)
+            const auto measure_per_domain = this->computeDomainMeasures();
 
             // Sort by largest measure, keeping index order if equal.
             const auto& m = measure_per_domain;
@@ -988,6 +1330,62 @@ private:
         }
     }
 
+    //! \brief Run extra local passes over the subdomains collected by
+    //! detectWellEventDomains().
+    //!
+    //! Each pass sweeps the affected domains Gauss-Seidel style; domains
+    //! that converge drop out, and the passes stop when all are converged
+    //! or the configured pass budget is spent. The regular sweep follows
+    //! directly afterwards and propagates the updates to the neighboring
+    //! domains.
+    template<class GlobalEqVector>
+    void resolveWellEventDomains(GlobalEqVector& solution,
+                                 GlobalEqVector& locally_solved,
+                                 const SimulatorTimerInterface& timer)
+    {
+        Dune::Timer resolveTimer;
+        resolveTimer.start();
+        DeferredLogger logger;
+        int total_newtons = 0;
+        auto remaining = event_resolve_domains_;
+
+        OPM_BEGIN_PARALLEL_TRY_CATCH()
+        const int max_passes = model_.param().nldd_well_event_resolve_passes_;
+        for (int pass = 0; pass < max_passes && !remaining.empty(); ++pass) {
+            std::vector<int> unconverged;
+            for (const int domain_index : remaining) {
+                const auto& domain = domains_[domain_index];
+                if (domain.skip) {
+                    continue;
+                }
+                SimulatorReportSingle local_report;
+                solveDomainGaussSeidel(solution, locally_solved, local_report,
+                                       logger, timer, domain);
+                if (!local_report.converged) {
+                    unconverged.push_back(domain_index);
+                }
+                total_newtons += local_report.total_newton_iterations;
+                domain_work_[domain_index] += local_report.total_newton_iterations
+                    + local_report.total_linear_iterations;
+                domain_reports_accumulated_[domain_index] += local_report;
+                local_reports_accumulated_ += local_report;
+            }
+            remaining.swap(unconverged);
+        }
+        OPM_END_PARALLEL_TRY_CATCH("Unexpected exception in near-well event resolve: ",
+                                   model_.simulator().vanguard().grid().comm());
+
+        auto global_logger = gatherDeferredLogger(logger, model_.simulator().vanguard().grid().comm());
+        global_logger.logMessages();
+
+        local_reports_accumulated_.success.total_time += resolveTimer.stop();
+        if (rank_ == 0 && !event_resolve_domains_.empty()) {
+            OpmLog::debug(fmt::format("NLDD: resolved {} near-well domains after "
+                                      "well schedule events, {} local Newton iterations.",
+                                      event_resolve_domains_.size(), total_newtons));
+        }
+    }
+
     template<class GlobalEqVector>
     void solveDomainJacobi(GlobalEqVector& solution,
                            GlobalEqVector& locally_solved,
@@ -1095,7 +1493,11 @@ private:
         return errorPV;
     }
 
-    decltype(auto) partitionCells() const
+    //! \brief Partition the rank's interior cells into subdomains.
+    //!
+    //! \param cell_weights Computational weight of each interior cell;
+    //!   empty treats all cells as equally expensive.
+    decltype(auto) partitionCells(const std::vector<double>& cell_weights) const
     {
         const auto& grid = this->model_.simulator().vanguard().grid();
 
@@ -1144,7 +1546,8 @@ private:
         return ::Opm::partitionCells(param.local_domains_partition_method_,
                                      num_domains, grid.leafGridView(), wells,
                                      possibleFutureConnectionSet, zoltan_ctrl,
-                                     param.local_domains_partition_well_neighbor_levels_);
+                                     param.local_domains_partition_well_neighbor_levels_,
+                                     cell_weights);
     }
 
     void updateMobilities(const Domain& domain)
@@ -1222,6 +1625,8 @@ private:
     BlackoilWellModelNldd<TypeTag> wellModel_; //!< NLDD well model adapter
     std::vector<Domain> domains_; //!< Vector of subdomains
     std::vector<std::unique_ptr<Mat>> domain_matrices_; //!< Vector of matrix operator for each subdomain
+    std::vector<BVector> domain_rhs_; //!< Reusable right-hand side vector for each subdomain
+    std::vector<BVector> domain_x_; //!< Reusable solution vector for each subdomain
     std::vector<ISTLSolverType> domain_linsolvers_; //!< Vector of linear solvers for each domain
     SimulatorReport local_reports_accumulated_; //!< Accumulated convergence report for subdomain solvers per rank
     // mutable because we need to update the number of wells for each domain in getDomainAccumulatedReports()
@@ -1231,6 +1636,25 @@ private:
     std::vector<Scalar> previousMobilities_;
     // Flag indicating if this domain should be solved in the next iteration
     std::vector<bool> domain_needs_solving_;
+    // Newton/linear iterations recorded per domain since the last
+    // (re)partitioning; used to drive dynamic repartitioning
+    std::vector<double> domain_work_;
+    // Domains sharing a grid face with each domain; only filled for the
+    // dynamic residual ordering, which promotes the neighbors of a solved domain
+    std::vector<std::vector<int>> domain_neighbors_;
+    // Subdomains holding wells with structural schedule events at the
+    // current report step; given extra local passes before the first sweep
+    std::vector<int> event_resolve_domains_;
+    // Whether the event-triggered resolve is still pending for this step
+    bool pending_event_resolve_ = false;
+    // Episode index for which the event detection last ran
+    int last_event_episode_ = -1;
+    // Number of consecutive passes each domain was converged without work
+    std::vector<int> domain_quiescent_count_;
+    // Remaining passes for which each quiescent domain is skipped
+    std::vector<int> domain_skip_remaining_;
+    // Handle for the subdomain system cache in the memory budget registry
+    std::size_t memory_budget_handle_ = 0;
 };
 
 } // namespace Opm
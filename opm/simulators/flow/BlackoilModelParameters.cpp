@@ -67,6 +67,8 @@ BlackoilModelParameters<Scalar>::BlackoilModelParameters()
     regularization_factor_wells_ = Parameters::Get<Parameters::RegularizationFactorWells<Scalar>>();
     max_niter_inner_well_iter_ = Parameters::Get<Parameters::MaxNewtonIterationsWithInnerWellIterations>();
     shut_unsolvable_wells_ = Parameters::Get<Parameters::ShutUnsolvableWells>();
+    gaslift_incremental_tolerance_ = Parameters::Get<Parameters::GasLiftIncrementalTolerance<Scalar>>();
+    gaslift_full_refresh_interval_ = Parameters::Get<Parameters::GasLiftFullRefreshInterval>();
     max_inner_iter_wells_ = Parameters::Get<Parameters::MaxInnerIterWells>();
     max_well_status_switch_inner_iter_ = Parameters::Get<Parameters::MaxWellStatusSwitchInInnerIterWells>();
     max_well_status_switch_ = Parameters::Get<Parameters::MaxWellStatusSwitchForWells>();
@@ -74,7 +76,15 @@ BlackoilModelParameters<Scalar>::BlackoilModelParameters()
     min_strict_cnv_iter_ = Parameters::Get<Parameters::MinStrictCnvIter>();
     min_strict_mb_iter_ = Parameters::Get<Parameters::MinStrictMbIter>();
     solve_welleq_initially_ = Parameters::Get<Parameters::SolveWelleqInitially>();
+    threaded_well_solves_ = Parameters::Get<Parameters::ThreadedWellSolves>();
+    well_potential_reuse_tol_ = Parameters::Get<Parameters::WellPotentialReuseTolerance<Scalar>>();
     pre_solve_network_ = Parameters::Get<Parameters::PreSolveNetwork>();
+    linear_solver_warm_start_ = Parameters::Get<Parameters::LinearSolverWarmStart>();
+    time_step_chop_warm_start_ = Parameters::Get<Parameters::TimeStepChopWarmStart>();
+    linear_solver_retest_interval_ = Parameters::Get<Parameters::LinearSolverRetestInterval>();
+    linear_solver_retest_time_degradation_ = Parameters::Get<Parameters::LinearSolverRetestTimeDegradation<Scalar>>();
+    reproducible_reductions_ = Parameters::Get<Parameters::ReproducibleReductions>();
+    cache_convergence_sweep_ = Parameters::Get<Parameters::CacheConvergenceSweep>();
     update_equations_scaling_ = Parameters::Get<Parameters::UpdateEquationsScaling>();
     use_update_stabilization_ = Parameters::Get<Parameters::UseUpdateStabilization>();
     matrix_add_well_contributions_ = Parameters::Get<Parameters::MatrixAddWellContributions>();
@@ -103,6 +113,9 @@ BlackoilModelParameters<Scalar>::BlackoilModelParameters()
     newton_min_iter_ = Parameters::Get<Parameters::NewtonMinIterations>();
     nldd_num_initial_newton_iter_ = Parameters::Get<Parameters::NlddNumInitialNewtonIter>();
     nldd_relative_mobility_change_tol_ = Parameters::Get<Parameters::NlddRelativeMobilityChangeTol<Scalar>>();
+    nldd_dynamic_repartition_imbalance_ = Parameters::Get<Parameters::NlddDynamicRepartitionImbalance<Scalar>>();
+    nldd_quiescent_domain_max_skip_ = Parameters::Get<Parameters::NlddQuiescentDomainMaxSkip>();
+    nldd_well_event_resolve_passes_ = Parameters::Get<Parameters::NlddWellEventResolvePasses>();
     num_local_domains_ = Parameters::Get<Parameters::NumLocalDomains>();
     local_domains_partition_imbalance_ = std::max(Scalar{1.0}, Parameters::Get<Parameters::LocalDomainsPartitioningImbalance<Scalar>>());
     local_domains_partition_method_ = Parameters::Get<Parameters::LocalDomainsPartitioningMethod>();
@@ -111,6 +124,7 @@ BlackoilModelParameters<Scalar>::BlackoilModelParameters()
     network_max_strict_outer_iterations_ = Parameters::Get<Parameters::NetworkMaxStrictOuterIterations>();
     network_max_outer_iterations_ = Parameters::Get<Parameters::NetworkMaxOuterIterations>();
     network_max_sub_iterations_ = Parameters::Get<Parameters::NetworkMaxSubIterations>();
+    network_newton_pressure_update_ = Parameters::Get<Parameters::NetworkNewtonPressureUpdate>();
     network_pressure_update_damping_factor_ = Parameters::Get<Parameters::NetworkPressureUpdateDampingFactor<Scalar>>();
     network_max_pressure_update_in_bars_ = Parameters::Get<Parameters::NetworkMaxPressureUpdateInBars<Scalar>>();
     local_domains_ordering_ = domainOrderingMeasureFromString(Parameters::Get<Parameters::LocalDomainsOrderingMeasure>());
@@ -119,9 +133,18 @@ BlackoilModelParameters<Scalar>::BlackoilModelParameters()
     monitor_params_.enabled_ = Parameters::Get<Parameters::ConvergenceMonitoring>();
     monitor_params_.cutoff_ = Parameters::Get<Parameters::ConvergenceMonitoringCutOff>();
     monitor_params_.decay_factor_ = Parameters::Get<Parameters::ConvergenceMonitoringDecayFactor<Scalar>>();
+    monitor_params_.prediction_enabled_ = Parameters::Get<Parameters::ConvergenceMonitoringPrediction>();
+    monitor_params_.prediction_warmup_ = Parameters::Get<Parameters::ConvergenceMonitoringPredictionWarmup>();
+    monitor_params_.prediction_slack_ = Parameters::Get<Parameters::ConvergenceMonitoringPredictionSlack<Scalar>>();
+
+    tolerance_policy_params_.after_chop_relax_factor_ = Parameters::Get<Parameters::ToleranceAfterChopRelaxFactor<Scalar>>();
+    tolerance_policy_params_.after_chop_relax_steps_ = Parameters::Get<Parameters::ToleranceAfterChopRelaxSteps>();
+    tolerance_policy_params_.report_step_tighten_factor_ = Parameters::Get<Parameters::ToleranceReportStepTightenFactor<Scalar>>();
 
     nupcol_group_rate_tolerance_ = Parameters::Get<Parameters::NupcolGroupRateTolerance<Scalar>>();
+    well_connection_props_reuse_tolerance_ = Parameters::Get<Parameters::WellConnectionPropsReuseTolerance<Scalar>>();
     well_group_constraints_max_iterations_ = Parameters::Get<Parameters::WellGroupConstraintsMaxIterations>();
+    well_control_freeze_iteration_ = Parameters::Get<Parameters::WellControlFreezeIteration>();
 }
 
 template<class Scalar>
@@ -163,6 +186,10 @@ void BlackoilModelParameters<Scalar>::registerParameters()
     Parameters::Register<Parameters::ToleranceCnvEnergyRelaxed<Scalar>>
         ("Relaxed local energy convergence tolerance that applies for iterations "
          "after the iterations with the strict tolerance");
+    Parameters::Register<Parameters::MaxTemperatureChangeSequential<Scalar>>
+        ("Largest temperature change (K) over a time step accepted by the "
+         "sequential-implicit temperature solve (TEMP) before the energy "
+         "equation is re-solved in substeps. Set to 0 to disable the check.");
     Parameters::Register<Parameters::ToleranceMaxDp<Scalar>>
         ("Tolerance for max pressure change during a Newton iteration. "
          "A value greater than 0.0 allows for convergence regardless "
@@ -207,6 +234,13 @@ void BlackoilModelParameters<Scalar>::registerParameters()
         ("Maximum newton iterations with inner well iterations");
     Parameters::Register<Parameters::ShutUnsolvableWells>
         ("Shut unsolvable wells");
+    Parameters::Register<Parameters::GasLiftIncrementalTolerance<Scalar>>
+        ("Relative change of the well potentials below which gas-lift "
+         "optimization keeps the previous ALQ for a well. A value of 0 "
+         "disables the incremental mode");
+    Parameters::Register<Parameters::GasLiftFullRefreshInterval>
+        ("Number of gas-lift optimization rounds between two full "
+         "optimizations when the incremental gas-lift mode is active");
     Parameters::Register<Parameters::MaxInnerIterWells>
         ("Maximum number of inner iterations for standard wells");
     Parameters::Register<Parameters::MaxWellStatusSwitchInInnerIterWells>
@@ -215,6 +249,10 @@ void BlackoilModelParameters<Scalar>::registerParameters()
         ("Maximum number of status switching (stop<->open) for a well during a time-step.");
     Parameters::Register<Parameters::AlternativeWellRateInit>
         ("Use alternative well rate initialization procedure");
+    Parameters::Register<Parameters::ExtrapolateWellGuess>
+        ("Initialize each time step's well solve from a polynomial "
+         "extrapolation of the last converged well solutions instead of "
+         "the previous state only");
     Parameters::Register<Parameters::RegularizationFactorWells<Scalar>>
         ("Regularization factor for wells");
     Parameters::Register<Parameters::MaxSinglePrecisionDays<Scalar>>
@@ -230,15 +268,53 @@ void BlackoilModelParameters<Scalar>::registerParameters()
          "number of Newton iterations are reached.");
     Parameters::Register<Parameters::SolveWelleqInitially>
         ("Fully solve the well equations before each iteration of the reservoir model");
+    Parameters::Register<Parameters::ThreadedWellSolves>
+        ("Solve the initial well equations and assemble the well systems of "
+         "wells that are local to a single MPI rank thread parallel using OpenMP");
+    Parameters::Register<Parameters::WellPotentialReuseTolerance<Scalar>>
+        ("Relative change in a well's bhp, thp and surface rates below which "
+         "previously computed well potentials are reused instead of being "
+         "recomputed with an embedded well solve. Set to 0 to always recompute");
     Parameters::Register<Parameters::PreSolveNetwork>
         ("Pre solve and iterate the network model at start-up");
+    Parameters::Register<Parameters::LinearSolverWarmStart>
+        ("Use the Newton update of the previous iteration as the initial "
+         "guess for the iterative linear solver instead of starting from zero");
+    Parameters::Register<Parameters::TimeStepChopWarmStart>
+        ("After a time step chop, start the retry from a state interpolated "
+         "between the step-start state and the last Newton iterate of the "
+         "failed attempt (where the primary variable meanings agree) instead "
+         "of repeating the early Newton iterations from the step-start state");
+    Parameters::Register<Parameters::LinearSolverRetestInterval>
+        ("Number of linear solves between speed tests comparing the "
+         "configured linear solvers when several are given. The fastest "
+         "solver of a test stays active until the next test. Set to 0 to "
+         "only test once at the start of the run");
+    Parameters::Register<Parameters::LinearSolverRetestTimeDegradation<Scalar>>
+        ("Re-run the linear solver speed test early when the recent "
+         "average solve time exceeds this factor times the best time seen "
+         "since the last test. The factor acts as hysteresis against "
+         "spurious switching; 0 (the default) only retests at the fixed "
+         "interval");
+    Parameters::Register<Parameters::ReproducibleReductions>
+        ("Use fixed-order compensated global reductions for the CNV/MB "
+         "convergence sums. This makes the convergence checks independent "
+         "of the MPI reduction tree at the cost of an allgather per "
+         "reduction");
+    Parameters::Register<Parameters::CacheConvergenceSweep>
+        ("Build the convergence-check cell data (cell lists, pore volumes "
+         "and B averages) once per time step and evaluate the CNV/MB "
+         "checks of later Newton iterations from the residual vector "
+         "only, skipping the grid traversal");
     Parameters::Register<Parameters::UpdateEquationsScaling>
         ("Update scaling factors for mass balance equations during the run");
     Parameters::Register<Parameters::UseUpdateStabilization>
         ("Try to detect and correct oscillations or stagnation during the Newton method");
     Parameters::Register<Parameters::MatrixAddWellContributions>
-        ("Explicitly specify the influences of wells between cells in "
-         "the Jacobian and preconditioner matrices");
+        ("Schur-eliminate the well equations into the Jacobian and "
+         "preconditioner matrices (A -= C^T D^-1 B) once per linearization "
+         "instead of applying the wells as an additive operator in every "
+         "Krylov iteration. This makes the linear operator reservoir-only");
     Parameters::Register<Parameters::EnableWellOperabilityCheck>
         ("Enable the well operability checking");
     Parameters::Register<Parameters::EnableWellOperabilityCheckIter>
@@ -261,6 +337,9 @@ void BlackoilModelParameters<Scalar>::registerParameters()
         ("Maximum outer number of iterations in the network solver before giving up");
     Parameters::Register<Parameters::NetworkMaxSubIterations>
         ("Maximum number of sub-iterations to update network pressures (within a single well/group control update)");
+    Parameters::Register<Parameters::NetworkNewtonPressureUpdate>
+        ("Use secant-based Newton steps on the network pressure fixed-point map "
+         "instead of plain damped updates in the inner network sub-iterations");
     Parameters::Register<Parameters::NetworkPressureUpdateDampingFactor<Scalar>>
         ("Damping factor in the inner network pressure update iterations");
     Parameters::Register<Parameters::NetworkMaxPressureUpdateInBars<Scalar>>
@@ -282,6 +361,19 @@ void BlackoilModelParameters<Scalar>::registerParameters()
         ("Number of initial global Newton iterations when running the NLDD nonlinear solver.");
     Parameters::Register<Parameters::NlddRelativeMobilityChangeTol<Scalar>>
         ("Threshold for single cell relative mobility change in the NLDD solver");
+    Parameters::Register<Parameters::NlddDynamicRepartitionImbalance<Scalar>>
+        ("Repartition the NLDD subdomains when the nonlinear work measured "
+         "for the local solves exceeds this factor of the mean across MPI "
+         "ranks. Values of 1.0 or less disable dynamic repartitioning.");
+    Parameters::Register<Parameters::NlddQuiescentDomainMaxSkip>
+        ("Maximum number of NLDD passes to skip a domain whose residual "
+         "has repeatedly been converged without local work. Zero checks "
+         "every domain in every pass.");
+    Parameters::Register<Parameters::NlddWellEventResolvePasses>
+        ("Maximum number of extra local NLDD passes over the subdomains "
+         "holding wells with structural schedule events (new completions, "
+         "opened or shut wells) at the start of a report step. Zero "
+         "disables the event-triggered local resolve.");
     Parameters::Register<Parameters::NumLocalDomains>
         ("Number of local domains for NLDD nonlinear solver.");
     Parameters::Register<Parameters::LocalDomainsPartitioningImbalance<Scalar>>
@@ -296,8 +388,12 @@ void BlackoilModelParameters<Scalar>::registerParameters()
     Parameters::Register<Parameters::LocalDomainsOrderingMeasure>
         ("Subdomain ordering measure. Allowed values are "
          "'maxpressure', "
-         "'averagepressure' "
-         "and  'residual'.");
+         "'averagepressure', "
+         "'residual' "
+         "and 'dynamicresidual'. The latter schedules the Gauss-Seidel "
+         "sweep through a priority queue keyed by the residual norm, "
+         "promoting the neighbors of each solved domain so local updates "
+         "propagate within the sweep.");
     Parameters::Register<Parameters::DebugEmitCellPartition>
         ("Whether or not to emit cell partitions as a debugging aid.");
 
@@ -307,14 +403,53 @@ void BlackoilModelParameters<Scalar>::registerParameters()
         ("Cut off limit for convergence monitoring");
     Parameters::Register<Parameters::ConvergenceMonitoringDecayFactor<Scalar>>
         ("Decay factor for convergence monitoring");
+    Parameters::Register<Parameters::ConvergenceMonitoringPrediction>
+        ("Abort the nonlinear iteration as soon as the residual contraction "
+         "rate projects more iterations to convergence than are left in the "
+         "iteration budget, instead of spending the full budget before "
+         "chopping the time step");
+    Parameters::Register<Parameters::ConvergenceMonitoringPredictionWarmup>
+        ("Number of nonlinear iterations before the convergence prediction "
+         "is trusted to abort the step");
+    Parameters::Register<Parameters::ConvergenceMonitoringPredictionSlack<Scalar>>
+        ("Safety factor applied to the remaining iteration budget before the "
+         "convergence prediction aborts the step. Larger values abort fewer "
+         "steps");
+
+    Parameters::Register<Parameters::ToleranceAfterChopRelaxFactor<Scalar>>
+        ("Factor applied to the CNV and MB tolerances on the first "
+         "sub-steps after a time-step chop. Values above one accept a "
+         "looser solution while the time stepper recovers from the chop. "
+         "One (the default) disables the relaxation");
+    Parameters::Register<Parameters::ToleranceAfterChopRelaxSteps>
+        ("Number of successful sub-steps after a time-step chop for which "
+         "ToleranceAfterChopRelaxFactor is applied");
+    Parameters::Register<Parameters::ToleranceReportStepTightenFactor<Scalar>>
+        ("Factor applied to the CNV and MB tolerances on the sub-step "
+         "ending at a report step. Values below one tighten the solution "
+         "entering report-step output. One (the default) disables the "
+         "tightening");
 
     Parameters::Register<Parameters::NupcolGroupRateTolerance<Scalar>>
         ("Tolerance for acceptable changes in VREP/RAIN group rates");
 
+    Parameters::Register<Parameters::WellConnectionPropsReuseTolerance<Scalar>>
+        ("Relative rate change below which a well's connection pressure-drop "
+         "properties are reused instead of recomputed at the start of a time "
+         "step. Wells touched by schedule events (WELSPECS, COMPDAT, control "
+         "or status changes) are always recomputed. Zero (the default) "
+         "recomputes for all wells every time step");
+
     Parameters::Hide<Parameters::DebugEmitCellPartition>();
 
     Parameters::Register<Parameters::WellGroupConstraintsMaxIterations>
     ("Maximum number of iterations in the well/group switching algorithm");
+    Parameters::Register<Parameters::WellControlFreezeIteration>
+    ("Newton iteration from which well controls and group targets are "
+     "frozen, so late iterations assemble the wells against the cached "
+     "control state. Freezing waits until the well residuals have "
+     "converged and no control switched in the previous iteration, and "
+     "is not applied when a network is active. Zero disables freezing.");
 
     // if openMP is available, use two threads per mpi rank by default
 #if _OPENMP
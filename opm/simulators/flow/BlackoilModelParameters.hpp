@@ -75,6 +75,9 @@ struct ToleranceCnvEnergy { static constexpr Scalar value = 1e-2*41.82; };
 template<class Scalar>
 struct ToleranceCnvEnergyRelaxed { static constexpr Scalar value = 1.0*41.82; };
 
+template<class Scalar>
+struct MaxTemperatureChangeSequential { static constexpr Scalar value = 50.0; };
+
 template<class Scalar>
 struct ToleranceMaxDp { static constexpr Scalar value = 0.0; };
 
@@ -101,7 +104,18 @@ struct MaxSinglePrecisionDays { static constexpr Scalar value = 20.0; };
 struct MinStrictCnvIter { static constexpr int value = -1; };
 struct MinStrictMbIter { static constexpr int value = -1; };
 struct SolveWelleqInitially { static constexpr bool value = true; };
+struct ThreadedWellSolves { static constexpr bool value = false; };
+
+template<class Scalar>
+struct WellPotentialReuseTolerance { static constexpr Scalar value = 0.0; };
 struct PreSolveNetwork { static constexpr bool value = true; };
+struct LinearSolverWarmStart { static constexpr bool value = false; };
+struct TimeStepChopWarmStart { static constexpr bool value = false; };
+struct LinearSolverRetestInterval { static constexpr int value = 100; };
+template<class Scalar>
+struct LinearSolverRetestTimeDegradation { static constexpr Scalar value = 0.0; };
+struct ReproducibleReductions { static constexpr bool value = false; };
+struct CacheConvergenceSweep { static constexpr bool value = false; };
 struct UpdateEquationsScaling { static constexpr bool value = false; };
 struct UseUpdateStabilization { static constexpr bool value = true; };
 struct MatrixAddWellContributions { static constexpr bool value = false; };
@@ -120,7 +134,12 @@ struct MaxInnerIterWells { static constexpr int value = 50; };
 struct MaxWellStatusSwitchInInnerIterWells { static constexpr int value = 99; };
 struct MaxWellStatusSwitchForWells { static constexpr int value = 99; };
 struct ShutUnsolvableWells { static constexpr bool value = true; };
+
+template<class Scalar>
+struct GasLiftIncrementalTolerance { static constexpr Scalar value = 0.0; };
+struct GasLiftFullRefreshInterval { static constexpr int value = 10; };
 struct AlternativeWellRateInit { static constexpr bool value = true; };
+struct ExtrapolateWellGuess { static constexpr bool value = false; };
 struct StrictOuterIterWells { static constexpr int value = 6; };
 struct StrictInnerIterWells { static constexpr int value = 40; };
 
@@ -148,6 +167,7 @@ struct CheckGroupConstraintsInnerWellIterations { static constexpr bool value =
 struct NetworkMaxStrictOuterIterations { static constexpr int value = 10; };
 struct NetworkMaxOuterIterations { static constexpr int value = 3; };
 struct NetworkMaxSubIterations { static constexpr int value = 100; };
+struct NetworkNewtonPressureUpdate { static constexpr bool value = false; };
 template<class Scalar>
 struct NetworkPressureUpdateDampingFactor { static constexpr Scalar value = 0.1; };
 template<class Scalar>
@@ -158,6 +178,7 @@ struct MaxLocalSolveIterations { static constexpr int value = 20; };
 struct NewtonMinIterations { static constexpr int value = 2; };
 
 struct WellGroupConstraintsMaxIterations { static constexpr int value = 1; };
+struct WellControlFreezeIteration { static constexpr int value = 0; };
 template<class Scalar>
 struct LocalToleranceScalingMb { static constexpr Scalar value = 1.0; };
 
@@ -166,6 +187,10 @@ struct LocalToleranceScalingCnv { static constexpr Scalar value = 0.1; };
 struct NlddNumInitialNewtonIter { static constexpr int value = 1; };
 template<class Scalar>
 struct NlddRelativeMobilityChangeTol { static constexpr Scalar value = 0.1; };
+template<class Scalar>
+struct NlddDynamicRepartitionImbalance { static constexpr Scalar value = 0.0; };
+struct NlddQuiescentDomainMaxSkip { static constexpr int value = 4; };
+struct NlddWellEventResolvePasses { static constexpr int value = 0; };
 struct NumLocalDomains { static constexpr int value = 0; };
 
 template<class Scalar>
@@ -179,11 +204,24 @@ struct ConvergenceMonitoring { static constexpr bool value = false; };
 struct ConvergenceMonitoringCutOff { static constexpr int value = 6; };
 template<class Scalar>
 struct ConvergenceMonitoringDecayFactor { static constexpr Scalar value = 0.75; };
+struct ConvergenceMonitoringPrediction { static constexpr bool value = false; };
+struct ConvergenceMonitoringPredictionWarmup { static constexpr int value = 4; };
+template<class Scalar>
+struct ConvergenceMonitoringPredictionSlack { static constexpr Scalar value = 1.5; };
+
+template<class Scalar>
+struct ToleranceAfterChopRelaxFactor { static constexpr Scalar value = 1.0; };
+struct ToleranceAfterChopRelaxSteps { static constexpr int value = 1; };
+template<class Scalar>
+struct ToleranceReportStepTightenFactor { static constexpr Scalar value = 1.0; };
 
 
 template<class Scalar>
 struct NupcolGroupRateTolerance { static constexpr Scalar value = 0.001; };
 
+template<class Scalar>
+struct WellConnectionPropsReuseTolerance { static constexpr Scalar value = 0.0; };
+
 } // namespace Opm::Parameters
 
 namespace Opm {
@@ -266,6 +304,15 @@ public:
     /// Whether to shut unsolvable well
     bool shut_unsolvable_wells_;
 
+    /// Relative change of the well potentials below which gas-lift
+    /// optimization keeps the previous ALQ for a well (0 disables the
+    /// incremental mode)
+    Scalar gaslift_incremental_tolerance_;
+
+    /// Number of gas-lift optimization rounds between two full
+    /// optimizations when the incremental mode is active
+    int gaslift_full_refresh_interval_;
+
     /// Maximum inner iteration number for standard wells
     int max_inner_iter_wells_;
 
@@ -285,9 +332,43 @@ public:
     /// Solve well equation initially
     bool solve_welleq_initially_;
 
+    /// Solve the initial well equations of independent wells thread parallel
+    bool threaded_well_solves_;
+
+    /// Relative change in a well's operating conditions below which
+    /// previously computed well potentials are reused, 0 to always recompute
+    Scalar well_potential_reuse_tol_;
+
     /// Pre solve and iterate network model
     bool pre_solve_network_;
 
+    /// Use the Newton update of the previous iteration as the initial
+    /// guess for the iterative linear solver instead of starting from zero
+    bool linear_solver_warm_start_;
+
+    /// After a time step chop, start the retry from a state interpolated
+    /// between the step-start state and the last Newton iterate of the
+    /// failed attempt instead of from the step-start state
+    bool time_step_chop_warm_start_;
+
+    /// Number of linear solves between speed tests comparing the
+    /// configured linear solvers, 0 to only test once at the start
+    int linear_solver_retest_interval_;
+
+    /// Re-run the linear solver speed test early when the recent solve
+    /// time exceeds this factor times the best time since the last test,
+    /// 0 to only retest at fixed intervals
+    Scalar linear_solver_retest_time_degradation_;
+
+    /// Use fixed-order compensated global reductions for the convergence
+    /// checks so that results do not depend on the MPI reduction tree
+    bool reproducible_reductions_;
+
+    /// Cache the per-cell convergence sweep data at the first Newton
+    /// iteration of each time step and evaluate later iterations' CNV/MB
+    /// checks from the residual vector only
+    bool cache_convergence_sweep_;
+
     /// Update scaling factors for mass balance equations
     bool update_equations_scaling_;
 
@@ -339,6 +420,10 @@ public:
     /// Maximum number of sub-iterations to update network pressures (within a single well/group control update)
     int network_max_sub_iterations_;
 
+    /// Use secant-based Newton steps instead of plain damped fixed-point
+    /// updates in the inner network pressure update iterations
+    bool network_newton_pressure_update_;
+
     /// Damping factor in the inner network pressure update iterations
     Scalar network_pressure_update_damping_factor_;
 
@@ -348,6 +433,9 @@ public:
     /// Maximum number of iterations in the well/group switch algorithm
     int well_group_constraints_max_iterations_;
 
+    /// Newton iteration from which well controls and group targets are frozen
+    int well_control_freeze_iteration_;
+
     /// Maximum number of status switches (open<->stop> in local well iterations
     int max_well_status_switch_inner_iter_;
 
@@ -374,6 +462,12 @@ public:
     int nldd_num_initial_newton_iter_{1};
     /// Threshold for single cell relative mobility change in NLDD
     Scalar nldd_relative_mobility_change_tol_;
+    /// Measured work imbalance across ranks that triggers NLDD repartitioning
+    Scalar nldd_dynamic_repartition_imbalance_{0.0};
+    /// Maximum number of NLDD passes to skip a repeatedly converged domain
+    int nldd_quiescent_domain_max_skip_{4};
+    /// Extra local passes for subdomains with well schedule events
+    int nldd_well_event_resolve_passes_{0};
     int num_local_domains_{0};
     Scalar local_domains_partition_imbalance_{1.03};
     std::string local_domains_partition_method_;
@@ -391,14 +485,42 @@ public:
         int cutoff_;
         /// Decay factor used in convergence monitoring
         Scalar decay_factor_;
+        /// Whether to abort when the projected iterations to convergence
+        /// exceed the remaining iteration budget
+        bool prediction_enabled_;
+        /// Number of iterations before the projection is trusted
+        int prediction_warmup_;
+        /// Safety factor applied to the remaining iteration budget
+        Scalar prediction_slack_;
     };
 
     ConvergenceMonitorParams monitor_params_; //!< Convergence monitoring parameters
 
+    /// Struct holding the adaptive tolerance policy params
+    struct TolerancePolicyParams
+    {
+        /// Factor (>= 1) applied to the CNV and MB tolerances on the
+        /// first sub-steps after a time-step chop
+        Scalar after_chop_relax_factor_;
+        /// Number of successful sub-steps for which the post-chop
+        /// relaxation stays active
+        int after_chop_relax_steps_;
+        /// Factor (<= 1) applied to the CNV and MB tolerances on the
+        /// sub-step ending at a report step
+        Scalar report_step_tighten_factor_;
+    };
+
+    TolerancePolicyParams tolerance_policy_params_; //!< Adaptive tolerance policy parameters
+
     // Relative tolerance of group rates (VREP, REIN)
     // If violated the nupcol wellstate is updated
     Scalar nupcol_group_rate_tolerance_;
 
+    // Relative rate change below which a well's connection pressure-drop
+    // properties are reused instead of recomputed at the start of a time
+    // step.  Zero recomputes for all wells every time step.
+    Scalar well_connection_props_reuse_tolerance_;
+
     /// Construct from user parameters or defaults.
     BlackoilModelParameters();
 
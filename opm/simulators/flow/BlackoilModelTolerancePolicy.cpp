@@ -0,0 +1,71 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+#include <opm/simulators/flow/BlackoilModelTolerancePolicy.hpp>
+
+#include <limits>
+
+namespace Opm {
+
+template<class Scalar>
+BlackoilModelTolerancePolicy<Scalar>::
+BlackoilModelTolerancePolicy(const PolicyParams& param)
+    : param_(param)
+    , steps_since_chop_(std::numeric_limits<int>::max())
+{
+}
+
+template<class Scalar>
+void BlackoilModelTolerancePolicy<Scalar>::
+beginTimeStep(const bool lastStepFailed, const bool endsAtReportStep)
+{
+    if (lastStepFailed) {
+        steps_since_chop_ = 0;
+    }
+    else if (steps_since_chop_ < std::numeric_limits<int>::max()) {
+        ++steps_since_chop_;
+    }
+
+    ends_at_report_step_ = endsAtReportStep;
+}
+
+template<class Scalar>
+Scalar BlackoilModelTolerancePolicy<Scalar>::
+toleranceFactor() const
+{
+    Scalar factor = 1.0;
+
+    if (steps_since_chop_ < param_.after_chop_relax_steps_) {
+        factor *= param_.after_chop_relax_factor_;
+    }
+
+    if (ends_at_report_step_) {
+        factor *= param_.report_step_tighten_factor_;
+    }
+
+    return factor;
+}
+
+template class BlackoilModelTolerancePolicy<double>;
+
+#if FLOW_INSTANTIATE_FLOAT
+template class BlackoilModelTolerancePolicy<float>;
+#endif
+
+} // namespace Opm
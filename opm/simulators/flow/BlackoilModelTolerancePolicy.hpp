@@ -0,0 +1,61 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_BLACKOILMODEL_TOLERANCE_POLICY_HEADER_INCLUDED
+#define OPM_BLACKOILMODEL_TOLERANCE_POLICY_HEADER_INCLUDED
+
+#include <opm/simulators/flow/BlackoilModelParameters.hpp>
+
+namespace Opm {
+
+/// Adaptive scaling of the nonlinear convergence tolerances based on the
+/// maturity of the current sub-step: looser tolerances on the first
+/// sub-steps after a time-step chop, tighter tolerances on the sub-step
+/// ending at a report step.  The policy only supplies a scaling factor
+/// for the CNV and MB tolerances; the per-iteration relaxation logic
+/// stays in BlackoilModel::getReservoirConvergence().  The scaled
+/// tolerances are recorded in the ConvergenceReport like any others.
+template <class Scalar>
+class BlackoilModelTolerancePolicy
+{
+public:
+    using PolicyParams = typename BlackoilModelParameters<Scalar>::TolerancePolicyParams;
+    explicit BlackoilModelTolerancePolicy(const PolicyParams& param);
+
+    /// Update the policy state at the start of a sub-step.
+    ///
+    /// \param[in] lastStepFailed Whether the previous sub-step attempt
+    ///   was chopped.
+    /// \param[in] endsAtReportStep Whether the sub-step about to be taken
+    ///   ends at a report step boundary.
+    void beginTimeStep(bool lastStepFailed, bool endsAtReportStep);
+
+    /// Combined scaling factor for the CNV and MB tolerances of the
+    /// current sub-step.  Unity when the policy is inactive.
+    Scalar toleranceFactor() const;
+
+private:
+    const PolicyParams& param_;
+    int steps_since_chop_;
+    bool ends_at_report_step_ = false;
+};
+
+} // namespace Opm
+
+#endif // OPM_BLACKOILMODEL_TOLERANCE_POLICY_HEADER_INCLUDED
@@ -35,8 +35,17 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 
 #include <opm/simulators/flow/countGlobalCells.hpp>
+#include <opm/simulators/flow/priVarsPacking.hpp>
+
+#include <opm/simulators/utils/AllocationTracker.hpp>
+#include <opm/simulators/utils/EventProfiler.hpp>
+#include <opm/simulators/utils/MemoryBudget.hpp>
+#include <opm/simulators/utils/ParallelCommunication.hpp>
+#include <opm/simulators/utils/ReproducibleReduction.hpp>
+#include <opm/simulators/utils/RooflineCounters.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <filesystem>
 #include <functional>
@@ -87,6 +96,7 @@ BlackoilModel(Simulator& simulator,
     , current_relaxation_(1.0)
     , dx_old_(simulator_.model().numGridDof())
     , conv_monitor_(param_.monitor_params_)
+    , tolerance_policy_(param_.tolerance_policy_params_)
 {
     // compute global sum of number of cells
     global_nc_ = detail::countGlobalCells(grid_);
@@ -105,6 +115,20 @@ BlackoilModel(Simulator& simulator,
         OPM_THROW(std::runtime_error, "Unknown nonlinear solver option: " +
                                       param_.nonlinear_solver_);
     }
+
+    // The global solver hierarchy is cheap to rebuild relative to the
+    // NLDD subdomain systems, so it is evicted first (lower priority).
+    memory_budget_handle_ = MemoryBudget::instance().registerCache(
+        "Linear solver hierarchy", /*priority=*/0,
+        [this]() { return simulator_.model().newtonMethod().linearSolver().solverHierarchyBytes(); },
+        [this]() { simulator_.model().newtonMethod().linearSolver().releaseSolverHierarchy(); });
+}
+
+template <class TypeTag>
+BlackoilModel<TypeTag>::
+~BlackoilModel()
+{
+    MemoryBudget::instance().unregisterCache(memory_budget_handle_);
 }
 
 template <class TypeTag>
@@ -123,6 +147,9 @@ prepareStep(const SimulatorTimerInterface& timer)
     }
     if (lastStepFailed) {
         simulator_.model().updateFailed();
+        if (param_.time_step_chop_warm_start_) {
+            applyTimeStepChopWarmStart(timer.currentStepLength());
+        }
     }
     else {
         simulator_.model().advanceTimeLevel();
@@ -135,6 +162,11 @@ prepareStep(const SimulatorTimerInterface& timer)
     simulator_.setTime(timer.simulationTimeElapsed());
     simulator_.setTimeStepSize(timer.currentStepLength());
 
+    // The episode was set up to span the report step by the simulator, so
+    // episodeWillBeOver() identifies the sub-step ending at a report step.
+    tolerance_policy_.beginTimeStep(lastStepFailed != 0,
+                                    simulator_.episodeWillBeOver());
+
     simulator_.problem().resetIterationForNewTimestep();
 
     simulator_.problem().beginTimeStep();
@@ -143,6 +175,9 @@ prepareStep(const SimulatorTimerInterface& timer)
     wasSwitched_.resize(numDof);
     std::fill(wasSwitched_.begin(), wasSwitched_.end(), false);
 
+    // the cached convergence sweep data is only valid within a time step
+    conv_cache_valid_ = false;
+
     if (param_.update_equations_scaling_) {
         OpmLog::error("Equation scaling not supported");
         //updateEquationsScaling();
@@ -177,6 +212,65 @@ prepareStep(const SimulatorTimerInterface& timer)
     return report;
 }
 
+template <class TypeTag>
+void
+BlackoilModel<TypeTag>::
+applyTimeStepChopWarmStart(const double new_dt)
+{
+    if (!chop_warm_start_valid_) {
+        return;
+    }
+    // The snapshot belongs to the attempt that just failed; never reuse it.
+    chop_warm_start_valid_ = false;
+
+    auto& solution = simulator_.model().solution(/*timeIdx=*/0);
+    if (chop_warm_start_iterate_.size() != solution.size() ||
+        !(chop_warm_start_dt_ > 0.0))
+    {
+        return;
+    }
+
+    // The iterate approximates the state after the full failed step. The
+    // chopped step only covers a fraction of it, so blend the restored
+    // step-start state towards the iterate by that fraction.
+    const double theta = std::clamp(new_dt / chop_warm_start_dt_, 0.0, 1.0);
+
+    std::size_t numUpdated = 0;
+    for (std::size_t dofIdx = 0; dofIdx < solution.size(); ++dofIdx) {
+        // Interpolating across a primary variable switch would mix
+        // quantities with different meanings; keep the step-start values
+        // for such cells.
+        if (PVUtil::pack(solution[dofIdx]) !=
+            PVUtil::pack(chop_warm_start_iterate_[dofIdx]))
+        {
+            continue;
+        }
+
+        std::array<double, numEq> blended;
+        bool finite = true;
+        for (int eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+            blended[eqIdx] = (1.0 - theta) * solution[dofIdx][eqIdx] +
+                             theta * chop_warm_start_iterate_[dofIdx][eqIdx];
+            finite = finite && std::isfinite(blended[eqIdx]);
+        }
+        if (!finite) {
+            continue;
+        }
+
+        for (int eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+            solution[dofIdx][eqIdx] = blended[eqIdx];
+        }
+        ++numUpdated;
+    }
+
+    if (numUpdated > 0) {
+        simulator_.model().invalidateAndUpdateIntensiveQuantities(/*timeIdx=*/0);
+        OpmLog::debug(fmt::format("Warm started chopped time step from the last "
+                                  "Newton iterate in {} of {} cells (theta = {:.3f}).",
+                                  numUpdated, solution.size(), theta));
+    }
+}
+
 template <class TypeTag>
 void
 BlackoilModel<TypeTag>::
@@ -253,6 +347,13 @@ nonlinearIteration(const SimulatorTimerInterface& timer,
         conv_monitor_.reset();
         current_relaxation_ = 1.0;
         dx_old_ = 0.0;
+        // The Newton updates of a new (or chopped) time step can have a very
+        // different scale, so do not carry the warm start guess across steps.
+        warm_start_x_.resize(0);
+        // The chop warm start snapshot was either consumed in prepareStep()
+        // or belongs to an earlier attempt; only iterates of this attempt
+        // may seed a future retry.
+        chop_warm_start_valid_ = false;
         convergence_reports_.push_back({timer.reportStepNum(), timer.currentStepNum(), {}});
         convergence_reports_.back().report.reserve(11);
     }
@@ -280,6 +381,8 @@ BlackoilModel<TypeTag>::
 nonlinearIterationNewton(const SimulatorTimerInterface& timer,
                          NonlinearSolverType& nonlinear_solver)
 {
+    const EventProfiler::Scope profileScope("nonlinearIterationNewton");
+
     // -----------   Set up reports and timer   -----------
     SimulatorReportSingle report;
     Dune::Timer perfTimer;
@@ -358,6 +461,14 @@ nonlinearIterationNewton(const SimulatorTimerInterface& timer,
         // chopping of the update.
         updateSolution(x);
 
+        if (param_.time_step_chop_warm_start_) {
+            // Remember the iterate so that a retry after a chop can start
+            // from an interpolated state instead of the step-start state.
+            chop_warm_start_iterate_ = simulator_.model().solution(/*timeIdx=*/0);
+            chop_warm_start_dt_ = timer.currentStepLength();
+            chop_warm_start_valid_ = true;
+        }
+
         report.update_time += perfTimer.stop();
     }
 
@@ -369,6 +480,10 @@ SimulatorReportSingle
 BlackoilModel<TypeTag>::
 assembleReservoir(const SimulatorTimerInterface& /* timer */)
 {
+    const EventProfiler::Scope profileScope("assembleReservoir");
+    const AllocationTracker::Scope allocScope(AllocationTracker::Subsystem::Assembly);
+    const RooflineCounters::Scope rooflineScope(RooflineCounters::Phase::Assembly);
+
     // -------- Mass balance equations --------
     simulator_.problem().beginIteration();
     simulator_.model().linearizer().linearizeDomain();
@@ -468,12 +583,16 @@ void
 BlackoilModel<TypeTag>::
 solveJacobianSystem(BVector& x)
 {
+    const EventProfiler::Scope profileScope("solveJacobianSystem");
+    const AllocationTracker::Scope allocScope(AllocationTracker::Subsystem::LinearSolve);
+    const RooflineCounters::Scope rooflineScope(RooflineCounters::Phase::LinearSolve);
+
     auto& jacobian = simulator_.model().linearizer().jacobian().istlMatrix();
     auto& residual = simulator_.model().linearizer().residual();
     auto& linSolver = simulator_.model().newtonMethod().linearSolver();
 
     const int numSolvers = linSolver.numAvailableSolvers();
-    if (numSolvers > 1 && (linSolver.getSolveCount() % 100 == 0)) {
+    if (numSolvers > 1 && this->shouldRetestLinearSolvers(linSolver.getSolveCount())) {
         if (terminal_output_) {
             OpmLog::debug("\nRunning speed test for comparing available linear solvers.");
         }
@@ -507,10 +626,23 @@ solveJacobianSystem(BVector& x)
         linear_solve_setup_time_ = setupTimes[fastest_solver];
         x = x_trial[fastest_solver];
         linSolver.setActiveSolver(fastest_solver);
+
+        // Restart the degradation tracking for the newly selected solver.
+        linear_solve_best_time_ = std::numeric_limits<double>::max();
+        linear_solve_recent_time_ = 0.0;
+        linear_solves_since_test_ = 0;
     }
     else {
         // set initial guess
-        x = 0.0;
+        if (param_.linear_solver_warm_start_ && warm_start_x_.size() == x.size()) {
+            // Successive Newton systems differ only slightly, so the Newton
+            // update of the previous iteration is typically closer to the new
+            // solution than zero.
+            x = warm_start_x_;
+        }
+        else {
+            x = 0.0;
+        }
 
         Dune::Timer perfTimer;
         perfTimer.start();
@@ -521,10 +653,71 @@ solveJacobianSystem(BVector& x)
         // account for parallelization properly. since the residual of ECFV
         // discretizations does not need to be synchronized across processes to be
         // consistent, this is not relevant for OPM-flow...
-        linSolver.solve(x);
+        perfTimer.reset();
+        perfTimer.start();
+        const bool converged = linSolver.solve(x);
+        const double solve_time = perfTimer.stop();
+
+        if (numSolvers > 1) {
+            // Track solve times of the active solver so that
+            // shouldRetestLinearSolvers() can detect degradation.
+            const double total_time = linear_solve_setup_time_ + solve_time;
+            linear_solve_best_time_ = std::min(linear_solve_best_time_, total_time);
+            if (linear_solves_since_test_ == 0) {
+                linear_solve_recent_time_ = total_time;
+            }
+            else {
+                // Exponential moving average smooths out single slow solves.
+                linear_solve_recent_time_ = 0.8 * linear_solve_recent_time_ + 0.2 * total_time;
+            }
+            ++linear_solves_since_test_;
+        }
+
+        if (param_.linear_solver_warm_start_) {
+            if (converged) {
+                warm_start_x_ = x;
+            }
+            else {
+                // Do not reuse the result of a failed solve as a guess.
+                warm_start_x_.resize(0);
+            }
+        }
     }
 }
 
+template <class TypeTag>
+bool
+BlackoilModel<TypeTag>::
+shouldRetestLinearSolvers(const int solveCount)
+{
+    // Fixed-interval retest; the very first solve always runs the speed
+    // test, also when the interval is zero ("test once at the start").
+    if (solveCount == 0) {
+        return true;
+    }
+    if (param_.linear_solver_retest_interval_ > 0 &&
+        solveCount % param_.linear_solver_retest_interval_ == 0)
+    {
+        return true;
+    }
+
+    // Early retest when the active solver has degraded relative to its
+    // best observed performance since the last test. The factor itself
+    // provides hysteresis; additionally require a few solves worth of
+    // statistics so a single slow solve does not trigger a retest.
+    if (param_.linear_solver_retest_time_degradation_ <= 1.0 ||
+        linear_solves_since_test_ < 10)
+    {
+        return false;
+    }
+    int degraded = static_cast<int>(
+        linear_solve_recent_time_ >
+        param_.linear_solver_retest_time_degradation_ * linear_solve_best_time_);
+    // Use the statistics on rank 0, must be consistent across ranks.
+    grid_.comm().broadcast(&degraded, 1, 0);
+    return degraded != 0;
+}
+
 template <class TypeTag>
 void
 BlackoilModel<TypeTag>::
@@ -663,6 +856,9 @@ convergenceReduction(Parallel::Communication comm,
                      std::vector< Scalar >& B_avg)
 {
     OPM_TIMEBLOCK(convergenceReduction);
+    // The reduction is the main synchronization point of an iteration, so
+    // the span shows up as MPI wait time of the fast ranks in the traces.
+    const EventProfiler::Scope profileScope("convergenceReduction");
     // Compute total pore volume (use only owned entries)
     Scalar pvSum = pvSumLocal;
     Scalar numAquiferPvSum = numAquiferPvSumLocal;
@@ -684,11 +880,24 @@ convergenceReduction(Parallel::Communication comm,
         sumBuffer.push_back( pvSum );
         sumBuffer.push_back( numAquiferPvSum );
 
-        // compute global sum
-        comm.sum( sumBuffer.data(), sumBuffer.size() );
+        {
+            // Any rank imbalance in the assembly shows up as wait time in
+            // this reduction; attribute it accordingly.
+            const Parallel::WaitTimer waitTimer(Parallel::WaitClass::Assembly);
+
+            // compute global sum
+            if (param_.reproducible_reductions_) {
+                // fixed-order compensated reduction: result is independent of
+                // the MPI implementation's reduction tree
+                Parallel::reproducibleSum(comm, sumBuffer.data(), sumBuffer.size());
+            }
+            else {
+                comm.sum( sumBuffer.data(), sumBuffer.size() );
+            }
 
-        // compute global max
-        comm.max( maxBuffer.data(), maxBuffer.size() );
+            // compute global max
+            comm.max( maxBuffer.data(), maxBuffer.size() );
+        }
 
         // restore values to local variables
         for (int compIdx = 0, buffIdx = 0; compIdx < numComp; ++compIdx, ++buffIdx) {
@@ -721,6 +930,13 @@ localConvergenceData(std::vector<Scalar>& R_sum,
                      std::vector<int>& maxCoeffCell)
 {
     OPM_TIMEBLOCK(localConvergenceData);
+
+    if (param_.cache_convergence_sweep_ && conv_cache_valid_ &&
+        conv_B_avg_.size() == B_avg.size())
+    {
+        return this->residualOnlyConvergenceData(R_sum, maxCoeff, B_avg, maxCoeffCell);
+    }
+
     Scalar pvSumLocal = 0.0;
     Scalar numAquiferPvSumLocal = 0.0;
     const auto& model = simulator_.model();
@@ -728,6 +944,11 @@ localConvergenceData(std::vector<Scalar>& R_sum,
 
     const auto& residual = simulator_.model().linearizer().residual();
 
+    if (param_.cache_convergence_sweep_) {
+        conv_cells_.clear();
+        conv_aquifer_cells_.clear();
+    }
+
     ElementContext elemCtx(simulator_);
     const auto& gridView = simulator().gridView();
     IsNumericalAquiferCell isNumericalAquiferCell(gridView.grid());
@@ -744,10 +965,15 @@ localConvergenceData(std::vector<Scalar>& R_sum,
                              model.dofTotalVolume(cell_idx);
         pvSumLocal += pvValue;
 
-        if (isNumericalAquiferCell(elem)) {
+        const bool aquiferCell = isNumericalAquiferCell(elem);
+        if (aquiferCell) {
             numAquiferPvSumLocal += pvValue;
         }
 
+        if (param_.cache_convergence_sweep_) {
+            (aquiferCell ? conv_aquifer_cells_ : conv_cells_).push_back(cell_idx);
+        }
+
         this->getMaxCoeff(cell_idx, intQuants, fs, residual, pvValue,
                           B_avg, R_sum, maxCoeff, maxCoeffCell);
     }
@@ -760,9 +986,67 @@ localConvergenceData(std::vector<Scalar>& R_sum,
         B_avg[i] /= Scalar(global_nc_);
     }
 
+    if (param_.cache_convergence_sweep_) {
+        conv_B_avg_ = B_avg;
+        conv_pv_sum_local_ = pvSumLocal;
+        conv_aquifer_pv_sum_local_ = numAquiferPvSumLocal;
+        conv_cache_valid_ = true;
+    }
+
     return {pvSumLocal, numAquiferPvSumLocal};
 }
 
+template <class TypeTag>
+std::pair<typename BlackoilModel<TypeTag>::Scalar,
+          typename BlackoilModel<TypeTag>::Scalar>
+BlackoilModel<TypeTag>::
+residualOnlyConvergenceData(std::vector<Scalar>& R_sum,
+                            std::vector<Scalar>& maxCoeff,
+                            std::vector<Scalar>& B_avg,
+                            std::vector<int>& maxCoeffCell) const
+{
+    OPM_TIMEBLOCK(residualOnlyConvergenceData);
+
+    const auto& model = simulator_.model();
+    const auto& problem = simulator_.problem();
+    const auto& residual = model.linearizer().residual();
+
+    // the B factors drift little within a Newton loop, reuse the averages
+    // of the full sweep at the start of the time step
+    B_avg = conv_B_avg_;
+
+    const int numComp = B_avg.size();
+    auto accumulate = [&](const int cell_idx)
+    {
+        const Scalar pvValue = problem.referencePorosity(cell_idx, /*timeIdx=*/0) *
+                               model.dofTotalVolume(cell_idx);
+        for (int compIdx = 0; compIdx < numComp; ++compIdx) {
+            auto R2 = residual[cell_idx][compIdx];
+            if constexpr (has_polymermw_) {
+                // same scaling as in getMaxCoeff()
+                if (compIdx == static_cast<int>(contiPolymerMWEqIdx)) {
+                    R2 /= 100.;
+                }
+            }
+            R_sum[compIdx] += R2;
+            const Scalar Rval = std::abs(R2) / pvValue;
+            if (Rval > maxCoeff[compIdx]) {
+                maxCoeff[compIdx] = Rval;
+                maxCoeffCell[compIdx] = cell_idx;
+            }
+        }
+    };
+
+    for (const int cell_idx : conv_cells_) {
+        accumulate(cell_idx);
+    }
+    for (const int cell_idx : conv_aquifer_cells_) {
+        accumulate(cell_idx);
+    }
+
+    return {conv_pv_sum_local_, conv_aquifer_pv_sum_local_};
+}
+
 template <class TypeTag>
 typename BlackoilModel<TypeTag>::CnvPvSplitData
 BlackoilModel<TypeTag>::
@@ -800,22 +1084,14 @@ characteriseCnvPvSplit(const std::vector<Scalar>& B_avg, const double dt)
     const auto& residual = model.linearizer().residual();
     const auto& gridView = this->simulator().gridView();
 
-    const IsNumericalAquiferCell isNumericalAquiferCell(gridView.grid());
-
-    ElementContext elemCtx(this->simulator());
-
     std::vector<unsigned> ixCells;
 
-    OPM_BEGIN_PARALLEL_TRY_CATCH();
-    for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
-        // Skip cells of numerical Aquifer
-        if (isNumericalAquiferCell(elem)) {
-            continue;
-        }
+    const bool trackIxCells =
+        this->param_.tolerance_max_dp_ > 0.0 || this->param_.tolerance_max_ds_ > 0.0 ||
+        this->param_.tolerance_max_drs_ > 0.0 || this->param_.tolerance_max_drv_ > 0.0;
 
-        elemCtx.updatePrimaryStencil(elem);
-
-        const unsigned cell_idx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
+    auto classifyCell = [&](const unsigned cell_idx)
+    {
         const auto pvValue = problem.referencePorosity(cell_idx, /*timeIdx=*/0)
             * model.dofTotalVolume(cell_idx);
 
@@ -828,15 +1104,39 @@ characteriseCnvPvSplit(const std::vector<Scalar>& B_avg, const double dt)
         ++cellCntPV[ix];
 
         // For dP and dS check, we need cell indices of [1] violations
-        if ( ix > 0 &&
-             (this->param_.tolerance_max_dp_ > 0.0 || this->param_.tolerance_max_ds_ > 0.0
-              || this->param_.tolerance_max_drs_ > 0.0 || this->param_.tolerance_max_drv_ > 0.0 ) ) {
+        if (ix > 0 && trackIxCells) {
             ixCells.push_back(cell_idx);
         }
+    };
+
+    if (this->param_.cache_convergence_sweep_ && this->conv_cache_valid_) {
+        // the cached cell list already excludes numerical-aquifer cells,
+        // no grid traversal needed
+        for (const int cell_idx : this->conv_cells_) {
+            classifyCell(cell_idx);
+        }
     }
+    else {
+        const IsNumericalAquiferCell isNumericalAquiferCell(gridView.grid());
 
-    OPM_END_PARALLEL_TRY_CATCH("BlackoilModel::characteriseCnvPvSplit() failed: ",
-                               this->grid_.comm());
+        ElementContext elemCtx(this->simulator());
+
+        OPM_BEGIN_PARALLEL_TRY_CATCH();
+        for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
+            // Skip cells of numerical Aquifer
+            if (isNumericalAquiferCell(elem)) {
+                continue;
+            }
+
+            elemCtx.updatePrimaryStencil(elem);
+
+            const unsigned cell_idx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
+            classifyCell(cell_idx);
+        }
+
+        OPM_END_PARALLEL_TRY_CATCH("BlackoilModel::characteriseCnvPvSplit() failed: ",
+                                   this->grid_.comm());
+    }
 
     this->grid_.comm().sum(splitPV  .data(), splitPV  .size());
     this->grid_.comm().sum(cellCntPV.data(), cellCntPV.size());
@@ -977,10 +1277,15 @@ getReservoirConvergence(const double reportTime,
     // solution change tolerances have been fulfilled
     Scalar tolerance_cnv_relaxed = relax_dsol_cnv ? 1e20 : param_.tolerance_cnv_relaxed_;
 
-    const auto tol_cnv = use_relaxed_cnv ? tolerance_cnv_relaxed : param_.tolerance_cnv_;
-    const auto tol_mb  = use_relaxed_mb ? param_.tolerance_mb_relaxed_ : param_.tolerance_mb_;
-    const auto tol_cnv_energy = use_relaxed_cnv ? param_.tolerance_cnv_energy_relaxed_ : param_.tolerance_cnv_energy_;
-    const auto tol_eb = use_relaxed_mb ? param_.tolerance_energy_balance_relaxed_ : param_.tolerance_energy_balance_;
+    // Iteration-independent scaling from the adaptive tolerance policy
+    // (post-chop relaxation, report-step tightening).  The scaled
+    // tolerances are what gets recorded in the convergence report below.
+    const Scalar policy_factor = tolerance_policy_.toleranceFactor();
+
+    const auto tol_cnv = (use_relaxed_cnv ? tolerance_cnv_relaxed : param_.tolerance_cnv_) * policy_factor;
+    const auto tol_mb  = (use_relaxed_mb ? param_.tolerance_mb_relaxed_ : param_.tolerance_mb_) * policy_factor;
+    const auto tol_cnv_energy = (use_relaxed_cnv ? param_.tolerance_cnv_energy_relaxed_ : param_.tolerance_cnv_energy_) * policy_factor;
+    const auto tol_eb = (use_relaxed_mb ? param_.tolerance_energy_balance_relaxed_ : param_.tolerance_energy_balance_) * policy_factor;
 
     // Finish computation
     std::vector<Scalar> CNV(numComp);
@@ -1188,7 +1493,7 @@ getConvergence(const SimulatorTimerInterface& timer,
                                                  /*checkWellGroupControlsAndNetwork*/report.converged());
     }
 
-    conv_monitor_.checkPenaltyCard(report, simulator_.problem().iterationContext().iteration());
+    conv_monitor_.checkPenaltyCard(report, simulator_.problem().iterationContext().iteration(), maxIter);
 
     return report;
 }
@@ -1236,6 +1541,16 @@ writeNonlinearIterationsPerCell(const std::filesystem::path& odir) const
     }
 }
 
+template <class TypeTag>
+void
+BlackoilModel<TypeTag>::
+writeDomainCostBreakdown(const std::filesystem::path& odir) const
+{
+    if (hasNlddSolver()) {
+        nlddSolver_->writeDomainCostBreakdown(odir);
+    }
+}
+
 template <class TypeTag>
 void
 BlackoilModel<TypeTag>::
@@ -1072,7 +1072,25 @@ collect(const data::Solution&                                localCellData,
         this->isIORank()
     };
 
-    toIORankComm_.exchange(packUnpackCellData);
+    // Some of the categories are empty in a rank-uniform way and their
+    // message rounds can be skipped entirely: the cell data and the
+    // flows/flores vectors are only filled on report steps (or with
+    // --enable-write-all-solutions), and the inter-region flow map only
+    // carries region maps when the deck requests inter-region summary
+    // output. This keeps summary-only steps from shipping the full field
+    // set through the I/O rank. Categories whose emptiness may differ
+    // between ranks (e.g. well and WBP data) are always exchanged.
+    const bool haveCellData = !localCellData.empty();
+    const bool haveFlowsn =
+        std::any_of(localFlowsn.begin(), localFlowsn.end(),
+                    [](const auto& flows) { return !flows.name.empty(); });
+    const bool haveFloresn =
+        std::any_of(localFloresn.begin(), localFloresn.end(),
+                    [](const auto& flores) { return !flores.name.empty(); });
+
+    if (haveCellData) {
+        toIORankComm_.exchange(packUnpackCellData);
+    }
     toIORankComm_.exchange(packUnpackWellData);
     toIORankComm_.exchange(packUnpackGroupAndNetworkData);
     toIORankComm_.exchange(packUnpackBlockData);
@@ -1080,9 +1098,15 @@ collect(const data::Solution&                                localCellData,
     toIORankComm_.exchange(packUnpackWBPData);
     toIORankComm_.exchange(packUnpackAquiferData);
     toIORankComm_.exchange(packUnpackWellTestState);
-    toIORankComm_.exchange(packUnpackInterRegFlows);
-    toIORankComm_.exchange(packUnpackFlowsn);
-    toIORankComm_.exchange(packUnpackFloresn);
+    if (localInterRegFlows.wantInterRegflowSummary()) {
+        toIORankComm_.exchange(packUnpackInterRegFlows);
+    }
+    if (haveFlowsn) {
+        toIORankComm_.exchange(packUnpackFlowsn);
+    }
+    if (haveFloresn) {
+        toIORankComm_.exchange(packUnpackFloresn);
+    }
 
 #ifndef NDEBUG
     // make sure every process is on the same page
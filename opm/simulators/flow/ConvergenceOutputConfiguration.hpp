@@ -23,6 +23,12 @@
 #include <cstddef>
 #include <string_view>
 
+namespace Opm::Parameters {
+
+struct OutputExtraConvergenceInfo { static constexpr auto* value = "none"; };
+
+} // namespace Opm::Parameters
+
 namespace Opm {
 
 /// Parse comma separated option strings into a runtime configuration object
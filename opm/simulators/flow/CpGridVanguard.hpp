@@ -251,7 +251,9 @@ public:
                              this->imbalanceTol(),
                              this->gridView(), this->schedule(),
                              this->eclState(), this->parallelWells_,
-                             this->numJacobiBlocks(), this->enableEclOutput());
+                             this->numJacobiBlocks(), this->enableEclOutput(),
+                             this->partitionCacheDir(),
+                             this->partitionCellWeightsFile());
 #endif
 
         this->updateGridView_();
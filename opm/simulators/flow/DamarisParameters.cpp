@@ -90,6 +90,13 @@ void registerDamarisParameters()
          "through via DamarisOutput::DamarisWriter::writeOutput)() to the "
          "damaris_write() call. This can be used to limit the number of "
          "variables being passed to the Damaris plugins (Paraview, Python and HDF5)");
+    Parameters::Register<Parameters::DamarisMaxWriteOverheadPercent>
+        ("Maximum percentage of simulation (compute) time that may be spent "
+         "passing data to the Damaris servers. When the previous write phase "
+         "exceeded this budget -- e.g. because the Damaris shared memory "
+         "buffer is full and damaris_write() blocks -- the next frame is "
+         "dropped instead of stalling the simulation. "
+         "Set to 0 (the default) to never drop frames.");
 }
 
 } // namespace Opm
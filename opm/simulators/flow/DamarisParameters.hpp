@@ -47,6 +47,7 @@ struct DamarisSharedMemorySizeBytes { static constexpr long value = 536870912; }
 struct DamarisLogLevel { static constexpr auto value = "info"; };
 struct DamarisDaskFile { static constexpr auto value = ""; };
 struct DamarisLimitVariables  { static constexpr auto value = ""; };
+struct DamarisMaxWriteOverheadPercent { static constexpr double value = 0.0; };
 
 } // namespace Opm::Parameters
 
@@ -46,9 +46,12 @@
 #include <opm/simulators/utils/GridDataOutput.hpp>
 #include <opm/simulators/utils/ParallelSerialization.hpp>
 
+#include <opm/models/parallel/threadedentityiterator.hh>
+
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -164,6 +167,9 @@ public:
         }
 
         wanted_vars_set_ = DamarisOutput::getSetOfIncludedVariables();
+
+        max_write_overhead_fraction_ =
+            Parameters::Get<Parameters::DamarisMaxWriteOverheadPercent>() / 100.0;
     }
 
     /*!
@@ -214,6 +220,31 @@ public:
             }
 
 
+            // Drop-frames-under-backpressure policy: damaris_write() blocks
+            // when the shared memory region is still occupied by frames the
+            // server processes have not consumed yet.  If the previous
+            // frame's write phase exceeded its wallclock budget relative to
+            // the compute time since then, drop this frame instead of
+            // letting visualization stall the simulation.  The decision is
+            // taken collectively so that all ranks agree on the frames that
+            // get published.
+            const auto frame_start = std::chrono::steady_clock::now();
+            int drop_frame = dropFrameUnderBackpressure_(frame_start) ? 1 : 0;
+            drop_frame = cc.max(drop_frame);
+            if (drop_frame) {
+                ++dropped_frames_;
+                // An unwritten frame leaves the shared memory budget to the
+                // frames already in flight, so the next one normally goes
+                // through again.
+                last_write_seconds_ = 0.0;
+                last_frame_end_ = std::chrono::steady_clock::now();
+                have_previous_frame_ = true;
+                OpmLog::debug(fmt::format(fmt::runtime("( rank:{}) Damaris backpressure: "
+                                                       "dropped frame for report step {} ({} dropped so far)."),
+                                          rank_, reportStepNum, dropped_frames_));
+                return;
+            }
+
             int cell_data_written = 0 ;
             // Call damaris_write() for all available variables
             for ( const auto& damVar : localCellData )
@@ -279,6 +310,10 @@ public:
             }
             DamarisOutput::handleError(dam_err_, cc, "endIteration()");
 
+            last_frame_end_ = std::chrono::steady_clock::now();
+            last_write_seconds_ = std::chrono::duration<double>(last_frame_end_ - frame_start).count();
+            have_previous_frame_ = true;
+
          } // end of ! isSubstep
     }
 
@@ -294,6 +329,24 @@ private:
     std::vector<unsigned long long> elements_rank_offsets_ ;
     bool damarisUpdate_ = false;  ///< Whenever this is true writeOutput() will set up Damaris mesh information and offsets of model fields
 
+    double max_write_overhead_fraction_ = 0.0; ///< Write-phase wallclock budget as fraction of compute time; 0 disables frame dropping
+    double last_write_seconds_ = 0.0;          ///< Duration of the previous frame's write phase
+    std::chrono::steady_clock::time_point last_frame_end_{};
+    bool have_previous_frame_ = false;
+    int dropped_frames_ = 0;
+
+    /// Whether the previous frame's write phase blew its wallclock budget
+    /// relative to the compute time since then.
+    bool dropFrameUnderBackpressure_(const std::chrono::steady_clock::time_point now) const
+    {
+        if (max_write_overhead_fraction_ <= 0.0 || !have_previous_frame_) {
+            return false;
+        }
+
+        const auto compute_seconds = std::chrono::duration<double>(now - last_frame_end_).count();
+        return last_write_seconds_ > max_write_overhead_fraction_ * compute_seconds;
+    }
+
     static bool enableDamarisOutput_()
     {
         static bool enable = Parameters::Get<Parameters::EnableDamarisOutput>();
@@ -444,38 +497,36 @@ private:
         damarisOutputModule_->allocBuffers(num_interior, reportStepNum,
                                       isSubStep, log, /*isRestart*/ false);
 
-        ElementContext elemCtx(simulator_);
         OPM_BEGIN_PARALLEL_TRY_CATCH();
         {
         OPM_TIMEBLOCK(prepareCellBasedData);
         damarisOutputModule_->setupExtractors(isSubStep, reportStepNum);
-        for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
-            elemCtx.updatePrimaryStencil(elem);
-            elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
 
-            damarisOutputModule_->processElement(elemCtx);
-        }
-        damarisOutputModule_->clearExtractors();
-        }
-        {
-        OPM_TIMEBLOCK(prepareBlockData);
-        for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
-            elemCtx.updatePrimaryStencil(elem);
-            elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-            damarisOutputModule_->processElementBlockData(elemCtx);
-        }
-        }
-        {
-        OPM_TIMEBLOCK(prepareFluidInPlace);
+        // Single sweep for both the cell and the block data, threaded the
+        // same way as in EclWriter::prepareLocalCellData().
+        ThreadedEntityIterator<GridView, /*codim=*/0> threadedElemIt(gridView);
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel
 #endif
-        for (int dofIdx=0; dofIdx < num_interior; ++dofIdx){
-                const auto& intQuants = *(simulator_.model().cachedIntensiveQuantities(dofIdx, /*timeIdx=*/0));
-                const auto totVolume = simulator_.model().dofTotalVolume(dofIdx);
-                damarisOutputModule_->updateFluidInPlace(dofIdx, intQuants, totVolume);
+        {
+            ElementContext elemCtx(simulator_);
+            auto elemIt = threadedElemIt.beginParallel();
+            for (; !threadedElemIt.isFinished(elemIt); elemIt = threadedElemIt.increment()) {
+                if (elemIt->partitionType() != Dune::InteriorEntity) {
+                    continue;
+                }
+
+                elemCtx.updatePrimaryStencil(*elemIt);
+                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
+
+                damarisOutputModule_->processElement(elemCtx);
+                damarisOutputModule_->processElementBlockData(elemCtx);
+            }
         }
+        damarisOutputModule_->clearExtractors();
         }
+        // The fluid-in-place quantities are accumulated inside
+        // processElement(), riding along the cell-based sweep above.
         damarisOutputModule_->validateLocalData();
         OPM_END_PARALLEL_TRY_CATCH("DamarisWriter::prepareLocalCellData() failed: ", simulator_.vanguard().grid().comm());
     }
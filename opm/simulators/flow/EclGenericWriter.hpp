@@ -80,7 +80,11 @@ public:
                      const Dune::CartesianIndexMapper<Grid>& cartMapper,
                      const Dune::CartesianIndexMapper<EquilGrid>* equilCartMapper,
                      bool enableAsyncOutput,
-                     bool enableEsmry);
+                     bool enableEsmry,
+                     int subStepOutputBatchSize = 1,
+                     int restartOutputBatchSize = 1);
+
+    ~EclGenericWriter();
 
     const EclipseIO& eclIO() const;
 
@@ -151,6 +155,9 @@ protected:
                      SummaryState&                                        summaryState,
                      UDQState&                                            udqState);
 
+    /// Hand all buffered substep output requests over to the output thread.
+    void flushPendingOutput();
+
     CollectDataOnIORankType collectOnIORank_;
     const Grid& grid_;
     const GridView& gridView_;
@@ -166,6 +173,20 @@ protected:
     SimulatorReportSingle sub_step_report_;
     SimulatorReport simulation_report_;
 
+    /// Substep output requests buffered in memory; written in one sequential
+    /// burst once the buffer holds subStepOutputBatchSize_ requests or a
+    /// report step output request arrives.  With restart batching enabled
+    /// report step requests join the same FIFO buffer, so the on-disk order
+    /// of the records is always preserved.
+    std::vector<std::shared_ptr<TaskletInterface>> pendingOutputTasklets_;
+    int subStepOutputBatchSize_ = 1;
+
+    /// Number of report step (restart) output requests to accumulate in
+    /// memory before writing them to the unified restart file in one
+    /// sequential burst, and the count currently buffered.
+    int restartOutputBatchSize_ = 1;
+    int pendingReportStepCount_ = 0;
+
     // Regular NNCs per grid: internal to a grid.
     // Both cells belong to the same level grid, either the main grid or a level/local grid.
     // nnc.cell1 (NNC1 in *.EGRID) Level/Local Cartesian index of cell1
@@ -189,21 +210,35 @@ protected:
     mutable std::unique_ptr<std::vector<data::Solution>> outputTrans_;
 
 private:
-    template<typename LevelIndicesFunction, typename OriginIndicesFunction>
+    /// Per-leaf-element index tuple, precomputed once per grid change so
+    /// the element loops in computeTrans_() and exportNncStructure_()
+    /// can translate leaf indices with flat array reads instead of
+    /// repeating the multi-level index translation per element access.
+    struct LevelIndexTuple
+    {
+        int level;         //!< refinement level the element belongs to
+        int levelCartIdx;  //!< Cartesian index within the element's level grid
+        int originCartIdx; //!< Cartesian index of the level-zero ancestor cell
+    };
+
+    /// Build the flattened per-element index tuples, ordered by leaf
+    /// element index.
+    ///
+    /// @tparam equilGridIsCpGrid Compile-time flag indicating whether the equilGrid_ is a Dune::CpGrid
+    ///                           (std::is_same_v<EquilGrid, Dune::CpGrid>).
+    template <bool equilGridIsCpGrid>
+    std::vector<LevelIndexTuple>
+    buildLevelIndexTuples_(const std::function<int(int, int)>& computeLevelCartIdx) const;
+
     void computeTrans_(const std::vector<std::unordered_map<int,int>>& levelCartToLevelCompressed,
                        const std::function<unsigned int(unsigned int)>& map,
-                       const LevelIndicesFunction& computeLevelIndices,
-                       const std::function<int(int, int)>& computeLevelCartIdx,
-                       const std::function<std::array<int,3>(int)>& computeLevelCartDimensions,
-                       const OriginIndicesFunction& computeOriginIndices) const;
+                       const std::vector<LevelIndexTuple>& levelIndexTuples,
+                       const std::vector<std::array<int,3>>& levelCartDims) const;
 
-    template<typename LevelIndicesFunction, typename OriginIndicesFunction>
     std::vector<std::vector<NNCdata>> exportNncStructure_(const std::vector<std::unordered_map<int,int>>& levelCartToLevelCompressed,
                                                           const std::function<unsigned int(unsigned int)>& map,
-                                                          const LevelIndicesFunction& computeLevelIndices,
-                                                          const std::function<int(int, int)>& computeLevelCartIdx,
-                                                          const std::function<std::array<int,3>(int)>& computeLevelCartDimensions,
-                                                          const OriginIndicesFunction& computeOriginIndices) const;
+                                                          const std::vector<LevelIndexTuple>& levelIndexTuples,
+                                                          const std::vector<std::array<int,3>>& levelCartDims) const;
 
     /// Returns true if cells (belonging to the same level grid) are (level) Cartesian neighbors (share a face)
     bool isCartesianNeighbour_(const std::array<int,3>& levelCartDims,
@@ -264,20 +299,6 @@ private:
     std::function<int(int, int)> computeLevelCartIdx_(const Opm::LevelCartesianIndexMapper<EquilGrid>& levelCartMapp,
                                                       const Dune::CartesianIndexMapper<EquilGrid>& equilCartMapp) const;
 
-    /// Return function to compute level (local/compressed) indices of the cells adjacent to an intersection.
-    ///
-    /// @tparam equilGridIsCpGrid Compile-time flag indicating whether the equilGrid_ is a Dune::CpGrid
-    ///                           (std::is_same_v<EquilGrid, Dune::CpGrid>).
-    template <bool equilGridIsCpGrid>
-    auto computeLevelIndices_() const;
-
-    /// Return function to compute origin indices of the cells adjacent to an intersection.
-    ///
-    /// @tparam equilGridIsCpGrid Compile-time flag indicating whether the equilGrid_ is a Dune::CpGrid
-    ///                           (std::is_same_v<EquilGrid, Dune::CpGrid>).
-    template <bool equilGridIsCpGrid>
-    auto computeOriginIndices_() const;
-
     /// Creates/allocates CellData for TRANX/Y/Z for level grids.
     /// Only for CpGrid. Other grid types do not support refinement yet.
     void allocateLevelTrans_(const std::array<int,3>& levelCartDims,
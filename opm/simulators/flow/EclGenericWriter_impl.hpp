@@ -62,6 +62,7 @@
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <memory>
@@ -220,7 +221,9 @@ EclGenericWriter(const Schedule& schedule,
                  const Dune::CartesianIndexMapper<Grid>& cartMapper,
                  const Dune::CartesianIndexMapper<EquilGrid>* equilCartMapper,
                  bool enableAsyncOutput,
-                 bool enableEsmry )
+                 bool enableEsmry,
+                 int subStepOutputBatchSize,
+                 int restartOutputBatchSize)
     : collectOnIORank_(grid,
                        equilGrid,
                        gridView,
@@ -253,6 +256,33 @@ EclGenericWriter(const Schedule& schedule,
     }
 
     this->taskletRunner_.reset(new TaskletRunner(numWorkerThreads));
+
+    // Batching output only makes sense where the output happens.
+    if (collectOnIORank_.isIORank()) {
+        this->subStepOutputBatchSize_ = std::max(subStepOutputBatchSize, 1);
+        this->restartOutputBatchSize_ = std::max(restartOutputBatchSize, 1);
+    }
+}
+
+template<class Grid, class EquilGrid, class GridView, class ElementMapper, class Scalar>
+EclGenericWriter<Grid,EquilGrid,GridView,ElementMapper,Scalar>::
+~EclGenericWriter()
+{
+    // Write out whatever is still buffered; with restart batching enabled
+    // the buffer regularly holds the results of the last few report steps.
+    this->flushPendingOutput();
+}
+
+template<class Grid, class EquilGrid, class GridView, class ElementMapper, class Scalar>
+void EclGenericWriter<Grid,EquilGrid,GridView,ElementMapper,Scalar>::
+flushPendingOutput()
+{
+    for (auto& tasklet : this->pendingOutputTasklets_) {
+        this->taskletRunner_->dispatch(std::move(tasklet));
+    }
+
+    this->pendingOutputTasklets_.clear();
+    this->pendingReportStepCount_ = 0;
 }
 
 template<class Grid, class EquilGrid, class GridView, class ElementMapper, class Scalar>
@@ -290,15 +320,23 @@ extractOutputTransAndNNC(const std::function<unsigned int(unsigned int)>& map)
 
         const auto levelCartMapp = this->createLevelCartMapp_<equilGridIsCpGrid>();
         const auto levelCartToLevelCompressed = this->createCartesianToActiveMaps_<equilGridIsCpGrid>(levelCartMapp);
-        auto computeLevelIndices = this->computeLevelIndices_<equilGridIsCpGrid>();
         auto computeLevelCartIdx = this->computeLevelCartIdx_<equilGridIsCpGrid>(levelCartMapp, *(this->equilCartMapper_));
         auto computeLevelCartDimensions = this->computeLevelCartDimensions_<equilGridIsCpGrid>(levelCartMapp, *(this->equilCartMapper_));
-        auto computeOriginIndices = this->computeOriginIndices_<equilGridIsCpGrid>();
 
-        computeTrans_(levelCartToLevelCompressed, map, computeLevelIndices,
-                      computeLevelCartIdx, computeLevelCartDimensions, computeOriginIndices);
-        exportNncStructure_(levelCartToLevelCompressed, map, computeLevelIndices, computeLevelCartIdx,
-                            computeLevelCartDimensions, computeOriginIndices);
+        // Flatten the multi-level index translation into one tuple per
+        // leaf element up front; the element loops below then run at the
+        // same per-element cost as on an unrefined grid.
+        const auto levelIndexTuples = this->buildLevelIndexTuples_<equilGridIsCpGrid>(computeLevelCartIdx);
+
+        const int maxLevel = this->equilGrid_->maxLevel();
+        std::vector<std::array<int,3>> levelCartDims;
+        levelCartDims.reserve(maxLevel + 1);
+        for (int level = 0; level <= maxLevel; ++level) {
+            levelCartDims.push_back(computeLevelCartDimensions(level));
+        }
+
+        computeTrans_(levelCartToLevelCompressed, map, levelIndexTuples, levelCartDims);
+        exportNncStructure_(levelCartToLevelCompressed, map, levelIndexTuples, levelCartDims);
     }
 
 #if HAVE_MPI
@@ -407,50 +445,39 @@ computeLevelCartIdx_(const Opm::LevelCartesianIndexMapper<EquilGrid>& levelCartM
 
 template<class Grid, class EquilGrid, class GridView, class ElementMapper, class Scalar>
 template <bool equilGridIsCpGrid>
-auto
+std::vector<typename EclGenericWriter<Grid,EquilGrid,GridView,ElementMapper,Scalar>::LevelIndexTuple>
 EclGenericWriter<Grid,EquilGrid,GridView,ElementMapper,Scalar>::
-computeLevelIndices_() const
+buildLevelIndexTuples_(const std::function<int(int, int)>& computeLevelCartIdx) const
 {
-    if constexpr (equilGridIsCpGrid) {
-        return [](const auto& intersection,
-                  const auto&,
-                  const auto&)
-        {
-            return std::pair{intersection.inside().getLevelElem().index(), intersection.outside().getLevelElem().index()};
-        };
-    }
-    else {
-        return [](const auto&,
-                  const auto& intersectionInsideLeafIdx,
-                  const auto& intersectionOutsideLeafIdx)
-        {
-            return std::pair{intersectionInsideLeafIdx, intersectionOutsideLeafIdx};
-        };
-    }
-}
+    using GlobalGridView = typename EquilGrid::LeafGridView;
+    using GlobElementMapper = Dune::MultipleCodimMultipleGeomTypeMapper<GlobalGridView>;
+    const GlobalGridView& globalGridView = this->equilGrid_->leafGridView();
+    const GlobElementMapper globalElemMapper { globalGridView, Dune::mcmgElementLayout() };
 
-template<class Grid, class EquilGrid, class GridView, class ElementMapper, class Scalar>
-template <bool equilGridIsCpGrid>
-auto
-EclGenericWriter<Grid,EquilGrid,GridView,ElementMapper,Scalar>::
-computeOriginIndices_() const
-{
-    if constexpr (equilGridIsCpGrid) {
-        return [](const auto& intersection,
-                  const auto&,
-                  const auto&)
-        {
-            return std::pair{intersection.inside().getOrigin().index(), intersection.outside().getOrigin().index()};
-        };
-    }
-    else {
-        return [](const auto&,
-                  const auto& intersectionInsideLeafIdx,
-                  const auto& intersectionOutsideLeafIdx)
-        {
-            return std::pair{intersectionInsideLeafIdx, intersectionOutsideLeafIdx};
-        };
+    std::vector<LevelIndexTuple> tuples(globalGridView.size(0));
+
+    for (const auto& elem : elements(globalGridView)) {
+        const auto leafIdx = globalElemMapper.index(elem);
+
+        if constexpr (equilGridIsCpGrid) {
+            // For CpGrid with LGRs, the level and leaf indices do not
+            // coincide, and the origin cell index refers to the coarsest
+            // ancestor cell when the cell is refined. For cells not
+            // involved in any refinement, it corresponds to the
+            // geometrically equivalent cell in the level-zero grid.
+            const int level = elem.level();
+            tuples[leafIdx] = { level,
+                                computeLevelCartIdx(elem.getLevelElem().index(), level),
+                                computeLevelCartIdx(elem.getOrigin().index(), /* level = */ 0) };
+        }
+        else {
+            // refinement only supported for CpGrid for now
+            const int cartIdx = computeLevelCartIdx(leafIdx, /* level = */ 0);
+            tuples[leafIdx] = { /* level = */ 0, cartIdx, cartIdx };
+        }
     }
+
+    return tuples;
 }
 
 template<class Grid, class EquilGrid, class GridView, class ElementMapper, class Scalar>
@@ -474,15 +501,12 @@ allocateLevelTrans_(const std::array<int,3>& levelCartDims,
 }
 
 template<class Grid, class EquilGrid, class GridView, class ElementMapper, class Scalar>
-template<typename LevelIndicesFunction, typename OriginIndicesFunction>
 void
 EclGenericWriter<Grid,EquilGrid,GridView,ElementMapper,Scalar>::
 computeTrans_(const std::vector<std::unordered_map<int,int>>&  levelCartToLevelCompressed,
               const std::function<unsigned int(unsigned int)>& map,
-              const LevelIndicesFunction& computeLevelIndices,
-              const std::function<int(int, int)>& computeLevelCartIdx,
-              const std::function<std::array<int,3>(int)>& computeLevelCartDims,
-              const OriginIndicesFunction& computeOriginIndices) const
+              const std::vector<LevelIndexTuple>& levelIndexTuples,
+              const std::vector<std::array<int,3>>& levelCartDims) const
 {
     if (!outputTrans_) {
         outputTrans_ = std::make_unique<std::vector<data::Solution>>(std::vector<data::Solution>{});
@@ -499,7 +523,7 @@ computeTrans_(const std::vector<std::unordered_map<int,int>>&  levelCartToLevelC
     outputTrans_->resize(maxLevel+1); // including level zero grid
 
     for (int level = 0; level <= maxLevel; ++level) {
-        allocateLevelTrans_(computeLevelCartDims(level), this->outputTrans_->at(level));
+        allocateLevelTrans_(levelCartDims[level], this->outputTrans_->at(level));
     }
 
     for (const auto& elem : elements(globalGridView)) {
@@ -517,22 +541,13 @@ computeTrans_(const std::vector<std::unordered_map<int,int>>&  levelCartToLevelC
             if (c1 > c2)
                 continue; // we only need to handle each connection once, thank you.
 
-            int level = is.inside().level();
+            const int level = levelIndexTuples[c1].level;
 
-            // For CpGrid with LGRs, level*Idx and c* do not coincide.
-            const auto& [levelInIdx, levelOutIdx] = computeLevelIndices(is, c1, c2);
+            const int levelCartIdxIn = levelIndexTuples[c1].levelCartIdx;
+            const int levelCartIdxOut = levelIndexTuples[c2].levelCartIdx;
 
-            const int levelCartIdxIn = computeLevelCartIdx(levelInIdx, level);
-            const int levelCartIdxOut = computeLevelCartIdx(levelOutIdx, level);
-
-            // For CpGrid with LGRs, the origin cell index refers to the coarsest
-            // ancestor cell when the cell is refined. For cells not involved in
-            // any refinement, it corresponds to the geometrically equivalent
-            // cell in the level-zero grid.
-            const auto [originInIdx, originOutIdx] = computeOriginIndices(is, c1, c2);
-
-            const auto originCartIdxIn = computeLevelCartIdx(originInIdx, /* level = */ 0);
-            const auto originCartIdxOut = computeLevelCartIdx(originOutIdx, /* level = */ 0);
+            const auto originCartIdxIn = levelIndexTuples[c1].originCartIdx;
+            const auto originCartIdxOut = levelIndexTuples[c2].originCartIdx;
 
             // For level-zero grid, level Cartesian indices coincide with the grid Cartesian indices.
             if (isNumAquCell_(originCartIdxIn) || isNumAquCell_(originCartIdxOut)) {
@@ -548,7 +563,7 @@ computeTrans_(const std::vector<std::unordered_map<int,int>>&  levelCartToLevelC
             const auto minLevelCartIdx = std::min(levelCartIdxIn, levelCartIdxOut);
             const auto maxLevelCartIdx = std::max(levelCartIdxIn, levelCartIdxOut);
 
-            const auto& levelCartDims = computeLevelCartDims(level);
+            const auto& cartDims = levelCartDims[level];
 
             // Re-ordering in case of non-empty mapping between equilGrid to grid
             if (map) {
@@ -556,18 +571,18 @@ computeTrans_(const std::vector<std::unordered_map<int,int>>&  levelCartToLevelC
                 c2 = map(c2);
             }
 
-            if (maxLevelCartIdx - minLevelCartIdx == 1 && levelCartDims[0] > 1 ) {
+            if (maxLevelCartIdx - minLevelCartIdx == 1 && cartDims[0] > 1 ) {
                 outputTrans_->at(level).at("TRANX").template data<double>()[minLevelCartIdx] = globalTrans().transmissibility(c1, c2);
                 continue; // skip other if clauses as they are false, last one needs some computation
             }
 
-            if (maxLevelCartIdx - minLevelCartIdx == levelCartDims[0] && levelCartDims[1] > 1) {
+            if (maxLevelCartIdx - minLevelCartIdx == cartDims[0] && cartDims[1] > 1) {
                 outputTrans_->at(level).at("TRANY").template data<double>()[minLevelCartIdx] = globalTrans().transmissibility(c1, c2);
                 continue; // skipt next if clause as it needs some computation
             }
 
-            if ( maxLevelCartIdx - minLevelCartIdx == levelCartDims[0]*levelCartDims[1] ||
-                 directVerticalNeighbors(levelCartDims,
+            if ( maxLevelCartIdx - minLevelCartIdx == cartDims[0]*cartDims[1] ||
+                 directVerticalNeighbors(cartDims,
                                          levelCartToLevelCompressed[level],
                                          minLevelCartIdx,
                                          maxLevelCartIdx)) {
@@ -642,15 +657,12 @@ allocateAllNncs_(int maxLevel) const
 }
 
 template<class Grid, class EquilGrid, class GridView, class ElementMapper, class Scalar>
-template<typename LevelIndicesFunction, typename OriginIndicesFunction>
 std::vector<std::vector<NNCdata>>
 EclGenericWriter<Grid,EquilGrid,GridView,ElementMapper,Scalar>::
 exportNncStructure_(const std::vector<std::unordered_map<int,int>>& levelCartToLevelCompressed,
                     const std::function<unsigned int(unsigned int)>& map,
-                    const LevelIndicesFunction& computeLevelIndices,
-                    const std::function<int(int, int)>& computeLevelCartIdx,
-                    const std::function<std::array<int,3>(int)>& computeLevelCartDims,
-                    const OriginIndicesFunction& computeOriginIndices) const
+                    const std::vector<LevelIndexTuple>& levelIndexTuples,
+                    const std::vector<std::array<int,3>>& levelCartDims) const
 {
     const auto& nncData = this->eclState_.getInputNNC().input();
     const auto& unitSystem = this->eclState_.getDeckUnitSystem();
@@ -721,15 +733,12 @@ exportNncStructure_(const std::vector<std::unordered_map<int,int>>& levelCartToL
             if (c1 > c2)
                 continue; // we only need to handle each connection once, thank you.
 
-            if ( is.inside().level() != is.outside().level() ) { // TRANGL and TRANLL
-                // For CpGrid with LGRs, level*Idx and c* do not coincide.
-                const auto& [levelInIdx, levelOutIdx] = computeLevelIndices(is, c1, c2);
+            if ( levelIndexTuples[c1].level != levelIndexTuples[c2].level ) { // TRANGL and TRANLL
+                const int levelIn = levelIndexTuples[c1].level;
+                const int levelOut = levelIndexTuples[c2].level;
 
-                const int levelIn = is.inside().level();
-                const int levelOut = is.outside().level();
-
-                auto levelCartIdxIn = computeLevelCartIdx(levelInIdx, levelIn);
-                auto levelCartIdxOut = computeLevelCartIdx(levelOutIdx, levelOut);
+                auto levelCartIdxIn = levelIndexTuples[c1].levelCartIdx;
+                auto levelCartIdxOut = levelIndexTuples[c2].levelCartIdx;
 
                 // To store correctly and only once the corresponding NNC
                 std::pair<int,int> smallerPair = {levelIn, levelCartIdxIn},
@@ -764,23 +773,13 @@ exportNncStructure_(const std::vector<std::unordered_map<int,int>>& levelCartToL
             }
             else {
                 // the cells sharing the intersection belong to the same level
-                assert(is.inside().level() == is.outside().level());
-                const int level = is.inside().level();
-
-                // For CpGrid with LGRs, the origin cell index refers to the coarsest
-                // ancestor cell when the cell is refined. For cells not involved in
-                // any refinement, it corresponds to the geometrically equivalent
-                // cell in the level-zero grid.
-                const auto [originInIdx, originOutIdx] = computeOriginIndices(is, c1, c2);
+                const int level = levelIndexTuples[c1].level;
 
-                const std::size_t originCartIdxIn = computeLevelCartIdx(originInIdx, /* level = */ 0);
-                const std::size_t originCartIdxOut = computeLevelCartIdx(originOutIdx, /* level = */ 0);
+                const std::size_t originCartIdxIn = levelIndexTuples[c1].originCartIdx;
+                const std::size_t originCartIdxOut = levelIndexTuples[c2].originCartIdx;
 
-                // For CpGrid with LGRs, level*Idx and c* do not coincide.
-                const auto& [levelInIdx, levelOutIdx] = computeLevelIndices(is, c1, c2);
-
-                auto levelCartIdxIn = computeLevelCartIdx(levelInIdx, level);
-                auto levelCartIdxOut = computeLevelCartIdx(levelOutIdx, level);
+                auto levelCartIdxIn = levelIndexTuples[c1].levelCartIdx;
+                auto levelCartIdxOut = levelIndexTuples[c2].levelCartIdx;
 
                 if ( levelCartIdxOut < levelCartIdxIn )
                     std::swap(levelCartIdxIn, levelCartIdxOut);
@@ -791,14 +790,12 @@ exportNncStructure_(const std::vector<std::unordered_map<int,int>>& levelCartToL
                     c2 = map(c2);
                 }
 
-                const auto& levelCartDims = computeLevelCartDims(level);
-
                 // Check there are no refined aquifer connections
                 assert(!isNumAquConn_(originCartIdxIn, originCartIdxOut) || level == 0);
 
                 if (isNumAquConn_(originCartIdxIn, originCartIdxOut) ||
                     ! isDirectNeighbours_(levelCartToLevelCompressed[level],
-                                          levelCartDims,
+                                          levelCartDims[level],
                                           levelCartIdxIn, levelCartIdxOut)) {
                     // We need to check whether an NNC for this face was also
                     // specified via the NNC keyword in the deck.
@@ -923,10 +920,12 @@ doWriteOutput(const int                          reportStepNum,
         restartValues.push_back(std::move(restartValue)); // no LGRs-> only one restart value
     }
 
-    // make sure that the previous I/O request has been completed
-    // and the number of incomplete tasklets does not increase between
-    // time steps
-    this->taskletRunner_->barrier();
+    // The restart data for this step has been snapshotted into the tasklet
+    // below, so the previous I/O request may still be in flight while the
+    // next time step starts; only apply backpressure when a second request
+    // is still incomplete so that at most two output buffers exist at any
+    // time.
+    this->taskletRunner_->waitForPending(1);
 
     // check if there might have been a failure in the TaskletRunner
     if (this->taskletRunner_->failure()) {
@@ -940,6 +939,38 @@ doWriteOutput(const int                          reportStepNum,
         summaryState, udqState, *this->eclIO_,
         reportStepNum, timeStepNum, isSubStep, curTime, std::move(restartValues), doublePrecision);
 
+    if (isSubStep && this->subStepOutputBatchSize_ > 1) {
+        // Substep output only appends summary records, so the write can be
+        // deferred: buffer the request and hand the whole batch to the
+        // output thread in one go.  Writing the records in one sequential
+        // burst keeps the number of separate append-and-flush cycles down,
+        // which matters on network file systems.
+        this->pendingOutputTasklets_.push_back(std::move(eclWriteTasklet));
+        if (this->pendingOutputTasklets_.size() >=
+            static_cast<std::size_t>(this->subStepOutputBatchSize_))
+        {
+            this->flushPendingOutput();
+        }
+        return;
+    }
+
+    if (this->restartOutputBatchSize_ > 1) {
+        // Report step output (which carries the restart arrays) can be
+        // deferred as well: keep the snapshotted restart values of up to
+        // restartOutputBatchSize_ report steps in memory and write them to
+        // the unified restart file in one sequential burst.  The request
+        // joins the same FIFO buffer as any pending substep records, so
+        // the on-disk record order is unchanged.
+        this->pendingOutputTasklets_.push_back(std::move(eclWriteTasklet));
+        if (++this->pendingReportStepCount_ >= this->restartOutputBatchSize_) {
+            this->flushPendingOutput();
+        }
+        return;
+    }
+
+    // Report step output must observe all buffered substep records first.
+    this->flushPendingOutput();
+
     // finally, start a new output writing job
     this->taskletRunner_->dispatch(std::move(eclWriteTasklet));
 }
@@ -1005,16 +1036,22 @@ evalSummary(const int                                            reportStepNum,
         // step we are currently on.
         const auto udq_step = reportStepNum - 1;
 
-        this->schedule_[udq_step].udq()
-            .eval(udq_step,
-                  this->schedule_.wellMatcher(udq_step),
-                  this->schedule_[udq_step].group_order(),
-                  this->schedule_.segmentMatcherFactory(udq_step),
-                  [es = std::cref(this->eclState_)]() {
-                      return std::make_unique<RegionSetMatcher>
-                          (es.get().fipRegionStatistics());
-                  },
-                  summaryState, udqState);
+        // Skip the UDQ machinery when the run defines no UDQs.  This runs
+        // for every accepted substep and constructing the well matcher is
+        // not free even when there is nothing to evaluate.
+        if (const auto& udqConfig = this->schedule_[udq_step].udq();
+            udqConfig.size() > 0)
+        {
+            udqConfig.eval(udq_step,
+                           this->schedule_.wellMatcher(udq_step),
+                           this->schedule_[udq_step].group_order(),
+                           this->schedule_.segmentMatcherFactory(udq_step),
+                           [es = std::cref(this->eclState_)]() {
+                               return std::make_unique<RegionSetMatcher>
+                                   (es.get().fipRegionStatistics());
+                           },
+                           summaryState, udqState);
+        }
     }
 
 #if HAVE_MPI
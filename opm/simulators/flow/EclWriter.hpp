@@ -43,13 +43,16 @@
 #include <opm/models/blackoil/blackoilenergymodules.hh>
 #include <opm/models/blackoil/blackoilproperties.hh> // Properties::EnableMech, EnableSolvent
 #include <opm/models/common/multiphasebaseproperties.hh> // Properties::FluidSystem
+#include <opm/models/parallel/threadedentityiterator.hh>
 
 #include <opm/simulators/flow/CollectDataOnIORank.hpp>
 #include <opm/simulators/flow/countGlobalCells.hpp>
 #include <opm/simulators/flow/EclGenericWriter.hpp>
 #include <opm/simulators/flow/FlowBaseVanguard.hpp>
+#include <opm/simulators/flow/GenericOutputBlackoilModule.hpp>
 #include <opm/simulators/timestepping/SimulatorTimer.hpp>
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
+#include <opm/simulators/utils/ParallelCommunication.hpp>
 #include <opm/simulators/utils/ParallelRestart.hpp>
 #include <opm/simulators/utils/ParallelSerialization.hpp>
 
@@ -79,6 +82,14 @@ struct EnableWriteAllSolutions { static constexpr bool value = false; };
 // Write ESMRY file for fast loading of summary data
 struct EnableEsmry { static constexpr bool value = true; };
 
+// Number of substep (summary) output requests to buffer in memory and
+// write to disk in one sequential burst
+struct EclOutputSubStepBatchSize { static constexpr int value = 1; };
+
+// Number of report step (restart) output requests to buffer in memory
+// and write to disk in one sequential burst
+struct EclOutputRestartBatchSize { static constexpr int value = 1; };
+
 } // namespace Opm::Parameters
 
 namespace Opm::Action {
@@ -145,6 +156,20 @@ public:
              "(i.e., using a separate thread).");
         Parameters::Register<Parameters::EnableEsmry>
             ("Write ESMRY file for fast loading of summary data.");
+        Parameters::Register<Parameters::EclOutputSubStepBatchSize>
+            ("Number of substep summary output requests that are buffered in "
+             "memory and written to the summary file in one sequential burst. "
+             "The buffer is always flushed at report steps. Values larger than "
+             "one reduce the impact of file system latency at the cost of "
+             "buffering memory.");
+        Parameters::Register<Parameters::EclOutputRestartBatchSize>
+            ("Number of report step output requests (restart arrays and "
+             "report step summary records) that are buffered in memory and "
+             "written to disk in one sequential burst. The restart file on "
+             "disk lags behind the simulation by up to this many report "
+             "steps until the buffer is flushed, at the latest at the end "
+             "of the run. Intended for decks that write restart "
+             "information at every report step.");
     }
 
     // The Simulator object should preferably have been const - the
@@ -164,7 +189,9 @@ public:
                     ? &simulator.vanguard().equilCartesianIndexMapper()
                     : nullptr),
                    Parameters::Get<Parameters::EnableAsyncEclOutput>(),
-                   Parameters::Get<Parameters::EnableEsmry>())
+                   Parameters::Get<Parameters::EnableEsmry>(),
+                   Parameters::Get<Parameters::EclOutputSubStepBatchSize>(),
+                   Parameters::Get<Parameters::EclOutputRestartBatchSize>())
         , simulator_(simulator)
     {
 #if HAVE_MPI
@@ -188,6 +215,16 @@ public:
         this->rank_ = this->simulator_.vanguard().grid().comm().rank();
 
         this->simulator_.vanguard().eclState().computeFipRegionStatistics();
+
+        if (Parameters::Get<Parameters::EclOutputDoublePrecision>() &&
+            Parameters::Get<Parameters::EclOutputSinglePrecisionPipeline>() &&
+            this->rank_ == 0)
+        {
+            OpmLog::warning("Both double precision restart output and the "
+                            "single precision output pipeline are requested; "
+                            "the restart file will contain the arrays "
+                            "upcast from single precision.");
+        }
     }
 
     ~EclWriter()
@@ -481,6 +518,7 @@ public:
             // output.  There's consequently no need to collect those
             // properties on the I/O rank.
 
+            const Parallel::WaitTimer waitTimer(Parallel::WaitClass::Output);
             this->collectOnIORank_.collect(localCellData,
                                            this->outputModule_->getBlockData(),
                                            this->outputModule_->getExtraBlockData(),
@@ -771,39 +809,43 @@ private:
                          isSubStep && !Parameters::Get<Parameters::EnableWriteAllSolutions>(),
                          log, /*isRestart*/ false);
 
-        ElementContext elemCtx(simulator_);
-
         OPM_BEGIN_PARALLEL_TRY_CATCH();
 
         {
             OPM_TIMEBLOCK(prepareCellBasedData);
 
+            // The fluid-in-place quantities are accumulated inside
+            // processElement(), riding along this sweep instead of a
+            // separate pass over the cached intensive quantities.
             this->outputModule_->prepareDensityAccumulation();
             this->outputModule_->setupExtractors(isSubStep, reportStepNum);
-            for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
-                elemCtx.updatePrimaryStencil(elem);
-                elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
-
-                this->outputModule_->processElement(elemCtx);
-                this->outputModule_->processElementBlockData(elemCtx);
-            }
-            this->outputModule_->clearExtractors();
-
-            this->outputModule_->accumulateDensityParallel();
-        }
-
-        {
-            OPM_TIMEBLOCK(prepareFluidInPlace);
 
+            // The per-cell extraction work is independent--all
+            // contributions are either per-cell buffer writes or go into
+            // per-thread partial sums--so the sweep can be threaded the
+            // same way as the intensive quantity updates.
+            ThreadedEntityIterator<GridView, /*codim=*/0> threadedElemIt(gridView);
 #ifdef _OPENMP
-#pragma omp parallel for
+#pragma omp parallel
 #endif
-            for (int dofIdx = 0; dofIdx < num_interior; ++dofIdx) {
-                const auto& intQuants = *simulator_.model().cachedIntensiveQuantities(dofIdx, /*timeIdx=*/0);
-                const auto totVolume = simulator_.model().dofTotalVolume(dofIdx);
+            {
+                ElementContext elemCtx(simulator_);
+                auto elemIt = threadedElemIt.beginParallel();
+                for (; !threadedElemIt.isFinished(elemIt); elemIt = threadedElemIt.increment()) {
+                    if (elemIt->partitionType() != Dune::InteriorEntity) {
+                        continue;
+                    }
+
+                    elemCtx.updatePrimaryStencil(*elemIt);
+                    elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
 
-                this->outputModule_->updateFluidInPlace(dofIdx, intQuants, totVolume);
+                    this->outputModule_->processElement(elemCtx);
+                    this->outputModule_->processElementBlockData(elemCtx);
+                }
             }
+            this->outputModule_->clearExtractors();
+
+            this->outputModule_->accumulateDensityParallel();
         }
 
         this->outputModule_->validateLocalData();
@@ -836,7 +878,28 @@ private:
 
         OPM_BEGIN_PARALLEL_TRY_CATCH();
 
+        if (this->interRegFlowCellMask_.empty()) {
+            // The region definition arrays do not change during the run,
+            // so the set of cells with inter-region connections is
+            // computed once, on the first capture.  Only the stencils are
+            // needed for this, not the intensive/extensive quantities.
+            this->interRegFlowCellMask_.assign(gridView.size(/*codim=*/0), false);
+
+            for (const auto& elem : elements(gridView, Dune::Partitions::interiorBorder)) {
+                elemCtx.updateStencil(elem);
+
+                this->outputModule_->markInterRegionCells(elemCtx, activeIndex,
+                                                          this->interRegFlowCellMask_);
+            }
+        }
+
         for (const auto& elem : elements(gridView, Dune::Partitions::interiorBorder)) {
+            if (! this->interRegFlowCellMask_[elemMapper.index(elem)]) {
+                // All of this cell's connections are internal to a region
+                // in every region set.
+                continue;
+            }
+
             elemCtx.updateStencil(elem);
             elemCtx.updateIntensiveQuantities(timeIdx);
             elemCtx.updateExtensiveQuantities(timeIdx);
@@ -900,6 +963,10 @@ private:
     Scalar restartTimeStepSize_;
     int rank_ ;
     Inplace inplace_;
+
+    //! \brief Cells with at least one inter-region connection in some
+    //! region set.  Computed on the first flux capture, empty until then.
+    std::vector<bool> interRegFlowCellMask_;
 };
 
 } // namespace Opm
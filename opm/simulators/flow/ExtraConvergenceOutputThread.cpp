@@ -19,6 +19,8 @@
 
 #include <opm/simulators/flow/ExtraConvergenceOutputThread.hpp>
 
+#include <opm/common/OpmLog/OpmLog.hpp>
+
 #include <opm/simulators/flow/ConvergenceOutputConfiguration.hpp>
 
 #include <opm/simulators/timestepping/ConvergenceReport.hpp>
@@ -48,6 +50,8 @@
 #include <utility>
 #include <vector>
 
+#include <fmt/format.h>
+
 namespace {
 
     auto fixedHeaders() noexcept
@@ -360,13 +364,30 @@ void Opm::ConvergenceReportQueue::enqueue(std::vector<OutputRequest>&& requests)
     // We don't need to signal if we're going from "some work" to "more
     // work".
     auto must_notify = false;
+    auto first_drop = false;
 
     {
         std::lock_guard<std::mutex> guard{ this->mtx_ };
-        must_notify = this->requests_.empty();
-        this->requests_.insert(this->requests_.end(),
-                               std::make_move_iterator(requests.begin()),
-                               std::make_move_iterator(requests.end()));
+
+        if (this->requests_.size() >= maxPendingRequests_) {
+            // The output thread has stalled.  Discard the incoming
+            // requests instead of buffering without limit, and never block
+            // the producing (stepping) thread.
+            first_drop = this->droppedRequests_ == 0;
+            this->droppedRequests_ += requests.size();
+        }
+        else {
+            must_notify = this->requests_.empty();
+            this->requests_.insert(this->requests_.end(),
+                                   std::make_move_iterator(requests.begin()),
+                                   std::make_move_iterator(requests.end()));
+        }
+    }
+
+    if (first_drop) {
+        OpmLog::warning("Convergence output thread has fallen behind. "
+                        "Further per-iteration convergence records will "
+                        "be discarded until it catches up.");
     }
 
     if (must_notify) {
@@ -376,8 +397,24 @@ void Opm::ConvergenceReportQueue::enqueue(std::vector<OutputRequest>&& requests)
 
 void Opm::ConvergenceReportQueue::signalLastOutputRequest()
 {
-    // Empty request signals end of production.
-    this->enqueue(std::vector<OutputRequest>(1));
+    auto num_dropped = std::vector<OutputRequest>::size_type{0};
+
+    {
+        // Empty request signals end of production.  Bypasses the capacity
+        // check so that the output thread is always shut down cleanly.
+        std::lock_guard<std::mutex> guard{ this->mtx_ };
+        this->requests_.emplace_back();
+        num_dropped = this->droppedRequests_;
+    }
+
+    this->cv_.notify_one();
+
+    if (num_dropped > 0) {
+        OpmLog::warning(fmt::format("Convergence output queue overflowed "
+                                    "during the run, {} per-iteration "
+                                    "convergence records were discarded.",
+                                    num_dropped));
+    }
 }
 
 // ---------------------------------------------------------------------------
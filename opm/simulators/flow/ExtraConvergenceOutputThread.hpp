@@ -76,6 +76,11 @@ public:
     /// Push sequence of output requests, typically all substeps whether
     /// converged or not, of a single report step.
     ///
+    /// Never blocks the producer.  The queue is bounded: if the output
+    /// thread has fallen so far behind that the number of pending requests
+    /// exceeds the queue capacity, the incoming requests are discarded and
+    /// counted instead of being buffered without limit.
+    ///
     /// \param[in] requests Output request sequence.  Queue takes ownership.
     void enqueue(std::vector<OutputRequest>&& requests);
 
@@ -89,6 +94,12 @@ public:
     friend class ConvergenceOutputThread;
 
 private:
+    /// Maximum number of pending output requests buffered before incoming
+    /// requests are discarded.  Each request covers the non-linear
+    /// iterations of a single substep, so this bound is only reached when
+    /// the output thread has stalled, e.g., on a slow file system.
+    static constexpr std::vector<OutputRequest>::size_type maxPendingRequests_ = 1024;
+
     /// Mutex for critical sections protecting 'requests_'.
     std::mutex mtx_{};
 
@@ -97,6 +108,9 @@ private:
 
     /// Pending convergence output requests.
     std::vector<OutputRequest> requests_{};
+
+    /// Number of output requests discarded because the queue was full.
+    std::vector<OutputRequest>::size_type droppedRequests_{0};
 };
 
 /// Encapsulating object for thread processing producer's convergence output
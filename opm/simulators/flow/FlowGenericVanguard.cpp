@@ -164,6 +164,8 @@ FlowGenericVanguard::FlowGenericVanguard(SimulationModelParams&& params)
     metisParams_ = Parameters::Get<Parameters::MetisParams>();
 
     externalPartitionFile_ = Parameters::Get<Parameters::ExternalPartition>();
+    partitionCacheDir_ = Parameters::Get<Parameters::PartitionCacheDir>();
+    partitionCellWeightsFile_ = Parameters::Get<Parameters::PartitionCellWeights>();
 #endif // HAVE_MPI
 
     enableDistributedWells_ = Parameters::Get<Parameters::AllowDistributedWells>();
@@ -480,6 +482,12 @@ void FlowGenericVanguard::registerParameters_()
     Parameters::Register<Parameters::SchedRestart>
         ("When restarting: should we try to initialize wells and "
          "groups from historical SCHEDULE section.");
+    Parameters::Register<Parameters::UseDeckSnapshot>
+        ("Cache the parsed deck as an HDF5 snapshot file in the output "
+         "directory and reuse it in subsequent runs of the same deck. "
+         "The snapshot is keyed on the content of the top-level deck file "
+         "only, so modifications made through INCLUDE files are not "
+         "detected.");
     Parameters::Register<Parameters::EdgeWeightsMethod>
         ("Choose edge-weighing strategy: 'uniform', 'transmissibility', or 'logtrans' (logarithm of transmissibility).");
 
@@ -532,6 +540,26 @@ void FlowGenericVanguard::registerParameters_()
          "method will be employed.");
     Parameters::Hide<Parameters::ExternalPartition>();
 
+    Parameters::Register<Parameters::PartitionCacheDir>
+        ("Directory in which to cache the computed MPI partitioning of "
+         "the model's active cells and reuse it in later runs.  Cache "
+         "entries are keyed on the grid geometry, the well completions "
+         "and the partitioner configuration, so repeated runs of the "
+         "same case (e.g. history matching loops) skip the graph "
+         "partitioning step.  Edge weights derived from transmissibility "
+         "are not part of the key; remove the cached files to force "
+         "repartitioning after property changes.  If empty, no caching "
+         "is performed.");
+
+    Parameters::Register<Parameters::PartitionCellWeights>
+        ("File of per-cell computational weights used to bias the MPI "
+         "load balancer, with one row of 'Cartesian_Idx Weight' per "
+         "cell.  Cells not listed get unit weight.  Record the weights "
+         "from a previous run of the same case, e.g. from per-domain "
+         "NLDD solver effort, so that ranks holding expensive cells "
+         "receive fewer of them.  Requires Zoltan.  If empty, all cells "
+         "are weighted equally.");
+
     Parameters::Hide<Parameters::ZoltanImbalanceTol<Scalar>>();
     Parameters::Hide<Parameters::ZoltanParams>();
     Parameters::Hide<Parameters::ZoltanPhgEdgeSizeThreshold>();
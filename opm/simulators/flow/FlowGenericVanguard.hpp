@@ -72,6 +72,9 @@ struct OwnerCellsFirst { static constexpr bool value = true; };
 struct ParsingStrictness { static constexpr auto value = "normal"; };
 struct ActionParsingStrictness { static constexpr auto value = "normal"; };
 
+struct PartitionCacheDir { static constexpr auto* value = ""; };
+struct PartitionCellWeights { static constexpr auto* value = ""; };
+
 /// 0: simple, 1: Zoltan, 2: METIS, 3: Zoltan with a all cells of a well
 /// represented by one vertex in the graph, see GridEnums.hpp
 struct PartitionMethod { static constexpr auto value = "zoltanwell"; };
@@ -82,6 +85,8 @@ struct EdgeConformal { static constexpr bool value = false; };
 struct SchedRestart{ static constexpr bool value = false; };
 struct SerialPartitioning{ static constexpr bool value = false; };
 
+struct UseDeckSnapshot { static constexpr bool value = false; };
+
 template<class Scalar>
 struct ZoltanImbalanceTol { static constexpr Scalar value = 1.1; };
 
@@ -303,6 +308,24 @@ public:
     {
         return this->externalPartitionFile_;
     }
+
+    /*!
+     * \brief Directory in which computed partitions are cached and reused
+     *        across runs.  Empty string disables the cache.
+     */
+    const std::string& partitionCacheDir() const
+    {
+        return this->partitionCacheDir_;
+    }
+
+    /*!
+     * \brief File of per-cell computational weights used to bias the
+     *        Zoltan load balancer.  Empty string means uniform weights.
+     */
+    const std::string& partitionCellWeightsFile() const
+    {
+        return this->partitionCellWeightsFile_;
+    }
 #endif // HAVE_MPI
 
     /*!
@@ -394,6 +417,8 @@ protected:
     std::string metisParams_;
 
     std::string externalPartitionFile_{};
+    std::string partitionCacheDir_{};
+    std::string partitionCellWeightsFile_{};
 #endif // HAVE_MPI
 
     bool enableDistributedWells_;
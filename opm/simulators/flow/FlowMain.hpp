@@ -34,6 +34,10 @@
 #include <opm/simulators/flow/SimulatorFullyImplicitBlackoil.hpp>
 #include <opm/simulators/flow/rescoup/ReservoirCouplingEnabled.hpp>
 
+#include <opm/simulators/utils/EventProfiler.hpp>
+#include <opm/simulators/utils/MemoryBudget.hpp>
+#include <opm/simulators/utils/RooflineCounters.hpp>
+
 #if HAVE_DUNE_FEM
 #include <dune/fem/misc/mpimanager.hh>
 #else
@@ -104,6 +108,21 @@ namespace Opm {
                  "In that case it will be appended to the *.DBG or *.PRT files");
             Parameters::Register<Parameters::DebugVerbosityLevel>
                 ("Set debug verbosity level globally. Default is 1, increasing values give additional output and 0 disables most messages to the .DBG file");
+            Parameters::Register<Parameters::EnableEventProfiling>
+                ("Record time stamps for instrumented hot-path scopes and write them as "
+                 "folded stacks (flame graph input) to CASENAME.PROFILE on the IO rank");
+            Parameters::Register<Parameters::MemoryBudgetMb>
+                ("Soft limit on the resident set size per process in MiB. When exceeded, "
+                 "reclaimable caches (e.g. linear solver hierarchies) are released at the "
+                 "next report step. Set to 0 to disable");
+            Parameters::Register<Parameters::EnableRooflineCounters>
+                ("Sample hardware counters (perf_event) around the assembly, linear "
+                 "solve and well phases and report per-phase IPC and achieved DRAM "
+                 "bandwidth at the end of the run");
+            Parameters::Register<Parameters::RooflineFpRawEvent>
+                ("Raw PMU event counting floating point operations, in perf list "
+                 "'rNNNN' syntax. When given, the roofline report also includes "
+                 "GFLOP/s and FLOP/byte per phase");
 
             // register the base parameters
             registerAllParameters_<TypeTag>(/*finalizeRegistration=*/false);
@@ -324,6 +343,19 @@ namespace Opm {
 
             using TM = GetPropType<TypeTag, Properties::ThreadManager>;
             TM::init(false);
+
+#if _OPENMP
+            // There is no portable way to bind threads once the OpenMP
+            // runtime has started, so if the threads are unbound we can only
+            // point the user at the environment controls. Unbound threads
+            // migrate between NUMA domains, which defeats the first-touch
+            // placement of the linear system and causes cross-socket memory
+            // traffic on multi-socket machines.
+            if (TM::maxThreads() > 1 && !TM::threadsBound()) {
+                OpmLog::info("OpenMP threads are not bound to processors. On multi-socket machines, "
+                             "consider setting OMP_PROC_BIND=spread and OMP_PLACES=cores.");
+            }
+#endif
         }
 
         void mergeParallelLogFiles()
@@ -331,13 +363,31 @@ namespace Opm {
             // force closing of all log files.
             OpmLog::removeAllBackends();
 
-            if (mpi_rank_ != 0 || mpi_size_ < 2 || !this->output_files_ || !modelSimulator_) {
+            if (mpi_size_ < 2 || !this->output_files_ || !modelSimulator_) {
+                return;
+            }
+
+            if (!Parameters::Get<Parameters::EnableLoggingFalloutWarning>()) {
+                // The per-rank files are discarded without inspection.
+                // Every rank removes its own files: funnelling tens of
+                // thousands of metadata operations through a directory
+                // scan on the root process adds minutes of tail latency
+                // on large parallel file systems.
+                if (mpi_rank_ != 0) {
+                    detail::removeParallelLogFiles(eclState().getIOConfig().getOutputDir(),
+                                                   Parameters::Get<Parameters::EclDeckFileName>(),
+                                                   mpi_rank_);
+                }
+                return;
+            }
+
+            if (mpi_rank_ != 0) {
                 return;
             }
 
             detail::mergeParallelLogFiles(eclState().getIOConfig().getOutputDir(),
                                           Parameters::Get<Parameters::EclDeckFileName>(),
-                                          Parameters::Get<Parameters::EnableLoggingFalloutWarning>());
+                                          /*enableLoggingFalloutWarning=*/true);
         }
 
         void setupModelSimulator()
@@ -371,6 +421,17 @@ namespace Opm {
         // Callback that will be called from runSimulatorInitOrRun_().
         int runSimulatorRunCallback_()
         {
+            if (Parameters::Get<Parameters::EnableEventProfiling>()) {
+                // roughly 40 MiB per thread; long runs keep the tail of
+                // the simulation, which is what we want for steady-state
+                // performance analysis
+                EventProfiler::enable(/*eventsPerThread=*/1 << 20);
+            }
+            MemoryBudget::instance().setBudget(
+                static_cast<std::size_t>(Parameters::Get<Parameters::MemoryBudgetMb>()) << 20);
+            if (Parameters::Get<Parameters::EnableRooflineCounters>()) {
+                RooflineCounters::enable(Parameters::Get<Parameters::RooflineFpRawEvent>());
+            }
 #ifdef RESERVOIR_COUPLING_ENABLED
             SimulatorReport report = simulator_->run(*simtimer_, this->argc_, this->argv_);
 #else
@@ -394,10 +455,32 @@ namespace Opm {
         // Output summary after simulation has completed
         void runSimulatorAfterSim_(SimulatorReport &report)
         {
+            if (EventProfiler::enabled()) {
+                EventProfiler::disable();
+                if (mpi_rank_ == 0) {
+                    const auto& ioConfig = eclState().getIOConfig();
+                    EventProfiler::writeFoldedStacks(ioConfig.getOutputDir() + "/" +
+                                                     ioConfig.getBaseName() + ".PROFILE");
+                }
+            }
+
+            if (MemoryBudget::instance().budget() > 0 && mpi_rank_ == 0) {
+                OpmLog::info(MemoryBudget::instance().formatReport());
+            }
+
+            if (RooflineCounters::enabled()) {
+                RooflineCounters::disable();
+                if (mpi_rank_ == 0) {
+                    OpmLog::info(RooflineCounters::formatReport());
+                }
+            }
+
             if (simulator_->model().hasNlddSolver()) {
                 const auto& odir = eclState().getIOConfig().getOutputDir();
                 // Write the number of nonlinear iterations per cell to a file in ResInsight compatible format
                 simulator_->model().writeNonlinearIterationsPerCell(odir);
+                // Write the per-domain cost breakdown to CSV files for offline NLDD tuning
+                simulator_->model().writeDomainCostBreakdown(odir);
                 // Write the NLDD statistics to the DBG file
                 reportNlddStatistics(simulator_->model().domainAccumulatedReports(),
                                      simulator_->model().localAccumulatedReports(),
@@ -63,6 +63,7 @@
 #include <opm/simulators/flow/TracerModel.hpp>
 #include <opm/simulators/flow/TemperatureModel.hpp>
 #include <opm/simulators/flow/Transmissibility.hpp>
+#include <opm/simulators/flow/TransportTopology.hpp>
 #include <opm/simulators/timestepping/AdaptiveTimeStepping.hpp>
 #include <opm/simulators/timestepping/SimulatorReport.hpp>
 
@@ -666,6 +667,21 @@ public:
     TemperatureModel& temperatureModel() // need for restart
     { return temperatureModel_; }
 
+    /*!
+     * \brief Return the cell-adjacency topology shared by the scalar
+     *        transport matrices (tracer and energy), building it on first use.
+     */
+    const std::shared_ptr<const TransportTopology>& transportTopology()
+    {
+        if (!transportTopology_) {
+            transportTopology_ =
+                TransportTopology::create<Stencil>(this->simulator().vanguard().gridView(),
+                                                   this->model().dofMapper(),
+                                                   this->model().numGridDof());
+        }
+        return transportTopology_;
+    }
+
     /*!
      * \copydoc FvBaseMultiPhaseProblem::porosity
      *
@@ -831,6 +847,43 @@ public:
         }
     }
 
+    template <class FluidState, class ...Args>
+    void updateRelpermsAndCapillaryPressures(
+        std::array<Evaluation,numPhases>& mobility,
+        DirectionalMobilityPtr& dirMob,
+        std::array<Evaluation,numPhases>& pC,
+        FluidState& fluidState,
+        unsigned globalSpaceIdx) const
+    {
+        using ContainerT = std::array<Evaluation, numPhases>;
+        OPM_TIMEBLOCK_LOCAL(updateRelperms, Subsystem::SatProps);
+        {
+            // Fetch the per-cell material law parameters once and evaluate
+            // both the relative permeabilities and the capillary pressures
+            // with them. This is called for every cell in every intensive
+            // quantities update, so the duplicate parameter lookup of the
+            // separate updateRelperms()/capillaryPressures() calls is
+            // measurable.
+            const auto& materialParams = materialLawParams(globalSpaceIdx);
+            MaterialLaw::template relativePermeabilities<ContainerT, FluidState, Args...>(mobility, materialParams, fluidState);
+            Valgrind::CheckDefined(mobility);
+            MaterialLaw::template capillaryPressures<ContainerT, FluidState, Args...>(pC, materialParams, fluidState);
+        }
+        if (materialLawManager_->hasDirectionalRelperms()
+               || materialLawManager_->hasDirectionalImbnum())
+        {
+            using Dir = FaceDir::DirEnum;
+            constexpr int ndim = 3;
+            dirMob = std::make_unique<DirectionalMobility<TypeTag>>();
+            Dir facedirs[ndim] = {Dir::XPlus, Dir::YPlus, Dir::ZPlus};
+            for (int i = 0; i<ndim; i++) {
+                const auto& materialParams = materialLawParams(globalSpaceIdx, facedirs[i]);
+                auto& mob_array = dirMob->getArray(i);
+                MaterialLaw::template relativePermeabilities<ContainerT, FluidState, Args...>(mob_array, materialParams, fluidState);
+            }
+        }
+    }
+
     /*!
      * \copydoc materialLawManager()
      */
@@ -1605,23 +1658,20 @@ protected:
         if (bcconfig.size() > 0) {
             nonTrivialBoundaryConditions_ = true;
 
-            std::size_t numCartDof = vanguard.cartesianSize();
             unsigned numElems = vanguard.gridView().size(/*codim=*/0);
-            std::vector<int> cartesianToCompressedElemIdx(numCartDof, -1);
-
-            for (unsigned elemIdx = 0; elemIdx < numElems; ++elemIdx)
-                cartesianToCompressedElemIdx[vanguard.cartesianIndex(elemIdx)] = elemIdx;
 
             bcindex_.resize(numElems, 0);
-            auto loopAndApply = [&cartesianToCompressedElemIdx,
-                                 &vanguard](const auto& bcface,
+            // Use the vanguard's Cartesian-to-compressed lookup instead of
+            // building a temporary array over the full Cartesian index
+            // space, which may be much larger than the active cell count.
+            auto loopAndApply = [&vanguard](const auto& bcface,
                                             auto apply)
             {
                 for (int i = bcface.i1; i <= bcface.i2; ++i) {
                     for (int j = bcface.j1; j <= bcface.j2; ++j) {
                         for (int k = bcface.k1; k <= bcface.k2; ++k) {
                             std::array<int, 3> tmp = {i,j,k};
-                            auto elemIdx = cartesianToCompressedElemIdx[vanguard.cartesianIndex(tmp)];
+                            auto elemIdx = vanguard.compressedIndex(vanguard.cartesianIndex(tmp));
                             if (elemIdx >= 0)
                                 apply(elemIdx);
                         }
@@ -1781,6 +1831,7 @@ protected:
     PffGridVector<GridView, Stencil, PffDofData_, DofMapper> pffDofData_;
     TracerModel tracerModel_;
     TemperatureModel temperatureModel_;
+    std::shared_ptr<const TransportTopology> transportTopology_;
 
     template<class T>
     struct BCData
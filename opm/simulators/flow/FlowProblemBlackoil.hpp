@@ -63,6 +63,7 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <functional>
 #include <limits>
@@ -70,6 +71,7 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -231,6 +233,11 @@ public:
         eclWriter_ = std::make_unique<EclWriterType>(simulator);
         enableEclOutput_ = Parameters::Get<Parameters::EnableEclOutput>();
 
+        // The parameter is registered by the TPFA linearizer only, so fall
+        // back to the default instead of erroring out for other linearizers.
+        separateSparseSourceTerms_ =
+            Parameters::Get<Parameters::SeparateSparseSourceTerms>(/*errorIfNotRegistered=*/false);
+
         // Safeguard against geochemistry since it exsist in a separate module with a separate problem class
         if constexpr (!enableGeochemistry) {
             if (vanguard.eclState().runspec().geochem().enabled()) {
@@ -624,7 +631,12 @@ public:
                           unsigned globalDofIdx,
                           unsigned timeIdx) const override
     {
-        this->aquiferModel_.addToSource(rate, globalDofIdx, timeIdx);
+        // With separate sparse source terms the aquifer contributions are
+        // assembled in batch over the connected cells only, see
+        // BlackoilAquiferModel::addReservoirSourceTerms().
+        if (!separateSparseSourceTerms_) {
+            this->aquiferModel_.addToSource(rate, globalDofIdx, timeIdx);
+        }
 
         // Add source term from deck
         const auto& source = this->simulator().vanguard().schedule()[this->episodeIndex()].source();
@@ -1134,6 +1146,171 @@ public:
         }
     }
 
+    /*!
+     * \brief Install an externally supplied initial state, bypassing
+     *        equilibration and deck-driven initialization.
+     *
+     * This is intended for ensemble workflows (e.g. iterative ensemble
+     * smoothers) which restart each realization from updated state vectors
+     * and for which re-running the full equilibration and output machinery
+     * is pure overhead. The supplied arrays replace the initial fluid
+     * states and the initial solution is recomputed from them.
+     *
+     * All arrays are indexed by compressed cell index. \a rs and \a rv may
+     * be empty if the corresponding mechanism is disabled; otherwise they
+     * must cover all cells. Well states can be installed alongside the
+     * cell states via setExternalWellState().
+     *
+     * \param pressure Oil-phase pressure (or gas/water pressure for runs
+     *                 without an oil phase) per cell.
+     * \param waterSaturation Water saturation per cell.
+     * \param gasSaturation Gas saturation per cell.
+     * \param rs Dissolved gas-oil ratio per cell.
+     * \param rv Vaporized oil-gas ratio per cell.
+     */
+    void setExternalInitialState(const std::vector<Scalar>& pressure,
+                                 const std::vector<Scalar>& waterSaturation,
+                                 const std::vector<Scalar>& gasSaturation,
+                                 const std::vector<Scalar>& rs,
+                                 const std::vector<Scalar>& rv)
+    {
+        const std::size_t numDof = this->model().numGridDof();
+
+        auto checkSize = [numDof](const std::vector<Scalar>& data,
+                                  const std::string_view name,
+                                  const bool required)
+        {
+            if (data.size() == numDof || (!required && data.empty())) {
+                return;
+            }
+
+            throw std::runtime_error {
+                "Externally supplied " + std::string { name } + " array covers " +
+                std::to_string(data.size()) + " cells, but the model has " +
+                std::to_string(numDof) + " active cells"
+            };
+        };
+
+        checkSize(pressure, "pressure", true);
+        if (FluidSystem::phaseIsActive(waterPhaseIdx) && Indices::numPhases > 1) {
+            checkSize(waterSaturation, "water saturation", true);
+        }
+        if (FluidSystem::phaseIsActive(gasPhaseIdx) && FluidSystem::phaseIsActive(oilPhaseIdx)) {
+            checkSize(gasSaturation, "gas saturation", true);
+        }
+        checkSize(rs, "RS", FluidSystem::enableDissolvedGas());
+        checkSize(rv, "RV", FluidSystem::enableVaporizedOil());
+
+        const auto& fp = this->simulator().vanguard().eclState().fieldProps();
+        const auto& tempiData = fp.get_double("TEMPI");
+
+        initialFluidStates_.resize(numDof);
+        for (std::size_t dofIdx = 0; dofIdx < numDof; ++dofIdx) {
+            const Scalar sw = waterSaturation.empty() ? 0.0 : waterSaturation[dofIdx];
+            const Scalar sg = gasSaturation.empty() ? 0.0 : gasSaturation[dofIdx];
+
+            if (!std::isfinite(pressure[dofIdx]) || pressure[dofIdx] <= 0.0) {
+                throw std::runtime_error("Externally supplied pressure is not positive "
+                                         "and finite in cell " + std::to_string(dofIdx));
+            }
+            if (sw < -smallSaturationTolerance_ || sg < -smallSaturationTolerance_ ||
+                sw + sg > 1.0 + smallSaturationTolerance_)
+            {
+                throw std::runtime_error("Externally supplied saturations are outside "
+                                         "the unit simplex in cell " + std::to_string(dofIdx));
+            }
+
+            auto& dofFluidState = initialFluidStates_[dofIdx];
+
+            dofFluidState.setPvtRegionIndex(pvtRegionIndex(dofIdx));
+
+            if constexpr (energyModuleType != EnergyModules::NoTemperature) {
+                Scalar temperatureLoc = tempiData[dofIdx];
+                if (!std::isfinite(temperatureLoc) || temperatureLoc <= 0)
+                    temperatureLoc = FluidSystem::surfaceTemperature;
+                dofFluidState.setTemperature(temperatureLoc);
+            }
+
+            if (FluidSystem::phaseIsActive(waterPhaseIdx))
+                dofFluidState.setSaturation(waterPhaseIdx, std::max(sw, Scalar{0.0}));
+
+            if (FluidSystem::phaseIsActive(gasPhaseIdx)) {
+                if (!FluidSystem::phaseIsActive(oilPhaseIdx))
+                    dofFluidState.setSaturation(gasPhaseIdx, 1.0 - sw);
+                else
+                    dofFluidState.setSaturation(gasPhaseIdx, std::max(sg, Scalar{0.0}));
+            }
+
+            if (FluidSystem::phaseIsActive(oilPhaseIdx)) {
+                const Scalar soil = 1.0 - sw - sg;
+                dofFluidState.setSaturation(oilPhaseIdx,
+                                            soil < smallSaturationTolerance_ ? 0.0 : soil);
+            }
+
+            // phase pressures follow from the reference pressure and the
+            // capillary pressures, exactly as in the deck-driven explicit
+            // initialization.
+            std::array<Scalar, numPhases> pc = {0};
+            const auto& matParams = this->materialLawParams(dofIdx);
+            MaterialLaw::capillaryPressures(pc, matParams, dofFluidState);
+            for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                if (!FluidSystem::phaseIsActive(phaseIdx))
+                    continue;
+
+                if (Indices::oilEnabled)
+                    dofFluidState.setPressure(phaseIdx, pressure[dofIdx] + (pc[phaseIdx] - pc[oilPhaseIdx]));
+                else if (Indices::gasEnabled)
+                    dofFluidState.setPressure(phaseIdx, pressure[dofIdx] + (pc[phaseIdx] - pc[gasPhaseIdx]));
+                else if (Indices::waterEnabled)
+                    dofFluidState.setPressure(phaseIdx, pressure[dofIdx]);
+            }
+
+            if constexpr (enableDissolvedGas) {
+                if (FluidSystem::enableDissolvedGas() && !rs.empty())
+                    dofFluidState.setRs(std::max(rs[dofIdx], Scalar{0.0}));
+                else if (Indices::gasEnabled && Indices::oilEnabled)
+                    dofFluidState.setRs(0.0);
+                if (FluidSystem::enableVaporizedOil() && !rv.empty())
+                    dofFluidState.setRv(std::max(rv[dofIdx], Scalar{0.0}));
+                else if (Indices::gasEnabled && Indices::oilEnabled)
+                    dofFluidState.setRv(0.0);
+            }
+
+            for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                if (!FluidSystem::phaseIsActive(phaseIdx))
+                    continue;
+
+                const auto& b = FluidSystem::inverseFormationVolumeFactor(dofFluidState, phaseIdx, pvtRegionIndex(dofIdx));
+                dofFluidState.setInvB(phaseIdx, b);
+
+                const auto& rho = FluidSystem::density(dofFluidState, phaseIdx, pvtRegionIndex(dofIdx));
+                dofFluidState.setDensity(phaseIdx, rho);
+            }
+
+            this->mixControls_.updateLastValues(dofIdx, dofFluidState.Rs(), dofFluidState.Rv());
+        }
+
+        // recompute the initial solution, the history and all intensive
+        // quantities from the fluid states installed above.
+        this->model().applyInitialSolution();
+    }
+
+    /*!
+     * \brief Install an externally supplied well state, replacing the
+     *        current and committed well states.
+     *
+     * Companion to setExternalInitialState() for ensemble workflows; the
+     * supplied state must have been created for the current well
+     * configuration, e.g. by copying the well state of a previous run of
+     * the same realization.
+     */
+    template <class WellStateData>
+    void setExternalWellState(WellStateData&& wellState)
+    {
+        this->wellModel_.wellState() = std::forward<WellStateData>(wellState);
+        this->wellModel_.commitWGState();
+    }
+
     /*!
      * \copydoc BlackOilBaseProblem::thresholdPressure
      */
@@ -1660,6 +1837,9 @@ protected:
         const auto isIoRank = this->simulator().vanguard()
             .grid().comm().rank() == ioRank;
 
+        const auto cellSampleStride = static_cast<std::size_t>
+            (std::max(Parameters::Get<Parameters::SatfuncConsistencyCellStride>(), 1));
+
         // Note: Run saturation function consistency checks on main grid
         // only (i.e., levelGridView(0)).  These checks are not supported
         // for LGRs at this time.
@@ -1668,7 +1848,8 @@ protected:
                  [&vg   = this->simulator().vanguard(),
                   &emap = this->simulator().model().elementMapper()]
                  (const auto& elem)
-                 { return vg.gridIdxToEquilGridIdx(emap.index(elem)); });
+                 { return vg.gridIdxToEquilGridIdx(emap.index(elem)); },
+                 cellSampleStride);
 
         using ViolationLevel = typename Satfunc::PhaseChecks::
             SatfuncConsistencyCheckManager<Scalar>::ViolationLevel;
@@ -1713,6 +1894,7 @@ protected:
     std::vector<InitialFluidState> initialFluidStates_;
 
     bool enableEclOutput_;
+    bool separateSparseSourceTerms_ = false;
     std::unique_ptr<EclWriterType> eclWriter_;
 
     const Scalar smallSaturationTolerance_ = 1.e-6;
@@ -72,6 +72,10 @@ void registerFlowProblemParameters()
     Parameters::Register<Parameters::NumSatfuncConsistencySamplePoints>
         ("Maximum number of reported failures for each individual saturation function consistency check");
 
+    Parameters::Register<Parameters::SatfuncConsistencyCellStride>
+        ("Run per-cell saturation function consistency checks on every N-th interior "
+         "cell only.  Per-region checks are always exhaustive.  N=1 checks every cell");
+
     Parameters::Register<Parameters::HybridNewtonConfigFile>
         ("JSON Config file path for Hybrid Newton");
 
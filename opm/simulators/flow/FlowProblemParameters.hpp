@@ -50,6 +50,11 @@ struct CheckSatfuncConsistency { static constexpr bool value = true; };
 // consistency check.
 struct NumSatfuncConsistencySamplePoints { static constexpr int value = 5; };
 
+// Run per-cell (scaled) saturation function consistency checks on every
+// N-th interior cell only.  The per-region checks of the tabulated
+// saturation functions are always exhaustive.  N=1 checks every cell.
+struct SatfuncConsistencyCellStride { static constexpr int value = 1; };
+
 // Parameterize equilibration accuracy
 struct NumPressurePointsEquil
 { static constexpr int value = ParserKeywords::EQLDIMS::DEPTH_NODES_P::defaultValue; };
@@ -55,32 +55,55 @@
 #include <filesystem>
 #include <fstream>
 #include <string>
+#include <system_error>
 #include <unistd.h>
 #include <vector>
 
 namespace Opm::detail {
 
+namespace {
+
+//! \brief Deck file name with the extension ("." or ".DATA") stripped.
+std::string logFileBaseName(std::string_view deckFilename)
+{
+    const std::filesystem::path deck_filename(deckFilename);
+    const std::string extension = uppercase(deck_filename.extension().string());
+    if (extension == ".DATA" || extension == ".") {
+        return uppercase(deck_filename.stem().string());
+    }
+
+    return uppercase(deck_filename.filename().string());
+}
+
+} // anonymous namespace
+
 void mergeParallelLogFiles(std::string_view output_dir,
                            std::string_view deckFilename,
                            bool enableLoggingFalloutWarning)
 {
     namespace fs = ::std::filesystem;
     fs::path output_path(output_dir);
-    fs::path deck_filename(deckFilename);
-    std::string basename;
-    // Strip extension "." and ".DATA"
-    std::string extension = uppercase(deck_filename.extension().string());
-    if (extension == ".DATA" || extension == ".") {
-        basename = uppercase(deck_filename.stem().string());
-    } else {
-        basename = uppercase(deck_filename.filename().string());
-    }
     std::for_each(fs::directory_iterator(output_path),
                   fs::directory_iterator(),
-                  detail::ParallelFileMerger(output_path, basename,
+                  detail::ParallelFileMerger(output_path,
+                                             logFileBaseName(deckFilename),
                                              enableLoggingFalloutWarning));
 }
 
+void removeParallelLogFiles(std::string_view output_dir,
+                            std::string_view deckFilename,
+                            int rank)
+{
+    namespace fs = ::std::filesystem;
+    const fs::path output_path(output_dir);
+    const std::string prefix = logFileBaseName(deckFilename) + '.' + std::to_string(rank);
+
+    for (const auto* extension : {".PRT", ".DBG"}) {
+        std::error_code ignored{};
+        fs::remove(output_path / (prefix + extension), ignored);
+    }
+}
+
 void handleExtraConvergenceOutput(const SimulatorReport& report,
                                   std::string_view option,
                                   std::string_view optionName,
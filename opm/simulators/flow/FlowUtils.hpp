@@ -36,6 +36,15 @@ void mergeParallelLogFiles(std::string_view output_dir,
                            std::string_view deck_filename,
                            bool enableLoggingFalloutWarning);
 
+//! \brief Remove the log files written by a single rank.
+//!
+//! Used instead of mergeParallelLogFiles() when the logging fallout
+//! warning is disabled: every rank disposes of its own files, so the
+//! end-of-run cleanup does not serialize on the root process.
+void removeParallelLogFiles(std::string_view output_dir,
+                            std::string_view deck_filename,
+                            int rank);
+
 void handleExtraConvergenceOutput(const SimulatorReport& report,
                                   std::string_view option,
                                   std::string_view optionName,
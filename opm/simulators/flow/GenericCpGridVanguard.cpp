@@ -40,6 +40,8 @@
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/LgrCollection.hpp>
 
+#include <opm/simulators/flow/partitionCells.hpp>
+
 #include <opm/simulators/utils/ParallelEclipseState.hpp>
 #include <opm/simulators/utils/ParallelSerialization.hpp>
 #include <opm/simulators/utils/PropsDataHandle.hpp>
@@ -55,12 +57,15 @@
 #endif //HAVE_DUNE_FEM
 
 #include <cassert>
+#include <cstdint>
 #include <fstream>
 #include <iterator>
 #include <numeric>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <system_error>
+#include <type_traits>
 #include <vector>
 
 #include <fmt/format.h>
@@ -126,6 +131,91 @@ MPIPartitionFromFile::operator()(const Dune::CpGrid& grid) const
 }
 
 }
+
+namespace {
+
+    void fnv1aAppend(std::uint64_t& hash, const void* data, const std::size_t numBytes)
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < numBytes; ++i) {
+            hash ^= bytes[i];
+            hash *= 0x100000001b3ULL;
+        }
+    }
+
+    template <typename T>
+    void fnv1aAppend(std::uint64_t& hash, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        fnv1aAppend(hash, &value, sizeof(value));
+    }
+
+    void fnv1aAppend(std::uint64_t& hash, const std::string& value)
+    {
+        fnv1aAppend(hash, value.data(), value.size());
+    }
+
+    // Key identifying a cached partition: grid geometry, well completions
+    // and everything in the partitioner configuration that influences the
+    // computed cell-to-rank assignment.  Transmissibility-based edge
+    // weights are deliberately not part of the key--see the description of
+    // the --partition-cache-dir parameter.
+    std::uint64_t
+    partitionCacheKey(const Dune::CpGrid&           grid,
+                      const std::vector<Opm::Well>& wells,
+                      const bool                    splitInactiveWells,
+                      const Dune::EdgeWeightMethod  edgeWeightsMethod,
+                      const bool                    ownersFirst,
+                      const bool                    addCorners,
+                      const int                     numOverlap,
+                      const Dune::PartitionMethod   partitionMethod,
+                      const bool                    serialPartitioning,
+                      const bool                    enableDistributedWells,
+                      const double                  imbalanceTol,
+                      const std::string&            zoltanParams,
+                      const double                  zoltanPhgEdgeSizeThreshold,
+                      const std::string&            metisParams)
+    {
+        auto hash = std::uint64_t{0xcbf29ce484222325ULL};
+
+        fnv1aAppend(hash, grid.logicalCartesianSize());
+        for (const auto globCell : grid.globalCell()) {
+            fnv1aAppend(hash, globCell);
+        }
+
+        for (const auto& well : wells) {
+            fnv1aAppend(hash, well.name());
+            for (const auto& conn : well.getConnections()) {
+                fnv1aAppend(hash, conn.global_index());
+            }
+        }
+
+        fnv1aAppend(hash, splitInactiveWells);
+        fnv1aAppend(hash, static_cast<int>(edgeWeightsMethod));
+        fnv1aAppend(hash, ownersFirst);
+        fnv1aAppend(hash, addCorners);
+        fnv1aAppend(hash, numOverlap);
+        fnv1aAppend(hash, static_cast<int>(partitionMethod));
+        fnv1aAppend(hash, serialPartitioning);
+        fnv1aAppend(hash, enableDistributedWells);
+        fnv1aAppend(hash, imbalanceTol);
+        fnv1aAppend(hash, zoltanParams);
+        fnv1aAppend(hash, zoltanPhgEdgeSizeThreshold);
+        fnv1aAppend(hash, metisParams);
+
+        return hash;
+    }
+
+    std::filesystem::path
+    partitionCacheFileName(const std::string&  cacheDir,
+                           const std::uint64_t key,
+                           const int           mpiSize)
+    {
+        return std::filesystem::path { cacheDir } /
+            fmt::format("partition_{:016x}_np{}.partition", key, mpiSize);
+    }
+
+} // Anonymous namespace
 #endif
 
 std::optional<std::function<std::vector<int> (const Dune::CpGrid&)>> externalLoadBalancer;
@@ -164,7 +254,9 @@ doLoadBalance_(const Dune::EdgeWeightMethod             edgeWeightsMethod,
                EclipseState&                            eclState1,
                FlowGenericVanguard::ParallelWellStruct& parallelWells,
                const int                                numJacobiBlocks,
-               const bool                               enableEclOutput)
+               const bool                               enableEclOutput,
+               const std::string&                       partitionCacheDir,
+               const std::string&                       partitionCellWeightsFile)
 {
     if (((partitionMethod == Dune::PartitionMethod::zoltan) ||
          (partitionMethod == Dune::PartitionMethod::zoltanGoG)) &&
@@ -187,6 +279,65 @@ doLoadBalance_(const Dune::EdgeWeightMethod             edgeWeightsMethod,
         (numJacobiBlocks > 1) && (mpiSize == 1);
 
     if ((mpiSize > 1) || (numJacobiBlocks > 1)) {
+        // Skipping inactive wells in partitioning currently does not play nice with restart..
+        const bool restart = eclState1.getInitConfig().restartRequested();
+        const bool split_inactive = (!restart && allowSplittingInactiveWells);
+        const auto wells = ((mpiSize > 1) || partitionJacobiBlocks)
+            ? split_inactive
+                ? schedule.getActiveWellsAtEnd()
+                : schedule.getWellsatEnd()
+            : std::vector<Well>{};
+
+        // Bias the partitioner with per-cell computational weights recorded
+        // by a previous run of the same case.  The weighted partition is
+        // fed through the external load balancer hook, which also disables
+        // the partition cache below--the cache key does not cover the
+        // weights.  This block is collective.
+        if ((mpiSize > 1) && !partitionCellWeightsFile.empty() &&
+            !externalLoadBalancer.has_value())
+        {
+            auto parts = this->partitionWithCellWeights
+                (partitionCellWeightsFile, wells,
+                 schedule.getPossibleFutureConnections(), imbalanceTol);
+
+            if (this->mpiRank == 0) {
+                externalLoadBalancer =
+                    [parts = std::move(parts)](const Dune::CpGrid&)
+                    { return parts; };
+            }
+        }
+
+        // Reuse a previously computed partition when one has been cached
+        // for the same grid, wells and partitioner configuration.  Only
+        // the I/O rank inspects the cache; the other ranks follow through
+        // the loadBalancerSet broadcast below.
+        auto partitionCacheFile = std::filesystem::path{};
+        auto writePartitionCache = false;
+        if ((mpiSize > 1) && !partitionCacheDir.empty() &&
+            (this->mpiRank == 0) && !externalLoadBalancer.has_value())
+        {
+            partitionCacheFile = partitionCacheFileName
+                (partitionCacheDir,
+                 partitionCacheKey(*this->grid_, wells, split_inactive,
+                                   edgeWeightsMethod, ownersFirst,
+                                   addCorners, numOverlap, partitionMethod,
+                                   serialPartitioning, enableDistributedWells,
+                                   imbalanceTol,
+                                   this->zoltanParams(),
+                                   this->zoltanPhgEdgeSizeThreshold(),
+                                   this->metisParams()),
+                 mpiSize);
+
+            if (std::filesystem::exists(partitionCacheFile)) {
+                OpmLog::info(fmt::format("Loading cached partition from '{}'",
+                                         partitionCacheFile.generic_string()));
+                externalLoadBalancer = details::MPIPartitionFromFile { partitionCacheFile };
+            }
+            else {
+                writePartitionCache = true;
+            }
+        }
+
         // CpGrid's loadBalance() method uses transmissibilities as edge
         // weights.  This is arguably a layering violation and extracting
         // the per-face transmissibilities as a linear array is relatively
@@ -211,15 +362,6 @@ doLoadBalance_(const Dune::EdgeWeightMethod             edgeWeightsMethod,
             }
         }
 
-        // Skipping inactive wells in partitioning currently does not play nice with restart..
-        const bool restart = eclState1.getInitConfig().restartRequested();
-        const bool split_inactive = (!restart && allowSplittingInactiveWells);
-        const auto wells = ((mpiSize > 1) || partitionJacobiBlocks)
-            ? split_inactive
-                ? schedule.getActiveWellsAtEnd()
-                : schedule.getWellsatEnd()
-            : std::vector<Well>{};
-
         const auto& possibleFutureConnections = schedule.getPossibleFutureConnections();
         // Distribute the grid and switch to the distributed view.
         if (mpiSize > 1) {
@@ -232,6 +374,18 @@ doLoadBalance_(const Dune::EdgeWeightMethod             edgeWeightsMethod,
                                  eclState1, parallelWells);
         }
 
+        // Cache the partition we just computed for the next run of the
+        // same case.  This is collective: all ranks contribute their
+        // interior cells, the I/O rank writes the file.
+        if ((mpiSize > 1) && !partitionCacheDir.empty()) {
+            auto doWrite = static_cast<int>(writePartitionCache);
+            this->grid_->comm().broadcast(&doWrite, 1, 0);
+
+            if (doWrite != 0) {
+                this->saveCachedPartition(partitionCacheFile);
+            }
+        }
+
         // Add inactive wells to all ranks with connections (not solved, so OK even without distributed wells)
         if (split_inactive) {
             std::unordered_set<unsigned> cellOnRank;
@@ -446,6 +600,151 @@ distributeGrid(const Dune::EdgeWeightMethod                          edgeWeights
     }
 }
 
+template <class ElementMapper, class GridView, class Scalar>
+void
+GenericCpGridVanguard<ElementMapper, GridView, Scalar>::
+saveCachedPartition(const std::filesystem::path& fileName) const
+{
+    const auto& comm = this->grid_->comm();
+    const auto mpiSize = comm.size();
+
+    // Cartesian indices of the cells owned by this rank.
+    auto myCells = std::vector<int>{};
+    {
+        const auto gv = this->grid_->leafGridView();
+        const auto& globalCell = this->grid_->globalCell();
+        for (const auto& element : elements(gv, Dune::Partitions::interior)) {
+            myCells.push_back(globalCell[gv.indexSet().index(element)]);
+        }
+    }
+
+    auto myCount = static_cast<int>(myCells.size());
+    auto counts = std::vector<int>(mpiSize, 0);
+    comm.gather(&myCount, counts.data(), 1, 0);
+
+    auto displ = std::vector<int>(mpiSize + 1, 0);
+    std::partial_sum(counts.begin(), counts.end(), displ.begin() + 1);
+
+    auto allCells = std::vector<int>(displ.back());
+    comm.gatherv(myCells.data(), myCount,
+                 allCells.data(), counts.data(), displ.data(), 0);
+
+    if (comm.rank() != 0) {
+        return;
+    }
+
+    // Same three column format as accepted by MPIPartitionFromFile.  The
+    // third column (NLDD domain) is not known here and left as zero.
+    // Write to a temporary and rename to avoid a concurrent run of the
+    // same case picking up a partially written file.
+    auto tmpName = fileName;
+    tmpName += ".tmp";
+
+    {
+        std::error_code ignored{};
+        std::filesystem::create_directories(fileName.parent_path(), ignored);
+    }
+
+    {
+        std::ofstream pfile { tmpName };
+        for (auto rank = 0; rank < mpiSize; ++rank) {
+            for (auto c = displ[rank]; c < displ[rank + 1]; ++c) {
+                pfile << rank << ' ' << allCells[c] << " 0\n";
+            }
+        }
+
+        if (!pfile) {
+            OpmLog::warning(fmt::format("Failed to write partition cache "
+                                        "file '{}'", tmpName.generic_string()));
+            return;
+        }
+    }
+
+    std::error_code errorCode{};
+    std::filesystem::rename(tmpName, fileName, errorCode);
+    if (errorCode) {
+        OpmLog::warning(fmt::format("Failed to move partition cache file "
+                                    "into place at '{}': {}",
+                                    fileName.generic_string(),
+                                    errorCode.message()));
+        return;
+    }
+
+    OpmLog::info(fmt::format("Cached partition in '{}'",
+                             fileName.generic_string()));
+}
+
+template<class ElementMapper, class GridView, class Scalar>
+std::vector<int>
+GenericCpGridVanguard<ElementMapper, GridView, Scalar>::
+partitionWithCellWeights(const std::string&                                    weightsFile,
+                         const std::vector<Well>&                              wells,
+                         const std::unordered_map<std::string, std::set<int>>& possibleFutureConnections,
+                         const double                                          imbalanceTol) const
+{
+    // The undistributed grid is only populated on the I/O rank, so that
+    // rank supplies the full weight vector while the other ranks
+    // contribute empty local graphs to the collective Zoltan call.
+    auto cellWeights = std::vector<double>{};
+    if (this->mpiRank == 0) {
+        if (!std::filesystem::exists(weightsFile)) {
+            OPM_THROW(std::runtime_error,
+                      fmt::format("Cell weights file '{}' does not exist.",
+                                  weightsFile));
+        }
+
+        // One row of "Cartesian_Idx Weight" per cell; unlisted cells get
+        // unit weight.
+        auto weightOfCell = std::unordered_map<int, double>{};
+        {
+            std::ifstream wfile { weightsFile };
+            auto cartIdx = 0;
+            auto weight = 0.0;
+            while (wfile >> cartIdx >> weight) {
+                weightOfCell.insert_or_assign(cartIdx, weight);
+            }
+        }
+
+        const auto& globalCell = this->grid_->globalCell();
+        cellWeights.assign(globalCell.size(), 1.0);
+        for (auto c = 0*globalCell.size(); c < globalCell.size(); ++c) {
+            auto pos = weightOfCell.find(globalCell[c]);
+            if (pos != weightOfCell.end()) {
+                cellWeights[c] = pos->second;
+            }
+        }
+
+        OpmLog::info(fmt::format("Partitioning with cell weights from '{}' "
+                                 "({} of {} cells listed)", weightsFile,
+                                 weightOfCell.size(), globalCell.size()));
+    }
+
+    const auto gv = this->grid_->leafGridView();
+
+    using Element = typename Dune::CpGrid::LeafGridView::template Codim<0>::Entity;
+
+    auto zoltan_ctrl = ZoltanPartitioningControl<Element>{};
+
+    zoltan_ctrl.domain_imbalance = imbalanceTol;
+
+    zoltan_ctrl.index =
+        [&indexSet = gv.indexSet()](const Element& element)
+    {
+        return indexSet.index(element);
+    };
+
+    zoltan_ctrl.local_to_global =
+        [&globalCell = this->grid_->globalCell()](const int elemIdx)
+    {
+        return globalCell[elemIdx];
+    };
+
+    return ::Opm::partitionCells("zoltan", this->grid_->comm().size(),
+                                 gv, wells, possibleFutureConnections,
+                                 zoltan_ctrl, /* num_neighbor_levels = */ 0,
+                                 cellWeights).first;
+}
+
 #endif  // HAVE_MPI
 
 template<class ElementMapper, class GridView, class Scalar>
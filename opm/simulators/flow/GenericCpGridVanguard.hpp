@@ -170,13 +170,29 @@ protected:
                         EclipseState&                            eclState,
                         FlowGenericVanguard::ParallelWellStruct& parallelWells,
                         const int                                numJacobiBlocks,
-                        const bool                               enableEclOutput);
+                        const bool                               enableEclOutput,
+                        const std::string&                       partitionCacheDir,
+                        const std::string&                       partitionCellWeightsFile);
 
     void distributeFieldProps_(EclipseState& eclState);
 
 private:
     std::vector<double> extractFaceTrans(const GridView& gridView) const;
 
+    /// Gather the computed cell-to-rank assignment on the I/O rank and
+    /// write it to \p fileName in the format read by MPIPartitionFromFile.
+    void saveCachedPartition(const std::filesystem::path& fileName) const;
+
+    /// Partition the undistributed grid with per-cell computational
+    /// weights read from \p weightsFile.  Collective over the grid's
+    /// communicator.  The returned cell-to-rank assignment is complete on
+    /// the I/O rank only.
+    std::vector<int>
+    partitionWithCellWeights(const std::string&                                    weightsFile,
+                             const std::vector<Well>&                              wells,
+                             const std::unordered_map<std::string, std::set<int>>& possibleFutureConnections,
+                             const double                                          imbalanceTol) const;
+
     void distributeGrid(const Dune::EdgeWeightMethod                          edgeWeightsMethod,
                         const bool                                            ownersFirst,
                         const bool                                            addCorners,
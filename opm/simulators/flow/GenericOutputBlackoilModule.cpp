@@ -61,6 +61,7 @@
 #include <string>
 #include <string_view>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -68,6 +69,35 @@
 
 namespace {
 
+    //! \brief Move a solution array into place, downcasting it to single
+    //! precision in one contiguous pass when the single-precision output
+    //! pipeline is active.
+    template<class Scalar>
+    void insertSolutionArray(Opm::data::Solution&            sol,
+                             const std::string&              name,
+                             const Opm::UnitSystem::measure  measure,
+                             std::vector<Scalar>&            data,
+                             const Opm::data::TargetType     target,
+                             const bool                      singlePrecision)
+    {
+        if (data.empty()) {
+            return;
+        }
+
+        if constexpr (std::is_same_v<Scalar, double>) {
+            if (singlePrecision) {
+                // The double array is released here instead of travelling
+                // through collection on the I/O rank and file writing.
+                std::vector<float> converted(data.begin(), data.end());
+                data = {};
+                sol.insert(name, measure, std::move(converted), target);
+                return;
+            }
+        }
+
+        sol.insert(name, measure, std::move(data), target);
+    }
+
     std::size_t numCells(const Opm::EclipseState& eclState)
     {
         return eclState.fieldProps().get_int("FIPNUM").size();
@@ -145,7 +175,8 @@ GenericOutputBlackoilModule(const EclipseState& eclState,
     , interRegionFlows_(numCells(eclState),
                         defineInterRegionFlowArrays(eclState, summaryConfig),
                         declaredMaxRegionID(eclState.runspec()))
-    , logOutput_(eclState, schedule, summaryState, moduleVersion)
+    , logOutput_(eclState, schedule, summaryState, moduleVersion,
+                 Parameters::Get<Parameters::DeferredWellReports>())
     , enableEnergy_(enableEnergy)
     , constantTemperature_(constantTemperature)
     , enableMech_(enableMech)
@@ -173,16 +204,29 @@ GenericOutputBlackoilModule(const EclipseState& eclState,
 
     this->RPRNodes_  = summaryConfig_.keywords("RPR*");
     this->RPRPNodes_ = summaryConfig_.keywords("RPRP*");
+    this->RHPVNodes_ = summaryConfig_.keywords("RHPV*");
 
     for (const auto& phase : Inplace::phases()) {
         std::string key_pattern = "R" + Inplace::EclString(phase) + "*";
         this->regionNodes_[phase] = summaryConfig_.keywords(key_pattern);
+
+        const std::string field_key = "F" + Inplace::EclString(phase);
+        if (summaryConfig_.hasKeyword(field_key)) {
+            this->fieldInplaceNodes_.emplace_back(field_key, phase);
+        }
     }
 
+    this->hasFHPV_ = summaryConfig_.hasKeyword("FHPV");
+    this->hasFOE_  = summaryConfig_.hasKeyword("FOE");
+    this->hasFPR_  = summaryConfig_.hasKeyword("FPR");
+    this->hasFPRP_ = summaryConfig_.hasKeyword("FPRP");
+
     forceDisableFipOutput_ =
         Parameters::Get<Parameters::ForceDisableFluidInPlaceOutput>();
     forceDisableFipresvOutput_ =
         Parameters::Get<Parameters::ForceDisableResvFluidInPlaceOutput>();
+    singlePrecisionOutput_ =
+        Parameters::Get<Parameters::EclOutputSinglePrecisionPipeline>();
 }
 
 template<class FluidSystem>
@@ -199,6 +243,16 @@ registerParameters()
     Parameters::Register<Parameters::ForceDisableResvFluidInPlaceOutput>
         ("Do not print reservoir volumes values after each report step "
          "even if requested by the deck.");
+    Parameters::Register<Parameters::DeferredWellReports>
+        ("Format the well/group report tables for the PRT file on a "
+         "background thread and skip re-emission of unchanged tables. "
+         "Reports may interleave differently with other log messages.");
+    Parameters::Register<Parameters::EclOutputSinglePrecisionPipeline>
+        ("Downcast the restart solution arrays to single precision already "
+         "when they leave the output module instead of when the restart "
+         "file is written. Halves the memory and communication volume of "
+         "the output path; the file contents are single precision either "
+         "way unless --ecl-output-double-precision is requested.");
 }
 
 template<class FluidSystem>
@@ -318,17 +372,15 @@ assignToSolution(data::Solution& sol)
     using DataEntry =
         std::tuple<std::string, UnitSystem::measure, std::vector<Scalar>&>;
 
-    auto doInsert = [&sol](DataEntry&       entry,
-                           const data::TargetType target)
+    auto doInsert = [&sol, this](DataEntry&       entry,
+                                 const data::TargetType target)
     {
-        if (std::get<2>(entry).empty()) {
-            return;
-        }
-
-        sol.insert(std::get<std::string>(entry),
-                   std::get<UnitSystem::measure>(entry),
-                   std::move(std::get<2>(entry)),
-                   target);
+        insertSolutionArray(sol,
+                            std::get<std::string>(entry),
+                            std::get<UnitSystem::measure>(entry),
+                            std::get<2>(entry),
+                            target,
+                            singlePrecisionOutput_);
     };
 
     // if index not specified, we treat it as valid (>= 0)
@@ -420,52 +472,50 @@ assignToSolution(data::Solution& sol)
     this->mech_.outputRestart(sol);
     this->extboC_.outputRestart(sol);
 
-    if (! this->temperature_.empty())
-    {
-        sol.insert("TEMP", UnitSystem::measure::temperature,
-                   std::move(this->temperature_), data::TargetType::RESTART_SOLUTION);
-    }
+    insertSolutionArray(sol, "TEMP", UnitSystem::measure::temperature,
+                        this->temperature_, data::TargetType::RESTART_SOLUTION,
+                        singlePrecisionOutput_);
 
-    if (FluidSystem::phaseIsActive(waterPhaseIdx) &&
-        ! this->saturation_[waterPhaseIdx].empty())
+    if (FluidSystem::phaseIsActive(waterPhaseIdx))
     {
-        sol.insert("SWAT", UnitSystem::measure::identity,
-                   std::move(this->saturation_[waterPhaseIdx]),
-                   data::TargetType::RESTART_SOLUTION);
+        insertSolutionArray(sol, "SWAT", UnitSystem::measure::identity,
+                            this->saturation_[waterPhaseIdx],
+                            data::TargetType::RESTART_SOLUTION,
+                            singlePrecisionOutput_);
     }
 
-    if (FluidSystem::phaseIsActive(gasPhaseIdx) &&
-        ! this->saturation_[gasPhaseIdx].empty())
+    if (FluidSystem::phaseIsActive(gasPhaseIdx))
     {
-        sol.insert("SGAS", UnitSystem::measure::identity,
-                   std::move(this->saturation_[gasPhaseIdx]),
-                   data::TargetType::RESTART_SOLUTION);
+        insertSolutionArray(sol, "SGAS", UnitSystem::measure::identity,
+                            this->saturation_[gasPhaseIdx],
+                            data::TargetType::RESTART_SOLUTION,
+                            singlePrecisionOutput_);
     }
 
     if (this->CO2H2C_.allocated()) {
         this->CO2H2C_.outputRestart(sol);
     }
 
-    if (FluidSystem::phaseIsActive(waterPhaseIdx) &&
-        ! this->residual_[waterPhaseIdx].empty())
+    if (FluidSystem::phaseIsActive(waterPhaseIdx))
     {
-        sol.insert("RES_WAT", UnitSystem::measure::liquid_surface_volume,
-                   std::move(this->residual_[waterPhaseIdx]),
-                   data::TargetType::RESTART_OPM_EXTENDED);
+        insertSolutionArray(sol, "RES_WAT", UnitSystem::measure::liquid_surface_volume,
+                            this->residual_[waterPhaseIdx],
+                            data::TargetType::RESTART_OPM_EXTENDED,
+                            singlePrecisionOutput_);
     }
-    if (FluidSystem::phaseIsActive(gasPhaseIdx) &&
-        ! this->residual_[gasPhaseIdx].empty())
+    if (FluidSystem::phaseIsActive(gasPhaseIdx))
     {
-        sol.insert("RES_GAS", UnitSystem::measure::gas_surface_volume,
-                   std::move(this->residual_[gasPhaseIdx]),
-                   data::TargetType::RESTART_OPM_EXTENDED);
+        insertSolutionArray(sol, "RES_GAS", UnitSystem::measure::gas_surface_volume,
+                            this->residual_[gasPhaseIdx],
+                            data::TargetType::RESTART_OPM_EXTENDED,
+                            singlePrecisionOutput_);
     }
-    if (FluidSystem::phaseIsActive(oilPhaseIdx) &&
-        ! this->residual_[oilPhaseIdx].empty())
+    if (FluidSystem::phaseIsActive(oilPhaseIdx))
     {
-        sol.insert("RES_OIL", UnitSystem::measure::liquid_surface_volume,
-                   std::move(this->residual_[oilPhaseIdx]),
-                   data::TargetType::RESTART_OPM_EXTENDED);
+        insertSolutionArray(sol, "RES_OIL", UnitSystem::measure::liquid_surface_volume,
+                            this->residual_[oilPhaseIdx],
+                            data::TargetType::RESTART_OPM_EXTENDED,
+                            singlePrecisionOutput_);
     }
 
     // Fluid in place
@@ -631,14 +681,14 @@ doAllocBuffers(const unsigned bufferSize,
                                              !substep,
                                              rstKeywords);
 
-    const auto needAvgPress = !substep         ||
-        !this->RPRNodes_.empty()               ||
-        this->summaryConfig_.hasKeyword("FPR") ||
-        this->summaryConfig_.hasKeyword("FPRP");
+    const auto needAvgPress = !substep ||
+        !this->RPRNodes_.empty()       ||
+        this->hasFPR_                  ||
+        this->hasFPRP_;
 
-    const auto needPoreVolume = needAvgPress    ||
-        this->summaryConfig_.hasKeyword("FHPV") ||
-        this->summaryConfig_.match("RHPV*");
+    const auto needPoreVolume = needAvgPress ||
+        this->hasFHPV_                       ||
+        !this->RHPVNodes_.empty();
 
     if (needPoreVolume) {
         this->fipC_.add(Inplace::Phase::PoreVolume);
@@ -945,6 +995,46 @@ doAllocBuffers(const unsigned bufferSize,
                       });
     }
 
+    // Report the memory footprint of the field arrays that actually got
+    // storage for this report step.  The full 3D arrays dominate the
+    // output module's memory use on large models, so an overview of what
+    // the RPTRST configuration ends up allocating helps when hunting for
+    // unexpected per-rank memory consumption.
+    if (log) {
+        auto numArrays = std::size_t{0};
+        auto numBytes = std::size_t{0};
+        auto addBuffer = [&numArrays, &numBytes](const ScalarBuffer& buffer)
+        {
+            if (!buffer.empty()) {
+                ++numArrays;
+                numBytes += buffer.size() * sizeof(Scalar);
+            }
+        };
+
+        std::ranges::for_each(entries,
+                      [&addBuffer](const auto& entry)
+                      {
+                          std::visit(VisitorOverloadSet{
+                                        [&addBuffer](ScalarBuffer* v)
+                                        { addBuffer(*v); },
+                                        [&addBuffer](std::vector<ScalarBuffer*>* v)
+                                        {
+                                            std::ranges::for_each(*v,
+                                                          [&addBuffer](const ScalarBuffer* b)
+                                                          { addBuffer(*b); });
+                                        },
+                                        [&addBuffer](PhaseArray* v)
+                                        { std::ranges::for_each(*v, addBuffer); }
+                                     }, entry.data);
+                      });
+
+        OpmLog::debug(fmt::format("Allocated {} restart field arrays "
+                                  "({:.1f} MiB per rank) for report step {}.",
+                                  numArrays,
+                                  numBytes / (1024.0 * 1024.0),
+                                  reportStepNum));
+    }
+
     failedCellsPb_.clear();
     failedCellsPd_.clear();
 
@@ -1075,23 +1165,20 @@ updateSummaryRegionValues(const Inplace& inplace,
 {
     // The field summary vectors should only use the FIPNUM based region sum.
     {
-        for (const auto& phase : Inplace::phases()) {
-            const std::string key = "F" + Inplace::EclString(phase);
-            if (this->summaryConfig_.hasKeyword(key)) {
-                miscSummaryData[key] = inplace.get(phase);
-            }
+        for (const auto& [key, phase] : this->fieldInplaceNodes_) {
+            miscSummaryData[key] = inplace.get(phase);
         }
 
-        if (this->summaryConfig_.hasKeyword("FHPV")) {
+        if (this->hasFHPV_) {
             miscSummaryData["FHPV"] = inplace.get(Inplace::Phase::HydroCarbonPV);
         }
 
-        if (this->summaryConfig_.hasKeyword("FOE") && this->initialInplace_) {
+        if (this->hasFOE_ && this->initialInplace_) {
             miscSummaryData["FOE"] = (this->initialInplace_.value().get(Inplace::Phase::OIL) - inplace.get(Inplace::Phase::OIL))
                 / this->initialInplace_.value().get(Inplace::Phase::OIL);
         }
 
-        if (this->summaryConfig_.hasKeyword("FPR")) {
+        if (this->hasFPR_) {
             miscSummaryData["FPR"] =
                 detail::pressureAverage(inplace.get(Inplace::Phase::PressureHydroCarbonPV),
                                         inplace.get(Inplace::Phase::HydroCarbonPV),
@@ -1100,7 +1187,7 @@ updateSummaryRegionValues(const Inplace& inplace,
                                         true);
         }
 
-        if (this->summaryConfig_.hasKeyword("FPRP")) {
+        if (this->hasFPRP_) {
             miscSummaryData["FPRP"] =
                 detail::pressureAverage(inplace.get(Inplace::Phase::PressureHydroCarbonPV),
                                         inplace.get(Inplace::Phase::HydroCarbonPV),
@@ -1143,7 +1230,7 @@ updateSummaryRegionValues(const Inplace& inplace,
                                         false);
         }
 
-        for (const auto& node : this->summaryConfig_.keywords("RHPV*")) {
+        for (const auto& node : this->RHPVNodes_) {
             regionData[node.keyword()] =
                 get_vector(node, Inplace::Phase::HydroCarbonPV);
         }
@@ -61,6 +61,8 @@ namespace Opm::Parameters {
 
 struct ForceDisableFluidInPlaceOutput { static constexpr bool value = false; };
 struct ForceDisableResvFluidInPlaceOutput { static constexpr bool value = false; };
+struct DeferredWellReports { static constexpr bool value = false; };
+struct EclOutputSinglePrecisionPipeline { static constexpr bool value = false; };
 
 } // namespace Opm::Parameters
 
@@ -389,6 +391,7 @@ protected:
     bool forceDisableFipOutput_{false};
     bool forceDisableFipresvOutput_{false};
     bool computeFip_{false};
+    bool singlePrecisionOutput_{false};
 
     FIPContainer<FluidSystem> fipC_;
     std::unordered_map<std::string, std::vector<int>> regions_;
@@ -396,6 +399,16 @@ protected:
 
     std::vector<SummaryConfigNode> RPRNodes_;
     std::vector<SummaryConfigNode> RPRPNodes_;
+    std::vector<SummaryConfigNode> RHPVNodes_;
+
+    // Field-level inplace summary keywords requested by the deck, resolved
+    // once at construction to avoid string-keyed SummaryConfig lookups in
+    // every summary evaluation.
+    std::vector<std::pair<std::string, Inplace::Phase>> fieldInplaceNodes_;
+    bool hasFHPV_{false};
+    bool hasFOE_{false};
+    bool hasFPR_{false};
+    bool hasFPRP_{false};
 
     std::vector<int> failedCellsPb_;
     std::vector<int> failedCellsPd_;
@@ -50,6 +50,7 @@
 namespace Opm {
 
 class EclipseState;
+class TransportTopology;
 class Well;
 
 template<class Grid, class GridView, class DofMapper, class Stencil, class FluidSystem, class Scalar>
@@ -128,6 +129,7 @@ protected:
      */
     void doInit(bool rst,
                 std::size_t numGridDof,
+                const TransportTopology& topology,
                 std::size_t gasPhaseIdx,
                 std::size_t oilPhaseIdx,
                 std::size_t waterPhaseIdx);
@@ -138,6 +140,16 @@ protected:
                                std::vector<TracerVector>& x,
                                std::vector<TracerVector>& b);
 
+#if HAVE_CUDA
+    //! \brief Solve the batch of tracer systems on the GPU via gpuistl.
+    bool gpuLinearSolveBatchwise_(const TracerMatrix& M,
+                                  std::vector<TracerVector>& x,
+                                  std::vector<TracerVector>& b,
+                                  Scalar tolerance,
+                                  int maxIter,
+                                  int verbosity);
+#endif
+
     Scalar currentConcentration_(const Well& eclWell,
                                  const std::string& trName,
                                  const SummaryState& summaryState) const;
@@ -47,16 +47,24 @@
 #include <opm/models/discretization/ecfv/ecfvstencil.hh>
 
 #include <opm/simulators/flow/GenericTracerModel.hpp>
+#include <opm/simulators/flow/TransportTopology.hpp>
+#include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
 #include <opm/simulators/linalg/ilufirstelement.hh>
 #include <opm/simulators/linalg/PropertyTree.hpp>
 #include <opm/simulators/linalg/FlexibleSolver.hpp>
 
+#if HAVE_CUDA
+#include <opm/simulators/linalg/LinearSolverAcceleratorType.hpp>
+#include <opm/simulators/linalg/gpuistl/GpuSparseMatrixWrapper.hpp>
+#include <opm/simulators/linalg/gpuistl/GpuVector.hpp>
+#include <opm/simulators/linalg/gpuistl/detail/FlexibleSolverWrapper.hpp>
+#endif
+
 #include <fmt/format.h>
 
 #include <array>
 #include <functional>
 #include <memory>
-#include <set>
 #include <stdexcept>
 #include <string>
 
@@ -224,7 +232,7 @@ name(int tracerIdx) const
 
 template<class Grid, class GridView, class DofMapper, class Stencil, class FluidSystem, class Scalar>
 void GenericTracerModel<Grid,GridView,DofMapper,Stencil,FluidSystem,Scalar>::
-doInit(bool rst, std::size_t numGridDof,
+doInit(bool rst, std::size_t numGridDof, const TransportTopology& topology,
        std::size_t gasPhaseIdx, std::size_t oilPhaseIdx, std::size_t waterPhaseIdx)
 {
     const auto& tracers = eclState_.tracer();
@@ -346,42 +354,9 @@ doInit(bool rst, std::size_t numGridDof,
         }
     }
 
-    // allocate matrix for storing the Jacobian of the tracer residual
-    tracerMatrix_ = std::make_unique<TracerMatrix>(numGridDof, numGridDof, TracerMatrix::random);
-
-    // find the sparsity pattern of the tracer matrix
-    using NeighborSet = std::set<unsigned>;
-    std::vector<NeighborSet> neighbors(numGridDof);
-
-    Stencil stencil(gridView_, dofMapper_);
-    for (const auto& elem : elements(gridView_)) {
-        stencil.update(elem);
-
-        for (unsigned primaryDofIdx = 0; primaryDofIdx < stencil.numPrimaryDof(); ++primaryDofIdx) {
-            unsigned myIdx = stencil.globalSpaceIndex(primaryDofIdx);
-
-            for (unsigned dofIdx = 0; dofIdx < stencil.numDof(); ++dofIdx) {
-                unsigned neighborIdx = stencil.globalSpaceIndex(dofIdx);
-                neighbors[myIdx].insert(neighborIdx);
-            }
-        }
-    }
-
-    // allocate space for the rows of the matrix
-    for (unsigned dofIdx = 0; dofIdx < numGridDof; ++ dofIdx) {
-        tracerMatrix_->setrowsize(dofIdx, neighbors[dofIdx].size());
-    }
-    tracerMatrix_->endrowsizes();
-
-    // fill the rows with indices. each degree of freedom talks to
-    // all of its neighbors. (it also talks to itself since
-    // degrees of freedom are sometimes quite egocentric.)
-    for (unsigned dofIdx = 0; dofIdx < numGridDof; ++ dofIdx) {
-        for (const auto& index : neighbors[dofIdx]) {
-            tracerMatrix_->addindex(dofIdx, index);
-        }
-    }
-    tracerMatrix_->endindices();
+    // allocate matrix for storing the Jacobian of the tracer residual; the
+    // sparsity pattern is the shared cell-adjacency topology
+    tracerMatrix_ = topology.makeMatrix<TracerMatrix>();
 }
 
 template<class Grid, class GridView, class DofMapper, class Stencil, class FluidSystem, class Scalar>
@@ -482,27 +457,117 @@ linearSolveBatchwise_(const TracerMatrix& M, std::vector<TracerVector>& x, std::
             return true;
         }
 
-        TracerOperator tracerOperator(M);
-        TracerScalarProduct tracerScalarProduct;
-        TracerPreconditioner tracerPreconditioner(M, 0, 1); // results in ILU0
-
-        TracerSolver solver (tracerOperator, tracerScalarProduct,
-                             tracerPreconditioner, tolerance, maxIter,
-                             verbosity);
+#if HAVE_CUDA
+        // When the main flow solve runs on the GPU, solve the tracer batch
+        // there as well: the matrix is uploaded and factorized once and all
+        // right-hand sides are solved back-to-back on device.
+        if (Parameters::linearSolverAcceleratorTypeFromCLI() ==
+            Parameters::LinearSolverAcceleratorType::GPU)
+        {
+            return gpuLinearSolveBatchwise_(M, x, b, tolerance, maxIter, verbosity);
+        }
+#endif
 
+        // The right-hand sides are independent solves with the same matrix,
+        // so they can be distributed over threads.  The preconditioner apply
+        // is stateful, so each thread sets up its own solver; the extra ILU0
+        // factorizations are cheap compared to solving the many tracers of a
+        // batch one after the other.  The ILU factorization and the solve
+        // can throw (e.g. a zero pivot raises Dune::ISTLError), and an
+        // exception escaping an OpenMP block terminates the program, so the
+        // region is funneled through the parallel try-catch.
         bool converged = true;
-        for (std::size_t nrhs = 0; nrhs < b.size(); ++nrhs) {
-            x[nrhs] = 0.0;
-            Dune::InverseOperatorResult result;
-            solver.apply(x[nrhs], b[nrhs], result);
-            converged = (converged && result.converged);
+        OPM_BEGIN_PARALLEL_TRY_CATCH();
+        #ifdef _OPENMP
+        #pragma omp parallel reduction(&& : converged)
+        #endif
+        {
+            TracerOperator tracerOperator(M);
+            TracerScalarProduct tracerScalarProduct;
+            TracerPreconditioner tracerPreconditioner(M, 0, 1); // results in ILU0
+
+            TracerSolver solver (tracerOperator, tracerScalarProduct,
+                                 tracerPreconditioner, tolerance, maxIter,
+                                 verbosity);
+
+            #ifdef _OPENMP
+            #pragma omp for
+            #endif
+            for (std::size_t nrhs = 0; nrhs < b.size(); ++nrhs) {
+                x[nrhs] = 0.0;
+                Dune::InverseOperatorResult result;
+                solver.apply(x[nrhs], b[nrhs], result);
+                converged = (converged && result.converged);
+            }
         }
+        OPM_END_PARALLEL_TRY_CATCH("linearSolveBatchwise_() failed: ",
+                                   gridView_.comm());
 
         // return the result of the solver
         return converged;
     }
 }
 
+#if HAVE_CUDA
+template<class Grid, class GridView, class DofMapper, class Stencil, class FluidSystem, class Scalar>
+bool GenericTracerModel<Grid,GridView,DofMapper,Stencil,FluidSystem,Scalar>::
+gpuLinearSolveBatchwise_(const TracerMatrix& M,
+                         std::vector<TracerVector>& x,
+                         std::vector<TracerVector>& b,
+                         const Scalar tolerance,
+                         const int maxIter,
+                         const int verbosity)
+{
+    OPM_TIMEBLOCK(tracerSolveGpu);
+
+    using GpuTracerMatrix = gpuistl::GpuSparseMatrixWrapper<Scalar>;
+    using GpuTracerVector = gpuistl::GpuVector<Scalar>;
+#if HAVE_MPI
+    using Comm = Dune::OwnerOverlapCopyCommunication<int, int>;
+#else
+    using Comm = Dune::Communication<int>;
+#endif
+    using GpuTracerSolver =
+        gpuistl::detail::FlexibleSolverWrapper<GpuTracerMatrix, GpuTracerVector, Comm>;
+
+    PropertyTree prm;
+    prm.put("maxiter", maxIter);
+    prm.put("tol", tolerance);
+    prm.put("verbosity", verbosity);
+    prm.put("solver", std::string("bicgstab"));
+    prm.put("preconditioner.type", std::string("jac"));
+
+    // Upload the matrix and set up the preconditioner once for the whole
+    // batch of right-hand sides.
+    const auto gpuM = GpuTracerMatrix::fromMatrix(M);
+    GpuTracerSolver solver(gpuM,
+                           /*parallel=*/false,
+                           prm,
+                           /*pressureIndex=*/0,
+                           /*weightCalculator=*/{},
+                           /*forceSerial=*/true,
+                           /*comm=*/nullptr);
+
+    GpuTracerVector gpuX(x.front());
+    GpuTracerVector gpuB(b.front());
+
+    bool converged = true;
+    for (std::size_t nrhs = 0; nrhs < b.size(); ++nrhs) {
+        x[nrhs] = 0.0;
+        gpuX.copyFromHost(x[nrhs]);
+        gpuB.copyFromHost(b[nrhs]);
+
+        Dune::InverseOperatorResult result;
+        solver.apply(gpuX, gpuB, result);
+        converged = (converged && result.converged);
+
+        gpuX.copyToHost(x[nrhs]);
+    }
+
+    return converged;
+}
+#endif
+
 } // namespace Opm
 
 #endif // OPM_GENERIC_TRACER_MODEL_IMPL_HPP
@@ -83,6 +83,20 @@ namespace Opm {
                            const Cell& destination,
                            const data::InterRegFlowMap::FlowRates& rates);
 
+        /// Whether or not two cells belong to different regions.
+        ///
+        /// Cheap query intended to filter out intra-region connections
+        /// before the associate flow rates are computed.  Must not be
+        /// called on objects reconstituted from an input stream.
+        ///
+        /// \param[in] cell1 First cell's active index on local rank.
+        ///
+        /// \param[in] cell2 Second cell's active index on local rank.
+        bool isInterRegion(const int cell1, const int cell2) const
+        {
+            return this->region_[cell1] != this->region_[cell2];
+        }
+
         /// Form CSR adjacency matrix representation of input graph from
         /// connections established in previous calls to addConnection().
         ///
@@ -243,6 +257,23 @@ namespace Opm {
                            const Cell& destination,
                            const data::InterRegFlowMap::FlowRates& rates);
 
+        /// Whether or not any region definition array assigns two cells
+        /// to different regions.
+        ///
+        /// The region definitions are fixed for the duration of the run,
+        /// so connections for which this predicate is \c false can be
+        /// skipped without computing their flow rates.
+        ///
+        /// \param[in] cell1 First cell's active index on local rank.
+        ///
+        /// \param[in] cell2 Second cell's active index on local rank.
+        bool isInterRegion(const int cell1, const int cell2) const
+        {
+            return std::ranges::any_of(this->regionMaps_,
+                                       [cell1, cell2](const auto& regionMap)
+                                       { return regionMap.isInterRegion(cell1, cell2); });
+        }
+
         /// Form CSR adjacency matrix representation of input graph from
         /// connections established in previous calls to addConnection().
         ///
@@ -37,6 +37,8 @@
 
 #include <opm/output/eclipse/report/WellSpecification.hpp>
 
+#include <opm/models/parallel/tasklets.hpp>
+
 #include <opm/simulators/utils/moduleVersion.hpp>
 #include <opm/simulators/utils/PressureAverage.hpp>
 
@@ -44,9 +46,12 @@
 #include <cmath>
 #include <functional>
 #include <iomanip>
+#include <memory>
+#include <mutex>
 #include <numeric>
 #include <sstream>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -167,19 +172,109 @@ template<class Scalar>
 LogOutputHelper<Scalar>::LogOutputHelper(const EclipseState& eclState,
                                          const Schedule& schedule,
                                          const SummaryState& summaryState,
-                                         const std::string& moduleVersionName)
+                                         const std::string& moduleVersionName,
+                                         const bool deferredFormatting)
     : eclState_(eclState)
     , schedule_(schedule)
     , summaryState_(summaryState)
     , flowVersionName_(moduleVersionName)
+    , reportRunner_(deferredFormatting
+                    ? std::make_unique<TaskletRunner>(1)
+                    : nullptr)
 {}
 
+template<class Scalar>
+LogOutputHelper<Scalar>::~LogOutputHelper()
+{
+    if (this->reportRunner_) {
+        // Wait for any in-flight formatting and emit the results so that
+        // no report is lost at the end of the simulation.
+        this->reportRunner_->barrier();
+        this->drainCompletedReports_();
+    }
+}
+
+namespace {
+
+//! \brief Tasklet formatting one report table in the background.
+//!
+//! The finished log messages are appended to the owning helper's queue of
+//! completed reports from whence the simulation thread emits them.
+class ReportFormatTasklet : public TaskletInterface
+{
+public:
+    using FormatCallback = std::function<std::vector<std::string>()>;
+
+    ReportFormatTasklet(FormatCallback format,
+                        std::mutex& mtx,
+                        std::vector<std::vector<std::string>>& completed)
+        : format_(std::move(format))
+        , mtx_(mtx)
+        , completed_(completed)
+    {}
+
+    void run() override
+    {
+        auto messages = this->format_();
+
+        const std::lock_guard<std::mutex> guard(this->mtx_);
+        this->completed_.push_back(std::move(messages));
+    }
+
+private:
+    FormatCallback format_;
+    std::mutex& mtx_;
+    std::vector<std::vector<std::string>>& completed_;
+};
+
+} // Namespace anonymous
+
+template<class Scalar>
+void LogOutputHelper<Scalar>::drainCompletedReports_() const
+{
+    auto completed = std::vector<std::vector<std::string>>{};
+    {
+        const std::lock_guard<std::mutex> guard(this->completedReportsMutex_);
+        completed.swap(this->completedReports_);
+    }
+
+    for (const auto& messages : completed) {
+        for (const auto& message : messages) {
+            OpmLog::note(message);
+        }
+    }
+}
+
+template<class Scalar>
+template<typename FormatReport>
+void LogOutputHelper<Scalar>::emitReport_(FormatReport&& format) const
+{
+    if (! this->reportRunner_) {
+        for (const auto& message : format()) {
+            OpmLog::note(message);
+        }
+
+        return;
+    }
+
+    // Emit whatever earlier reports have finished formatting by now.  The
+    // single worker thread runs the tasklets in dispatch order, so the
+    // completed reports always form an in-order prefix of the dispatched
+    // ones.
+    this->drainCompletedReports_();
+
+    this->reportRunner_->dispatch
+        (std::make_shared<ReportFormatTasklet>(std::forward<FormatReport>(format),
+                                               this->completedReportsMutex_,
+                                               this->completedReports_));
+}
+
 template<class Scalar>
 void LogOutputHelper<Scalar>::
 cumulative(const std::size_t reportStepNum,
            const bool        withConns) const
 {
-    this->beginCumulativeReport_();
+    auto records = std::vector<ReportRecord>{};
 
     using Ix = typename WellCumDataType::WCId;
 
@@ -201,7 +296,7 @@ cumulative(const std::size_t reportStepNum,
         values[Ix::GasInj]          = isField ? st.get("FGIT", 0.0) : st.get_group_var(gname, "GGIT", 0.0);
         values[Ix::FluidResVolInj]  = isField ? st.get("FVIT", 0.0) : st.get_group_var(gname, "GVIT", 0.0);
 
-        this->outputCumulativeReportRecord_(values, names, {});
+        records.push_back(ReportRecord { std::move(values), std::move(names), {} });
     }
 
     for (const auto& wname : this->schedule_[reportStepNum].well_order()) {
@@ -264,10 +359,37 @@ cumulative(const std::size_t reportStepNum,
             }
         }
 
-        this->outputCumulativeReportRecord_(values, names, connData);
+        records.push_back(ReportRecord {
+            std::move(values), std::move(names), std::move(connData) });
+    }
+
+    if (this->reportRunner_) {
+        if (records == this->lastCumulativeRecords_) {
+            // Table is identical to the one emitted for the previous
+            // report step; skip re-emission entirely.
+            return;
+        }
+
+        this->lastCumulativeRecords_ = records;
     }
 
-    this->endCumulativeReport_();
+    this->emitReport_([this, records = std::move(records)]()
+    {
+        auto out = std::vector<std::string>{};
+
+        this->beginCumulativeReport_(out);
+
+        for (const auto& record : records) {
+            this->outputCumulativeReportRecord_(record.values,
+                                                record.names,
+                                                record.connData,
+                                                out);
+        }
+
+        this->endCumulativeReport_(out);
+
+        return out;
+    });
 }
 
 template<class Scalar>
@@ -443,7 +565,7 @@ timeStamp(const std::string& lbl, double elapsed, int rstep, boost::posix_time::
         << "  *                                             Flow  version " << std::setw(11) << flowVersionName_ << "  *\n"
         << "                              **************************************************************************\n";
 
-    OpmLog::note(ss.str());
+    this->emitReport_([msg = ss.str()]() { return std::vector<std::string> { msg }; });
 }
 
 template<class Scalar>
@@ -451,7 +573,7 @@ void LogOutputHelper<Scalar>::
 injection(const std::size_t reportStepNum,
           const std::map<std::pair<std::string,int>, double>& block_pressures) const
 {
-    this->beginInjectionReport_();
+    auto records = std::vector<ReportRecord>{};
 
     using Ix = typename WellInjDataType::WIId;
 
@@ -470,7 +592,7 @@ injection(const std::size_t reportStepNum,
         values[Ix::GasRate]     = isField ? st.get("FGIR", 0.0) : st.get_group_var(gname, "GGIR", 0.0);
         values[Ix::FluidResVol] = isField ? st.get("FVIR", 0.0) : st.get_group_var(gname, "GVIR", 0.0);
 
-        this->outputInjectionReportRecord_(values, names, {});
+        records.push_back(ReportRecord { std::move(values), std::move(names), {} });
     }
 
     for (const auto& wname : this->schedule_[reportStepNum].well_order()) {
@@ -541,10 +663,37 @@ injection(const std::size_t reportStepNum,
             }
         }
 
-        this->outputInjectionReportRecord_(values, names, connData);
+        records.push_back(ReportRecord {
+            std::move(values), std::move(names), std::move(connData) });
     }
 
-    this->endInjectionReport_();
+    if (this->reportRunner_) {
+        if (records == this->lastInjectionRecords_) {
+            // Table is identical to the one emitted for the previous
+            // report step; skip re-emission entirely.
+            return;
+        }
+
+        this->lastInjectionRecords_ = records;
+    }
+
+    this->emitReport_([this, records = std::move(records)]()
+    {
+        auto out = std::vector<std::string>{};
+
+        this->beginInjectionReport_(out);
+
+        for (const auto& record : records) {
+            this->outputInjectionReportRecord_(record.values,
+                                               record.names,
+                                               record.connData,
+                                               out);
+        }
+
+        this->endInjectionReport_(out);
+
+        return out;
+    });
 }
 
 template<class Scalar>
@@ -564,13 +713,21 @@ msw(const std::size_t reportStepNum) const
         return;
     }
 
-    this->beginMSWReport_();
+    // Note: The segment report is formatted eagerly--its records read the
+    // summary state, which must not be accessed from the background
+    // thread--but still routed through emitReport_() so that it keeps its
+    // place relative to the deferred well reports.
+    auto out = std::vector<std::string>{};
+
+    this->beginMSWReport_(out);
 
     std::ranges::for_each(msWells,
-                          [this](const Well& well)
-                          { this->outputMSWReportRecord_(well); });
+                          [this, &out](const Well& well)
+                          { this->outputMSWReportRecord_(well, out); });
 
-    this->endMSWReport_();
+    this->endMSWReport_(out);
+
+    this->emitReport_([out = std::move(out)]() { return out; });
 }
 
 
@@ -579,7 +736,7 @@ void LogOutputHelper<Scalar>::
 production(const std::size_t reportStepNum,
            const std::map<std::pair<std::string,int>,double>& block_pressures) const
 {
-    this->beginProductionReport_();
+    auto records = std::vector<ReportRecord>{};
 
     using Ix = typename WellProdDataType::WPId;
 
@@ -608,7 +765,7 @@ production(const std::size_t reportStepNum,
             values[Ix::WatGasRatio] = 0.0;
         }
 
-        this->outputProductionReportRecord_(values, names, {});
+        records.push_back(ReportRecord { std::move(values), std::move(names), {} });
     }
 
     for (const auto& wname : this->schedule_[reportStepNum].well_order()) {
@@ -677,10 +834,37 @@ production(const std::size_t reportStepNum,
             }
         }
 
-        this->outputProductionReportRecord_(values, names, connData);
+        records.push_back(ReportRecord {
+            std::move(values), std::move(names), std::move(connData) });
+    }
+
+    if (this->reportRunner_) {
+        if (records == this->lastProductionRecords_) {
+            // Table is identical to the one emitted for the previous
+            // report step; skip re-emission entirely.
+            return;
+        }
+
+        this->lastProductionRecords_ = records;
     }
 
-    this->endProductionReport_();
+    this->emitReport_([this, records = std::move(records)]()
+    {
+        auto out = std::vector<std::string>{};
+
+        this->beginProductionReport_(out);
+
+        for (const auto& record : records) {
+            this->outputProductionReportRecord_(record.values,
+                                                record.names,
+                                                record.connData,
+                                                out);
+        }
+
+        this->endProductionReport_(out);
+
+        return out;
+    });
 }
 
 template<class Scalar>
@@ -707,7 +891,7 @@ wellSpecification(const std::vector<std::string>& changedWells,
 }
 
 template <typename Scalar>
-void LogOutputHelper<Scalar>::beginCumulativeReport_() const
+void LogOutputHelper<Scalar>::beginCumulativeReport_(std::vector<std::string>& out) const
 {
     const auto& units = this->eclState_.getUnits();
     const auto widths = std::array{8, 11, 8, 4, 11, 11, 11, 11, 11, 11, 11, 11};
@@ -805,21 +989,22 @@ void LogOutputHelper<Scalar>::beginCumulativeReport_() const
        << formatTextRow(widths, unitStrings)
        << fmt::format("{:=>132}", "");
 
-    OpmLog::note(ss.str());
+    out.push_back(ss.str());
 }
 
 template <typename Scalar>
-void LogOutputHelper<Scalar>::endCumulativeReport_() const
+void LogOutputHelper<Scalar>::endCumulativeReport_(std::vector<std::string>& out) const
 {
     const auto widths = std::array{8, 11, 8, 4, 11, 11, 11, 11, 11, 11, 11, 11};
-    OpmLog::note(formatBorder(widths));
+    out.push_back(formatBorder(widths));
 }
 
 template<class Scalar>
 void LogOutputHelper<Scalar>::
 outputCumulativeReportRecord_(const std::vector<Scalar>& wellCum,
                               const std::vector<std::string>& wellCumNames,
-                              const std::vector<ConnData>& connData) const
+                              const std::vector<ConnData>& connData,
+                              std::vector<std::string>& out) const
 {
     std::ostringstream ss;
 
@@ -874,11 +1059,11 @@ outputCumulativeReportRecord_(const std::vector<Scalar>& wellCum,
                           scaledValue(conn.data, WellCumDataType::WCId::FluidResVolInj));
     }
 
-    OpmLog::note(ss.str());
+    out.push_back(ss.str());
 }
 
 template <typename Scalar>
-void LogOutputHelper<Scalar>::beginInjectionReport_() const
+void LogOutputHelper<Scalar>::beginInjectionReport_(std::vector<std::string>& out) const
 {
     const auto& units = this->eclState_.getUnits();
     const auto widths = std::array{8, 11, 6, 6, 6, 11, 11, 11, 11, 8, 8};
@@ -973,21 +1158,22 @@ void LogOutputHelper<Scalar>::beginInjectionReport_() const
        << formatTextRow(widths, unitStrings)
        << fmt::format("{:=>109}", "");
 
-    OpmLog::note(ss.str());
+    out.push_back(ss.str());
 }
 
 template <typename Scalar>
-void LogOutputHelper<Scalar>::endInjectionReport_() const
+void LogOutputHelper<Scalar>::endInjectionReport_(std::vector<std::string>& out) const
 {
     const auto widths = std::array{8, 11, 6, 6, 6, 11, 11, 11, 11, 8, 8};
-    OpmLog::note(formatBorder(widths));
+    out.push_back(formatBorder(widths));
 }
 
 template<class Scalar>
 void LogOutputHelper<Scalar>::
 outputInjectionReportRecord_(const std::vector<Scalar>& wellInj,
                              const std::vector<std::string>& wellInjNames,
-                             const std::vector<ConnData>& connData) const
+                             const std::vector<ConnData>& connData,
+                             std::vector<std::string>& out) const
 {
     const auto isWellRecord =
         wellInj[WellProdDataType::WellLocationi] >= 1;
@@ -1034,11 +1220,11 @@ outputInjectionReportRecord_(const std::vector<Scalar>& wellInj,
                           conn.data[WellInjDataType::BPR]);
     }
 
-    OpmLog::note(ss.str());
+    out.push_back(ss.str());
 }
 
 template <typename Scalar>
-void LogOutputHelper<Scalar>::beginMSWReport_() const
+void LogOutputHelper<Scalar>::beginMSWReport_(std::vector<std::string>& out) const
 {
     const auto& units = this->eclState_.getUnits();
     const auto widths  = std::array{10, 5, 5, 11, 11, 11, 9, 16, 9, 8, 8, 8};
@@ -1093,19 +1279,20 @@ void LogOutputHelper<Scalar>::beginMSWReport_() const
                         })
        << fmt::format("{:=>124}", "");
 
-    OpmLog::note(ss.str());
+    out.push_back(ss.str());
 }
 
 template <typename Scalar>
-void LogOutputHelper<Scalar>::endMSWReport_() const
+void LogOutputHelper<Scalar>::endMSWReport_(std::vector<std::string>& out) const
 {
     const auto widths = std::array{10, 5, 5, 11, 11, 11, 9, 16, 9, 8, 8, 8};
-    OpmLog::note(formatBorder(widths));
+    out.push_back(formatBorder(widths));
 }
 
 template<class Scalar>
 void LogOutputHelper<Scalar>::
-outputMSWReportRecord_(const Well& well) const
+outputMSWReportRecord_(const Well& well,
+                       std::vector<std::string>& out) const
 {
     const auto& st = this->summaryState_;
 
@@ -1183,11 +1370,11 @@ outputMSWReportRecord_(const Well& well) const
             first = false;
         }
     }
-    OpmLog::note(ss.str());
+    out.push_back(ss.str());
 }
 
 template <typename Scalar>
-void LogOutputHelper<Scalar>::beginProductionReport_() const
+void LogOutputHelper<Scalar>::beginProductionReport_(std::vector<std::string>& out) const
 {
     const auto& units = this->eclState_.getUnits();
     const auto widths = std::array{8, 11, 4, 11, 11, 11, 11, 11, 10, 12, 8, 8};
@@ -1315,21 +1502,22 @@ void LogOutputHelper<Scalar>::beginProductionReport_() const
        << formatTextRow(widths, unitStrings)
        << fmt::format("{:=>129}", "");
 
-    OpmLog::note(ss.str());
+    out.push_back(ss.str());
 }
 
 template <typename Scalar>
-void LogOutputHelper<Scalar>::endProductionReport_() const
+void LogOutputHelper<Scalar>::endProductionReport_(std::vector<std::string>& out) const
 {
     const auto widths = std::array{8, 11, 4, 11, 11, 11, 11, 11, 10, 12, 8, 8};
-    OpmLog::note(formatBorder(widths));
+    out.push_back(formatBorder(widths));
 }
 
 template<class Scalar>
 void LogOutputHelper<Scalar>::
 outputProductionReportRecord_(const std::vector<Scalar>& wellProd,
                               const std::vector<std::string>& wellProdNames,
-                              const std::vector<ConnData>& connData) const
+                              const std::vector<ConnData>& connData,
+                              std::vector<std::string>& out) const
 {
     const auto isWellRecord =
         wellProd[WellProdDataType::WellLocationi] >= 1;
@@ -1381,7 +1569,7 @@ outputProductionReportRecord_(const std::vector<Scalar>& wellProd,
                           conn.data[WellProdDataType::BPR]);
     }
 
-    OpmLog::note(ss.str());
+    out.push_back(ss.str());
 }
 
 template<class Scalar>
@@ -26,6 +26,8 @@
 
 #include <cstddef>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -39,15 +41,26 @@ class EclipseState;
 class Inplace;
 class Schedule;
 class SummaryState;
+class TaskletRunner;
 class Well;
 
 template<class Scalar>
 class LogOutputHelper {
 public:
+    //! \brief Constructor.
+    //!
+    //! \param[in] deferredFormatting If set, the well/group report tables
+    //! are formatted by a background thread and emitted to the log from a
+    //! later report call, so that formatting never blocks time stepping.
+    //! Tables which are unchanged since the previous report step are not
+    //! re-emitted in this mode.
     LogOutputHelper(const EclipseState& eclState,
                     const Schedule& schedule,
                     const SummaryState& st,
-                    const std::string& moduleVersionName);
+                    const std::string& moduleVersionName,
+                    const bool deferredFormatting = false);
+
+    ~LogOutputHelper();
 
     //! \brief Write cumulative production and injection reports to output.
     void cumulative(const std::size_t reportStepNum,
@@ -107,13 +120,44 @@ private:
 
         int I, J, K;
         std::vector<Scalar> data;
+
+        bool operator==(const ConnData&) const = default;
+    };
+
+    //! \brief One well or group record of a well report.
+    //!
+    //! Holds the raw values of a report table row so that the expensive
+    //! string formatting can be deferred to a background thread and
+    //! unchanged tables can be detected without formatting them.
+    struct ReportRecord
+    {
+        std::vector<Scalar> values;
+        std::vector<std::string> names;
+        std::vector<ConnData> connData;
+
+        bool operator==(const ReportRecord&) const = default;
     };
 
-    void beginCumulativeReport_() const;
-    void endCumulativeReport_() const;
+    //! \brief Emit a report through a formatting callback.
+    //!
+    //! \p format returns the report as a sequence of log messages.  In
+    //! synchronous mode the callback runs and the messages are logged
+    //! immediately.  In deferred mode the callback is dispatched to the
+    //! background formatting thread and the finished messages are logged
+    //! from the simulation thread by a later report call, or ultimately
+    //! by the destructor.
+    template <typename FormatReport>
+    void emitReport_(FormatReport&& format) const;
+
+    //! \brief Log any background-formatted reports which have completed.
+    void drainCompletedReports_() const;
+
+    void beginCumulativeReport_(std::vector<std::string>& out) const;
+    void endCumulativeReport_(std::vector<std::string>& out) const;
     void outputCumulativeReportRecord_(const std::vector<Scalar>& wellCum,
                                        const std::vector<std::string>& wellCumNames,
-                                       const std::vector<ConnData>& connData) const;
+                                       const std::vector<ConnData>& connData,
+                                       std::vector<std::string>& out) const;
 
     void outputRegionFluidInPlace_(std::unordered_map<Inplace::Phase, Scalar> oip,
                                    std::unordered_map<Inplace::Phase, Scalar> cip,
@@ -124,21 +168,24 @@ private:
     void outputResvFluidInPlace_(std::unordered_map<Inplace::Phase, Scalar> cipr,
                                  const int reg) const;
 
-    void beginInjectionReport_() const;
-    void endInjectionReport_() const;
+    void beginInjectionReport_(std::vector<std::string>& out) const;
+    void endInjectionReport_(std::vector<std::string>& out) const;
     void outputInjectionReportRecord_(const std::vector<Scalar>& wellInj,
                                       const std::vector<std::string>& wellInjNames,
-                                      const std::vector<ConnData>& connData) const;
+                                      const std::vector<ConnData>& connData,
+                                      std::vector<std::string>& out) const;
 
-    void beginMSWReport_() const;
-    void endMSWReport_() const;
-    void outputMSWReportRecord_(const Well& well) const;
+    void beginMSWReport_(std::vector<std::string>& out) const;
+    void endMSWReport_(std::vector<std::string>& out) const;
+    void outputMSWReportRecord_(const Well& well,
+                                std::vector<std::string>& out) const;
 
-    void beginProductionReport_() const;
-    void endProductionReport_() const;
+    void beginProductionReport_(std::vector<std::string>& out) const;
+    void endProductionReport_(std::vector<std::string>& out) const;
     void outputProductionReportRecord_(const std::vector<Scalar>& wellProd,
                                        const std::vector<std::string>& wellProdNames,
-                                       const std::vector<ConnData>& connData) const;
+                                       const std::vector<ConnData>& connData,
+                                       std::vector<std::string>& out) const;
 
     void fipUnitConvert_(std::unordered_map<Inplace::Phase, Scalar>& fip) const;
     void pressureUnitConvert_(Scalar& pav) const;
@@ -219,6 +266,21 @@ private:
     const Schedule& schedule_;
     const SummaryState& summaryState_;
     std::string flowVersionName_;
+
+    //! \brief Single-threaded runner for background report formatting.
+    //! Nullptr in synchronous mode.
+    std::unique_ptr<TaskletRunner> reportRunner_;
+
+    //! \brief Completed background-formatted reports awaiting emission
+    //! from the simulation thread.  Guarded by \c completedReportsMutex_.
+    mutable std::vector<std::vector<std::string>> completedReports_;
+    mutable std::mutex completedReportsMutex_;
+
+    //! \brief Most recently emitted report records, used to skip
+    //! re-emission of unchanged tables in deferred mode.
+    mutable std::vector<ReportRecord> lastCumulativeRecords_;
+    mutable std::vector<ReportRecord> lastInjectionRecords_;
+    mutable std::vector<ReportRecord> lastProductionRecords_;
 };
 
 } // namespace Opm
@@ -48,6 +48,7 @@
 #include <omp.h>
 #endif
 
+#include <filesystem>
 #include <iostream>
 // NOTE: There is no C++ header replacement for these C posix headers (as of C++17)
 #include <fcntl.h>  // for open()
@@ -287,6 +288,7 @@ void Main::readDeck(const std::string& deckFilename,
                     const std::string& parsingStrictness,
                     const std::string& actionParsingStrictness,
                     const std::string& inputSkipMode,
+                    const bool useDeckSnapshot,
                     const bool keepKeywords,
                     const std::size_t numThreads,
                     const int output_param,
@@ -311,6 +313,22 @@ void Main::readDeck(const std::string& deckFilename,
     if (output_param >= 0)
         outputInterval = output_param;
 
+    // The deck snapshot lives next to the other result files.  Mirror the
+    // output directory fallback used by setupLogging() when no explicit
+    // output directory has been requested.
+    std::string deckSnapshotFile;
+    if (useDeckSnapshot) {
+        namespace fs = std::filesystem;
+        const auto fpath = fs::path { deckFilename };
+        auto dir = fs::path { outputDir };
+        if (dir.empty()) {
+            dir = fpath.has_parent_path()
+                ? fs::absolute(fpath.parent_path())
+                : fs::current_path();
+        }
+        deckSnapshotFile = (dir / fpath.stem()).string() + ".OPMSNAP";
+    }
+
     Opm::readDeck(FlowGenericVanguard::comm(),
                   deckFilename,
                   eclipseState_,
@@ -327,7 +345,8 @@ void Main::readDeck(const std::string& deckFilename,
                   outputCout_,
                   keepKeywords,
                   outputInterval,
-                  slaveMode);
+                  slaveMode,
+                  deckSnapshotFile);
 
     verifyValidCellGeometry(FlowGenericVanguard::comm(), *this->eclipseState_);
 
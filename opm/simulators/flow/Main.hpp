@@ -310,6 +310,7 @@ protected:
                            Parameters::Get<Parameters::ParsingStrictness>(),
                            Parameters::Get<Parameters::ActionParsingStrictness>(),
                            Parameters::Get<Parameters::InputSkipMode>(),
+                           Parameters::Get<Parameters::UseDeckSnapshot>(),
                            keepKeywords,
                            getNumThreads(),
                            Parameters::Get<Parameters::EclOutputInterval>(),
@@ -512,6 +513,7 @@ private:
                   const std::string& parsingStrictness,
                   const std::string& actionParsingStrictness,
                   const std::string& inputSkipMode,
+                  const bool useDeckSnapshot,
                   const bool keepKeywords,
                   const std::size_t numThreads,
                   const int output_param,
@@ -151,6 +151,57 @@ void writeNonlinearIterationsPerCell(
     }
 }
 
+/**
+ * Writes the accumulated per-domain cost breakdown to a CSV file per rank.
+ *
+ * One row per domain with cell/well counts, iteration counts and the
+ * timing split of the local solves.  Intended for offline tuning of the
+ * NLDD parameters (number of domains, local tolerances, partitioning
+ * method): the files from a parameter sweep can be aggregated with
+ * bin/nldd_bench.py.
+ *
+ * @param odir The output directory
+ * @param domains The subdomains
+ * @param domain_reports The accumulated reports per domain
+ * @param comm The communication object for parallel runs
+ */
+template <class Domain>
+void writeDomainCostBreakdown(
+    const std::filesystem::path& odir,
+    const std::vector<Domain>& domains,
+    const std::vector<SimulatorReport>& domain_reports,
+    const Parallel::Communication& comm)
+{
+    const int rank = comm.rank();
+    const auto nDigit = 1 + static_cast<int>(std::floor(std::log10(comm.size())));
+    std::ofstream csv { odir / fmt::format(fmt::runtime("nldd_domain_costs_{1:0>{0}}.csv"),
+                                           nDigit, rank) };
+
+    csv << "rank,domain,cells,wells,newton_iterations,linearizations,"
+           "linear_iterations,assemble_time,assemble_time_well,"
+           "linear_solve_setup_time,linear_solve_time,update_time,"
+           "pre_post_time,total_time\n";
+
+    const auto dr_size = domain_reports.size();
+    for (auto i = 0*dr_size; i < dr_size; ++i) {
+        const auto& s = domain_reports[i].success;
+        const auto& f = domain_reports[i].failure;
+        csv << rank << ',' << i << ','
+            << domains[i].cells.size() << ','
+            << s.num_wells << ','
+            << (s.total_newton_iterations + f.total_newton_iterations) << ','
+            << (s.total_linearizations + f.total_linearizations) << ','
+            << (s.total_linear_iterations + f.total_linear_iterations) << ','
+            << (s.assemble_time + f.assemble_time) << ','
+            << (s.assemble_time_well + f.assemble_time_well) << ','
+            << (s.linear_solve_setup_time + f.linear_solve_setup_time) << ','
+            << (s.linear_solve_time + f.linear_solve_time) << ','
+            << (s.update_time + f.update_time) << ','
+            << (s.pre_post_time + f.pre_post_time) << ','
+            << (s.total_time + f.total_time) << '\n';
+    }
+}
+
 /**
  * Writes the partition vector to a file in ResInsight compatible format and a partition file for each rank
  *
@@ -37,6 +37,8 @@
 #include <opm/simulators/timestepping/SimulatorTimerInterface.hpp>
 #include <opm/simulators/timestepping/TimeStepControl.hpp>
 
+#include <opm/simulators/utils/ParallelCommunication.hpp>
+
 #include <memory>
 
 namespace Opm::Parameters {
@@ -181,6 +183,21 @@ struct NonlinearSolverParameters
             }
 
             report.converged = true;
+
+            // Fold the communication wait times accumulated since the
+            // last harvest into the report. Waits between solver steps
+            // (e.g. output gathers) are credited to the following step,
+            // which keeps the cumulative totals exact.
+            {
+                using Parallel::WaitClass;
+                const auto waits = Parallel::WaitTimes::takeStep();
+                report.comm_wait_assembly = waits[static_cast<std::size_t>(WaitClass::Assembly)];
+                report.comm_wait_wells = waits[static_cast<std::size_t>(WaitClass::Wells)];
+                report.comm_wait_linear_solve = waits[static_cast<std::size_t>(WaitClass::LinearSolve)];
+                report.comm_wait_output = waits[static_cast<std::size_t>(WaitClass::Output)];
+                report.comm_wait_other = waits[static_cast<std::size_t>(WaitClass::Other)];
+            }
+
             return report;
         }
 
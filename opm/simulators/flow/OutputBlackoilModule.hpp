@@ -282,6 +282,13 @@ public:
             }
 
             Extractor::process(ectx, extractors_);
+
+            // Fluid-in-place accumulation rides along this sweep while the
+            // intensive quantities are hot in cache.  All contributions are
+            // per-cell buffer writes, so no cross-cell merging is needed.
+            this->updateFluidInPlace_(ectx.globalDofIdx, intQuants,
+                                      elemCtx.simulator().model()
+                                          .dofTotalVolume(ectx.globalDofIdx));
         }
     }
 
@@ -472,6 +479,12 @@ public:
             const auto left  = identifyCell(stencil.element(face.interiorIndex()));
             const auto right = identifyCell(stencil.element(face.exteriorIndex()));
 
+            if (! this->interRegionFlows_.isInterRegion(left.activeIndex, right.activeIndex)) {
+                // Connection is internal to a region in every region set.
+                // No need to compute its surface rates.
+                continue;
+            }
+
             const auto rates = this->
                 getComponentSurfaceRates(elemCtx, face.area(), scvfIdx, timeIdx);
 
@@ -479,6 +492,47 @@ public:
         }
     }
 
+    /*!
+     * \brief Mark the cells which have at least one inter-region
+     *    connection in some region set.
+     *
+     * The region definition arrays are fixed for the duration of the run,
+     * so the marks can be computed once and used to skip cells without
+     * inter-region connections when capturing connection fluxes.  Only
+     * the stencil of \p elemCtx needs to be valid here.
+     *
+     * \tparam ActiveIndex Callable type, typically a lambda, mapping an
+     *    element to its active index on the local MPI rank.
+     *
+     * \param[in] elemCtx Primary lookup structure for per-cell/element
+     *    static information.
+     *
+     * \param[in] activeIndex Mapping from cell/elements to linear indices
+     *    on local MPI rank.
+     *
+     * \param[in,out] interRegionCells Per-cell marks, indexed by active
+     *    index.  Updated for the cells of the current stencil.
+     */
+    template <class ActiveIndex>
+    void markInterRegionCells(const ElementContext& elemCtx,
+                              ActiveIndex&&         activeIndex,
+                              std::vector<bool>&    interRegionCells) const
+    {
+        const auto timeIdx = 0u;
+        const auto& stencil = elemCtx.stencil(timeIdx);
+        const auto numInteriorFaces = elemCtx.numInteriorFaces(timeIdx);
+
+        for (auto scvfIdx = 0 * numInteriorFaces; scvfIdx < numInteriorFaces; ++scvfIdx) {
+            const auto& face = stencil.interiorFace(scvfIdx);
+            const auto left  = activeIndex(stencil.element(face.interiorIndex()));
+            const auto right = activeIndex(stencil.element(face.exteriorIndex()));
+
+            if (this->interRegionFlows_.isInterRegion(left, right)) {
+                interRegionCells[left] = interRegionCells[right] = true;
+            }
+        }
+    }
+
     /*!
      * \brief Prepare for capturing connection fluxes, particularly to
      *    account for inter-region flows.
@@ -1167,41 +1221,63 @@ private:
         const bool hasResidual = simulator_.model().linearizer().residual().size() > 0;
         const auto& hysteresisConfig = simulator_.problem().materialLawManager()->hysteresisConfig();
 
+        const auto anyPhaseBufferAllocated = [](const auto&... phaseArrays)
+        {
+            return ((std::ranges::any_of(phaseArrays,
+                                         [](const auto& buffer)
+                                         { return !buffer.empty(); })) || ...);
+        };
+
         auto extractors = std::array{
-            Entry{PhaseEntry{&this->saturation_,
-                             [](const unsigned phase, const Context& ectx)
-                             { return getValue(ectx.fs.saturation(phase)); }
-                  }
-            },
-            Entry{PhaseEntry{&this->invB_,
-                            [](const unsigned phase, const Context& ectx)
-                            { return getValue(ectx.fs.invB(phase)); }
-                  }
-            },
-            Entry{PhaseEntry{&this->density_,
-                             [](const unsigned phase, const Context& ectx)
-                             { return getValue(ectx.fs.density(phase)); }
-                  }
-            },
-            Entry{PhaseEntry{&this->relativePermeability_,
-                            [](const unsigned phase, const Context& ectx)
-                            { return getValue(ectx.intQuants.relativePermeability(phase)); }
-                  }
-            },
-            Entry{PhaseEntry{&this->viscosity_,
-                             [this](const unsigned phaseIdx, const Context& ectx)
-                             {
-                                if (this->extboC_.allocated() && phaseIdx == oilPhaseIdx) {
-                                    return getValue(ectx.intQuants.oilViscosity());
-                                }
-                                else if (this->extboC_.allocated() && phaseIdx == gasPhaseIdx) {
-                                    return getValue(ectx.intQuants.gasViscosity());
-                                }
-                                else {
-                                    return getValue(ectx.fs.viscosity(phaseIdx));
-                                }
-                             }
-                  }
+            // The per-phase quantities are extracted in a single flattened
+            // sweep over the active phases instead of through one callback
+            // per quantity and phase.  These buffers make up the bulk of
+            // the full 3D fields written for restart output, and all their
+            // values are cached on the fluid state, so the extraction cost
+            // is dominated by dispatch overhead rather than evaluation.
+            Entry{[this](const Context& ectx)
+                  {
+                      const auto idx = ectx.globalDofIdx;
+                      for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                          if (!FluidSystem::phaseIsActive(phaseIdx)) {
+                              continue;
+                          }
+
+                          if (auto& sat = this->saturation_[phaseIdx]; !sat.empty()) {
+                              sat[idx] = getValue(ectx.fs.saturation(phaseIdx));
+                              Valgrind::CheckDefined(sat[idx]);
+                          }
+                          if (auto& invB = this->invB_[phaseIdx]; !invB.empty()) {
+                              invB[idx] = getValue(ectx.fs.invB(phaseIdx));
+                              Valgrind::CheckDefined(invB[idx]);
+                          }
+                          if (auto& rho = this->density_[phaseIdx]; !rho.empty()) {
+                              rho[idx] = getValue(ectx.fs.density(phaseIdx));
+                              Valgrind::CheckDefined(rho[idx]);
+                          }
+                          if (auto& kr = this->relativePermeability_[phaseIdx]; !kr.empty()) {
+                              kr[idx] = getValue(ectx.intQuants.relativePermeability(phaseIdx));
+                              Valgrind::CheckDefined(kr[idx]);
+                          }
+                          if (auto& mu = this->viscosity_[phaseIdx]; !mu.empty()) {
+                              if (this->extboC_.allocated() && phaseIdx == oilPhaseIdx) {
+                                  mu[idx] = getValue(ectx.intQuants.oilViscosity());
+                              }
+                              else if (this->extboC_.allocated() && phaseIdx == gasPhaseIdx) {
+                                  mu[idx] = getValue(ectx.intQuants.gasViscosity());
+                              }
+                              else {
+                                  mu[idx] = getValue(ectx.fs.viscosity(phaseIdx));
+                              }
+                              Valgrind::CheckDefined(mu[idx]);
+                          }
+                      }
+                  },
+                  anyPhaseBufferAllocated(this->saturation_,
+                                          this->invB_,
+                                          this->density_,
+                                          this->relativePermeability_,
+                                          this->viscosity_)
             },
             Entry{PhaseEntry{&this->residual_,
                              [&modelResid = this->simulator_.model().linearizer().residual()]
@@ -1633,7 +1709,7 @@ private:
                                   [&fs = ectx.fs]() { return getValue(fs.pressure(oilPhaseIdx)); },
                                   [&fs = ectx.fs]() { return getValue(fs.saturation(waterPhaseIdx)); },
                                   [&fs = ectx.fs]() { return getValue(fs.saturation(gasPhaseIdx)); });
-                   }
+                   }, this->rftC_.active()
             },
             Entry{[&tC = this->tracerC_,
                    &tM = this->simulator_.problem().tracerModel()](const Context& ectx)
@@ -323,6 +323,20 @@ public:
     {
     }
 
+    /*!
+     * \brief Mark the cells which have at least one inter-region
+     *    connection in some region set.
+     *
+     * Empty implementation for compositional runs; no connection fluxes
+     * are captured, so no cells are marked.
+     */
+    template <class ActiveIndex>
+    void markInterRegionCells(const ElementContext& /* elemCtx */,
+                              ActiveIndex&&         /* activeIndex */,
+                              std::vector<bool>&    /* interRegionCells */) const
+    {
+    }
+
     /*!
      * \brief Prepare for capturing connection fluxes, particularly to
      *    account for inter-region flows.
@@ -38,34 +38,11 @@
 #include <opm/output/data/Wells.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <map>
 #include <tuple>
-
-namespace {
-
-template<class Scalar>
-void gatherAndUpdateMap(std::map<std::size_t, Scalar>& local_map,
-                        const Opm::Parallel::Communication& comm)
-{
-    std::vector<std::pair<int, Scalar>> pairs(local_map.begin(), local_map.end());
-    std::vector<std::pair<int, Scalar>> all_pairs;
-    std::vector<int> offsets;
-
-    std::tie(all_pairs, offsets) = Opm::allGatherv(pairs, comm);
-
-    // Update maps on all ranks
-    for (auto i = static_cast<std::size_t>(offsets[0]); i < all_pairs.size(); ++i) {
-        const auto& key_value = all_pairs[i];
-        if (auto candidate = local_map.find(key_value.first); candidate != local_map.end()) {
-            const Scalar prev_value = candidate->second;
-            candidate->second = std::max(prev_value, key_value.second);
-        }
-        else {
-            local_map[key_value.first] = key_value.second;
-        }
-    }
-}
-
-}
+#include <utility>
+#include <vector>
 
 namespace Opm {
 
@@ -81,9 +58,7 @@ addToWells(data::Wells& wellDatas,
     }
 
     if (comm.size() > 1) {
-        gatherAndUpdateMap(oilConnectionPressures_, comm);
-        gatherAndUpdateMap(waterConnectionSaturations_, comm);
-        gatherAndUpdateMap(gasConnectionSaturations_, comm);
+        this->mergeParallel(comm);
     }
 
     for (const auto& wname : this->schedule_[reportStepNum].well_order()) {
@@ -108,27 +83,28 @@ addToWells(data::Wells& wellDatas,
             }
         }
 
-        auto cond_assign = [](double& dest, unsigned idx, const auto& map)
+        auto cond_assign = [](double& dest, const int pos, const auto& values)
         {
-            auto it = map.find(idx);
-            if (it != map.end()) {
-                dest = it->second;
+            if (pos >= 0 && !values.empty()) {
+                dest = values[pos];
             }
         };
 
         std::ranges::for_each(wellDataPos->second.connections,
                               [&cond_assign, this](auto& connectionData)
                               {
-                                  const auto index = connectionData.index;
-                                  cond_assign(connectionData.cell_pressure, index,
+                                  const auto pos = this->cellPosition(connectionData.index);
+                                  cond_assign(connectionData.cell_pressure, pos,
                                               oilConnectionPressures_);
-                                  cond_assign(connectionData.cell_saturation_water, index,
+                                  cond_assign(connectionData.cell_saturation_water, pos,
                                               waterConnectionSaturations_);
-                                  cond_assign(connectionData.cell_saturation_gas, index,
+                                  cond_assign(connectionData.cell_saturation_gas, pos,
                                               gasConnectionSaturations_);
                               });
     }
 
+    // Keep the capacity of the flat arrays for the next RFT output step.
+    cellIndex_.clear();
     oilConnectionPressures_.clear();
     waterConnectionSaturations_.clear();
     gasConnectionSaturations_.clear();
@@ -144,6 +120,7 @@ allocate(const std::size_t reportStepNum)
         return;
     }
 
+    cellIndex_.clear();
     for (const auto& wname : schedule_[reportStepNum].well_order()) {
         // don't bother with wells not on this process
         if (!wellOnCurrentRank_(wname)) {
@@ -153,20 +130,24 @@ allocate(const std::size_t reportStepNum)
         const auto& well = schedule_[reportStepNum].wells.get(wname);
 
         for (const auto& connection: well.getConnections()) {
-            const std::size_t index = connection.global_index();
+            cellIndex_.push_back(connection.global_index());
+        }
+    }
 
-            if (FluidSystem::phaseIsActive(oilPhaseIdx)) {
-                oilConnectionPressures_.emplace(index, 0.0);
-            }
+    std::sort(cellIndex_.begin(), cellIndex_.end());
+    cellIndex_.erase(std::unique(cellIndex_.begin(), cellIndex_.end()),
+                     cellIndex_.end());
 
-            if (FluidSystem::phaseIsActive(waterPhaseIdx)) {
-                waterConnectionSaturations_.emplace(index, 0.0);
-            }
+    if (FluidSystem::phaseIsActive(oilPhaseIdx)) {
+        oilConnectionPressures_.assign(cellIndex_.size(), 0.0);
+    }
 
-            if (FluidSystem::phaseIsActive(gasPhaseIdx)) {
-                gasConnectionSaturations_.emplace(index, 0.0);
-            }
-        }
+    if (FluidSystem::phaseIsActive(waterPhaseIdx)) {
+        waterConnectionSaturations_.assign(cellIndex_.size(), 0.0);
+    }
+
+    if (FluidSystem::phaseIsActive(gasPhaseIdx)) {
+        gasConnectionSaturations_.assign(cellIndex_.size(), 0.0);
     }
 }
 
@@ -177,17 +158,100 @@ assign(const unsigned cartesianIndex,
        const AssignmentFunc& water,
        const AssignmentFunc& gas)
 {
-    auto cond_assign = [](auto& map, unsigned idx, const auto& func)
+    const auto pos = this->cellPosition(cartesianIndex);
+    if (pos < 0) {
+        return;
+    }
+
+    if (!oilConnectionPressures_.empty()) {
+        oilConnectionPressures_[pos] = oil();
+    }
+
+    if (!waterConnectionSaturations_.empty()) {
+        waterConnectionSaturations_[pos] = water();
+    }
+
+    if (!gasConnectionSaturations_.empty()) {
+        gasConnectionSaturations_[pos] = gas();
+    }
+}
+
+template<class FluidSystem>
+int RFTContainer<FluidSystem>::
+cellPosition(const std::size_t cartesianIndex) const
+{
+    const auto it = std::lower_bound(cellIndex_.begin(), cellIndex_.end(),
+                                     cartesianIndex);
+
+    if ((it == cellIndex_.end()) || (*it != cartesianIndex)) {
+        return -1;
+    }
+
+    return static_cast<int>(std::distance(cellIndex_.begin(), it));
+}
+
+template<class FluidSystem>
+void RFTContainer<FluidSystem>::
+mergeParallel(const Parallel::Communication& comm)
+{
+    // Merge per-cell values across ranks, taking the maximum for cells
+    // shared by several ranks, and rebuild the sorted flat arrays from the
+    // union of all ranks' connection cells.
+    auto gatherToGlobal = [this, &comm](const std::vector<Scalar>& values)
     {
-        auto it = map.find(idx);
-        if (it != map.end()) {
-            it->second = func();
+        std::vector<std::pair<int, Scalar>> pairs;
+        pairs.reserve(values.size());
+        for (auto i = 0*values.size(); i < values.size(); ++i) {
+            pairs.emplace_back(static_cast<int>(this->cellIndex_[i]), values[i]);
+        }
+
+        const auto& [all_pairs, offsets] = allGatherv(pairs, comm);
+        static_cast<void>(offsets);
+
+        std::map<std::size_t, Scalar> global;
+        for (const auto& [cell, value] : all_pairs) {
+            const auto& [pos, inserted] = global.emplace(cell, value);
+            if (!inserted) {
+                pos->second = std::max(pos->second, value);
+            }
+        }
+
+        return global;
+    };
+
+    const auto oilGlobal = gatherToGlobal(oilConnectionPressures_);
+    const auto waterGlobal = gatherToGlobal(waterConnectionSaturations_);
+    const auto gasGlobal = gatherToGlobal(gasConnectionSaturations_);
+
+    cellIndex_.clear();
+    for (const auto* global : {&oilGlobal, &waterGlobal, &gasGlobal}) {
+        for (const auto& [cell, value] : *global) {
+            static_cast<void>(value);
+            cellIndex_.push_back(cell);
+        }
+    }
+
+    std::sort(cellIndex_.begin(), cellIndex_.end());
+    cellIndex_.erase(std::unique(cellIndex_.begin(), cellIndex_.end()),
+                     cellIndex_.end());
+
+    auto flatten = [this](const std::map<std::size_t, Scalar>& global,
+                          std::vector<Scalar>& values)
+    {
+        if (global.empty()) {
+            values.clear();
+            return;
+        }
+
+        values.assign(this->cellIndex_.size(), 0.0);
+        for (const auto& [cell, value] : global) {
+            values[this->cellPosition(cell)] = value;
         }
     };
 
-    cond_assign(oilConnectionPressures_, cartesianIndex, oil);
-    cond_assign(waterConnectionSaturations_, cartesianIndex, water);
-    cond_assign(gasConnectionSaturations_, cartesianIndex, gas);
+    flatten(oilGlobal, oilConnectionPressures_);
+    flatten(waterGlobal, waterConnectionSaturations_);
+    flatten(gasGlobal, gasConnectionSaturations_);
 }
 
 template<class T> using FS = BlackOilFluidSystem<T, BlackOilDefaultFluidSystemIndices>;
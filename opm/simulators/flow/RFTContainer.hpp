@@ -30,7 +30,6 @@
 
 #include <cstddef>
 #include <functional>
-#include <map>
 #include <string>
 #include <vector>
 
@@ -154,6 +153,12 @@ public:
                 const AssignmentFunc& water,
                 const AssignmentFunc& gas);
 
+    /// Whether RFT state has been requested for any cell at the current
+    /// report step.  Use to skip the per-cell collection entirely when no
+    /// RFT output is due.
+    bool active() const
+    { return !this->cellIndex_.empty(); }
+
 private:
     /// Run's static properties and configurations.
     const EclipseState& eclState_;
@@ -173,24 +178,43 @@ private:
     /// Needed to properly allocate the internal buffers.
     WellQueryFunc wellOnCurrentRank_;
 
+    /// Find position of linearised global cell ID in \c cellIndex_.
+    ///
+    /// \param[in] cartesianIndex Linearised global cell ID.
+    ///
+    /// \return Position in the value arrays, or negative one if the cell
+    /// is not among those for which RFT state is requested.
+    int cellPosition(std::size_t cartesianIndex) const;
+
+    /// Merge per-cell state values across MPI ranks for wells whose
+    /// connections are distributed over multiple ranks.
+    ///
+    /// \param[in] comm MPI communication object.
+    void mergeParallel(const Parallel::Communication& comm);
+
+    /// Sorted linearised global cell IDs of all pertinent well
+    /// connections.  Shared index for the value arrays below; capacity is
+    /// retained across report steps.
+    std::vector<std::size_t> cellIndex_;
+
     /// Cell level oil pressure values for all pertinent well connections.
     ///
-    /// Keyed by the linearised global cell ID.  Will be populated only if
-    /// oil is active in the current run.
-    std::map<std::size_t, Scalar> oilConnectionPressures_;
+    /// Indexed as \c cellIndex_.  Will be populated only if oil is active
+    /// in the current run.
+    std::vector<Scalar> oilConnectionPressures_;
 
     /// Cell level water saturation values for all pertinent well
     /// connections.
     ///
-    /// Keyed by the linearised global cell ID.  Will be populated only if
-    /// water is active in the current run.
-    std::map<std::size_t, Scalar> waterConnectionSaturations_;
+    /// Indexed as \c cellIndex_.  Will be populated only if water is
+    /// active in the current run.
+    std::vector<Scalar> waterConnectionSaturations_;
 
     /// Cell level gas saturation values for all pertinent well connections.
     ///
-    /// Keyed by the linearised global cell ID.  Will be populated only if
-    /// gas is active in the current run.
-    std::map<std::size_t, Scalar> gasConnectionSaturations_;
+    /// Indexed as \c cellIndex_.  Will be populated only if gas is active
+    /// in the current run.
+    std::vector<Scalar> gasConnectionSaturations_;
 };
 
 } // namespace Opm
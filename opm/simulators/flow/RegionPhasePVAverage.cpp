@@ -25,6 +25,8 @@
 
 #include <opm/input/eclipse/EclipseState/Grid/FieldProps.hpp>
 
+#include <opm/models/parallel/threadmanager.hpp>
+
 #include <opm/simulators/utils/ParallelCommunication.hpp>
 
 #include <algorithm>
@@ -85,6 +87,7 @@ RegionPhasePoreVolAverage(const Parallel::Communication&  comm,
     , getRegionArray_ { std::move(getRegionArray) }
     , rsStart_        { regionStartPointers(rsetNames_, getRegionArray_, comm_) }
     , x_              (rsStart_.back() * numPhases * AvgType::NumTypes * Element::NumElem)
+    , xThread_        (ThreadManager::maxThreads() * x_.size())
 {}
 
 double Opm::RegionPhasePoreVolAverage::fieldValue(const Phase& p) const
@@ -111,6 +114,7 @@ value(std::string_view rset, const Phase& p, const Region& r) const
 void Opm::RegionPhasePoreVolAverage::prepareAccumulation()
 {
     std::ranges::fill(this->x_, 0.0);
+    this->xThread_.assign(ThreadManager::maxThreads() * this->x_.size(), 0.0);
 }
 
 void Opm::RegionPhasePoreVolAverage::
@@ -127,6 +131,8 @@ addCell(const std::size_t activeCell,
 
 void Opm::RegionPhasePoreVolAverage::accumulateParallel()
 {
+    this->collectThreadContributions();
+
     this->comm_.get().sum(this->x_.data(), this->x_.size());
 }
 
@@ -189,12 +195,30 @@ void Opm::RegionPhasePoreVolAverage::add(const Ix      start,
 
 double& Opm::RegionPhasePoreVolAverage::value(const Ix start, const AvgType type)
 {
-    return this->x_[ this->valueArrayIndex(start, type, Element::Value) ];
+    return this->threadLocalSums()[ this->valueArrayIndex(start, type, Element::Value) ];
 }
 
 double& Opm::RegionPhasePoreVolAverage::weight(const Ix start, const AvgType type)
 {
-    return this->x_[ this->valueArrayIndex(start, type, Element::Weight) ];
+    return this->threadLocalSums()[ this->valueArrayIndex(start, type, Element::Weight) ];
+}
+
+double* Opm::RegionPhasePoreVolAverage::threadLocalSums()
+{
+    return this->xThread_.data() + ThreadManager::threadId() * this->x_.size();
+}
+
+void Opm::RegionPhasePoreVolAverage::collectThreadContributions()
+{
+    const auto n = this->x_.size();
+
+    for (auto thread = 0*n; thread < this->xThread_.size() / n; ++thread) {
+        const auto* sums = this->xThread_.data() + thread*n;
+
+        for (auto i = 0*n; i < n; ++i) {
+            this->x_[i] += sums[i];
+        }
+    }
 }
 
 double Opm::RegionPhasePoreVolAverage::value(const Ix start, const AvgType type) const
@@ -117,6 +117,10 @@ namespace Opm {
 
         /// Incorporate contributions from a single cell.
         ///
+        /// Safe to call concurrently from multiple threads--each thread
+        /// accumulates into its own set of partial running sums which get
+        /// folded together in accumulateParallel().
+        ///
         /// \param[in] activeCell Per-rank active cell ID--typically one of
         ///   the rank's interior cells.
         ///
@@ -125,7 +129,8 @@ namespace Opm {
         /// \param[in] cv Single cell function value contribution.
         void addCell(std::size_t activeCell, const Phase& p, const CellValue& cv);
 
-        /// Accumulate region-level average values across MPI ranks.
+        /// Accumulate region-level average values across threads and MPI
+        /// ranks.
         ///
         /// Typically the last step in calculating the region-level average
         /// values.  It is typically an error to call this function multiple
@@ -189,6 +194,13 @@ namespace Opm {
         /// should be the return value from fieldStartIx() or rsetStartIx().
         std::vector<double> x_{};
 
+        /// Per-thread partial running sums.  Laid out as \code
+        /// ThreadManager::maxThreads() \endcode consecutive copies of the
+        /// \c x_ layout so that concurrent addCell() calls from different
+        /// threads never touch the same elements.  Folded into \c x_ by
+        /// collectThreadContributions().
+        std::vector<double> xThread_{};
+
         /// Compute final average value for a single region and phase.
         ///
         /// Prefers the average value weighted by phase-filled pore-volume,
@@ -282,6 +294,8 @@ namespace Opm {
 
         /// Mutable access to value item of specific average value type
         ///
+        /// References the calling thread's partial running sums.
+        ///
         /// \param[in] start Offset into linearised value array (\c x_)
         ///   corresponding to the first average value type of a particular
         ///   phase in a particular region.  Usually calculated by
@@ -295,6 +309,8 @@ namespace Opm {
 
         /// Mutable access to weight item of specific average value type
         ///
+        /// References the calling thread's partial running sums.
+        ///
         /// \param[in] start Offset into linearised value array (\c x_)
         ///   corresponding to the first average value type of a particular
         ///   phase in a particular region.  Usually calculated by
@@ -306,6 +322,17 @@ namespace Opm {
         ///   corresponding to the running sum of function weights.
         double& weight(Ix start, AvgType type);
 
+        /// Partial running sums of the calling thread.
+        ///
+        /// \return Pointer to the first element of the calling thread's
+        ///   copy of the \c x_ layout within \c xThread_.
+        double* threadLocalSums();
+
+        /// Fold the per-thread partial running sums into \c x_.
+        ///
+        /// Must not be called from inside a parallel region.
+        void collectThreadContributions();
+
         /// Read-only access to value item of specific average value type
         ///
         /// \param[in] start Offset into linearised value array (\c x_)
@@ -46,6 +46,12 @@ void registerSimulatorParameters()
          "Use negative values of \"x\" to keep only the last "
          "written step, or \"last\" to save every step, keeping "
          "only the last.");
+    Parameters::Register<Parameters::SaveOnSignal>
+        ("Save serialized state to .OPMRST file when SIGTERM or SIGUSR1 "
+         "is received, at the end of the current report step. On SIGTERM "
+         "the simulation stops after the checkpoint has been written. "
+         "Useful to survive preemption of cloud spot instances; resume "
+         "with --load-step=0.");
     Parameters::Register<Parameters::LoadStep>
         ("Load serialized state from .OPMRST file. "
          "Either a specific report step, or 0 to load last "
@@ -61,6 +67,15 @@ void registerSimulatorParameters()
     Parameters::Register<Parameters::Slave>
         ("Specify if the simulation is a slave simulation in a master-slave simulation");
     Parameters::Hide<Parameters::Slave>();
+    Parameters::Register<Parameters::EnableStepTelemetry>
+        ("Write per-rank performance counters for each report step to "
+         "a compact binary CASENAME.TELEMETRY.<rank> file. "
+         "Decode the files with bin/step_telemetry.py.");
+    Parameters::Register<Parameters::EnableSolverEventTrace>
+        ("Record the solver events of every report step (assembly, linear "
+         "solve, well updates, convergence reductions) and write them as "
+         "Chrome trace JSON to CASENAME.TRACE-<step>.<rank>.json. "
+         "View the files in chrome://tracing or Perfetto.");
 
 }
 
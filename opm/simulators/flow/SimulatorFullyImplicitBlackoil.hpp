@@ -47,8 +47,11 @@
 #include <opm/simulators/flow/SimulatorConvergenceOutput.hpp>
 #include <opm/simulators/flow/SimulatorReportBanners.hpp>
 #include <opm/simulators/flow/SimulatorSerializer.hpp>
+#include <opm/simulators/flow/StepTelemetry.hpp>
 #include <opm/simulators/timestepping/AdaptiveTimeStepping.hpp>
 #include <opm/simulators/timestepping/ConvergenceReport.hpp>
+#include <opm/simulators/utils/EventProfiler.hpp>
+#include <opm/simulators/utils/MemoryBudget.hpp>
 #include <opm/simulators/utils/moduleVersion.hpp>
 #include <opm/simulators/wells/WellState.hpp>
 
@@ -68,12 +71,13 @@
 namespace Opm::Parameters {
 
 struct EnableAdaptiveTimeStepping { static constexpr bool value = true; };
-struct OutputExtraConvergenceInfo { static constexpr auto* value = "none"; };
 struct SaveStep { static constexpr auto* value = ""; };
+struct SaveOnSignal { static constexpr bool value = false; };
 struct SaveFile { static constexpr auto* value = ""; };
 struct LoadFile { static constexpr auto* value = ""; };
 struct LoadStep { static constexpr int value = -1; };
 struct Slave { static constexpr bool value = false; };
+struct EnableStepTelemetry { static constexpr bool value = false; };
 
 } // namespace Opm::Parameters
 
@@ -122,6 +126,7 @@ public:
                       FlowGenericVanguard::comm(),
                       simulator_.vanguard().eclState().getIOConfig(),
                       Parameters::Get<Parameters::SaveStep>(),
+                      Parameters::Get<Parameters::SaveOnSignal>(),
                       Parameters::Get<Parameters::LoadStep>(),
                       Parameters::Get<Parameters::SaveFile>(),
                       Parameters::Get<Parameters::LoadFile>())
@@ -145,6 +150,20 @@ public:
                                 getPhaseName);
             }
         }
+
+        // Telemetry logs are written by every rank, not just the I/O rank.
+        if (Parameters::Get<Parameters::EnableStepTelemetry>() &&
+            !simulator_.vanguard().eclState().getIOConfig().initOnly())
+        {
+            const auto& ioConfig = simulator_.vanguard().eclState().getIOConfig();
+            step_telemetry_ = std::make_unique<StepTelemetryWriter>(
+                ioConfig.getOutputDir(),
+                ioConfig.getBaseName(),
+                this->grid().comm().rank(),
+                this->grid().comm().size());
+        }
+
+        solverEventTrace_ = Parameters::Get<Parameters::EnableSolverEventTrace>();
     }
 
     ~SimulatorFullyImplicitBlackoil() override
@@ -400,6 +419,12 @@ public:
             serializer_.loadTimerInfo(timer);
         }
 
+        if (solverEventTrace_) {
+            // Fresh, bounded ring buffers (~5 MiB per thread) for every
+            // report step; the trace is written out at the end of the step.
+            EventProfiler::enable(/*eventsPerThread=*/1 << 16);
+        }
+
         // Report timestep.
         if (terminalOutput_) {
             std::ostringstream ss;
@@ -545,10 +570,18 @@ public:
                 events.hasEvent(ScheduleEvents::WELL_STATUS_CHANGE);
             auto stepReport = adaptiveTimeStepping_->step(timer, *solver_, event, tuningUpdater);
             report_ += stepReport;
+            if (step_telemetry_) {
+                step_telemetry_->write(timer.currentStepNum(), timer.currentStepLength(),
+                                       stepReport.success, stepReport.failure);
+            }
         } else {
             // solve for complete report step
             auto stepReport = solver_->step(timer, nullptr);
             report_ += stepReport;
+            if (step_telemetry_) {
+                step_telemetry_->write(timer.currentStepNum(), timer.currentStepLength(),
+                                       stepReport, SimulatorReportSingle{});
+            }
             // Pass simulation report to eclwriter for summary output
             simulator_.problem().setSubStepReport(stepReport);
             simulator_.problem().setSimulationReport(report_);
@@ -570,6 +603,10 @@ public:
 
         solver_->model().endReportStep();
 
+        // Report steps are a safe point to shed reclaimable caches if the
+        // process has grown past the configured memory budget.
+        MemoryBudget::instance().enforce();
+
         // take time that was used to solve system for this reportStep
         solverTimer_->stop();
 
@@ -583,6 +620,16 @@ public:
             convergence_output_.write(reps);
         }
 
+        if (solverEventTrace_) {
+            EventProfiler::disable();
+            const auto& ioConfig = simulator_.vanguard().eclState().getIOConfig();
+            EventProfiler::writeChromeTrace(
+                fmt::format("{}/{}.TRACE-{}.{}.json",
+                            ioConfig.getOutputDir(), ioConfig.getBaseName(),
+                            timer.currentStepNum(), this->grid().comm().rank()),
+                this->grid().comm().rank());
+        }
+
         // Increment timer, remember well state.
         ++timer;
 
@@ -595,6 +642,14 @@ public:
 
         serializer_.save(timer);
 
+        if (serializer_.stopRequested()) {
+            if (terminalOutput_) {
+                OpmLog::info("Stopping simulation after writing checkpoint: "
+                             "termination was requested by signal.");
+            }
+            return false;
+        }
+
         return true;
     }
 
@@ -733,6 +788,8 @@ protected:
     std::unique_ptr<TimeStepper> adaptiveTimeStepping_;
 
     SimulatorConvergenceOutput convergence_output_{};
+    std::unique_ptr<StepTelemetryWriter> step_telemetry_{};
+    bool solverEventTrace_ = false;
 
 #ifdef RESERVOIR_COUPLING_ENABLED
     bool slaveMode_{false};
@@ -28,6 +28,8 @@
 
 #include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
 
+#include <opm/models/parallel/tasklets.hpp>
+
 #include <opm/simulators/timestepping/SimulatorTimer.hpp>
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
 
@@ -36,15 +38,36 @@
 #endif
 
 #include <algorithm>
+#include <csignal>
 #include <filesystem>
 #include <stdexcept>
 
+namespace {
+
+// Written from the signal handler; setting flags of type sig_atomic_t is
+// the only state change an async-signal-safe handler may perform.  The
+// actual serialization happens at the next report step, which is the only
+// point the state is consistent and the resume machinery can load.
+volatile std::sig_atomic_t checkpointSignal = 0;
+volatile std::sig_atomic_t terminateSignal = 0;
+
+extern "C" void handleCheckpointSignal(int signum)
+{
+    checkpointSignal = 1;
+    if (signum == SIGTERM) {
+        terminateSignal = 1;
+    }
+}
+
+} // anonymous namespace
+
 namespace Opm {
 
 SimulatorSerializer::SimulatorSerializer([[maybe_unused]] SerializableSim& simulator,
                                          Parallel::Communication& comm,
                                          const IOConfig& ioconfig,
                                          const std::string& saveSpec,
+                                         bool saveOnSignal,
                                          int loadStep,
                                          const std::string& saveFile,
                                          const std::string& loadFile)
@@ -54,6 +77,7 @@ SimulatorSerializer::SimulatorSerializer([[maybe_unused]] SerializableSim& simul
 #else
     : comm_(comm)
 #endif // HAVE_HDF5
+    , saveOnSignal_(saveOnSignal)
     , loadStep_(loadStep)
     , saveFile_(saveFile)
     , loadFile_(loadFile)
@@ -77,6 +101,10 @@ SimulatorSerializer::SimulatorSerializer([[maybe_unused]] SerializableSim& simul
         OPM_THROW(std::runtime_error, "Saving of serialized state requested, "
                                       "but no HDF5 support available.");
     }
+    if (saveOnSignal_)  {
+        OPM_THROW(std::runtime_error, "Saving of serialized state on signal requested, "
+                                      "but no HDF5 support available.");
+    }
 #endif
 
     if (loadFile_.empty() || saveFile_.empty()) {
@@ -91,39 +119,97 @@ SimulatorSerializer::SimulatorSerializer([[maybe_unused]] SerializableSim& simul
             }
         }
     }
+
+#if HAVE_HDF5
+    // Once the state has been packed in-memory, writing the checkpoint is
+    // pure file I/O, so hand it to a background thread when running without
+    // MPI. In parallel runs the HDF5 writes involve the communicator and
+    // must stay on the main thread.
+    if ((saveStride_ != 0 || saveStep_ != -1 || saveOnSignal_) && comm_.size() == 1) {
+        asyncWriter_ = std::make_unique<TaskletRunner>(1);
+    }
+
+    // Request a checkpoint when the process is asked to terminate, as done
+    // by cloud schedulers ahead of spot-instance preemption, or receives
+    // SIGUSR1.  The handler only sets a flag which save() acts upon.
+    if (saveOnSignal_) {
+        std::signal(SIGTERM, handleCheckpointSignal);
+        std::signal(SIGUSR1, handleCheckpointSignal);
+    }
+#endif
 }
 
+SimulatorSerializer::~SimulatorSerializer() = default;
+
 void SimulatorSerializer::save(SimulatorTimer& timer)
 {
-    if (saveStride_ == 0 && saveStep_ == -1) {
+    bool signalCheckpoint = false;
+    if (saveOnSignal_) {
+        // The preemption notice is not necessarily delivered to every
+        // rank, so exchange the signal flags to make a collective decision.
+        int flags[2] = {checkpointSignal, terminateSignal};
+        comm_.max(flags, 2);
+        signalCheckpoint = flags[0] == 1;
+        stopRequested_ = flags[1] == 1;
+        checkpointSignal = 0;
+    }
+
+    if (saveStride_ == 0 && saveStep_ == -1 && !signalCheckpoint) {
         return;
     }
 
     OPM_BEGIN_PARALLEL_TRY_CATCH();
 
     int nextStep = timer.currentStepNum();
-    if ((saveStep_ != -1 && nextStep == saveStep_)  ||
+    if (signalCheckpoint ||
+        (saveStep_ != -1 && nextStep == saveStep_)  ||
         (saveStride_ != 0 && (nextStep % saveStride_) == 0)) {
 #if HAVE_HDF5
+        // With signal-triggered checkpoints and no regular saving
+        // configured the file holds a single step, as for "last".
+        const bool freshFile = saveStride_ < 0 || nextStep == saveStride_ || nextStep == saveStep_ ||
+                               (signalCheckpoint && saveStride_ == 0 && saveStep_ == -1);
         const std::string groupName = "/report_step/" + std::to_string(nextStep);
-        if (saveStride_ < 0 || nextStep == saveStride_ || nextStep == saveStep_) {
+        if (asyncWriter_) {
+            // Make sure a previously dispatched checkpoint write has released
+            // the file before it is removed or reopened here.
+            asyncWriter_->barrier();
+            if (asyncWriter_->failure()) {
+                OPM_THROW(std::runtime_error, "Error writing serialized state");
+            }
+        }
+        if (freshFile) {
             std::filesystem::remove(saveFile_);
         }
-        HDF5Serializer writer(saveFile_, HDF5File::OpenMode::APPEND, comm_);
-        if (saveStride_ < 0 || nextStep == saveStride_ || nextStep == saveStep_) {
+        auto writer = std::make_shared<HDF5Serializer>(saveFile_, HDF5File::OpenMode::APPEND, comm_);
+        if (freshFile) {
             const auto data = simulator_.getHeader();
-            writer.writeHeader(data[0], data[1], data[2], data[3], data[4], comm_.size());
+            writer->writeHeader(data[0], data[1], data[2], data[3], data[4], comm_.size());
 
             if (comm_.size() > 1) {
                 const auto& cellMapping = simulator_.getCellMapping();
                 std::size_t hash = Dune::hash_range(cellMapping.begin(), cellMapping.end());
-                writer.write(hash, "/", "grid_checksum");
+                writer->write(hash, "/", "grid_checksum");
             }
         }
-        simulator_.saveState(writer, groupName);
-        writer.write(timer, groupName, "simulator_timer",
-                     HDF5File::DataSetMode::ROOT_ONLY);
-        OpmLog::info("Serialized state written for report step " + std::to_string(nextStep));
+        if (asyncWriter_) {
+            writer->startBuffering();
+        }
+        simulator_.saveState(*writer, groupName);
+        writer->write(timer, groupName, "simulator_timer",
+                      HDF5File::DataSetMode::ROOT_ONLY);
+        if (asyncWriter_) {
+            // The packed state is flushed to file by the background thread;
+            // the writer (and thereby the open file) is kept alive by the
+            // tasklet until the flush has completed.
+            auto flush = [writer]() { writer->flushPendingWrites(); };
+            asyncWriter_->dispatchFunction(flush);
+            OpmLog::info("Serialized state queued for writing for report step " + std::to_string(nextStep) +
+                         (signalCheckpoint ? " on signal request" : ""));
+        } else {
+            OpmLog::info("Serialized state written for report step " + std::to_string(nextStep) +
+                         (signalCheckpoint ? " on signal request" : ""));
+        }
 #endif
     }
 
@@ -23,6 +23,7 @@
 #include <opm/simulators/utils/ParallelCommunication.hpp>
 
 #include <array>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -31,6 +32,7 @@ namespace Opm {
 class HDF5Serializer;
 class IOConfig;
 class SimulatorTimer;
+class TaskletRunner;
 
 //! \brief Abstract interface for simulator serialization ops.
 struct SerializableSim {
@@ -59,6 +61,7 @@ public:
     //! \param comm Parallel communicator to use
     //! \param ioconfig I/O configuration object
     //! \param saveSpec Specification of steps to save
+    //! \param saveOnSignal Save on SIGTERM/SIGUSR1, stop on SIGTERM
     //! \param loadStep Step to load
     //! \param saveFile File to save to
     //! \param loadFile File to load from
@@ -66,10 +69,14 @@ public:
                         Parallel::Communication& comm,
                         const IOConfig& ioconfig,
                         const std::string& saveSpec,
+                        bool saveOnSignal,
                         int loadStep,
                         const std::string& saveFile,
                         const std::string& loadFile);
 
+    //! \brief Destructor waits for any pending asynchronous write.
+    ~SimulatorSerializer();
+
     //! \brief Returns whether or not a state should be loaded.
     bool shouldLoad() const { return loadStep_ > -1; }
 
@@ -77,6 +84,10 @@ public:
     int loadStep() const { return loadStep_; }
 
     //! \brief Save data to file if appropriate.
+    //!
+    //! In serial runs the state is packed in-memory here while the file
+    //! output itself is performed by a background thread, so the simulation
+    //! can proceed while the checkpoint is written.
     void save(SimulatorTimer& timer);
 
     //! \brief Loads time step info from file.
@@ -85,6 +96,14 @@ public:
     //! \brief Load state from file.
     void loadState();
 
+    //! \brief Returns whether a termination signal has requested the
+    //!        simulation to stop after the last checkpoint.
+    //!
+    //! Only meaningful after save() has been called for the current
+    //! report step; the signal flags are exchanged between the ranks
+    //! there.
+    bool stopRequested() const { return stopRequested_; }
+
 private:
     //! \brief Checks for differences between command line parameters.
     void checkSerializedCmdLine(const std::string& current,
@@ -96,9 +115,12 @@ private:
     Parallel::Communication& comm_; //!< Communication to use
     int saveStride_ = 0; //!< Stride to save serialized state at, negative to only keep last
     int saveStep_ = -1; //!< Specific step to save serialized state at
+    bool saveOnSignal_ = false; //!< Save serialized state when signaled, stop on SIGTERM
+    bool stopRequested_ = false; //!< A termination signal has been received
     int loadStep_ = -1; //!< Step to load serialized state from
     std::string saveFile_; //!< File to save serialized state to
     std::string loadFile_; //!< File to load serialized state from
+    std::unique_ptr<TaskletRunner> asyncWriter_; //!< Background thread for checkpoint output (serial runs only)
 };
 
 } // namespace Opm
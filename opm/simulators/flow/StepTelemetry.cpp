@@ -0,0 +1,104 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+#include <opm/simulators/flow/StepTelemetry.hpp>
+
+#include <opm/simulators/timestepping/SimulatorReport.hpp>
+
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+static_assert(std::is_trivially_copyable_v<Opm::StepTelemetryWriter::Record>,
+              "telemetry records are written as raw bytes");
+
+namespace Opm {
+
+StepTelemetryWriter::StepTelemetryWriter(const std::string& outputDir,
+                                         const std::string& baseName,
+                                         const int rank,
+                                         const int commSize)
+{
+    const auto path = std::filesystem::path{outputDir} /
+        std::filesystem::path{baseName}
+            .concat(".TELEMETRY.")
+            .concat(std::to_string(rank));
+
+    file_.open(path, std::ios::binary | std::ios::trunc);
+    if (!file_) {
+        throw std::runtime_error("Failed to open telemetry log " + path.string());
+    }
+
+    const char magic[8] = {'O', 'P', 'M', 'S', 'T', 'E', 'P', '1'};
+    const std::uint32_t record_size = sizeof(Record);
+    const std::int32_t rank32 = rank;
+    const std::int32_t size32 = commSize;
+    file_.write(magic, sizeof(magic));
+    file_.write(reinterpret_cast<const char*>(&record_size), sizeof(record_size));
+    file_.write(reinterpret_cast<const char*>(&rank32), sizeof(rank32));
+    file_.write(reinterpret_cast<const char*>(&size32), sizeof(size32));
+}
+
+void StepTelemetryWriter::write(const int reportStep,
+                                const double timestepLength,
+                                const SimulatorReportSingle& success,
+                                const SimulatorReportSingle& failure)
+{
+    Record record;
+    record.report_step = reportStep;
+    record.newton_iterations = success.total_newton_iterations;
+    record.linear_iterations = success.total_linear_iterations;
+    record.linearizations = success.total_linearizations;
+    record.well_iterations = success.total_well_iterations;
+    record.wasted_linearizations = failure.total_linearizations;
+    record.wasted_linear_iterations = failure.total_linear_iterations;
+    record.timestep_length = timestepLength;
+    record.assemble_time = success.assemble_time + failure.assemble_time;
+    record.assemble_time_well = success.assemble_time_well + failure.assemble_time_well;
+    record.linear_solve_time = success.linear_solve_time + failure.linear_solve_time;
+    record.linear_solve_setup_time = success.linear_solve_setup_time + failure.linear_solve_setup_time;
+    record.update_time = success.update_time + failure.update_time;
+    record.pre_post_time = success.pre_post_time + failure.pre_post_time;
+    record.memory_highwater_bytes = memoryHighwater();
+
+    file_.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    // Flush once per report step so the log is usable even when a run
+    // is killed; this is far too infrequent to matter for performance.
+    file_.flush();
+}
+
+double StepTelemetryWriter::memoryHighwater()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.rfind("VmHWM:", 0) == 0) {
+            std::istringstream is(line.substr(6));
+            double kb = 0.0;
+            is >> kb;
+            return kb * 1024.0;
+        }
+    }
+    return 0.0;
+}
+
+} // namespace Opm
@@ -0,0 +1,100 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_STEP_TELEMETRY_HPP
+#define OPM_STEP_TELEMETRY_HPP
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+namespace Opm {
+
+struct SimulatorReportSingle;
+
+//! \brief Per-rank, per-report-step performance counters in a compact
+//!        binary log.
+//!
+//! Every rank appends one fixed-width record per report step to its own
+//! <CASE>.TELEMETRY.<rank> file in the output directory, so rank/step
+//! performance outliers can be located after a production run without
+//! rerunning under a profiler. The counters are taken from the local
+//! SimulatorReportSingle of the report step plus the process memory
+//! highwater, so recording costs one flushed write per report step.
+//!
+//! The file starts with an 8-byte magic ("OPMSTEP1"), the record size as
+//! uint32, and the writing rank and communicator size as int32, followed
+//! by the records. bin/step_telemetry.py decodes the format.
+class StepTelemetryWriter
+{
+public:
+    //! \brief Counters for one report step on one rank.
+    //!
+    //! All members are fixed-width so the record can be written and read
+    //! as raw bytes. Keep bin/step_telemetry.py in sync when changing it.
+    struct Record
+    {
+        std::int32_t report_step{0};
+        std::int32_t newton_iterations{0};
+        std::int32_t linear_iterations{0};
+        std::int32_t linearizations{0};
+        std::int32_t well_iterations{0};
+        //! Work spent in substeps that were subsequently rejected.
+        std::int32_t wasted_linearizations{0};
+        std::int32_t wasted_linear_iterations{0};
+        std::int32_t unused{0}; //!< Padding to 8-byte alignment.
+        double timestep_length{0.0};
+        double assemble_time{0.0};
+        double assemble_time_well{0.0};
+        double linear_solve_time{0.0};
+        double linear_solve_setup_time{0.0};
+        double update_time{0.0};
+        double pre_post_time{0.0};
+        double memory_highwater_bytes{0.0};
+    };
+
+    //! \brief Open <outputDir>/<baseName>.TELEMETRY.<rank> and write the
+    //!        file header.
+    StepTelemetryWriter(const std::string& outputDir,
+                        const std::string& baseName,
+                        int rank,
+                        int commSize);
+
+    //! \brief Append the counters for one report step and flush.
+    //!
+    //! \param success counters of the accepted substeps of the report step
+    //! \param failure counters of the rejected substeps, recorded as the
+    //!                wasted_* fields
+    void write(int reportStep,
+               double timestepLength,
+               const SimulatorReportSingle& success,
+               const SimulatorReportSingle& failure);
+
+    //! \brief Resident set highwater of this process in bytes.
+    //!
+    //! Read from /proc/self/status; returns 0 where that is unavailable.
+    static double memoryHighwater();
+
+private:
+    std::ofstream file_;
+};
+
+} // namespace Opm
+
+#endif // OPM_STEP_TELEMETRY_HPP
@@ -39,13 +39,16 @@ namespace Opm
     enum class DomainOrderingMeasure {
         AveragePressure,
         MaxPressure,
-        Residual
+        Residual,
+        DynamicResidual
     };
 
     inline DomainOrderingMeasure domainOrderingMeasureFromString(const std::string_view measure)
     {
         if (measure == "residual") {
             return DomainOrderingMeasure::Residual;
+        } else if (measure == "dynamicresidual") {
+            return DomainOrderingMeasure::DynamicResidual;
         } else if (measure == "maxpressure") {
             return DomainOrderingMeasure::MaxPressure;
         } else if (measure == "averagepressure") {
@@ -35,6 +35,7 @@
 
 #include <opm/simulators/flow/BlackoilModelParameters.hpp>
 #include <opm/simulators/flow/GenericTemperatureModel.hpp>
+#include <opm/simulators/flow/TransportTopology.hpp>
 #include <opm/simulators/linalg/findOverlapRowsAndColumns.hpp>
 #include <opm/simulators/aquifers/AquiferGridUtils.hpp>
 #include <opm/models/discretization/common/tpfalinearizer.hh>
@@ -260,9 +261,9 @@ public:
         // set the scaling factor
         scalingFactor_ = getPropValue<TypeTag, Properties::BlackOilEnergyScalingFactor>();
 
-        // find the sparsity pattern of the temperature matrix
-        using NeighborSet = std::set<unsigned>;
-        std::vector<NeighborSet> neighbors(numCells);
+        // collect the thermal transmissibilities of the cell interfaces; the
+        // sparsity pattern of the temperature matrix comes from the shared
+        // cell-adjacency topology
         Stencil stencil(this->gridView_, this->dofMapper_);
         neighborInfo_.reserve(numCells, 6 * numCells);
         std::vector<NeighborInfoCPU> loc_nbinfo;
@@ -273,7 +274,6 @@ public:
                 loc_nbinfo.resize(stencil.numDof() - 1); // Do not include the primary dof in neighborInfo_
                 for (unsigned dofIdx = 0; dofIdx < stencil.numDof(); ++dofIdx) {
                     const unsigned neighborIdx = stencil.globalSpaceIndex(dofIdx);
-                    neighbors[myIdx].insert(neighborIdx);
                     if (dofIdx > 0) {
                         const auto scvfIdx = dofIdx - 1;
                         const auto& scvf = stencil.interiorFace(scvfIdx);
@@ -290,7 +290,7 @@ public:
         // allocate matrix for storing the Jacobian of the temperature residual
         energyMatrix_ = std::make_unique<SpareMatrixEnergyAdapter>(simulator_);
         diagMatAddress_.resize(numCells);
-        energyMatrix_->reserve(neighbors);
+        energyMatrix_->reserve(simulator_.problem().transportTopology()->rowViews());
         for (unsigned globI = 0; globI < numCells; globI++) {
             const auto& nbInfos = neighborInfo_[globI];
             diagMatAddress_[globI] = energyMatrix_->blockAddress(globI, globI);
@@ -392,14 +392,59 @@ protected:
     }
 
     void advanceTemperatureFields()
+    {
+        const Scalar dt = simulator_.timeStepSize();
+        const auto maxSeqChange = Parameters::Get<Parameters::MaxTemperatureChangeSequential<Scalar>>();
+        std::vector<Scalar> temperature0;
+        if (maxSeqChange > 0.0) {
+            temperature0 = this->temperature_;
+        }
+
+        solveTemperature(dt);
+
+        if (maxSeqChange <= 0.0) {
+            return;
+        }
+
+        // The sequential splitting freezes the mass fluxes over the whole time
+        // step. If the resulting temperature change is large that assumption is
+        // no longer defensible, so redo the solve in smaller substeps (still
+        // with the frozen fluxes) to limit the splitting error.
+        const unsigned int numCells = simulator_.model().numTotalDof();
+        Scalar maxChange = 0.0;
+        for (unsigned globI = 0; globI < numCells; ++globI) {
+            maxChange = max(maxChange, std::abs(this->temperature_[globI] - temperature0[globI]));
+        }
+        maxChange = simulator_.gridView().comm().max(maxChange);
+        if (maxChange <= maxSeqChange) {
+            return;
+        }
+
+        const int maxNumSubSteps = 10;
+        const int numSubSteps = std::min(static_cast<int>(std::ceil(maxChange / maxSeqChange)),
+                                         maxNumSubSteps);
+        const auto msg =
+            fmt::format(fmt::runtime("Temperature model (TEMP): max temperature change {:.1f} K "
+                                     "exceeds {:.1f} K. Re-solving the energy equation in {} substeps."),
+                        maxChange, maxSeqChange, numSubSteps);
+        OpmLog::debug(msg);
+
+        resetTemperature(temperature0);
+        for (int subStep = 0; subStep < numSubSteps; ++subStep) {
+            updateStorageCache();
+            solveTemperature(dt / numSubSteps);
+        }
+    }
+
+    void solveTemperature(const Scalar dt)
     {
         const int max_iter = 20;
         const int min_iter = 1;
         bool is_converged = false;
         // solve using Newton
         for (int iter = 0; iter < max_iter; ++iter) {
-            assembleEquations();
-            if (iter >= min_iter && converged(iter)) {
+            assembleEquations(dt);
+            if (iter >= min_iter && converged(iter, dt)) {
                 is_converged = true;
                 break;
             }
@@ -414,6 +459,19 @@ protected:
         }
     }
 
+    void resetTemperature(const std::vector<Scalar>& temperature)
+    {
+        const unsigned int numCells = simulator_.model().numTotalDof();
+        #ifdef _OPENMP
+        #pragma omp parallel for
+        #endif
+        for (unsigned globI = 0; globI < numCells; ++globI) {
+            this->temperature_[globI] = temperature[globI];
+            intQuants_[globI].updateTemperature_(simulator_.problem(), globI, /*timeIdx*/ 0);
+            intQuants_[globI].updateEnergyQuantities_(simulator_.problem(), globI, /*timeIdx*/ 0);
+        }
+    }
+
     void solveAndUpdate()
     {
         const unsigned int numCells = simulator_.model().numTotalDof();
@@ -436,9 +494,8 @@ protected:
         }
     }
 
-    bool converged(const int iter)
+    bool converged(const int iter, const Scalar dt)
     {
-        Scalar dt = simulator_.timeStepSize();
         Scalar maxNorm = 0.0;
         Scalar sumNorm = 0.0;
         const auto tolerance_cnv_energy_strict = Parameters::Get<Parameters::ToleranceCnvEnergy<Scalar>>();
@@ -566,14 +623,13 @@ protected:
         heatFlux *= scalingFactor_*res_nbinfo.faceArea;
     }
 
-    void assembleEquations()
+    void assembleEquations(const Scalar dt)
     {
         const unsigned int numCells = simulator_.model().numTotalDof();
         for (unsigned globI = 0; globI < numCells; ++globI) {
             this->energyVector_[globI] = 0.0;
             energyMatrix_->clearRow(globI, 0.0);
         }
-        Scalar dt = simulator_.timeStepSize();
         #ifdef _OPENMP
         #pragma omp parallel for
         #endif
@@ -623,7 +679,10 @@ protected:
             }
 
             if (enableDriftCompensation) {
-                auto dofDriftRate = problem.drift()[globI]/dt;
+                // problem.drift() holds the residual accumulated over the full
+                // time step, so convert it to a rate with the full step length
+                // even when the temperature solve is substepped.
+                auto dofDriftRate = problem.drift()[globI]/simulator_.timeStepSize();
                 const auto& fs = intQuantsIn.fluidStateTemp();
                 for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++ phaseIdx) {
                    const unsigned activeCompIdx =
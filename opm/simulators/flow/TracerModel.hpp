@@ -31,6 +31,7 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/TimingMacros.hpp>
 
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
 
 #include <opm/grid/utility/ElementChunks.hpp>
@@ -137,7 +138,12 @@ public:
     */
     void init(bool rst)
     {
+        if (simulator_.vanguard().eclState().tracer().size() == 0) {
+            return; // tracer treatment is supposed to be disabled
+        }
+
         this->doInit(rst, simulator_.model().numGridDof(),
+                     *simulator_.problem().transportTopology(),
                      gasPhaseIdx, oilPhaseIdx, waterPhaseIdx);
     }
 
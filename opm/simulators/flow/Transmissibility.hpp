@@ -153,10 +153,19 @@ public:
      *   keywords, or the result of generating connections to or within
      *   numerical aquifers.  Default value: \c false, meaning do not apply
      *   regional multipliers to explicit NNCs.
+     *
+     * \param[in] dirtyCells Compressed indices of the cells whose static
+     *   properties (e.g., permeabilities or multipliers) have changed since
+     *   the last update.  If non-empty, only the faces incident to these
+     *   cells are recomputed and all other entries are left untouched,
+     *   which turns e.g. a small ACTIONX-driven MULTX edit into a local
+     *   operation instead of a full-field recompute.  An empty list (the
+     *   default) requests a full update.
      */
     enum class TransUpdateQuantities { Trans, All };
     void update(bool global, TransUpdateQuantities update_quantities = TransUpdateQuantities::All,
-                const std::function<unsigned int(unsigned int)>& map = {}, bool applyNncMultRegT = false);
+                const std::function<unsigned int(unsigned int)>& map = {}, bool applyNncMultRegT = false,
+                const std::vector<unsigned>& dirtyCells = {});
 
 protected:
     void updateFromEclState_(bool global);
@@ -293,6 +302,10 @@ protected:
     bool enableDiffusivity_;
     bool enableDispersivity_;
     bool warnEditNNC_ = true;
+    // Per-cell dirty flags during an incremental update(); empty during a
+    // full update.  Consulted by the NNC/TRAN helpers so that edits are
+    // only re-applied to the entries that have been recomputed.
+    std::vector<bool> updateDirtyFilter_;
     std::unordered_map<std::uint64_t, Scalar> thermalHalfTrans_; //NB this is based on direction map size is ca 2*trans_ (diffusivity_)
     std::unordered_map<std::uint64_t, Scalar> diffusivity_;
     std::unordered_map<std::uint64_t, Scalar> dispersivity_;
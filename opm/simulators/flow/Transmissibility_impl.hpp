@@ -168,7 +168,8 @@ dispersivity(unsigned elemIdx1, unsigned elemIdx2) const
 template<class Grid, class GridView, class ElementMapper, class CartesianIndexMapper, class Scalar>
 void Transmissibility<Grid,GridView,ElementMapper,CartesianIndexMapper,Scalar>::
 update(bool global, const TransUpdateQuantities update_quantities,
-       const std::function<unsigned int(unsigned int)>& map, const bool applyNncMultregT)
+       const std::function<unsigned int(unsigned int)>& map, const bool applyNncMultregT,
+       const std::vector<unsigned>& dirtyCells)
 {
     // whether only update the permeability related transmissibility
     const bool onlyTrans = (update_quantities == TransUpdateQuantities::Trans);
@@ -194,41 +195,61 @@ update(bool global, const TransUpdateQuantities update_quantities,
 
     const int num_threads = ThreadManager::maxThreads();
 
+    // A non-empty list of dirty cells turns this into an incremental
+    // update: only faces incident to those cells are recomputed and the
+    // existing maps are updated in place rather than being rebuilt.
+    const bool incremental = !dirtyCells.empty();
+    updateDirtyFilter_.clear();
+    if (incremental) {
+        updateDirtyFilter_.assign(numElements, false);
+        for (const unsigned cell : dirtyCells) {
+            updateDirtyFilter_[cell] = true;
+        }
+    }
+
     // reserving some space in the hashmap upfront saves quite a bit of time because
     // resizes are costly for hashmaps and there would be quite a few of them if we
     // would not have a rough idea of how large the final map will be (the rough idea
     // is a conforming Cartesian grid).
-    trans_.clear();
-    if (num_threads == 1) {
-        trans_.reserve(numElements*3*1.05);
-    }
+    if (!incremental) {
+        trans_.clear();
+        if (num_threads == 1) {
+            trans_.reserve(numElements*3*1.05);
+        }
 
-    transBoundary_.clear();
+        transBoundary_.clear();
+    }
 
     // if energy is enabled, let's do the same for the "thermal half transmissibilities"
     if ( enableEnergy_ && !onlyTrans) {
-        thermalHalfTrans_.clear();
-        if (num_threads == 1) {
-            thermalHalfTrans_.reserve(numElements*6*1.05);
-        }
+        if (!incremental) {
+            thermalHalfTrans_.clear();
+            if (num_threads == 1) {
+                thermalHalfTrans_.reserve(numElements*6*1.05);
+            }
 
-        thermalHalfTransBoundary_.clear();
+            thermalHalfTransBoundary_.clear();
+        }
     }
 
     // if diffusion is enabled, let's do the same for the "diffusivity"
     if (updateDiffusivity && !onlyTrans) {
-        diffusivity_.clear();
-        if (num_threads == 1) {
-            diffusivity_.reserve(numElements*3*1.05);
+        if (!incremental) {
+            diffusivity_.clear();
+            if (num_threads == 1) {
+                diffusivity_.reserve(numElements*3*1.05);
+            }
         }
         extractPorosity_();
     }
 
     // if dispersion is enabled, let's do the same for the "dispersivity"
     if (updateDispersivity && !onlyTrans) {
-        dispersivity_.clear();
-        if (num_threads == 1) {
-            dispersivity_.reserve(numElements*3*1.05);
+        if (!incremental) {
+            dispersivity_.clear();
+            if (num_threads == 1) {
+                dispersivity_.reserve(numElements*3*1.05);
+            }
         }
         extractDispersion_();
     }
@@ -257,9 +278,14 @@ update(bool global, const TransUpdateQuantities update_quantities,
 
     // fill the centroids cache to avoid repeated calculations in loops below
     centroids_cache_.resize(gridView_.size(0));
-    for (const auto& elem : elements(gridView_)) {
-        const unsigned elemIdx = elemMapper.index(elem);
-        centroids_cache_[elemIdx] = centroids_(elemIdx);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (const auto& chunk : ElementChunks(gridView_, Dune::Partitions::all, num_threads)) {
+        for (const auto& elem : chunk) {
+            const unsigned elemIdx = elemMapper.index(elem);
+            centroids_cache_[elemIdx] = centroids_(elemIdx);
+        }
     }
 
     auto harmonicMean = [](const Scalar x1, const Scalar x2)
@@ -356,6 +382,11 @@ update(bool global, const TransUpdateQuantities update_quantities,
             for (const auto& intersection : intersections(gridView_, elem)) {
                 // deal with grid boundaries
                 if (intersection.boundary()) {
+                    if (incremental && !updateDirtyFilter_[inside.elemIdx]) {
+                        ++boundaryIsIdx;
+                        continue;
+                    }
+
                     // compute the transmissibilty for the boundary intersection
                     const auto& geometry = intersection.geometry();
                     inside.faceCenter = geometry.center();
@@ -415,6 +446,15 @@ update(bool global, const TransUpdateQuantities update_quantities,
                     continue;
                 }
 
+                // in an incremental update only faces incident to a dirty
+                // cell are recomputed
+                if (incremental &&
+                    !updateDirtyFilter_[inside.elemIdx] &&
+                    !updateDirtyFilter_[outside.elemIdx])
+                {
+                    continue;
+                }
+
                 // local indices of the faces of the inside and
                 // outside elements which contain the intersection
                 inside.faceIdx  = intersection.indexInInside();
@@ -575,6 +615,8 @@ update(bool global, const TransUpdateQuantities update_quantities,
     // If disableNNC == true, remove all non-neighbouring transmissibilities.
     // If disableNNC == false, remove very small non-neighbouring transmissibilities.
     this->removeNonCartesianTransmissibilities_(disableNNC);
+
+    updateDirtyFilter_.clear();
 }
 
 template<class Grid, class GridView, class ElementMapper, class CartesianIndexMapper, class Scalar>
@@ -934,6 +976,15 @@ resetTransmissibilityFromArrays_(const std::array<bool,3>& is_tran,
                 continue;
             }
 
+            if (!updateDirtyFilter_.empty() &&
+                !updateDirtyFilter_[c1] && !updateDirtyFilter_[c2])
+            {
+                // incremental update: this entry was not recomputed and
+                // already carries the TRAN{XYZ} edits; writing the array
+                // value back would apply the edit operations a second time
+                continue;
+            }
+
             auto isID = details::isId(c1, c2);
 
             // For CpGrid with LGRs, when leaf grid view cells with indices c1 and c2
@@ -1084,6 +1135,13 @@ applyPinchNncToGridTrans_(const std::unordered_map<std::size_t,int>& cartesianTo
             continue;
         }
 
+        if (!updateDirtyFilter_.empty() &&
+            !updateDirtyFilter_[low] && !updateDirtyFilter_[high])
+        {
+            // incremental update: entry has not been recomputed
+            continue;
+        }
+
         {
             auto candidate = trans_.find(details::isId(low, high));
             if (candidate != trans_.end()) {
@@ -1107,12 +1165,24 @@ applyNncToGridTrans_(const std::unordered_map<std::size_t,int>& cartesianToCompr
 {
     // First scale NNCs with EDITNNC.
     const auto& nnc_input = eclState_.getInputNNC().input();
+    const std::size_t numNnc = nnc_input.size();
 
-    for (const auto& nncEntry : nnc_input) {
-        auto c1 = nncEntry.cell1;
-        auto c2 = nncEntry.cell2;
-        auto lowIt = cartesianToCompressed.find(c1);
-        auto highIt = cartesianToCompressed.find(c2);
+    // The hash table lookups dominate this loop on models with many NNCs.
+    // Resolve each entry to its slot in trans_ thread parallel and apply
+    // the additions serially in input order afterwards.  Duplicate entries
+    // for the same cell pair are then accumulated in the same order as in
+    // a serial traversal, keeping the result deterministic.
+    enum class NncAction : char { Discard, Apply, WarnInactive };
+    std::vector<NncAction> action(numNnc, NncAction::Discard);
+    std::vector<typename std::unordered_map<std::uint64_t, Scalar>::iterator> candidate(numNnc);
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (std::size_t nncIdx = 0; nncIdx < numNnc; ++nncIdx) {
+        const auto& nncEntry = nnc_input[nncIdx];
+        auto lowIt = cartesianToCompressed.find(nncEntry.cell1);
+        auto highIt = cartesianToCompressed.find(nncEntry.cell2);
         int low = (lowIt == cartesianToCompressed.end())? -1 : lowIt->second;
         int high = (highIt == cartesianToCompressed.end())? -1 : highIt->second;
 
@@ -1126,19 +1196,50 @@ applyNncToGridTrans_(const std::unordered_map<std::size_t,int>& cartesianToCompr
         }
 
         if (low == -1 || high == -1) {
-            // Discard the NNC if it is between active cell and inactive cell
-            std::ostringstream sstr;
-            sstr << "NNC between active and inactive cells ("
-                 << low << " -> " << high << ") with globalcell is (" << c1 << "->" << c2 <<")";
-            OpmLog::warning(sstr.str());
+            // Discard the NNC if it is between active cell and inactive
+            // cell.  Warn only in full updates; incremental updates would
+            // otherwise repeat the warning on every property edit.
+            action[nncIdx] = updateDirtyFilter_.empty()
+                ? NncAction::WarnInactive : NncAction::Discard;
+            continue;
+        }
+
+        if (!updateDirtyFilter_.empty() &&
+            !updateDirtyFilter_[low] && !updateDirtyFilter_[high])
+        {
+            // incremental update: this entry's transmissibility has not
+            // been recomputed, so the NNC contribution is still in place
             continue;
         }
 
-        if (auto candidate = trans_.find(details::isId(low, high)); candidate != trans_.end()) {
+        if (auto it = trans_.find(details::isId(low, high)); it != trans_.end()) {
             // NNC is represented by the grid and might be a neighboring connection
             // In this case the transmissibilty is added to the value already
             // set or computed.
-            candidate->second += nncEntry.trans;
+            action[nncIdx] = NncAction::Apply;
+            candidate[nncIdx] = it;
+        }
+    }
+
+    for (std::size_t nncIdx = 0; nncIdx < numNnc; ++nncIdx) {
+        if (action[nncIdx] == NncAction::Apply) {
+            candidate[nncIdx]->second += nnc_input[nncIdx].trans;
+        }
+        else if (action[nncIdx] == NncAction::WarnInactive) {
+            const auto& nncEntry = nnc_input[nncIdx];
+            auto lowIt = cartesianToCompressed.find(nncEntry.cell1);
+            auto highIt = cartesianToCompressed.find(nncEntry.cell2);
+            int low = (lowIt == cartesianToCompressed.end())? -1 : lowIt->second;
+            int high = (highIt == cartesianToCompressed.end())? -1 : highIt->second;
+            if (low > high) {
+                std::swap(low, high);
+            }
+
+            std::ostringstream sstr;
+            sstr << "NNC between active and inactive cells ("
+                 << low << " -> " << high << ") with globalcell is ("
+                 << nncEntry.cell1 << "->" << nncEntry.cell2 <<")";
+            OpmLog::warning(sstr.str());
         }
         // if (enableEnergy_) {
         //     auto candidate = thermalHalfTrans_.find(details::directionalIsId(low, high));
@@ -1254,6 +1355,17 @@ applyEditNncToGridTransHelper_(const std::unordered_map<std::size_t,int>& global
             std::swap(low, high);
         }
 
+        if (!updateDirtyFilter_.empty() &&
+            !updateDirtyFilter_[low] && !updateDirtyFilter_[high])
+        {
+            // incremental update: the previously applied edit for this
+            // connection is still in place, do not apply it again
+            while (nnc != end && c1 == nnc->cell1 && c2 == nnc->cell2) {
+                ++nnc;
+            }
+            continue;
+        }
+
         auto candidate = trans_.find(details::isId(low, high));
         if (candidate == trans_.end() && warnEditNNC_) {
             print_warning(*nnc);
@@ -1317,6 +1429,13 @@ applyNncMultreg_(const std::unordered_map<std::size_t,int>& cartesianToCompresse
                 std::swap(low, high);
             }
 
+            if (!updateDirtyFilter_.empty() &&
+                !updateDirtyFilter_[low] && !updateDirtyFilter_[high])
+            {
+                // incremental update: entry has not been recomputed
+                continue;
+            }
+
             auto candidate = this->trans_.find(details::isId(low, high));
             if (candidate != this->trans_.end()) {
                 candidate->second *= transMult.getRegionMultiplierNNC(c1, c2);
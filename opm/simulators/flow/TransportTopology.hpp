@@ -0,0 +1,161 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::TransportTopology
+ */
+#ifndef OPM_TRANSPORT_TOPOLOGY_HPP
+#define OPM_TRANSPORT_TOPOLOGY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief Immutable cell-adjacency graph shared by the scalar transport
+ *        matrices (tracer and energy).
+ *
+ * The tracer and temperature models solve decoupled transport systems on
+ * the same grid, so their matrices all have the sparsity pattern of the
+ * flow Jacobian's cell-to-cell coupling. This class stores that pattern
+ * once in CSR form (row pointers plus column indices, sorted ascendingly
+ * per row) so the stencil sweep and the per-dof neighbor sets it used to
+ * require are not repeated for every matrix.
+ */
+class TransportTopology
+{
+public:
+    //! \brief Lightweight per-row view with the set-like interface
+    //!        expected by SparseMatrixAdapter::reserve().
+    class RowView
+    {
+    public:
+        RowView(const unsigned* begin, const unsigned* end)
+            : begin_(begin), end_(end)
+        {}
+
+        std::size_t size() const { return end_ - begin_; }
+        const unsigned* begin() const { return begin_; }
+        const unsigned* end() const { return end_; }
+
+    private:
+        const unsigned* begin_;
+        const unsigned* end_;
+    };
+
+    /*!
+     * \brief Build the topology with a single sweep over the grid.
+     *
+     * Each degree of freedom is coupled to all degrees of freedom of the
+     * stencils it appears in (including itself, since degrees of freedom
+     * are sometimes quite egocentric).
+     */
+    template <class Stencil, class GridView, class DofMapper>
+    static std::shared_ptr<const TransportTopology>
+    create(const GridView& gridView, const DofMapper& dofMapper, std::size_t numDof)
+    {
+        std::vector<std::vector<unsigned>> neighbors(numDof);
+
+        Stencil stencil(gridView, dofMapper);
+        for (const auto& elem : elements(gridView)) {
+            stencil.update(elem);
+
+            for (unsigned primaryDofIdx = 0; primaryDofIdx < stencil.numPrimaryDof(); ++primaryDofIdx) {
+                const unsigned myIdx = stencil.globalSpaceIndex(primaryDofIdx);
+
+                for (unsigned dofIdx = 0; dofIdx < stencil.numDof(); ++dofIdx) {
+                    neighbors[myIdx].push_back(stencil.globalSpaceIndex(dofIdx));
+                }
+            }
+        }
+
+        auto topology = std::make_shared<TransportTopology>();
+        topology->rowPointers_.reserve(numDof + 1);
+        topology->rowPointers_.push_back(0);
+        for (auto& row : neighbors) {
+            std::sort(row.begin(), row.end());
+            row.erase(std::unique(row.begin(), row.end()), row.end());
+            topology->columnIndices_.insert(topology->columnIndices_.end(),
+                                            row.begin(), row.end());
+            topology->rowPointers_.push_back(topology->columnIndices_.size());
+        }
+
+        return topology;
+    }
+
+    std::size_t numDof() const
+    { return rowPointers_.empty() ? 0 : rowPointers_.size() - 1; }
+
+    std::size_t numConnections() const
+    { return columnIndices_.size(); }
+
+    const std::vector<unsigned>& rowPointers() const
+    { return rowPointers_; }
+
+    const std::vector<unsigned>& columnIndices() const
+    { return columnIndices_; }
+
+    //! \brief One view per row, suitable for SparseMatrixAdapter::reserve().
+    std::vector<RowView> rowViews() const
+    {
+        std::vector<RowView> views;
+        views.reserve(numDof());
+        for (std::size_t dofIdx = 0; dofIdx < numDof(); ++dofIdx) {
+            views.emplace_back(columnIndices_.data() + rowPointers_[dofIdx],
+                               columnIndices_.data() + rowPointers_[dofIdx + 1]);
+        }
+        return views;
+    }
+
+    //! \brief Allocate a BCRS matrix with this sparsity pattern.
+    template <class Matrix>
+    std::unique_ptr<Matrix> makeMatrix() const
+    {
+        auto matrix = std::make_unique<Matrix>(numDof(), numDof(), Matrix::random);
+
+        for (std::size_t dofIdx = 0; dofIdx < numDof(); ++dofIdx) {
+            matrix->setrowsize(dofIdx, rowPointers_[dofIdx + 1] - rowPointers_[dofIdx]);
+        }
+        matrix->endrowsizes();
+
+        for (std::size_t dofIdx = 0; dofIdx < numDof(); ++dofIdx) {
+            for (unsigned j = rowPointers_[dofIdx]; j < rowPointers_[dofIdx + 1]; ++j) {
+                matrix->addindex(dofIdx, columnIndices_[j]);
+            }
+        }
+        matrix->endindices();
+
+        return matrix;
+    }
+
+private:
+    std::vector<unsigned> rowPointers_;
+    std::vector<unsigned> columnIndices_;
+};
+
+} // namespace Opm
+
+#endif // OPM_TRANSPORT_TOPOLOGY_HPP
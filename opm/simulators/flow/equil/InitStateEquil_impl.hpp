@@ -1977,65 +1977,66 @@ calcPressSatRsRv(const RMap& reg,
 
     auto ptable = Details::PressureTable<FluidSystem, EquilReg<Scalar>>{ grav, this->num_pressure_points_ };
     auto psat   = PhaseSat { materialLawManager, this->swatInit_ };
-    auto vspan  = std::array<Scalar, 2>{};
 
-    std::vector<int> regionIsEmpty(rec.size(), 0);
-    for (std::size_t r = 0; r < rec.size(); ++r) {
-        const auto& cells = reg.cells(r);
+    const int numRegions = rec.size();
+
+    // The vertical extents involve global reductions and must therefore be
+    // established region by region before the region loop below can run
+    // thread parallel.
+    std::vector<std::array<Scalar, 2>> vspans(numRegions);
+    std::vector<int> regionIsEmpty(numRegions, 0);
+    for (int r = 0; r < numRegions; ++r) {
+        Details::verticalExtent(reg.cells(r), cellZMinMax_, comm, vspans[r]);
+        if (reg.cells(r).empty()) {
+            regionIsEmpty[r] = 1;
+        }
+    }
 
-        Details::verticalExtent(cells, cellZMinMax_, comm, vspan);
+    // The equilibration regions cover disjoint cell sets, so the expensive
+    // part -- the ODE integration in PressureTable::equilibrate() and the
+    // per-cell saturation derivation -- runs thread parallel with private
+    // pressure-table and saturation-engine copies.  The SWATINIT scaling
+    // performed through psat only mutates per-cell data in the material
+    // law manager and is hence safe for disjoint regions.
+    OPM_BEGIN_PARALLEL_TRY_CATCH();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) firstprivate(ptable, psat)
+#endif
+    for (int r = 0; r < numRegions; ++r) {
+        if (regionIsEmpty[r]) {
+            continue;
+        }
 
+        const auto& cells = reg.cells(r);
         const auto acc = rec[r].initializationTargetAccuracy();
+        const auto eqreg = EquilReg {
+            rec[r], this->rsFunc_[r], this->rvFunc_[r], this->rvwFunc_[r],
+            this->tempVdTable_[r], this->saltVdTable_[r], this->regionPvtIdx_[r]
+        };
+
+        // Ensure contacts are within the span
+        auto vspan = vspans[r];
+        vspan[0] = std::min(vspan[0], std::min(eqreg.zgoc(), eqreg.zwoc()));
+        vspan[1] = std::max(vspan[1], std::max(eqreg.zgoc(), eqreg.zwoc()));
+        ptable.equilibrate(eqreg, vspan);
+
         if (acc > 0) {
             // The grid blocks are treated as being tilted
-            // First check if the region has cells
-            if (cells.empty()) {
-                regionIsEmpty[r] = 1;
-                continue;
-            }
-            const auto eqreg = EquilReg {
-                rec[r], this->rsFunc_[r], this->rvFunc_[r], this->rvwFunc_[r],
-                this->tempVdTable_[r], this->saltVdTable_[r], this->regionPvtIdx_[r]
-            };
-            // Ensure contacts are within the span
-            vspan[0] = std::min(vspan[0], std::min(eqreg.zgoc(), eqreg.zwoc()));
-            vspan[1] = std::max(vspan[1], std::max(eqreg.zgoc(), eqreg.zwoc()));
-            ptable.equilibrate(eqreg, vspan);
             // For titled blocks, we can use a simple weightening based on title of the grid
             // this->equilibrateTiltedFaultBlockSimple(cells, eqreg, gridView, acc, ptable, psat);
             this->equilibrateTiltedFaultBlock(cells, eqreg, gridView, acc, ptable, psat);
         }
         else if (acc == 0) {
-            if (cells.empty()) {
-                regionIsEmpty[r] = 1;
-                continue;
-            }
-            const auto eqreg = EquilReg {
-                rec[r], this->rsFunc_[r], this->rvFunc_[r], this->rvwFunc_[r],
-                this->tempVdTable_[r], this->saltVdTable_[r], this->regionPvtIdx_[r]
-            };
-            vspan[0] = std::min(vspan[0], std::min(eqreg.zgoc(), eqreg.zwoc()));
-            vspan[1] = std::max(vspan[1], std::max(eqreg.zgoc(), eqreg.zwoc()));
-            ptable.equilibrate(eqreg, vspan);
             // Centre-point method
             this->equilibrateCellCentres(cells, eqreg, ptable, psat);
         }
-        else if (acc < 0) {
-            if (cells.empty()) {
-                regionIsEmpty[r] = 1;
-                continue;
-            }
-            const auto eqreg = EquilReg {
-                rec[r], this->rsFunc_[r], this->rvFunc_[r], this->rvwFunc_[r],
-                this->tempVdTable_[r], this->saltVdTable_[r], this->regionPvtIdx_[r]
-            };
-            vspan[0] = std::min(vspan[0], std::min(eqreg.zgoc(), eqreg.zwoc()));
-            vspan[1] = std::max(vspan[1], std::max(eqreg.zgoc(), eqreg.zwoc()));
-            ptable.equilibrate(eqreg, vspan);
+        else {
             // Horizontal subdivision
             this->equilibrateHorizontal(cells, eqreg, -acc, ptable, psat);
         }
     }
+    OPM_END_PARALLEL_TRY_CATCH("InitialStateComputer::calcPressSatRsRv() failed: ", comm);
+
     comm.min(regionIsEmpty.data(),regionIsEmpty.size());
     if (comm.rank() == 0) {
         for (std::size_t r = 0; r < rec.size(); ++r) {
@@ -160,6 +160,24 @@ public:
               const GridView&                                grid_view,
               const Opm::ZoltanPartitioningControl<Element>& zoltan_ctrl) const;
 
+    /// Assign computational weights to the rank's interior cells.
+    ///
+    /// \tparam GridView DUNE grid view type
+    ///
+    /// \tparam Element Grid view's representation of a cell.
+    ///
+    /// \param[in] cell_weights Weight of each interior cell in \p
+    ///   grid_view traversal order.
+    ///
+    /// \param[in] grid_view Current rank's reachable cells.
+    ///
+    /// \param[in] zoltan_ctrl Control parameters for on-rank subdomain
+    ///   partitioning.
+    template <class GridView, class Element>
+    void setCellWeights(const std::vector<double>&                     cell_weights,
+                        const GridView&                                grid_view,
+                        const Opm::ZoltanPartitioningControl<Element>& zoltan_ctrl);
+
 private:
     /// Zoltan partitioning backend.
     Opm::ParallelNLDDPartitioningZoltan partitioner_;
@@ -293,6 +311,23 @@ ZoltanPartitioner::partition(const int                                      num_
     return partition;
 }
 
+template <class GridView, class Element>
+void ZoltanPartitioner::setCellWeights(const std::vector<double>&                     cell_weights,
+                                       const GridView&                                grid_view,
+                                       const Opm::ZoltanPartitioningControl<Element>& zoltan_ctrl)
+{
+    // Map the interior-cell weights onto the partitioner's local vertex
+    // numbering, which covers both interior and overlap cells.
+    auto weights = std::vector<double>(grid_view.size(0), 1.0);
+
+    auto cell = std::vector<double>::size_type{0};
+    for (const auto& element : elements(grid_view, Dune::Partitions::interior)) {
+        weights[zoltan_ctrl.index(element)] = cell_weights[cell++];
+    }
+
+    this->partitioner_.setVertexWeights(std::move(weights));
+}
+
 template <class GridView, class Element>
 std::unordered_map<int, int>
 ZoltanPartitioner::connectElements(const GridView&                                grid_view,
@@ -431,7 +466,8 @@ partitionCellsZoltan(const int                                             num_d
                      const std::vector<Opm::Well>&                         wells,
                      const std::unordered_map<std::string, std::set<int>>& possibleFutureConnections,
                      const Opm::ZoltanPartitioningControl<Element>&        zoltan_ctrl,
-                     const int                                             num_neighbor_levels)
+                     const int                                             num_neighbor_levels,
+                     const std::vector<double>&                            cell_weights)
 {
     if (num_domains <= 1) {     // No partitioning => every cell in domain zero.
         const auto num_interior_cells =
@@ -448,6 +484,10 @@ partitionCellsZoltan(const int                                             num_d
 
     partitioner.buildLocalGraph(grid_view, wells, possibleFutureConnections, zoltan_ctrl, num_neighbor_levels);
 
+    if (! cell_weights.empty()) {
+        partitioner.setCellWeights(cell_weights, grid_view, zoltan_ctrl);
+    }
+
     return partitioner.partition(num_domains, grid_view, zoltan_ctrl);
 }
 
@@ -667,12 +707,14 @@ Opm::partitionCells(const std::string& method,
                     [[maybe_unused]] const std::vector<Well>&                              wells,
                     [[maybe_unused]] const std::unordered_map<std::string, std::set<int>>& possibleFutureConnections,
                     [[maybe_unused]] const ZoltanPartitioningControl<Element>&             zoltan_ctrl,
-                    [[maybe_unused]] const int                                             num_neighbor_levels)
+                    [[maybe_unused]] const int                                             num_neighbor_levels,
+                    [[maybe_unused]] const std::vector<double>&                            cell_weights)
 {
     if (method == "zoltan") {
 #if HAVE_MPI && HAVE_ZOLTAN
 
-        return partitionCellsZoltan(num_local_domains, grid_view, wells, possibleFutureConnections, zoltan_ctrl, num_neighbor_levels);
+        return partitionCellsZoltan(num_local_domains, grid_view, wells, possibleFutureConnections,
+                                    zoltan_ctrl, num_neighbor_levels, cell_weights);
 
 #else // !HAVE_MPI || !HAVE_ZOLTAN
 
@@ -768,7 +810,8 @@ Opm::partitionCellsSimple(const int num_cells, const int num_domains)
                         const Opm::ZoltanPartitioningControl<                  \
                         typename std::remove_cv_t<std::remove_reference_t<     \
                         decltype(std::declval<Grid>().leafGridView())>>::template Codim<0>::Entity>&, \
-                        const int)
+                        const int,                                             \
+                        const std::vector<double>&)
 
 // ---------------------------------------------------------------------------
 // Grid types built into Flow.
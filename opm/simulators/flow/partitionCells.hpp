@@ -89,6 +89,11 @@ struct ZoltanPartitioningControl
 /// \param[in] num_neighbor_levels Number of neighbor levels to consider for partitioning.
 ///   0 means only direct well connections are considered, 1 means one level of neighbors, etc.
 ///
+/// \param[in] cell_weights Computational weight of each cell in \p
+///    grid_view traversal order for its interior cells.  An empty vector,
+///    the default, treats all cells as equally expensive.  Not used unless
+///    \code method == "zoltan" \endcode.
+///
 /// \return Partition vector--subdomain ID for each cell in \p grid_view
 ///    traversal order for its interior cells--and the number of subdomains
 ///    on current rank.
@@ -100,7 +105,8 @@ partitionCells(const std::string&                                    method,
                const std::vector<Well>&                              wells,
                const std::unordered_map<std::string, std::set<int>>& possibleFutureConnections,
                const ZoltanPartitioningControl<Element>&             zoltan_ctrl,
-               const int                                             num_neighbor_levels);
+               const int                                             num_neighbor_levels,
+               const std::vector<double>&                            cell_weights = {});
 
 /// Read a partitioning from file, assumed to contain one number per cell, its partition number.
 /// \return pair containing a partition vector (partition number for each cell), and the number of partitions.
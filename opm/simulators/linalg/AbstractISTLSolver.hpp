@@ -21,6 +21,8 @@
 #include <opm/simulators/linalg/FlowLinearSolverParameters.hpp>
 #include <opm/simulators/linalg/PropertyTree.hpp>
 
+#include <cstddef>
+
 namespace Opm
 {
 
@@ -180,6 +182,21 @@ public:
      */
     virtual int getSolveCount() const = 0;
 
+    /**
+     * \brief Release the solver and preconditioner hierarchy to reclaim memory.
+     *
+     * The hierarchy is recreated on the next call to prepare(). The default
+     * implementation does nothing, for solvers that hold no reusable state.
+     */
+    virtual void releaseSolverHierarchy() {}
+
+    /**
+     * \brief Estimate of the memory held by the reusable solver hierarchy in bytes.
+     *
+     * Used by the memory budget accounting; zero when nothing is held.
+     */
+    virtual std::size_t solverHierarchyBytes() const { return 0; }
+
 protected:
 
     /**
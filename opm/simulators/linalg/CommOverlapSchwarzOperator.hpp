@@ -0,0 +1,292 @@
+/*
+  Copyright 2025 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_COMMOVERLAPSCHWARZOPERATOR_HEADER_INCLUDED
+#define OPM_COMMOVERLAPSCHWARZOPERATOR_HEADER_INCLUDED
+
+#include <dune/common/shared_ptr.hh>
+#include <dune/istl/operators.hh>
+#include <dune/istl/owneroverlapcopy.hh>
+
+#include <opm/common/TimingMacros.hpp>
+
+#if HAVE_MPI
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+/*!
+   \brief Overlapping-Schwarz style linear operator that hides the halo
+   exchange behind the interior part of the sparse matrix-vector product.
+
+   Dune::OverlappingSchwarzOperator assumes a consistent input vector, so
+   the caller has to complete the (blocking) copyOwnerToAll before the SpMV
+   can start.  This operator instead takes ownership of the halo update:
+   apply() starts the non-blocking exchange of the overlap entries of x,
+   computes all owner rows whose stencil only touches owner entries while
+   the messages are in flight, and finishes the rows that reference copy
+   (ghost) entries after the receives have completed.  At high rank counts
+   this hides most of the communication time that otherwise shows up as
+   waits inside Dune::OwnerOverlapCopyCommunication.
+
+   The row partition and the per-neighbor message plan are built once from
+   the matrix sparsity pattern and the parallel index set; only the pack,
+   exchange and unpack happen per apply.  Note that, like copyOwnerToAll
+   on a single vector, the exchange writes the copy entries of x, so those
+   entries are treated as scratch storage.
+ */
+template<class M, class X, class Y, class C>
+class CommOverlapSchwarzOperator : public Dune::AssembledLinearOperator<M,X,Y>
+{
+public:
+    using matrix_type = M;
+    using domain_type = X;
+    using range_type = Y;
+    using field_type = typename X::field_type;
+    using communication_type = C;
+
+    static constexpr int block_size = X::block_type::dimension;
+
+    Dune::SolverCategory::Category category() const override
+    {
+        return Dune::SolverCategory::overlapping;
+    }
+
+    CommOverlapSchwarzOperator(const M& A, const communication_type& comm)
+        : A_(Dune::stackobject_to_shared_ptr(A))
+        , comm_(comm)
+    {
+        buildExchangePlan_();
+        buildRowPartition_();
+    }
+
+    CommOverlapSchwarzOperator(std::shared_ptr<const M> A, const communication_type& comm)
+        : A_(std::move(A))
+        , comm_(comm)
+    {
+        buildExchangePlan_();
+        buildRowPartition_();
+    }
+
+    void apply(const X& x, Y& y) const override
+    {
+        OPM_TIMEBLOCK(apply);
+        startExchange_(x);
+        for (const auto rowIdx : interiorRows_) {
+            y[rowIdx] = 0;
+            const auto& row = (*A_)[rowIdx];
+            const auto endc = row.end();
+            for (auto col = row.begin(); col != endc; ++col)
+                (*col).umv(x[col.index()], y[rowIdx]);
+        }
+        finishExchange_(x);
+        for (const auto rowIdx : boundaryRows_) {
+            y[rowIdx] = 0;
+            const auto& row = (*A_)[rowIdx];
+            const auto endc = row.end();
+            for (auto col = row.begin(); col != endc; ++col)
+                (*col).umv(x[col.index()], y[rowIdx]);
+        }
+        for (const auto rowIdx : ghostRows_)
+            y[rowIdx] = 0;
+    }
+
+    // y += \alpha * A * x
+    void applyscaleadd(field_type alpha, const X& x, Y& y) const override
+    {
+        OPM_TIMEBLOCK(applyscaleadd);
+        startExchange_(x);
+        for (const auto rowIdx : interiorRows_) {
+            const auto& row = (*A_)[rowIdx];
+            const auto endc = row.end();
+            for (auto col = row.begin(); col != endc; ++col)
+                (*col).usmv(alpha, x[col.index()], y[rowIdx]);
+        }
+        finishExchange_(x);
+        for (const auto rowIdx : boundaryRows_) {
+            const auto& row = (*A_)[rowIdx];
+            const auto endc = row.end();
+            for (auto col = row.begin(); col != endc; ++col)
+                (*col).usmv(alpha, x[col.index()], y[rowIdx]);
+        }
+        for (const auto rowIdx : ghostRows_)
+            y[rowIdx] = 0;
+    }
+
+    const matrix_type& getmat() const override
+    {
+        return *A_;
+    }
+
+    const communication_type& comm() const
+    {
+        return comm_;
+    }
+
+private:
+    // Per-neighbor message: local indices to pack/unpack and the offset of
+    // this neighbor's section in the flat send/receive buffers (in scalars).
+    struct Message {
+        int rank;
+        std::vector<std::size_t> sendIndices;
+        std::vector<std::size_t> recvIndices;
+        std::size_t sendStart = 0;
+        std::size_t recvStart = 0;
+    };
+
+    void buildExchangePlan_()
+    {
+        // Same pairing as Dune's buffered communicator: for every neighbor
+        // we send our owner entries that the remote holds as copies and
+        // receive into our copy entries owned by the remote.
+        const auto& ri = comm_.remoteIndices();
+        std::map<int, Message> plan;
+        for (const auto& process : ri) {
+            auto& msg = plan[process.first];
+            msg.rank = process.first;
+            for (auto remote = process.second.first->begin(),
+                      remoteEnd = process.second.first->end();
+                 remote != remoteEnd; ++remote) {
+                if (remote->localIndexPair().local().attribute()
+                    == Dune::OwnerOverlapCopyAttributeSet::owner) {
+                    msg.sendIndices.push_back(remote->localIndexPair().local().local());
+                }
+            }
+            for (auto remote = process.second.second->begin(),
+                      remoteEnd = process.second.second->end();
+                 remote != remoteEnd; ++remote) {
+                if (remote->attribute() == Dune::OwnerOverlapCopyAttributeSet::owner) {
+                    msg.recvIndices.push_back(remote->localIndexPair().local().local());
+                }
+            }
+        }
+
+        std::size_t sendSize = 0;
+        std::size_t recvSize = 0;
+        for (auto& [rank, msg] : plan) {
+            if (msg.sendIndices.empty() && msg.recvIndices.empty())
+                continue;
+            msg.sendStart = sendSize;
+            msg.recvStart = recvSize;
+            sendSize += msg.sendIndices.size() * block_size;
+            recvSize += msg.recvIndices.size() * block_size;
+            messages_.push_back(std::move(msg));
+        }
+        sendBuf_.resize(sendSize);
+        recvBuf_.resize(recvSize);
+        requests_.resize(2 * messages_.size());
+    }
+
+    void buildRowPartition_()
+    {
+        const std::size_t numRows = A_->N();
+        std::vector<bool> isCopy(numRows, false);
+        for (const auto& index : comm_.indexSet()) {
+            if (index.local().attribute() == Dune::OwnerOverlapCopyAttributeSet::copy)
+                isCopy[index.local().local()] = true;
+        }
+
+        for (auto row = A_->begin(), rowEnd = A_->end(); row != rowEnd; ++row) {
+            if (isCopy[row.index()]) {
+                ghostRows_.push_back(row.index());
+                continue;
+            }
+            bool touchesCopy = false;
+            for (auto col = (*row).begin(), endc = (*row).end(); col != endc; ++col) {
+                if (isCopy[col.index()]) {
+                    touchesCopy = true;
+                    break;
+                }
+            }
+            if (touchesCopy)
+                boundaryRows_.push_back(row.index());
+            else
+                interiorRows_.push_back(row.index());
+        }
+    }
+
+    void startExchange_(const X& x) const
+    {
+        std::size_t req = 0;
+        for (const auto& msg : messages_) {
+            if (!msg.recvIndices.empty()) {
+                MPI_Irecv(recvBuf_.data() + msg.recvStart,
+                          static_cast<int>(msg.recvIndices.size() * block_size),
+                          Dune::MPITraits<field_type>::getType(),
+                          msg.rank, commTag_, comm_.communicator(),
+                          &requests_[req++]);
+            }
+        }
+        for (const auto& msg : messages_) {
+            if (!msg.sendIndices.empty()) {
+                std::size_t pos = msg.sendStart;
+                for (const auto idx : msg.sendIndices)
+                    for (int comp = 0; comp < block_size; ++comp)
+                        sendBuf_[pos++] = x[idx][comp];
+                MPI_Isend(sendBuf_.data() + msg.sendStart,
+                          static_cast<int>(msg.sendIndices.size() * block_size),
+                          Dune::MPITraits<field_type>::getType(),
+                          msg.rank, commTag_, comm_.communicator(),
+                          &requests_[req++]);
+            }
+        }
+        activeRequests_ = req;
+    }
+
+    void finishExchange_(const X& x) const
+    {
+        MPI_Waitall(static_cast<int>(activeRequests_), requests_.data(),
+                    MPI_STATUSES_IGNORE);
+        // The copy entries of x are scratch storage for the operator, see
+        // the class documentation.
+        X& xMutable = const_cast<X&>(x);
+        for (const auto& msg : messages_) {
+            std::size_t pos = msg.recvStart;
+            for (const auto idx : msg.recvIndices)
+                for (int comp = 0; comp < block_size; ++comp)
+                    xMutable[idx][comp] = recvBuf_[pos++];
+        }
+    }
+
+    constexpr static int commTag_ = 4792;
+
+    std::shared_ptr<const matrix_type> A_;
+    const communication_type& comm_;
+    std::vector<Message> messages_;
+    std::vector<std::size_t> interiorRows_;
+    std::vector<std::size_t> boundaryRows_;
+    std::vector<std::size_t> ghostRows_;
+    mutable std::vector<field_type> sendBuf_;
+    mutable std::vector<field_type> recvBuf_;
+    mutable std::vector<MPI_Request> requests_;
+    mutable std::size_t activeRequests_ = 0;
+};
+
+} // namespace Opm
+
+#endif // HAVE_MPI
+
+#endif // OPM_COMMOVERLAPSCHWARZOPERATOR_HEADER_INCLUDED
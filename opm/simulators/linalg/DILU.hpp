@@ -26,7 +26,9 @@
 #include <dune/common/version.hh>
 #include <dune/istl/bcrsmatrix.hh>
 
+#include <opm/simulators/linalg/DILUKernels.hpp>
 #include <opm/simulators/linalg/GraphColoring.hpp>
+#include <opm/simulators/linalg/SmallDenseMatrixUtils.hpp>
 
 #include <cstddef>
 #include <optional>
@@ -49,7 +51,7 @@ namespace Dune
    \tparam Y Type of the defect
 */
 template <class M, class X, class Y>
-class MultithreadDILU : public PreconditionerWithUpdate<X, Y>
+class MultithreadDILU final : public PreconditionerWithUpdate<X, Y>
 {
 public:
     //! \brief The matrix type the preconditioner is for.
@@ -197,7 +199,7 @@ private:
                 // if A[i, j] != 0 and A[j, i] != 0
                 if (a_ji != A_[col_j].end()) {
                     // Dinv_temp -= A[i, j] * d[j] * A[j, i]
-                    Dinv_temp -= (*a_ij) * Dune::FieldMatrix(Dinv_[col_j]) * (*a_ji);
+                    Opm::detail::subtractTripleProduct(*a_ij, Dinv_[col_j], *a_ji, Dinv_temp);
                 }
             }
             Dinv_temp.invert();
@@ -239,7 +241,7 @@ private:
                     const auto a_ji = (*A_reordered_)[col_j].find(row_i);
                     if (a_ji != (*A_reordered_)[col_j].end()) {
                         // Dinv_temp -= A[i, j] * d[j] * A[j, i]
-                        Dinv_temp -= (*a_ij) * Dune::FieldMatrix(Dinv_[col_j]) * (*a_ji);
+                        Opm::detail::subtractTripleProduct(*a_ij, Dinv_[col_j], *a_ji, Dinv_temp);
                     }
                 }
                 Dinv_temp.invert();
@@ -258,47 +260,18 @@ private:
         // Working with defect d = b - Ax and update v = x_{n+1} - x_n
         // solving the product M^-1(d) using upper and lower triangular solve
         // v = M^{-1}*d = (D + U_A)^{-1} D (D + L_A)^{-1} * d
-        // lower triangular solve: (D + L_A) y = d
-        using Xblock = typename X::block_type;
-        using Yblock = typename Y::block_type;
+        // The sweeps live in DILUKernels.hpp so the common block types
+        // resolve to the multiversioned overloads in DILUKernels.cpp.
         {
             OPM_TIMEBLOCK(lower_solve);
-            auto endi = A_.end();
-            for (auto row = A_.begin(); row != endi; ++row) {
-                const auto row_i = row.index();
-                Yblock rhs = d[row_i];
-                for (auto a_ij = (*row).begin(); a_ij.index() < row_i; ++a_ij) {
-                    // if  A[i][j] != 0
-                    // rhs -= A[i][j]* y[j], where v_j stores y_j
-                    const auto col_j = a_ij.index();
-                    a_ij->mmv(v[col_j], rhs);
-                }
-                // y_i = Dinv_i * rhs
-                // storing y_i in v_i
-                Dinv_[row_i].mv(rhs, v[row_i]); // (D + L_A)_ii = D_i
-            }
+            // lower triangular solve: (D + L_A) y = d
+            Opm::detail::diluSerialLowerSolve(A_, Dinv_, v, d);
         }
 
         {
             OPM_TIMEBLOCK(upper_solve);
-
             // upper triangular solve: (D + U_A) v = Dy
-            auto rendi = A_.beforeBegin();
-            for (auto row = A_.beforeEnd(); row != rendi; --row) {
-                const auto row_i = row.index();
-                // rhs = 0
-                Xblock rhs(0.0);
-                for (auto a_ij = (*row).beforeEnd(); a_ij.index() > row_i; --a_ij) {
-                    // if A[i][j] != 0
-                    // rhs += A[i][j]*v[j]
-                    const auto col_j = a_ij.index();
-                    a_ij->umv(v[col_j], rhs);
-                }
-                // calculate update v = M^-1*d
-                // v_i = y_i - Dinv_i*rhs
-                // before update v_i is y_i
-                Dinv_[row_i].mmv(rhs, v[row_i]);
-            }
+            Opm::detail::diluSerialUpperSolve(A_, Dinv_, v);
         }
     }
 
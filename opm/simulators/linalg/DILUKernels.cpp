@@ -0,0 +1,65 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+#include <opm/simulators/linalg/DILUKernels.hpp>
+
+#include <opm/simulators/utils/TargetClones.hpp>
+
+namespace Opm::detail
+{
+
+// Each overload forwards to the generic template (the <> keeps the call
+// from resolving back to the overload itself). The template body is
+// inlined here and, through OPM_TARGET_CLONES, compiled once per
+// instruction set with load-time dispatch, so the dense block updates
+// in the sweeps vectorize as far as the executing CPU allows.
+#define OPM_DILU_KERNELS_DEFINE(T, N)                                                   \
+    OPM_TARGET_CLONES                                                                   \
+    void diluSerialLowerSolve(const Dune::BCRSMatrix<MatrixBlock<T, N, N>>& A,          \
+                              const std::vector<MatrixBlock<T, N, N>>& Dinv,            \
+                              Dune::BlockVector<Dune::FieldVector<T, N>>& v,            \
+                              const Dune::BlockVector<Dune::FieldVector<T, N>>& d)      \
+    {                                                                                   \
+        diluSerialLowerSolve<>(A, Dinv, v, d);                                          \
+    }                                                                                   \
+    OPM_TARGET_CLONES                                                                   \
+    void diluSerialUpperSolve(const Dune::BCRSMatrix<MatrixBlock<T, N, N>>& A,          \
+                              const std::vector<MatrixBlock<T, N, N>>& Dinv,            \
+                              Dune::BlockVector<Dune::FieldVector<T, N>>& v)            \
+    {                                                                                   \
+        diluSerialUpperSolve<>(A, Dinv, v);                                             \
+    }
+
+OPM_DILU_KERNELS_DEFINE(double, 1)
+OPM_DILU_KERNELS_DEFINE(double, 2)
+OPM_DILU_KERNELS_DEFINE(double, 3)
+OPM_DILU_KERNELS_DEFINE(double, 4)
+OPM_DILU_KERNELS_DEFINE(double, 5)
+OPM_DILU_KERNELS_DEFINE(double, 6)
+
+OPM_DILU_KERNELS_DEFINE(float, 1)
+OPM_DILU_KERNELS_DEFINE(float, 2)
+OPM_DILU_KERNELS_DEFINE(float, 3)
+OPM_DILU_KERNELS_DEFINE(float, 4)
+OPM_DILU_KERNELS_DEFINE(float, 5)
+OPM_DILU_KERNELS_DEFINE(float, 6)
+
+#undef OPM_DILU_KERNELS_DEFINE
+
+} // namespace Opm::detail
@@ -0,0 +1,125 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_DILU_KERNELS_HEADER_INCLUDED
+#define OPM_DILU_KERNELS_HEADER_INCLUDED
+
+#include <opm/simulators/linalg/matrixblock.hh>
+
+#include <dune/common/fmatrix.hh>
+#include <dune/common/fvector.hh>
+#include <dune/istl/bcrsmatrix.hh>
+#include <dune/istl/bvector.hh>
+
+#include <vector>
+
+namespace Opm::detail
+{
+
+/// \file
+/// \brief Triangular solve kernels for the serial DILU apply.
+///
+/// The sweeps are kept out of MultithreadDILU so that the block
+/// size/scalar combinations used by the flow binaries can be compiled
+/// as concrete, function-multiversioned overloads (see DILUKernels.cpp
+/// and TargetClones.hpp). Overload resolution prefers those over the
+/// generic templates below, which remain the fallback for any other
+/// matrix types (e.g. the plain FieldMatrix blocks used in unit tests).
+
+//! \brief Lower triangular solve (D + L_A) y = d of the DILU apply.
+//!
+//! On return v holds y. \see MultithreadDILU::serialApply for the
+//! derivation of the sweep.
+template <class M, class X, class Y>
+void diluSerialLowerSolve(const M& A,
+                          const std::vector<typename M::block_type>& Dinv,
+                          X& v,
+                          const Y& d)
+{
+    const auto endi = A.end();
+    for (auto row = A.begin(); row != endi; ++row) {
+        const auto row_i = row.index();
+        typename Y::block_type rhs = d[row_i];
+        for (auto a_ij = (*row).begin(); a_ij.index() < row_i; ++a_ij) {
+            // if  A[i][j] != 0
+            // rhs -= A[i][j]* y[j], where v_j stores y_j
+            const auto col_j = a_ij.index();
+            a_ij->mmv(v[col_j], rhs);
+        }
+        // y_i = Dinv_i * rhs
+        // storing y_i in v_i
+        Dinv[row_i].mv(rhs, v[row_i]); // (D + L_A)_ii = D_i
+    }
+}
+
+//! \brief Upper triangular solve (D + U_A) v = Dy of the DILU apply.
+//!
+//! On entry v holds y from the lower solve; on return it holds the
+//! update v = M^-1 d.
+template <class M, class X>
+void diluSerialUpperSolve(const M& A,
+                          const std::vector<typename M::block_type>& Dinv,
+                          X& v)
+{
+    const auto rendi = A.beforeBegin();
+    for (auto row = A.beforeEnd(); row != rendi; --row) {
+        const auto row_i = row.index();
+        // rhs = 0
+        typename X::block_type rhs(0.0);
+        for (auto a_ij = (*row).beforeEnd(); a_ij.index() > row_i; --a_ij) {
+            // if A[i][j] != 0
+            // rhs += A[i][j]*v[j]
+            const auto col_j = a_ij.index();
+            a_ij->umv(v[col_j], rhs);
+        }
+        // v_i = y_i - Dinv_i*rhs
+        // before update v_i is y_i
+        Dinv[row_i].mmv(rhs, v[row_i]);
+    }
+}
+
+// Concrete, function-multiversioned overloads for the matrix and vector
+// types used by the flow binaries (cf. the FlexibleSolver instantiations).
+#define OPM_DILU_KERNELS_DECLARE(T, N)                                                   \
+    void diluSerialLowerSolve(const Dune::BCRSMatrix<MatrixBlock<T, N, N>>& A,           \
+                              const std::vector<MatrixBlock<T, N, N>>& Dinv,             \
+                              Dune::BlockVector<Dune::FieldVector<T, N>>& v,             \
+                              const Dune::BlockVector<Dune::FieldVector<T, N>>& d);      \
+    void diluSerialUpperSolve(const Dune::BCRSMatrix<MatrixBlock<T, N, N>>& A,           \
+                              const std::vector<MatrixBlock<T, N, N>>& Dinv,             \
+                              Dune::BlockVector<Dune::FieldVector<T, N>>& v);
+
+OPM_DILU_KERNELS_DECLARE(double, 1)
+OPM_DILU_KERNELS_DECLARE(double, 2)
+OPM_DILU_KERNELS_DECLARE(double, 3)
+OPM_DILU_KERNELS_DECLARE(double, 4)
+OPM_DILU_KERNELS_DECLARE(double, 5)
+OPM_DILU_KERNELS_DECLARE(double, 6)
+
+OPM_DILU_KERNELS_DECLARE(float, 1)
+OPM_DILU_KERNELS_DECLARE(float, 2)
+OPM_DILU_KERNELS_DECLARE(float, 3)
+OPM_DILU_KERNELS_DECLARE(float, 4)
+OPM_DILU_KERNELS_DECLARE(float, 5)
+OPM_DILU_KERNELS_DECLARE(float, 6)
+
+#undef OPM_DILU_KERNELS_DECLARE
+
+} // namespace Opm::detail
+
+#endif // OPM_DILU_KERNELS_HEADER_INCLUDED
@@ -23,18 +23,48 @@
 #define OPM_FLEXIBLE_SOLVER_HEADER_INCLUDED
 
 #include <opm/simulators/linalg/PreconditionerWithUpdate.hpp>
+#include <opm/simulators/linalg/PropertyTree.hpp>
 
 #include <dune/istl/solver.hh>
 #include <dune/istl/paamg/pinfo.hh>
 
-namespace Opm
-{
-class PropertyTree;
-}
+#include <string>
 
 namespace Dune
 {
 
+/// Solver-level configuration compiled from a PropertyTree.
+///
+/// Compiling the configuration once at setup lets repeated solver
+/// creations (e.g. once per Newton iteration and subdomain when the
+/// preconditioner hierarchy must be rebuilt) skip the string-keyed
+/// property lookups and the copy of the preconditioner subtree.
+struct FlexibleSolverDescriptor
+{
+    double tol = 1e-2;
+    int maxiter = 200;
+    int verbosity = 0;
+    int restart = 15;
+    std::string solver_type = "bicgstab";
+    std::string precond_type = "error"; // only examined by mixed-bicgstab
+    Opm::PropertyTree precond_prm{};    // subtree handed to the PreconditionerFactory
+
+    static FlexibleSolverDescriptor compile(const Opm::PropertyTree& prm)
+    {
+        FlexibleSolverDescriptor descr;
+        descr.tol = prm.get<double>("tol", descr.tol);
+        descr.maxiter = prm.get<int>("maxiter", descr.maxiter);
+        descr.verbosity = prm.get<int>("verbosity", descr.verbosity);
+        descr.restart = prm.get<int>("restart", descr.restart);
+        descr.solver_type = prm.get<std::string>("solver", descr.solver_type);
+        descr.precond_type = prm.get<std::string>("preconditioner.type", descr.precond_type);
+        if (auto child = prm.get_child_optional("preconditioner")) {
+            descr.precond_prm = *child;
+        }
+        return descr;
+    }
+};
+
 /// A solver class that encapsulates all needed objects for a linear solver
 /// (operator, scalar product, iterative solver and preconditioner) and sets
 /// them up based on runtime parameters, using the PreconditionerFactory for
@@ -63,6 +93,20 @@ public:
                    const std::function<VectorType()>& weightsCalculator,
                    std::size_t pressureIndex);
 
+    /// Create a sequential solver from a pre-compiled configuration.
+    FlexibleSolver(Operator& op,
+                   const FlexibleSolverDescriptor& descr,
+                   const std::function<VectorType()>& weightsCalculator,
+                   std::size_t pressureIndex);
+
+    /// Create a parallel solver from a pre-compiled configuration.
+    template <class Comm>
+    FlexibleSolver(Operator& op,
+                   const Comm& comm,
+                   const FlexibleSolverDescriptor& descr,
+                   const std::function<VectorType()>& weightsCalculator,
+                   std::size_t pressureIndex);
+
     virtual void apply(VectorType& x, VectorType& rhs, Dune::InverseOperatorResult& res) override;
 
     virtual void apply(VectorType& x, VectorType& rhs, double reduction, Dune::InverseOperatorResult& res) override;
@@ -78,16 +122,16 @@ private:
 
     // Machinery for making sequential or parallel operators/preconditioners/scalar products.
     template <class Comm>
-    void initOpPrecSp(Operator& op, const Opm::PropertyTree& prm,
+    void initOpPrecSp(Operator& op, const FlexibleSolverDescriptor& descr,
                       const std::function<VectorType()> weightsCalculator, const Comm& comm,
                       std::size_t pressureIndex);
 
-    void initOpPrecSp(Operator& op, const Opm::PropertyTree& prm,
+    void initOpPrecSp(Operator& op, const FlexibleSolverDescriptor& descr,
                       const std::function<VectorType()> weightsCalculator, const Dune::Amg::SequentialInformation&,
                       std::size_t pressureIndex);
 
     template <class Comm>
-    void initSolver(const Opm::PropertyTree& prm, const Comm& comm);
+    void initSolver(const FlexibleSolverDescriptor& descr, const Comm& comm);
 
     void recreateDirectSolver();
 
@@ -96,7 +140,7 @@ private:
     template <class Comm>
     void init(Operator& op,
               const Comm& comm,
-              const Opm::PropertyTree& prm,
+              const FlexibleSolverDescriptor& descr,
               const std::function<VectorType()> weightsCalculator,
               std::size_t pressureIndex);
 
@@ -62,7 +62,8 @@ namespace Dune
                    const std::function<VectorType()>& weightsCalculator,
                    std::size_t pressureIndex)
     {
-        init(op, Dune::Amg::SequentialInformation(), prm, weightsCalculator,
+        init(op, Dune::Amg::SequentialInformation(),
+             FlexibleSolverDescriptor::compile(prm), weightsCalculator,
              pressureIndex);
     }
 
@@ -76,7 +77,33 @@ namespace Dune
                    const std::function<VectorType()>& weightsCalculator,
                    std::size_t pressureIndex)
     {
-        init(op, comm, prm, weightsCalculator, pressureIndex);
+        init(op, comm, FlexibleSolverDescriptor::compile(prm),
+             weightsCalculator, pressureIndex);
+    }
+
+    /// Create a sequential solver from a pre-compiled configuration.
+    template <class Operator>
+    FlexibleSolver<Operator>::
+    FlexibleSolver(Operator& op,
+                   const FlexibleSolverDescriptor& descr,
+                   const std::function<VectorType()>& weightsCalculator,
+                   std::size_t pressureIndex)
+    {
+        init(op, Dune::Amg::SequentialInformation(), descr, weightsCalculator,
+             pressureIndex);
+    }
+
+    /// Create a parallel solver from a pre-compiled configuration.
+    template <class Operator>
+    template <class Comm>
+    FlexibleSolver<Operator>::
+    FlexibleSolver(Operator& op,
+                   const Comm& comm,
+                   const FlexibleSolverDescriptor& descr,
+                   const std::function<VectorType()>& weightsCalculator,
+                   std::size_t pressureIndex)
+    {
+        init(op, comm, descr, weightsCalculator, pressureIndex);
     }
 
     template <class Operator>
@@ -124,16 +151,15 @@ namespace Dune
     void
     FlexibleSolver<Operator>::
     initOpPrecSp(Operator& op,
-                 const Opm::PropertyTree& prm,
+                 const FlexibleSolverDescriptor& descr,
                  const std::function<VectorType()> weightsCalculator,
                  const Comm& comm,
                  std::size_t pressureIndex)
     {
         // Parallel case.
         linearoperator_for_solver_ = &op;
-        auto child = prm.get_child_optional("preconditioner");
         preconditioner_ = Opm::PreconditionerFactory<Operator, Comm>::create(op,
-                                                                             child ? *child : Opm::PropertyTree(),
+                                                                             descr.precond_prm,
                                                                              weightsCalculator,
                                                                              comm,
                                                                              pressureIndex);
@@ -144,16 +170,15 @@ namespace Dune
     void
     FlexibleSolver<Operator>::
     initOpPrecSp(Operator& op,
-                 const Opm::PropertyTree& prm,
+                 const FlexibleSolverDescriptor& descr,
                  const std::function<VectorType()> weightsCalculator,
                  const Dune::Amg::SequentialInformation&,
                  std::size_t pressureIndex)
     {
         // Sequential case.
         linearoperator_for_solver_ = &op;
-        auto child = prm.get_child_optional("preconditioner");
         preconditioner_ = Opm::PreconditionerFactory<Operator,Dune::Amg::SequentialInformation>::create(op,
-                                                                       child ? *child : Opm::PropertyTree(),
+                                                                       descr.precond_prm,
                                                                        weightsCalculator,
                                                                        pressureIndex);
         scalarproduct_ = std::make_shared<Dune::SeqScalarProduct<VectorType>>();
@@ -164,13 +189,13 @@ namespace Dune
     template <class Comm>
     void
     FlexibleSolver<Operator>::
-    initSolver(const Opm::PropertyTree& prm, const Comm& comm)
+    initSolver(const FlexibleSolverDescriptor& descr, const Comm& comm)
     {
         const bool is_iorank = comm.communicator().rank() == 0;
-        const double tol = prm.get<double>("tol", 1e-2);
-        const int maxiter = prm.get<int>("maxiter", 200);
-        const int verbosity = is_iorank ? prm.get<int>("verbosity", 0) : 0;
-        const std::string solver_type = prm.get<std::string>("solver", "bicgstab");
+        const double tol = descr.tol;
+        const int maxiter = descr.maxiter;
+        const int verbosity = is_iorank ? descr.verbosity : 0;
+        const std::string& solver_type = descr.solver_type;
 
 
         // make sure it is nullptr at the start (used for error checking in the end).
@@ -192,8 +217,7 @@ namespace Dune
             } else if constexpr (std::is_same_v<typename VectorType::field_type, float>){
                 OPM_THROW(std::invalid_argument, "mixed-bicgstab solver not supported for single precision.");
             } else {
-                const std::string prec_type = prm.get<std::string>("preconditioner.type", "error");
-                bool use_mixed_dilu= (prec_type=="mixed-dilu");
+                bool use_mixed_dilu = (descr.precond_type == "mixed-dilu");
                 using MatrixType = decltype(linearoperator_for_solver_->getmat());
                 linsolver_ = std::make_shared<Dune::MixedSolver<VectorType,MatrixType>>(
                                                                             linearoperator_for_solver_->getmat(),
@@ -211,7 +235,7 @@ namespace Dune
                                                                         maxiter, // maximum number of iterations
                                                                         verbosity);
         } else if (solver_type == "gmres") {
-            int restart = prm.get<int>("restart", 15);
+            int restart = descr.restart;
             linsolver_ = std::make_shared<Dune::RestartedGMResSolver<VectorType>>(*linearoperator_for_solver_,
                                                                                   *scalarproduct_,
                                                                                   *preconditioner_,
@@ -222,7 +246,7 @@ namespace Dune
         } else {
             if constexpr (!Opm::is_gpu_operator_v<Operator>) {
                 if (solver_type == "flexgmres") {
-                    int restart = prm.get<int>("restart", 15);
+                    int restart = descr.restart;
                     linsolver_ = std::make_shared<Dune::RestartedFlexibleGMResSolver<VectorType>>(*linearoperator_for_solver_,
                                                                                             *scalarproduct_,
                                                                                             *preconditioner_,
@@ -294,12 +318,12 @@ namespace Dune
     FlexibleSolver<Operator>::
     init(Operator& op,
          const Comm& comm,
-         const Opm::PropertyTree& prm,
+         const FlexibleSolverDescriptor& descr,
          const std::function<VectorType()> weightsCalculator,
          std::size_t pressureIndex)
     {
-        initOpPrecSp(op, prm, weightsCalculator, comm, pressureIndex);
-        initSolver(prm, comm);
+        initOpPrecSp(op, descr, weightsCalculator, comm, pressureIndex);
+        initSolver(descr, comm);
     }
 
 } // namespace Dune
@@ -341,6 +365,12 @@ using ParOpD = Dune::OverlappingSchwarzOperator<OBM<Scalar,N>, BV<Scalar,N>, BV<
                        const Comm& comm,                                                            \
                        const Opm::PropertyTree& prm,                                                \
                        const std::function<typename __VA_ARGS__::domain_type()>& weightsCalculator, \
+                       std::size_t pressureIndex);                                                  \
+    template Dune::FlexibleSolver<__VA_ARGS__>::                                                    \
+        FlexibleSolver(__VA_ARGS__& op,                                                             \
+                       const Comm& comm,                                                            \
+                       const Dune::FlexibleSolverDescriptor& descr,                                 \
+                       const std::function<typename __VA_ARGS__::domain_type()>& weightsCalculator, \
                        std::size_t pressureIndex);
 
 #define INSTANTIATE_FLEXIBLESOLVER(T,N)         \
@@ -48,6 +48,7 @@ void FlowLinearSolverParameters::init(bool cprRequestedInDataFile)
     cpr_reuse_setup_  = Parameters::Get<Parameters::CprReuseSetup>();
     cpr_reuse_interval_  = Parameters::Get<Parameters::CprReuseInterval>();
     gpu_aware_mpi_ = Parameters::Get<Parameters::GpuAwareMpi>();
+    gpu_zero_initial_guess_ = Parameters::Get<Parameters::GpuZeroInitialGuess>();
 
     if (!Parameters::IsSet<Parameters::LinearSolver>() && cprRequestedInDataFile) {
         linsolver_ = "cpr";
@@ -151,7 +152,10 @@ void FlowLinearSolverParameters::registerParameters()
          "1: recreate once every timestep, "
          "2: recreate if last linear solve took more than 10 iterations, "
          "3: never recreate, "
-         "4: recreated every CprReuseInterval");
+         "4: recreated every CprReuseInterval, "
+         "5: keep a frozen hierarchy (only the finest level is re-smoothed) "
+         "until the iteration count degrades noticeably versus the best "
+         "solve seen with the current setup");
     Parameters::Register<Parameters::CprReuseInterval>
         ("Reuse preconditioner interval. Used when CprReuseSetup is set to 4, "
          "then the preconditioner will be fully recreated instead of reused "
@@ -181,6 +185,11 @@ void FlowLinearSolverParameters::registerParameters()
             "MPI implementation does not support GPU aware MPI. "
             "Note that the verification is not exhaustive, "
             "and some configurations might not be verified, but will work in practice");
+    Parameters::Register<Parameters::GpuZeroInitialGuess>
+        ("Assume a zero initial guess for GPU linear solves. The solution "
+            "vector then stays device resident between Newton iterations and "
+            "only the converged update is copied back to the host, instead of "
+            "uploading the CPU initial guess for every solve");
     Parameters::Register<Parameters::CprWeightsThreadParallel>
         ("Enable OpenMP thread parallelization of CPR weight calculation. "
             "This can improve performance for large models but is disabled by default");
@@ -215,6 +224,7 @@ void FlowLinearSolverParameters::reset()
     linear_solver_accelerator_ = Parameters::LinearSolverAcceleratorType::CPU;
     gpu_aware_mpi_              = false;
     verify_gpu_aware_mpi_       = false;
+    gpu_zero_initial_guess_     = false;
     cpr_weights_thread_parallel_ = false;
 }
 
@@ -87,6 +87,7 @@ struct GpuDeviceId { static constexpr int value = 0; };
 struct OpenclPlatformId { static constexpr int value = 0; };
 struct OpenclIluParallel { static constexpr bool value = true; }; // note: false should only be used in debug
 struct GpuAwareMpi { static constexpr bool value = false; };
+struct GpuZeroInitialGuess { static constexpr bool value = false; };
 struct VerifyGpuAwareMpi { static constexpr bool value = false; };
 struct CprWeightsThreadParallel { static constexpr bool value = false; };
 } // namespace Opm::Parameters
@@ -121,6 +122,7 @@ struct FlowLinearSolverParameters
     Parameters::LinearSolverAcceleratorType linear_solver_accelerator_;
     bool gpu_aware_mpi_;
     bool verify_gpu_aware_mpi_;
+    bool gpu_zero_initial_guess_;
     bool cpr_weights_thread_parallel_;
 
     FlowLinearSolverParameters() { reset(); }
@@ -305,6 +305,55 @@ getMatrixRowColoring(const M& matrix, ColoringType coloringType)
             colorCnt.data(), colorCnt.data() + colorCnt.size()};
 }
 
+/// Greedy distance-1 coloring of the matrix sparsity graph: every row gets
+/// the smallest color not used by any of its sparsity neighbours, so rows of
+/// the same color have no couplings between them and can be updated
+/// concurrently in a multicolor Gauss-Seidel sweep. For the bipartite graph
+/// of a structured stencil this produces the classical red-black splitting.
+/// \brief Given a matrix, returns a SparseTable grouping the rows into
+///        independent sets (colors), keeping matrix order within each color
+/// \param matrix A dune sparse matrix
+/// \return SparseTable with the rows of the matrix grouped by color
+template <class M>
+Opm::SparseTable<std::size_t>
+getMatrixIndependentSetColoring(const M& matrix)
+{
+    OPM_TIMEBLOCK(colorMatrix);
+
+    std::vector<int> color(matrix.N(), -1);
+    std::vector<bool> forbidden;
+    std::vector<std::size_t> colorCnt;
+    for (auto i = matrix.begin(); i != matrix.end(); ++i) {
+        std::fill(forbidden.begin(), forbidden.end(), false);
+        for (auto a_ij = i->begin(); a_ij != i->end(); ++a_ij) {
+            const auto neighbour_color = color[a_ij.index()];
+            if (neighbour_color >= 0) {
+                forbidden[neighbour_color] = true;
+            }
+        }
+        int my_color = 0;
+        while (my_color < static_cast<int>(colorCnt.size()) && forbidden[my_color]) {
+            ++my_color;
+        }
+        if (my_color == static_cast<int>(colorCnt.size())) {
+            colorCnt.push_back(0);
+            forbidden.push_back(false);
+        }
+        color[i.index()] = my_color;
+        ++colorCnt[my_color];
+    }
+
+    std::vector<std::size_t> rowIndices(matrix.N(), 0);
+    std::iota(rowIndices.begin(), rowIndices.end(), 0);
+    std::stable_sort(rowIndices.begin(),
+                     rowIndices.end(),
+                     [&color](const std::size_t a, const std::size_t b)
+                     { return color[a] < color[b]; });
+
+    return {rowIndices.data(), rowIndices.data() + rowIndices.size(),
+            colorCnt.data(), colorCnt.data() + colorCnt.size()};
+}
+
 } // end namespace Opm
 
 #endif
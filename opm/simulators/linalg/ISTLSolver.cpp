@@ -107,6 +107,14 @@ void FlexibleSolverInfo<Matrix,Vector,Comm>::create(const Matrix& matrix,
         }
     }
 
+    // Compile the solver configuration once; later re-creations of the
+    // solver (e.g. when the preconditioner must be rebuilt) then avoid
+    // the repeated string-keyed property lookups.
+    if (!this->descriptor_) {
+        this->descriptor_ = Dune::FlexibleSolverDescriptor::compile(prm);
+    }
+    const auto& descr = *this->descriptor_;
+
     // Delete the operator and solver here to avoid
     // a large temporary memory peak from having two
     // operators and solvers at the same time.
@@ -119,7 +127,7 @@ void FlexibleSolverInfo<Matrix,Vector,Comm>::create(const Matrix& matrix,
             using ParOperatorType = Opm::GhostLastMatrixAdapter<Matrix, Vector, Vector, Comm>;
             auto pop = std::make_unique<ParOperatorType>(matrix, *comm);
             using FlexibleSolverType = Dune::FlexibleSolver<ParOperatorType>;
-            auto sol = std::make_unique<FlexibleSolverType>(*pop, *comm, prm,
+            auto sol = std::make_unique<FlexibleSolverType>(*pop, *comm, descr,
                                                             weightsCalculator,
                                                             pressureIndex);
             this->pre_ = &sol->preconditioner();
@@ -130,7 +138,7 @@ void FlexibleSolverInfo<Matrix,Vector,Comm>::create(const Matrix& matrix,
             auto pop = std::make_unique<ParOperatorType>(matrix, *wellOperator_,
                                                          interiorCellNum_);
             using FlexibleSolverType = Dune::FlexibleSolver<ParOperatorType>;
-            auto sol = std::make_unique<FlexibleSolverType>(*pop, *comm, prm,
+            auto sol = std::make_unique<FlexibleSolverType>(*pop, *comm, descr,
                                                             weightsCalculator,
                                                             pressureIndex);
             this->pre_ = &sol->preconditioner();
@@ -143,7 +151,7 @@ void FlexibleSolverInfo<Matrix,Vector,Comm>::create(const Matrix& matrix,
             using SeqOperatorType = Dune::MatrixAdapter<Matrix, Vector, Vector>;
             auto sop = std::make_unique<SeqOperatorType>(matrix);
             using FlexibleSolverType = Dune::FlexibleSolver<SeqOperatorType>;
-            auto sol = std::make_unique<FlexibleSolverType>(*sop, prm,
+            auto sol = std::make_unique<FlexibleSolverType>(*sop, descr,
                                                             weightsCalculator,
                                                             pressureIndex);
             this->pre_ = &sol->preconditioner();
@@ -153,7 +161,7 @@ void FlexibleSolverInfo<Matrix,Vector,Comm>::create(const Matrix& matrix,
             using SeqOperatorType = WellModelMatrixAdapter<Matrix, Vector, Vector>;
             auto sop = std::make_unique<SeqOperatorType>(matrix, *wellOperator_);
             using FlexibleSolverType = Dune::FlexibleSolver<SeqOperatorType>;
-            auto sol = std::make_unique<FlexibleSolverType>(*sop, prm,
+            auto sol = std::make_unique<FlexibleSolverType>(*sop, descr,
                                                             weightsCalculator,
                                                             pressureIndex);
             this->pre_ = &sol->preconditioner();
@@ -40,6 +40,7 @@
 #include <opm/simulators/flow/FlowBaseVanguard.hpp>
 #include <opm/simulators/flow/FlowBaseProblemProperties.hpp>
 #include <opm/simulators/linalg/ExtractParallelGridInformationToISTL.hpp>
+#include <opm/simulators/linalg/FlexibleSolver.hpp>
 #include <opm/simulators/linalg/FlowLinearSolverParameters.hpp>
 #include <opm/simulators/linalg/matrixblock.hh>
 #include <opm/simulators/linalg/istlsparsematrixadapter.hh>
@@ -52,10 +53,12 @@
 #include <opm/simulators/linalg/AbstractISTLSolver.hpp>
 #include <opm/simulators/linalg/printlinearsolverparameter.hpp>
 
+#include <algorithm>
 #include <any>
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <set>
 #include <sstream>
 #include <string>
@@ -116,6 +119,8 @@ struct FlexibleSolverInfo
     std::unique_ptr<LinearOperatorExtra<Vector,Vector>> wellOperator_;
     AbstractPreconditionerType* pre_ = nullptr;
     std::size_t interiorCellNum_ = 0;
+    // Compiled solver configuration, reused when the solver is recreated.
+    std::optional<Dune::FlexibleSolverDescriptor> descriptor_{};
 };
 
 
@@ -317,6 +322,32 @@ std::unique_ptr<Matrix> blockJacobiAdjacency(const Grid& grid,
         {
         }
 
+        void releaseSolverHierarchy() override
+        {
+            for (auto& f : flexibleSolver_) {
+                // shouldCreateSolver() sees the missing solver and rebuilds
+                // the hierarchy on the next prepare().
+                f.solver_.reset();
+                f.op_.reset();
+                f.wellOperator_.reset();
+                f.pre_ = nullptr;
+            }
+        }
+
+        std::size_t solverHierarchyBytes() const override
+        {
+            // Rough estimate: an ILU-type preconditioner keeps one
+            // factorized copy of the matrix, and AMG coarse levels add a
+            // comparable amount on top of that.
+            std::size_t bytes = 0;
+            for (const auto& f : flexibleSolver_) {
+                if (f.solver_ && matrix_ != nullptr) {
+                    bytes += matrix_->nonzeroes() * sizeof(typename Matrix::block_type);
+                }
+            }
+            return bytes;
+        }
+
         void setActiveSolver(const int num) override
         {
             if (num > static_cast<int>(prm_.size()) - 1) {
@@ -428,6 +459,12 @@ std::unique_ptr<Matrix> blockJacobiAdjacency(const Grid& grid,
 
             iterations_ = result.iterations;
 
+            // Track the best performance of the current preconditioner setup;
+            // used by the staleness criterion of --cpr-reuse-setup=5.
+            if (bestIterationsSinceCreate_ < 0 || iterations_ < bestIterationsSinceCreate_) {
+                bestIterationsSinceCreate_ = iterations_;
+            }
+
             // Check convergence, iterations etc.
             return checkConvergence(result);
         }
@@ -499,11 +536,19 @@ std::unique_ptr<Matrix> blockJacobiAdjacency(const Grid& grid,
                                                          weightCalculator,
                                                          forceSerial_,
                                                          comm_.get());
+                bestIterationsSinceCreate_ = -1;
             }
             else
             {
                 OPM_TIMEBLOCK(flexibleSolverUpdate);
-                flexibleSolver_[activeSolverNum_].pre_->update();
+                if (this->parameters_[activeSolverNum_].cpr_reuse_setup_ == 5) {
+                    // Frozen hierarchy mode: only refresh the parts that are
+                    // cheap to update (e.g. the finest-level smoother).
+                    flexibleSolver_[activeSolverNum_].pre_->partialUpdate();
+                }
+                else {
+                    flexibleSolver_[activeSolverNum_].pre_->update();
+                }
             }
         }
 
@@ -549,6 +594,17 @@ std::unique_ptr<Matrix> blockJacobiAdjacency(const Grid& grid,
                 const bool create = ((solveCount_ % step) == 0);
                 return create;
             }
+            if (this->parameters_[activeSolverNum_].cpr_reuse_setup_ == 5) {
+                // Frozen hierarchy: keep the setup across Newton iterations
+                // and report steps, rebuilding only when it has become stale,
+                // i.e. the last solve needed significantly more iterations
+                // than the best solve seen with the current setup.
+                if (bestIterationsSinceCreate_ < 0) {
+                    // No solve has been performed with the current setup yet.
+                    return false;
+                }
+                return this->iterations() > std::max(10, 2 * bestIterationsSinceCreate_);
+            }
             // If here, we have an invalid parameter.
             const bool on_io_rank = (simulator_.gridView().comm().rank() == 0);
             std::string msg = "Invalid value: " + std::to_string(this->parameters_[activeSolverNum_].cpr_reuse_setup_)
@@ -645,6 +701,9 @@ std::unique_ptr<Matrix> blockJacobiAdjacency(const Grid& grid,
         const Simulator& simulator_;
         mutable int iterations_;
         mutable int solveCount_;
+        // fewest iterations any solve needed with the current
+        // preconditioner setup; -1 if no solve was done yet
+        mutable int bestIterationsSinceCreate_ = -1;
         std::any parallelInformation_;
 
         // non-const to be able to scale the linear system
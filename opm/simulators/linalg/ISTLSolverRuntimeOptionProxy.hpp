@@ -142,6 +142,16 @@ public:
         return istlSolver_->getSolveCount();
     }
 
+    void releaseSolverHierarchy() override
+    {
+        istlSolver_->releaseSolverHierarchy();
+    }
+
+    std::size_t solverHierarchyBytes() const override
+    {
+        return istlSolver_->solverHierarchyBytes();
+    }
+
 private:
     std::unique_ptr<AbstractISTLSolver<TypeTag>> istlSolver_;
 
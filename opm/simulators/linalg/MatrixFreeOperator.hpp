@@ -0,0 +1,140 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_MATRIXFREEOPERATOR_HEADER_INCLUDED
+#define OPM_MATRIXFREEOPERATOR_HEADER_INCLUDED
+
+#include <dune/istl/operators.hh>
+#include <dune/istl/solvercategory.hh>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/TimingMacros.hpp>
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+namespace Opm {
+
+/// Matrix-free linear operator for the outermost Krylov loop.
+///
+/// Approximates Jacobian-vector products with a first-order directional
+/// difference of the nonlinear residual,
+///
+///    J(u) v ~= (R(u + h v) - R(u)) / h,
+///
+/// so the Krylov solver never touches an assembled Jacobian.  The owner
+/// supplies a residual evaluator that computes R(u + dx) for a given
+/// increment dx; with the TPFA linearizer this is the residual-only
+/// linearization path, which skips all Jacobian storage and updates.
+/// The residual at the current iterate, R(u), is evaluated once per
+/// Newton iteration and cached through setBaseResidual().
+///
+/// The difference increment follows the usual Jacobian-free
+/// Newton-Krylov scaling, h = sqrt(machine epsilon) * (1 + |u|) / |v|,
+/// where the solution magnitude |u| is provided by the owner since the
+/// operator never sees the solution itself.
+///
+/// Each apply() costs one residual evaluation instead of an SpMV; the
+/// trade is flops for the memory of the assembled system.  Note that the
+/// preconditioners in the flexible solver framework are all built from
+/// an assembled matrix, so a fully matrix-free solve still needs an
+/// assembled (possibly lower precision) copy on the preconditioner side.
+template <class X, class Y = X>
+class MatrixFreeJacobianOperator : public Dune::LinearOperator<X, Y>
+{
+public:
+    using domain_type = X;
+    using range_type = Y;
+    using field_type = typename X::field_type;
+
+    //! Evaluates the residual at the current iterate plus the given
+    //! increment: out = R(u + dx).  Must not change the iterate as seen
+    //! by later calls.
+    using ResidualEvaluator = std::function<void(const X& dx, Y& out)>;
+
+    //! \param evaluator  residual evaluation callback
+    //! \param solutionNorm  magnitude |u| of the current iterate, used
+    //!                      to scale the difference increment
+    MatrixFreeJacobianOperator(ResidualEvaluator evaluator,
+                               const field_type solutionNorm)
+        : evaluator_(std::move(evaluator))
+        , solutionNorm_(solutionNorm)
+    {}
+
+    //! Cache the residual at the current iterate.  Must be called
+    //! whenever the iterate changes, before the first apply().
+    void setBaseResidual(const Y& residual)
+    {
+        baseResidual_ = residual;
+        haveBaseResidual_ = true;
+    }
+
+    void apply(const X& x, Y& y) const override
+    {
+        OPM_TIMEBLOCK(apply);
+
+        if (!haveBaseResidual_) {
+            OPM_THROW(std::logic_error,
+                      "MatrixFreeJacobianOperator: apply() called before setBaseResidual()");
+        }
+
+        const field_type xNorm = x.two_norm();
+        if (!(xNorm > 0.0)) {
+            y = 0.0;
+            return;
+        }
+
+        const field_type h = std::sqrt(std::numeric_limits<field_type>::epsilon())
+            * (1.0 + solutionNorm_) / xNorm;
+
+        X dx(x);
+        dx *= h;
+
+        evaluator_(dx, y);
+
+        y -= baseResidual_;
+        y /= h;
+    }
+
+    void applyscaleadd(field_type alpha, const X& x, Y& y) const override
+    {
+        OPM_TIMEBLOCK(applyscaleadd);
+
+        Y temp(y);
+        apply(x, temp);
+        y.axpy(alpha, temp);
+    }
+
+    Dune::SolverCategory::Category category() const override
+    {
+        return Dune::SolverCategory::sequential;
+    }
+
+private:
+    ResidualEvaluator evaluator_;
+    field_type solutionNorm_;
+    Y baseResidual_{};
+    bool haveBaseResidual_ = false;
+};
+
+} // namespace Opm
+
+#endif // OPM_MATRIXFREEOPERATOR_HEADER_INCLUDED
@@ -0,0 +1,172 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_MULTICOLOR_GAUSS_SEIDEL_HEADER_INCLUDED
+#define OPM_MULTICOLOR_GAUSS_SEIDEL_HEADER_INCLUDED
+
+#include <opm/common/TimingMacros.hpp>
+#include <opm/simulators/linalg/GraphColoring.hpp>
+#include <opm/simulators/linalg/PreconditionerWithUpdate.hpp>
+
+#include <dune/common/unused.hh>
+#include <dune/istl/bcrsmatrix.hh>
+
+#include <cstddef>
+#include <vector>
+
+namespace Dune
+{
+
+/*! \brief Multicolor (red-black) Gauss-Seidel preconditioner.
+ *  \details Rows are grouped into independent sets by a greedy distance-1
+ *           coloring of the sparsity graph, so all rows of one color can be
+ *           updated concurrently with OpenMP. For the two-color case of a
+ *           structured stencil this is the classical red-black ordering.
+ *           Each sweep fuses the residual computation with the update
+ *           v_i += w * D_ii^{-1} * (d_i - (A v)_i), reading every matrix
+ *           row exactly once, which makes a sweep cheaper on bandwidth
+ *           bound systems than a triangular ILU solve.
+ *           Safe to run serially without OpenMP.
+
+   \tparam M The matrix type to operate on
+   \tparam X Type of the update
+   \tparam Y Type of the defect
+*/
+template <class M, class X, class Y>
+class MulticolorGaussSeidel : public PreconditionerWithUpdate<X, Y>
+{
+public:
+    //! \brief The matrix type the preconditioner is for.
+    using matrix_type = M;
+    //! \brief The domain type of the preconditioner.
+    using domain_type = X;
+    //! \brief The range type of the preconditioner.
+    using range_type = Y;
+    //! \brief The field type of the preconditioner.
+    using field_type = typename X::field_type;
+
+    /*! \brief Constructor gets all parameters to operate the prec.
+       \param A The matrix to operate on.
+       \param sweeps The number of Gauss-Seidel sweeps per application.
+       \param relaxation The relaxation factor.
+    */
+    MulticolorGaussSeidel(const M& A, const int sweeps, const field_type relaxation)
+        : A_(A)
+        , sweeps_(sweeps)
+        , relaxation_(relaxation)
+    {
+        OPM_TIMEBLOCK(prec_construct);
+        color_sets_ = Opm::getMatrixIndependentSetColoring(A_);
+        Dinv_.resize(A_.N());
+        update();
+    }
+
+    /*!
+       \brief Update the preconditioner.
+       \copydoc Preconditioner::update()
+    */
+    void update() override
+    {
+        OPM_TIMEBLOCK(prec_update);
+        // The coloring only depends on the sparsity pattern, so an update
+        // just refreshes the inverted diagonal blocks.
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (std::size_t row = 0; row < A_.N(); ++row) {
+            Dinv_[row] = A_[row][row];
+            Dinv_[row].invert();
+        }
+    }
+
+    /*!
+       \brief Prepare the preconditioner.
+       \copydoc Preconditioner::pre(X&,Y&)
+    */
+    void pre(X& v, Y& d) override
+    {
+        DUNE_UNUSED_PARAMETER(v);
+        DUNE_UNUSED_PARAMETER(d);
+    }
+
+    /*!
+       \brief Apply the preconditioner.
+       \copydoc Preconditioner::apply(X&,const Y&)
+    */
+    void apply(X& v, const Y& d) override
+    {
+        OPM_TIMEBLOCK(prec_apply);
+        using Yblock = typename Y::block_type;
+        for (int sweep = 0; sweep < sweeps_; ++sweep) {
+            for (int color = 0; color < color_sets_.size(); ++color) {
+                const auto& rows = color_sets_[color];
+                const int num_rows_in_color = rows.size();
+                // Rows of the same color have no couplings between them,
+                // so the update below only reads v entries of other colors.
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                for (int idx = 0; idx < num_rows_in_color; ++idx) {
+                    const auto row_i = rows[idx];
+                    const auto row = A_.begin() + row_i;
+                    // fused residual: rhs = d_i - (A v)_i
+                    Yblock rhs = d[row_i];
+                    for (auto a_ij = row->begin(); a_ij != row->end(); ++a_ij) {
+                        a_ij->mmv(v[a_ij.index()], rhs);
+                    }
+                    // v_i += w * Dinv_i * rhs
+                    Dinv_[row_i].usmv(relaxation_, rhs, v[row_i]);
+                }
+            }
+        }
+    }
+
+    /*!
+       \brief Clean up.
+       \copydoc Preconditioner::post(X&)
+    */
+    void post(X& x) override
+    {
+        DUNE_UNUSED_PARAMETER(x);
+    }
+
+    //! Category of the preconditioner (see SolverCategory::Category)
+    virtual SolverCategory::Category category() const override
+    {
+        return SolverCategory::sequential;
+    }
+
+    virtual bool hasPerfectUpdate() const override
+    {
+        return true;
+    }
+
+private:
+    //! \brief The matrix we operate on.
+    const M& A_;
+    //! \brief The inverses of the diagonal blocks.
+    std::vector<typename M::block_type> Dinv_;
+    //! \brief SparseTable storing the rows of each color (independent set).
+    Opm::SparseTable<std::size_t> color_sets_;
+    //! \brief The number of Gauss-Seidel sweeps per application.
+    int sweeps_;
+    //! \brief The relaxation factor.
+    field_type relaxation_;
+};
+
+} // namespace Dune
+
+#endif
@@ -71,10 +71,18 @@ std::ostream& operator<<(std::ostream& out,
 /// - Self-contained, because it owns its policy components.
 /// - Flexible, because it uses the runtime-flexible solver
 ///   and preconditioner factory.
+///
+/// By default the fine smoother is created through the preconditioner
+/// factory and applied through the type-erased PreconditionerWithUpdate
+/// interface. For the common fixed chains the Smoother parameter can
+/// instead name the concrete smoother type, which instantiates the
+/// two-level method directly against it so that every smoother
+/// application is a direct call instead of a virtual dispatch.
 template <class OperatorType,
           class VectorType,
           class LevelTransferPolicy,
-          class Communication = Dune::Amg::SequentialInformation>
+          class Communication = Dune::Amg::SequentialInformation,
+          class Smoother = Dune::PreconditionerWithUpdate<VectorType, VectorType>>
 class OwningTwoLevelPreconditioner : public Dune::PreconditionerWithUpdate<VectorType, VectorType>
 {
 public:
@@ -115,6 +123,40 @@ public:
         }
     }
 
+    /// Constructor taking a ready-made fine smoother. This is the entry
+    /// point for the devirtualized chains, where the caller constructs the
+    /// concrete smoother matching the configuration itself.
+    OwningTwoLevelPreconditioner(const OperatorType& linearoperator, const Opm::PropertyTree& prm,
+                                 const std::function<VectorType()> weightsCalculator,
+                                 std::size_t pressureIndex,
+                                 std::shared_ptr<Smoother> finesmoother)
+        : linear_operator_(linearoperator)
+        , finesmoother_(std::move(finesmoother))
+        , comm_(nullptr)
+        , weightsCalculator_(weightsCalculator)
+        , weights_(weightsCalculator())
+        , levelTransferPolicy_(dummy_comm_, weights_, prm, pressureIndex)
+        , coarseSolverPolicy_(prm.get_child_optional("coarsesolver") ? prm.get_child("coarsesolver") : Opm::PropertyTree())
+        , twolevel_method_(linearoperator,
+                           finesmoother_,
+                           levelTransferPolicy_,
+                           coarseSolverPolicy_,
+                           prm.get<int>("pre_smooth", 0),
+                           prm.get<int>("post_smooth", 1))
+        , prm_(prm)
+    {
+        if (prm.get<int>("verbosity", 0) > 10) {
+            std::string filename = prm.get<std::string>("weights_filename", "impes_weights.txt");
+            std::ofstream outfile(filename);
+            if (!outfile) {
+                OPM_THROW(std::ofstream::failure,
+                          "Could not write weights to file " + filename + ".");
+            }
+            // Unqualified on purpose to enable ADL for GPU/CPU types
+            writeMatrixMarket(weights_, outfile);
+        }
+    }
+
     OwningTwoLevelPreconditioner(const OperatorType& linearoperator, const Opm::PropertyTree& prm,
                                  const std::function<VectorType()> weightsCalculator,
                                  std::size_t pressureIndex, const Communication& comm)
@@ -170,6 +212,14 @@ public:
         updateImpl(comm_);
     }
 
+    virtual void partialUpdate() override
+    {
+        // Re-smooth only the finest level and keep the coarse hierarchy
+        // (including the transfer operator weights it was built with)
+        // frozen.
+        twolevel_method_.updateSmootherOnly(finesmoother_);
+    }
+
     virtual Dune::SolverCategory::Category category() const override
     {
         return linear_operator_.category();
@@ -185,7 +235,7 @@ private:
                                                                FlexibleSolver<CoarseOperator>,
                                                                LevelTransferPolicy>;
     using TwoLevelMethod
-        = Dune::Amg::TwoLevelMethodCpr<OperatorType, CoarseSolverPolicy, Dune::PreconditionerWithUpdate<VectorType, VectorType>>;
+        = Dune::Amg::TwoLevelMethodCpr<OperatorType, CoarseSolverPolicy, Smoother>;
 
     // Handling parallel vs serial instantiation of preconditioner factory.
     template <class Comm>
@@ -202,7 +252,7 @@ private:
     }
 
     const OperatorType& linear_operator_;
-    std::shared_ptr<PreconditionerWithUpdate<VectorType, VectorType>> finesmoother_;
+    std::shared_ptr<Smoother> finesmoother_;
     const Communication* comm_;
     std::function<VectorType()> weightsCalculator_;
     VectorType weights_;
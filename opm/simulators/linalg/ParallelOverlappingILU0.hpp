@@ -20,6 +20,7 @@
 #ifndef OPM_PARALLELOVERLAPPINGILU0_HEADER_INCLUDED
 #define OPM_PARALLELOVERLAPPINGILU0_HEADER_INCLUDED
 #include <opm/common/TimingMacros.hpp>
+#include <opm/grid/utility/SparseTable.hpp>
 #include <opm/simulators/linalg/MILU.hpp>
 #include <opm/simulators/linalg/PreconditionerWithUpdate.hpp>
 #include <dune/istl/paamg/smoother.hh>
@@ -126,7 +127,7 @@ namespace Opm
 /// \tparam ParallelInfo The type of the parallel information object
 ///         used, e.g. Dune::OwnerOverlapCommunication
 template<class Matrix, class Domain, class Range, class ParallelInfoT>
-class ParallelOverlappingILU0
+class ParallelOverlappingILU0 final
     : public Dune::PreconditionerWithUpdate<Domain,Range>
 {
     using ParallelInfo = ParallelInfoT;
@@ -331,11 +332,21 @@ protected:
 
     void reorderBack(const Range& reorderedV, Range& v);
 
+    //! \brief Apply the triangular solves level-by-level with OpenMP.
+    void applyLevelScheduled(Domain& mv, const Range& md);
+
     //! \brief The ILU0 decomposition of the matrix.
     std::unique_ptr<Matrix> ILU_;
     CRS lower_;
     CRS upper_;
     std::vector< block_type > inv_;
+    //! \brief Rows of the factors grouped into mutually independent level
+    //!        sets; only non-empty if level-scheduled solves are used.
+    SparseTable<std::size_t> lowerLevelSets_;
+    SparseTable<std::size_t> upperLevelSets_;
+    //! \brief Whether to run the triangular solves level-scheduled across
+    //!        OpenMP threads.
+    bool levelScheduling_ = false;
     //! \brief the reordering of the unknowns
     std::vector< std::size_t > ordering_;
     //! \brief The reordered right hand side
@@ -33,6 +33,10 @@
 
 #include <cassert>
 
+#if HAVE_OPENMP
+#include <omp.h>
+#endif
+
 namespace Opm
 {
 namespace detail
@@ -339,6 +343,19 @@ apply (Domain& v, const Range& d)
         OPM_THROW(std::logic_error,"ILU: number of lower and upper rows must be the same");
     }
 
+    if (levelScheduling_)
+    {
+        applyLevelScheduled(mv, md);
+
+        copyOwnerToAll( mv );
+
+        if( relaxation_ ) {
+            mv *= w_;
+        }
+        reorderBack(mv, v);
+        return;
+    }
+
     // lower triangular solve
     for (size_type i = 0; i < lowerLoopEnd; ++i)
     {
@@ -378,6 +395,78 @@ apply (Domain& v, const Range& d)
     reorderBack(mv, v);
 }
 
+template<class Matrix, class Domain, class Range, class ParallelInfoT>
+void ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
+applyLevelScheduled(Domain& mv, const Range& md)
+{
+    // Same arithmetic as the serial sweeps in apply(), but rows within a
+    // level set have no mutual dependencies and are distributed across
+    // OpenMP threads. Executing the levels in order preserves the exact
+    // result of the serial solves.
+    using dblock = typename Range ::block_type;
+    using vblock = typename Domain::block_type;
+
+    const size_type iEnd = lower_.rows();
+    const size_type lastRow = iEnd - 1;
+    const size_type upperLoopStart = iEnd - interiorSize_;
+    const size_type lowerLoopEnd = interiorSize_;
+
+    // lower triangular solve
+    for (const auto& levelSet : lowerLevelSets_)
+    {
+        const int numRowsInLevel = levelSet.size();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int rowIdxInLevel = 0; rowIdxInLevel < numRowsInLevel; ++rowIdxInLevel)
+        {
+            const size_type i = levelSet[rowIdxInLevel];
+            if (i >= lowerLoopEnd) {
+                continue;
+            }
+            dblock rhs( md[ i ] );
+            const size_type rowI     = lower_.rows_[ i ];
+            const size_type rowINext = lower_.rows_[ i+1 ];
+
+            for (size_type col = rowI; col < rowINext; ++col)
+            {
+                lower_.values_[ col ].mmv( mv[ lower_.cols_[ col ] ], rhs );
+            }
+
+            mv[ i ] = rhs;  // Lii = I
+        }
+    }
+
+    // upper triangular solve; note that upper_ and inv_ store the rows in
+    // reverse order, so the storage index of row r is lastRow - r.
+    for (const auto& levelSet : upperLevelSets_)
+    {
+        const int numRowsInLevel = levelSet.size();
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+        for (int rowIdxInLevel = 0; rowIdxInLevel < numRowsInLevel; ++rowIdxInLevel)
+        {
+            const size_type i = lastRow - levelSet[rowIdxInLevel];
+            if (i < upperLoopStart) {
+                continue;
+            }
+            vblock& vBlock = mv[ lastRow - i ];
+            vblock rhs ( vBlock );
+            const size_type rowI     = upper_.rows_[ i ];
+            const size_type rowINext = upper_.rows_[ i+1 ];
+
+            for (size_type col = rowI; col < rowINext; ++col)
+            {
+                upper_.values_[ col ].mmv( mv[ upper_.cols_[ col ] ], rhs );
+            }
+
+            // apply inverse and store result
+            inv_[ i ].mv( rhs, vBlock);
+        }
+    }
+}
+
 template<class Matrix, class Domain, class Range, class ParallelInfoT>
 template<class V>
 void ParallelOverlappingILU0<Matrix,Domain,Range,ParallelInfoT>::
@@ -559,6 +648,19 @@ update()
 
     // store ILU in simple CRS format
     detail::convertToCRS(*ILU_, lower_, upper_, inv_);
+
+    // With several OpenMP threads available, group the rows of the factors
+    // into mutually independent level sets so that the triangular solves in
+    // apply() can run in parallel. The red-black reordered variant already
+    // exposes its parallelism through the ordering, so keep it as is.
+    levelScheduling_ = false;
+#if HAVE_OPENMP
+    if (omp_get_max_threads() > 1 && ordering_.empty()) {
+        lowerLevelSets_ = getMatrixRowColoring(*ILU_, ColoringType::LOWER);
+        upperLevelSets_ = getMatrixRowColoring(*ILU_, ColoringType::UPPER);
+        levelScheduling_ = true;
+    }
+#endif
 }
 
 template<class Matrix, class Domain, class Range, class ParallelInfoT>
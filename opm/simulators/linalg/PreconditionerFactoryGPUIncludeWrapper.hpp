@@ -25,6 +25,7 @@
 #include <opm/simulators/linalg/gpuistl_hip/GpuBlockPreconditioner.hpp>
 #include <opm/simulators/linalg/gpuistl_hip/GpuDILU.hpp>
 #include <opm/simulators/linalg/gpuistl_hip/GpuPressureTransferPolicy.hpp>
+#include <opm/simulators/linalg/gpuistl_hip/GpuToCpuPressureTransferPolicy.hpp>
 #include <opm/simulators/linalg/gpuistl_hip/OpmGpuILU0.hpp>
 #include <opm/simulators/linalg/gpuistl_hip/GpuJac.hpp>
 #include <opm/simulators/linalg/gpuistl_hip/GpuSeqILU0.hpp>
@@ -35,6 +36,7 @@
 #include <opm/simulators/linalg/gpuistl/GpuBlockPreconditioner.hpp>
 #include <opm/simulators/linalg/gpuistl/GpuDILU.hpp>
 #include <opm/simulators/linalg/gpuistl/GpuPressureTransferPolicy.hpp>
+#include <opm/simulators/linalg/gpuistl/GpuToCpuPressureTransferPolicy.hpp>
 #include <opm/simulators/linalg/gpuistl/OpmGpuILU0.hpp>
 #include <opm/simulators/linalg/gpuistl/GpuJac.hpp>
 #include <opm/simulators/linalg/gpuistl/GpuSeqILU0.hpp>
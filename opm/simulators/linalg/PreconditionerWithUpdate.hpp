@@ -33,6 +33,12 @@ class PreconditionerWithUpdate : public Preconditioner<X, Y>
 public:
     virtual void update() = 0;
 
+    /// Update only the parts of the preconditioner that are cheap to refresh
+    /// (e.g. the finest-level smoother of a multilevel method), keeping any
+    /// frozen hierarchy intact. Defaults to a full update().
+    virtual void partialUpdate()
+    { update(); }
+
     // Force derived classes to define if preconditioner has perfect update
     virtual bool hasPerfectUpdate() const = 0;
 };
@@ -109,6 +109,50 @@ namespace detail
         multMatrixTransposedImpl( A, B, ret, std::false_type() );
     }
 
+    //! calculates ret -= A * B * C for statically sized blocks
+    //!
+    //! The loops have compile-time bounds and the intermediate product
+    //! rows live on the stack, so for the 2x2-4x4 blocks used by the
+    //! flow models the compiler fully unrolls and vectorizes this,
+    //! while the operator* chain on Dune matrices materializes two
+    //! temporary matrices per term.
+    template< class TA, class TB, class TC, class TRet >
+    static inline void subtractTripleProduct( const TA &A,  // n x m
+                                              const TB &B,  // m x p
+                                              const TC &C,  // p x q
+                                              TRet &ret )   // n x q
+    {
+        using K = typename TRet :: field_type;
+        static_assert( int(TA::cols) == int(TB::rows), "size mismatch" );
+        static_assert( int(TB::cols) == int(TC::rows), "size mismatch" );
+        static_assert( int(TA::rows) == int(TRet::rows), "size mismatch" );
+        static_assert( int(TC::cols) == int(TRet::cols), "size mismatch" );
+
+        for( int i = 0; i < int(TA::rows); ++i )
+        {
+            // row i of (A * B)
+            K ab[ int(TB::cols) ];
+            for( int l = 0; l < int(TB::cols); ++l )
+            {
+                K sum = 0;
+                for( int k = 0; k < int(TA::cols); ++k )
+                {
+                    sum += A[ i ][ k ] * B[ k ][ l ];
+                }
+                ab[ l ] = sum;
+            }
+            for( int j = 0; j < int(TC::cols); ++j )
+            {
+                K sum = 0;
+                for( int l = 0; l < int(TB::cols); ++l )
+                {
+                    sum += ab[ l ] * C[ l ][ j ];
+                }
+                ret[ i ][ j ] -= sum;
+            }
+        }
+    }
+
     //! calculates ret = A * B
     template< class K>
     static inline
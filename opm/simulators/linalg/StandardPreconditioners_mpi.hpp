@@ -170,6 +170,11 @@ struct StandardPreconditioners
             const double w = prm.get<double>("relaxation", 1.0);
             return wrapBlockPreconditioner<DummyUpdatePreconditioner<SeqGS<M, V, V>>>(comm, op.getmat(), n, w);
         });
+        F::addCreator("rbgs", [](const O& op, const P& prm, const std::function<V()>&, std::size_t, const C& comm) {
+            const int n = prm.get<int>("repeats", 1);
+            const double w = prm.get<double>("relaxation", 1.0);
+            return wrapBlockPreconditioner<MulticolorGaussSeidel<M, V, V>>(comm, op.getmat(), n, w);
+        });
         F::addCreator("sor", [](const O& op, const P& prm, const std::function<V()>&, std::size_t, const C& comm) {
             const int n = prm.get<int>("repeats", 1);
             const double w = prm.get<double>("relaxation", 1.0);
@@ -268,13 +273,28 @@ struct StandardPreconditioners
                          const P& prm,
                          const std::function<V()> weightsCalculator,
                          std::size_t pressureIndex,
-                         const C& comm) {
+                         const C& comm) -> typename F::PrecPtr {
                           assert(weightsCalculator);
                           if (pressureIndex == std::numeric_limits<std::size_t>::max()) {
                               OPM_THROW(std::logic_error,
                                         "Pressure index out of bounds. It needs to specified for CPR");
                           }
                           using Scalar = typename V::field_type;
+                          // With "coarse_precision": "float" the pressure system is
+                          // assembled and solved in single precision; the conversion is
+                          // fused into the restriction/prolongation of the transfer
+                          // policy and the outer Krylov iteration is unaffected.
+                          if (prm.get<std::string>("coarse_precision", "native") == "float") {
+#if FLOW_INSTANTIATE_FLOAT
+                              using LevelTransferPolicy = PressureTransferPolicy<O, Comm, float, false>;
+                              return std::make_shared<OwningTwoLevelPreconditioner<O, V, LevelTransferPolicy, Comm>>(
+                                  op, prm, weightsCalculator, pressureIndex, comm);
+#else
+                              OPM_THROW(std::invalid_argument,
+                                        "coarse_precision = float requires a build with "
+                                        "float support (FLOW_INSTANTIATE_FLOAT)");
+#endif
+                          }
                           using LevelTransferPolicy = PressureTransferPolicy<O, Comm, Scalar, false>;
                           return std::make_shared<OwningTwoLevelPreconditioner<O, V, LevelTransferPolicy, Comm>>(
                               op, prm, weightsCalculator, pressureIndex, comm);
@@ -284,13 +304,24 @@ struct StandardPreconditioners
                          const P& prm,
                          const std::function<V()> weightsCalculator,
                          std::size_t pressureIndex,
-                         const C& comm) {
+                         const C& comm) -> typename F::PrecPtr {
                           assert(weightsCalculator);
                           if (pressureIndex == std::numeric_limits<std::size_t>::max()) {
                               OPM_THROW(std::logic_error,
                                         "Pressure index out of bounds. It needs to specified for CPR");
                           }
                           using Scalar = typename V::field_type;
+                          if (prm.get<std::string>("coarse_precision", "native") == "float") {
+#if FLOW_INSTANTIATE_FLOAT
+                              using LevelTransferPolicy = PressureTransferPolicy<O, Comm, float, true>;
+                              return std::make_shared<OwningTwoLevelPreconditioner<O, V, LevelTransferPolicy, Comm>>(
+                                  op, prm, weightsCalculator, pressureIndex, comm);
+#else
+                              OPM_THROW(std::invalid_argument,
+                                        "coarse_precision = float requires a build with "
+                                        "float support (FLOW_INSTANTIATE_FLOAT)");
+#endif
+                          }
                           using LevelTransferPolicy = PressureTransferPolicy<O, Comm, Scalar, true>;
                           return std::make_shared<OwningTwoLevelPreconditioner<O, V, LevelTransferPolicy, Comm>>(
                               op, prm, weightsCalculator, pressureIndex, comm);
@@ -48,6 +48,47 @@ class TrivialPreconditioner : public Dune::PreconditionerWithUpdate<X, Y>
 template <class Operator>
 struct StandardPreconditioners<Operator, Dune::Amg::SequentialInformation, typename std::enable_if_t<!Opm::is_gpu_operator_v<Operator>>>
 {
+    // Create the two-level CPR preconditioner with the fine smoother type
+    // resolved at compile time for the common smoother choices. This
+    // instantiates the two-level method directly against the concrete
+    // smoother, so each smoother application in the apply-dominated Krylov
+    // loop is a direct call instead of a virtual dispatch through the
+    // type-erased preconditioner interface. Other smoother configurations
+    // fall back to the factory-created, type-erased fine smoother.
+    template <class LevelTransferPolicy>
+    static typename PreconditionerFactory<Operator, Dune::Amg::SequentialInformation>::PrecPtr
+    createTwoLevel(const Operator& op,
+                   const PropertyTree& prm,
+                   const std::function<typename PreconditionerFactory<Operator, Dune::Amg::SequentialInformation>::Vector()>& weightsCalculator,
+                   std::size_t pressureIndex)
+    {
+        using O = Operator;
+        using C = Dune::Amg::SequentialInformation;
+        using F = PreconditionerFactory<O, C>;
+        using M = typename F::Matrix;
+        using V = typename F::Vector;
+
+        std::string smoother = prm.get<std::string>("finesmoother.type", "paroverilu0");
+        // Make the smoother type lowercase for internal canonical representation
+        std::ranges::transform(smoother, smoother.begin(), ::tolower);
+        if (smoother == "ilu0" || smoother == "paroverilu0") {
+            using Smoother = ParallelOverlappingILU0<M, V, V, C>;
+            const double w = prm.get<double>("finesmoother.relaxation", 1.0);
+            const int n = (smoother == "ilu0") ? 0 : prm.get<int>("finesmoother.ilulevel", 0);
+            auto finesmoother = std::make_shared<Smoother>(op.getmat(), n, w, MILU_VARIANT::ILU);
+            return std::make_shared<Dune::OwningTwoLevelPreconditioner<O, V, LevelTransferPolicy, C, Smoother>>(
+                op, prm, weightsCalculator, pressureIndex, std::move(finesmoother));
+        }
+        if (smoother == "dilu") {
+            using Smoother = MultithreadDILU<M, V, V>;
+            auto finesmoother = std::make_shared<Smoother>(op.getmat());
+            return std::make_shared<Dune::OwningTwoLevelPreconditioner<O, V, LevelTransferPolicy, C, Smoother>>(
+                op, prm, weightsCalculator, pressureIndex, std::move(finesmoother));
+        }
+        return std::make_shared<Dune::OwningTwoLevelPreconditioner<O, V, LevelTransferPolicy>>(
+            op, prm, weightsCalculator, pressureIndex);
+    }
+
     static void add()
     {
         using namespace Dune;
@@ -104,6 +145,11 @@ struct StandardPreconditioners<Operator, Dune::Amg::SequentialInformation, typen
             const double w = prm.get<double>("relaxation", 1.0);
             return getDummyUpdateWrapper<SeqGS<M, V, V>>(op.getmat(), n, w);
         });
+        F::addCreator("rbgs", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
+            const int n = prm.get<int>("repeats", 1);
+            const double w = prm.get<double>("relaxation", 1.0);
+            return std::make_shared<MulticolorGaussSeidel<M, V, V>>(op.getmat(), n, w);
+        });
         F::addCreator("sor", [](const O& op, const P& prm, const std::function<V()>&, std::size_t) {
             const int n = prm.get<int>("repeats", 1);
             const double w = prm.get<double>("relaxation", 1.0);
@@ -222,32 +268,53 @@ struct StandardPreconditioners<Operator, Dune::Amg::SequentialInformation, typen
                     using Scalar = typename V::field_type;
                     using LevelTransferPolicy
                         = PressureBhpTransferPolicy<O, Dune::Amg::SequentialInformation, Scalar, false>;
-                    return std::make_shared<OwningTwoLevelPreconditioner<O, V, LevelTransferPolicy>>(
-                        op, prm, weightsCalculator, pressureIndex);
+                    return createTwoLevel<LevelTransferPolicy>(op, prm, weightsCalculator, pressureIndex);
                 });
         }
 
         F::addCreator(
             "cpr",
-            [](const O& op, const P& prm, const std::function<V()>& weightsCalculator, std::size_t pressureIndex) {
+            [](const O& op, const P& prm, const std::function<V()>& weightsCalculator, std::size_t pressureIndex)
+                -> typename F::PrecPtr {
                 if (pressureIndex == std::numeric_limits<std::size_t>::max()) {
                     OPM_THROW(std::logic_error, "Pressure index out of bounds. It needs to specified for CPR");
                 }
                 using Scalar = typename V::field_type;
+                // With "coarse_precision": "float" the pressure system is assembled and
+                // solved in single precision, with the conversion fused into the
+                // restriction/prolongation of the transfer policy. The outer Krylov
+                // iteration is unaffected.
+                if (prm.get<std::string>("coarse_precision", "native") == "float") {
+#if FLOW_INSTANTIATE_FLOAT
+                    using LevelTransferPolicy = PressureTransferPolicy<O, Dune::Amg::SequentialInformation, float, false>;
+                    return createTwoLevel<LevelTransferPolicy>(op, prm, weightsCalculator, pressureIndex);
+#else
+                    OPM_THROW(std::invalid_argument,
+                              "coarse_precision = float requires a build with float support (FLOW_INSTANTIATE_FLOAT)");
+#endif
+                }
                 using LevelTransferPolicy = PressureTransferPolicy<O, Dune::Amg::SequentialInformation, Scalar, false>;
-                return std::make_shared<OwningTwoLevelPreconditioner<O, V, LevelTransferPolicy>>(
-                    op, prm, weightsCalculator, pressureIndex);
+                return createTwoLevel<LevelTransferPolicy>(op, prm, weightsCalculator, pressureIndex);
             });
         F::addCreator(
             "cprt",
-            [](const O& op, const P& prm, const std::function<V()>& weightsCalculator, std::size_t pressureIndex) {
+            [](const O& op, const P& prm, const std::function<V()>& weightsCalculator, std::size_t pressureIndex)
+                -> typename F::PrecPtr {
                 if (pressureIndex == std::numeric_limits<std::size_t>::max()) {
                     OPM_THROW(std::logic_error, "Pressure index out of bounds. It needs to specified for CPR");
                 }
                 using Scalar = typename V::field_type;
+                if (prm.get<std::string>("coarse_precision", "native") == "float") {
+#if FLOW_INSTANTIATE_FLOAT
+                    using LevelTransferPolicy = PressureTransferPolicy<O, Dune::Amg::SequentialInformation, float, true>;
+                    return createTwoLevel<LevelTransferPolicy>(op, prm, weightsCalculator, pressureIndex);
+#else
+                    OPM_THROW(std::invalid_argument,
+                              "coarse_precision = float requires a build with float support (FLOW_INSTANTIATE_FLOAT)");
+#endif
+                }
                 using LevelTransferPolicy = PressureTransferPolicy<O, Dune::Amg::SequentialInformation, Scalar, true>;
-                return std::make_shared<OwningTwoLevelPreconditioner<O, V, LevelTransferPolicy>>(
-                    op, prm, weightsCalculator, pressureIndex);
+                return createTwoLevel<LevelTransferPolicy>(op, prm, weightsCalculator, pressureIndex);
             });
 
 #if HAVE_CUDA
@@ -93,19 +93,9 @@ public:
     void applyscaleadd(field_type alpha, const X& x, Y& y) const override
     {
         OPM_TIMEBLOCK(applyscaleadd);
-        if (this->wellMod_.empty()) {
-            return;
-        }
-
-        if (scaleAddRes_.size() != y.size()) {
-            scaleAddRes_.resize(y.size());
+        for (const auto& well : this->wellMod_) {
+            this->applyScaleAddSingleWell(alpha, x, y, well, well->cells());
         }
-
-        scaleAddRes_ = 0.0;
-        // scaleAddRes_  = - C D^-1 B x
-        apply(x, scaleAddRes_);
-        // Ax = Ax + alpha * scaleAddRes_
-        y.axpy(alpha, scaleAddRes_);
     }
 
     /// Category for operator.
@@ -163,12 +153,35 @@ protected:
 
     }
 
+    template<class WellType, class ArrayType>
+    void applyScaleAddSingleWell(const field_type alpha,
+                                 const X& x, Y& y,
+                                 const WellType& well,
+                                 const ArrayType& cells) const
+    {
+        // A well only modifies the perforated rows of y, so gather and
+        // scatter those instead of forming the contribution in a
+        // full-size temporary vector.
+        x_local_.resize(cells.size());
+        Ax_local_.resize(cells.size());
+
+        for (size_t i = 0; i < cells.size(); ++i) {
+            x_local_[i] = x[cells[i]];
+        }
+        Ax_local_ = 0.0;
+
+        well->apply(x_local_, Ax_local_);
+
+        for (size_t i = 0; i < cells.size(); ++i) {
+            y[cells[i]].axpy(alpha, Ax_local_[i]);
+        }
+    }
+
     // These members are used to avoid reallocation.
     // Their state is not relevant between function calls, so they can
     // (and must) be mutable, as the functions using them are const.
     mutable X x_local_{};
     mutable Y Ax_local_{};
-    mutable Y scaleAddRes_{};
 };
 
 template <class WellModel, class X, class Y>
@@ -195,6 +208,19 @@ public:
         }
     }
 
+    void applyscaleadd(field_type alpha, const X& x, Y& y) const override
+    {
+        OPM_TIMEBLOCK(applyscaleadd);
+        std::size_t well_index = 0;
+        for (const auto& well : this->wellMod_) {
+            if (this->wellMod_.well_domain().at(well->name()) == domainIndex_) {
+                this->applyScaleAddSingleWell(alpha, x, y, well,
+                                              this->wellMod_.well_local_cells()[well_index]);
+            }
+            ++well_index;
+        }
+    }
+
     void addWellPressureEquations(PressureMatrix& jacobian,
                                   const X& weights,
                                   const bool use_well_weights) const override
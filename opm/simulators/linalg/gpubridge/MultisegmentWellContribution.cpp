@@ -83,6 +83,13 @@ template<class Scalar>
 void MultisegmentWellContribution<Scalar>::apply(Scalar* h_x, Scalar* h_y)
 {
     OPM_TIMEBLOCK(apply);
+    computeZ2(h_x);
+    applyZ2(h_y);
+}
+
+template<class Scalar>
+void MultisegmentWellContribution<Scalar>::computeZ2(const Scalar* h_x)
+{
     // reset z1 and z2
     std::ranges::fill(z1, 0.0);
     std::ranges::fill(z2, 0.0);
@@ -109,7 +116,11 @@ void MultisegmentWellContribution<Scalar>::apply(Scalar* h_x, Scalar* h_y)
     } else {
         umfpack_di_solve(UMFPACK_A, Dcols.data(), Drows.data(), Dvals.data(), z2.data(), z1.data(), UMFPACK_Numeric, nullptr, nullptr);
     }
+}
 
+template<class Scalar>
+void MultisegmentWellContribution<Scalar>::applyZ2(Scalar* h_y)
+{
     // y -= (C^T * z2)
     // y -= (C^T * (D^-1 * (B * x)))
     for (unsigned int row = 0; row < Mb; ++row) {
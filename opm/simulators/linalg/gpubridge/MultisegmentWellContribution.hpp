@@ -113,6 +113,17 @@ public:
     /// \param[in] h_x          vector x, must be on CPU
     /// \param[inout] h_y       vector y, must be on CPU
     void apply(Scalar* h_x, Scalar* h_y);
+
+    /// Compute z2 = D^-1 * (B*x), the part of apply() that only depends on x
+    /// Splitting apply() in two allows the x-dependent work to run while the
+    /// GPU is still producing y (e.g. overlapped with the reservoir SpMV)
+    /// \param[in] h_x          vector x, must be on CPU
+    void computeZ2(const Scalar* h_x);
+
+    /// Subtract C^T * z2 from y, the part of apply() that depends on y
+    /// Must be preceded by a call to computeZ2() for the same x
+    /// \param[inout] h_y       vector y, must be on CPU
+    void applyZ2(Scalar* h_y);
 };
 
 } //namespace Opm
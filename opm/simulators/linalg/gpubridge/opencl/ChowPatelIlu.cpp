@@ -847,13 +847,8 @@ void ChowPatelIlu<block_size>::gpu_decomposition(
         // just put everything in the capture list
         std::call_once(initialize_flag, [&](){
             cl::Program::Sources source(1, chow_patel_ilu_sweep_s);  // what does this '1' mean? cl::Program::Sources is of type 'std::vector<std::pair<const char*, long unsigned int> >'
-            cl::Program program = cl::Program(*context, source, &err);
-            if (err != CL_SUCCESS) {
-                OPM_THROW(std::logic_error, "ChowPatelIlu OpenCL could not create Program");
-            }
-
             std::vector<cl::Device> devices = context->getInfo<CL_CONTEXT_DEVICES>();
-            program.build(devices);
+            cl::Program program = buildProgramWithCache(context, devices, source, verbosity);
 
             chow_patel_ilu_sweep_k.reset(new cl::KernelFunctor<cl::Buffer&, cl::Buffer&, cl::Buffer&,
                                                      cl::Buffer&, cl::Buffer&, cl::Buffer&,
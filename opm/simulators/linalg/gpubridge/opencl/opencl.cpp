@@ -19,7 +19,21 @@
 
 #include <config.h>
 #include <opm/simulators/linalg/gpubridge/opencl/opencl.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
 #include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
 
 namespace Opm
 {
@@ -101,5 +115,103 @@ std::string getErrorString(cl_int error)
     }
 }
 
+namespace {
+
+/// 64 bit FNV-1a. Used instead of std::hash so that the cache file names
+/// are stable across processes and standard library implementations.
+std::uint64_t fnv1aHash(std::uint64_t hash, const std::string& data)
+{
+    for (const unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+} // anonymous namespace
+
+cl::Program buildProgramWithCache(cl::Context* context,
+                                  std::vector<cl::Device>& devices,
+                                  const cl::Program::Sources& sources,
+                                  int verbosity)
+{
+    auto buildFromSource = [&]()
+    {
+        cl::Program program(*context, sources);
+        program.build(devices);
+        return program;
+    };
+
+    const char* cacheDir = std::getenv("OPM_OPENCL_KERNEL_CACHE_DIR");
+    if (cacheDir == nullptr || *cacheDir == '\0' || devices.size() != 1) {
+        // Caching is opt-in, and a single binary cannot represent a
+        // multi-device build.
+        return buildFromSource();
+    }
+
+    // Key on the program text and the device/driver identification: a
+    // source change or a driver update invalidates the entry.
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const auto& src : sources) {
+        hash = fnv1aHash(hash, src);
+    }
+    hash = fnv1aHash(hash, devices[0].getInfo<CL_DEVICE_NAME>());
+    hash = fnv1aHash(hash, devices[0].getInfo<CL_DEVICE_VERSION>());
+    hash = fnv1aHash(hash, devices[0].getInfo<CL_DRIVER_VERSION>());
+
+    std::ostringstream fname;
+    fname << cacheDir << "/opm-opencl-" << std::hex << hash << ".bin";
+    const std::string cacheFile = fname.str();
+
+    if (std::ifstream in(cacheFile, std::ios::binary); in) {
+        std::vector<unsigned char> binary((std::istreambuf_iterator<char>(in)),
+                                          std::istreambuf_iterator<char>());
+        if (!binary.empty()) {
+            try {
+                cl::Program program(*context, devices,
+                                    cl::Program::Binaries{std::move(binary)});
+                program.build(devices);
+                if (verbosity >= 1) {
+                    OpmLog::info("Loaded OpenCL program binary from " + cacheFile);
+                }
+                return program;
+            } catch (const cl::Error&) {
+                // Stale or foreign binary; recompile from source below.
+                if (verbosity >= 1) {
+                    OpmLog::info("Could not use cached OpenCL program binary " +
+                                 cacheFile + ", recompiling from source");
+                }
+            }
+        }
+    }
+
+    cl::Program program = buildFromSource();
+
+    try {
+        const auto binaries = program.getInfo<CL_PROGRAM_BINARIES>();
+        if (!binaries.empty() && !binaries.front().empty()) {
+            // Write to a temporary file and rename it into place so that
+            // concurrent processes never observe a partial cache entry.
+            const std::string tmpFile = cacheFile + '.' + std::to_string(getpid());
+            std::ofstream out(tmpFile, std::ios::binary);
+            out.write(reinterpret_cast<const char*>(binaries.front().data()),
+                      binaries.front().size());
+            out.close();
+
+            std::error_code ec{};
+            std::filesystem::rename(tmpFile, cacheFile, ec);
+            if (ec) {
+                std::filesystem::remove(tmpFile, ec);
+            } else if (verbosity >= 1) {
+                OpmLog::info("Stored OpenCL program binary in " + cacheFile);
+            }
+        }
+    } catch (const std::exception&) {
+        // A failure to populate the cache must never fail the run.
+    }
+
+    return program;
+}
+
 } // namespace Accelerator
 } // namespace Opm
@@ -32,6 +32,7 @@
 #endif
 
 #include <string>
+#include <vector>
 
 
 namespace Opm
@@ -44,5 +45,25 @@ namespace Accelerator
 /// \param[in] error     error code
 std::string getErrorString(cl_int error);
 
+/// Build an OpenCL program from source, using a persistent program-binary
+/// cache if one is configured.
+///
+/// The cache is enabled by pointing the environment variable
+/// OPM_OPENCL_KERNEL_CACHE_DIR at a writable directory. Cached binaries
+/// are keyed by a hash of the program text together with the device name
+/// and the driver version, so a source change or a driver update
+/// invalidates the entry automatically. On a cache miss the program is
+/// compiled from source and its binary is stored for subsequent runs.
+/// Without the environment variable the program is always compiled from
+/// source.
+/// \param[in] context   the OpenCL context
+/// \param[in] devices   the devices to build for
+/// \param[in] sources   the program sources
+/// \param[in] verbosity controls logging of cache hits and misses
+cl::Program buildProgramWithCache(cl::Context* context,
+                                  std::vector<cl::Device>& devices,
+                                  const cl::Program::Sources& sources,
+                                  int verbosity);
+
 } // namespace Accelerator
 } // namespace Opm
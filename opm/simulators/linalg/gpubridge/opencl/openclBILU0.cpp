@@ -207,7 +207,9 @@ create_preconditioner(BlockedMatrix<Scalar>* mat, BlockedMatrix<Scalar>* jacMat)
         copyThread->join();
     }
 
-    // TODO: remove this copy by replacing inplace ilu decomp by out-of-place ilu decomp
+#if CHOW_PATEL
+    // The Chow-Patel decomposition updates the values on the host, so they
+    // have to be staged in LUmat first.
     Timer t_copy;
     memcpy(LUmat->nnzValues, matToDecompose->nnzValues,
            sizeof(Scalar) * bs * bs * matToDecompose->nnzbs);
@@ -218,7 +220,6 @@ create_preconditioner(BlockedMatrix<Scalar>* mat, BlockedMatrix<Scalar>* jacMat)
         OpmLog::info(out.str());
     }
 
-#if CHOW_PATEL
     chowPatelIlu.decomposition(queue.get(), context.get(),
                                LUmat.get(), Lmat.get(), Umat.get(),
                                invDiagVals.data(), diagIndex,
@@ -226,12 +227,16 @@ create_preconditioner(BlockedMatrix<Scalar>* mat, BlockedMatrix<Scalar>* jacMat)
                                s.Lvals, s.Lcols, s.Lrows,
                                s.Uvals, s.Ucols, s.Urows);
 #else
+    // The GPU decomposition only reads the values through s.LUvals, so
+    // upload them straight from the source matrix instead of staging them
+    // in LUmat first.  The level-scheduling row permutation is applied on
+    // the GPU through s.rowIndices.
     Timer t_copyToGpu;
 
     events.resize(1);
     queue->enqueueWriteBuffer(s.LUvals, CL_FALSE, 0,
                               LUmat->nnzbs * bs * bs * sizeof(Scalar),
-                              LUmat->nnzValues, nullptr, &events[0]);
+                              matToDecompose->nnzValues, nullptr, &events[0]);
 
     std::call_once(pattern_uploaded, [&](){
         // find the positions of each diagonal block
@@ -127,8 +127,7 @@ void OpenclKernels<Scalar>::init(cl::Context *context,
     sources.emplace_back(isaiL_str);
     sources.emplace_back(isaiU_str);
 
-    cl::Program program = cl::Program(*context, sources);
-    program.build(devices);
+    cl::Program program = buildProgramWithCache(context, devices, sources, verbosity);
 
     // queue.enqueueNDRangeKernel() is a blocking/synchronous call, at least for NVIDIA
     // cl::KernelFunctor<> myKernel(); myKernel(args, arg1, arg2); is also blocking
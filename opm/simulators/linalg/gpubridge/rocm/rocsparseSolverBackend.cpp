@@ -255,6 +255,12 @@ gpu_pbicgstab([[maybe_unused]] WellContributions<Scalar>& wellContribs,
         // apply ilu0/cpr: d_pw = prec(d_p)
         prec->apply(*d_p, *d_pw, wellContribs);
 
+        // start downloading d_pw for the multisegment wells on the well stream,
+        // overlapped with the spmv below
+        if (wellContribs.getNumWells() > 0) {
+            static_cast<WellContributionsRocsparse<Scalar>&>(wellContribs).prefetch_mswells(d_pw);
+        }
+
         if (verbosity >= 3) {
             HIP_CHECK(hipStreamSynchronize(stream));
             t_prec.stop();
@@ -355,6 +361,12 @@ gpu_pbicgstab([[maybe_unused]] WellContributions<Scalar>& wellContribs,
 
         prec->apply(*d_r, *d_s, wellContribs);// d_s = W-1 * d_r
 
+        // start downloading d_s for the multisegment wells on the well stream,
+        // overlapped with the spmv below
+        if (wellContribs.getNumWells() > 0) {
+            static_cast<WellContributionsRocsparse<Scalar>&>(wellContribs).prefetch_mswells(d_s);
+        }
+
         if (verbosity >= 3) {
             HIP_CHECK(hipStreamSynchronize(stream));
             t_prec.stop();
@@ -130,6 +130,30 @@ __global__ void stdwell_apply(const Scalar* Cnnzs,
 }
 #endif
 
+template<class Scalar>
+WellContributionsRocsparse<Scalar>::WellContributionsRocsparse()
+{
+    HIP_CHECK(hipStreamCreate(&well_stream));
+    HIP_CHECK(hipEventCreateWithFlags(&x_ready_event, hipEventDisableTiming));
+}
+
+template<class Scalar>
+WellContributionsRocsparse<Scalar>::~WellContributionsRocsparse()
+{
+    hipError_t hipstatus = hipStreamSynchronize(well_stream);
+    if (hipstatus != hipSuccess) {
+        OpmLog::error("Could not synchronize with well hipStream");
+    }
+    hipstatus = hipStreamDestroy(well_stream);
+    if (hipstatus != hipSuccess) {
+        OpmLog::error("Could not destroy well hipStream");
+    }
+    hipstatus = hipEventDestroy(x_ready_event);
+    if (hipstatus != hipSuccess) {
+        OpmLog::error("Could not destroy hipEvent");
+    }
+}
+
 template<class Scalar>
 void WellContributionsRocsparse<Scalar>::
 apply_stdwells([[maybe_unused]] Scalar* d_x,
@@ -151,12 +175,32 @@ apply_stdwells([[maybe_unused]] Scalar* d_x,
                                                                               this->dim_wells,
                                                                               d_val_pointers_hip
     );
-    HIP_CHECK(hipStreamSynchronize(stream));
 #else
     OPM_THROW(std::logic_error, "Error separate wellcontributions for rocsparse only supported when compiling with hipcc");
 #endif
 }
 
+template<class Scalar>
+void WellContributionsRocsparse<Scalar>::
+prefetch_mswells(const Scalar* d_x)
+{
+    if (this->num_ms_wells == 0) {
+        return;
+    }
+
+    if (h_x.empty()) {
+        h_x.resize(this->N);
+        h_y.resize(this->N);
+    }
+
+    // download x on the well stream as soon as it is valid on the main stream,
+    // concurrently with whatever the main stream does next (the reservoir SpMV)
+    HIP_CHECK(hipEventRecord(x_ready_event, stream));
+    HIP_CHECK(hipStreamWaitEvent(well_stream, x_ready_event, 0));
+    HIP_CHECK(hipMemcpyAsync(h_x.data(), d_x, sizeof(Scalar) * this->N, hipMemcpyDeviceToHost, well_stream));
+    mswells_staged = true;
+}
+
 template<class Scalar>
 void WellContributionsRocsparse<Scalar>::
 apply_mswells(Scalar* d_x, Scalar* d_y)
@@ -166,18 +210,34 @@ apply_mswells(Scalar* d_x, Scalar* d_y)
         h_y.resize(this->N);
     }
 
-    HIP_CHECK(hipMemcpyAsync(h_x.data(), d_x, sizeof(Scalar) * this->N, hipMemcpyDeviceToHost, stream));
+    // enqueue the y download first so it overlaps with the CPU segment solves below
     HIP_CHECK(hipMemcpyAsync(h_y.data(), d_y, sizeof(Scalar) * this->N, hipMemcpyDeviceToHost, stream));
-    HIP_CHECK(hipStreamSynchronize(stream));
 
-    // actually apply MultisegmentWells
+    if (mswells_staged) {
+        // x was downloaded on the well stream by prefetch_mswells(),
+        // overlapped with the SpMV on the main stream
+        HIP_CHECK(hipStreamSynchronize(well_stream));
+    } else {
+        HIP_CHECK(hipMemcpyAsync(h_x.data(), d_x, sizeof(Scalar) * this->N, hipMemcpyDeviceToHost, stream));
+        HIP_CHECK(hipStreamSynchronize(stream));
+    }
+
+    // the x-dependent half runs while the main stream may still be busy with
+    // the SpMV, the standard well kernel and the y download
+    for (auto& well : this->multisegments) {
+        well->computeZ2(h_x.data());
+    }
+
+    HIP_CHECK(hipStreamSynchronize(stream)); // wait for h_y
+
     for (auto& well : this->multisegments) {
-        well->apply(h_x.data(), h_y.data());
+        well->applyZ2(h_y.data());
     }
 
     // copy vector y from CPU to GPU
     HIP_CHECK(hipMemcpyAsync(d_y, h_y.data(), sizeof(Scalar) * this->N, hipMemcpyHostToDevice, stream));
     HIP_CHECK(hipStreamSynchronize(stream));
+    mswells_staged = false;
 }
 
 template<class Scalar>
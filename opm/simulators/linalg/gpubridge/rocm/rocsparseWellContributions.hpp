@@ -33,13 +33,26 @@ class WellContributionsRocsparse : public WellContributions<Scalar>
 {
 private:
     hipStream_t stream;
+    hipStream_t well_stream;    // second stream used to overlap well work with the reservoir SpMV
+    hipEvent_t x_ready_event;   // signals on 'stream' that the input vector x is valid
+    bool mswells_staged = false;
 
 public:
+    WellContributionsRocsparse();
+    ~WellContributionsRocsparse() override;
+
     void apply_stdwells(Scalar* d_x, Scalar* d_y);
     void apply_mswells(Scalar* d_x, Scalar* d_y);
     void apply(Scalar* d_x, Scalar* d_y);
     void setStream(hipStream_t stream);
 
+    /// Start downloading the input vector x on the well stream.
+    /// Call right after x has been produced on the main stream; the copy then
+    /// runs concurrently with the reservoir SpMV, and the CPU part of the
+    /// multisegment apply in apply_mswells() overlaps the remaining GPU work.
+    /// No-op when there are no multisegment wells.
+    void prefetch_mswells(const Scalar* d_x);
+
 protected:
     /// Allocate memory for the StandardWells
     void APIalloc() override;
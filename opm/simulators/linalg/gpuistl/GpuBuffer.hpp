@@ -23,6 +23,7 @@
 #include <exception>
 #include <fmt/core.h>
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/simulators/linalg/gpuistl/detail/gpu_memory_pool.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/gpu_safe_call.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/safe_conversion.hpp>
 #include <opm/simulators/linalg/gpuistl/GpuView.hpp>
@@ -110,7 +111,7 @@ public:
     explicit GpuBuffer(const size_t numberOfElements)
         : m_numberOfElements(numberOfElements)
     {
-        OPM_GPU_SAFE_CALL(cudaMalloc(&m_dataOnDevice, sizeof(T) * m_numberOfElements));
+        m_dataOnDevice = static_cast<T*>(detail::allocateDevice(sizeof(T) * m_numberOfElements));
     }
 
 
@@ -136,7 +137,7 @@ public:
      */
     virtual ~GpuBuffer()
     {
-        OPM_GPU_WARN_IF_ERROR(cudaFree(m_dataOnDevice));
+        detail::freeDevice(m_dataOnDevice);
     }
 
     /**
@@ -311,12 +312,11 @@ public:
 
         if (m_numberOfElements == 0) {
             // We have no data, so we can just allocate new memory
-            OPM_GPU_SAFE_CALL(cudaMalloc(&m_dataOnDevice, sizeof(T) * newSize));
+            m_dataOnDevice = static_cast<T*>(detail::allocateDevice(sizeof(T) * newSize));
         }
         else {
             // Allocate memory for temporary buffer
-            T* tmpBuffer = nullptr;
-            OPM_GPU_SAFE_CALL(cudaMalloc(&tmpBuffer, sizeof(T) * m_numberOfElements));
+            T* tmpBuffer = static_cast<T*>(detail::allocateDevice(sizeof(T) * m_numberOfElements));
 
             // Move the data from the old to the new buffer with truncation
             size_t sizeOfMove = std::min({m_numberOfElements, newSize});
@@ -326,7 +326,7 @@ public:
                                         cudaMemcpyDeviceToDevice));
 
             // free the old buffer
-            OPM_GPU_SAFE_CALL(cudaFree(m_dataOnDevice));
+            detail::freeDevice(m_dataOnDevice);
 
             // swap the buffers
             m_dataOnDevice = tmpBuffer;
@@ -179,6 +179,12 @@ private:
     std::map<std::pair<field_type*, const field_type*>, GPUGraph> m_apply_graphs;
     std::map<std::pair<field_type*, const field_type*>, GPUGraphExec> m_executableGraphs;
 
+    // Graph for the factorization update; captured on the first update()
+    // and replayed afterwards since the kernel sequence and buffers are fixed
+    GPUGraph m_update_graph;
+    GPUGraphExec m_update_graph_exec;
+    bool m_update_graph_captured = false;
+
     // Stream for the DILU operations on the GPU
     GPUStream m_stream {};
     // Events for synchronization with main stream
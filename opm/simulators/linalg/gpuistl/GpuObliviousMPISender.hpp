@@ -19,22 +19,29 @@
 #ifndef OPM_GPUISTL_GPUOBLIVIOUSMPISENDER_HPP
 #define OPM_GPUISTL_GPUOBLIVIOUSMPISENDER_HPP
 
+#include <dune/common/parallel/mpitraits.hh>
 #include <dune/istl/owneroverlapcopy.hh>
 
 #include <opm/simulators/linalg/FlowLinearSolverParameters.hpp>
 #include <opm/simulators/linalg/gpuistl/GpuSender.hpp>
 #include <opm/simulators/linalg/gpuistl/GpuVector.hpp>
+#include <opm/simulators/linalg/gpuistl/detail/safe_conversion.hpp>
 
 #include <mpi.h>
 
+#include <map>
 #include <memory>
+#include <vector>
 
 namespace Opm::gpuistl
 {
 
 /**
  * @brief Derived class of GPUSender that handles MPI calls that should NOT use GPU direct communicatoin
- * The implementation moves data fromthe GPU to the CPU and then sends it using regular MPI
+ * The implementation packs the halo entries with device kernels, stages only
+ * the packed send/receive buffers through the CPU and sends them using regular
+ * MPI, so the traffic over PCIe is proportional to the overlap and not to the
+ * full vector.
  * @tparam field_type is float or double
  * @tparam block_size is the blocksize of the blockelements in the matrix
  * @tparam OwnerOverlapCopyCommunicationType is typically a Dune::LinearOperator::communication_type
@@ -52,15 +59,152 @@ public:
 
     void copyOwnerToAll(const X& source, X& dest) const override
     {
-        // TODO: [perf] Can we reduce copying from the GPU here?
-        // TODO: [perf] Maybe create a global buffer instead?
-        auto sourceAsDuneVector = source.template asDuneBlockVector<block_size>();
-        auto destAsDuneVector = dest.template asDuneBlockVector<block_size>();
-        this->m_cpuOwnerOverlapCopy.copyOwnerToAll(sourceAsDuneVector, destAsDuneVector);
-        dest.copyFromHost(destAsDuneVector);
+        std::call_once(this->m_initializedIndices, [&]() { initIndexSet(); });
+
+        if (m_messageInformation.empty()) {
+            return;
+        }
+
+        // Pack the owner entries with a device kernel and stage only the
+        // packed halo through the CPU, not the whole vector.
+        source.prepareSendBuf(*m_GPUSendBuf, *m_commpairIndicesOwner);
+        m_GPUSendBuf->copyToHost(m_hostSendBuf);
+
+        std::vector<MPI_Request> sendRequests(m_messageInformation.size(), MPI_REQUEST_NULL);
+        std::vector<MPI_Request> recvRequests(m_messageInformation.size(), MPI_REQUEST_NULL);
+
+        {
+            std::size_t i = 0;
+            for (const auto& [rank, info] : m_messageInformation) {
+                if (info.second.m_size) {
+                    MPI_Irecv(m_hostRecvBuf.data() + info.second.m_start,
+                              detail::to_int(info.second.m_size),
+                              Dune::MPITraits<field_type>::getType(),
+                              rank,
+                              m_commTag,
+                              this->m_cpuOwnerOverlapCopy.communicator(),
+                              &recvRequests[i]);
+                }
+                ++i;
+            }
+        }
+        {
+            std::size_t i = 0;
+            for (const auto& [rank, info] : m_messageInformation) {
+                if (info.first.m_size) {
+                    MPI_Isend(m_hostSendBuf.data() + info.first.m_start,
+                              detail::to_int(info.first.m_size),
+                              Dune::MPITraits<field_type>::getType(),
+                              rank,
+                              m_commTag,
+                              this->m_cpuOwnerOverlapCopy.communicator(),
+                              &sendRequests[i]);
+                }
+                ++i;
+            }
+        }
+
+        MPI_Waitall(detail::to_int(recvRequests.size()), recvRequests.data(), MPI_STATUSES_IGNORE);
+
+        m_GPURecvBuf->copyFromHost(m_hostRecvBuf);
+        dest.syncFromRecvBuf(*m_GPURecvBuf, *m_commpairIndicesCopy);
+
+        MPI_Waitall(detail::to_int(sendRequests.size()), sendRequests.data(), MPI_STATUSES_IGNORE);
     }
 
 private:
+    mutable std::unique_ptr<GpuVector<int>> m_commpairIndicesCopy;
+    mutable std::unique_ptr<GpuVector<int>> m_commpairIndicesOwner;
+    mutable std::unique_ptr<GpuVector<field_type>> m_GPUSendBuf;
+    mutable std::unique_ptr<GpuVector<field_type>> m_GPURecvBuf;
+    mutable std::vector<field_type> m_hostSendBuf;
+    mutable std::vector<field_type> m_hostRecvBuf;
+
+    struct MessageInformation {
+        MessageInformation()
+            : m_start(0)
+            , m_size(0)
+        {
+        }
+        MessageInformation(std::size_t start, std::size_t size)
+            : m_start(start)
+            , m_size(size)
+        {
+        }
+        std::size_t m_start; // offset in elements of "field_type"
+        std::size_t m_size; // size in elements of "field_type"
+    };
+
+    using InformationMap = std::map<int, std::pair<MessageInformation, MessageInformation>>;
+    mutable InformationMap m_messageInformation;
+
+    constexpr static int m_commTag = 0; // So says DUNE
+
+    void buildCommPairIdxs() const
+    {
+        // Same pairing as in GPUAwareMPISender: for every neighbor we send
+        // our owner entries that the remote holds as copies and receive into
+        // our copy entries owned by the remote.
+        const auto& ri = this->m_cpuOwnerOverlapCopy.remoteIndices();
+        std::map<int, std::pair<std::vector<int>, std::vector<int>>> im;
+
+        for (const auto& process : ri) {
+            im[process.first] = std::pair(std::vector<int>(), std::vector<int>());
+            for (int send = 0; send < 2; ++send) {
+                auto remoteEnd = send ? process.second.first->end() : process.second.second->end();
+                auto remote = send ? process.second.first->begin() : process.second.second->begin();
+
+                while (remote != remoteEnd) {
+                    if (send ? (remote->localIndexPair().local().attribute() == 1) : (remote->attribute() == 1)) {
+                        if (send) {
+                            im[process.first].first.push_back(remote->localIndexPair().local().local());
+                        } else {
+                            im[process.first].second.push_back(remote->localIndexPair().local().local());
+                        }
+                    }
+                    ++remote;
+                }
+            }
+        }
+
+        std::vector<int> commpairIndicesCopyOnCPU;
+        std::vector<int> commpairIndicesOwnerCPU;
+        std::size_t sendBufIdx = 0;
+        std::size_t recvBufIdx = 0;
+        for (const auto& [rank, indexPair] : im) {
+            const std::size_t noSend = indexPair.first.size();
+            const std::size_t noRecv = indexPair.second.size();
+
+            if (noSend + noRecv > 0) {
+                m_messageInformation.insert(std::make_pair(
+                    rank,
+                    std::make_pair(MessageInformation(sendBufIdx * block_size, noSend * block_size),
+                                   MessageInformation(recvBufIdx * block_size, noRecv * block_size))));
+
+                for (const auto idx : indexPair.first) {
+                    for (int bs = 0; bs < block_size; bs++) {
+                        commpairIndicesOwnerCPU.push_back(idx * block_size + bs);
+                    }
+                }
+                for (const auto idx : indexPair.second) {
+                    for (int bs = 0; bs < block_size; bs++) {
+                        commpairIndicesCopyOnCPU.push_back(idx * block_size + bs);
+                    }
+                }
+                sendBufIdx += noSend;
+                recvBufIdx += noRecv;
+            }
+        }
+
+        m_commpairIndicesCopy = std::make_unique<GpuVector<int>>(commpairIndicesCopyOnCPU);
+        m_commpairIndicesOwner = std::make_unique<GpuVector<int>>(commpairIndicesOwnerCPU);
+
+        m_GPUSendBuf = std::make_unique<GpuVector<field_type>>(sendBufIdx * block_size);
+        m_GPURecvBuf = std::make_unique<GpuVector<field_type>>(recvBufIdx * block_size);
+        m_hostSendBuf.resize(sendBufIdx * block_size);
+        m_hostRecvBuf.resize(recvBufIdx * block_size);
+    }
+
     void initIndexSet() const override
     {
         // We need indices that we we will use in the project, dot and norm calls.
@@ -84,6 +228,8 @@ private:
 
         this->m_indicesCopy = std::make_unique<GpuVector<int>>(indicesCopyOnCPU);
         this->m_indicesOwner = std::make_unique<GpuVector<int>>(indicesOwnerCPU);
+
+        buildCommPairIdxs();
     }
 };
 
@@ -95,8 +95,7 @@ public:
     {
         const auto& fineLevelMatrix = fineOperator.getmat();
 
-        // Set coarse matrix to zero
-        coarseLevelMatrix_->getNonZeroValues() = 0.0;
+        // No zeroing needed: the extraction kernel writes every coarse entry.
 
         // Calculate coarse entries on GPU
         detail::calculateCoarseEntries<Scalar, transpose>(fineLevelMatrix, *coarseLevelMatrix_, weights_, pressure_var_index_);
@@ -104,10 +103,8 @@ public:
 
     void moveToCoarseLevel(const typename ParentType::FineRangeType& fine) override
     {
-        // Set coarse vector to zero
-        this->rhs_ = 0;
-
-        // Restrict vector on GPU
+        // Restrict vector on GPU; the kernel writes every coarse entry, so
+        // no zeroing pass is needed beforehand.
         detail::restrictVector<Scalar, transpose>(fine, this->rhs_, weights_, pressure_var_index_);
 
         this->lhs_ = 0;
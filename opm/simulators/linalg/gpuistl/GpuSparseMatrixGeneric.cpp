@@ -22,6 +22,7 @@
 #include <opm/simulators/linalg/gpuistl/detail/cusparse_safe_call.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/gpu_safe_call.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/gpusparse_matrix_utilities.hpp>
+#include <opm/simulators/linalg/gpuistl/detail/spmvBlockKernels.hpp>
 #include <opm/simulators/linalg/matrixblock.hh>
 
 #include <dune/common/fmatrix.hh>
@@ -98,6 +99,14 @@ template <class T>
 void
 GpuSparseMatrixGeneric<T>::initializeMatrixDescriptor()
 {
+    // Block sizes with a hand-written SpMV kernel never touch the vendor
+    // generic API, so no descriptor is needed. This also makes these block
+    // sizes usable on HIP and older CUDA, where the generic API has no BSR
+    // support.
+    if (usesBlockedSpMVKernel()) {
+        return;
+    }
+
     // Create matrix descriptor based on blockSize
     if (m_blockSize > 1) {
 #if !USE_HIP && CUDA_VERSION >= 12030
@@ -139,6 +148,11 @@ template <class T>
 void
 GpuSparseMatrixGeneric<T>::preprocessSpMV()
 {
+    if (usesBlockedSpMVKernel()) {
+        // The hand-written kernels need no preprocessing or work buffer.
+        return;
+    }
+
     // Initialize buffer for SpMV operations and preprocess
     size_t vecSize = m_numberOfRows * m_blockSize;
 
@@ -268,6 +282,31 @@ GpuSparseMatrixGeneric<T>::spMV(T alpha, const GpuVector<T>& x, T beta, GpuVecto
     assertSameSize(x);
     assertSameSize(y);
 
+    // The larger block sizes fall off a performance cliff in the vendor
+    // generic BSR path, so they go through the tuned kernels instead.
+    if (m_blockSize == 4) {
+        detail::blockSpMV<T, 4>(alpha,
+                                m_nonZeroElements.data(),
+                                m_rowIndices.data(),
+                                m_columnIndices.data(),
+                                x.data(),
+                                beta,
+                                y.data(),
+                                N());
+        return;
+    }
+    if (m_blockSize == 5) {
+        detail::blockSpMV<T, 5>(alpha,
+                                m_nonZeroElements.data(),
+                                m_rowIndices.data(),
+                                m_columnIndices.data(),
+                                x.data(),
+                                beta,
+                                y.data(),
+                                N());
+        return;
+    }
+
     // Create vector descriptors with RAII cleanup
     auto vecX = detail::makeSafeVectorDescriptor();
     auto vecY = detail::makeSafeVectorDescriptor();
@@ -321,6 +321,14 @@ private:
     // Initialize matrix descriptor based on block size
     void initializeMatrixDescriptor();
 
+    // Whether SpMV goes through the tuned kernels in detail/spmvBlockKernels.hpp
+    // instead of the vendor generic API. These block sizes neither create a
+    // matrix descriptor nor need a work buffer.
+    bool usesBlockedSpMVKernel() const
+    {
+        return m_blockSize == 4 || m_blockSize == 5;
+    }
+
     template <class VectorType>
     void assertSameSize(const VectorType& vector) const;
 
@@ -0,0 +1,173 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_GPU_TO_CPU_PRESSURE_TRANSFER_POLICY_HEADER_INCLUDED
+#define OPM_GPU_TO_CPU_PRESSURE_TRANSFER_POLICY_HEADER_INCLUDED
+
+#include <opm/simulators/linalg/PressureTransferPolicy.hpp>
+#include <opm/simulators/linalg/PropertyTree.hpp>
+#include <opm/simulators/linalg/gpuistl/GpuSparseMatrixWrapper.hpp>
+#include <opm/simulators/linalg/gpuistl/GpuVector.hpp>
+#include <opm/simulators/linalg/gpuistl/detail/cpr_amg_operations.hpp>
+#include <opm/simulators/linalg/twolevelmethodcpr.hh>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Opm::gpuistl
+{
+/// Level transfer policy for a heterogeneous CPR cycle: the fine-level
+/// smoother stays on the GPU while the coarse pressure system is solved
+/// on the CPU, e.g. by Dune AMG.
+///
+/// The restriction, prolongation and coarse-matrix extraction kernels all
+/// run on the GPU, exactly as in GpuPressureTransferPolicy; only the
+/// block-size-1 pressure system crosses the bus.  That is one scalar per
+/// matrix block instead of the full block, so the transfers stay small
+/// compared to the fine-level data the GPU smoother works on.
+///
+/// This is the CPR mode for nodes whose GPU comfortably runs the block
+/// smoother but has no (or no efficient) AMG backend: the GPU keeps the
+/// fine smoother and the CPU cores run the coarse AMG instead of idling.
+template <class FineOperator, class Communication, class Scalar, bool transpose = false>
+class GpuToCpuPressureTransferPolicy
+    : public Dune::Amg::LevelTransferPolicyCpr<FineOperator, Details::SeqCoarseOperatorType<Scalar>>
+{
+public:
+    using CoarseOperator = Details::SeqCoarseOperatorType<Scalar>;
+    using ParentType = Dune::Amg::LevelTransferPolicyCpr<FineOperator, CoarseOperator>;
+    using ParallelInformation = Communication;
+    using FineVectorType = typename FineOperator::domain_type;
+
+public:
+    GpuToCpuPressureTransferPolicy(const Communication& comm,
+                                   const FineVectorType& weights,
+                                   [[maybe_unused]] const PropertyTree& prm,
+                                   int pressure_var_index)
+        : communication_(&const_cast<Communication&>(comm))
+        , weights_(weights)
+        , pressure_var_index_(pressure_var_index)
+    {
+    }
+
+    void createCoarseLevelSystem(const FineOperator& fineOperator) override
+    {
+        using CoarseMatrix = typename CoarseOperator::matrix_type;
+        const auto& fineLevelMatrix = fineOperator.getmat();
+
+        // Staging matrix on the GPU with block size 1 and the sparsity
+        // pattern of the fine matrix; the extraction kernel writes into it.
+        gpuCoarseMatrix_ = std::make_shared<GpuSparseMatrixWrapper<Scalar>>(fineLevelMatrix.getRowIndices(),
+                                                                            fineLevelMatrix.getColumnIndices(),
+                                                                            1 // block size 1
+        );
+
+        // Mirror the sparsity pattern on the CPU for the coarse solver.
+        const auto rowPointers = fineLevelMatrix.getRowIndices().asStdVector();
+        const auto columnIndices = fineLevelMatrix.getColumnIndices().asStdVector();
+        coarseLevelMatrix_ = std::make_shared<CoarseMatrix>(
+            fineLevelMatrix.N(), fineLevelMatrix.N(), fineLevelMatrix.nonzeroes(), CoarseMatrix::row_wise);
+        auto createIter = coarseLevelMatrix_->createbegin();
+        for (std::size_t row = 0; row < fineLevelMatrix.N(); ++row) {
+            for (int entry = rowPointers[row]; entry < rowPointers[row + 1]; ++entry) {
+                createIter.insert(columnIndices[entry]);
+            }
+            ++createIter;
+        }
+
+        coarseValuesHost_.resize(fineLevelMatrix.nonzeroes());
+        gpuRhs_ = std::make_shared<GpuVector<Scalar>>(fineLevelMatrix.N());
+        gpuLhs_ = std::make_shared<GpuVector<Scalar>>(fineLevelMatrix.N());
+
+        calculateCoarseEntries(fineOperator);
+        coarseLevelCommunication_.reset(communication_, [](Communication*) {});
+
+        this->lhs_.resize(coarseLevelMatrix_->M());
+        this->rhs_.resize(coarseLevelMatrix_->N());
+
+        this->operator_ = std::make_shared<CoarseOperator>(*coarseLevelMatrix_);
+    }
+
+    void calculateCoarseEntries(const FineOperator& fineOperator) override
+    {
+        const auto& fineLevelMatrix = fineOperator.getmat();
+
+        // Extract the pressure system on the GPU, then bring only its
+        // scalar entries across the bus for the CPU coarse solver.
+        detail::calculateCoarseEntries<Scalar, transpose>(
+            fineLevelMatrix, *gpuCoarseMatrix_, weights_, pressure_var_index_);
+        gpuCoarseMatrix_->getNonZeroValues().copyToHost(coarseValuesHost_.data(), coarseValuesHost_.size());
+
+        // Both matrices hold the entries of each row in ascending column
+        // order, so a linear pass matches them up.
+        std::size_t entryIndex = 0;
+        for (auto row = coarseLevelMatrix_->begin(), rowEnd = coarseLevelMatrix_->end(); row != rowEnd; ++row) {
+            for (auto entry = row->begin(), entryEnd = row->end(); entry != entryEnd; ++entry) {
+                (*entry) = coarseValuesHost_[entryIndex++];
+            }
+        }
+    }
+
+    void moveToCoarseLevel(const typename ParentType::FineRangeType& fine) override
+    {
+        // Restrict on the GPU; only the coarse-sized result is copied out.
+        detail::restrictVector<Scalar, transpose>(fine, *gpuRhs_, weights_, pressure_var_index_);
+        gpuRhs_->copyToHost(this->rhs_);
+
+        this->lhs_ = 0;
+    }
+
+    void moveToFineLevel(typename ParentType::FineDomainType& fine) override
+    {
+        // Copy the coarse-sized solution in and prolongate on the GPU.
+        gpuLhs_->copyFromHost(this->lhs_);
+        detail::prolongateVector<Scalar, transpose>(*gpuLhs_, fine, weights_, pressure_var_index_);
+    }
+
+    GpuToCpuPressureTransferPolicy* clone() const override
+    {
+        return new GpuToCpuPressureTransferPolicy(*this);
+    }
+
+    const Communication& getCoarseLevelCommunication() const
+    {
+        return *coarseLevelCommunication_;
+    }
+
+    std::size_t getPressureIndex() const
+    {
+        return pressure_var_index_;
+    }
+
+private:
+    Communication* communication_;
+    const FineVectorType& weights_;
+    const std::size_t pressure_var_index_;
+    std::shared_ptr<Communication> coarseLevelCommunication_;
+    std::shared_ptr<typename CoarseOperator::matrix_type> coarseLevelMatrix_;
+    std::shared_ptr<GpuSparseMatrixWrapper<Scalar>> gpuCoarseMatrix_;
+    std::shared_ptr<GpuVector<Scalar>> gpuRhs_;
+    std::shared_ptr<GpuVector<Scalar>> gpuLhs_;
+    std::vector<Scalar> coarseValuesHost_;
+};
+
+} // namespace Opm::gpuistl
+
+#endif // OPM_GPU_TO_CPU_PRESSURE_TRANSFER_POLICY_HEADER_INCLUDED
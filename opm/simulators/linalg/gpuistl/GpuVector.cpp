@@ -25,6 +25,7 @@
 #include <opm/simulators/linalg/gpuistl/detail/cublas_safe_call.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/cublas_wrapper.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/gpu_constants.hpp>
+#include <opm/simulators/linalg/gpuistl/detail/gpu_memory_pool.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/gpu_safe_call.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/vector_operations.hpp>
 
@@ -42,7 +43,7 @@ GpuVector<T>::GpuVector(const size_t numberOfElements)
     : m_numberOfElements(detail::to_int(numberOfElements))
     , m_cuBlasHandle(detail::CuBlasHandle::getInstance())
 {
-    OPM_GPU_SAFE_CALL(cudaMalloc(&m_dataOnDevice, sizeof(T) * detail::to_size_t(m_numberOfElements)));
+    m_dataOnDevice = static_cast<T*>(detail::allocateDevice(sizeof(T) * detail::to_size_t(m_numberOfElements)));
 }
 
 template <class T>
@@ -97,7 +98,7 @@ GpuVector<T>::GpuVector(const GpuVector<T>& other)
 template <class T>
 GpuVector<T>::~GpuVector()
 {
-    OPM_GPU_WARN_IF_ERROR(cudaFree(m_dataOnDevice));
+    detail::freeDevice(m_dataOnDevice);
 }
 
 template <typename T>
@@ -132,7 +133,7 @@ GpuVector<T>::resize(size_t new_size)
     if (new_elements == 0) {
         // Free existing memory and set to empty state
         if (m_dataOnDevice != nullptr) {
-            OPM_GPU_WARN_IF_ERROR(cudaFree(m_dataOnDevice));
+            detail::freeDevice(m_dataOnDevice);
             m_dataOnDevice = nullptr;
         }
         m_numberOfElements = 0;
@@ -140,8 +141,7 @@ GpuVector<T>::resize(size_t new_size)
     }
 
     // Allocate new memory
-    T* new_data = nullptr;
-    OPM_GPU_SAFE_CALL(cudaMalloc(&new_data, sizeof(T) * new_size));
+    T* new_data = static_cast<T*>(detail::allocateDevice(sizeof(T) * new_size));
 
     if (m_dataOnDevice != nullptr && m_numberOfElements > 0) {
         // Copy existing data (up to the minimum of old and new size)
@@ -153,7 +153,7 @@ GpuVector<T>::resize(size_t new_size)
         }
 
         // Free old memory
-        OPM_GPU_WARN_IF_ERROR(cudaFree(m_dataOnDevice));
+        detail::freeDevice(m_dataOnDevice);
     }
 
     m_dataOnDevice = new_data;
@@ -249,6 +249,28 @@ GpuVector<T>::two_norm() const
     return result;
 }
 
+template <class T>
+T
+GpuVector<T>::axpyDot(T alpha, const GpuVector<T>& y, const GpuVector<T>& z)
+{
+    assertHasElements();
+    assertSameSize(y);
+    assertSameSize(z);
+    GpuVector<T> resultBuffer(1);
+    return detail::fusedAxpyDot(data(), alpha, y.data(), z.data(), resultBuffer.data(), m_numberOfElements);
+}
+
+template <class T>
+T
+GpuVector<T>::axpyTwoNorm(T alpha, const GpuVector<T>& y)
+{
+    assertHasElements();
+    assertSameSize(y);
+    GpuVector<T> resultBuffer(1);
+    return std::sqrt(
+        detail::fusedAxpySquaredNorm(data(), alpha, y.data(), resultBuffer.data(), m_numberOfElements));
+}
+
 template <typename T>
 T
 GpuVector<T>::dot(const GpuVector<T>& other, const GpuVector<int>& indexSet, GpuVector<T>& buffer) const
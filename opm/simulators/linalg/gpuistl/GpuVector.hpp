@@ -418,6 +418,39 @@ public:
      */
     T two_norm() const;
 
+    /**
+     * @brief axpyDot sets this vector equal to this + alpha * y and returns the
+     * dot product of the updated vector with z
+     *
+     * Fuses the vector update and the reduction into a single kernel, saving
+     * one launch and one full pass over the data compared to axpy() followed
+     * by dot().  This matches the recurring update-then-reduce steps of the
+     * Krylov solvers, where small per-rank systems are launch-latency bound.
+     *
+     * @param alpha the scalar with which to multiply y
+     * @param y input vector of same size as this
+     * @param z the vector to compute the inner product of the updated vector with
+     * @note int is not supported
+     *
+     * @return the inner product of the updated vector with z
+     */
+    T axpyDot(T alpha, const GpuVector<T>& y, const GpuVector<T>& z);
+
+    /**
+     * @brief axpyTwoNorm sets this vector equal to this + alpha * y and
+     * returns the l2 norm of the updated vector
+     *
+     * Fuses the residual update and the convergence-check norm of the Krylov
+     * solvers into a single kernel; see axpyDot().
+     *
+     * @param alpha the scalar with which to multiply y
+     * @param y input vector of same size as this
+     * @note int is not supported
+     *
+     * @return the l2 norm of the updated vector
+     */
+    T axpyTwoNorm(T alpha, const GpuVector<T>& y);
+
     /**
      * Computes the dot product sum_i this[indexSet[i]] * other[indexSet[i]]
      *
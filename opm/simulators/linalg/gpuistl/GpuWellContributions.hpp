@@ -0,0 +1,194 @@
+/*
+  Copyright 2025 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_GPUISTL_GPUWELLCONTRIBUTIONS_HPP
+#define OPM_GPUISTL_GPUWELLCONTRIBUTIONS_HPP
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <opm/simulators/linalg/gpuistl/GpuVector.hpp>
+#include <opm/simulators/linalg/gpuistl/detail/safe_conversion.hpp>
+#include <opm/simulators/linalg/gpuistl/detail/wellContributionKernels.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace Opm::gpuistl
+{
+
+/**
+ * @brief Device-resident standard well contributions for the gpuistl solver stack
+ *
+ * Holds the B, C and (inverted) D blocks of a batch of standard wells on the
+ * device so the well part of the linearized system can be applied inside the
+ * GPU Krylov loop without moving x and y across PCIe. The intended usage is
+ * to rebuild the batch once per Newton iteration: call clear(), then addWell()
+ * for each standard well, then upload(); apply() can then be called once per
+ * Krylov iteration on device vectors.
+ *
+ * The storage layout matches the gpubridge WellContributions class: one
+ * row-major (dimWells x dim) block per perforation for B and C, one row-major
+ * (dimWells x dimWells) inverted block per well for D.
+ *
+ * @tparam Scalar the field type of the linear system (double or float)
+ */
+template <class Scalar>
+class GpuWellContributions
+{
+public:
+    /**
+     * @brief setBlockSizes sets the block dimensions of the well system
+     * @param dim block size of the reservoir system (number of conservation equations)
+     * @param dimWells number of well equations per well
+     *
+     * Must be called before the first addWell() and invalidates any wells
+     * added earlier.
+     */
+    void setBlockSizes(int dim, int dimWells)
+    {
+        m_dim = dim;
+        m_dimWells = dimWells;
+        clear();
+    }
+
+    /**
+     * @brief addWell appends one standard well to the host staging area
+     * @param Bvalues B block values, one (dimWells x dim) block per perforation
+     * @param Bcolumns the cell index of each B block
+     * @param Cvalues C block values, one (dimWells x dim) block per perforation
+     * @param Ccolumns the cell index of each C block
+     * @param invDvalues the inverted (dimWells x dimWells) D block of the well
+     */
+    void addWell(const std::vector<Scalar>& Bvalues,
+                 const std::vector<int>& Bcolumns,
+                 const std::vector<Scalar>& Cvalues,
+                 const std::vector<int>& Ccolumns,
+                 const std::vector<Scalar>& invDvalues)
+    {
+        if (m_dim == 0 || m_dimWells == 0) {
+            OPM_THROW(std::logic_error, "setBlockSizes() must be called before adding wells.");
+        }
+        const std::size_t blockSize = static_cast<std::size_t>(m_dim) * m_dimWells;
+        if (Bvalues.size() != Bcolumns.size() * blockSize || Cvalues.size() != Ccolumns.size() * blockSize
+            || Bcolumns.size() != Ccolumns.size()
+            || invDvalues.size() != static_cast<std::size_t>(m_dimWells) * m_dimWells) {
+            OPM_THROW(std::invalid_argument, "Inconsistent well block sizes.");
+        }
+        m_hostB.insert(m_hostB.end(), Bvalues.begin(), Bvalues.end());
+        m_hostBcols.insert(m_hostBcols.end(), Bcolumns.begin(), Bcolumns.end());
+        m_hostC.insert(m_hostC.end(), Cvalues.begin(), Cvalues.end());
+        m_hostCcols.insert(m_hostCcols.end(), Ccolumns.begin(), Ccolumns.end());
+        m_hostInvD.insert(m_hostInvD.end(), invDvalues.begin(), invDvalues.end());
+        m_hostValPointers.push_back(m_hostValPointers.back() + detail::to_int(Bcolumns.size()));
+        m_uploaded = false;
+    }
+
+    /**
+     * @brief upload transfers the staged wells to the device
+     *
+     * Should be called once per Newton iteration, after the last addWell().
+     */
+    void upload()
+    {
+        if (empty()) {
+            m_uploaded = true;
+            return;
+        }
+        m_deviceB = std::make_unique<GpuVector<Scalar>>(m_hostB);
+        m_deviceBcols = std::make_unique<GpuVector<int>>(m_hostBcols);
+        m_deviceC = std::make_unique<GpuVector<Scalar>>(m_hostC);
+        m_deviceCcols = std::make_unique<GpuVector<int>>(m_hostCcols);
+        m_deviceInvD = std::make_unique<GpuVector<Scalar>>(m_hostInvD);
+        m_deviceValPointers = std::make_unique<GpuVector<int>>(m_hostValPointers);
+        m_uploaded = true;
+    }
+
+    /**
+     * @brief apply subtracts the well contributions: y -= C^T * (D^-1 * (B * x))
+     * @param x the current Krylov iterate (device memory)
+     * @param y the operator result to modify (device memory)
+     */
+    void apply(const GpuVector<Scalar>& x, GpuVector<Scalar>& y) const
+    {
+        if (empty()) {
+            return;
+        }
+        if (!m_uploaded) {
+            OPM_THROW(std::logic_error, "upload() must be called before apply().");
+        }
+        detail::applyWellContributions(m_deviceC->data(),
+                                       m_deviceInvD->data(),
+                                       m_deviceB->data(),
+                                       m_deviceCcols->data(),
+                                       m_deviceBcols->data(),
+                                       x.data(),
+                                       y.data(),
+                                       m_dim,
+                                       m_dimWells,
+                                       numWells(),
+                                       m_deviceValPointers->data());
+    }
+
+    //! @brief numWells returns the number of wells currently in the batch
+    int numWells() const
+    {
+        return detail::to_int(m_hostValPointers.size() - 1);
+    }
+
+    //! @brief empty returns true if no wells have been added
+    bool empty() const
+    {
+        return numWells() == 0;
+    }
+
+    //! @brief clear removes all wells, keeping the block dimensions
+    void clear()
+    {
+        m_hostB.clear();
+        m_hostBcols.clear();
+        m_hostC.clear();
+        m_hostCcols.clear();
+        m_hostInvD.clear();
+        m_hostValPointers.assign(1, 0);
+        m_uploaded = false;
+    }
+
+private:
+    int m_dim = 0;
+    int m_dimWells = 0;
+    bool m_uploaded = false;
+
+    std::vector<Scalar> m_hostB;
+    std::vector<int> m_hostBcols;
+    std::vector<Scalar> m_hostC;
+    std::vector<int> m_hostCcols;
+    std::vector<Scalar> m_hostInvD;
+    std::vector<int> m_hostValPointers;
+
+    std::unique_ptr<GpuVector<Scalar>> m_deviceB;
+    std::unique_ptr<GpuVector<int>> m_deviceBcols;
+    std::unique_ptr<GpuVector<Scalar>> m_deviceC;
+    std::unique_ptr<GpuVector<int>> m_deviceCcols;
+    std::unique_ptr<GpuVector<Scalar>> m_deviceInvD;
+    std::unique_ptr<GpuVector<int>> m_deviceValPointers;
+};
+
+} // namespace Opm::gpuistl
+
+#endif
@@ -275,6 +275,11 @@ public:
                 const_cast<real_type*>(&x[0][0]),
                 x.dim()
             );
+        } else if (m_parameters.gpu_zero_initial_guess_) {
+            // With a zero initial guess the solution vector stays device
+            // resident between Newton iterations; only the converged update
+            // is copied back to the host below.
+            *m_x = 0;
         } else {
             // copy from host to device using main stream and asynchronous transfer
             m_x->copyFromHostAsync(x);
@@ -22,7 +22,6 @@
 #include <fmt/core.h>
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/common/TimingMacros.hpp>
-#include <opm/simulators/linalg/GraphColoring.hpp>
 #include <opm/simulators/linalg/gpuistl/GpuSparseMatrixWrapper.hpp>
 #include <opm/simulators/linalg/gpuistl/GpuVector.hpp>
 #include <opm/simulators/linalg/gpuistl/OpmGpuILU0.hpp>
@@ -40,7 +39,7 @@ namespace Opm::gpuistl
 
 template <class M, class X, class Y, int l>
 OpmGpuILU0<M, X, Y, l>::OpmGpuILU0(const OpmGpuILU0<M, X, Y, l>::matrix_type& gpuMatrix, const M& cpuMatrix, bool splitMatrix, bool tuneKernels, int mixedPrecisionScheme)
-    : m_levelSets(Opm::getMatrixRowColoring(cpuMatrix, Opm::ColoringType::LOWER))
+    : m_levelSets(detail::getGpuMatrixRowColoring(gpuMatrix))
     , m_reorderedToNatural(detail::createReorderedToNatural(m_levelSets))
     , m_naturalToReordered(detail::createNaturalToReordered(m_levelSets))
     , m_gpuMatrix(gpuMatrix)
@@ -267,8 +266,29 @@ template <class M, class X, class Y, int l>
 void
 OpmGpuILU0<M, X, Y, l>::update()
 {
-    reorderAndSplitMatrix(m_moveThreadBlockSize);
-    LUFactorizeMatrix(m_ILU0FactorizationThreadBlockSize);
+    // ensure that this stream only starts doing work when main stream is completed up to this point
+    OPM_GPU_SAFE_CALL(cudaEventRecord(m_before.get(), 0));
+    OPM_GPU_SAFE_CALL(cudaStreamWaitEvent(m_stream.get(), m_before.get(), 0));
+
+    // The update is a fixed kernel sequence on fixed buffers -- one
+    // launch per level set -- so it is captured once as a GPU graph and
+    // replayed on later Newton iterations, the same way apply()
+    // amortizes its launch latency.
+    if (!m_update_graph_captured) {
+        OPM_GPU_SAFE_CALL(cudaStreamBeginCapture(m_stream.get(), cudaStreamCaptureModeGlobal));
+
+        reorderAndSplitMatrix(m_moveThreadBlockSize);
+        LUFactorizeMatrix(m_ILU0FactorizationThreadBlockSize);
+
+        OPM_GPU_SAFE_CALL(cudaStreamEndCapture(m_stream.get(), &m_update_graph.get()));
+        OPM_GPU_SAFE_CALL(cudaGraphInstantiate(&m_update_graph_exec.get(), m_update_graph.get(), nullptr, nullptr, 0));
+        m_update_graph_captured = true;
+    }
+    OPM_GPU_SAFE_CALL(cudaGraphLaunch(m_update_graph_exec.get(), 0));
+
+    // ensure that main stream only continues after this stream is completed
+    OPM_GPU_SAFE_CALL(cudaEventRecord(m_after.get(), m_stream.get()));
+    OPM_GPU_SAFE_CALL(cudaStreamWaitEvent(0, m_after.get(), 0));
 }
 
 template <class M, class X, class Y, int l>
@@ -23,6 +23,7 @@
 #include <memory>
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/grid/utility/SparseTable.hpp>
+#include <opm/simulators/linalg/gpuistl/detail/gpusparse_matrix_operations.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/safe_conversion.hpp>
 #include <tuple>
 #include <vector>
@@ -33,6 +34,24 @@ extracting sparsity structures from dune matrices and creating gpusparsematrix i
 */
 namespace Opm::gpuistl::detail
 {
+/// Device side counterpart of Opm::getMatrixRowColoring(matrix, ColoringType::LOWER):
+/// the level sets are computed from the sparsity structure already residing on the GPU,
+/// so refreshing them after a topology change does not traverse the CPU matrix.
+template <class GPUM>
+inline Opm::SparseTable<std::size_t>
+getGpuMatrixRowColoring(const GPUM& gpuMatrix)
+{
+    std::vector<std::size_t> rowsByLevel;
+    std::vector<std::size_t> rowsPerLevel;
+    computeLowerLevelSets(gpuMatrix.getRowIndices().data(),
+                          gpuMatrix.getColumnIndices().data(),
+                          gpuMatrix.N(),
+                          rowsByLevel,
+                          rowsPerLevel);
+    return {rowsByLevel.data(), rowsByLevel.data() + rowsByLevel.size(),
+            rowsPerLevel.data(), rowsPerLevel.data() + rowsPerLevel.size()};
+}
+
 inline std::vector<int>
 createReorderedToNatural(const Opm::SparseTable<size_t>& levelSets)
 {
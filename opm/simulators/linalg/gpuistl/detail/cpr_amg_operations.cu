@@ -77,7 +77,11 @@ namespace
         }
     }
 
-    // Kernel to calculate matrix entries for the coarse level - processes each row in parallel
+    // Kernel to calculate matrix entries for the coarse level - processes each
+    // nonzero block in parallel. Consecutive threads read consecutive fine
+    // blocks and write consecutive coarse entries, keeping the accesses
+    // coalesced; a thread-per-row sweep leaves most of a warp idle on the
+    // short rows typical of reservoir grids.
     template <typename T, bool transpose>
     __global__ void calculateCoarseEntriesKernel(const T* fineNonZeroValues,
                                                  T* coarseNonZeroValues,
@@ -85,39 +89,44 @@ namespace
                                                  const int* rowIndices,
                                                  const int* colIndices,
                                                  const int numberOfRows,
+                                                 const int numberOfNonZeroes,
                                                  const int blockSize,
                                                  const int pressureVarIndex)
     {
-        // Each thread processes one row of the matrix
-        const auto row = blockDim.x * blockIdx.x + threadIdx.x;
+        const auto nnzIndex = blockDim.x * blockIdx.x + threadIdx.x;
 
-        if (row < numberOfRows) {
-            // Get start and end indices for this row
-            const int start = rowIndices[row];
-            const int end = rowIndices[row + 1];
-
-            // Process all non-zeros in this row
-            for (int i = start; i < end; i++) {
-                const int col = colIndices[i];
-                const int blockOffset = i * blockSize * blockSize;
-                T matrixEl = 0.0;
-
-                if constexpr (transpose) {
-                    // Use column weight
-                    const T* bw = weights + col * blockSize;
-                    for (int j = 0; j < blockSize; ++j) {
-                        matrixEl += fineNonZeroValues[blockOffset + pressureVarIndex * blockSize + j] * bw[j];
-                    }
-                } else {
-                    // Use row weight
-                    const T* bw = weights + row * blockSize;
-                    for (int j = 0; j < blockSize; ++j) {
-                        matrixEl += fineNonZeroValues[blockOffset + j * blockSize + pressureVarIndex] * bw[j];
+        if (nnzIndex < numberOfNonZeroes) {
+            const int blockOffset = nnzIndex * blockSize * blockSize;
+            T matrixEl = 0.0;
+
+            if constexpr (transpose) {
+                // Use column weight
+                const int col = colIndices[nnzIndex];
+                const T* bw = weights + col * blockSize;
+                for (int j = 0; j < blockSize; ++j) {
+                    matrixEl += fineNonZeroValues[blockOffset + pressureVarIndex * blockSize + j] * bw[j];
+                }
+            } else {
+                // Use row weight; recover the row of this nonzero as the
+                // last row whose start offset is <= nnzIndex by binary
+                // search in the row pointers.
+                int low = 0;
+                int high = numberOfRows;
+                while (high - low > 1) {
+                    const int mid = (low + high) / 2;
+                    if (rowIndices[mid] <= nnzIndex) {
+                        low = mid;
+                    } else {
+                        high = mid;
                     }
                 }
-
-                coarseNonZeroValues[i] = matrixEl;
+                const T* bw = weights + low * blockSize;
+                for (int j = 0; j < blockSize; ++j) {
+                    matrixEl += fineNonZeroValues[blockOffset + j * blockSize + pressureVarIndex] * bw[j];
+                }
             }
+
+            coarseNonZeroValues[nnzIndex] = matrixEl;
         }
     }
 
@@ -233,11 +242,10 @@ calculateCoarseEntries(const GpuSparseMatrixWrapper<T>& fineMatrix,
                        const GpuVector<T>& weights,
                        std::size_t pressureVarIndex)
 {
-    const int blockSize = fineMatrix.blockSize();
-    const int numberOfRows = fineMatrix.N();
+    const int numberOfNonZeroes = fineMatrix.nonzeroes();
 
     int threadBlockSize = getCudaRecomendedThreadBlockSize(calculateCoarseEntriesKernel<T, transpose>);
-    int nThreadBlocks = getNumberOfBlocks(numberOfRows, threadBlockSize);
+    int nThreadBlocks = getNumberOfBlocks(numberOfNonZeroes, threadBlockSize);
 
     calculateCoarseEntriesKernel<T, transpose>
         <<<nThreadBlocks, threadBlockSize>>>(fineMatrix.getNonZeroValues().data(),
@@ -246,6 +254,7 @@ calculateCoarseEntries(const GpuSparseMatrixWrapper<T>& fineMatrix,
                                              fineMatrix.getRowIndices().data(),
                                              fineMatrix.getColumnIndices().data(),
                                              fineMatrix.N(),
+                                             numberOfNonZeroes,
                                              fineMatrix.blockSize(),
                                              pressureVarIndex);
 }
@@ -0,0 +1,164 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <opm/simulators/linalg/gpuistl/detail/gpu_memory_pool.hpp>
+
+#include <opm/simulators/linalg/gpuistl/detail/gpu_safe_call.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm::gpuistl::detail
+{
+
+namespace
+{
+    // Checks once whether the current device supports stream-ordered
+    // allocation, and if so raises the release threshold of its default
+    // memory pool so that freed blocks are kept for reuse instead of being
+    // returned to the driver (which would reintroduce the implicit
+    // synchronization we are trying to avoid).
+    bool
+    streamOrderedAllocationSupported()
+    {
+        static const bool supported = [] {
+            int device = 0;
+            if (cudaGetDevice(&device) != cudaSuccess) {
+                return false;
+            }
+            int hasPools = 0;
+            if (cudaDeviceGetAttribute(&hasPools, cudaDevAttrMemoryPoolsSupported, device) != cudaSuccess
+                || hasPools == 0) {
+                return false;
+            }
+            cudaMemPool_t pool = nullptr;
+            OPM_GPU_SAFE_CALL(cudaDeviceGetDefaultMemPool(&pool, device));
+            std::uint64_t releaseThreshold = UINT64_MAX;
+            OPM_GPU_SAFE_CALL(cudaMemPoolSetAttribute(pool, cudaMemPoolAttrReleaseThreshold, &releaseThreshold));
+            return true;
+        }();
+        return supported;
+    }
+
+    // The pinned pool buckets requests by the next power of two so that
+    // slightly varying sizes (e.g. after a well is added) still hit the
+    // free lists. Blocks stay pinned for the lifetime of the process; the
+    // amount of memory retained is bounded by the high-water mark of
+    // concurrently live pinned allocations.
+    struct PinnedPool {
+        std::mutex mutex;
+        std::map<std::size_t, std::vector<void*>> freeLists;
+        std::unordered_map<void*, std::size_t> bucketOfPointer;
+    };
+
+    PinnedPool&
+    pinnedPool()
+    {
+        static PinnedPool pool;
+        return pool;
+    }
+
+    std::size_t
+    bucketSize(std::size_t numberOfBytes)
+    {
+        std::size_t bucket = 256;
+        while (bucket < numberOfBytes) {
+            bucket *= 2;
+        }
+        return bucket;
+    }
+} // namespace
+
+void*
+allocateDevice(std::size_t numberOfBytes)
+{
+    void* ptr = nullptr;
+    if (streamOrderedAllocationSupported()) {
+        OPM_GPU_SAFE_CALL(cudaMallocAsync(&ptr, numberOfBytes, 0));
+    } else {
+        OPM_GPU_SAFE_CALL(cudaMalloc(&ptr, numberOfBytes));
+    }
+    return ptr;
+}
+
+void
+freeDevice(void* ptr) noexcept
+{
+    if (ptr == nullptr) {
+        return;
+    }
+    if (streamOrderedAllocationSupported()) {
+        OPM_GPU_WARN_IF_ERROR(cudaFreeAsync(ptr, 0));
+    } else {
+        OPM_GPU_WARN_IF_ERROR(cudaFree(ptr));
+    }
+}
+
+void*
+allocatePinned(std::size_t numberOfBytes)
+{
+    if (numberOfBytes == 0) {
+        return nullptr;
+    }
+
+    const std::size_t bucket = bucketSize(numberOfBytes);
+    auto& pool = pinnedPool();
+
+    {
+        const std::lock_guard<std::mutex> guard(pool.mutex);
+        auto& freeList = pool.freeLists[bucket];
+        if (!freeList.empty()) {
+            void* recycled = freeList.back();
+            freeList.pop_back();
+            return recycled;
+        }
+    }
+
+    void* ptr = nullptr;
+    OPM_GPU_SAFE_CALL(cudaHostAlloc(&ptr, bucket, cudaHostAllocDefault));
+
+    const std::lock_guard<std::mutex> guard(pool.mutex);
+    pool.bucketOfPointer[ptr] = bucket;
+    return ptr;
+}
+
+void
+freePinned(void* ptr) noexcept
+{
+    if (ptr == nullptr) {
+        return;
+    }
+
+    auto& pool = pinnedPool();
+    const std::lock_guard<std::mutex> guard(pool.mutex);
+    const auto position = pool.bucketOfPointer.find(ptr);
+    if (position == pool.bucketOfPointer.end()) {
+        // Not ours: the pointer came from a plain cudaHostAlloc, so release
+        // it directly rather than corrupting the free lists.
+        OPM_GPU_WARN_IF_ERROR(cudaFreeHost(ptr));
+        return;
+    }
+    pool.freeLists[position->second].push_back(ptr);
+}
+
+} // namespace Opm::gpuistl::detail
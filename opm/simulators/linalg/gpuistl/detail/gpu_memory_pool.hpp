@@ -0,0 +1,76 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_GPUISTL_GPU_MEMORY_POOL_HPP
+#define OPM_GPUISTL_GPU_MEMORY_POOL_HPP
+
+#include <cstddef>
+
+namespace Opm::gpuistl::detail
+{
+
+/**
+ * @brief allocateDevice allocates device memory from a stream-ordered memory pool
+ * @param numberOfBytes number of bytes to allocate
+ * @return pointer to device memory (never nullptr for a non-zero request)
+ *
+ * On devices supporting stream-ordered allocation (cudaMallocAsync), the
+ * allocation is served from the device's default memory pool whose release
+ * threshold has been raised so that freed blocks are retained for reuse. This
+ * means steady-state Newton iterations that repeatedly create and destroy
+ * vectors of the same sizes perform no allocator calls and trigger no implicit
+ * device synchronization. Falls back to plain cudaMalloc when the device does
+ * not support memory pools.
+ *
+ * @note Memory obtained from this function must be released with freeDevice().
+ */
+void* allocateDevice(std::size_t numberOfBytes);
+
+/**
+ * @brief freeDevice returns device memory obtained from allocateDevice to the pool
+ * @param ptr pointer obtained from allocateDevice (nullptr is a no-op)
+ *
+ * @note Safe to call from destructors: errors are logged, not thrown.
+ */
+void freeDevice(void* ptr) noexcept;
+
+/**
+ * @brief allocatePinned allocates page-locked host memory from a size-bucketed pool
+ * @param numberOfBytes number of bytes to allocate
+ * @return pointer to pinned host memory (never nullptr for a non-zero request)
+ *
+ * cudaHostAlloc/cudaHostRegister are expensive operations that synchronize the
+ * device; this pool keeps freed blocks on per-size free lists so that repeated
+ * host staging buffers of the same sizes are recycled without touching the
+ * CUDA runtime.
+ *
+ * @note Memory obtained from this function must be released with freePinned().
+ */
+void* allocatePinned(std::size_t numberOfBytes);
+
+/**
+ * @brief freePinned returns pinned host memory obtained from allocatePinned to the pool
+ * @param ptr pointer obtained from allocatePinned (nullptr is a no-op)
+ *
+ * @note Safe to call from destructors: errors are logged, not thrown.
+ */
+void freePinned(void* ptr) noexcept;
+
+} // namespace Opm::gpuistl::detail
+
+#endif
@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include <config.h>
+#include <algorithm>
 #include <opm/common/ErrorMacros.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/gpusparse_matrix_operations.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/deviceBlockOperations.hpp>
@@ -97,6 +98,25 @@ namespace
         }
     }
 
+    __global__ void cuAssignLowerLevels(
+        const int* rowIndices, const int* columnIndices, int* levels, int* changed, size_t numberOfRows)
+    {
+        const auto row = blockDim.x * blockIdx.x + threadIdx.x;
+        if (row < numberOfRows) {
+            int level = 0;
+            for (int block = rowIndices[row]; block < rowIndices[row + 1]; ++block) {
+                const auto col = columnIndices[block];
+                if (col < static_cast<int>(row) && levels[col] >= level) {
+                    level = levels[col] + 1;
+                }
+            }
+            if (level > levels[row]) {
+                levels[row] = level;
+                *changed = 1;
+            }
+        }
+    }
+
     template <class T>
     __global__ void cuComputeDiagPtrs(const int* rowIndices,
                                       const int* colIndices,
@@ -166,6 +186,58 @@ copyMatDataToReorderedSplit(const T* srcMatrix,
                                                                                  numberOfRows);
 }
 
+void
+computeLowerLevelSets(const int* rowIndices,
+                      const int* columnIndices,
+                      size_t numberOfRows,
+                      std::vector<size_t>& rowsByLevel,
+                      std::vector<size_t>& rowsPerLevel)
+{
+    rowsByLevel.clear();
+    rowsPerLevel.clear();
+    if (numberOfRows == 0) {
+        return;
+    }
+
+    GpuBuffer<int> levels(std::vector<int>(numberOfRows, 0));
+    GpuBuffer<int> changed(1);
+
+    int threadBlockSize = ::Opm::gpuistl::detail::getCudaRecomendedThreadBlockSize(cuAssignLowerLevels);
+    int nThreadBlocks = ::Opm::gpuistl::detail::getNumberOfBlocks(numberOfRows, threadBlockSize);
+
+    // Relax until a sweep no longer raises any level. The number of sweeps is bounded by the
+    // number of levels, and each sweep is a single kernel launch over all rows.
+    int changedOnHost = 1;
+    while (changedOnHost != 0) {
+        OPM_GPU_SAFE_CALL(cudaMemset(changed.data(), 0, sizeof(int)));
+        cuAssignLowerLevels<<<nThreadBlocks, threadBlockSize>>>(
+            rowIndices, columnIndices, levels.data(), changed.data(), numberOfRows);
+        OPM_GPU_SAFE_CALL(cudaMemcpy(&changedOnHost, changed.data(), sizeof(int), cudaMemcpyDeviceToHost));
+    }
+
+    // Group the rows by level, keeping natural order within each level like the host
+    // implementation in GraphColoring.hpp does.
+    const auto levelOfRow = levels.asStdVector();
+    const int numberOfLevels = *std::max_element(levelOfRow.begin(), levelOfRow.end()) + 1;
+
+    rowsPerLevel.assign(numberOfLevels, 0);
+    for (const auto level : levelOfRow) {
+        ++rowsPerLevel[level];
+    }
+
+    std::vector<size_t> nextInLevel(numberOfLevels, 0);
+    size_t offset = 0;
+    for (int level = 0; level < numberOfLevels; ++level) {
+        nextInLevel[level] = offset;
+        offset += rowsPerLevel[level];
+    }
+
+    rowsByLevel.resize(numberOfRows);
+    for (size_t row = 0; row < numberOfRows; ++row) {
+        rowsByLevel[nextInLevel[levelOfRow[row]]++] = row;
+    }
+}
+
 template <class T>
 GpuBuffer<T*>
 getDiagPtrs(GpuSparseMatrixWrapper<T>& matrix)
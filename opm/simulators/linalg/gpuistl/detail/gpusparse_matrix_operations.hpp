@@ -20,6 +20,7 @@
 #define OPM_GPUISTL_GPUSPARSE_MATRIX_OPERATIONS_HPP
 
 #include <cstddef>
+#include <vector>
 #include <opm/simulators/linalg/gpuistl/GpuBuffer.hpp>
 #include <opm/simulators/linalg/gpuistl/GpuSparseMatrixWrapper.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/gpuThreadUtils.hpp>
@@ -77,6 +78,26 @@ void copyMatDataToReorderedSplit(const T* srcMatrix,
                                  size_t numberOfRows,
                                  int threadBlockSize);
 
+/**
+ * @brief Computes the lower triangular level sets of a matrix from its sparsity structure on the GPU
+ * @param rowIndices Pointer to vector on GPU containing row indices compliant with bsr format
+ * @param columnIndices Pointer to vector on GPU containing column indices compliant with bsr format
+ * @param numberOfRows The number of rows in the matrix
+ * @param [out] rowsByLevel The rows of the matrix grouped by level, in natural order within each level
+ * @param [out] rowsPerLevel The number of rows in each level
+ *
+ * The level of a row is one more than the largest level among the rows it depends on through
+ * entries left of the diagonal, so all rows within one level can be processed concurrently in
+ * a triangular solve. The levels are computed by repeated relaxation sweeps on the GPU; only
+ * the per-row levels are copied back to the host, the sparsity structure itself is never
+ * traversed there.
+ */
+void computeLowerLevelSets(const int* rowIndices,
+                           const int* columnIndices,
+                           size_t numberOfRows,
+                           std::vector<size_t>& rowsByLevel,
+                           std::vector<size_t>& rowsPerLevel);
+
 /**
  * @brief Return the pointers to diagonal elements in a GpuBuffer
  * @param matrix The matrix to extract diagonal pointers from
@@ -0,0 +1,124 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+#include <opm/simulators/linalg/gpuistl/detail/gpuThreadUtils.hpp>
+#include <opm/simulators/linalg/gpuistl/detail/spmvBlockKernels.hpp>
+
+#include <cstddef>
+
+namespace Opm::gpuistl::detail
+{
+
+namespace
+{
+    // One group per block row. The group size is a warp on NVIDIA hardware;
+    // on AMD hardware it is half a wavefront, which still gives coalesced
+    // loads of the block values. Correctness only relies on __syncthreads(),
+    // not on the groups mapping exactly onto hardware warps.
+    constexpr int groupSize = 32;
+    constexpr int spmvThreadBlockSize = 256;
+
+    template <class T, int blocksize>
+    __global__ void blockSpMVKernel(T alpha,
+                                    const T* nonZeroElements,
+                                    const int* rowIndices,
+                                    const int* columnIndices,
+                                    const T* x,
+                                    T beta,
+                                    T* y,
+                                    int numberOfRows)
+    {
+        // Lane l of a group works on row (l % blocksize) of nonzero block
+        // (l / blocksize) within the block row; the group strides over the
+        // blocks of the row blocksPerGroup at a time. For blocksize 5 the
+        // last two lanes of each group are idle.
+        constexpr int blocksPerGroup = groupSize / blocksize;
+
+        __shared__ T staging[spmvThreadBlockSize];
+
+        const int row = static_cast<int>(blockDim.x * blockIdx.x + threadIdx.x) / groupSize;
+        const int lane = threadIdx.x % groupSize;
+        const int blockInGroup = lane / blocksize;
+        const int rowInBlock = lane % blocksize;
+
+        T sum = 0;
+        if (row < numberOfRows && blockInGroup < blocksPerGroup) {
+            const int rowEnd = rowIndices[row + 1];
+            for (int block = rowIndices[row] + blockInGroup; block < rowEnd; block += blocksPerGroup) {
+                const T* localBlock
+                    = nonZeroElements + static_cast<std::size_t>(block) * blocksize * blocksize;
+                const T* localX = x + static_cast<std::size_t>(columnIndices[block]) * blocksize;
+
+                for (int c = 0; c < blocksize; ++c) {
+                    sum += localBlock[rowInBlock * blocksize + c] * localX[c];
+                }
+            }
+        }
+
+        staging[threadIdx.x] = sum;
+        __syncthreads();
+
+        // The first blocksize lanes of each group own one row of the result
+        // block each and fold in the partial sums of the remaining lanes.
+        if (row < numberOfRows && lane < blocksize) {
+            const int groupStart = threadIdx.x - lane;
+
+            T total = 0;
+            for (int b = 0; b < blocksPerGroup; ++b) {
+                total += staging[groupStart + b * blocksize + lane];
+            }
+
+            const std::size_t yIndex = static_cast<std::size_t>(row) * blocksize + lane;
+            y[yIndex] = alpha * total + beta * y[yIndex];
+        }
+    }
+} // namespace
+
+template <class T, int blocksize>
+void
+blockSpMV(T alpha,
+          const T* nonZeroElements,
+          const int* rowIndices,
+          const int* columnIndices,
+          const T* x,
+          T beta,
+          T* y,
+          std::size_t numberOfRows)
+{
+    if (numberOfRows == 0) {
+        return;
+    }
+
+    const int wantedThreads = static_cast<int>(numberOfRows) * groupSize;
+    const int nThreadBlocks = getNumberOfBlocks(wantedThreads, spmvThreadBlockSize);
+
+    blockSpMVKernel<T, blocksize><<<nThreadBlocks, spmvThreadBlockSize>>>(
+        alpha, nonZeroElements, rowIndices, columnIndices, x, beta, y, static_cast<int>(numberOfRows));
+}
+
+template void blockSpMV<float, 4>(
+    float, const float*, const int*, const int*, const float*, float, float*, std::size_t);
+template void blockSpMV<float, 5>(
+    float, const float*, const int*, const int*, const float*, float, float*, std::size_t);
+template void blockSpMV<double, 4>(
+    double, const double*, const int*, const int*, const double*, double, double*, std::size_t);
+template void blockSpMV<double, 5>(
+    double, const double*, const int*, const int*, const double*, double, double*, std::size_t);
+
+} // namespace Opm::gpuistl::detail
@@ -0,0 +1,293 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_GPUISTL_TPFA_ASSEMBLY_KERNELS_HPP
+#define OPM_GPUISTL_TPFA_ASSEMBLY_KERNELS_HPP
+
+#include <opm/common/utility/gpuDecorators.hpp>
+
+#include <opm/grid/utility/SparseTable.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/// \file
+/// \brief Device kernels for TPFA residual and Jacobian assembly.
+///
+/// These kernels are the device-side counterpart of
+/// TpfaLinearizer::linearizeCell_: one thread per cell computes the flux
+/// terms towards its neighbors (and the accumulation term) and scatters
+/// values and derivatives into the BSR value array of a GpuSparseMatrix
+/// and into a block residual vector. The scatter pattern mirrors the CPU
+/// assembly: a cell writes its own residual entry and diagonal block, and
+/// the coupling block (neighbor row, own column), so every matrix block is
+/// written by exactly one thread and no atomics are needed.
+///
+/// The kernels are templates over the GPU-instantiable model types (the
+/// local residual, intensive quantities and module parameters); they are
+/// intended to be instantiated from a translation unit compiled with the
+/// GPU compiler that knows the concrete simulator types, with the
+/// intensive quantities mirrored on the device and the neighbor
+/// information converted with the copy_to_gpu overloads in
+/// tpfalinearizer.hh. Source, boundary and well terms as well as the
+/// flows/dispersion output paths remain on the CPU.
+
+namespace Opm::gpuistl::detail
+{
+
+/// \brief Compute the Jacobian scatter offsets for the TPFA assembly kernels.
+///
+/// For each cell this returns the BSR block index of its diagonal block,
+/// and for each (cell, neighbor) pair, parallel to the rows of \p
+/// neighborInfo, the block index of the coupling block (neighbor row, cell
+/// column) that the cell's thread writes; the flat vector shares the row
+/// partitioning of \p neighborInfo and is meant to be wrapped in a
+/// parallel SparseTable before upload. \p rowIndices and \p columnIndices
+/// are the BSR structure of the Jacobian on the host; the offsets only
+/// depend on the sparsity pattern and can be reused until the matrix
+/// structure changes.
+template <class NeighborInfo>
+std::pair<std::vector<int>, std::vector<int>>
+computeTpfaScatterOffsets(const SparseTable<NeighborInfo>& neighborInfo,
+                          const std::vector<int>& rowIndices,
+                          const std::vector<int>& columnIndices)
+{
+    const int numCells = static_cast<int>(neighborInfo.size());
+    std::vector<int> diagOffsets(numCells, -1);
+    std::vector<int> nbOffsets;
+    nbOffsets.reserve(neighborInfo.dataSize());
+
+    const auto findBlock = [&](const int row, const int col) {
+        for (int candidate = rowIndices[row]; candidate < rowIndices[row + 1]; ++candidate) {
+            if (columnIndices[candidate] == col) {
+                return candidate;
+            }
+        }
+        return -1;
+    };
+
+    for (int globI = 0; globI < numCells; ++globI) {
+        diagOffsets[globI] = findBlock(globI, globI);
+        for (const auto& nbInfo : neighborInfo[globI]) {
+            nbOffsets.push_back(findBlock(static_cast<int>(nbInfo.neighbor), globI));
+        }
+    }
+    return {std::move(diagOffsets), std::move(nbOffsets)};
+}
+
+} // namespace Opm::gpuistl::detail
+
+#if HAVE_CUDA && OPM_IS_COMPILING_WITH_GPU_COMPILER
+
+#if USE_HIP
+#include <opm/simulators/linalg/gpuistl_hip/GpuView.hpp>
+#include <opm/simulators/linalg/gpuistl_hip/MiniMatrix.hpp>
+#include <opm/simulators/linalg/gpuistl_hip/MiniVector.hpp>
+#include <opm/simulators/linalg/gpuistl_hip/detail/gpuThreadUtils.hpp>
+#include <opm/simulators/linalg/gpuistl_hip/detail/gpu_safe_call.hpp>
+#else
+#include <opm/simulators/linalg/gpuistl/GpuView.hpp>
+#include <opm/simulators/linalg/gpuistl/MiniMatrix.hpp>
+#include <opm/simulators/linalg/gpuistl/MiniVector.hpp>
+#include <opm/simulators/linalg/gpuistl/detail/gpuThreadUtils.hpp>
+#include <opm/simulators/linalg/gpuistl/detail/gpu_safe_call.hpp>
+#endif
+
+namespace Opm::gpuistl::detail
+{
+
+//! \brief Device version of TpfaLinearizer::setResAndJacobi: extract the
+//! value and derivatives of an AD residual into a residual block and a
+//! dense Jacobian block.
+template <int numEq, class Scalar, class ADVectorBlock>
+OPM_HOST_DEVICE void
+setResAndJacobi(MiniVector<Scalar, numEq>& res,
+                MiniMatrix<Scalar, numEq>& bMat,
+                const ADVectorBlock& resid)
+{
+    for (int eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+        res[eqIdx] = resid[eqIdx].value();
+        for (int pvIdx = 0; pvIdx < numEq; ++pvIdx) {
+            bMat[eqIdx][pvIdx] = resid[eqIdx].derivative(pvIdx);
+        }
+    }
+}
+
+namespace kernels
+{
+
+//! \brief Flux-term linearization, one thread per cell.
+//!
+//! Each thread computes the fluxes from its cell towards all neighbors,
+//! accumulates its own residual entry and diagonal block, and subtracts
+//! the flux derivatives from the coupling block (neighbor row, own
+//! column) given by \p nbOffsets, which is a table parallel to \p
+//! neighborInfo. \p jacNonzeroes is the BSR value array of the Jacobian
+//! with numEq x numEq blocks and \p residual holds numEq entries per
+//! cell; both must be zeroed (or hold the partial assembly of other
+//! terms for other cells) before the launch.
+template <class LocalResidual, class Evaluation, int numEq,
+          class IntensiveQuantities, class NeighborInfo, class ModuleParams, class Scalar>
+__global__ void
+linearizeFluxTerms(const SparseTable<NeighborInfo, GpuView> neighborInfo,
+                   const GpuView<const int> cells,
+                   const GpuView<const IntensiveQuantities> intQuants,
+                   const GpuView<const int> diagOffsets,
+                   const SparseTable<int, GpuView> nbOffsets,
+                   Scalar* jacNonzeroes,
+                   Scalar* residual,
+                   const ModuleParams moduleParams)
+{
+    const auto idx = blockDim.x * blockIdx.x + threadIdx.x;
+    if (idx >= cells.size()) {
+        return;
+    }
+    const unsigned globI = cells[idx];
+    const IntensiveQuantities intQuantsIn = intQuants[globI];
+    constexpr int blockSize = numEq * numEq;
+    Scalar* const diagBlock = jacNonzeroes + static_cast<std::size_t>(diagOffsets[globI]) * blockSize;
+
+    MiniVector<Scalar, numEq> res;
+    MiniMatrix<Scalar, numEq> bMat;
+    const auto nbInfos = neighborInfo[globI];
+    const auto nbOffsetsRow = nbOffsets[globI];
+    for (std::size_t loc = 0; loc < nbInfos.size(); ++loc) {
+        const auto& nbInfo = nbInfos[loc];
+        const unsigned globJ = nbInfo.neighbor;
+        MiniVector<Evaluation, numEq> adres(Evaluation(0.0));
+        MiniVector<Evaluation, numEq> darcyFlux(Evaluation(0.0));
+        const IntensiveQuantities intQuantsEx = intQuants[globJ];
+        LocalResidual::computeFlux(adres, darcyFlux, globI, globJ,
+                                   intQuantsIn, intQuantsEx,
+                                   nbInfo.res_nbinfo, moduleParams);
+        for (int eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+            adres[eqIdx] *= nbInfo.res_nbinfo.faceArea;
+        }
+        setResAndJacobi<numEq>(res, bMat, adres);
+
+        for (int eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+            residual[globI * numEq + eqIdx] += res[eqIdx];
+        }
+        Scalar* const couplingBlock
+            = jacNonzeroes + static_cast<std::size_t>(nbOffsetsRow[loc]) * blockSize;
+        for (int eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+            for (int pvIdx = 0; pvIdx < numEq; ++pvIdx) {
+                diagBlock[eqIdx * numEq + pvIdx] += bMat[eqIdx][pvIdx];
+                couplingBlock[eqIdx * numEq + pvIdx] -= bMat[eqIdx][pvIdx];
+            }
+        }
+    }
+}
+
+//! \brief Accumulation-term linearization, one thread per cell.
+//!
+//! Computes (storage(iq) - storageOld) * volume / dt for each cell and
+//! adds it to the residual and diagonal block. \p storageOld holds the
+//! cached start-of-step storage (numEq entries per cell), corresponding
+//! to the storage-cache path of the CPU assembly.
+template <class LocalResidual, class Evaluation, int numEq,
+          class IntensiveQuantities, class Scalar>
+__global__ void
+linearizeStorageTerms(const GpuView<const int> cells,
+                      const GpuView<const IntensiveQuantities> intQuants,
+                      const GpuView<const Scalar> storageOld,
+                      const GpuView<const Scalar> dofVolumes,
+                      const Scalar dt,
+                      const GpuView<const int> diagOffsets,
+                      Scalar* jacNonzeroes,
+                      Scalar* residual)
+{
+    const auto idx = blockDim.x * blockIdx.x + threadIdx.x;
+    if (idx >= cells.size()) {
+        return;
+    }
+    const unsigned globI = cells[idx];
+    constexpr int blockSize = numEq * numEq;
+    Scalar* const diagBlock = jacNonzeroes + static_cast<std::size_t>(diagOffsets[globI]) * blockSize;
+    const Scalar storefac = dofVolumes[globI] / dt;
+
+    MiniVector<Evaluation, numEq> adres(Evaluation(0.0));
+    const IntensiveQuantities intQuantsIn = intQuants[globI];
+    LocalResidual::template computeStorage<Evaluation>(adres, intQuantsIn);
+
+    MiniVector<Scalar, numEq> res;
+    MiniMatrix<Scalar, numEq> bMat;
+    setResAndJacobi<numEq>(res, bMat, adres);
+
+    for (int eqIdx = 0; eqIdx < numEq; ++eqIdx) {
+        residual[globI * numEq + eqIdx]
+            += (res[eqIdx] - storageOld[globI * numEq + eqIdx]) * storefac;
+        for (int pvIdx = 0; pvIdx < numEq; ++pvIdx) {
+            diagBlock[eqIdx * numEq + pvIdx] += bMat[eqIdx][pvIdx] * storefac;
+        }
+    }
+}
+
+} // namespace kernels
+
+//! \brief Launch the flux-term linearization kernel for the given cells.
+template <class LocalResidual, class Evaluation, int numEq,
+          class IntensiveQuantities, class NeighborInfo, class ModuleParams, class Scalar>
+void
+linearizeFluxTerms(const SparseTable<NeighborInfo, GpuView>& neighborInfo,
+                   const GpuView<const int>& cells,
+                   const GpuView<const IntensiveQuantities>& intQuants,
+                   const GpuView<const int>& diagOffsets,
+                   const SparseTable<int, GpuView>& nbOffsets,
+                   Scalar* jacNonzeroes,
+                   Scalar* residual,
+                   const ModuleParams& moduleParams,
+                   int suggestedThrBlockSize = -1)
+{
+    auto kernel = kernels::linearizeFluxTerms<LocalResidual, Evaluation, numEq,
+                                              IntensiveQuantities, NeighborInfo, ModuleParams, Scalar>;
+    const int threadBlockSize = getCudaRecomendedThreadBlockSize(kernel, suggestedThrBlockSize);
+    const int nThreadBlocks = getNumberOfBlocks(cells.size(), threadBlockSize);
+    kernel<<<nThreadBlocks, threadBlockSize>>>(neighborInfo, cells, intQuants,
+                                               diagOffsets, nbOffsets,
+                                               jacNonzeroes, residual, moduleParams);
+}
+
+//! \brief Launch the accumulation-term linearization kernel for the given cells.
+template <class LocalResidual, class Evaluation, int numEq,
+          class IntensiveQuantities, class Scalar>
+void
+linearizeStorageTerms(const GpuView<const int>& cells,
+                      const GpuView<const IntensiveQuantities>& intQuants,
+                      const GpuView<const Scalar>& storageOld,
+                      const GpuView<const Scalar>& dofVolumes,
+                      const Scalar dt,
+                      const GpuView<const int>& diagOffsets,
+                      Scalar* jacNonzeroes,
+                      Scalar* residual,
+                      int suggestedThrBlockSize = -1)
+{
+    auto kernel = kernels::linearizeStorageTerms<LocalResidual, Evaluation, numEq,
+                                                 IntensiveQuantities, Scalar>;
+    const int threadBlockSize = getCudaRecomendedThreadBlockSize(kernel, suggestedThrBlockSize);
+    const int nThreadBlocks = getNumberOfBlocks(cells.size(), threadBlockSize);
+    kernel<<<nThreadBlocks, threadBlockSize>>>(cells, intQuants, storageOld, dofVolumes,
+                                               dt, diagOffsets, jacNonzeroes, residual);
+}
+
+} // namespace Opm::gpuistl::detail
+
+#endif // HAVE_CUDA && OPM_IS_COMPILING_WITH_GPU_COMPILER
+
+#endif // OPM_GPUISTL_TPFA_ASSEMBLY_KERNELS_HPP
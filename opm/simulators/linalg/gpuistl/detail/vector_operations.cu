@@ -24,6 +24,7 @@
 #include <opm/simulators/linalg/gpuistl/detail/gpu_safe_call.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/gpuThreadUtils.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/vector_operations.hpp>
+#include <algorithm>
 #include <stdexcept>
 namespace Opm::gpuistl::detail
 {
@@ -102,6 +103,63 @@ namespace
             a[indices[globalIndex]] = buffer[globalIndex];
         }
     }
+
+    // thread block size of the fused update/reduction kernels; must be a power of two
+    // for the shared memory tree reduction below
+    constexpr int fusedReductionBlockSize = 256;
+
+    template <class T>
+    __device__ void blockReduceAndAccumulate(T localSum, T* result)
+    {
+        __shared__ T partial[fusedReductionBlockSize];
+        partial[threadIdx.x] = localSum;
+        __syncthreads();
+
+        for (int stride = fusedReductionBlockSize / 2; stride > 0; stride /= 2) {
+            if (threadIdx.x < stride) {
+                partial[threadIdx.x] += partial[threadIdx.x + stride];
+            }
+            __syncthreads();
+        }
+
+        if (threadIdx.x == 0) {
+            atomicAdd(result, partial[0]);
+        }
+    }
+
+    template <class T>
+    __global__ void fusedAxpyDotKernel(T* x, const T alpha, const T* y, const T* z, size_t numberOfElements, T* result)
+    {
+        T localSum = 0;
+        for (size_t i = blockDim.x * blockIdx.x + threadIdx.x; i < numberOfElements;
+             i += static_cast<size_t>(blockDim.x) * gridDim.x) {
+            const T updated = x[i] + alpha * y[i];
+            x[i] = updated;
+            localSum += updated * z[i];
+        }
+        blockReduceAndAccumulate(localSum, result);
+    }
+
+    template <class T>
+    __global__ void
+    fusedAxpySquaredNormKernel(T* x, const T alpha, const T* y, size_t numberOfElements, T* result)
+    {
+        T localSum = 0;
+        for (size_t i = blockDim.x * blockIdx.x + threadIdx.x; i < numberOfElements;
+             i += static_cast<size_t>(blockDim.x) * gridDim.x) {
+            const T updated = x[i] + alpha * y[i];
+            x[i] = updated;
+            localSum += updated * updated;
+        }
+        blockReduceAndAccumulate(localSum, result);
+    }
+
+    // cap the grid so that the atomic accumulation stays cheap on large vectors
+    int fusedReductionBlocks(size_t numberOfElements)
+    {
+        const int blocks = ::Opm::gpuistl::detail::getNumberOfBlocks(numberOfElements, fusedReductionBlockSize);
+        return std::min(blocks, 1024);
+    }
 } // namespace
 
 template <class T>
@@ -217,4 +275,36 @@ weightedDiagMV(const T* squareBlockVector,
 template void weightedDiagMV(const double*, const size_t, const size_t, double, const double*, double*);
 template void weightedDiagMV(const float*, const size_t, const size_t, float, const float*, float*);
 
+template <class T>
+T
+fusedAxpyDot(T* x, T alpha, const T* y, const T* z, T* resultBuffer, size_t numberOfElements)
+{
+    OPM_GPU_SAFE_CALL(cudaMemset(resultBuffer, 0, sizeof(T)));
+    fusedAxpyDotKernel<<<fusedReductionBlocks(numberOfElements), fusedReductionBlockSize>>>(
+        x, alpha, y, z, numberOfElements, resultBuffer);
+    T result = 0;
+    OPM_GPU_SAFE_CALL(cudaMemcpy(&result, resultBuffer, sizeof(T), cudaMemcpyDeviceToHost));
+    return result;
+}
+
+template double fusedAxpyDot(double*, double, const double*, const double*, double*, size_t);
+template float fusedAxpyDot(float*, float, const float*, const float*, float*, size_t);
+template int fusedAxpyDot(int*, int, const int*, const int*, int*, size_t);
+
+template <class T>
+T
+fusedAxpySquaredNorm(T* x, T alpha, const T* y, T* resultBuffer, size_t numberOfElements)
+{
+    OPM_GPU_SAFE_CALL(cudaMemset(resultBuffer, 0, sizeof(T)));
+    fusedAxpySquaredNormKernel<<<fusedReductionBlocks(numberOfElements), fusedReductionBlockSize>>>(
+        x, alpha, y, numberOfElements, resultBuffer);
+    T result = 0;
+    OPM_GPU_SAFE_CALL(cudaMemcpy(&result, resultBuffer, sizeof(T), cudaMemcpyDeviceToHost));
+    return result;
+}
+
+template double fusedAxpySquaredNorm(double*, double, const double*, double*, size_t);
+template float fusedAxpySquaredNorm(float*, float, const float*, float*, size_t);
+template int fusedAxpySquaredNorm(int*, int, const int*, int*, size_t);
+
 } // namespace Opm::gpuistl::detail
@@ -85,6 +85,34 @@ void weightedDiagMV(const T* squareBlockVector,
                     const T* srcVec,
                     T* dstVec);
 
+/**
+ * @brief fusedAxpyDot computes x += alpha * y followed by the inner product of the updated x with z in one kernel
+ * @param x the vector to update (device memory)
+ * @param alpha the scalar with which to multiply y
+ * @param y the vector to add (device memory)
+ * @param z the vector to compute the inner product of the updated x with (device memory)
+ * @param resultBuffer a buffer of one element receiving the reduction result (device memory)
+ * @param numberOfElements number of elements in each vector
+ * @return the inner product of the updated x with z
+ *
+ * @note Fusing the update with the reduction saves one kernel launch and one full
+ *       pass over the vector data compared to an AXPY followed by a dot product.
+ */
+template <class T>
+T fusedAxpyDot(T* x, T alpha, const T* y, const T* z, T* resultBuffer, size_t numberOfElements);
+
+/**
+ * @brief fusedAxpySquaredNorm computes x += alpha * y followed by the squared l2 norm of the updated x in one kernel
+ * @param x the vector to update (device memory)
+ * @param alpha the scalar with which to multiply y
+ * @param y the vector to add (device memory)
+ * @param resultBuffer a buffer of one element receiving the reduction result (device memory)
+ * @param numberOfElements number of elements in each vector
+ * @return the squared l2 norm of the updated x
+ */
+template <class T>
+T fusedAxpySquaredNorm(T* x, T alpha, const T* y, T* resultBuffer, size_t numberOfElements);
+
 } // namespace Opm::gpuistl::detail
 
 #endif
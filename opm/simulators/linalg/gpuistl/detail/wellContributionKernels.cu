@@ -0,0 +1,138 @@
+/*
+  Copyright 2025 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include <config.h>
+#include <opm/simulators/linalg/gpuistl/detail/gpu_safe_call.hpp>
+#include <opm/simulators/linalg/gpuistl/detail/wellContributionKernels.hpp>
+
+namespace Opm::gpuistl::detail
+{
+
+namespace
+{
+    // One thread block per well: z1 = B * x, z2 = D^-1 * z1, y -= C^T * z2.
+    // Unlike the warp-shuffle kernel in gpubridge this makes no assumption
+    // on dim/dimWells, it only needs 2 * dimWells scalars of shared memory.
+    template <class T>
+    __global__ void applyWellContributionsKernel(const T* __restrict__ Cnnzs,
+                                                 const T* __restrict__ Dnnzs,
+                                                 const T* __restrict__ Bnnzs,
+                                                 const int* __restrict__ Ccols,
+                                                 const int* __restrict__ Bcols,
+                                                 const T* __restrict__ x,
+                                                 T* __restrict__ y,
+                                                 const int dim,
+                                                 const int dimWells,
+                                                 const int* __restrict__ valPointers)
+    {
+        const unsigned int well = blockIdx.x;
+        const unsigned int blockStart = valPointers[well];
+        const unsigned int blockEnd = valPointers[well + 1];
+        const int blocksPerWellBlock = dim * dimWells;
+
+        extern __shared__ unsigned char sharedMemory[];
+        T* z1 = reinterpret_cast<T*>(sharedMemory); // dimWells entries
+        T* z2 = z1 + dimWells;                      // dimWells entries
+
+        // z1 = B * x
+        for (int r = threadIdx.x; r < dimWells; r += blockDim.x) {
+            T sum = 0.0;
+            for (unsigned int b = blockStart; b < blockEnd; ++b) {
+                const int cell = Bcols[b];
+                for (int c = 0; c < dim; ++c) {
+                    sum += Bnnzs[b * blocksPerWellBlock + r * dim + c] * x[cell * dim + c];
+                }
+            }
+            z1[r] = sum;
+        }
+
+        __syncthreads();
+
+        // z2 = D^-1 * z1
+        for (int r = threadIdx.x; r < dimWells; r += blockDim.x) {
+            T sum = 0.0;
+            for (int c = 0; c < dimWells; ++c) {
+                sum += Dnnzs[well * dimWells * dimWells + r * dimWells + c] * z1[c];
+            }
+            z2[r] = sum;
+        }
+
+        __syncthreads();
+
+        // y -= C^T * z2, one thread per (perforation block, column) pair
+        const unsigned int numEntries = (blockEnd - blockStart) * dim;
+        for (unsigned int i = threadIdx.x; i < numEntries; i += blockDim.x) {
+            const unsigned int b = blockStart + i / dim;
+            const int c = i % dim;
+            T sum = 0.0;
+            for (int r = 0; r < dimWells; ++r) {
+                sum += Cnnzs[b * blocksPerWellBlock + r * dim + c] * z2[r];
+            }
+            y[Ccols[b] * dim + c] -= sum;
+        }
+    }
+} // namespace
+
+template <class T>
+void
+applyWellContributions(const T* Cnnzs,
+                       const T* Dnnzs,
+                       const T* Bnnzs,
+                       const int* Ccols,
+                       const int* Bcols,
+                       const T* x,
+                       T* y,
+                       int dim,
+                       int dimWells,
+                       int numWells,
+                       const int* valPointers)
+{
+    if (numWells == 0) {
+        return;
+    }
+    constexpr int threadBlockSize = 64;
+    const int sharedMemorySize = 2 * dimWells * sizeof(T);
+    applyWellContributionsKernel<<<numWells, threadBlockSize, sharedMemorySize>>>(
+        Cnnzs, Dnnzs, Bnnzs, Ccols, Bcols, x, y, dim, dimWells, valPointers);
+    OPM_GPU_SAFE_CALL(cudaGetLastError());
+}
+
+template void applyWellContributions(const double*,
+                                     const double*,
+                                     const double*,
+                                     const int*,
+                                     const int*,
+                                     const double*,
+                                     double*,
+                                     int,
+                                     int,
+                                     int,
+                                     const int*);
+template void applyWellContributions(const float*,
+                                     const float*,
+                                     const float*,
+                                     const int*,
+                                     const int*,
+                                     const float*,
+                                     float*,
+                                     int,
+                                     int,
+                                     int,
+                                     const int*);
+
+} // namespace Opm::gpuistl::detail
@@ -0,0 +1,61 @@
+/*
+  Copyright 2025 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_GPUISTL_WELLCONTRIBUTIONKERNELS_HPP
+#define OPM_GPUISTL_WELLCONTRIBUTIONKERNELS_HPP
+
+namespace Opm::gpuistl::detail
+{
+
+/**
+ * @brief applyWellContributions computes y -= C^T * (D^-1 * (B * x)) for a batch of standard wells
+ *
+ * All wells are processed in a single kernel launch, one thread block per
+ * well. The block layout matches the gpubridge WellContributions storage:
+ * B and C hold one (dimWells x dim) block per perforation in row-major
+ * order, D holds one inverted (dimWells x dimWells) block per well, and
+ * valPointers gives the [start, end) perforation block range of each well.
+ *
+ * @param Cnnzs the C block values (device memory)
+ * @param Dnnzs the inverted D block values (device memory)
+ * @param Bnnzs the B block values (device memory)
+ * @param Ccols the cell index of each C block (device memory)
+ * @param Bcols the cell index of each B block (device memory)
+ * @param x the vector to apply the wells to (device memory)
+ * @param y the vector to subtract the well contributions from (device memory)
+ * @param dim the block size of the reservoir system
+ * @param dimWells the number of well equations per well
+ * @param numWells the number of wells in the batch
+ * @param valPointers the perforation block ranges, numWells + 1 entries (device memory)
+ */
+template <class T>
+void applyWellContributions(const T* Cnnzs,
+                            const T* Dnnzs,
+                            const T* Bnnzs,
+                            const int* Ccols,
+                            const int* Bcols,
+                            const T* x,
+                            T* y,
+                            int dim,
+                            int dimWells,
+                            int numWells,
+                            const int* valPointers);
+
+} // namespace Opm::gpuistl::detail
+
+#endif
@@ -31,6 +31,8 @@
 #include <dune/common/fmatrix.hh>
 #include <dune/common/version.hh>
 
+#include <opm/models/utils/hugepages.hpp>
+
 namespace Opm {
 namespace Linear {
 
@@ -98,6 +100,21 @@ public:
                 istlMatrix_->addindex(dofIdx, *nIt);
         }
         istlMatrix_->endindices();
+
+        // The matrix values are the largest single allocation of the
+        // simulation and are swept linearly in every linearization and
+        // every matrix-vector product, so ask for huge page backing.
+        // BCRSMatrix stores all blocks in one contiguous array once the
+        // sparsity pattern is complete.
+        if (HugePages::enabled() && istlMatrix_->nonzeroes() > 0) {
+            for (auto rowIt = istlMatrix_->begin(); rowIt != istlMatrix_->end(); ++rowIt) {
+                if (rowIt->begin() != rowIt->end()) {
+                    HugePages::advise(&(*rowIt->begin()),
+                                      istlMatrix_->nonzeroes() * sizeof(MatrixBlock));
+                    break;
+                }
+            }
+        }
     }
 
     /*!
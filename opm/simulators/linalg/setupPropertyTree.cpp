@@ -111,10 +111,14 @@ namespace
     }
 #endif
 
-    // Decide and configure the GPU AMG backend. Throws if none available.
+    // Decide and configure the GPU AMG backend.  When \p allowCpuAmg is
+    // set (the CPR coarse solver), a missing GPU backend falls back to
+    // Dune AMG on the CPU -- the hybrid CPU+GPU CPR mode; otherwise the
+    // absence of a GPU backend is an error.
     inline void setupGpuAmgBackend(PropertyTree& prm,
                                    const std::string& typeKey,
-                                   [[maybe_unused]] const std::string& root)
+                                   const std::string& root,
+                                   const bool allowCpuAmg = false)
     {
         using namespace std::string_literals;
 
@@ -146,6 +150,20 @@ namespace
 #endif
         }
 
+        if (requested == "cpuamg") {
+            // Hybrid mode: keep the fine-level smoother on the GPU and run
+            // Dune AMG for the coarse pressure system on the CPU.  Only the
+            // block-size-1 coarse system is transferred between the devices.
+            if (!allowCpuAmg) {
+                OPM_THROW(std::invalid_argument,
+                          "The CPU AMG backend is only available as the CPR coarse solver.");
+            }
+            OpmLog::info("\nUsing CPU Dune AMG for the coarse pressure solve (hybrid CPU+GPU CPR)\n");
+            prm.put(typeKey, "amg"s);
+            setupDuneAMG(prm, root);
+            return;
+        }
+
 #if HAVE_AMGX
         OpmLog::info("\nAuto-selecting AMGX for GPU AMG backend\n");
         prm.put(typeKey, "amgx"s);
@@ -158,12 +176,26 @@ namespace
         setupHypreAMG(prm, root, true);
         return;
 #else
+        if (allowCpuAmg) {
+            OpmLog::info("\nNo GPU AMG backend available (Hypre is built without GPU support); "
+                         "running Dune AMG for the coarse pressure solve on the CPU (hybrid CPU+GPU CPR)\n");
+            prm.put(typeKey, "amg"s);
+            setupDuneAMG(prm, root);
+            return;
+        }
         OPM_THROW(std::invalid_argument,
                   "GPU accelerator selected, but Hypre is built without GPU support. "
                   "Enable AMGX or build Hypre with CUDA/HIP, or use a different preconditioner (e.g., DILU by setting "
                   "--linear-solver=dilu).");
 #endif
 #else
+        if (allowCpuAmg) {
+            OpmLog::info("\nNo GPU AMG backend available; running Dune AMG for the coarse "
+                         "pressure solve on the CPU (hybrid CPU+GPU CPR)\n");
+            prm.put(typeKey, "amg"s);
+            setupDuneAMG(prm, root);
+            return;
+        }
         OPM_THROW(std::invalid_argument,
                   "GPU accelerator selected, but no GPU AMG backend is available. "
                   "Enable AMGX or build Hypre with CUDA/HIP, or use a different preconditioner (e.g., DILU by setting "
@@ -339,8 +371,10 @@ setupCPR(const std::string& conf, const FlowLinearSolverParameters& p)
     prm.put("preconditioner.coarsesolver.verbosity", 0);
     // Choose coarsesolver AMG backend based on accelerator backend and available AMG backends
     if (p.linear_solver_accelerator_ == Parameters::LinearSolverAcceleratorType::GPU) {
-        setupGpuAmgBackend(
-            prm, "preconditioner.coarsesolver.preconditioner.type", "preconditioner.coarsesolver.preconditioner.");
+        setupGpuAmgBackend(prm,
+                           "preconditioner.coarsesolver.preconditioner.type",
+                           "preconditioner.coarsesolver.preconditioner.",
+                           /*allowCpuAmg=*/true);
         return prm;
     } else {
         prm.put("preconditioner.coarsesolver.preconditioner.type", "amg"s);
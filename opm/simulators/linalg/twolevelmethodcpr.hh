@@ -467,6 +467,16 @@ public:
     updatePreconditioner(smoother, coarsePolicy);
   }
 
+  void updateSmootherOnly(std::shared_ptr<SmootherType> smoother)
+  {
+    // Refresh only the finest level; the coarse level system and its
+    // solver are kept frozen. This is much cheaper than a full
+    // updatePreconditioner() and is adequate as long as the coarse
+    // hierarchy is still a good approximation of the current matrix.
+    smoother_ = smoother;
+    smoother_->update();
+  }
+
   void updatePreconditioner(std::shared_ptr<SmootherType> smoother,
                             CoarseLevelSolverPolicy& coarsePolicy)
   {
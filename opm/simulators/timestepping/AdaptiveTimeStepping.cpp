@@ -95,6 +95,11 @@ consistentlyFailingWells(const std::vector<StepReport>& sr, bool requireRepeated
 void registerAdaptiveParameters()
 {
     // TODO: make sure the help messages are correct (and useful)
+    Parameters::Register<Parameters::SolverAdaptiveRestartFactor>
+        ("Adjust the restart factor after a convergence failure based on the "
+         "convergence trajectory of the failed attempt: retry with a milder "
+         "chop when the attempt was close to converging, and with a harder "
+         "chop when it diverged");
     Parameters::Register<Parameters::SolverContinueOnConvergenceFailure>
         ("Continue instead of stop when minimum solver time step is reached");
     Parameters::Register<Parameters::SolverMaxRestarts>
@@ -117,6 +122,7 @@ void registerAdaptiveParameters()
          "'iterationcount', "
          "'newtoniterationcount', "
          "'general3rdorder', "
+         "'residualhistory', "
          "and 'hardcoded'");
     Parameters::Register<Parameters::TimeStepControlTolerance>
         ("The tolerance used by the time step size control algorithm");
@@ -164,6 +170,10 @@ void registerAdaptiveParameters()
     Parameters::Register<Parameters::TimeStepControlParameters>
         ("Only applicable for the general 3rd order controller. Parameters for the general "
          "3rd order controller. Should be given as 'beta_1;beta_2;beta_3;alpha_2;alpha_3'");
+    Parameters::Register<Parameters::TimeStepControlHistoryWindowSize>
+        ("Only applicable for the residual history controller. The number of completed "
+         "substeps whose Newton convergence histories are kept to predict the next "
+         "time step size");
 }
 
 std::tuple<TimeStepControlType, std::unique_ptr<TimeStepControlInterface>, bool>
@@ -267,6 +277,22 @@ createController(const UnitSystem& unitSystem)
                  false
              };
         }},
+        {"residualhistory",
+         [verbose]() {
+             const int iterations = Parameters::Get<Parameters::TimeStepControlTargetNewtonIterations>();
+             const double decayrate = Parameters::Get<Parameters::TimeStepControlDecayRate>();
+             const double growthrate = Parameters::Get<Parameters::TimeStepControlGrowthRate>();
+             const int windowSize = Parameters::Get<Parameters::TimeStepControlHistoryWindowSize>();
+             return RetVal{
+                 TimeStepControlType::ResidualHistory,
+                 std::make_unique<ResidualHistoryTimeStepControl>(iterations,
+                                                                  decayrate,
+                                                                  growthrate,
+                                                                  windowSize,
+                                                                  verbose),
+                 true
+             };
+         }},
         {"hardcoded",
          []() {
              const std::string filename = Parameters::Get<Parameters::TimeStepControlFileName>();
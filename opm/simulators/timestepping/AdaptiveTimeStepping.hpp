@@ -28,6 +28,7 @@
 
 namespace Opm::Parameters {
 
+struct SolverAdaptiveRestartFactor { static constexpr bool value = false; };
 struct SolverContinueOnConvergenceFailure { static constexpr bool value = false; };
 struct SolverMaxRestarts { static constexpr int value = 10; };
 struct SolverVerbosity { static constexpr int value = 1; };
@@ -50,6 +51,7 @@ struct TimeStepControlRejectCompletedStep { static constexpr bool value = false;
 struct TimeStepControlToleranceTestVersion { static constexpr auto value = "standard"; };
 struct TimeStepControlMaxReductionTimeStep { static constexpr double value = 0.1; };
 struct TimeStepControlParameters { static constexpr auto value = "0.125;0.25;0.125;0.75;0.25"; };
+struct TimeStepControlHistoryWindowSize { static constexpr int value = 5; };
 
 } // namespace Opm::Parameters
 
@@ -160,7 +162,9 @@ private:
         double maxGrowth_() const;
         double minTimeStepBeforeClosingWells_() const;
         double minTimeStep_() const;
+        bool adaptiveRestartFactor_() const;
         double restartFactor_() const;
+        double restartFactorFromFailedAttempt_(const double default_factor) const;
         SimulatorReportSingle runSubStep_();
         int solverRestartMax_() const;
         double suggestedNextTimestep_() const;
@@ -230,6 +234,7 @@ public:
     static AdaptiveTimeStepping<TypeTag> serializationTestObjectPIDIt();
     static AdaptiveTimeStepping<TypeTag> serializationTestObjectSimple();
     static AdaptiveTimeStepping<TypeTag> serializationTestObject3rdOrder();
+    static AdaptiveTimeStepping<TypeTag> serializationTestObjectResidualHistory();
 
 private:
     void maybeModifySuggestedTimeStepAtBeginningOfReportStep_(const double original_time_step,
@@ -253,6 +258,7 @@ protected:
     TimeStepControlType time_step_control_type_{TimeStepControlType::PIDAndIterationCount};
     TimeStepController time_step_control_{}; //!< time step control object
     double restart_factor_{};                //!< factor to multiply time step with when solver fails to converge
+    bool adaptive_restart_factor_{false};    //!< adjust the restart factor from the failed attempt's convergence history
     double growth_factor_{};                 //!< factor to multiply time step when solver recovered from failed convergence
     double max_growth_{};                    //!< factor that limits the maximum growth of a time step
     double max_time_step_{};                 //!< maximal allowed time step size in days
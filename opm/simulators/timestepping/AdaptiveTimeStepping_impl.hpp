@@ -43,6 +43,7 @@
 
 #include <opm/models/utils/parametersystem.hpp>
 
+#include <opm/simulators/timestepping/ConvergenceReport.hpp>
 #include <opm/simulators/timestepping/EclTimeSteppingParams.hpp>
 
 #include <algorithm>
@@ -70,6 +71,7 @@ AdaptiveTimeStepping(const UnitSystem& unit_system,
 )
     : time_step_control_{}
     , restart_factor_{Parameters::Get<Parameters::SolverRestartFactor<Scalar>>()} // 0.33
+    , adaptive_restart_factor_{Parameters::Get<Parameters::SolverAdaptiveRestartFactor>()} // false
     , growth_factor_{Parameters::Get<Parameters::SolverGrowthFactor<Scalar>>()} // 2.0
     , max_growth_{Parameters::Get<Parameters::SolverMaxGrowth<Scalar>>()} // 3.0
     , max_time_step_{
@@ -112,6 +114,7 @@ AdaptiveTimeStepping(double max_next_tstep,
 )
     : time_step_control_{}
     , restart_factor_{tuning.TSFCNV}
+    , adaptive_restart_factor_{Parameters::Get<Parameters::SolverAdaptiveRestartFactor>()} // false
     , growth_factor_{tuning.TFDIFF}
     , max_growth_{tuning.TSFMAX}
     , max_time_step_{tuning.TSMAXZ} // 365.25
@@ -161,10 +164,14 @@ operator==(const AdaptiveTimeStepping<TypeTag>& rhs) const
     case TimeStepControlType::General3rdOrder:
         result = castAndComp<General3rdOrderController>(rhs);
         break;
+    case TimeStepControlType::ResidualHistory:
+        result = castAndComp<ResidualHistoryTimeStepControl>(rhs);
+        break;
     }
 
     return result &&
            this->restart_factor_ == rhs.restart_factor_ &&
+           this->adaptive_restart_factor_ == rhs.adaptive_restart_factor_ &&
            this->growth_factor_ == rhs.growth_factor_ &&
            this->max_growth_ == rhs.max_growth_ &&
            this->max_time_step_ == rhs.max_time_step_ &&
@@ -234,8 +241,12 @@ serializeOp(Serializer& serializer)
     case TimeStepControlType::General3rdOrder:
         allocAndSerialize<General3rdOrderController>(serializer);
         break;
+    case TimeStepControlType::ResidualHistory:
+        allocAndSerialize<ResidualHistoryTimeStepControl>(serializer);
+        break;
     }
     serializer(this->restart_factor_);
+    serializer(this->adaptive_restart_factor_);
     serializer(this->growth_factor_);
     serializer(this->max_growth_);
     serializer(this->max_time_step_);
@@ -299,6 +310,14 @@ serializationTestObject3rdOrder()
     return serializationTestObject_<General3rdOrderController>();
 }
 
+template<class TypeTag>
+AdaptiveTimeStepping<TypeTag>
+AdaptiveTimeStepping<TypeTag>::
+serializationTestObjectResidualHistory()
+{
+    return serializationTestObject_<ResidualHistoryTimeStepControl>();
+}
+
 
 template<class TypeTag>
 void
@@ -407,6 +426,7 @@ serializationTestObject_()
     AdaptiveTimeStepping<TypeTag> result;
 
     result.restart_factor_ = 1.0;
+    result.adaptive_restart_factor_ = true;
     result.growth_factor_ = 2.0;
     result.max_growth_ = 3.0;
     result.max_time_step_ = 4.0;
@@ -853,6 +873,9 @@ run()
             checkTimeStepMaxRestartLimit_(restarts);
 
             double new_time_step = restartFactor_() * dt;
+            if (adaptiveRestartFactor_() && !substep_report.time_step_rejected) {
+                new_time_step = restartFactorFromFailedAttempt_(restartFactor_()) * dt;
+            }
             if (substep_report.time_step_rejected) {
                 const double tol = Parameters::Get<Parameters::TimeStepControlTolerance>();
                 const double safetyFactor = Parameters::Get<Parameters::TimeStepControlSafetyFactor>();
@@ -1231,6 +1254,66 @@ restartFactor_() const
     return this->adaptive_time_stepping_.restart_factor_;
 }
 
+template<class TypeTag>
+template<class Solver>
+bool
+AdaptiveTimeStepping<TypeTag>::SubStepIteration<Solver>::
+adaptiveRestartFactor_() const
+{
+    return this->adaptive_time_stepping_.adaptive_restart_factor_;
+}
+
+// Choose the chop factor for the retry from the convergence trajectory of
+// the attempt that just failed.  An attempt that was still contracting and
+// close to the tolerances is very likely to succeed after a mild chop, which
+// saves redoing most of its work; an attempt that diverged gets a harder
+// chop right away instead of burning a second failed attempt on an
+// intermediate step size.
+template<class TypeTag>
+template<class Solver>
+double
+AdaptiveTimeStepping<TypeTag>::SubStepIteration<Solver>::
+restartFactorFromFailedAttempt_(const double default_factor) const
+{
+    // distance-to-convergence of a Newton iterate in decades, as used by the
+    // convergence monitor
+    auto distance = [](const ConvergenceReport& report) {
+        double d = 0.0;
+        for (const auto& metric : report.reservoirConvergence()) {
+            if (metric.tolerance() > 0.0) {
+                d += std::max(std::log10(metric.value() / metric.tolerance()), 0.0);
+            }
+        }
+        return d;
+    };
+
+    const auto& step_reports = solver_().model().stepReports();
+    if (step_reports.empty() || step_reports.back().report.size() < 2) {
+        return default_factor;
+    }
+
+    const auto& reports = step_reports.back().report;
+    const double last = distance(reports.back());
+    const double previous = distance(reports[reports.size() - 2]);
+
+    double factor = default_factor;
+    if (last < 0.5 && last < previous) {
+        // nearly converged and still contracting
+        factor = std::max(default_factor, 0.5);
+    }
+    else if (last > previous) {
+        // diverging
+        factor = std::min(default_factor, 0.25);
+    }
+
+    if (solverVerbose_() && factor != default_factor) {
+        OpmLog::debug(fmt::format("Adjusted restart factor from failed attempt: {} "
+                                  "(distance to convergence {:.2f} -> {:.2f} decades)",
+                                  factor, previous, last));
+    }
+    return factor;
+}
+
 template<class TypeTag>
 template<class Solver>
 SimulatorReportSingle
@@ -1365,6 +1448,17 @@ AdaptiveTimeStepping<TypeTag>::SubStepIteration<Solver>::
 timeStepControlComputeEstimate_(const double dt, const int iterations,
                                 const AdaptiveSimulatorTimer& substepTimer) const
 {
+    // the residual history controller additionally inspects the per-iteration
+    // convergence reports of the substep that just completed
+    if (this->adaptive_time_stepping_.time_step_control_type_ == TimeStepControlType::ResidualHistory) {
+        const auto& step_reports = solver_().model().stepReports();
+        if (! step_reports.empty()) {
+            static_cast<const ResidualHistoryTimeStepControl*>
+                (this->adaptive_time_stepping_.time_step_control_.get())
+                    ->recordConvergenceHistory(dt, iterations, step_reports.back().report);
+        }
+    }
+
     // create object to compute the time error, simply forwards the call to the model
     const SolutionTimeErrorSolverWrapper<Solver> relative_change{solver_()};
     return this->adaptive_time_stepping_.time_step_control_->computeTimeStepSize(
@@ -34,9 +34,10 @@ namespace Opm
     {
         return SimulatorReportSingle{1.0, 2.0, 3.0, 4.0, 5.0, 6.0,
                                      7.0, 8.0, 9.0, 10.0, 11.0, 12.0,
+                                     12.1, 12.2, 12.3, 12.4, 12.5,
                                      13, 14, 15, 16, 17, 18,
                                      true, false, false, 19, 20.0, 21.0,
-                                     22, 23, 24, 25, 26, 27, 28, 29};
+                                     22, 23, 24, 25, 26, 27, 28, 29, 30};
     }
 
     bool SimulatorReportSingle::operator==(const SimulatorReportSingle& rhs) const
@@ -53,6 +54,11 @@ namespace Opm
                this->local_solve_time == rhs.local_solve_time &&
                this->update_time == rhs.update_time &&
                this->output_write_time == rhs.output_write_time &&
+               this->comm_wait_assembly == rhs.comm_wait_assembly &&
+               this->comm_wait_wells == rhs.comm_wait_wells &&
+               this->comm_wait_linear_solve == rhs.comm_wait_linear_solve &&
+               this->comm_wait_output == rhs.comm_wait_output &&
+               this->comm_wait_other == rhs.comm_wait_other &&
                this->total_well_iterations == rhs.total_well_iterations &&
                this->total_linearizations == rhs.total_linearizations &&
                this->total_newton_iterations == rhs.total_newton_iterations &&
@@ -72,7 +78,8 @@ namespace Opm
                this->converged_domains == rhs.converged_domains &&
                this->unconverged_domains == rhs.unconverged_domains &&
                this->accepted_unconverged_domains == rhs.accepted_unconverged_domains &&
-               this->skipped_domains == rhs.skipped_domains;
+               this->skipped_domains == rhs.skipped_domains &&
+               this->convergence_sweeps == rhs.convergence_sweeps;
     }
 
     void SimulatorReportSingle::operator+=(const SimulatorReportSingle& sr)
@@ -88,6 +95,11 @@ namespace Opm
         assemble_time_well += sr.assemble_time_well;
         update_time += sr.update_time;
         output_write_time += sr.output_write_time;
+        comm_wait_assembly += sr.comm_wait_assembly;
+        comm_wait_wells += sr.comm_wait_wells;
+        comm_wait_linear_solve += sr.comm_wait_linear_solve;
+        comm_wait_output += sr.comm_wait_output;
+        comm_wait_other += sr.comm_wait_other;
         total_time += sr.total_time;
         total_well_iterations += sr.total_well_iterations;
         total_linearizations += sr.total_linearizations;
@@ -102,6 +114,7 @@ namespace Opm
         unconverged_domains += sr.unconverged_domains;
         accepted_unconverged_domains += sr.accepted_unconverged_domains;
         skipped_domains += sr.skipped_domains;
+        convergence_sweeps += sr.convergence_sweeps;
         // It makes no sense adding time points. Therefore, do not
         // overwrite the value of global_time which gets set in
         // NonlinearSolver.hpp by the line:
@@ -209,6 +222,21 @@ namespace Opm
             os << fmt::format("  Output write time:          {:7.2f} s",
                               output_write_time + (failureReport ? failureReport->output_write_time : 0.0));
             os << std::endl;
+
+            const double wait_assembly = comm_wait_assembly + (failureReport ? failureReport->comm_wait_assembly : 0.0);
+            const double wait_wells = comm_wait_wells + (failureReport ? failureReport->comm_wait_wells : 0.0);
+            const double wait_linear = comm_wait_linear_solve + (failureReport ? failureReport->comm_wait_linear_solve : 0.0);
+            const double wait_output = comm_wait_output + (failureReport ? failureReport->comm_wait_output : 0.0);
+            const double wait_other = comm_wait_other + (failureReport ? failureReport->comm_wait_other : 0.0);
+            const double comm_wait = wait_assembly + wait_wells + wait_linear + wait_output + wait_other;
+            if (comm_wait > 0.0) {
+                os << fmt::format("  Comm/wait time:             {:7.2f} s "
+                                  "(assembly {:.2f}, wells {:.2f}, linear {:.2f}, "
+                                  "output {:.2f}, other {:.2f})",
+                                  comm_wait, wait_assembly, wait_wells,
+                                  wait_linear, wait_output, wait_other);
+                os << std::endl;
+            }
         }
 
         int n = total_linearizations + (failureReport ? failureReport->total_linearizations : 0);
@@ -333,6 +361,9 @@ namespace Opm
         }
         os << std::endl;
         os << fmt::format("-------------------------------------------------------\n");
+        n = convergence_sweeps + (failureReport ? failureReport->convergence_sweeps : 0);
+        os << fmt::format("Convergence sweeps:          {:7}", n);
+        os << std::endl;
         n = skipped_domains + (failureReport ? failureReport->skipped_domains : 0);
         os << fmt::format("Skipped domain solves:       {:7}", n);
         os << std::endl;
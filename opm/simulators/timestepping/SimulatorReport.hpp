@@ -45,6 +45,16 @@ namespace Opm
         double update_time = 0.0;
         double output_write_time = 0.0;
 
+        // Time spent in instrumented communication calls, attributed to
+        // the subsystem that was active at the call site; see
+        // Parallel::WaitTimes. On an imbalanced run the slow subsystem
+        // shows up as wait time on the other ranks.
+        double comm_wait_assembly = 0.0;
+        double comm_wait_wells = 0.0;
+        double comm_wait_linear_solve = 0.0;
+        double comm_wait_output = 0.0;
+        double comm_wait_other = 0.0;
+
         unsigned int total_well_iterations = 0;
         unsigned int total_linearizations = 0;
         unsigned int total_newton_iterations = 0;
@@ -69,6 +79,7 @@ namespace Opm
         int unconverged_domains = 0;
         int accepted_unconverged_domains = 0;
         int skipped_domains = 0;
+        int convergence_sweeps = 0;
 
         static SimulatorReportSingle serializationTestObject();
 
@@ -95,6 +106,11 @@ namespace Opm
             serializer(local_solve_time);
             serializer(update_time);
             serializer(output_write_time);
+            serializer(comm_wait_assembly);
+            serializer(comm_wait_wells);
+            serializer(comm_wait_linear_solve);
+            serializer(comm_wait_output);
+            serializer(comm_wait_other);
             serializer(total_well_iterations);
             serializer(total_linearizations);
             serializer(total_newton_iterations);
@@ -115,6 +131,7 @@ namespace Opm
             serializer(unconverged_domains);
             serializer(accepted_unconverged_domains);
             serializer(skipped_domains);
+            serializer(convergence_sweeps);
         }
     };
 
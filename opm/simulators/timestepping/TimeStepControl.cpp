@@ -23,6 +23,7 @@
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <iostream>
 #include <stdexcept>
 #include <string>
@@ -36,6 +37,7 @@
 #include <opm/input/eclipse/Units/Units.hpp>
 #include <opm/simulators/timestepping/TimeStepControl.hpp>
 #include <opm/simulators/timestepping/AdaptiveSimulatorTimer.hpp>
+#include <opm/simulators/timestepping/ConvergenceReport.hpp>
 
 #include <fmt/format.h>
 
@@ -111,6 +113,194 @@ namespace Opm
                 this->verbose_ == ctrl.verbose_;
     }
 
+    ////////////////////////////////////////////////////////
+    //
+    //  ResidualHistoryTimeStepControl Implementation
+    //
+    ////////////////////////////////////////////////////////
+
+    ResidualHistoryTimeStepControl::
+    ResidualHistoryTimeStepControl( const int target_iterations,
+                                    const double decayrate,
+                                    const double growthrate,
+                                    const int window_size,
+                                    const bool verbose)
+        : target_iterations_( target_iterations )
+        , decayrate_( decayrate )
+        , growthrate_( growthrate )
+        , window_size_( window_size )
+        , verbose_( verbose )
+    {
+        if( decayrate_  > 1.0 ) {
+            OPM_THROW(std::runtime_error,
+                      "ResidualHistoryTimeStepControl: "
+                      "decay should be <= 1 " + std::to_string(decayrate_));
+        }
+        if( growthrate_ < 1.0 ) {
+            OPM_THROW(std::runtime_error,
+                      "ResidualHistoryTimeStepControl: "
+                      "growth should be >= 1 " + std::to_string(growthrate_));
+        }
+        if( window_size_ < 2 ) {
+            OPM_THROW(std::runtime_error,
+                      "ResidualHistoryTimeStepControl: "
+                      "history window should hold at least 2 substeps " + std::to_string(window_size_));
+        }
+    }
+
+    ResidualHistoryTimeStepControl
+    ResidualHistoryTimeStepControl::serializationTestObject()
+    {
+        ResidualHistoryTimeStepControl result{8, 0.5, 1.5, 5, true};
+        result.dt_history_ = {1.0, 2.0};
+        result.iteration_history_ = {4.0, 6.0};
+        result.contraction_history_ = {0.3, 0.4};
+        result.cnv_pv_fraction_history_ = {0.0, 0.01};
+
+        return result;
+    }
+
+    void
+    ResidualHistoryTimeStepControl::recordConvergenceHistory(const double dt,
+                                                             const int iterations,
+                                                             const std::vector<ConvergenceReport>& reports) const
+    {
+        // Geometric mean contraction rate of the worst normalised reservoir
+        // residual over the Newton iterations of the substep.
+        double contraction = 0.5; // neutral value if no metrics are available
+        if (reports.size() >= 2) {
+            auto worstResidual = [](const ConvergenceReport& report) {
+                double worst = 0.0;
+                for (const auto& metric : report.reservoirConvergence()) {
+                    if (metric.tolerance() > 0.0) {
+                        worst = std::max(worst, metric.value() / metric.tolerance());
+                    }
+                }
+                return worst;
+            };
+            const double first = worstResidual(reports.front());
+            const double last = worstResidual(reports.back());
+            if (first > 0.0 && last > 0.0) {
+                contraction = std::clamp(std::pow(last / first, 1.0 / (reports.size() - 1)),
+                                         0.0, 2.0);
+            }
+        }
+
+        // Pore-volume fraction of the cells still violating the plain CNV
+        // criterion at the end of the substep.  Small values mean the
+        // remaining residual is local and growing the step is cheap.
+        double cnvPvFraction = 1.0;
+        if (! reports.empty()) {
+            // [1]: tol < cnv <= relaxed, [2]: relaxed < cnv
+            const auto& splitPv = reports.back().cnvPvSplit().first;
+            const double eligiblePv = reports.back().eligiblePoreVolume();
+            if (splitPv.size() >= 3 && eligiblePv > 0.0) {
+                cnvPvFraction = (splitPv[1] + splitPv[2]) / eligiblePv;
+            }
+        }
+
+        dt_history_.push_back(dt);
+        iteration_history_.push_back(iterations);
+        contraction_history_.push_back(contraction);
+        cnv_pv_fraction_history_.push_back(cnvPvFraction);
+        if (dt_history_.size() > static_cast<std::size_t>(window_size_)) {
+            dt_history_.erase(dt_history_.begin());
+            iteration_history_.erase(iteration_history_.begin());
+            contraction_history_.erase(contraction_history_.begin());
+            cnv_pv_fraction_history_.erase(cnv_pv_fraction_history_.begin());
+        }
+    }
+
+    double
+    ResidualHistoryTimeStepControl::computeTimeStepSize(const double dt,
+                                                        const int iterations,
+                                                        const RelativeChangeInterface& /* relativeChange */,
+                                                        const AdaptiveSimulatorTimer& /* substepTimer */) const
+    {
+        // Callers that do not report per-iteration convergence metrics via
+        // recordConvergenceHistory() still contribute neutral history entries.
+        if (dt_history_.empty() ||
+            dt_history_.back() != dt ||
+            iteration_history_.back() != double(iterations)) {
+            recordConvergenceHistory(dt, iterations, {});
+        }
+
+        const std::size_t n = dt_history_.size();
+
+        // Fit the Newton count as an affine function of log(dt) by least
+        // squares over the history window.
+        double offset = double(iterations);
+        double slope = 0.0;
+        {
+            double sx = 0.0, sy = 0.0, sxx = 0.0, sxy = 0.0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const double x = std::log(dt_history_[i]);
+                const double y = iteration_history_[i];
+                sx += x; sy += y; sxx += x*x; sxy += x*y;
+            }
+            const double denom = n*sxx - sx*sx;
+            if (denom > 1e-12 * n * sxx) {
+                slope = (n*sxy - sx*sy) / denom;
+                offset = (sy - slope*sx) / n;
+            }
+        }
+
+        // Tighten the iteration target when the contraction rate is poor or
+        // deteriorating over the window; the following substeps are then
+        // likely to be chopped even if the last Newton count looked fine.
+        const double goodContraction = 0.5;
+        const double localCnvPvFraction = 0.01;
+        const double contraction = contraction_history_.back();
+        const double trend = contraction_history_.back() - contraction_history_.front();
+        double effectiveTarget = double(target_iterations_);
+        if (contraction > goodContraction) {
+            effectiveTarget *= goodContraction / contraction;
+        }
+        if (trend > 0.0) {
+            effectiveTarget /= 1.0 + trend;
+        }
+        // Localised CNV violations are no reason to hold the step back.
+        if (cnv_pv_fraction_history_.back() < localCnvPvFraction &&
+            iterations <= target_iterations_) {
+            effectiveTarget = double(target_iterations_);
+        }
+        effectiveTarget = std::max(effectiveTarget, 1.0);
+
+        double dtEstimate;
+        if (slope > 1e-8) {
+            // largest dt whose predicted Newton count stays below the target
+            dtEstimate = std::exp((effectiveTarget - offset) / slope);
+        }
+        else {
+            // The iteration counts do not (yet) correlate with the step size
+            // in the window; fall back to a plain ratio rule.
+            dtEstimate = dt * effectiveTarget / std::max(double(iterations), 1.0);
+        }
+
+        // limit the change rate relative to the completed step
+        dtEstimate = std::clamp(dtEstimate, decayrate_ * dt, growthrate_ * dt);
+
+        if( verbose_ )
+            OpmLog::debug(fmt::format("Suggested next time step size (from residual history controller): {} days",
+                                      unit::convert::to( dtEstimate, unit::day )));
+
+        return dtEstimate;
+    }
+
+    bool ResidualHistoryTimeStepControl::
+    operator==(const ResidualHistoryTimeStepControl& ctrl) const
+    {
+        return this->target_iterations_ == ctrl.target_iterations_ &&
+               this->decayrate_ == ctrl.decayrate_ &&
+               this->growthrate_ == ctrl.growthrate_ &&
+               this->window_size_ == ctrl.window_size_ &&
+               this->dt_history_ == ctrl.dt_history_ &&
+               this->iteration_history_ == ctrl.iteration_history_ &&
+               this->contraction_history_ == ctrl.contraction_history_ &&
+               this->cnv_pv_fraction_history_ == ctrl.cnv_pv_fraction_history_ &&
+               this->verbose_ == ctrl.verbose_;
+    }
+
     ////////////////////////////////////////////////////////
     //
     //  HardcodedTimeStepControl Implementation
@@ -29,12 +29,15 @@
 
 namespace Opm
 {
+    class ConvergenceReport;
+
     enum class TimeStepControlType {
       SimpleIterationCount,
       PID,
       PIDAndIterationCount,
       HardCodedTimeStep,
       General3rdOrder,
+      ResidualHistory,
     };
 
     enum class ToleranceTestVersions {
@@ -294,6 +297,88 @@ namespace Opm
         const bool verbose_ = false;
     };
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    ///
+    ///  Adaptive time step control based on a window of Newton convergence histories.
+    ///
+    ///  Keeps the time step length, Newton iteration count, residual contraction
+    ///  rate and CNV pore-volume locality of the last few completed substeps and
+    ///  predicts the largest step whose expected Newton count stays below the
+    ///  target, instead of reacting to the previous substep only.
+    ///
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class ResidualHistoryTimeStepControl : public TimeStepControlInterface
+    {
+    public:
+        static constexpr TimeStepControlType Type = TimeStepControlType::ResidualHistory;
+
+        ResidualHistoryTimeStepControl() = default;
+
+        /// \brief constructor
+        /// \param target_iterations  number of desired Newton iterations per substep
+        /// \param decayrate          largest allowed reduction of the time step per substep (should be <= 1)
+        /// \param growthrate         largest allowed increase of the time step per substep (should be >= 1)
+        /// \param window_size        number of completed substeps kept in the convergence history
+        /// \param verbose            if true, get some output
+        ResidualHistoryTimeStepControl(const int target_iterations,
+                                       const double decayrate,
+                                       const double growthrate,
+                                       const int window_size,
+                                       const bool verbose);
+
+        static ResidualHistoryTimeStepControl serializationTestObject();
+
+        /// \brief Record the Newton convergence history of the substep that just
+        ///        completed.
+        /// \param dt          time step size used in the completed substep
+        /// \param iterations  number of Newton iterations used
+        /// \param reports     one ConvergenceReport per Newton iteration
+        ///
+        /// Should be called before computeTimeStepSize(); if it is not, the
+        /// completed substep enters the history with neutral convergence metrics.
+        void recordConvergenceHistory(const double dt,
+                                      const int iterations,
+                                      const std::vector<ConvergenceReport>& reports) const;
+
+        /// \brief \copydoc TimeStepControlInterface::computeTimeStepSize
+        double computeTimeStepSize(const double dt,
+                                   const int iterations,
+                                   const RelativeChangeInterface& /* relativeChange */,
+                                   const AdaptiveSimulatorTimer& /* substepTimer */ ) const override;
+
+        bool timeStepAccepted(const double /* error */,
+                              const double /* timeStepJustCompleted */) const override { return true; }
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(target_iterations_);
+            serializer(decayrate_);
+            serializer(growthrate_);
+            serializer(window_size_);
+            serializer(dt_history_);
+            serializer(iteration_history_);
+            serializer(contraction_history_);
+            serializer(cnv_pv_fraction_history_);
+            serializer(verbose_);
+        }
+
+        bool operator==(const ResidualHistoryTimeStepControl&) const;
+
+    protected:
+        const int     target_iterations_ = 8;
+        const double  decayrate_ = 0.75;
+        const double  growthrate_ = 1.25;
+        const int     window_size_ = 5;
+        // Convergence history of the last window_size_ completed substeps,
+        // newest entries last.
+        mutable std::vector<double> dt_history_{};
+        mutable std::vector<double> iteration_history_{};
+        mutable std::vector<double> contraction_history_{};
+        mutable std::vector<double> cnv_pv_fraction_history_{};
+        const bool    verbose_ = false;
+    };
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////////////////
     ///
     ///  HardcodedTimeStepControl
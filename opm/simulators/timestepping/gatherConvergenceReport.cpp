@@ -139,13 +139,28 @@ namespace Opm
     /// reports.
     ConvergenceReport
     gatherConvergenceReport(const ConvergenceReport& local_report,
-                            Parallel::Communication  mpi_communicator)
+                            Parallel::Communication  mpi_communicator,
+                            const bool               collectAllReports)
     {
         if (mpi_communicator.size() == 1) {
             // Sequential run, no communication needed.
             return local_report;
         }
 
+        if (! collectAllReports) {
+            // A fixed-size reduction decides whether the variable-length
+            // gather below can be skipped.  When every rank's report is
+            // converged, the local report already is the global answer:
+            // there are no failures to merge and the per-well metrics are
+            // not consumed.  This keeps the expensive gather out of the
+            // Newton loop on well-behaved steps.
+            const int any_unconverged =
+                mpi_communicator.max(static_cast<int>(! local_report.converged()));
+            if (any_unconverged == 0) {
+                return local_report;
+            }
+        }
+
         // Multi-process run (common case).  Need object distribution.
         auto combinedReport = ConvergenceReport {};
 
@@ -169,7 +184,8 @@ namespace Opm
 {
     ConvergenceReport
     gatherConvergenceReport(const ConvergenceReport& local_report,
-                            [[maybe_unused]] Parallel::Communication mpi_communicator)
+                            [[maybe_unused]] Parallel::Communication mpi_communicator,
+                            [[maybe_unused]] const bool collectAllReports)
     {
         return local_report;
     }
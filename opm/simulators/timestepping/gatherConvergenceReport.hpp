@@ -30,9 +30,17 @@ namespace Opm
 
     /// Create a global convergence report combining local
     /// (per-process) reports.
+    ///
+    /// When \p collectAllReports is false the variable-length gather is
+    /// skipped, by way of a single fixed-size reduction, whenever every
+    /// rank's local report is converged.  The local report is then returned
+    /// as the combined report, which is equivalent for all consumers except
+    /// those that inspect the per-well convergence metrics of converged
+    /// iterations (i.e., the INFOITER output).
     ConvergenceReport
     gatherConvergenceReport(const ConvergenceReport& local_report,
-                            Parallel::Communication  communicator);
+                            Parallel::Communication  communicator,
+                            const bool               collectAllReports = true);
 
 } // namespace Opm
 
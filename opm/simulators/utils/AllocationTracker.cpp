@@ -0,0 +1,120 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/simulators/utils/AllocationTracker.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+// All state is constant-initialized so that record() is safe even for
+// allocations made before any static constructor has run.
+thread_local Opm::AllocationTracker::Subsystem currentSubsystem =
+    Opm::AllocationTracker::Subsystem::None;
+
+std::atomic<bool> trackerArmed{false};
+std::atomic<bool> faultOnAllocation{false};
+
+std::array<std::atomic<std::uint64_t>,
+           Opm::AllocationTracker::numSubsystems> allocationCounts{};
+
+constexpr const char* subsystemNames[] = {
+    "assembly", "linear solve", "wells", "output", "other",
+};
+
+} // anonymous namespace
+
+namespace Opm {
+
+AllocationTracker::Scope::Scope(const Subsystem subsystem)
+    : previous_(currentSubsystem)
+{
+    currentSubsystem = subsystem;
+}
+
+AllocationTracker::Scope::~Scope()
+{
+    currentSubsystem = previous_;
+}
+
+void AllocationTracker::arm(const bool fault)
+{
+    faultOnAllocation.store(fault, std::memory_order_relaxed);
+    trackerArmed.store(true, std::memory_order_relaxed);
+}
+
+void AllocationTracker::disarm()
+{
+    trackerArmed.store(false, std::memory_order_relaxed);
+}
+
+bool AllocationTracker::armed()
+{
+    return trackerArmed.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::record(const std::size_t bytes) noexcept
+{
+    if (!trackerArmed.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    const auto subsystem = currentSubsystem;
+    if (subsystem == Subsystem::None) {
+        return;
+    }
+
+    const auto index = static_cast<std::size_t>(subsystem);
+    allocationCounts[index].fetch_add(1, std::memory_order_relaxed);
+
+    if (faultOnAllocation.load(std::memory_order_relaxed)) {
+        // stderr and abort() are all that can be used from inside
+        // operator new; the abort leaves a core with the offending
+        // call site on the stack.
+        std::fprintf(stderr,
+                     "AllocationTracker: %zu byte heap allocation in the "
+                     "%s hot path after steady state\n",
+                     bytes, subsystemNames[index]);
+        std::abort();
+    }
+}
+
+std::array<std::uint64_t, AllocationTracker::numSubsystems>
+AllocationTracker::takeCounts()
+{
+    std::array<std::uint64_t, numSubsystems> counts;
+    for (std::size_t i = 0; i < numSubsystems; ++i) {
+        counts[i] = allocationCounts[i].exchange(0, std::memory_order_relaxed);
+    }
+    return counts;
+}
+
+std::string AllocationTracker::subsystemName(const Subsystem subsystem)
+{
+    if (subsystem == Subsystem::None) {
+        return "none";
+    }
+    return subsystemNames[static_cast<std::size_t>(subsystem)];
+}
+
+} // namespace Opm
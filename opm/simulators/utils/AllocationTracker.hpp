@@ -0,0 +1,94 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_ALLOCATION_TRACKER_HEADER_INCLUDED
+#define OPM_ALLOCATION_TRACKER_HEADER_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Opm {
+
+/// \brief Steady-state allocation gate for the stepping hot path.
+///
+/// After the first couple of time steps the hot path -- assembly, linear
+/// solve, well updates -- is expected to run without heap allocations:
+/// every buffer has reached its working size by then and further churn is
+/// a regression.  The tracker attributes allocations to the subsystem of
+/// the innermost annotated scope and can optionally abort on the first
+/// one, so the offending call site is caught under a debugger or in a
+/// test.
+///
+/// The library does not replace the global allocator.  Allocations are
+/// only observed when the executable installs a reporting operator new
+/// that forwards to record(); the allocation gate test in tests/ does
+/// exactly that.  In a production binary an annotation costs a
+/// thread-local enum assignment and nothing else.
+class AllocationTracker
+{
+public:
+    //! Hot-path subsystems that allocations are attributed to.
+    enum class Subsystem : int { Assembly, LinearSolve, Wells, Output, Other, None };
+
+    //! Number of subsystems that allocations are counted for
+    //! (Subsystem::None marks unannotated code and is not counted).
+    static constexpr std::size_t numSubsystems = 5;
+
+    //! RAII subsystem annotation.  Nests; the enclosing subsystem is
+    //! restored on destruction.
+    class Scope
+    {
+    public:
+        explicit Scope(Subsystem subsystem);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Subsystem previous_;
+    };
+
+    //! Start counting allocations made inside annotated scopes.  With
+    //! \p faultOnAllocation the first such allocation aborts the process
+    //! after naming the subsystem on stderr (nothing more can be done
+    //! from inside operator new).
+    static void arm(bool faultOnAllocation);
+
+    //! Stop counting.  The counts recorded so far are kept.
+    static void disarm();
+
+    static bool armed();
+
+    //! Entry point for a replacement operator new.  Cheap while the
+    //! tracker is disarmed, and never allocates.
+    static void record(std::size_t bytes) noexcept;
+
+    //! The number of allocations attributed to each subsystem since the
+    //! last call, in enum order.  Resets the counters.
+    static std::array<std::uint64_t, numSubsystems> takeCounts();
+
+    static std::string subsystemName(Subsystem subsystem);
+};
+
+} // namespace Opm
+
+#endif // OPM_ALLOCATION_TRACKER_HEADER_INCLUDED
@@ -21,72 +21,93 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/simulators/utils/DeferredLogger.hpp>
 
+#include <iterator>
+#include <utility>
+
 namespace Opm
 {
 
-    void DeferredLogger::info(const std::string& tag, const std::string& message)
+    void DeferredLogger::info(std::string tag, std::string message)
     {
-        messages_.push_back({Log::MessageType::Info, tag, message});
+        messages_.push_back({Log::MessageType::Info, std::move(tag), std::move(message)});
     }
-    void DeferredLogger::warning(const std::string& tag, const std::string& message)
+    void DeferredLogger::warning(std::string tag, std::string message)
     {
-        messages_.push_back({Log::MessageType::Warning, tag, message});
+        messages_.push_back({Log::MessageType::Warning, std::move(tag), std::move(message)});
     }
-    void DeferredLogger::error(const std::string& tag, const std::string& message)
+    void DeferredLogger::error(std::string tag, std::string message)
     {
-        messages_.push_back({Log::MessageType::Error, tag, message});
+        messages_.push_back({Log::MessageType::Error, std::move(tag), std::move(message)});
     }
-    void DeferredLogger::problem(const std::string& tag, const std::string& message)
+    void DeferredLogger::problem(std::string tag, std::string message)
     {
-        messages_.push_back({Log::MessageType::Problem, tag, message});
+        messages_.push_back({Log::MessageType::Problem, std::move(tag), std::move(message)});
     }
-    void DeferredLogger::bug(const std::string& tag, const std::string& message)
+    void DeferredLogger::bug(std::string tag, std::string message)
     {
-        messages_.push_back({Log::MessageType::Bug, tag, message});
+        messages_.push_back({Log::MessageType::Bug, std::move(tag), std::move(message)});
     }
-    void DeferredLogger::debug(const std::string& tag, const std::string& message)
+    void DeferredLogger::debug(std::string tag, std::string message)
     {
-        messages_.push_back({Log::MessageType::Debug, tag, message});
+        messages_.push_back({Log::MessageType::Debug, std::move(tag), std::move(message)});
     }
-    void DeferredLogger::note(const std::string& tag, const std::string& message)
+    void DeferredLogger::note(std::string tag, std::string message)
     {
-        messages_.push_back({Log::MessageType::Note, tag, message});
+        messages_.push_back({Log::MessageType::Note, std::move(tag), std::move(message)});
     }
 
-    void DeferredLogger::info(const std::string& message)
+    void DeferredLogger::info(std::string message)
     {
-        messages_.push_back({Log::MessageType::Info, "", message});
+        messages_.push_back({Log::MessageType::Info, "", std::move(message)});
     }
-    void DeferredLogger::warning(const std::string& message)
+    void DeferredLogger::warning(std::string message)
     {
-        messages_.push_back({Log::MessageType::Warning, "", message});
+        messages_.push_back({Log::MessageType::Warning, "", std::move(message)});
     }
-    void DeferredLogger::error(const std::string& message)
+    void DeferredLogger::error(std::string message)
     {
-        messages_.push_back({Log::MessageType::Error, "", message});
+        messages_.push_back({Log::MessageType::Error, "", std::move(message)});
     }
-    void DeferredLogger::problem(const std::string& message)
+    void DeferredLogger::problem(std::string message)
     {
-        messages_.push_back({Log::MessageType::Problem, "", message});
+        messages_.push_back({Log::MessageType::Problem, "", std::move(message)});
     }
-    void DeferredLogger::bug(const std::string& message)
+    void DeferredLogger::bug(std::string message)
     {
-        messages_.push_back({Log::MessageType::Bug, "", message});
+        messages_.push_back({Log::MessageType::Bug, "", std::move(message)});
     }
 
-    void DeferredLogger::debug(const std::string& message) {
-        this->debug(message, OpmLog::defaultDebugVerbosityLevel);
+    void DeferredLogger::debug(std::string message) {
+        this->debug(std::move(message), OpmLog::defaultDebugVerbosityLevel);
     }
 
-    void DeferredLogger::debug(const std::string& message, const int verbosity_level)
+    void DeferredLogger::debug(std::string message, const int verbosity_level)
     {
         if (OpmLog::getDebugVerbosityLevel() >= verbosity_level) {
-            messages_.push_back({Log::MessageType::Debug, "", message});
+            messages_.push_back({Log::MessageType::Debug, "", std::move(message)});
         }
     }
-    void DeferredLogger::note(const std::string& message)
+    void DeferredLogger::note(std::string message)
+    {
+        messages_.push_back({Log::MessageType::Note, "", std::move(message)});
+    }
+
+    void DeferredLogger::append(const DeferredLogger& other)
     {
-        messages_.push_back({Log::MessageType::Note, "", message});
+        messages_.insert(messages_.end(),
+                         other.messages_.begin(), other.messages_.end());
+    }
+
+    void DeferredLogger::append(DeferredLogger&& other)
+    {
+        if (messages_.empty()) {
+            messages_ = std::move(other.messages_);
+        } else {
+            messages_.insert(messages_.end(),
+                             std::make_move_iterator(other.messages_.begin()),
+                             std::make_move_iterator(other.messages_.end()));
+        }
+        other.messages_.clear();
     }
 
     void DeferredLogger::logMessages()
@@ -64,22 +64,35 @@ enum ExcEnum {
             std::string text;
         };
 
-        void info(const std::string& tag, const std::string& message);
-        void warning(const std::string& tag, const std::string& message);
-        void error(const std::string& tag, const std::string& message);
-        void problem(const std::string& tag, const std::string& message);
-        void bug(const std::string& tag, const std::string& message);
-        void debug(const std::string& tag, const std::string& message);
-        void note(const std::string& tag, const std::string& message);
-
-        void info(const std::string& message);
-        void warning(const std::string& message);
-        void error(const std::string& message);
-        void problem(const std::string& message);
-        void bug(const std::string& message);
-        void debug(const std::string& message);
-        void debug(const std::string& message, const int verbosity_level);
-        void note(const std::string& message);
+        // The tag and message parameters are taken by value and moved into
+        // the message container, so call sites passing temporaries (e.g. the
+        // result of fmt::format()) incur no extra string allocation.
+        void info(std::string tag, std::string message);
+        void warning(std::string tag, std::string message);
+        void error(std::string tag, std::string message);
+        void problem(std::string tag, std::string message);
+        void bug(std::string tag, std::string message);
+        void debug(std::string tag, std::string message);
+        void note(std::string tag, std::string message);
+
+        void info(std::string message);
+        void warning(std::string message);
+        void error(std::string message);
+        void problem(std::string message);
+        void bug(std::string message);
+        void debug(std::string message);
+        void debug(std::string message, const int verbosity_level);
+        void note(std::string message);
+
+        /// Append the messages of another logger to this one.
+        /// Used to merge loggers that were filled independently,
+        /// e.g. one logger per thread.
+        void append(const DeferredLogger& other);
+
+        /// Append overload for expiring loggers: the messages are moved
+        /// instead of copied, so merging per-thread loggers after a
+        /// parallel well loop does not reallocate the message strings.
+        void append(DeferredLogger&& other);
 
         /// Log all messages to the OpmLog backends,
         /// and clear the message container.
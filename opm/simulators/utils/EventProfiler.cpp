@@ -0,0 +1,322 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/simulators/utils/EventProfiler.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include <fmt/format.h>
+
+namespace Opm {
+
+//! Per-thread event storage.  Only the owning thread writes to it while
+//! recording; other threads read it during aggregation only, which must
+//! happen after disable().
+struct EventProfiler::ThreadBuffer
+{
+    std::vector<Event> events{};
+    std::size_t next = 0;
+    bool wrapped = false;
+    std::array<const char*, maxDepth> stack{};
+    int depth = 0;
+};
+
+} // namespace Opm
+
+namespace {
+
+std::atomic<bool> profilingEnabled{false};
+
+// guards the buffer registry, not the buffers themselves
+std::mutex registryMutex;
+
+// one entry per thread that entered a scope; the buffers are leaked
+// deliberately so that aggregation can still read events of threads
+// that have exited
+std::vector<Opm::EventProfiler::ThreadBuffer*>& bufferRegistry()
+{
+    static std::vector<Opm::EventProfiler::ThreadBuffer*> registry;
+    return registry;
+}
+
+std::size_t eventsPerThread = 0;
+
+// anchor correlating the time stamp counter with wall clock time; laid
+// down by enable() and completed when the events are collapsed
+std::uint64_t anchorTicks = 0;
+std::chrono::steady_clock::time_point anchorTime{};
+
+} // Anonymous namespace
+
+namespace Opm {
+
+std::uint64_t EventProfiler::now_()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    // The time stamp counter is constant-rate on every CPU we run
+    // production on, and reading it is much cheaper than a clock_gettime
+    // call on the hot path.
+    return __rdtsc();
+#else
+    return static_cast<std::uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+EventProfiler::ThreadBuffer& EventProfiler::threadBuffer_()
+{
+    static thread_local ThreadBuffer* buffer = nullptr;
+    if (buffer == nullptr) {
+        buffer = new ThreadBuffer{};
+        std::lock_guard<std::mutex> guard(registryMutex);
+        bufferRegistry().push_back(buffer);
+    }
+    return *buffer;
+}
+
+EventProfiler::Scope::Scope(const char* name)
+{
+    if (!profilingEnabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    auto& tb = threadBuffer_();
+    if (tb.events.size() != eventsPerThread) {
+        // first event of this thread in the current recording
+        tb.events.assign(eventsPerThread, Event{});
+        tb.next = 0;
+        tb.wrapped = false;
+    }
+
+    if (tb.depth < maxDepth) {
+        tb.stack[tb.depth] = name;
+    }
+    ++tb.depth;
+
+    active_ = true;
+    begin_ = now_();
+}
+
+EventProfiler::Scope::~Scope()
+{
+    if (!active_) {
+        return;
+    }
+
+    const std::uint64_t end = now_();
+
+    auto& tb = threadBuffer_();
+    --tb.depth;
+    if (tb.depth >= maxDepth || tb.events.empty()) {
+        // deeper than the recorded stack; the time is attributed to the
+        // enclosing depth-limited scope
+        return;
+    }
+
+    Event& ev = tb.events[tb.next];
+    std::copy_n(tb.stack.begin(), tb.depth + 1, ev.stack.begin());
+    std::fill(ev.stack.begin() + tb.depth + 1, ev.stack.end(), nullptr);
+    ev.begin = begin_;
+    ev.end = end;
+
+    if (++tb.next == tb.events.size()) {
+        tb.next = 0;
+        tb.wrapped = true;
+    }
+}
+
+void EventProfiler::enable(const std::size_t numEventsPerThread)
+{
+    if (numEventsPerThread == 0) {
+        OPM_THROW(std::invalid_argument,
+                  "The event profiler needs a non-empty ring buffer");
+    }
+
+    std::lock_guard<std::mutex> guard(registryMutex);
+
+    eventsPerThread = numEventsPerThread;
+    for (auto* tb : bufferRegistry()) {
+        tb->events.clear();
+        tb->next = 0;
+        tb->wrapped = false;
+        tb->depth = 0;
+    }
+
+    anchorTicks = now_();
+    anchorTime = std::chrono::steady_clock::now();
+
+    profilingEnabled.store(true, std::memory_order_relaxed);
+}
+
+bool EventProfiler::enabled()
+{
+    return profilingEnabled.load(std::memory_order_relaxed);
+}
+
+void EventProfiler::disable()
+{
+    profilingEnabled.store(false, std::memory_order_relaxed);
+}
+
+std::vector<std::string> EventProfiler::foldedStacks()
+{
+    if (enabled()) {
+        OPM_THROW(std::logic_error,
+                  "Cannot collapse profiling events while recording is enabled");
+    }
+
+    // complete the tick/wall-time anchor laid down by enable()
+    const std::uint64_t nowTicks = now_();
+    const auto nowTime = std::chrono::steady_clock::now();
+    const double elapsedMicro =
+        std::chrono::duration<double, std::micro>(nowTime - anchorTime).count();
+    const double ticksPerMicro = (elapsedMicro > 0.0 && nowTicks > anchorTicks)
+        ? (nowTicks - anchorTicks) / elapsedMicro
+        : 1.0;
+
+    // accumulate inclusive time per stack path, and the total inclusive
+    // time of the direct children of each path so that the emitted self
+    // times do not double-count nested scopes
+    std::map<std::string, double> inclusive;
+    std::map<std::string, double> childTime;
+
+    std::lock_guard<std::mutex> guard(registryMutex);
+    for (const auto* tb : bufferRegistry()) {
+        const std::size_t numEvents = tb->wrapped ? tb->events.size() : tb->next;
+        for (std::size_t i = 0; i < numEvents; ++i) {
+            const Event& ev = tb->events[i];
+
+            std::string path{ev.stack[0]};
+            std::string parent{};
+            for (int d = 1; d < maxDepth && ev.stack[d] != nullptr; ++d) {
+                parent = path;
+                path += ';';
+                path += ev.stack[d];
+            }
+
+            const double micro = (ev.end - ev.begin) / ticksPerMicro;
+            inclusive[path] += micro;
+            if (!parent.empty()) {
+                childTime[parent] += micro;
+            }
+        }
+    }
+
+    std::vector<std::string> lines;
+    lines.reserve(inclusive.size());
+    for (const auto& [path, total] : inclusive) {
+        const auto child = childTime.find(path);
+        const double self = (child == childTime.end())
+            ? total
+            : std::max(total - child->second, 0.0);
+
+        const auto rounded = std::llround(self);
+        if (rounded > 0) {
+            lines.push_back(fmt::format("{} {}", path, rounded));
+        }
+    }
+
+    return lines;
+}
+
+void EventProfiler::writeChromeTrace(const std::string& fileName, const int rank)
+{
+    if (enabled()) {
+        OPM_THROW(std::logic_error,
+                  "Cannot write profiling events while recording is enabled");
+    }
+
+    std::ofstream os(fileName);
+    if (!os) {
+        OPM_THROW(std::runtime_error,
+                  "Failed to open '" + fileName + "' for trace output");
+    }
+
+    // complete the tick/wall-time anchor laid down by enable()
+    const std::uint64_t nowTicks = now_();
+    const auto nowTime = std::chrono::steady_clock::now();
+    const double elapsedMicro =
+        std::chrono::duration<double, std::micro>(nowTime - anchorTime).count();
+    const double ticksPerMicro = (elapsedMicro > 0.0 && nowTicks > anchorTicks)
+        ? (nowTicks - anchorTicks) / elapsedMicro
+        : 1.0;
+
+    // Complete ("ph":"X") events only; the viewers infer the nesting from
+    // the span overlap within each thread, so the enclosing stack frames
+    // recorded with every event need not be written out.
+    os << "{\"traceEvents\":[";
+
+    std::lock_guard<std::mutex> guard(registryMutex);
+
+    bool first = true;
+    int threadId = 0;
+    for (const auto* tb : bufferRegistry()) {
+        const std::size_t numEvents = tb->wrapped ? tb->events.size() : tb->next;
+        for (std::size_t i = 0; i < numEvents; ++i) {
+            const Event& ev = tb->events[i];
+
+            const char* name = ev.stack[0];
+            for (int d = 1; d < maxDepth && ev.stack[d] != nullptr; ++d) {
+                name = ev.stack[d];
+            }
+
+            os << (first ? "\n" : ",\n")
+               << fmt::format(R"({{"name":"{}","cat":"solver","ph":"X",)"
+                              R"("ts":{:.3f},"dur":{:.3f},"pid":{},"tid":{}}})",
+                              name,
+                              (ev.begin - anchorTicks) / ticksPerMicro,
+                              (ev.end - ev.begin) / ticksPerMicro,
+                              rank, threadId);
+            first = false;
+        }
+        ++threadId;
+    }
+
+    os << "\n]}\n";
+}
+
+void EventProfiler::writeFoldedStacks(const std::string& fileName)
+{
+    std::ofstream os(fileName);
+    if (!os) {
+        OPM_THROW(std::runtime_error,
+                  "Failed to open '" + fileName + "' for profiling output");
+    }
+
+    for (const auto& line : foldedStacks()) {
+        os << line << '\n';
+    }
+}
+
+} // namespace Opm
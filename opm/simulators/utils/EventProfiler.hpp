@@ -0,0 +1,117 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_EVENT_PROFILER_HEADER_INCLUDED
+#define OPM_EVENT_PROFILER_HEADER_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Opm::Parameters {
+
+struct EnableEventProfiling { static constexpr bool value = false; };
+struct EnableSolverEventTrace { static constexpr bool value = false; };
+
+} // namespace Opm::Parameters
+
+namespace Opm {
+
+/// \brief Low-overhead scope profiler intended for production runs.
+///
+/// Each Scope records two time-stamp-counter readings into a preallocated
+/// per-thread ring buffer; no locks, allocations or aggregation happen
+/// while timing, so instrumented hot paths stay cheap even in threaded
+/// regions.  Aggregation into folded stack lines -- the input format of
+/// the common flame graph tools -- happens once, when the results are
+/// written at the end of the run.
+///
+/// The ring buffers keep the most recent events only; long runs therefore
+/// profile the tail of the simulation, which is usually what is wanted
+/// when hunting steady-state performance problems.
+class EventProfiler
+{
+public:
+    //! Maximum nesting depth recorded for a scope.  Deeper scopes are
+    //! attributed to their depth-limited ancestor path.
+    static constexpr int maxDepth = 8;
+
+    //! One completed scope, as stored in the per-thread ring buffers.
+    //! Scope names must be string literals (only the pointers are kept).
+    struct Event
+    {
+        std::array<const char*, maxDepth> stack{}; //!< Enclosing scopes, outermost first, null-padded
+        std::uint64_t begin{}; //!< Time stamp at scope entry
+        std::uint64_t end{};   //!< Time stamp at scope exit
+    };
+
+    //! RAII scope recorder.  A cheap no-op while profiling is disabled.
+    class Scope
+    {
+    public:
+        explicit Scope(const char* name);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        std::uint64_t begin_{};
+        bool active_{false};
+    };
+
+    //! Start recording with a ring buffer of \p eventsPerThread events
+    //! for every thread that enters an instrumented scope.  Any events
+    //! from a previous recording are dropped.
+    static void enable(std::size_t eventsPerThread);
+
+    static bool enabled();
+
+    //! Stop recording.  The events recorded so far are kept and can
+    //! still be collapsed and written out.
+    static void disable();
+
+    //! Collapse the recorded events of all threads into folded stack
+    //! lines ("outer;inner <microseconds of self time>").  Must not be
+    //! called while recording is enabled.
+    static std::vector<std::string> foldedStacks();
+
+    //! Write foldedStacks() to \p fileName.
+    static void writeFoldedStacks(const std::string& fileName);
+
+    //! Write the recorded events of all threads as Chrome trace JSON
+    //! ("trace event format") to \p fileName.  Each event becomes a
+    //! complete span with the MPI \p rank as the process id and the
+    //! recording thread as the thread id, so traces of several ranks can
+    //! be concatenated and viewed side by side in chrome://tracing or
+    //! Perfetto.  Must not be called while recording is enabled.
+    static void writeChromeTrace(const std::string& fileName, int rank);
+
+private:
+    struct ThreadBuffer;
+
+    static ThreadBuffer& threadBuffer_();
+    static std::uint64_t now_();
+};
+
+} // namespace Opm
+
+#endif // OPM_EVENT_PROFILER_HEADER_INCLUDED
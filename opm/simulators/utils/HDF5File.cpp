@@ -26,6 +26,7 @@
 
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <filesystem>
@@ -281,10 +282,33 @@ hid_t HDF5File::getCompression([[maybe_unused]] hsize_t size) const
 {
     hid_t dcpl = H5P_DEFAULT;
 #if H5_VERS_MINOR > 8
-    if (H5Zfilter_avail(H5Z_FILTER_DEFLATE)) {
+    if (size == 0) {
+        return dcpl;
+    }
+
+    // Prefer the zstd filter (registered through the HDF5 plugin
+    // mechanism) when it is available; it compresses the serialized
+    // state considerably faster than deflate at similar ratios. Fall
+    // back to deflate, which is always built into the library. Reading
+    // is transparent in either case since the filter pipeline is
+    // recorded in the file.
+    constexpr H5Z_filter_t zstd_filter = 32015;
+    const bool has_zstd = H5Zfilter_avail(zstd_filter) > 0;
+    const bool has_deflate = H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0;
+    if (has_zstd || has_deflate) {
         dcpl = H5Pcreate(H5P_DATASET_CREATE);
-        H5Pset_deflate(dcpl, 1);
-        H5Pset_chunk(dcpl, 1, &size);
+        // Chunks pass through the filter pipeline independently, so
+        // bounding the chunk size keeps the compression working set
+        // small instead of filtering the whole dataset in one piece.
+        constexpr hsize_t max_chunk_size = hsize_t{1} << 20;
+        hsize_t chunk = std::min(size, max_chunk_size);
+        H5Pset_chunk(dcpl, 1, &chunk);
+        if (has_zstd) {
+            const unsigned int level = 3;
+            H5Pset_filter(dcpl, zstd_filter, H5Z_FLAG_OPTIONAL, 1, &level);
+        } else {
+            H5Pset_deflate(dcpl, 1);
+        }
     }
 #endif
     return dcpl;
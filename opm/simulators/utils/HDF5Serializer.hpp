@@ -30,6 +30,8 @@
 #include <cstddef>
 #include <limits>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace Opm {
 
@@ -62,9 +64,36 @@ public:
             throw;
         }
 
+        if (m_buffered) {
+            m_pending.push_back({group, dset, std::move(m_buffer), mode});
+            m_buffer.clear();
+            return;
+        }
+
         m_h5file.write(group, dset, m_buffer, mode);
     }
 
+    //! \brief Capture subsequent write() calls instead of performing them.
+    //!
+    //! The serialization (packing) still happens in the calling thread;
+    //! only the file output is postponed until flushPendingWrites() is
+    //! called. This allows the actual HDF5 I/O to be handed to a
+    //! background thread once the state has been packed.
+    void startBuffering()
+    {
+        m_buffered = true;
+    }
+
+    //! \brief Write all captured datasets to file and stop buffering.
+    void flushPendingWrites()
+    {
+        for (const auto& w : m_pending) {
+            m_h5file.write(w.group, w.dset, w.data, w.mode);
+        }
+        m_pending.clear();
+        m_buffered = false;
+    }
+
     //! \brief Writes a header to the file.
     //! \param simulator_name Name of simulator used
     //! \param module_version Version of simulator used
@@ -102,8 +131,18 @@ public:
     std::vector<int> reportSteps() const;
 
 private:
+    //! \brief A dataset write captured while buffering is active.
+    struct PendingWrite {
+        std::string group; //!< Group to write dataset to
+        std::string dset; //!< Data set to write
+        std::vector<char> data; //!< Packed dataset contents
+        HDF5File::DataSetMode mode; //!< Mode for dataset
+    };
+
     const Serialization::MemPacker m_packer_priv{}; //!< Packer instance
     HDF5File m_h5file; //!< HDF5 backend for the serializer
+    bool m_buffered = false; //!< True if write() calls are being captured
+    std::vector<PendingWrite> m_pending; //!< Captured writes to flush
 };
 
 }
@@ -54,6 +54,14 @@
  *
  * This will instantiate `MyClass` with all predefined index configurations for both
  * `double` and `float` scalar types (if `FLOW_INSTANTIATE_FLOAT` is defined).
+ *
+ * The per-group macros `INSTANTIATE_TYPE_INDICES_ONEPHASE`,
+ * `INSTANTIATE_TYPE_INDICES_TWOPHASE` and `INSTANTIATE_TYPE_INDICES_THREEPHASE`
+ * cover the one-, two- and three-phase configurations separately. They allow
+ * instantiation-heavy translation units to be sharded into one file per group
+ * so the groups compile in parallel, following the FlexibleSolver1-7.cpp /
+ * PreconditionerFactory1-7.cpp precedent (see e.g.
+ * StandardWellConnections1-3.cpp).
  */
 
     template<class Scalar>
@@ -62,10 +70,12 @@
 #define INSTANTIATE_CLASS(CLASS, T, ...) \
     template class CLASS<FS<T>,__VA_ARGS__>;
 
-#define INSTANTIATE_TYPE_INDICES(CLASS, T)                                                  \
+#define INSTANTIATE_TYPE_INDICES_ONEPHASE(CLASS, T)                                      \
     INSTANTIATE_CLASS(CLASS,T,BlackOilOnePhaseIndices<0u,0u,0u,0u,false,false,0u,1u,0u>) \
     INSTANTIATE_CLASS(CLASS,T,BlackOilOnePhaseIndices<0u,0u,0u,1u,false,false,0u,1u,0u>) \
-    INSTANTIATE_CLASS(CLASS,T,BlackOilOnePhaseIndices<0u,0u,0u,0u,false,false,0u,1u,5u>) \
+    INSTANTIATE_CLASS(CLASS,T,BlackOilOnePhaseIndices<0u,0u,0u,0u,false,false,0u,1u,5u>)
+
+#define INSTANTIATE_TYPE_INDICES_TWOPHASE(CLASS, T)                                      \
     INSTANTIATE_CLASS(CLASS,T,BlackOilTwoPhaseIndices<0u,0u,0u,0u,false,false,0u,0u,0u>) \
     INSTANTIATE_CLASS(CLASS,T,BlackOilTwoPhaseIndices<0u,0u,0u,0u,false,false,0u,1u,0u>) \
     INSTANTIATE_CLASS(CLASS,T,BlackOilTwoPhaseIndices<0u,0u,0u,0u,false,false,0u,2u,0u>) \
@@ -77,7 +87,9 @@
     INSTANTIATE_CLASS(CLASS,T,BlackOilTwoPhaseIndices<0u,0u,0u,1u,false,false,0u,0u,0u>) \
     INSTANTIATE_CLASS(CLASS,T,BlackOilTwoPhaseIndices<0u,0u,0u,1u,false,true,0u,0u,0u>)  \
     INSTANTIATE_CLASS(CLASS,T,BlackOilTwoPhaseIndices<1u,0u,0u,0u,false,false,0u,0u,0u>) \
-    INSTANTIATE_CLASS(CLASS,T,BlackOilTwoPhaseIndices<0u,0u,0u,0u,false,false,0u,0u,2u>) \
+    INSTANTIATE_CLASS(CLASS,T,BlackOilTwoPhaseIndices<0u,0u,0u,0u,false,false,0u,0u,2u>)
+
+#define INSTANTIATE_TYPE_INDICES_THREEPHASE(CLASS, T)                                                       \
     INSTANTIATE_CLASS(CLASS,T,BlackOilVariableAndEquationIndices<0u,0u,0u,0u,false,false,0u,0u>)            \
     INSTANTIATE_CLASS(CLASS,T,BlackOilVariableAndEquationIndices<0u,0u,0u,0u,true,false,0u,0u>)             \
     INSTANTIATE_CLASS(CLASS,T,BlackOilVariableAndEquationIndices<0u,0u,0u,0u,false,true,0u,0u>)             \
@@ -88,4 +100,9 @@
     INSTANTIATE_CLASS(CLASS,T,BlackOilVariableAndEquationIndices<0u,0u,0u,1u,false,true,0u,0u>)             \
     INSTANTIATE_CLASS(CLASS,T,BlackOilVariableAndEquationIndices<1u,0u,0u,0u,true,false,0u,0u>)
 
+#define INSTANTIATE_TYPE_INDICES(CLASS, T)      \
+    INSTANTIATE_TYPE_INDICES_ONEPHASE(CLASS, T) \
+    INSTANTIATE_TYPE_INDICES_TWOPHASE(CLASS, T) \
+    INSTANTIATE_TYPE_INDICES_THREEPHASE(CLASS, T)
+
 #endif
@@ -0,0 +1,180 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/simulators/utils/MemoryBudget.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+
+#include <fmt/format.h>
+
+#if defined(__unix__) || defined(__unix) || defined(unix)
+#include <unistd.h>
+#endif
+
+namespace Opm {
+
+MemoryBudget& MemoryBudget::instance()
+{
+    static MemoryBudget the_instance;
+    return the_instance;
+}
+
+std::size_t MemoryBudget::registerCache(std::string_view name,
+                                        const int priority,
+                                        UsageCallback usage,
+                                        ReleaseCallback release)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    // Reuse a slot freed by unregisterCache() if there is one, so
+    // handles stay valid across unrelated register/unregister cycles.
+    auto slot = std::find_if(entries_.begin(), entries_.end(),
+                             [](const Entry& entry) { return !entry.active; });
+    if (slot == entries_.end()) {
+        slot = entries_.insert(entries_.end(), Entry{});
+    }
+
+    slot->name = name;
+    slot->priority = priority;
+    slot->usage = std::move(usage);
+    slot->release = std::move(release);
+    slot->timesReleased = 0;
+    slot->bytesReleased = 0;
+    slot->active = true;
+
+    return static_cast<std::size_t>(slot - entries_.begin());
+}
+
+void MemoryBudget::unregisterCache(const std::size_t id)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (id < entries_.size()) {
+        entries_[id].active = false;
+        entries_[id].usage = UsageCallback{};
+        entries_[id].release = ReleaseCallback{};
+    }
+}
+
+void MemoryBudget::setBudget(const std::size_t bytes)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    budget_ = bytes;
+}
+
+std::size_t MemoryBudget::budget() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return budget_;
+}
+
+std::size_t MemoryBudget::currentResidentBytes()
+{
+#if defined(__unix__) || defined(__unix) || defined(unix)
+    // Second field of /proc/self/statm is the resident size in pages.
+    std::ifstream statm("/proc/self/statm");
+    std::size_t sizePages = 0;
+    std::size_t residentPages = 0;
+    if (statm >> sizePages >> residentPages) {
+        return residentPages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+bool MemoryBudget::enforce()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    if (budget_ == 0) {
+        return false;
+    }
+
+    const auto resident = currentResidentBytes();
+    if (resident == 0 || resident <= budget_) {
+        return false;
+    }
+
+    // Evict in ascending priority.  The allocator does not necessarily
+    // hand pages back to the kernel immediately, so the decision uses
+    // the projected release rather than re-reading the resident size.
+    std::vector<std::size_t> order;
+    order.reserve(entries_.size());
+    for (std::size_t id = 0; id < entries_.size(); ++id) {
+        if (entries_[id].active) {
+            order.push_back(id);
+        }
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [this](const std::size_t id1, const std::size_t id2)
+                     { return entries_[id1].priority < entries_[id2].priority; });
+
+    const auto overshoot = resident - budget_;
+    std::size_t released = 0;
+    for (const auto id : order) {
+        if (released >= overshoot) {
+            break;
+        }
+        auto& entry = entries_[id];
+        const auto held = entry.usage ? entry.usage() : 0;
+        if (held == 0) {
+            continue;
+        }
+        entry.release();
+        ++entry.timesReleased;
+        entry.bytesReleased += held;
+        released += held;
+        OpmLog::info(fmt::format("Memory budget: resident size {:.0f} MiB exceeds "
+                                 "budget {:.0f} MiB, released cache '{}' ({:.0f} MiB)",
+                                 resident / 1048576.0, budget_ / 1048576.0,
+                                 entry.name, held / 1048576.0));
+    }
+
+    return released > 0;
+}
+
+std::string MemoryBudget::formatReport() const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    std::string report = fmt::format("Memory budget accounting (budget {})\n",
+                                     budget_ == 0 ? std::string("unlimited")
+                                                  : fmt::format("{:.0f} MiB", budget_ / 1048576.0));
+    report += fmt::format("  {:32} {:>12} {:>10} {:>14}\n",
+                          "Cache", "Held [MiB]", "Evictions", "Released [MiB]");
+    for (const auto& entry : entries_) {
+        if (!entry.active) {
+            continue;
+        }
+        const auto held = entry.usage ? entry.usage() : 0;
+        report += fmt::format("  {:32} {:>12.1f} {:>10} {:>14.1f}\n",
+                              entry.name, held / 1048576.0,
+                              entry.timesReleased, entry.bytesReleased / 1048576.0);
+    }
+    report += fmt::format("  Resident set size: {:.0f} MiB\n",
+                          currentResidentBytes() / 1048576.0);
+    return report;
+}
+
+} // namespace Opm
@@ -0,0 +1,107 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_MEMORY_BUDGET_HEADER_INCLUDED
+#define OPM_MEMORY_BUDGET_HEADER_INCLUDED
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Opm::Parameters {
+
+struct MemoryBudgetMb { static constexpr int value = 0; };
+
+} // namespace Opm::Parameters
+
+namespace Opm {
+
+/// \brief Central registry of reclaimable caches with a soft memory budget.
+///
+/// Subsystems that hold memory they can rebuild on demand -- solver
+/// hierarchies kept across time steps, per-subdomain matrices, and the
+/// like -- register a cache with a usage callback (bytes currently held),
+/// a release callback that frees the memory, and an eviction priority.
+/// When the process' resident set exceeds the configured budget,
+/// enforce() releases caches in priority order (lowest priority first)
+/// until the projected usage is back under budget.  The registry also
+/// keeps per-cache accounting -- current size, number of evictions and
+/// bytes released -- for the end-of-run report.
+///
+/// Registration and enforcement are serialized with a mutex; the
+/// callbacks themselves are invoked outside any parallel region, so
+/// release callbacks may touch their subsystem freely.
+class MemoryBudget
+{
+public:
+    using UsageCallback = std::function<std::size_t()>;
+    using ReleaseCallback = std::function<void()>;
+
+    static MemoryBudget& instance();
+
+    //! Register a reclaimable cache.  Lower \p priority means evicted
+    //! earlier.  Returns a handle for unregisterCache().
+    std::size_t registerCache(std::string_view name,
+                              int priority,
+                              UsageCallback usage,
+                              ReleaseCallback release);
+
+    //! Remove a cache from the registry, e.g. when its owner is destroyed.
+    void unregisterCache(std::size_t id);
+
+    //! Set the budget in bytes; zero disables enforcement.
+    void setBudget(std::size_t bytes);
+
+    std::size_t budget() const;
+
+    //! Resident set size of this process in bytes, or zero when the
+    //! platform does not expose it.
+    static std::size_t currentResidentBytes();
+
+    //! Release caches (lowest priority first) until the projected
+    //! resident size is under budget or every cache has been released.
+    //! Returns whether anything was released.  A no-op without a budget.
+    bool enforce();
+
+    //! Per-cache accounting lines for the end-of-run report.
+    std::string formatReport() const;
+
+private:
+    struct Entry
+    {
+        std::string name;
+        int priority = 0;
+        UsageCallback usage;
+        ReleaseCallback release;
+        std::size_t timesReleased = 0;
+        std::size_t bytesReleased = 0;
+        bool active = false;
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<Entry> entries_;
+    std::size_t budget_ = 0;
+};
+
+} // namespace Opm
+
+#endif // OPM_MEMORY_BUDGET_HEADER_INCLUDED
@@ -23,12 +23,187 @@
 #include <dune/common/version.hh>
 #include <dune/common/parallel/mpihelper.hh>
 
+#include <array>
+#include <chrono>
+#include <cstddef>
+
 namespace Opm {
 namespace Parallel {
 
     using MPIComm = typename Dune::MPIHelper::MPICommunicator;
     using Communication = Dune::Communication<MPIComm>;
 
+    /// Subsystems to which time spent in communication calls is
+    /// attributed; rank imbalance in a subsystem surfaces as wait time
+    /// in its collectives.
+    enum class WaitClass : std::size_t {
+        Assembly = 0,
+        Wells,
+        LinearSolve,
+        Output,
+        Other,
+        Count
+    };
+
+    /// Per-process accumulator for time spent in instrumented
+    /// communication calls. The cost per call is two steady_clock
+    /// reads, so instrumenting the per-iteration collectives is well
+    /// below measurement noise. Only meant to be used from the main
+    /// thread, like the collectives themselves.
+    class WaitTimes
+    {
+    public:
+        static constexpr std::size_t numClasses =
+            static_cast<std::size_t>(WaitClass::Count);
+
+        static void add(const WaitClass wc, const double seconds)
+        { times_[static_cast<std::size_t>(wc)] += seconds; }
+
+        /// Return the accumulated times and reset the counters. Called
+        /// when filling the times into a step report.
+        static std::array<double, numClasses> takeStep()
+        {
+            const auto result = times_;
+            times_ = {};
+            return result;
+        }
+
+        static WaitClass active()
+        { return active_; }
+
+        static void setActive(const WaitClass wc)
+        { active_ = wc; }
+
+    private:
+        inline static std::array<double, numClasses> times_{};
+        inline static WaitClass active_ = WaitClass::Other;
+    };
+
+    /// Scope guard marking the subsystem that instrumented
+    /// communication inside the scope is attributed to.
+    class WaitScope
+    {
+    public:
+        explicit WaitScope(const WaitClass wc)
+            : previous_(WaitTimes::active())
+        { WaitTimes::setActive(wc); }
+
+        ~WaitScope()
+        { WaitTimes::setActive(previous_); }
+
+        WaitScope(const WaitScope&) = delete;
+        WaitScope& operator=(const WaitScope&) = delete;
+
+    private:
+        WaitClass previous_;
+    };
+
+    /// Scope guard timing a communication region -- a gather helper or
+    /// a batch of collectives -- and attributing the elapsed time to
+    /// the given subsystem.
+    class WaitTimer
+    {
+    public:
+        explicit WaitTimer(const WaitClass wc)
+            : class_(wc), start_(std::chrono::steady_clock::now())
+        {}
+
+        ~WaitTimer()
+        {
+            const std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start_;
+            WaitTimes::add(class_, elapsed.count());
+        }
+
+        WaitTimer(const WaitTimer&) = delete;
+        WaitTimer& operator=(const WaitTimer&) = delete;
+
+    private:
+        WaitClass class_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    /// Thin wrapper around Communication that attributes the time spent
+    /// in the wrapped collectives to the currently active subsystem,
+    /// see WaitScope.
+    class TimedCommunication
+    {
+    public:
+        explicit TimedCommunication(const Communication& comm)
+            : comm_(comm)
+        {}
+
+        template<class T>
+        T sum(const T& in) const
+        {
+            const WaitTimer timer(WaitTimes::active());
+            return comm_.sum(in);
+        }
+
+        template<class T>
+        void sum(T* inout, const int len) const
+        {
+            const WaitTimer timer(WaitTimes::active());
+            comm_.sum(inout, len);
+        }
+
+        template<class T>
+        T max(const T& in) const
+        {
+            const WaitTimer timer(WaitTimes::active());
+            return comm_.max(in);
+        }
+
+        template<class T>
+        void max(T* inout, const int len) const
+        {
+            const WaitTimer timer(WaitTimes::active());
+            comm_.max(inout, len);
+        }
+
+        template<class T>
+        T min(const T& in) const
+        {
+            const WaitTimer timer(WaitTimes::active());
+            return comm_.min(in);
+        }
+
+        template<class T>
+        void min(T* inout, const int len) const
+        {
+            const WaitTimer timer(WaitTimes::active());
+            comm_.min(inout, len);
+        }
+
+        template<class BinaryFunction, class T>
+        void allreduce(T* inout, const int len) const
+        {
+            const WaitTimer timer(WaitTimes::active());
+            comm_.template allreduce<BinaryFunction>(inout, len);
+        }
+
+        template<class T>
+        int broadcast(T* inout, const int len, const int root) const
+        {
+            const WaitTimer timer(WaitTimes::active());
+            return comm_.broadcast(inout, len, root);
+        }
+
+        void barrier() const
+        {
+            const WaitTimer timer(WaitTimes::active());
+            comm_.barrier();
+        }
+
+        int rank() const { return comm_.rank(); }
+        int size() const { return comm_.size(); }
+
+        const Communication& communication() const { return comm_; }
+
+    private:
+        const Communication& comm_;
+    };
+
 } // namespace Parallel
 } // end namespace Opm
 
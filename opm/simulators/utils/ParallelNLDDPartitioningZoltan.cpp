@@ -241,6 +241,24 @@ namespace {
             return this->graph_.getFinalVertexID(originalVertexID);
         }
 
+        /// Assign computational weights to the graph's vertices.
+        ///
+        /// \param[in] weights Weight for each vertex in the final,
+        ///   post-merge numbering.
+        void setVertexWeights(std::vector<float> weights)
+        {
+            this->vertexWeights_ = std::move(weights);
+        }
+
+        /// Retrieve computational weight of a vertex.
+        ///
+        /// \param[in] localCell Vertex ID in the final, post-merge numbering.
+        float vertexWeight(const int localCell) const
+        {
+            return this->vertexWeights_.empty()
+                ? 1.0f : this->vertexWeights_[localCell];
+        }
+
     private:
         // VertexID = int, TrackCompressedIdx = false
         using Backend = Opm::utility::CSRGraphFromCoordinates<>;
@@ -251,6 +269,10 @@ namespace {
         /// Globally unique vertex ID of each locally reachable vertex.
         std::vector<int> globalCell_{};
 
+        /// Computational weight of each vertex in the final, post-merge
+        /// numbering.  Empty when all vertices are equally expensive.
+        std::vector<float> vertexWeights_{};
+
         /// Vertex connectivity graph.
         Backend graph_{};
     };
@@ -337,8 +359,8 @@ extern "C" {
                     const int        numElmsPerLid,
                     ZOLTAN_ID_PTR    globalIds,
                     ZOLTAN_ID_PTR    localIds,
-                    const int     /* wgtDim */,
-                    float*        /* objWgts */,
+                    const int        wgtDim,
+                    float*           objWgts,
                     int*             ierr)
     {
         if ((numElmsPerGid != numElmsPerLid) || (numElmsPerLid != 1)) {
@@ -361,6 +383,12 @@ extern "C" {
                            return graph->globalId(localCell);
                        });
 
+        if (wgtDim > 0) {
+            for (auto cell = 0; cell < graph->numVertices(); ++cell) {
+                objWgts[wgtDim * cell] = graph->vertexWeight(cell);
+            }
+        }
+
         *ierr = ZOLTAN_OK;
     }
 
@@ -589,8 +617,24 @@ Opm::ParallelNLDDPartitioningZoltan::partitionElements(const ZoltanParamMap& par
         this->conns_, vertexId, reachableVertexGroups, this->globalCell_
     };
 
+    auto effectiveParams = params;
+    if (! this->vertexWeights_.empty()) {
+        // Accumulate the per-element weights onto the final, post-merge
+        // vertex numbering and enable object weighting in Zoltan.
+        auto weights = std::vector<float>(graph.numVertices(), 0.0f);
+        for (auto elm = 0*this->numElements_; elm < this->numElements_; ++elm) {
+            if (const auto reachableElmIx = vertexId[elm]; reachableElmIx >= 0) {
+                weights[graph.getFinalVertexID(reachableElmIx)] +=
+                    static_cast<float>(this->vertexWeights_[elm]);
+            }
+        }
+        graph.setVertexWeights(std::move(weights));
+
+        effectiveParams.insert_or_assign("OBJ_WEIGHT_DIM", "1");
+    }
+
     const auto partsForReachableCells = Partitioner {
-        this->comm_, params
+        this->comm_, effectiveParams
     }(static_cast<void*>(&graph), graph.numVertices());
 
     // Map reachable cells back to full cell numbering.
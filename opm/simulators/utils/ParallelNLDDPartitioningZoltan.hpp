@@ -92,6 +92,16 @@ namespace Opm {
         /// \param[in] vertices Vector of vertex IDs to merge
         void addVertexGroup(const std::vector<int>& vertices);
 
+        /// Assign computational weights to the graph vertices.
+        ///
+        /// \param[in] weights Weight for each of the \c numElements
+        ///   vertices.  An empty vector, the default, treats all vertices
+        ///   as equally expensive.
+        void setVertexWeights(std::vector<double> weights)
+        {
+            this->vertexWeights_ = std::move(weights);
+        }
+
     private:
         /// Connection/graph edge.
         using Connection = std::pair<std::size_t, std::size_t>;
@@ -110,6 +120,10 @@ namespace Opm {
 
         /// Connectivity graph edges.
         std::vector<Connection> conns_{};
+
+        /// Computational weight of each vertex.  Empty when all vertices
+        /// are equally expensive.
+        std::vector<double> vertexWeights_{};
     };
 
 } // namespace Opm
@@ -32,6 +32,37 @@
 #include <opm/output/eclipse/RestartValue.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 
+namespace {
+
+#if HAVE_MPI
+// Broadcast a solution section one per-cell array at a time.  The
+// serialization buffer on the I/O rank then only needs to hold the
+// largest single array instead of the whole section, and unpacking of
+// one array on the receiving ranks overlaps with the root packing the
+// next one.  On restarted multi-million cell models the monolithic
+// message was a significant part of the I/O rank's peak memory.
+void broadcastSolution(Opm::Parallel::MpiSerializer& ser,
+                       const bool isRoot,
+                       Opm::data::Solution& sol)
+{
+    std::vector<std::string> keys;
+    if (isRoot) {
+        keys.reserve(sol.size());
+        for (const auto& [key, cellData] : sol) {
+            static_cast<void>(cellData);
+            keys.push_back(key);
+        }
+    }
+    ser.broadcast(Opm::Parallel::RootRank{0}, keys);
+
+    for (const auto& key : keys) {
+        ser.broadcast(Opm::Parallel::RootRank{0}, sol[key]);
+    }
+}
+#endif
+
+}
+
 namespace Opm {
 
 RestartValue loadParallelRestart(const EclipseIO* eclIO,
@@ -51,7 +82,20 @@ RestartValue loadParallelRestart(const EclipseIO* eclIO,
     }
 
     Parallel::MpiSerializer ser(comm);
+
+    // Detach the solution section, i.e., the global per-cell arrays, and
+    // stream it array by array.  The remaining, much smaller pieces of
+    // the restart value travel in a single message as before.
+    data::Solution solution{};
+    if (comm.rank() == 0) {
+        solution = std::move(restartValues.solution);
+        restartValues.solution.clear();
+    }
+
     ser.broadcast(Parallel::RootRank{0}, restartValues, summaryState);
+    broadcastSolution(ser, comm.rank() == 0, solution);
+    restartValues.solution = std::move(solution);
+
     return restartValues;
 #else
     return eclIO->loadRestart(actionState, summaryState, solutionKeys, extraKeys);
@@ -73,7 +117,7 @@ data::Solution loadParallelRestartSolution(const EclipseIO* eclIO,
     }
 
     Parallel::MpiSerializer ser(comm);
-    ser.broadcast(Parallel::RootRank{0}, sol);
+    broadcastSolution(ser, comm.rank() == 0, sol);
     return sol;
 #else
     return eclIO->loadRestartSolution(solutionKeys, step);
@@ -79,7 +79,18 @@ void eclStateBroadcast(Parallel::Communication comm, EclipseState& eclState, Sch
                        WellTestState&  wtestState)
 {
     Parallel::MpiSerializer ser(comm);
-    ser.broadcast(Parallel::RootRank{0}, eclState, schedule, summaryConfig, udqState, actionState, wtestState);
+
+    // Broadcast the state objects one at a time instead of as a single
+    // monolithic message.  The pack buffer then only needs to hold the
+    // largest individual object rather than the whole model, and the
+    // root's serialization of each object overlaps with the other ranks
+    // still deserializing the previous one.
+    ser.broadcast(Parallel::RootRank{0}, eclState);
+    ser.broadcast(Parallel::RootRank{0}, schedule);
+    ser.broadcast(Parallel::RootRank{0}, summaryConfig);
+    ser.broadcast(Parallel::RootRank{0}, udqState);
+    ser.broadcast(Parallel::RootRank{0}, actionState);
+    ser.broadcast(Parallel::RootRank{0}, wtestState);
 }
 
 template <class T>
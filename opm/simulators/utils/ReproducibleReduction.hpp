@@ -0,0 +1,82 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_REPRODUCIBLE_REDUCTION_HEADER_INCLUDED
+#define OPM_REPRODUCIBLE_REDUCTION_HEADER_INCLUDED
+
+#include <opm/simulators/utils/ParallelCommunication.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace Opm {
+namespace Parallel {
+
+/// \brief Sum values over all ranks in a fixed, rank-major order.
+///
+/// Drop-in alternative to Communication::sum() for workflows that need
+/// the global result to be independent of the reduction tree used by the
+/// MPI implementation.  The partial results of all ranks are gathered to
+/// every rank and accumulated in rank order with Neumaier compensated
+/// summation, so the result is bitwise identical on all ranks and does
+/// not change with the MPI library's reduction schedule.  Note that the
+/// local partial sums still depend on the domain decomposition, so runs
+/// with different rank counts agree only up to the accuracy of the
+/// compensated accumulation.
+///
+/// \param[in]     comm   communicator to reduce over
+/// \param[in,out] values on entry the local partial sums, on exit the
+///                       global sums (identical on all ranks)
+/// \param[in]     n      number of values to reduce
+template<class Scalar>
+void reproducibleSum(const Communication& comm,
+                     Scalar* values,
+                     const std::size_t n)
+{
+    const int nprocs = comm.size();
+    if (nprocs < 2 || n == 0) {
+        return;
+    }
+
+    std::vector<Scalar> gathered(n * nprocs);
+    comm.allgather(values, static_cast<int>(n), gathered.data());
+
+    for (std::size_t i = 0; i < n; ++i) {
+        Scalar sum = 0.0;
+        Scalar correction = 0.0;
+        for (int rank = 0; rank < nprocs; ++rank) {
+            const Scalar value = gathered[rank * n + i];
+            const Scalar tmp = sum + value;
+            if (std::abs(sum) >= std::abs(value)) {
+                correction += (sum - tmp) + value;
+            }
+            else {
+                correction += (value - tmp) + sum;
+            }
+            sum = tmp;
+        }
+        values[i] = sum + correction;
+    }
+}
+
+} // namespace Parallel
+} // namespace Opm
+
+#endif // OPM_REPRODUCIBLE_REDUCTION_HEADER_INCLUDED
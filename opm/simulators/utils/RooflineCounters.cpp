@@ -0,0 +1,321 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/simulators/utils/RooflineCounters.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+#include <fmt/format.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using Phase = Opm::RooflineCounters::Phase;
+
+constexpr std::size_t numPhases = Opm::RooflineCounters::numPhases;
+constexpr std::size_t maxCounters = Opm::RooflineCounters::maxCounters;
+
+// Assumed DRAM transfer size of a last-level cache miss.
+constexpr double cacheLineBytes = 64.0;
+
+constexpr const char* phaseNames[] = {
+    "assembly", "linear solve", "wells",
+};
+
+std::atomic<bool> countersEnabled{false};
+bool haveFpCounter = false;
+std::size_t numCounters = 0;
+int counterFds[maxCounters] = {-1, -1, -1, -1};
+
+// Sampled totals; [phase][counter] plus wall time per phase.  Written
+// from the sampling thread only, atomics keep formatReport() safe.
+std::atomic<std::uint64_t> counterTotals[numPhases][maxCounters];
+std::atomic<std::uint64_t> timeTotals[numPhases];
+
+thread_local Opm::RooflineCounters::Scope* currentScope = nullptr;
+
+std::uint64_t timeNow()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#if defined(__linux__)
+
+int perfEventOpen(struct perf_event_attr* attr)
+{
+    return static_cast<int>(::syscall(__NR_perf_event_open, attr,
+                                      /*pid=*/0, /*cpu=*/-1,
+                                      /*group_fd=*/-1, /*flags=*/0UL));
+}
+
+int openCounter(const std::uint32_t type, const std::uint64_t config)
+{
+    struct perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // Count threads spawned after the counter is opened as well, so
+    // threaded phases are covered.  Inherited counters cannot be read
+    // as a group, hence one fd per counter.
+    attr.inherit = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TIME_RUNNING;
+
+    return perfEventOpen(&attr);
+}
+
+#endif // __linux__
+
+void readCounters(std::uint64_t (&values)[maxCounters])
+{
+#if defined(__linux__)
+    for (std::size_t i = 0; i < numCounters; ++i) {
+        struct {
+            std::uint64_t value;
+            std::uint64_t timeEnabled;
+            std::uint64_t timeRunning;
+        } sample{};
+
+        if (::read(counterFds[i], &sample, sizeof(sample))
+            != static_cast<ssize_t>(sizeof(sample))) {
+            values[i] = 0;
+            continue;
+        }
+
+        // Scale for multiplexing in case the PMU ran out of slots.
+        values[i] = (sample.timeRunning > 0 && sample.timeRunning < sample.timeEnabled)
+            ? static_cast<std::uint64_t>(
+                  static_cast<double>(sample.value) * static_cast<double>(sample.timeEnabled)
+                  / static_cast<double>(sample.timeRunning))
+            : sample.value;
+    }
+#else
+    for (std::size_t i = 0; i < maxCounters; ++i) {
+        values[i] = 0;
+    }
+#endif
+}
+
+void attribute(const Phase phase,
+               const std::uint64_t (&begin)[maxCounters],
+               const std::uint64_t (&end)[maxCounters])
+{
+    const auto phaseIndex = static_cast<std::size_t>(phase);
+    for (std::size_t i = 0; i < numCounters; ++i) {
+        counterTotals[phaseIndex][i].fetch_add(end[i] - begin[i],
+                                               std::memory_order_relaxed);
+    }
+}
+
+} // anonymous namespace
+
+namespace Opm {
+
+RooflineCounters::Scope::Scope(const Phase phase)
+    : phase_(phase)
+{
+    if (!countersEnabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    active_ = true;
+    parent_ = currentScope;
+    currentScope = this;
+
+    std::uint64_t now[maxCounters];
+    readCounters(now);
+
+    // Close the enclosing scope's interval so nested work is only
+    // attributed to the nested phase.
+    if (parent_ != nullptr) {
+        std::uint64_t parentBegin[maxCounters];
+        for (std::size_t i = 0; i < maxCounters; ++i) {
+            parentBegin[i] = parent_->baseline_[i];
+        }
+        attribute(parent_->phase_, parentBegin, now);
+
+        const auto time = timeNow();
+        timeTotals[static_cast<std::size_t>(parent_->phase_)]
+            .fetch_add(time - parent_->beginTime_, std::memory_order_relaxed);
+        parent_->beginTime_ = time;
+    }
+
+    for (std::size_t i = 0; i < maxCounters; ++i) {
+        baseline_[i] = now[i];
+    }
+    beginTime_ = timeNow();
+}
+
+RooflineCounters::Scope::~Scope()
+{
+    if (!active_) {
+        return;
+    }
+
+    std::uint64_t now[maxCounters];
+    readCounters(now);
+
+    std::uint64_t begin[maxCounters];
+    for (std::size_t i = 0; i < maxCounters; ++i) {
+        begin[i] = baseline_[i];
+    }
+    attribute(phase_, begin, now);
+
+    const auto time = timeNow();
+    timeTotals[static_cast<std::size_t>(phase_)]
+        .fetch_add(time - beginTime_, std::memory_order_relaxed);
+
+    // Restart the enclosing scope's interval.
+    if (parent_ != nullptr) {
+        for (std::size_t i = 0; i < maxCounters; ++i) {
+            parent_->baseline_[i] = now[i];
+        }
+        parent_->beginTime_ = time;
+    }
+
+    currentScope = parent_;
+}
+
+void RooflineCounters::enable(const std::string& fpRawEvent)
+{
+#if defined(__linux__)
+    if (countersEnabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    counterFds[0] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    counterFds[1] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+    counterFds[2] = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+
+    if (counterFds[0] < 0 || counterFds[1] < 0 || counterFds[2] < 0) {
+        OpmLog::warning("Roofline counters unavailable: perf_event_open failed "
+                        "(check /proc/sys/kernel/perf_event_paranoid)");
+        disable();
+        return;
+    }
+    numCounters = 3;
+
+    if (!fpRawEvent.empty()) {
+        std::uint64_t config = 0;
+        const auto* digits = fpRawEvent.c_str();
+        if (digits[0] == 'r' || digits[0] == 'R') {
+            ++digits;
+        }
+        config = std::strtoull(digits, nullptr, 16);
+
+        counterFds[3] = openCounter(PERF_TYPE_RAW, config);
+        if (counterFds[3] < 0) {
+            OpmLog::warning(fmt::format("Roofline counters: raw floating point "
+                                        "event '{}' could not be opened; "
+                                        "GFLOP/s will not be reported",
+                                        fpRawEvent));
+        }
+        else {
+            haveFpCounter = true;
+            numCounters = 4;
+        }
+    }
+
+    countersEnabled.store(true, std::memory_order_relaxed);
+#else
+    static_cast<void>(fpRawEvent);
+    OpmLog::warning("Roofline counters are only supported on Linux (perf_event)");
+#endif
+}
+
+bool RooflineCounters::enabled()
+{
+    return countersEnabled.load(std::memory_order_relaxed);
+}
+
+void RooflineCounters::disable()
+{
+    countersEnabled.store(false, std::memory_order_relaxed);
+
+#if defined(__linux__)
+    for (auto& fd : counterFds) {
+        if (fd >= 0) {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+#endif
+}
+
+std::string RooflineCounters::formatReport()
+{
+    std::string report = "Roofline counters per solver phase:\n";
+    report += haveFpCounter
+        ? fmt::format("  {:<14} {:>9} {:>9} {:>6} {:>9} {:>9} {:>10}\n",
+                      "Phase", "Time(s)", "GInstr", "IPC", "DRAM GB/s", "GFLOP/s", "FLOP/byte")
+        : fmt::format("  {:<14} {:>9} {:>9} {:>6} {:>9}\n",
+                      "Phase", "Time(s)", "GInstr", "IPC", "DRAM GB/s");
+
+    for (std::size_t phase = 0; phase < numPhases; ++phase) {
+        const double seconds =
+            timeTotals[phase].load(std::memory_order_relaxed) * 1.0e-9;
+        if (seconds <= 0.0) {
+            continue;
+        }
+
+        const double cycles = counterTotals[phase][0].load(std::memory_order_relaxed);
+        const double instructions = counterTotals[phase][1].load(std::memory_order_relaxed);
+        const double bytes =
+            counterTotals[phase][2].load(std::memory_order_relaxed) * cacheLineBytes;
+
+        const double ipc = cycles > 0.0 ? instructions / cycles : 0.0;
+
+        if (haveFpCounter) {
+            const double flops = counterTotals[phase][3].load(std::memory_order_relaxed);
+            report += fmt::format("  {:<14} {:>9.2f} {:>9.2f} {:>6.2f} {:>9.2f} {:>9.2f} {:>10.3f}\n",
+                                  phaseNames[phase], seconds,
+                                  instructions * 1.0e-9, ipc,
+                                  bytes * 1.0e-9 / seconds,
+                                  flops * 1.0e-9 / seconds,
+                                  bytes > 0.0 ? flops / bytes : 0.0);
+        }
+        else {
+            report += fmt::format("  {:<14} {:>9.2f} {:>9.2f} {:>6.2f} {:>9.2f}\n",
+                                  phaseNames[phase], seconds,
+                                  instructions * 1.0e-9, ipc,
+                                  bytes * 1.0e-9 / seconds);
+        }
+    }
+
+    return report;
+}
+
+} // namespace Opm
@@ -0,0 +1,106 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_ROOFLINE_COUNTERS_HEADER_INCLUDED
+#define OPM_ROOFLINE_COUNTERS_HEADER_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Opm::Parameters {
+
+struct EnableRooflineCounters { static constexpr bool value = false; };
+struct RooflineFpRawEvent { static constexpr auto value = ""; };
+
+} // namespace Opm::Parameters
+
+namespace Opm {
+
+/// \brief Hardware counter sampling per solver phase for roofline analysis.
+///
+/// Samples perf_event hardware counters -- cycles, instructions and
+/// last-level cache misses -- around the instrumented solver phases and
+/// reports per-phase instruction throughput, IPC and achieved DRAM
+/// bandwidth (cache misses times the line size) at the end of the run.
+/// The measured arithmetic intensity is what the CPU-versus-GPU
+/// placement decision per asset needs, without attaching an external
+/// profiler that perturbs the run.
+///
+/// Generic perf events do not expose floating point operations; on CPUs
+/// where the raw PMU event for them is known it can be passed as
+/// "rNNNN" (hexadecimal event descriptor, perf list syntax), in which
+/// case GFLOP/s and FLOP/byte are reported as well.
+///
+/// The counters follow the enabling thread and the threads it spawns
+/// afterwards (perf inherit); enable before the worker pool starts for
+/// full coverage of threaded phases.  While disabled an instrumented
+/// scope costs a single branch.
+class RooflineCounters
+{
+public:
+    //! Instrumented solver phases.
+    enum class Phase : int { Assembly, LinearSolve, Wells };
+
+    static constexpr std::size_t numPhases = 3;
+
+    //! Maximum number of sampled counters (cycles, instructions,
+    //! cache misses and the optional floating point event).
+    static constexpr std::size_t maxCounters = 4;
+
+    //! RAII phase sampler.  Nests; time under a nested scope is
+    //! attributed to the nested scope's phase only.
+    class Scope
+    {
+    public:
+        explicit Scope(Phase phase);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        Phase phase_;
+        bool active_{false};
+        Scope* parent_{nullptr};
+        std::array<std::uint64_t, maxCounters> baseline_{};
+        std::uint64_t beginTime_{};
+    };
+
+    //! Open the hardware counters on the calling thread.  \p fpRawEvent
+    //! optionally names a raw PMU event counting floating point
+    //! operations; empty means none.  Logs a warning and stays disabled
+    //! when the platform or the perf_event paranoia setting does not
+    //! allow counting.
+    static void enable(const std::string& fpRawEvent);
+
+    static bool enabled();
+
+    //! Close the counters.  The totals sampled so far are kept for
+    //! formatReport().
+    static void disable();
+
+    //! Per-phase summary lines for the end-of-run report.
+    static std::string formatReport();
+};
+
+} // namespace Opm
+
+#endif // OPM_ROOFLINE_COUNTERS_HEADER_INCLUDED
@@ -0,0 +1,52 @@
+/*
+  Copyright 2026 Equinor ASA
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef OPM_TARGET_CLONES_HPP
+#define OPM_TARGET_CLONES_HPP
+
+/// \file
+/// \brief Helper macro for compiler function multiversioning.
+///
+/// Release binaries are typically built for a lowest-common-denominator
+/// x86-64 baseline although the machines they run on often support AVX2
+/// or AVX-512. Marking a hot kernel with OPM_TARGET_CLONES makes the
+/// compiler emit one variant of the function per listed instruction set
+/// and select among them once at load time via the GNU ifunc mechanism,
+/// so a single binary uses the widest vectors each node offers.
+///
+/// Limitations: the attribute only applies to non-template functions
+/// with external linkage defined in a translation unit, so kernels that
+/// live in headers as templates must be routed through concrete
+/// overloads first (see DILUKernels.cpp for the pattern). On platforms
+/// without ifunc support the macro expands to nothing and a single
+/// baseline version is emitted. Define OPM_DISABLE_TARGET_CLONES to
+/// force the baseline everywhere, e.g. when profiling with tools that
+/// mishandle ifunc resolvers.
+
+#if !defined(OPM_DISABLE_TARGET_CLONES) && \
+    defined(__x86_64__) && defined(__ELF__) && \
+    ((defined(__GNUC__) && !defined(__clang__)) || \
+     (defined(__clang__) && __clang_major__ >= 14))
+#define OPM_TARGET_CLONES_ENABLED 1
+#define OPM_TARGET_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define OPM_TARGET_CLONES_ENABLED 0
+#define OPM_TARGET_CLONES
+#endif
+
+#endif // OPM_TARGET_CLONES_HPP
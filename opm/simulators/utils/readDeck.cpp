@@ -73,12 +73,19 @@
 #include <opm/simulators/utils/PartiallySupportedFlowKeywords.hpp>
 #include <opm/simulators/utils/UnsupportedFlowKeywords.hpp>
 
+#if HAVE_HDF5
+#include <opm/simulators/utils/HDF5Serializer.hpp>
+#include <opm/simulators/utils/moduleVersion.hpp>
+#endif
+
 #include <fmt/format.h>
 
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <filesystem>
+#include <fstream>
+#include <functional>
 #include <memory>
 #include <regex>
 #include <sstream>
@@ -440,6 +447,150 @@ namespace {
     }
 #endif
 
+#if HAVE_HDF5
+    // The deck snapshot is keyed on the content of the top-level deck file
+    // and the simulator version.  Changes made through INCLUDE files are
+    // invisible to this hash, which is one reason the snapshot machinery
+    // is strictly opt-in.
+    std::uint64_t deckSnapshotHash(const std::string& deckFilename)
+    {
+        std::ifstream is(deckFilename, std::ios::binary);
+        std::ostringstream content;
+        content << is.rdbuf();
+
+        return std::hash<std::string>{}(content.str());
+    }
+
+    Opm::Parallel::Communication selfCommunication()
+    {
+#if HAVE_MPI
+        return Opm::Parallel::Communication { MPI_COMM_SELF };
+#else
+        return Opm::Parallel::Communication {};
+#endif
+    }
+
+    bool loadDeckSnapshot(const std::string&                   snapshotFile,
+                          const std::uint64_t                  deckHash,
+                          [[maybe_unused]] Opm::Parallel::Communication comm,
+                          std::shared_ptr<Opm::Python>         python,
+                          std::shared_ptr<Opm::EclipseState>&  eclipseState,
+                          std::shared_ptr<Opm::Schedule>&      schedule,
+                          std::unique_ptr<Opm::UDQState>&      udqState,
+                          std::unique_ptr<Opm::Action::State>& actionState,
+                          std::unique_ptr<Opm::WellTestState>& wtestState,
+                          std::shared_ptr<Opm::SummaryConfig>& summaryConfig)
+    {
+        if (! std::filesystem::exists(snapshotFile)) {
+            return false;
+        }
+
+        try {
+            Opm::HDF5Serializer ser(snapshotFile,
+                                    Opm::HDF5File::OpenMode::READ,
+                                    selfCommunication());
+
+            auto key = std::pair<std::uint64_t, std::string>{};
+            ser.read(key, "/", "deck_key",
+                     Opm::HDF5File::DataSetMode::ROOT_ONLY);
+
+            if ((key.first != deckHash) ||
+                (key.second != Opm::moduleVersion()))
+            {
+                Opm::OpmLog::info(fmt::format("Deck snapshot '{}' does not match "
+                                              "the current deck; re-parsing input",
+                                              snapshotFile));
+                return false;
+            }
+
+            // Deserialization targets are constructed the same way as on
+            // the non-I/O ranks; their content is overwritten by the
+            // reads below.
+#if HAVE_MPI
+            eclipseState = std::make_shared<Opm::ParallelEclipseState>(comm);
+#else
+            eclipseState = std::make_shared<Opm::EclipseState>();
+#endif
+            schedule = std::make_shared<Opm::Schedule>(std::move(python));
+            udqState = std::make_unique<Opm::UDQState>(0);
+            actionState = std::make_unique<Opm::Action::State>();
+            wtestState = std::make_unique<Opm::WellTestState>();
+            summaryConfig = std::make_shared<Opm::SummaryConfig>();
+
+            const auto mode = Opm::HDF5File::DataSetMode::ROOT_ONLY;
+            ser.read(*eclipseState, "/snapshot", "eclipse_state", mode);
+            ser.read(*schedule, "/snapshot", "schedule", mode);
+            ser.read(*summaryConfig, "/snapshot", "summary_config", mode);
+            ser.read(*udqState, "/snapshot", "udq_state", mode);
+            ser.read(*actionState, "/snapshot", "action_state", mode);
+            ser.read(*wtestState, "/snapshot", "wtest_state", mode);
+        }
+        catch (const std::exception& e) {
+            Opm::OpmLog::warning(fmt::format("Failed to load deck snapshot "
+                                             "'{}': {}; re-parsing input",
+                                             snapshotFile, e.what()));
+
+            // Ensure a partially deserialized state is not left behind;
+            // the regular parsing path recreates null objects.
+            eclipseState.reset();
+            schedule.reset();
+            udqState.reset();
+            actionState.reset();
+            wtestState.reset();
+            summaryConfig.reset();
+
+            return false;
+        }
+
+        if (Opm::OpmLog::hasBackend("STDOUT_LOGGER")) {
+            // loggers might not be set up!
+            setupMessageLimiter((*schedule)[0].message_limits(), "STDOUT_LOGGER");
+        }
+
+        Opm::OpmLog::info(fmt::format("Loaded parsed deck from snapshot '{}'",
+                                      snapshotFile));
+
+        return true;
+    }
+
+    void writeDeckSnapshot(const std::string&  snapshotFile,
+                           const std::uint64_t deckHash,
+                           Opm::EclipseState&  eclipseState,
+                           Opm::Schedule&      schedule,
+                           Opm::UDQState&      udqState,
+                           Opm::Action::State& actionState,
+                           Opm::WellTestState& wtestState,
+                           Opm::SummaryConfig& summaryConfig)
+    {
+        try {
+            Opm::HDF5Serializer ser(snapshotFile,
+                                    Opm::HDF5File::OpenMode::OVERWRITE,
+                                    selfCommunication());
+
+            auto key = std::pair { deckHash, Opm::moduleVersion() };
+            ser.write(key, "/", "deck_key",
+                      Opm::HDF5File::DataSetMode::ROOT_ONLY);
+
+            const auto mode = Opm::HDF5File::DataSetMode::ROOT_ONLY;
+            ser.write(eclipseState, "/snapshot", "eclipse_state", mode);
+            ser.write(schedule, "/snapshot", "schedule", mode);
+            ser.write(summaryConfig, "/snapshot", "summary_config", mode);
+            ser.write(udqState, "/snapshot", "udq_state", mode);
+            ser.write(actionState, "/snapshot", "action_state", mode);
+            ser.write(wtestState, "/snapshot", "wtest_state", mode);
+
+            Opm::OpmLog::info(fmt::format("Wrote deck snapshot '{}'",
+                                          snapshotFile));
+        }
+        catch (const std::exception& e) {
+            // A failed snapshot write only costs a re-parse in the next
+            // run and must not bring down the current one.
+            Opm::OpmLog::warning(fmt::format("Failed to write deck snapshot "
+                                             "'{}': {}", snapshotFile, e.what()));
+        }
+    }
+#endif // HAVE_HDF5
+
     std::pair<bool, std::string>
     gridHasValidCellGeometry(const Opm::EclipseGrid& inputGrid,
                              const Opm::UnitSystem&  usys)
@@ -699,7 +850,8 @@ void Opm::readDeck(Opm::Parallel::Communication    comm,
                    const bool                      checkDeck,
                    const bool                      keepKeywords,
                    const std::optional<int>&       outputInterval,
-                   const bool                      slaveMode)
+                   const bool                      slaveMode,
+                   const std::string&              deckSnapshotFile)
 {
     auto errorGuard = std::make_unique<ErrorGuard>();
     int parseSuccess = 1; // > 0 is success
@@ -728,11 +880,37 @@ void Opm::readDeck(Opm::Parallel::Communication    comm,
                 parseContext->update(ParseContext::SCHEDULE_INVALID_NAME, InputErrorAction::WARN);
             }
             parseContext->setInputSkipMode(inputSkipMode);
-            readOnIORank(comm, deckFilename, parseContext.get(),
-                         eclipseState, schedule, udqState, actionState, wtestState,
-                         summaryConfig, std::move(python), initFromRestart,
-                         checkDeck, treatCriticalAsNonCritical, lowActionParsingStrictness,
-                         keepKeywords, outputInterval, *errorGuard, slaveMode);
+
+            bool loadedSnapshot = false;
+            [[maybe_unused]] std::uint64_t snapshotHash = 0;
+            if (! deckSnapshotFile.empty()) {
+#if HAVE_HDF5
+                snapshotHash = deckSnapshotHash(deckFilename);
+                loadedSnapshot =
+                    loadDeckSnapshot(deckSnapshotFile, snapshotHash, comm, python,
+                                     eclipseState, schedule, udqState,
+                                     actionState, wtestState, summaryConfig);
+#else
+                OpmLog::warning("Deck snapshot requested, but flow was compiled "
+                                "without HDF5 support; parsing the deck as usual");
+#endif
+            }
+
+            if (! loadedSnapshot) {
+                readOnIORank(comm, deckFilename, parseContext.get(),
+                             eclipseState, schedule, udqState, actionState, wtestState,
+                             summaryConfig, std::move(python), initFromRestart,
+                             checkDeck, treatCriticalAsNonCritical, lowActionParsingStrictness,
+                             keepKeywords, outputInterval, *errorGuard, slaveMode);
+
+#if HAVE_HDF5
+                if (! deckSnapshotFile.empty() && ! (*errorGuard)) {
+                    writeDeckSnapshot(deckSnapshotFile, snapshotHash,
+                                      *eclipseState, *schedule, *udqState,
+                                      *actionState, *wtestState, *summaryConfig);
+                }
+#endif
+            }
 
             // Update schedule so that re-parsing after actions use same strictness
             assert(schedule);
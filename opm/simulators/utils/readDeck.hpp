@@ -84,6 +84,11 @@ setupLogging(Parallel::Communication& comm,
 ///
 /// If pointers already contains objects then they are used otherwise they
 /// are created and can be used outside later.
+///
+/// If \p deckSnapshotFile is non-empty and flow was compiled with HDF5
+/// support, the parsed state objects are cached in that file and reused
+/// in subsequent runs of the same, unmodified deck instead of parsing
+/// the input again.
 void readDeck(Parallel::Communication         comm,
               const std::string&              deckFilename,
               std::shared_ptr<EclipseState>&  eclipseState,
@@ -100,7 +105,8 @@ void readDeck(Parallel::Communication         comm,
               bool                            checkDeck,
               bool                            keepKeywords,
               const std::optional<int>&       outputInterval,
-              bool                            slaveMode);
+              bool                            slaveMode,
+              const std::string&              deckSnapshotFile = {});
 
 void verifyValidCellGeometry(Parallel::Communication comm,
                              const EclipseState&     eclipseState);
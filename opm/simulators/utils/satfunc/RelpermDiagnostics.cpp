@@ -851,40 +851,55 @@ namespace Opm {
         scaledEpsInfo_.resize(nc);
         EclEpsGridProperties epsGridProperties(eclState, false);
         const std::string tag = "Scaled endpoints";
+
+        // Only build the (comparatively expensive) cell and region labels
+        // when a check actually fails, and serialise the log output since
+        // the sweep over the cells is threaded.
+        auto emitWarning = [&tag, &epsGridProperties, &levelCartesianIndexMapper]
+            (const int c, const std::string& condition)
+        {
+            std::array<int, 3> ijk;
+            levelCartesianIndexMapper.cartesianCoordinate(c, ijk, 0);
+
+            const std::string msg = "For scaled endpoints input, cell(" +
+                std::to_string(ijk[0]) + ", " +
+                std::to_string(ijk[1]) + ", " +
+                std::to_string(ijk[2]) + ") SATNUM = " +
+                std::to_string(epsGridProperties.satRegion(c)) +
+                ", " + condition;
+
+#ifdef _OPENMP
+#pragma omp critical (RelpermDiagnosticsLog)
+#endif
+            OpmLog::warning(tag, msg);
+        };
+
+        const bool mobilityChecks = threepoint && fluidSystem_ == FluidSystem::BlackOil;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1000)
+#endif
         for (int c = 0; c < nc; ++c) {
-            const std::string satnumIdx = std::to_string(epsGridProperties.satRegion(c));
-            std::string cellIdx;
-            {
-                std::array<int, 3> ijk;
-                levelCartesianIndexMapper.cartesianCoordinate(c, ijk, 0);
-                cellIdx = "(" + std::to_string(ijk[0]) + ", " +
-                    std::to_string(ijk[1]) + ", " +
-                    std::to_string(ijk[2]) + ")";
-            }
             scaledEpsInfo_[c].extractScaled(eclState, epsGridProperties, c);
 
             // SGU <= 1.0 - SWL
             if (scaledEpsInfo_[c].Sgu > (1.0 - scaledEpsInfo_[c].Swl + tolerance)) {
-                const std::string msg = "For scaled endpoints input, cell" + cellIdx + " SATNUM = " + satnumIdx + ", SGU exceed 1.0 - SWL";
-                OpmLog::warning(tag, msg);
+                emitWarning(c, "SGU exceed 1.0 - SWL");
             }
 
             // SGL <= 1.0 - SWU
             if (scaledEpsInfo_[c].Sgl > (1.0 - scaledEpsInfo_[c].Swu + tolerance)) {
-                const std::string msg = "For scaled endpoints input, cell" + cellIdx + " SATNUM = " + satnumIdx + ", SGL exceed 1.0 - SWU";
-                OpmLog::warning(tag, msg);
+                emitWarning(c, "SGL exceed 1.0 - SWU");
             }
 
-            if (threepoint && fluidSystem_ == FluidSystem::BlackOil) {
+            if (mobilityChecks) {
                 // Mobilility check.
                 if ((scaledEpsInfo_[c].Sowcr + scaledEpsInfo_[c].Swcr) >= (1.0 + tolerance)) {
-                    const std::string msg = "For scaled endpoints input, cell" + cellIdx + " SATNUM = " + satnumIdx + ", SOWCR + SWCR exceed 1.0";
-                    OpmLog::warning(tag, msg);
+                    emitWarning(c, "SOWCR + SWCR exceed 1.0");
                 }
 
-            if ((scaledEpsInfo_[c].Sogcr + scaledEpsInfo_[c].Sgcr + scaledEpsInfo_[c].Swl) >= (1.0 + tolerance)) {
-                    const std::string msg = "For scaled endpoints input, cell" + cellIdx + " SATNUM = " + satnumIdx + ", SOGCR + SGCR + SWL exceed 1.0";
-                    OpmLog::warning(tag, msg);
+                if ((scaledEpsInfo_[c].Sogcr + scaledEpsInfo_[c].Sgcr + scaledEpsInfo_[c].Swl) >= (1.0 + tolerance)) {
+                    emitWarning(c, "SOGCR + SGCR + SWL exceed 1.0");
                 }
             }
         }
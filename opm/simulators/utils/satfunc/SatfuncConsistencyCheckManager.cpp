@@ -170,22 +170,73 @@ warnIfDirectionalOrIrreversibleEPS() const
 
 template <typename Scalar>
 void Opm::Satfunc::PhaseChecks::SatfuncConsistencyCheckManager<Scalar>::
-runCellChecks(const int cellIdx)
+runCellChecks(const std::vector<int>& cellIndices,
+              const std::size_t       cellSampleStride)
 {
-    this->curveLoop([cellIdx, endPoints = EclEpsScalingPointsInfo<Scalar>{}]
-                    (auto& curve) mutable
+    // Region based checks must visit every cell in order to guarantee that
+    // each saturation region gets checked.  The checks de-duplicate on the
+    // underlying region index, however, so this sweep amounts to a cheap
+    // lookup per cell and runs serially.
     {
-        const auto pointID = curve.point->pointID(cellIdx);
-        if (! pointID.has_value()) {
-            // Check does not apply to this cell for 'curve'.  Might be
-            // because it's a region based check and we already ran the
-            // checks for this particular underlying region.
-            return;
+        auto endPoints = EclEpsScalingPointsInfo<Scalar>{};
+
+        for (const auto& cellIdx : cellIndices) {
+            this->curveLoop([cellIdx, &endPoints](auto& curve)
+            {
+                if (curve.perCellPoints) {
+                    return;
+                }
+
+                const auto pointID = curve.point->pointID(cellIdx);
+                if (! pointID.has_value()) {
+                    // We already ran the checks for this cell's underlying
+                    // region.
+                    return;
+                }
+
+                curve.point->populateCheckPoint(cellIdx, endPoints);
+                curve.checks.checkEndpoints(*pointID, endPoints);
+            });
         }
+    }
 
-        curve.point->populateCheckPoint(cellIdx, endPoints);
-        curve.checks.checkEndpoints(*pointID, endPoints);
-    });
+    // Per-cell checks of the scaled curves.  Populating the scaled
+    // end-points dominates the cost of this sweep so it is threaded, with
+    // each thread using private end-point storage.  Recording check
+    // violations mutates shared state, but is comparatively cheap and
+    // therefore serialised.
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        auto endPoints = EclEpsScalingPointsInfo<Scalar>{};
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1000)
+#endif
+        for (std::size_t i = 0; i < cellIndices.size(); i += cellSampleStride) {
+            const auto cellIdx = cellIndices[i];
+
+            this->curveLoop([cellIdx, &endPoints](auto& curve)
+            {
+                if (! curve.perCellPoints) {
+                    return;
+                }
+
+                const auto pointID = curve.point->pointID(cellIdx);
+                if (! pointID.has_value()) {
+                    return;
+                }
+
+                curve.point->populateCheckPoint(cellIdx, endPoints);
+
+#ifdef _OPENMP
+#pragma omp critical (SatfuncConsistencyCheckViolations)
+#endif
+                curve.checks.checkEndpoints(*pointID, endPoints);
+            });
+        }
+    }
 }
 
 template <typename Scalar>
@@ -264,6 +315,8 @@ configureScaledCurveChecks(const UnscaledSatfuncCheckPoint<Scalar>& unscaledChec
           &this->gridProps_.back(), this->localToGlobal_),
          "Grid Block", numSamplePoints);
 
+    curve.perCellPoints = true;
+
     const auto nchar = std::max({
             fmt::formatted_size("{}", gdims.getNX()),
             fmt::formatted_size("{}", gdims.getNY()),
@@ -34,6 +34,7 @@
 #include <dune/grid/common/partitionset.hh>
 #include <dune/grid/common/rangegenerators.hh>
 
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -124,17 +125,30 @@ namespace Opm::Satfunc::PhaseChecks {
         /// \param[in] getCellIndex Callback function for computing a
         /// numeric lookup index associated to each interior element of the
         /// grid view.
+        ///
+        /// \param[in] cellSampleStride Run the per-cell checks of the
+        /// scaled saturation functions on every \p cellSampleStride-th
+        /// interior cell only.  The per-region checks of the tabulated
+        /// saturation functions are always exhaustive.  Stride one--the
+        /// default--checks every cell.
         template <typename GridView, typename GetCellIndex>
-        void run(const GridView& gv, GetCellIndex&& getCellIndex)
+        void run(const GridView&   gv,
+                 GetCellIndex&&    getCellIndex,
+                 const std::size_t cellSampleStride = 1)
         {
             this->isRoot_ = gv.comm().rank() == this->root_;
 
             this->warnIfDirectionalOrIrreversibleEPS();
 
+            auto cellIndices = std::vector<int>{};
+            cellIndices.reserve(gv.size(0));
             for (const auto& elem : elements(gv, Dune::Partitions::interior)) {
-                this->runCellChecks(getCellIndex(elem));
+                cellIndices.push_back(getCellIndex(elem));
             }
 
+            this->runCellChecks(cellIndices,
+                                std::max(cellSampleStride, std::size_t{1}));
+
             gv.comm().barrier();
 
             this->collectFailures(gv.comm());
@@ -206,6 +220,12 @@ namespace Opm::Satfunc::PhaseChecks {
 
             /// Set of consistency checks to run against \c point.
             SatfuncConsistencyChecks<Scalar> checks;
+
+            /// Whether the check points of this curve are defined per
+            /// grid cell (e.g., scaled end-points) as opposed to per
+            /// saturation region.  Per-cell curves are eligible for
+            /// sampled (strided) checking.
+            bool perCellPoints{false};
         };
 
         /// Container of static properties such as the scaled saturation
@@ -259,12 +279,23 @@ namespace Opm::Satfunc::PhaseChecks {
         /// function consistency analysis.
         void warnIfDirectionalOrIrreversibleEPS() const;
 
-        /// Run all configured saturation function checks for a single
-        /// active cell.
+        /// Run all configured saturation function checks for a set of
+        /// active cells.
+        ///
+        /// The region based checks always visit every cell in order to
+        /// guarantee that each saturation region gets checked, although
+        /// de-duplication on the region index makes that sweep cheap.  The
+        /// per-cell checks of the scaled curves only visit every \p
+        /// cellSampleStride-th cell and are threaded if OpenMP is
+        /// available.
+        ///
+        /// \param[in] cellIndices Numeric lookup indices associated to the
+        /// interior elements/cells of a grid view.
         ///
-        /// \param[in] cellIdx Numeric lookup index associated to an
-        /// interior element/cell of a grid view.
-        void runCellChecks(const int cellIdx);
+        /// \param[in] cellSampleStride Distance between consecutive cells
+        /// included in the per-cell checks.  Stride one checks every cell.
+        void runCellChecks(const std::vector<int>& cellIndices,
+                           const std::size_t       cellSampleStride);
 
         /// Configure all pertinent saturation function consistency checks.
         ///
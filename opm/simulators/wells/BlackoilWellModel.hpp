@@ -272,6 +272,12 @@ template<class Scalar> class WellContributions;
             /// Called from assemble() when needsTimestepInit() returns true.
             void calculateExplicitQuantities() const;
 
+            /// Whether the connection pressure-drop properties of the named
+            /// well may be reused from the previous time step.  True only
+            /// when reuse is enabled, no relevant schedule event touches the
+            /// well and its state is unchanged within the reuse tolerance.
+            bool canReuseConnectionPressures(const std::string& well_name) const;
+
             /// One-time initialization at the start of each timestep.
             /// Called once per timestep from assemble() when needsTimestepInit() returns true.
             void prepareTimeStep(DeferredLogger& deferred_logger);
@@ -516,6 +522,7 @@ template<class Scalar> class WellContributions;
             Scalar gravity_{};
             std::vector<Scalar> depth_{};
             bool alternative_well_rate_init_{};
+            bool extrapolate_well_guess_{};
             std::unique_ptr<RateConverterType> rateConverter_{};
             std::map<std::string, std::unique_ptr<AverageRegionalPressureType>> regionalAveragePressureCalculator_{};
 
@@ -526,6 +533,11 @@ template<class Scalar> class WellContributions;
             // A flag to tell the convergence report whether we need to take another newton step
             bool network_needs_more_balancing_force_another_newton_iteration_{false};
 
+            // Whether the globally gathered well residuals were converged in
+            // the most recent convergence check; used as the safety trigger
+            // for freezing the well controls in late Newton iterations.
+            mutable bool well_residuals_converged_{false};
+
             std::vector<Scalar> B_avg_{};
 
             const EquilGrid& equilGrid() const
@@ -575,11 +587,22 @@ template<class Scalar> class WellContributions;
 
             void updateAverageFormationFactor();
 
-            void computePotentials(const std::size_t widx,
+            //! \brief Compute the potentials of the given wells.
+            //!
+            //! Wells local to a single rank are solved thread parallel when
+            //! ThreadedWellSolves is enabled, the remainder serially.
+            void computePotentials(const std::vector<std::size_t>& widxs,
                                    const WellState<Scalar, IndexTraits>& well_state_copy,
                                    std::string& exc_msg,
                                    ExceptionType::ExcEnum& exc_type) override;
 
+            //! \brief Compute the potentials of a single well.
+            void computeSingleWellPotentials(const std::size_t widx,
+                                             const WellState<Scalar, IndexTraits>& well_state_copy,
+                                             GroupStateHelperType& group_state_helper,
+                                             std::string& exc_msg,
+                                             ExceptionType::ExcEnum& exc_type);
+
             const std::vector<Scalar>& wellPerfEfficiencyFactors() const;
 
             void calculateProductivityIndexValuesShutWells(const int reportStepIdx, DeferredLogger& deferred_logger) override;
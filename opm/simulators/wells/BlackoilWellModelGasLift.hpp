@@ -29,6 +29,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace Opm {
 
@@ -86,6 +87,12 @@ protected:
 
     bool terminal_output_;
     double last_glift_opt_time_ = -1.0;
+
+    // Phase potentials each well was last optimized at; used by the
+    // incremental mode to identify wells whose potentials have not moved
+    // and which may keep their current ALQ.
+    std::map<std::string, std::vector<Scalar>> last_glift_potentials_;
+    int glift_optimization_count_ = 0;
 };
 
 /// Class for handling the gaslift in the blackoil well model.
@@ -133,6 +140,7 @@ private:
                                    GLiftOptWells& glift_wells,
                                    GasLiftGroupInfo<Scalar, IndexTraits>& group_info,
                                    GLiftWellStateMap& state_map,
+                                   const Scalar incremental_tolerance,
                                    DeferredLogger& deferred_logger);
 
     // cannot be const since it accesses the non-const WellState
@@ -145,8 +153,15 @@ private:
                                              GasLiftGroupInfo<Scalar, IndexTraits>& group_info,
                                              GLiftWellStateMap& state_map,
                                              GLiftSyncGroups& groups_to_sync,
+                                             const Scalar incremental_tolerance,
                                              DeferredLogger& deferred_logger);
 
+    // returns true if no entry of current deviates from prev by more than
+    // the relative tolerance
+    static bool potentialsUnchanged_(const std::vector<Scalar>& prev,
+                                     const std::vector<Scalar>& current,
+                                     const Scalar tol);
+
     void updateWellPotentials(const Simulator& simulator,
                               const std::vector<WellInterfacePtr>& well_container,
                               const std::map<std::string, Scalar>& node_pressures,
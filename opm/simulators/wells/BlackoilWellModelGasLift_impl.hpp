@@ -28,6 +28,7 @@
 #include <opm/simulators/wells/BlackoilWellModelGasLift.hpp>
 #endif
 #include <opm/common/TimingMacros.hpp>
+#include <opm/simulators/flow/BlackoilModelParameters.hpp>
 #include <opm/simulators/wells/GasLiftSingleWell.hpp>
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
 
@@ -35,6 +36,10 @@
 #include <opm/simulators/utils/MPISerializer.hpp>
 #endif
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
 namespace Opm {
 
 template<typename TypeTag>
@@ -101,6 +106,23 @@ maybeDoGasLiftOptimize(const Simulator& simulator,
         };
         group_info.initialize();
 
+        // With a positive --gas-lift-incremental-tolerance, wells whose
+        // phase potentials have not moved since they were last optimized
+        // keep their current ALQ and are skipped.  A full optimization is
+        // run periodically and whenever no previous solution exists.
+        const Scalar incremental_tol =
+            Parameters::Get<Parameters::GasLiftIncrementalTolerance<Scalar>>();
+        const int full_refresh =
+            Parameters::Get<Parameters::GasLiftFullRefreshInterval>();
+        Scalar effective_tol = incremental_tol;
+        if (this->last_glift_potentials_.empty() ||
+            (full_refresh > 0 &&
+             this->glift_optimization_count_ % full_refresh == 0))
+        {
+            effective_tol = 0.0;
+        }
+        ++this->glift_optimization_count_;
+
         gasLiftOptimizationStage1(simulator,
                                   well_container,
                                   wellState,
@@ -109,6 +131,7 @@ maybeDoGasLiftOptimize(const Simulator& simulator,
                                   glift_wells,
                                   group_info,
                                   state_map,
+                                  effective_tol,
                                   deferred_logger);
 
         this->gasLiftOptimizationStage2(simulator.vanguard().gridView().comm(),
@@ -123,6 +146,16 @@ maybeDoGasLiftOptimize(const Simulator& simulator,
                                         simulator.episodeIndex(),
                                         deferred_logger);
 
+        // Remember the potentials the optimized wells were solved at; they
+        // decide which wells can be skipped in later incremental rounds.
+        if (incremental_tol > 0.0) {
+            for (const auto& [wname, glift_state] : state_map) {
+                static_cast<void>(glift_state);
+                this->last_glift_potentials_[wname] =
+                    wellState.well(wname).well_potentials;
+            }
+        }
+
         if constexpr (glift_debug) {
             std::vector<WellInterfaceGeneric<Scalar, IndexTraits>*> wc;
             wc.reserve(well_container.size());
@@ -150,6 +183,7 @@ gasLiftOptimizationStage1(const Simulator& simulator,
                           GLiftOptWells &glift_wells,
                           GasLiftGroupInfo<Scalar, IndexTraits>& group_info,
                           GLiftWellStateMap& state_map,
+                          const Scalar incremental_tolerance,
                           DeferredLogger& deferred_logger)
 {
     OPM_TIMEFUNCTION();
@@ -197,6 +231,7 @@ gasLiftOptimizationStage1(const Simulator& simulator,
                                                         group_info,
                                                         state_map,
                                                         groups_to_sync,
+                                                        incremental_tolerance,
                                                         deferred_logger);
                 }
             }
@@ -267,9 +302,22 @@ gasLiftOptimizationStage1SingleWell(WellInterface<TypeTag>* well,
                                     GasLiftGroupInfo<Scalar, IndexTraits>& group_info,
                                     GLiftWellStateMap& state_map,
                                     GLiftSyncGroups& sync_groups,
+                                    const Scalar incremental_tolerance,
                                     DeferredLogger& deferred_logger)
 {
     OPM_TIMEFUNCTION();
+    if (incremental_tolerance > 0.0) {
+        const auto prev = this->last_glift_potentials_.find(well->name());
+        if (prev != this->last_glift_potentials_.end() &&
+            potentialsUnchanged_(prev->second,
+                                 wellState.well(well->name()).well_potentials,
+                                 incremental_tolerance))
+        {
+            // The optimization would reproduce the previous answer;
+            // keep the current ALQ for this well in this round.
+            return;
+        }
+    }
     const auto& summary_state = simulator.vanguard().summaryState();
     auto glift = std::make_unique<GasLiftSingleWell<TypeTag>>(*well,
                                                               simulator,
@@ -291,6 +339,25 @@ gasLiftOptimizationStage1SingleWell(WellInterface<TypeTag>* well,
     prod_wells.insert({well->name(), well});
 }
 
+template<typename TypeTag>
+bool
+BlackoilWellModelGasLift<TypeTag>::
+potentialsUnchanged_(const std::vector<Scalar>& prev,
+                     const std::vector<Scalar>& current,
+                     const Scalar tol)
+{
+    if (prev.size() != current.size()) {
+        return false;
+    }
+    for (std::size_t p = 0; p < prev.size(); ++p) {
+        const Scalar scale = std::max(std::abs(prev[p]), std::abs(current[p]));
+        if (std::abs(current[p] - prev[p]) > tol * scale) {
+            return false;
+        }
+    }
+    return true;
+}
+
 template<typename TypeTag>
 void
 BlackoilWellModelGasLift<TypeTag>::
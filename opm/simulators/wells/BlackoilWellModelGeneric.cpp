@@ -50,6 +50,7 @@
 
 #include <opm/input/eclipse/Units/Units.hpp>
 
+#include <opm/models/parallel/tasklets.hpp>
 #include <opm/models/utils/parametersystem.hpp>
 
 #include <opm/material/fluidsystems/BlackOilDefaultFluidSystemIndices.hpp>
@@ -75,8 +76,11 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 #include <tuple>
@@ -110,7 +114,7 @@ BlackoilWellModelGeneric(Schedule& schedule,
     , guideRate_(schedule)
     , active_wgstate_(pu)
     , last_valid_wgstate_(pu)
-    , nupcol_wgstate_(pu)
+    , nupcol_well_state_(pu)
     , group_state_helper_(this->wellState(),
                           this->groupState(),
                           this->schedule(),
@@ -139,6 +143,10 @@ BlackoilWellModelGeneric(Schedule& schedule,
     };
 }
 
+template<typename Scalar, typename IndexTraits>
+BlackoilWellModelGeneric<Scalar, IndexTraits>::
+~BlackoilWellModelGeneric() = default;
+
 template<typename Scalar, typename IndexTraits>
 int BlackoilWellModelGeneric<Scalar, IndexTraits>::
 numLocalWells() const
@@ -280,7 +288,7 @@ prepareDeserialize(int report_step, const std::size_t numCells, bool handle_ms_w
     }
     this->wellState().clearWellRates();
     this->commitWGState();
-    this->updateNupcolWGState();
+    this->updateNupcolWellState();
 }
 
 template<typename Scalar, typename IndexTraits>
@@ -302,6 +310,57 @@ getLocalWells(const int timeStepIdx) const
     return w;
 }
 
+template<typename Scalar, typename IndexTraits>
+void BlackoilWellModelGeneric<Scalar, IndexTraits>::
+prefetchLocalWells(const int timeStepIdx)
+{
+    if (timeStepIdx < 0 || timeStepIdx >= static_cast<int>(this->schedule_.size())) {
+        return;
+    }
+
+    if (!this->well_prefetch_runner_) {
+        this->well_prefetch_runner_ = std::make_unique<TaskletRunner>(/*numWorkers=*/1);
+    }
+
+    this->prefetched_wells_step_ = timeStepIdx;
+    auto prefetch = [this, timeStepIdx]()
+    { this->prefetched_wells_ = this->getLocalWells(timeStepIdx); };
+    this->well_prefetch_runner_->dispatchFunction(prefetch);
+}
+
+template<typename Scalar, typename IndexTraits>
+void BlackoilWellModelGeneric<Scalar, IndexTraits>::
+discardPrefetchedLocalWells()
+{
+    if (this->well_prefetch_runner_) {
+        this->well_prefetch_runner_->barrier();
+        this->prefetched_wells_.clear();
+        this->prefetched_wells_step_ = -1;
+    }
+}
+
+template<typename Scalar, typename IndexTraits>
+std::vector<Well> BlackoilWellModelGeneric<Scalar, IndexTraits>::
+localWellsForStep(const int timeStepIdx)
+{
+    if (this->well_prefetch_runner_ && this->prefetched_wells_step_ != -1) {
+        this->well_prefetch_runner_->barrier();
+        if (this->well_prefetch_runner_->failure()) {
+            // The background copy failed, fall back to materializing the
+            // wells synchronously and stop prefetching.
+            this->well_prefetch_runner_.reset();
+            this->prefetched_wells_.clear();
+            this->prefetched_wells_step_ = -1;
+        }
+        else if (this->prefetched_wells_step_ == timeStepIdx) {
+            this->prefetched_wells_step_ = -1;
+            return std::move(this->prefetched_wells_);
+        }
+    }
+
+    return this->getLocalWells(timeStepIdx);
+}
+
 template<typename Scalar, typename IndexTraits>
 std::vector<std::reference_wrapper<ParallelWellInfo<Scalar>>>
 BlackoilWellModelGeneric<Scalar, IndexTraits>::
@@ -780,6 +839,10 @@ updateEclWells(const int timeStepIdx,
                const SimulatorUpdate& sim_update,
                const SummaryState& st)
 {
+    // The action has modified the schedule, so any cached schedule object
+    // pointers for this report step are stale.
+    this->group_state_helper_.invalidateScheduleCache();
+
     this->updateEclWellsConstraints(timeStepIdx, sim_update, st);
 
     if (! sim_update.well_structure_changed &&
@@ -1234,7 +1297,7 @@ updateAndCommunicateGroupData(const int reportStepIdx,
     GroupStateHelperType &group_state_helper = this->groupStateHelper();
     if (iterCtx.withinNupcol(nupcol)) {
         OPM_TIMEBLOCK(updateNupcol);
-        this->updateNupcolWGState();
+        this->updateNupcolWellState();
     } else {
         for (const auto& gr_name : schedule().groupNames(reportStepIdx)) {
             const Phase all[] = { Phase::WATER, Phase::OIL, Phase::GAS };
@@ -1277,7 +1340,7 @@ updateAndCommunicateGroupData(const int reportStepIdx,
                         Scalar denominator = (0.5*gr_rate_nupcol + 0.5*gr_rate);
                         Scalar rel_change = denominator > small_rate ? std::abs( (gr_rate_nupcol - gr_rate) / denominator) : 0.0;
                         if ( rel_change > tol_nupcol) {
-                            this->updateNupcolWGState();
+                            this->updateNupcolWellState();
                             if (comm_.rank() == 0) {
                                 const std::string control_str = is_vrep? "VREP" : "REIN";
                                 const std::string msg = fmt::format("Group prodution relative change {} larger than tolerance {} "
@@ -1299,6 +1362,12 @@ updateAndCommunicateGroupData(const int reportStepIdx,
             group_state_helper.updateGroupControlledWells(is_production_group[i], phases[i]);
         }
     }
+    // The well surface and reservoir rates are fixed for the remainder of
+    // this function (only currentWellRates, targets and control modes are
+    // written below), so the recursive rate sums over the group tree can be
+    // memoized. The cache follows the active well state, so the nupcol scope
+    // below gets its own consistent entries.
+    auto rate_cache = group_state_helper.pushGroupRateCache();
     // the group target reduction rates needs to be update since wells may have switched to/from GRUP control
     // The group target reduction does not honor NUPCOL.
     group_state_helper.updateGroupTargetReduction(fieldGroup, /*is_injector=*/false);
@@ -1315,8 +1384,16 @@ updateAndCommunicateGroupData(const int reportStepIdx,
         group_state_helper.updateGroupProductionRates(fieldGroup);
     }
     group_state_helper.updateWellRates(fieldGroup, this->nupcolWellState(), this->wellState());
-    this->wellState().communicateGroupRates(comm_);
-    this->groupState().communicate_rates(comm_);
+    // Pack the well and group rates into one persistent flat buffer and
+    // sum them with a single reduction instead of one per container.
+    const std::size_t well_sz = this->wellState().data_size();
+    const std::size_t group_sz = this->groupState().data_size();
+    rate_comm_buffer_.resize(well_sz + group_sz);
+    this->wellState().collect(rate_comm_buffer_.data());
+    this->groupState().collect(rate_comm_buffer_.data() + well_sz);
+    comm_.sum(rate_comm_buffer_.data(), rate_comm_buffer_.size());
+    this->wellState().distribute(rate_comm_buffer_.data());
+    this->groupState().distribute(rate_comm_buffer_.data() + well_sz);
 
     if (update_wellgrouptarget) {
         for (const auto& well : well_container_generic_) {
@@ -1515,6 +1592,7 @@ updateWellPotentials(const int reportStepIdx,
     const bool write_restart_file = schedule().write_rst_file(reportStepIdx);
     auto exc_type = ExceptionType::NONE;
     std::string exc_msg;
+    std::vector<std::size_t> wells_to_compute;
     std::size_t widx = 0;
     for (const auto& well : well_container_generic_) {
         const bool needed_for_summary =
@@ -1548,22 +1626,91 @@ updateWellPotentials(const int reportStepIdx,
                                              + ScheduleEvents::PRODUCTION_UPDATE
                                              + ScheduleEvents::INJECTION_UPDATE;
         const auto& events = schedule()[reportStepIdx].wellgroup_events();
+        // A swapped VFP table (e.g. an ACTIONX updating VFPPROD) does not
+        // raise a well event, but invalidates the potentials of exactly
+        // the wells referencing that table.
+        const std::size_t vfp_version = well->vfpTableVersion();
+        const auto vfp_it = well_vfp_versions_.find(well->name());
+        const bool vfp_changed = vfp_it == well_vfp_versions_.end()
+            ? vfp_version > 0
+            : vfp_it->second != vfp_version;
         const bool event = events.hasEvent(well->name(), ScheduleEvents::ACTIONX_WELL_EVENT) ||
+                           vfp_changed ||
                            (report_step_starts_ && events.hasEvent(well->name(), effective_events_mask));
         const bool needPotentialsForGuideRates = well->underPredictionMode() && (!onlyAfterEvent || event);
         const bool needPotentialsForOutput = !onlyAfterEvent && (needed_for_summary || write_restart_file);
         const bool compute_potential = needPotentialsForOutput || needPotentialsForGuideRates;
-        if (compute_potential)
+
+        // Reuse the potentials from the last evaluation if the well is
+        // still operating at the conditions they were computed for. Events
+        // always force a fresh evaluation.
+        const bool reuse_potential = compute_potential && !event &&
+                                     well_potential_reuse_tol_ > Scalar{0.0} &&
+                                     this->canReuseWellPotentials(*well);
+        if (compute_potential && !reuse_potential)
         {
-            this->computePotentials(widx, well_state_copy, exc_msg, exc_type);
+            wells_to_compute.push_back(widx);
+            well_vfp_versions_[well->name()] = vfp_version;
         }
         ++widx;
     }
+
+    if (!wells_to_compute.empty()) {
+        this->computePotentials(wells_to_compute, well_state_copy, exc_msg, exc_type);
+        if (well_potential_reuse_tol_ > Scalar{0.0}) {
+            for (const auto i : wells_to_compute) {
+                this->storeWellPotentialConditions(*well_container_generic_[i]);
+            }
+        }
+    }
+
     logAndCheckForProblemsAndThrow(deferred_logger, exc_type,
                                    "updateWellPotentials() failed: " + exc_msg,
                                    terminal_output_, comm_);
 }
 
+template<typename Scalar, typename IndexTraits>
+bool BlackoilWellModelGeneric<Scalar, IndexTraits>::
+canReuseWellPotentials(const WellInterfaceGeneric<Scalar, IndexTraits>& well) const
+{
+    const auto cond_it = this->potential_eval_conditions_.find(well.name());
+    if (cond_it == this->potential_eval_conditions_.end()) {
+        return false;
+    }
+
+    const auto& cond = cond_it->second;
+    const auto& ws = this->wellState().well(well.indexOfWell());
+    if (static_cast<int>(ws.status) != cond.status ||
+        static_cast<int>(ws.injection_cmode) != cond.injection_cmode ||
+        static_cast<int>(ws.production_cmode) != cond.production_cmode ||
+        ws.surface_rates.size() != cond.surface_rates.size())
+    {
+        return false;
+    }
+
+    auto close = [tol = this->well_potential_reuse_tol_](const Scalar a, const Scalar b)
+    { return std::abs(a - b) <= tol * std::max(std::abs(a), std::abs(b)); };
+
+    return close(ws.bhp, cond.bhp) &&
+           close(ws.thp, cond.thp) &&
+           std::equal(ws.surface_rates.begin(), ws.surface_rates.end(),
+                      cond.surface_rates.begin(), close);
+}
+
+template<typename Scalar, typename IndexTraits>
+void BlackoilWellModelGeneric<Scalar, IndexTraits>::
+storeWellPotentialConditions(const WellInterfaceGeneric<Scalar, IndexTraits>& well)
+{
+    const auto& ws = this->wellState().well(well.indexOfWell());
+    auto& cond = this->potential_eval_conditions_[well.name()];
+    cond.bhp = ws.bhp;
+    cond.thp = ws.thp;
+    cond.surface_rates = ws.surface_rates;
+    cond.status = static_cast<int>(ws.status);
+    cond.injection_cmode = static_cast<int>(ws.injection_cmode);
+    cond.production_cmode = static_cast<int>(ws.production_cmode);
+}
+
 template<typename Scalar, typename IndexTraits>
 void BlackoilWellModelGeneric<Scalar, IndexTraits>::
 runWellPIScaling(const int reportStepIdx,
@@ -1935,7 +2082,7 @@ operator==(const BlackoilWellModelGeneric& rhs) const
         && this->prev_inj_multipliers_ == rhs.prev_inj_multipliers_
         && this->active_wgstate_ == rhs.active_wgstate_
         && this->last_valid_wgstate_ == rhs.last_valid_wgstate_
-        && this->nupcol_wgstate_ == rhs.nupcol_wgstate_
+        && this->nupcol_well_state_ == rhs.nupcol_well_state_
         && this->switched_prod_groups_ == rhs.switched_prod_groups_
         && this->switched_inj_groups_ == rhs.switched_inj_groups_
         && this->closed_offending_wells_ == rhs.closed_offending_wells_
@@ -71,6 +71,7 @@ namespace Opm {
     class Schedule;
     struct SimulatorUpdate;
     class SummaryConfig;
+    class TaskletRunner;
     template<typename Scalar, typename IndexTraits> class VFPProperties;
     template<typename Scalar, typename IndexTraits> class WellInterfaceGeneric;
     template<typename Scalar, typename IndexTraits> class WellState;
@@ -105,7 +106,7 @@ public:
                              const PhaseUsageInfo<IndexTraits>& phase_usage,
                              const Parallel::Communication& comm);
 
-    virtual ~BlackoilWellModelGeneric() = default;
+    virtual ~BlackoilWellModelGeneric();
     virtual int compressedIndexForInteriorLGR([[maybe_unused]] const std::string& lgr_tag,
                                               [[maybe_unused]] const Connection& conn) const
     {
@@ -137,6 +138,23 @@ public:
 
     const Well& getWellEcl(const std::string& well_name) const;
     std::vector<Well> getLocalWells(const int timeStepIdx) const;
+
+    //! \brief Materialize the local well objects for a report step on a
+    //! background thread.
+    //!
+    //! Dispatched at the end of beginReportStep() for the upcoming report
+    //! step, so that copying the well objects out of the schedule overlaps
+    //! with the time stepping of the current step. The result is picked up
+    //! (or recomputed on a miss) by localWellsForStep().
+    void prefetchLocalWells(const int timeStepIdx);
+
+    //! \brief Join a pending well prefetch and throw its result away.
+    //!
+    //! Must be called before the schedule is modified dynamically (e.g. by
+    //! an ACTIONX block), both because the prefetched wells would be stale
+    //! and because the background thread must not read the schedule while
+    //! it is updated.
+    void discardPrefetchedLocalWells();
     const Schedule& schedule() const { return schedule_; }
     const PhaseUsageInfo<IndexTraits>& phaseUsage() const { return phase_usage_info_; }
     const GroupState<Scalar>& groupState() const { return this->active_wgstate_.group_state; }
@@ -164,7 +182,7 @@ public:
 
     /*
       Will return the currently active nupcolWellState; must update
-      the internal nupcol wellstate with updateNupcolWGState() first.
+      the internal nupcol wellstate with updateNupcolWellState() first.
 
       Both const and non-const accessors are provided. The non-const
       accessor is required for the WellStateGuard pattern and pushWellState()
@@ -172,11 +190,11 @@ public:
     */
     const WellState<Scalar, IndexTraits>& nupcolWellState() const
     {
-        return this->nupcol_wgstate_.well_state;
+        return this->nupcol_well_state_;
     }
     WellState<Scalar, IndexTraits>& nupcolWellState()
     {
-        return this->nupcol_wgstate_.well_state;
+        return this->nupcol_well_state_;
     }
     GroupState<Scalar>& groupState() { return this->active_wgstate_.group_state; }
 
@@ -259,7 +277,7 @@ public:
         serializer(prev_inj_multipliers_);
         serializer(active_wgstate_);
         serializer(last_valid_wgstate_);
-        serializer(nupcol_wgstate_);
+        serializer(nupcol_well_state_);
         serializer(switched_prod_groups_);
         serializer(switched_inj_groups_);
         serializer(closed_offending_wells_);
@@ -332,7 +350,7 @@ protected:
         3. For the NUPCOL functionality we should either use the
            currently active wellstate or a wellstate frozen at max
            nupcol iterations. This is handled with the member
-           nupcol_well_state_ and the updateNupcolWGState() function.
+           nupcol_well_state_ and the updateNupcolWellState() function.
     */
 
     /*
@@ -362,6 +380,17 @@ protected:
         this->last_valid_wgstate_ = std::move(wgstate);
     }
 
+    /*
+      Resolve once which optional well report quantities have a consumer
+      in the summary configuration.  Both well state copies are updated
+      so the resolution survives resetWGState()/commitWGState() cycles.
+    */
+    void resolveWellOutputRequests(const SummaryConfig& summary_config)
+    {
+        this->active_wgstate_.well_state.resolveOutputRequests(summary_config);
+        this->last_valid_wgstate_.well_state.resolveOutputRequests(summary_config);
+    }
+
     /*
       Will update the internal variable active_well_state_ to whatever
       was stored in the last_valid_well_state_ member. This function
@@ -379,10 +408,16 @@ protected:
       Will store the current active wellstate in the nupcol_well_state_
       member. This can then be subsequently retrieved with accessor
       nupcolWellState().
+
+      Only the well state is stored; the group and well test states of
+      the active WGState are never consumed through the nupcol snapshot.
+      Copy assignment reuses the per-well buffers of the previous
+      snapshot, so in steady state this is allocation-free even though
+      it runs every Newton iteration within NUPCOL.
     */
-    void updateNupcolWGState()
+    void updateNupcolWellState()
     {
-        this->nupcol_wgstate_ = this->active_wgstate_;
+        this->nupcol_well_state_ = this->active_wgstate_.well_state;
     }
 
     void reportGroupSwitching(DeferredLogger& local_deferredLogger) const;
@@ -455,7 +490,9 @@ protected:
 
     void setRepRadiusPerfLength();
 
-    virtual void computePotentials(const std::size_t widx,
+    //! \brief Compute the potentials of the given wells, thread parallel
+    //! where the implementation supports it.
+    virtual void computePotentials(const std::vector<std::size_t>& widxs,
                                    const WellState<Scalar, IndexTraits>& well_state_copy,
                                    std::string& exc_msg,
                                    ExceptionType::ExcEnum& exc_type) = 0;
@@ -466,6 +503,15 @@ protected:
                               const SummaryConfig& summaryConfig,
                               DeferredLogger& deferred_logger);
 
+    //! \brief Returns true if the well's operating conditions are within a
+    //! relative tolerance of those at its last potential evaluation, in
+    //! which case the stored potentials can be reused.
+    bool canReuseWellPotentials(const WellInterfaceGeneric<Scalar, IndexTraits>& well) const;
+
+    //! \brief Record the operating conditions a well's potentials were
+    //! evaluated at, for later reuse checks.
+    void storeWellPotentialConditions(const WellInterfaceGeneric<Scalar, IndexTraits>& well);
+
     void initInjMult();
 
     void updateInjMult(DeferredLogger& deferred_logger);
@@ -528,6 +574,38 @@ protected:
     std::vector<Well> wells_ecl_;
     std::vector<std::vector<PerforationData<Scalar>>> well_perf_data_;
 
+    //! \brief Return the local well objects for a report step, consuming a
+    //! prefetched copy if one is available for that step.
+    std::vector<Well> localWellsForStep(const int timeStepIdx);
+
+    // Background materialization of local well objects, see prefetchLocalWells().
+    std::unique_ptr<TaskletRunner> well_prefetch_runner_{};
+    std::vector<Well> prefetched_wells_{};
+    int prefetched_wells_step_ = -1;
+
+    //! \brief Operating conditions at a well's last potential evaluation.
+    //!
+    //! The status and control modes are stored as plain integers to keep
+    //! this header free of the schedule enumeration headers.
+    struct PotentialEvalConditions {
+        Scalar bhp{};
+        Scalar thp{};
+        std::vector<Scalar> surface_rates{};
+        int status = -1;
+        int injection_cmode = -1;
+        int production_cmode = -1;
+    };
+    std::unordered_map<std::string, PotentialEvalConditions> potential_eval_conditions_;
+
+    //! \brief VFP table version each well's potentials were last computed
+    //! with; used to re-run the evaluation only for wells whose table was
+    //! swapped by the schedule.
+    std::unordered_map<std::string, std::size_t> well_vfp_versions_;
+
+    //! \brief Relative tolerance for reusing well potentials, 0 to always
+    //! recompute. Assigned from the model parameters by the derived class.
+    Scalar well_potential_reuse_tol_{0.0};
+
     // Times at which wells were opened (for WCYCLE)
     std::map<std::string, double> well_open_times_;
 
@@ -564,16 +642,20 @@ protected:
       The various wellState members should be accessed and modified
       through the accessor functions wellState(), prevWellState(),
       commitWellState(), resetWellState(), nupcolWellState() and
-      updateNupcolWGState().
+      updateNupcolWellState().
     */
     WGState<Scalar, IndexTraits> active_wgstate_;
     WGState<Scalar, IndexTraits> last_valid_wgstate_;
-    WGState<Scalar, IndexTraits> nupcol_wgstate_;
+    WellState<Scalar, IndexTraits> nupcol_well_state_;
     GroupStateHelperType group_state_helper_;
     WellGroupEvents report_step_start_events_; //!< Well group events at start of report step
 
     bool wellStructureChangedDynamically_{false};
 
+    // Persistent buffer for the fused well/group rate reduction, kept
+    // across iterations to avoid reallocating it each time.
+    std::vector<Scalar> rate_comm_buffer_{};
+
     // Store maps of group name and new group controls for output
     std::map<std::string, std::vector<Group::ProductionCMode>> switched_prod_groups_;
     std::map<std::string, std::array<std::vector<Group::InjectionCMode>, 3>> switched_inj_groups_;
@@ -153,7 +153,8 @@ Scalar
 BlackoilWellModelNetworkGeneric<Scalar, IndexTraits>::
 updatePressures(const int reportStepIdx,
                 const Scalar damping_factor,
-                const Scalar upper_update_bound)
+                const Scalar upper_update_bound,
+                const bool use_newton_update)
 {
     OPM_TIMEFUNCTION();
     // Get the network and return if inactive (no wells in network at this time)
@@ -170,6 +171,10 @@ updatePressures(const int reportStepIdx,
                                              reportStepIdx,
                                              well_model_.comm());
 
+    // The undamped result of this sweep, kept for the secant slope
+    // estimates of the next one.
+    const auto computed_node_pressures = node_pressures_;
+
     // here, the network imbalance is the difference between the previous nodal pressure and the new nodal pressure
     Scalar network_imbalance = 0.;
     if (!this->active()) {
@@ -192,8 +197,34 @@ updatePressures(const int reportStepIdx,
             // We dampen the nodal pressure change during one iteration since our nodal pressure calculation
             // is somewhat explicit. There is a relative dampening factor applied to the update value, and also
             // the maximum update is limited (to 5 bar by default, can be changed with --network-max-pressure-update-in-bars).
-            const Scalar damped_change = std::min(damping_factor * std::abs(change), upper_update_bound);
-            const Scalar sign = change > 0 ? 1. : -1.;
+            Scalar update = damping_factor * change;
+            if (use_newton_update) {
+                // Treat the sweep as a fixed-point map p -> G(p) and take a
+                // Newton step on F(p) = G(p) - p, with dG/dp estimated per
+                // node from the previous sweep by a secant. This resolves the
+                // interaction between the node pressures and the THP
+                // controlled well rates in a few sweeps where the damped
+                // fixed-point iteration needs dozens.
+                const auto in_it = previous_sweep_input_pressures_.find(name);
+                const auto out_it = previous_sweep_computed_pressures_.find(name);
+                if (in_it != previous_sweep_input_pressures_.end() &&
+                    out_it != previous_sweep_computed_pressures_.end())
+                {
+                    const Scalar dp = pressure - in_it->second;
+                    if (std::abs(dp) > Scalar{1e-3}) { // Pa; below this the slope is noise
+                        const Scalar slope = (new_pressure - out_it->second) / dp;
+                        const Scalar denom = Scalar{1.} - slope;
+                        // Only accept well-conditioned steps; a slope close
+                        // to (or above) one means the map is locally
+                        // non-contractive and the damped update is safer.
+                        if (denom > Scalar{0.1}) {
+                            update = change / denom;
+                        }
+                    }
+                }
+            }
+            const Scalar damped_change = std::min(std::abs(update), upper_update_bound);
+            const Scalar sign = update > 0 ? 1. : -1.;
             node_pressures_[name] = pressure + sign * damped_change;
         }
     } else {
@@ -204,6 +235,9 @@ updatePressures(const int reportStepIdx,
         }
     }
 
+    previous_sweep_input_pressures_ = previous_node_pressures;
+    previous_sweep_computed_pressures_ = computed_node_pressures;
+
     for (auto& well : well_model_.genericWells()) {
 
         // Producers only, since we so far only support the
@@ -90,7 +90,18 @@ public:
 
     Scalar updatePressures(const int reportStepIdx,
                            const Scalar damping_factor,
-                           const Scalar update_upper_bound);
+                           const Scalar update_upper_bound,
+                           const bool use_newton_update);
+
+    /// Forget the sweep history used for the secant-based Newton pressure
+    /// updates. Must be called before a new sequence of network
+    /// sub-iterations, so that slopes are never estimated across
+    /// unrelated sweeps.
+    void resetPressureUpdateHistory()
+    {
+        previous_sweep_input_pressures_.clear();
+        previous_sweep_computed_pressures_.clear();
+    }
 
     void assignNodeValues(std::map<std::string, data::NodeData>& nodevalues,
                           const int reportStepIdx) const;
@@ -126,6 +137,12 @@ protected:
     std::map<std::string, Scalar> node_pressures_;
     // Valid network pressures for output and initialization for safe restart after failed iterations
     std::map<std::string, Scalar> last_valid_node_pressures_;
+    // Input and (undamped) computed node pressures of the previous
+    // sub-iteration sweep, used for the secant slope estimates of the
+    // Newton pressure updates. Transient within one balance call,
+    // hence not serialized.
+    std::map<std::string, Scalar> previous_sweep_input_pressures_;
+    std::map<std::string, Scalar> previous_sweep_computed_pressures_;
 };
 
 } // namespace Opm
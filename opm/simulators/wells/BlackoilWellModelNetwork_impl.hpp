@@ -113,12 +113,16 @@ update(const bool mandatory_network_balance,
             well_model_.param().network_pressure_update_damping_factor_;
         const Scalar network_max_pressure_update =
             well_model_.param().network_max_pressure_update_in_bars_ * unit::barsa;
+        const bool use_newton_update =
+            well_model_.param().network_newton_pressure_update_;
         bool more_network_sub_update = false;
+        this->resetPressureUpdateHistory();
         for (int i = 0; i < max_number_of_sub_iterations; i++) {
             const auto local_network_imbalance =
                 this->updatePressures(episodeIdx,
                                       network_pressure_update_damping_factor,
-                                      network_max_pressure_update);
+                                      network_max_pressure_update,
+                                      use_newton_update);
             network_imbalance = comm.max(local_network_imbalance);
             const auto& balance = well_model_.schedule()[episodeIdx].network_balance();
             constexpr Scalar relaxation_factor = 10.0;
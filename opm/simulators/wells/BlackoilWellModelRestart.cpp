@@ -153,6 +153,16 @@ loadRestartWellData(const std::string&                   well_name,
         ws.surface_rates[i] = rst_well.rates.get(phs[i]);
     }
 
+    // Resume gas lift from the ALQ stored in the restart file. Without
+    // this the optimization has to climb from the default ALQ again
+    // after every restart.
+    if (ws.producer && rst_well.rates.has(data::Rates::opt::alq)) {
+        const auto alq = rst_well.rates.get(data::Rates::opt::alq);
+        if (alq > 0.0) {
+            ws.alq_state.set(alq);
+        }
+    }
+
     this->loadRestartConnectionData(phs, rst_well, old_perf_data, ws);
 
     if (handle_ms_well && !rst_well.segments.empty()) {
@@ -55,10 +55,16 @@
 #include <opm/simulators/wells/rescoup/RescoupConstraintsCalculator.hpp>
 #endif
 
+#include <opm/simulators/flow/ConvergenceOutputConfiguration.hpp>
+
+#include <opm/simulators/utils/AllocationTracker.hpp>
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
+#include <opm/simulators/utils/EventProfiler.hpp>
 #if HAVE_MPI
 #include <opm/simulators/utils/MPIPacker.hpp>
 #endif
+#include <opm/simulators/utils/ParallelCommunication.hpp>
+#include <opm/simulators/utils/RooflineCounters.hpp>
 
 #if COMPILE_GPU_BRIDGE
 #include <opm/simulators/linalg/gpubridge/WellContributions.hpp>
@@ -66,6 +72,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <exception>
 #include <iomanip>
 #include <utility>
 #include <optional>
@@ -111,6 +118,13 @@ namespace Opm {
         this->alternative_well_rate_init_ =
             Parameters::Get<Parameters::AlternativeWellRateInit>();
 
+        this->extrapolate_well_guess_ =
+            Parameters::Get<Parameters::ExtrapolateWellGuess>();
+
+        this->well_potential_reuse_tol_ = param_.well_potential_reuse_tol_;
+
+        this->resolveWellOutputRequests(simulator.vanguard().summaryConfig());
+
         using SourceDataSpan =
             typename PAvgDynamicSourceData<Scalar>::template SourceDataSpan<Scalar>;
 
@@ -223,12 +237,18 @@ namespace Opm {
             // purpose of RESV controls.
             this->rateConverter_->template defineState<ElementContext>(this->simulator_);
 
-            // Update VFP properties.
+            // Update VFP properties. The object is kept alive over the
+            // whole run so that it can track table versions; only tables
+            // the schedule actually swapped are replaced.
             {
                 const auto& sched_state = this->schedule()[timeStepIdx];
 
-                this->vfp_properties_ = std::make_unique<VFPProperties<Scalar, IndexTraits>>
-                    (sched_state.vfpinj(), sched_state.vfpprod(), this->wellState());
+                if (this->vfp_properties_ == nullptr) {
+                    this->vfp_properties_ = std::make_unique<VFPProperties<Scalar, IndexTraits>>
+                        (sched_state.vfpinj(), sched_state.vfpprod(), this->wellState());
+                } else {
+                    this->vfp_properties_->updateTables(sched_state.vfpinj(), sched_state.vfpprod());
+                }
             }
         }
         OPM_END_PARALLEL_TRY_CATCH("beginReportStep() failed: ", comm)
@@ -238,6 +258,12 @@ namespace Opm {
         this->commitWGState();
 
         this->wellStructureChangedDynamically_ = false;
+
+        // Start copying the next report step's well objects out of the
+        // schedule while this report step computes. The copy is picked up
+        // by localWellsForStep() at the next beginReportStep(), unless an
+        // action modifies the schedule in the meantime.
+        this->prefetchLocalWells(timeStepIdx + 1);
     }
 
 
@@ -256,7 +282,7 @@ namespace Opm {
         const auto& comm = this->simulator_.vanguard().grid().comm();
 
         // Wells_ecl_ holds this rank's wells, both open and stopped/shut.
-        this->wells_ecl_ = this->getLocalWells(reportStepIdx);
+        this->wells_ecl_ = this->localWellsForStep(reportStepIdx);
         this->local_parallel_well_info_ =
             this->createLocalParallelWellInfo(this->wells_ecl_);
 
@@ -413,6 +439,16 @@ namespace Opm {
             // calculate the efficiency factors for each well
             this->calculateEfficiencyFactors(reportStepIdx);
 
+            if (this->extrapolate_well_guess_) {
+                // warm start the well solves from an extrapolation of the
+                // last converged solutions
+                const double next_time = simulationTime + simulator_.timeStepSize();
+                for (const auto& well : well_container_) {
+                    this->wellState().well(well->indexOfWell())
+                        .extrapolate_initial_guess(next_time);
+                }
+            }
+
             if constexpr (has_polymer_)
             {
                 if (PolymerModule::hasPlyshlog() || getPropValue<TypeTag, Properties::EnablePolymerMW>() ) {
@@ -649,6 +685,12 @@ namespace Opm {
                                             const double simulationTime,
                                             DeferredLogger& deferred_logger)
     {
+        // Create and prepare all candidate wells up front.  The
+        // preparation touches shared state (the candidate's own entries
+        // in the well state) and is cheap, so it stays serial; the
+        // candidates then all see the same pre-test state regardless of
+        // how the expensive test solves below are scheduled.
+        std::vector<WellInterfacePtr> wells_to_test;
         for (const std::string& well_name : this->getWellsForTesting(timeStepIdx, simulationTime)) {
             const Well& wellEcl = this->schedule().getWell(well_name, timeStepIdx);
             if (wellEcl.getStatus() == Well::Status::SHUT)
@@ -681,8 +723,29 @@ namespace Opm {
             if (network.active()) {
                 this->network_.initializeWell(*well);
             }
+
+            wells_to_test.push_back(std::move(well));
+        }
+
+        using GLiftEclWells = typename GasLiftGroupInfo<Scalar, IndexTraits>::GLiftEclWells;
+
+        // The test solves are independent between candidates: each one
+        // works on copies of the well and group state and only merges
+        // its own well's results on success.  Candidates local to this
+        // rank may therefore be tested thread parallel from the shared
+        // pre-test snapshot; wells perforating cells on several ranks
+        // communicate on the well communicator during their solves and
+        // are handled serially, as MPI may not be called from worker
+        // threads.
+        std::vector<WellInterface<TypeTag>*> threaded_wells;
+        for (auto& well : wells_to_test) {
+            if (param_.threaded_well_solves_ &&
+                well->parallelWellInfo().communication().size() == 1)
+            {
+                threaded_wells.push_back(well.get());
+                continue;
+            }
             try {
-                using GLiftEclWells = typename GasLiftGroupInfo<Scalar, IndexTraits>::GLiftEclWells;
                 GLiftEclWells ecl_well_map;
                 gaslift_.initGliftEclWellMap(well_container_, ecl_well_map);
                 well->wellTesting(simulator_,
@@ -695,10 +758,83 @@ namespace Opm {
             } catch (const std::exception& e) {
                 const std::string msg =
                   fmt::format(fmt::runtime("Exception during testing of well: {}. The well will not open.\n"
-                                           "Exception message: {}"), wellEcl.name(), e.what());
+                                           "Exception message: {}"), well->name(), e.what());
                 deferred_logger.warning("WELL_TESTING_FAILED", msg);
             }
         }
+
+        if (threaded_wells.empty()) {
+            return;
+        }
+
+        const int num_wells = static_cast<int>(threaded_wells.size());
+        std::vector<DeferredLogger> well_loggers(num_wells);
+        // Per-candidate results, merged in candidate order below so the
+        // outcome is independent of thread scheduling.  The well state
+        // is only kept for candidates whose test succeeded.
+        std::vector<std::optional<WellState<Scalar, IndexTraits>>> test_states(num_wells);
+        std::vector<WellTestState> test_welltest_states(num_wells);
+        std::vector<std::map<std::string, double>> test_open_times(num_wells);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+        for (int i = 0; i < num_wells; ++i) {
+            auto& well = *threaded_wells[i];
+            GroupStateHelperType helper_copy = this->groupStateHelper();
+            helper_copy.setThreadLocalLogger(&well_loggers[i]);
+            try {
+                GLiftEclWells ecl_well_map;
+                gaslift_.initGliftEclWellMap(well_container_, ecl_well_map);
+                auto well_state_copy = this->wellState();
+                auto welltest_state_copy = this->wellTestState();
+                well.wellTesting(simulator_,
+                                 simulationTime,
+                                 helper_copy,
+                                 well_state_copy,
+                                 welltest_state_copy,
+                                 ecl_well_map,
+                                 test_open_times[i]);
+                // wellTesting() only records an opening time on success.
+                if (test_open_times[i].count(well.name()) > 0) {
+                    test_states[i] = std::move(well_state_copy);
+                    test_welltest_states[i] = std::move(welltest_state_copy);
+                }
+            } catch (const std::exception& e) {
+                const std::string msg =
+                  fmt::format(fmt::runtime("Exception during testing of well: {}. The well will not open.\n"
+                                           "Exception message: {}"), well.name(), e.what());
+                well_loggers[i].warning("WELL_TESTING_FAILED", msg);
+            }
+        }
+
+        for (const auto& logger : well_loggers) {
+            deferred_logger.append(logger);
+        }
+
+        // Deterministic merge: the test solves only modify the tested
+        // well's own entries, so applying the successful candidates in
+        // candidate order reproduces the serial result.
+        for (int i = 0; i < num_wells; ++i) {
+            if (!test_states[i].has_value()) {
+                continue;
+            }
+            auto& well = *threaded_wells[i];
+            const auto& well_name = well.name();
+            this->wellState().well(well.indexOfWell()) =
+                test_states[i]->well(well.indexOfWell());
+            this->wellTestState().open_well(well_name);
+            const Well& wellEcl = this->schedule().getWell(well_name, timeStepIdx);
+            for (const auto& completion : wellEcl.getCompletions()) {
+                if (this->wellTestState().completion_is_closed(well_name, completion.first) &&
+                    !test_welltest_states[i].completion_is_closed(well_name, completion.first))
+                {
+                    this->wellTestState().open_completion(well_name, completion.first);
+                }
+            }
+            for (const auto& [name, time] : test_open_times[i]) {
+                this->well_open_times_.try_emplace(name, time);
+            }
+        }
     }
 
     // called at the end of a report step
@@ -760,6 +896,15 @@ namespace Opm {
         // WINJMULT: At the end of the time step, update the inj_multiplier saved in WellState for later use
         this->updateInjMult(local_deferredLogger);
 
+        if (this->extrapolate_well_guess_) {
+            // record the converged solutions for extrapolating the next
+            // time step's initial guess
+            for (const auto& well : well_container_) {
+                this->wellState().well(well->indexOfWell())
+                    .record_solution_history(simulationTime + dt);
+            }
+        }
+
         // report well switching
         for (const auto& well : well_container_) {
             well->reportWellSwitching(this->wellState().well(well->indexOfWell()), local_deferredLogger);
@@ -1174,6 +1319,9 @@ namespace Opm {
     assemble(const double dt)
     {
         OPM_TIMEFUNCTION();
+        const EventProfiler::Scope profileScope("assembleWells");
+        const AllocationTracker::Scope allocScope(AllocationTracker::Subsystem::Wells);
+        const RooflineCounters::Scope rooflineScope(RooflineCounters::Phase::Wells);
         auto logger_guard = this->groupStateHelper().pushLogger();
         auto& local_deferredLogger = this->groupStateHelper().deferredLogger();
 
@@ -1186,6 +1334,7 @@ namespace Opm {
                 gaslift_.gliftDebug(msg, local_deferredLogger);
             }
         }
+        const bool prev_iteration_changed_controls = last_report_.well_group_control_changed;
         last_report_ = SimulatorReportSingle();
         Dune::Timer perfTimer;
         perfTimer.start();
@@ -1214,9 +1363,33 @@ namespace Opm {
             OPM_END_PARALLEL_TRY_CATCH_LOG(local_deferredLogger,
                                            "assemble() failed during well initialization: ",
                                            this->terminal_output_, grid().comm());
-        }
+            well_residuals_converged_ = false;
+        }
+
+        // In late Newton iterations the control-switching machinery is
+        // almost always a no-op, and occasionally cycles between controls,
+        // costing extra iterations. Once the configured iteration is
+        // reached, the well residuals have converged and the previous
+        // iteration switched nothing, freeze the controls and group targets
+        // and assemble the wells against the cached state. Networks need
+        // their nodal pressures rebalanced every iteration, so freezing is
+        // not applied while one is active. All inputs to this decision are
+        // globally communicated, keeping it collective.
+        const int freeze_iter = param_.well_control_freeze_iteration_;
+        const bool freeze_well_controls = freeze_iter > 0
+            && iterCtx.iteration() >= freeze_iter
+            && well_residuals_converged_
+            && !prev_iteration_changed_controls
+            && !this->schedule()[simulator_.episodeIndex()].network().active();
 
-        const bool well_group_control_changed = updateWellControlsAndNetwork(false, dt, local_deferredLogger);
+        bool well_group_control_changed = false;
+        if (freeze_well_controls) {
+            local_deferredLogger.debug(
+                fmt::format("assemble(): well controls frozen from iteration {}",
+                            iterCtx.iteration()));
+        } else {
+            well_group_control_changed = updateWellControlsAndNetwork(false, dt, local_deferredLogger);
+        }
 
         // even when there is no wells active, the network nodal pressure still need to be updated through updateWellControlsAndNetwork()
         // but there is no need to assemble the well equations
@@ -1397,10 +1570,57 @@ namespace Opm {
         // on one of them (WetGasPvt::saturationPressure might throw if not converged)
         OPM_BEGIN_PARALLEL_TRY_CATCH();
 
+        // Assembly, including the setup of each well's linear solver at its
+        // end, is independent between wells.  Wells local to a single rank
+        // may therefore be assembled thread parallel; wells perforating
+        // cells on several ranks communicate on the well communicator during
+        // assembly and are handled serially, as MPI may not be called from
+        // worker threads.
+        std::vector<WellInterface<TypeTag>*> threaded_wells;
         for (auto& well: well_container_) {
+            if (param_.threaded_well_solves_ &&
+                well->parallelWellInfo().communication().size() == 1)
+            {
+                threaded_wells.push_back(well.get());
+                continue;
+            }
             well->assembleWellEqWithoutIteration(simulator_, this->groupStateHelper(), dt, this->wellState(),
                                                  /*solving_with_zero_rate=*/false);
         }
+
+        if (!threaded_wells.empty()) {
+            std::vector<DeferredLogger> well_loggers(threaded_wells.size());
+            const int num_wells = static_cast<int>(threaded_wells.size());
+            std::exception_ptr assembly_exception;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int i = 0; i < num_wells; ++i) {
+                GroupStateHelperType helper_copy = this->groupStateHelper();
+                helper_copy.setThreadLocalLogger(&well_loggers[i]);
+                try {
+                    threaded_wells[i]->assembleWellEqWithoutIteration(simulator_, helper_copy, dt, this->wellState(),
+                                                                      /*solving_with_zero_rate=*/false);
+                } catch (...) {
+#ifdef _OPENMP
+#pragma omp critical(bwm_assembly_exception)
+#endif
+                    {
+                        if (!assembly_exception) {
+                            assembly_exception = std::current_exception();
+                        }
+                    }
+                }
+            }
+            for (const auto& logger : well_loggers) {
+                deferred_logger.append(logger);
+            }
+            // Rethrow inside the parallel-try-catch scope so failures are
+            // handled the same way as in the serial loop.
+            if (assembly_exception) {
+                std::rethrow_exception(assembly_exception);
+            }
+        }
         OPM_END_PARALLEL_TRY_CATCH_LOG(deferred_logger, "BlackoilWellModel::assembleWellEqWithoutIteration failed: ",
                                        this->terminal_output_, grid().comm());
 
@@ -1619,7 +1839,25 @@ namespace Opm {
         } // logger_guard goes out of scope here, before the OpmLog::debug() calls below
 
         const Opm::Parallel::Communication comm = grid().comm();
-        ConvergenceReport report = gatherConvergenceReport(local_report, comm);
+
+        // Only the INFOITER file consumes the per-well metrics of converged
+        // iterations, so unless that output is enabled the gather may take
+        // the cheap reduction path whenever no rank reports a failure.
+        static const bool collect_all_reports = ConvergenceOutputConfiguration {
+            Parameters::Get<Parameters::OutputExtraConvergenceInfo>(),
+            R"(OutputExtraConvergenceInfo (--output-extra-convergence-info))"
+        }.want(ConvergenceOutputConfiguration::Option::Iterations);
+
+        ConvergenceReport report = [&]() {
+            // Attribute the gather -- including the wait for slower
+            // ranks -- to the well subsystem.
+            const Parallel::WaitTimer waitTimer(Parallel::WaitClass::Wells);
+            return gatherConvergenceReport(local_report, comm, collect_all_reports);
+        }();
+
+        // The gathered report is identical on all ranks, so this flag stays
+        // collective-consistent for the control freeze decision in assemble().
+        well_residuals_converged_ = !report.wellFailed();
 
         if (checkWellGroupControlsAndNetwork) {
             // the well_group_control_changed info is already communicated
@@ -1651,13 +1889,69 @@ namespace Opm {
     {
         // TODO: checking isOperableAndSolvable() ?
         for (auto& well : well_container_) {
-            well->calculateExplicitQuantities(simulator_, this->groupStateHelper());
+            well->calculateExplicitQuantities(simulator_, this->groupStateHelper(),
+                                              this->canReuseConnectionPressures(well->name()));
         }
     }
 
 
 
 
+    template<typename TypeTag>
+    bool
+    BlackoilWellModel<TypeTag>::
+    canReuseConnectionPressures(const std::string& well_name) const
+    {
+        const Scalar tolerance = param_.well_connection_props_reuse_tolerance_;
+        if (!(tolerance > 0.0)) {
+            return false;
+        }
+
+        // Wells touched by schedule events must pick up their new
+        // specification.
+        if (this->report_step_starts_) {
+            const uint64_t effective_events_mask = ScheduleEvents::WELL_STATUS_CHANGE
+                    + ScheduleEvents::WELL_WELSPECS_UPDATE
+                    + ScheduleEvents::COMPLETION_CHANGE
+                    + ScheduleEvents::PRODUCTION_UPDATE
+                    + ScheduleEvents::INJECTION_UPDATE
+                    + ScheduleEvents::INJECTION_TYPE_CHANGED
+                    + ScheduleEvents::WELL_SWITCHED_INJECTOR_PRODUCER
+                    + ScheduleEvents::NEW_WELL;
+
+            const int reportStepIdx = simulator_.episodeIndex();
+            const auto& events = this->schedule()[reportStepIdx].wellgroup_events();
+            if (events.hasEvent(well_name, effective_events_mask)) {
+                return false;
+            }
+        }
+
+        const auto& ws = this->wellState().well(well_name);
+        const auto& prev_ws = this->prevWellState().well(well_name);
+
+        if (ws.status != prev_ws.status ||
+            ws.production_cmode != prev_ws.production_cmode ||
+            ws.injection_cmode != prev_ws.injection_cmode)
+        {
+            return false;
+        }
+
+        // The pressure-drop tables depend on the connection fluid mixture,
+        // which follows the well rates.  Reuse only when the surface rates
+        // are steady relative to the previous time step.
+        Scalar rate_change = 0.0;
+        Scalar rate_scale = 0.0;
+        for (std::size_t p = 0; p < ws.surface_rates.size(); ++p) {
+            rate_change += std::abs(ws.surface_rates[p] - prev_ws.surface_rates[p]);
+            rate_scale += std::abs(prev_ws.surface_rates[p]);
+        }
+
+        return rate_change <= tolerance * rate_scale;
+    }
+
+
+
+
 
     template<typename TypeTag>
     bool
@@ -1683,6 +1977,12 @@ namespace Opm {
             bool changed_well_to_group = false;
             {
                 OPM_TIMEBLOCK(UpdateWellControls);
+                // The wells all evaluate the same per-group guide-rate
+                // recursion against unchanged rates, so memoize it for the
+                // duration of the sweep. A well that switches control
+                // changes the set of group-controlled wells, so the cached
+                // entries are dropped whenever that happens.
+                auto fraction_cache = this->groupStateHelper().pushGuideRateFractionCache();
                 // For MS Wells a linear solve is performed below and the matrix might be singular.
                 // We need to communicate the exception thrown to the others and rethrow.
                 OPM_BEGIN_PARALLEL_TRY_CATCH()
@@ -1692,6 +1992,7 @@ namespace Opm {
                             simulator_, mode, this->groupStateHelper(), this->wellState()
                         );
                         if (changed_well) {
+                            this->groupStateHelper().invalidateGuideRateFractionCache();
                             changed_well_to_group = changed_well || changed_well_to_group;
                         }
                     }
@@ -1892,19 +2193,71 @@ namespace Opm {
 
     template<typename TypeTag>
     void
-    BlackoilWellModel<TypeTag>::computePotentials(const std::size_t widx,
+    BlackoilWellModel<TypeTag>::computePotentials(const std::vector<std::size_t>& widxs,
                                                   const WellState<Scalar, IndexTraits>& well_state_copy,
                                                   std::string& exc_msg,
                                                   ExceptionType::ExcEnum& exc_type)
     {
         OPM_TIMEFUNCTION();
+
+        // The embedded well solves are independent. As for the initial well
+        // solves, wells local to a single rank may be solved thread
+        // parallel, while wells perforating cells on several ranks
+        // communicate on the well communicator and are handled serially.
+        std::vector<std::size_t> threaded_wells;
+        for (const auto widx : widxs) {
+            if (param_.threaded_well_solves_ &&
+                well_container_[widx]->parallelWellInfo().communication().size() == 1)
+            {
+                threaded_wells.push_back(widx);
+            }
+            else {
+                this->computeSingleWellPotentials(widx, well_state_copy,
+                                                  this->groupStateHelper(),
+                                                  exc_msg, exc_type);
+            }
+        }
+
+        if (!threaded_wells.empty()) {
+            const int num_wells = static_cast<int>(threaded_wells.size());
+            std::vector<DeferredLogger> well_loggers(num_wells);
+            std::vector<std::string> well_exc_msgs(num_wells);
+            std::vector<ExceptionType::ExcEnum> well_exc_types(num_wells, ExceptionType::NONE);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int i = 0; i < num_wells; ++i) {
+                GroupStateHelperType helper_copy = this->groupStateHelper();
+                helper_copy.setThreadLocalLogger(&well_loggers[i]);
+                this->computeSingleWellPotentials(threaded_wells[i], well_state_copy,
+                                                  helper_copy,
+                                                  well_exc_msgs[i], well_exc_types[i]);
+            }
+            for (int i = 0; i < num_wells; ++i) {
+                exc_msg += well_exc_msgs[i];
+                exc_type = std::max(exc_type, well_exc_types[i]);
+            }
+            for (const auto& logger : well_loggers) {
+                this->groupStateHelper().deferredLogger().append(logger);
+            }
+        }
+    }
+
+    template<typename TypeTag>
+    void
+    BlackoilWellModel<TypeTag>::computeSingleWellPotentials(const std::size_t widx,
+                                                            const WellState<Scalar, IndexTraits>& well_state_copy,
+                                                            GroupStateHelperType& group_state_helper,
+                                                            std::string& exc_msg,
+                                                            ExceptionType::ExcEnum& exc_type)
+    {
         const int np = this->numPhases();
         std::vector<Scalar> potentials;
         const auto& well = well_container_[widx];
         std::string cur_exc_msg;
         auto cur_exc_type = ExceptionType::NONE;
         try {
-            well->computeWellPotentials(simulator_, well_state_copy, this->groupStateHelper(), potentials);
+            well->computeWellPotentials(simulator_, well_state_copy, group_state_helper, potentials);
         }
         // catch all possible exception and store type and message.
         OPM_PARALLEL_CATCH_CLAUSE(cur_exc_type, cur_exc_msg);
@@ -2011,8 +2364,26 @@ namespace Opm {
             if (events.hasEvent(ScheduleEvents::REQUEST_OPEN_WELL)) {
                 events.clearEvent(ScheduleEvents::REQUEST_OPEN_WELL);
             }
-            // solve the well equation initially to improve the initial solution of the well model
-            if (param_.solve_welleq_initially_ && well->isOperableAndSolvable()) {
+        }
+
+        // solve the well equations initially to improve the initial solution of the well model
+        if (param_.solve_welleq_initially_) {
+            // The wells are independent in this stage.  Wells local to a
+            // single rank may therefore be solved thread parallel; wells
+            // perforating cells on several ranks communicate on the well
+            // communicator during their solve and are handled serially, as
+            // MPI may not be called from worker threads.
+            std::vector<WellInterface<TypeTag>*> threaded_wells;
+            for (const auto& well : well_container_) {
+                if (!well->isOperableAndSolvable()) {
+                    continue;
+                }
+                if (param_.threaded_well_solves_ &&
+                    well->parallelWellInfo().communication().size() == 1)
+                {
+                    threaded_wells.push_back(well.get());
+                    continue;
+                }
                 try {
                     well->solveWellEquation(
                         simulator_, this->groupStateHelper(), this->wellState()
@@ -2022,6 +2393,34 @@ namespace Opm {
                     deferred_logger.warning("WELL_INITIAL_SOLVE_FAILED", msg);
                 }
             }
+
+            if (!threaded_wells.empty()) {
+                // Each thread logs to its own DeferredLogger through a copy
+                // of the group state helper; the messages are merged into the
+                // caller's logger afterwards to keep their handling deterministic.
+                std::vector<DeferredLogger> well_loggers(threaded_wells.size());
+                const int num_wells = static_cast<int>(threaded_wells.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+                for (int i = 0; i < num_wells; ++i) {
+                    auto* well = threaded_wells[i];
+                    GroupStateHelperType helper_copy = this->groupStateHelper();
+                    helper_copy.setThreadLocalLogger(&well_loggers[i]);
+                    try {
+                        well->solveWellEquation(simulator_, helper_copy, this->wellState());
+                    } catch (const std::exception& e) {
+                        const std::string msg = "Compute initial well solution for " + well->name() + " initially failed. Continue with the previous rates";
+                        well_loggers[i].warning("WELL_INITIAL_SOLVE_FAILED", msg);
+                    }
+                }
+                for (const auto& logger : well_loggers) {
+                    deferred_logger.append(logger);
+                }
+            }
+        }
+
+        for (const auto& well : well_container_) {
             // If we're using local well solves that include control switches, they also update
             // operability, so reset before main iterations begin
             well->resetWellOperability();
@@ -166,6 +166,54 @@ FractionCalculator<Scalar, IndexTraits>::
 guideRate(const std::string& name,
           const std::string& always_included_child,
           const bool always_use_potentials)
+{
+    // While a guide-rate fraction cache guard is alive (see
+    // GroupStateHelper::pushGuideRateFractionCache()), memoize the
+    // recursive evaluations so that repeated constraint checks against
+    // unchanged rates do not re-walk the group tree.
+    if (!this->groupStateHelper().guideRateFractionCacheActive()) {
+        return this->computeGuideRate(name, always_included_child, always_use_potentials);
+    }
+
+    const auto key = this->guideRateCacheKey(name, always_included_child, always_use_potentials);
+    if (const auto cached = this->groupStateHelper().cachedGuideRateFraction(key)) {
+        return *cached;
+    }
+    const Scalar value = this->computeGuideRate(name, always_included_child, always_use_potentials);
+    this->groupStateHelper().storeGuideRateFraction(key, value);
+    return value;
+}
+
+template<typename Scalar, typename IndexTraits>
+std::string
+FractionCalculator<Scalar, IndexTraits>::
+guideRateCacheKey(const std::string& name,
+                  const std::string& always_included_child,
+                  const bool always_use_potentials) const
+{
+    // The cache is shared between calculators with different targets and
+    // phases, so everything the evaluation depends on goes into the key.
+    // Well and group names cannot contain '\0', making the composition
+    // unambiguous.
+    std::string key;
+    key.reserve(name.size() + always_included_child.size() + 6);
+    key += name;
+    key += '\0';
+    key += always_included_child;
+    key += '\0';
+    key += static_cast<char>('0' + static_cast<int>(always_use_potentials));
+    key += static_cast<char>('0' + static_cast<int>(is_producer_));
+    key += static_cast<char>('0' + static_cast<int>(target_));
+    key += static_cast<char>('0' + static_cast<int>(injection_phase_));
+    return key;
+}
+
+template<typename Scalar, typename IndexTraits>
+Scalar
+FractionCalculator<Scalar, IndexTraits>::
+computeGuideRate(const std::string& name,
+                 const std::string& always_included_child,
+                 const bool always_use_potentials)
 {
     if (schedule_.hasWell(name, report_step_)) {
         if (guide_rate_->has(name) || guide_rate_->hasPotentials(name)) {
@@ -66,6 +66,14 @@ private:
     Scalar guideRate(const std::string& name,
                      const std::string& always_included_child,
                      const bool always_use_potentials);
+    // uncached worker behind guideRate()
+    Scalar computeGuideRate(const std::string& name,
+                            const std::string& always_included_child,
+                            const bool always_use_potentials);
+    // key for memoizing guideRate() results in the group state helper
+    std::string guideRateCacheKey(const std::string& name,
+                                  const std::string& always_included_child,
+                                  const bool always_use_potentials) const;
     int groupControlledWells(const std::string& group_name,
                              const std::string& always_included_child);
     GuideRate::RateVector getGroupRateVector(const std::string& group_name);
@@ -66,8 +66,7 @@ Scalar
 GasLiftGroupInfo<Scalar, IndexTraits>::
 alqRate(const std::string& group_name)
 {
-    auto& group_rate = this->group_rate_map_.at(group_name);
-    return group_rate.alq();
+    return this->alq_rates_[this->group_idx_.at(group_name)];
 }
 
 template<typename Scalar, typename IndexTraits>
@@ -82,8 +81,7 @@ Scalar
 GasLiftGroupInfo<Scalar, IndexTraits>::
 gasRate(const std::string& group_name) const
 {
-    auto& group_rate = this->group_rate_map_.at(group_name);
-    return group_rate.gasRate();
+    return this->gas_rates_[this->group_idx_.at(group_name)];
 }
 
 template<typename Scalar, typename IndexTraits>
@@ -167,9 +165,10 @@ std::tuple<Scalar, Scalar, Scalar, Scalar>
 GasLiftGroupInfo<Scalar, IndexTraits>::
 getRates(const int group_idx) const
 {
-    const auto& group_name = groupIdxToName(group_idx);
-    auto& rates = this->group_rate_map_.at(group_name);
-    return std::make_tuple(rates.oilRate(), rates.gasRate(), rates.waterRate(), rates.alq());
+    return std::make_tuple(this->oil_rates_[group_idx],
+                           this->gas_rates_[group_idx],
+                           this->water_rates_[group_idx],
+                           this->alq_rates_[group_idx]);
 }
 
 template<typename Scalar, typename IndexTraits>
@@ -201,6 +200,15 @@ getWellGroups(const std::string& well_name)
     return this->well_group_map_[well_name];
 }
 
+template<typename Scalar, typename IndexTraits>
+const std::vector<std::pair<int,Scalar>>&
+GasLiftGroupInfo<Scalar, IndexTraits>::
+getWellGroupsIdx(const std::string& well_name) const
+{
+    assert(this->well_group_idx_map_.count(well_name) == 1);
+    return this->well_group_idx_map_.at(well_name);
+}
+
 template<typename Scalar, typename IndexTraits>
 const std::string&
 GasLiftGroupInfo<Scalar, IndexTraits>::
@@ -282,8 +290,7 @@ Scalar
 GasLiftGroupInfo<Scalar, IndexTraits>::
 oilRate(const std::string& group_name) const
 {
-    auto& group_rate = this->group_rate_map_.at(group_name);
-    return group_rate.oilRate();
+    return this->oil_rates_[this->group_idx_.at(group_name)];
 }
 
 template<typename Scalar, typename IndexTraits>
@@ -318,8 +325,7 @@ Scalar
 GasLiftGroupInfo<Scalar, IndexTraits>::
 waterRate(const std::string& group_name) const
 {
-    auto& group_rate = this->group_rate_map_.at(group_name);
-    return group_rate.waterRate();
+    return this->water_rates_[this->group_idx_.at(group_name)];
 }
 
 template<typename Scalar, typename IndexTraits>
@@ -339,8 +345,24 @@ update(const std::string& group_name,
         Scalar delta_water,
         Scalar delta_alq)
 {
-    auto& group_rate = this->group_rate_map_.at(group_name);
-    group_rate.update(delta_oil, delta_gas, delta_water, delta_alq);
+    update(this->group_idx_.at(group_name),
+           delta_oil, delta_gas, delta_water, delta_alq);
+}
+
+template<typename Scalar, typename IndexTraits>
+void GasLiftGroupInfo<Scalar, IndexTraits>::
+update(int group_idx,
+       Scalar delta_oil,
+       Scalar delta_gas,
+       Scalar delta_water,
+       Scalar delta_alq)
+{
+    // NOTE: We do not update the potentials at this point. They are only
+    //   needed initially.
+    this->oil_rates_[group_idx] += delta_oil;
+    this->gas_rates_[group_idx] += delta_gas;
+    this->water_rates_[group_idx] += delta_water;
+    this->alq_rates_[group_idx] += delta_alq;
 }
 
 template<typename Scalar, typename IndexTraits>
@@ -351,9 +373,10 @@ updateRate(int idx,
            Scalar water_rate,
            Scalar alq)
 {
-    const auto& group_name = groupIdxToName(idx);
-    auto& rates = this->group_rate_map_.at(group_name);
-    rates.assign(oil_rate, gas_rate, water_rate, alq);
+    this->oil_rates_[idx] = oil_rate;
+    this->gas_rates_[idx] = gas_rate;
+    this->water_rates_[idx] = water_rate;
+    this->alq_rates_[idx] = alq;
 }
 
 /****************************************
@@ -684,8 +707,18 @@ initializeGroupRatesRecursive_(const Group& group)
     }
     if (oil_target || liquid_target || water_target || gas_target || max_total_gas || max_alq) {
         updateGroupIdxMap_(group.name());
+        const int group_idx = this->group_idx_.at(group.name());
+        if (static_cast<int>(this->oil_rates_.size()) <= group_idx) {
+            this->oil_rates_.resize(group_idx + 1);
+            this->gas_rates_.resize(group_idx + 1);
+            this->water_rates_.resize(group_idx + 1);
+            this->alq_rates_.resize(group_idx + 1);
+        }
+        this->oil_rates_[group_idx] = oil_rate;
+        this->gas_rates_[group_idx] = gas_rate;
+        this->water_rates_[group_idx] = water_rate;
+        this->alq_rates_[group_idx] = alq;
         this->group_rate_map_.try_emplace(group.name(),
-            oil_rate, gas_rate, water_rate, alq,
             oil_potential, gas_potential, water_potential,
             oil_target, gas_target, water_target, liquid_target, max_total_gas, max_alq);
         if (this->debug) {
@@ -757,6 +790,7 @@ initializeWell2GroupMapRecursive_(const Group& group,
                       {well_name, /*empty vector*/ {}});
                 assert(success);
                 auto& vec = itr->second;
+                auto& idx_vec = this->well_group_idx_map_[well_name];
                 assert(group_names.size() == group_efficiency.size());
                 auto iter2 = group_efficiency.begin();
                 for (auto iter1 = group_names.begin();
@@ -764,6 +798,7 @@ initializeWell2GroupMapRecursive_(const Group& group,
                 {
                     Scalar efficiency = (*iter2) * wfac;
                     vec.emplace_back(/*group_name=*/*iter1, efficiency);
+                    idx_vec.emplace_back(this->group_idx_.at(*iter1), efficiency);
                     ++iter2;
                 }
             }
@@ -54,6 +54,11 @@ protected:
     //    to the well group.
     using Well2GroupMap =
         std::map<std::string, std::vector<std::pair<std::string, Scalar>>>;
+    // Same mapping as Well2GroupMap, but with the groups resolved to their
+    //   group index so the optimization loops can update the group rate
+    //   arrays without any string lookups.
+    using Well2GroupIdxMap =
+        std::map<std::string, std::vector<std::pair<int, Scalar>>>;
     using GroupRateMap =
         std::map<std::string, GroupRates>;
     using GroupIdxMap = std::map<std::string, int>;
@@ -77,6 +82,9 @@ public:
     std::vector<std::pair<std::string,Scalar>>&
     getWellGroups(const std::string& well_name);
 
+    const std::vector<std::pair<int,Scalar>>&
+    getWellGroupsIdx(const std::string& well_name) const;
+
     Scalar alqRate(const std::string& group_name);
     Scalar gasRate(const std::string& group_name) const;
     Scalar gasPotential(const std::string& group_name) const;
@@ -105,6 +113,11 @@ public:
                 Scalar delta_gas,
                 Scalar delta_water,
                 Scalar delta_alq);
+    void update(int group_idx,
+                Scalar delta_oil,
+                Scalar delta_gas,
+                Scalar delta_water,
+                Scalar delta_alq);
     void updateRate(int idx,
                     Scalar oil_rate,
                     Scalar gas_rate,
@@ -148,13 +161,15 @@ protected:
                                            Scalar cur_efficiency);
     void updateGroupIdxMap_(const std::string& group_name);
 
+    // NOTE: The live (mutable) group rates are not stored here. They live
+    //   in the rate arrays below, indexed by group index, so the
+    //   fixed-point iterations in stage 1 and stage 2 can update them in
+    //   tight loops without any string lookups. GroupRates keeps the
+    //   static per-group data: the potentials (only needed initially) and
+    //   the targets and limits.
     class GroupRates {
     public:
-        GroupRates(Scalar oil_rate,
-                   Scalar gas_rate,
-                   Scalar water_rate,
-                   Scalar alq,
-                   Scalar oil_potential,
+        GroupRates(Scalar oil_potential,
                    Scalar gas_potential,
                    Scalar water_potential,
                    std::optional<Scalar> oil_target,
@@ -163,11 +178,7 @@ protected:
                    std::optional<Scalar> liquid_target,
                    std::optional<Scalar> total_gas,
                    std::optional<Scalar> max_alq)
-            : oil_rate_{oil_rate}
-            , gas_rate_{gas_rate}
-            , water_rate_{water_rate}
-            , alq_{alq}
-            , oil_potential_{oil_potential}
+            : oil_potential_{oil_potential}
             , gas_potential_{gas_potential}
             , water_potential_{water_potential}
             , oil_target_{oil_target}
@@ -178,48 +189,17 @@ protected:
             , max_alq_{max_alq}
         {}
 
-        Scalar alq() const { return alq_; }
-        void assign(Scalar oil_rate,
-                    Scalar gas_rate,
-                    Scalar water_rate,
-                    Scalar alq)
-        {
-            oil_rate_ = oil_rate;
-            gas_rate_ = gas_rate;
-            water_rate_ = water_rate;
-            alq_ = alq;
-        }
-        Scalar gasRate() const { return gas_rate_; }
-        Scalar waterRate() const { return water_rate_; }
         std::optional<Scalar> gasTarget() const { return gas_target_; }
         std::optional<Scalar> waterTarget() const { return water_target_; }
         std::optional<Scalar> maxAlq() const { return max_alq_; }
         std::optional<Scalar > maxTotalGasRate() const { return total_gas_; }
-        Scalar oilRate() const { return oil_rate_; }
         std::optional<Scalar> oilTarget() const { return oil_target_; }
         std::optional<Scalar> liquidTarget() const { return liquid_target_; }
         Scalar oilPotential() const { return oil_potential_; }
         Scalar gasPotential() const { return gas_potential_; }
         Scalar waterPotential() const { return water_potential_; }
 
-        void update(Scalar delta_oil,
-                    Scalar delta_gas,
-                    Scalar delta_water,
-                    Scalar delta_alq)
-        {
-            oil_rate_ += delta_oil;
-            gas_rate_ += delta_gas;
-            water_rate_ += delta_water;
-            alq_ += delta_alq;
-            // Note. We don't updata the potentials at this point. They
-            // are only needed initially.
-        }
-
     private:
-        Scalar oil_rate_;
-        Scalar gas_rate_;
-        Scalar water_rate_;
-        Scalar alq_;
         Scalar oil_potential_;
         Scalar gas_potential_;
         Scalar water_potential_;
@@ -240,7 +220,14 @@ protected:
     const GasLiftOpt& glo_;
     GroupRateMap group_rate_map_;
     Well2GroupMap well_group_map_;
+    Well2GroupIdxMap well_group_idx_map_;
     GroupIdxMap group_idx_;
+    // Live group rates in struct-of-arrays layout, indexed by the group
+    //   index from group_idx_.
+    std::vector<Scalar> oil_rates_;
+    std::vector<Scalar> gas_rates_;
+    std::vector<Scalar> water_rates_;
+    std::vector<Scalar> alq_rates_;
     int next_group_idx_ = 0;
     // Optimize only wells under THP control
     bool optimize_only_thp_wells_ = false;
@@ -1381,14 +1381,13 @@ updateGroupRates_(const LimitedRatesAndBhp& rates,
     Scalar delta_oil = new_rates.oil - rates.oil;
     Scalar delta_gas = new_rates.gas - rates.gas;
     Scalar delta_water = new_rates.water - rates.water;
-    const auto& pairs = this->group_info_.getWellGroups(this->well_name_);
-    for (const auto& [group_name, efficiency] : pairs) {
-        int idx = this->group_info_.getGroupIdx(group_name);
+    const auto& pairs = this->group_info_.getWellGroupsIdx(this->well_name_);
+    for (const auto& [idx, efficiency] : pairs) {
         // This will notify the optimize loop in BlackoilWellModel, see
         //   gasLiftOptimizationStage1() in BlackoilWellModel_impl.hpp
         // that this group_info needs to be synchronized to the other MPI ranks
         this->sync_groups_.insert(idx);
-        this->group_info_.update(group_name,
+        this->group_info_.update(idx,
                                  efficiency * delta_oil,
                                  efficiency * delta_gas,
                                  efficiency * delta_water,
@@ -288,10 +288,8 @@ std::tuple<Scalar, Scalar, Scalar, Scalar>
 GasLiftStage2<Scalar, IndexTraits>::
 getCurrentGroupRates_(const Group& group)
 {
-    return {this->group_info_.oilRate(group.name()),
-            this->group_info_.gasRate(group.name()),
-            this->group_info_.waterRate(group.name()),
-            this->group_info_.alqRate(group.name())};
+    // resolve the group index once instead of four string lookups
+    return this->group_info_.getRates(this->group_info_.getGroupIdx(group.name()));
 }
 
 template<typename Scalar, typename IndexTraits>
@@ -811,9 +809,11 @@ updateGroupInfo(const std::string& well_name, bool add)
     const auto delta = computeDelta(well_name, add);
     const auto& [delta_oil, delta_gas, delta_water, delta_alq] = delta;
     if (this->group_info_.hasWell(well_name)) {
-        const auto& pairs = this->group_info_.getWellGroups(well_name);
-       for (const auto& [group_name, efficiency] : pairs) {
-            this->group_info_.update(group_name,
+        // use the index-resolved mapping; this is the hot loop of the
+        // stage 2 fixed-point iteration and should not do string lookups
+        const auto& pairs = this->group_info_.getWellGroupsIdx(well_name);
+        for (const auto& [group_idx, efficiency] : pairs) {
+            this->group_info_.update(group_idx,
                                      efficiency * delta_oil,
                                      efficiency * delta_gas,
                                      efficiency * delta_water,
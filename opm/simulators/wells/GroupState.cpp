@@ -608,6 +608,46 @@ get_production_group_potential(const std::string& gname) const
     return this->production_group_potentials.at(gname);
 }
 
+template<class Scalar>
+std::size_t GroupState<Scalar>::data_size() const
+{
+    std::size_t sz = 0;
+    forAllRateVectors(*this, [&sz](const auto& v) { sz += v.size(); });
+    return sz + this->inj_vrep_rate.size();
+}
+
+template<class Scalar>
+std::size_t GroupState<Scalar>::collect(Scalar* data) const
+{
+    std::size_t pos = 0;
+    forAllRateVectors(*this, [data, &pos](const auto& v)
+                      {
+                          for (const auto& x : v) {
+                              data[pos++] = x;
+                          }
+                      });
+    for (const auto& x : this->inj_vrep_rate) {
+        data[pos++] = x.second;
+    }
+    return pos;
+}
+
+template<class Scalar>
+std::size_t GroupState<Scalar>::distribute(const Scalar* data)
+{
+    std::size_t pos = 0;
+    forAllRateVectors(*this, [data, &pos](auto& v)
+                      {
+                          for (auto& x : v) {
+                              x = data[pos++];
+                          }
+                      });
+    for (auto& x : this->inj_vrep_rate) {
+        x.second = data[pos++];
+    }
+    return pos;
+}
+
 template class GroupState<double>;
 
 #if FLOW_INSTANTIATE_FLOAT
@@ -129,8 +129,13 @@ public:
     );
     const GroupPotential& get_production_group_potential(const std::string& gname) const;
 
+    /// Number of scalars exchanged between ranks by communicate_rates().
     std::size_t data_size() const;
+    /// Flatten the rate containers into data; returns the number of
+    /// scalars written. data must hold at least data_size() entries.
     std::size_t collect(Scalar* data) const;
+    /// Scatter (summed) data back into the rate containers; returns the
+    /// number of scalars read.
     std::size_t distribute(const Scalar* data);
 
     GPMaint::State& gpmaint(const std::string& gname);
@@ -138,71 +143,15 @@ public:
     template<class Comm>
     void communicate_rates(const Comm& comm)
     {
-        // Note that injection_group_vrep_rates is handled separate from
-        // the forAllGroupData() function, since it contains single doubles,
-        // not vectors.
-
-        // Create a function that calls some function
-        // for all the individual data items to simplify
-        // the further code.
-        auto iterateContainer = [](auto& container, const auto& func) {
-            for (auto& x : container) {
-                func(x.second);
-            }
-        };
-
-
-        auto forAllGroupData = [&](auto& func) {
-            iterateContainer(m_production_rates, func);
-            iterateContainer(m_network_leaf_node_production_rates, func);
-            iterateContainer(prod_red_rates, func);
-            iterateContainer(inj_red_rates, func);
-            iterateContainer(inj_resv_rates, func);
-            iterateContainer(inj_rein_rates, func);
-            iterateContainer(inj_surface_rates, func);
-        };
-
-        // Compute the size of the data.
-        std::size_t sz = 0;
-        auto computeSize = [&sz](const auto& v) {
-            sz += v.size();
-        };
-        forAllGroupData(computeSize);
-        sz += this->inj_vrep_rate.size();
-
-        // Make a vector and collect all data into it.
-        std::vector<Scalar> data(sz);
-        std::size_t pos = 0;
-
-        // That the collect function mutates the vector v is an artifact for
-        // testing.
-        auto doCollect = [&data, &pos](auto& v) {
-            for (auto& x : v) {
-                data[pos++] = x;
-                x = -1;
-            }
-        };
-        forAllGroupData(doCollect);
-        for (const auto& x : this->inj_vrep_rate) {
-            data[pos++] = x.second;
-        }
-        if (pos != sz)
+        // Flatten all rate containers into one contiguous buffer so that
+        // a single sum() call suffices.
+        std::vector<Scalar> data(this->data_size());
+        if (this->collect(data.data()) != data.size())
             throw std::logic_error("Internal size mismatch when collecting groupData");
 
-        // Communicate it with a single sum() call.
         comm.sum(data.data(), data.size());
 
-        // Distribute the summed vector to the data items.
-        pos = 0;
-        auto doDistribute = [&data, &pos](auto& v) {
-            std::copy_n(data.begin() + pos, v.size(), v.begin());
-            pos += v.size();
-        };
-        forAllGroupData(doDistribute);
-        for (auto& x : this->inj_vrep_rate) {
-            x.second = data[pos++];
-        }
-        if (pos != sz)
+        if (this->distribute(data.data()) != data.size())
             throw std::logic_error("Internal size mismatch when distributing groupData");
     }
 
@@ -230,6 +179,27 @@ public:
     }
 
 private:
+    // Apply func to every rate vector that takes part in the
+    // communicate_rates() exchange, in a fixed order. Note that
+    // inj_vrep_rate is handled separately by the callers, since it
+    // contains single scalars, not vectors.
+    template<class Self, class Func>
+    static void forAllRateVectors(Self& self, Func&& func)
+    {
+        auto iterateContainer = [&func](auto& container) {
+            for (auto& x : container) {
+                func(x.second);
+            }
+        };
+        iterateContainer(self.m_production_rates);
+        iterateContainer(self.m_network_leaf_node_production_rates);
+        iterateContainer(self.prod_red_rates);
+        iterateContainer(self.inj_red_rates);
+        iterateContainer(self.inj_resv_rates);
+        iterateContainer(self.inj_rein_rates);
+        iterateContainer(self.inj_surface_rates);
+    }
+
     std::size_t num_phases{};
     std::map<std::string, std::vector<Scalar>> m_production_rates;
     std::map<std::string, std::vector<Scalar>> m_network_leaf_node_production_rates;
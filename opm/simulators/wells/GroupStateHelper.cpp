@@ -67,6 +67,28 @@ GroupStateHelper<Scalar, IndexTraits>::GroupStateHelper(WellState<Scalar, IndexT
 // Public methods
 // ---------------------------------------------------------------------
 
+template <typename Scalar, typename IndexTraits>
+const Group&
+GroupStateHelper<Scalar, IndexTraits>::getGroup(const std::string& group_name) const
+{
+    auto [it, inserted] = this->group_cache_.try_emplace(group_name, nullptr);
+    if (inserted) {
+        it->second = &this->schedule_.getGroup(group_name, this->report_step_);
+    }
+    return *it->second;
+}
+
+template <typename Scalar, typename IndexTraits>
+const Well&
+GroupStateHelper<Scalar, IndexTraits>::getWell(const std::string& well_name) const
+{
+    auto [it, inserted] = this->well_cache_.try_emplace(well_name, nullptr);
+    if (inserted) {
+        it->second = &this->schedule_.getWell(well_name, this->report_step_);
+    }
+    return *it->second;
+}
+
 template <typename Scalar, typename IndexTraits>
 void
 GroupStateHelper<Scalar, IndexTraits>::accumulateGroupEfficiencyFactor(const Group& group,
@@ -74,7 +96,7 @@ GroupStateHelper<Scalar, IndexTraits>::accumulateGroupEfficiencyFactor(const Gro
 {
     factor *= group.getGroupEfficiencyFactor();
     if (group.parent() != "FIELD" && !group.parent().empty())
-        this->accumulateGroupEfficiencyFactor(this->schedule_.getGroup(group.parent(), this->report_step_),
+        this->accumulateGroupEfficiencyFactor(this->getGroup(group.parent()),
                                               factor);
 }
 
@@ -109,7 +131,7 @@ GroupStateHelper<Scalar, IndexTraits>::checkGroupConstraintsInj(const std::strin
             return std::make_pair(false, Scalar(1));
         }
         // Otherwise: check production share of parent's control.
-        const auto& parent_group = this->schedule_.getGroup(group.parent(), this->report_step_);
+        const auto& parent_group = this->getGroup(group.parent());
         return this->checkGroupConstraintsInj(name,
                                               parent,
                                               parent_group,
@@ -164,7 +186,7 @@ GroupStateHelper<Scalar, IndexTraits>::checkGroupConstraintsInj(const std::strin
             if (this->guide_rate_.has(chain[ii], injection_phase)) {
                 const auto& guided_group = chain[ii];
                 const Scalar grefficiency
-                    = this->schedule_.getGroup(guided_group, this->report_step_).getGroupEfficiencyFactor();
+                    = this->getGroup(guided_group).getGroupEfficiencyFactor();
                 const Scalar current_rate_fraction = grefficiency * local_current_rate_lambda(guided_group)
                     / local_current_rate_lambda(chain[ii - 1]);
                 const Scalar guiderate_fraction = local_fraction_lambda(guided_group);
@@ -244,7 +266,7 @@ GroupStateHelper<Scalar, IndexTraits>::checkGroupConstraintsProd(const std::stri
             return std::make_pair(false, 1);
         }
         // Otherwise: check production share of parent's control.
-        const auto& parent_group = this->schedule_.getGroup(group.parent(), this->report_step_);
+        const auto& parent_group = this->getGroup(group.parent());
         return this->checkGroupConstraintsProd(name,
                                                parent,
                                                parent_group,
@@ -305,7 +327,7 @@ GroupStateHelper<Scalar, IndexTraits>::checkGroupConstraintsProd(const std::stri
             if (this->guide_rate_.has(chain[ii])) {
                 const auto& guided_group = chain[ii];
                 const Scalar grefficiency
-                    = this->schedule_.getGroup(guided_group, this->report_step_).getGroupEfficiencyFactor();
+                    = this->getGroup(guided_group).getGroupEfficiencyFactor();
                 const Scalar current_rate_fraction = grefficiency * local_current_rate_lambda(guided_group)
                     / (local_current_rate_lambda(chain[ii - 1]));
                 const Scalar guiderate_fraction = local_fraction_lambda(guided_group);
@@ -567,7 +589,7 @@ getAutoChokeGroupProductionTargetRate(const Group& bottom_group,
             return std::make_pair(1.0, currentGroupControl);
         } else {
             // Produce share of parents control
-            const auto& parent = this->schedule_.getGroup(group.parent(), this->report_step_);
+            const auto& parent = this->getGroup(group.parent());
             efficiencyFactor *= group.getGroupEfficiencyFactor();
             return this->getAutoChokeGroupProductionTargetRate(bottom_group, parent,
                                                                resv_coeff, efficiencyFactor);
@@ -677,7 +699,7 @@ GroupStateHelper<Scalar, IndexTraits>::getWellGroupTargetInjector(const std::str
             return std::nullopt;
         }
         // Otherwise: check production share of parent's control.
-        const auto& parent_group = this->schedule_.getGroup(group.parent(), this->report_step_);
+        const auto& parent_group = this->getGroup(group.parent());
         return this->getWellGroupTargetInjector(name,
                                                 parent,
                                                 parent_group,
@@ -771,7 +793,7 @@ GroupStateHelper<Scalar, IndexTraits>::getWellGroupTargetProducer(const std::str
             return std::nullopt;
         }
         // Otherwise: check production share of parent's control.
-        const auto& parent_group = this->schedule_.getGroup(group.parent(), this->report_step_);
+        const auto& parent_group = this->getGroup(group.parent());
         return this->getWellGroupTargetProducer(name,
                                                 parent,
                                                 parent_group,
@@ -856,9 +878,9 @@ GroupStateHelper<Scalar, IndexTraits>::groupChainTopBot(const std::string& botto
     // Get initial parent, 'bottom' can be a well or a group.
     std::string parent;
     if (this->schedule_.hasWell(bottom, this->report_step_)) {
-        parent = this->schedule_.getWell(bottom, this->report_step_).groupName();
+        parent = this->getWell(bottom).groupName();
     } else {
-        parent = this->schedule_.getGroup(bottom, this->report_step_).parent();
+        parent = this->getGroup(bottom).parent();
     }
 
     // Build the chain from bottom to top.
@@ -866,7 +888,7 @@ GroupStateHelper<Scalar, IndexTraits>::groupChainTopBot(const std::string& botto
     chain.push_back(bottom);
     chain.push_back(parent);
     while (parent != top) {
-        parent = this->schedule_.getGroup(parent, this->report_step_).parent();
+        parent = this->getGroup(parent).parent();
         chain.push_back(parent);
     }
     assert(chain.back() == top);
@@ -933,7 +955,7 @@ GroupStateHelper<Scalar, IndexTraits>::setCmodeGroup(const Group& group)
 {
 
     for (const std::string& group_name : group.groups()) {
-        this->setCmodeGroup(this->schedule_.getGroup(group_name, this->report_step_));
+        this->setCmodeGroup(this->getGroup(group_name));
     }
 
     // use NONE as default control
@@ -991,7 +1013,7 @@ GroupStateHelper<Scalar, IndexTraits>::sumSolventRates(const Group& group, const
 {
     Scalar rate = 0.0;
     for (const std::string& group_name : group.groups()) {
-        const Group& group_tmp = this->schedule_.getGroup(group_name, this->report_step_);
+        const Group& group_tmp = this->getGroup(group_name);
         const auto& gefac = group_tmp.getGroupEfficiencyFactor();
         rate += gefac * this->sumSolventRates(group_tmp, is_injector);
     }
@@ -1006,7 +1028,7 @@ GroupStateHelper<Scalar, IndexTraits>::sumSolventRates(const Group& group, const
             continue;
         }
 
-        const auto& well_ecl = this->schedule_.getWell(well_name, this->report_step_);
+        const auto& well_ecl = this->getWell(well_name);
         // only count producers or injectors
         if ((well_ecl.isProducer() && is_injector) || (well_ecl.isInjector() && !is_injector))
             continue;
@@ -1033,6 +1055,44 @@ GroupStateHelper<Scalar, IndexTraits>::sumWellPhaseRates(bool res_rates,
                                                         const int phase_pos,
                                                         const bool is_injector,
                                                         const bool network) const
+{
+    // Memoize the recursive sums while a GroupRateCacheGuard is alive (see
+    // pushGroupRateCache()). The cache is per-rank: whatever this rank would
+    // compute for (group, args) is stored, including the rank-dependent
+    // satellite and reservoir-coupling results, so no communication pattern
+    // changes. When the well state is switched via pushWellState() the cache
+    // is cleared and rebound, so entries always belong to the active state.
+    if (!this->group_rate_cache_active_ || phase_pos < 0 || phase_pos >= 3) {
+        return this->sumWellPhaseRatesUncached_(res_rates, group, phase_pos, is_injector, network);
+    }
+    if (this->well_state_ != this->group_rate_cache_state_) {
+        this->group_rate_cache_.clear();
+        this->group_rate_cache_state_ = this->well_state_;
+    }
+
+    const int slot = ((phase_pos * 2 + static_cast<int>(res_rates)) * 2
+                      + static_cast<int>(is_injector)) * 2 + static_cast<int>(network);
+    auto& entry = this->group_rate_cache_[group.name()];
+    if (!entry.valid.test(slot)) {
+        // Note: the recursion below may rehash group_rate_cache_ and
+        // invalidate 'entry', so the result is stored through a fresh lookup.
+        const Scalar rate
+            = this->sumWellPhaseRatesUncached_(res_rates, group, phase_pos, is_injector, network);
+        auto& stored = this->group_rate_cache_[group.name()];
+        stored.values[slot] = rate;
+        stored.valid.set(slot);
+        return rate;
+    }
+    return entry.values[slot];
+}
+
+template <typename Scalar, typename IndexTraits>
+Scalar
+GroupStateHelper<Scalar, IndexTraits>::sumWellPhaseRatesUncached_(bool res_rates,
+                                                                 const Opm::Group& group,
+                                                                 const int phase_pos,
+                                                                 const bool is_injector,
+                                                                 const bool network) const
 {
     if (this->isRank0()) {
         // Only obtain satellite rates once (on rank 0)
@@ -1059,7 +1119,7 @@ GroupStateHelper<Scalar, IndexTraits>::sumWellPhaseRates(bool res_rates,
     }
     Scalar rate = 0.0;
     for (const std::string& group_name : group.groups()) {
-        const auto& group_tmp = this->schedule_.getGroup(group_name, this->report_step_);
+        const auto& group_tmp = this->getGroup(group_name);
         const auto& gefac = group_tmp.getGroupEfficiencyFactor(network);
         rate += gefac * this->sumWellPhaseRates(res_rates, group_tmp, phase_pos, is_injector, network);
     }
@@ -1074,7 +1134,7 @@ GroupStateHelper<Scalar, IndexTraits>::sumWellPhaseRates(bool res_rates,
             continue;
         }
 
-        const auto& well_ecl = this->schedule_.getWell(well_name, this->report_step_);
+        const auto& well_ecl = this->getWell(well_name);
         // only count producers or injectors
         if ((well_ecl.isProducer() && is_injector) || (well_ecl.isInjector() && !is_injector))
             continue;
@@ -1158,7 +1218,7 @@ GroupStateHelper<Scalar, IndexTraits>::updateGroupProductionRates(const Group& g
 {
     OPM_TIMEFUNCTION();
     for (const std::string& group_name : group.groups()) {
-        const Group& group_tmp = this->schedule_.getGroup(group_name, this->report_step_);
+        const Group& group_tmp = this->getGroup(group_name);
         this->updateGroupProductionRates(group_tmp);
     }
     const int np = this->numPhases();
@@ -1281,7 +1341,7 @@ GroupStateHelper<Scalar, IndexTraits>::updateREINForGroups(const Group& group,
     OPM_TIMEFUNCTION();
     const int np = this->numPhases();
     for (const std::string& groupName : group.groups()) {
-        const Group& group_tmp = this->schedule_.getGroup(groupName, this->report_step_);
+        const Group& group_tmp = this->getGroup(groupName);
         this->updateREINForGroups(group_tmp, sum_rank);
     }
 
@@ -1311,7 +1371,7 @@ GroupStateHelper<Scalar, IndexTraits>::updateReservoirRatesInjectionGroups(const
 {
     OPM_TIMEFUNCTION();
     for (const std::string& group_name : group.groups()) {
-        const Group& group_tmp = this->schedule_.getGroup(group_name, this->report_step_);
+        const Group& group_tmp = this->getGroup(group_name);
         this->updateReservoirRatesInjectionGroups(group_tmp);
     }
     const int np = this->numPhases();
@@ -1370,7 +1430,7 @@ GroupStateHelper<Scalar, IndexTraits>::updateSurfaceRatesInjectionGroups(const G
 {
     OPM_TIMEFUNCTION();
     for (const std::string& group_name : group.groups()) {
-        const Group& group_tmp = this->schedule_.getGroup(group_name, this->report_step_);
+        const Group& group_tmp = this->getGroup(group_name);
         this->updateSurfaceRatesInjectionGroups(group_tmp);
     }
     const int np = this->numPhases();
@@ -1392,7 +1452,7 @@ GroupStateHelper<Scalar, IndexTraits>::updateVREPForGroups(const Group& group)
 {
     OPM_TIMEFUNCTION();
     for (const std::string& group_name : group.groups()) {
-        const Group& group_tmp = this->schedule_.getGroup(group_name, this->report_step_);
+        const Group& group_tmp = this->getGroup(group_name);
         this->updateVREPForGroups(group_tmp);
     }
     const int np = this->numPhases();
@@ -1412,7 +1472,7 @@ GroupStateHelper<Scalar, IndexTraits>::updateWellRates(const Group& group,
 {
     OPM_TIMEFUNCTION();
     for (const std::string& group_name : group.groups()) {
-        const Group& group_tmp = this->schedule_.getGroup(group_name, this->report_step_);
+        const Group& group_tmp = this->getGroup(group_name);
         this->updateWellRates(group_tmp, well_state_nupcol, well_state);
     }
     const int np = this->numPhases();
@@ -1420,7 +1480,7 @@ GroupStateHelper<Scalar, IndexTraits>::updateWellRates(const Group& group,
         std::vector<Scalar> rates(np, 0.0);
         const auto well_index = well_state.index(well_name);
         if (well_index.has_value()) { // the well is found on this node
-            const auto& well_tmp = this->schedule_.getWell(well_name, this->report_step_);
+            const auto& well_tmp = this->getWell(well_name);
             int sign = 1;
             // production wellRates are negative. The users of currentWellRates uses the convention in
             // opm-common that production and injection rates are positive.
@@ -1462,14 +1522,14 @@ GroupStateHelper<Scalar, IndexTraits>::updateWellRatesFromGroupTargetScale(
                                   && current_group_control != Group::ProductionCMode::NONE);
         }
         if (!individual_control) {
-            const Group& group_tmp = this->schedule_.getGroup(group_name, this->report_step_);
+            const Group& group_tmp = this->getGroup(group_name);
             this->updateWellRatesFromGroupTargetScale(scale, group_tmp, is_injector, well_state);
         }
     }
 
     const int np = this->numPhases();
     for (const std::string& well_name : group.wells()) {
-        const auto& well_tmp = this->schedule_.getWell(well_name, this->report_step_);
+        const auto& well_tmp = this->getWell(well_name);
 
         if (well_tmp.isProducer() && is_injector)
             continue;
@@ -1508,7 +1568,7 @@ GroupStateHelper<Scalar, IndexTraits>::worstOffendingWell(const Group& group,
 {
     std::pair<std::optional<std::string>, Scalar> offending_well {std::nullopt, 0.0};
     for (const std::string& child_group : group.groups()) {
-        const auto& this_group = this->schedule_.getGroup(child_group, this->report_step_);
+        const auto& this_group = this->getGroup(child_group);
         const auto& offending_well_this = this->worstOffendingWell(this_group, offended_control);
         if (offending_well_this.second > offending_well.second) {
             offending_well = offending_well_this;
@@ -1568,7 +1628,7 @@ GroupStateHelper<Scalar, IndexTraits>::worstOffendingWell(const Group& group,
                 break;
             }
             const auto preferred_phase
-                = this->schedule_.getWell(child_well, this->report_step_).getPreferredPhase();
+                = this->getWell(child_well).getPreferredPhase();
             switch (preferred_phase) {
             case Phase::OIL: {
                 const int oil_pos
@@ -1739,10 +1799,10 @@ GroupStateHelper<Scalar, IndexTraits>::computeAddbackEfficiency_(const std::vect
     for (std::size_t jj = local_reduction_level + 1; jj <= num_ancestors; ++jj) {
         const std::string& name = chain[jj];
         if (this->schedule_.hasGroup(name, this->report_step_)) {
-            const auto& grp = this->schedule_.getGroup(name, this->report_step_);
+            const auto& grp = this->getGroup(name);
             efficiency *= grp.getGroupEfficiencyFactor();
         } else if (this->schedule_.hasWell(name, this->report_step_)) {
-            const auto& well = this->schedule_.getWell(name, this->report_step_);
+            const auto& well = this->getWell(name);
             efficiency *= well.getEfficiencyFactor()
                 * this->wellState()[name].efficiency_scaling_factor;
         }
@@ -2029,7 +2089,7 @@ GroupStateHelper<Scalar, IndexTraits>::controlGroup_(const Group& group) const
         || currentGroupControl == Group::ProductionCMode::NONE) {
         const auto& parent_name = group.control_group();
         if (parent_name) {
-            const auto& parent = this->schedule_.getGroup(parent_name.value(), this->report_step_);
+            const auto& parent = this->getGroup(parent_name.value());
             return this->controlGroup_(parent);
         }
     }
@@ -2072,13 +2132,13 @@ GroupStateHelper<Scalar, IndexTraits>::isInGroupChainTopBot_(const std::string&
     // Get initial parent, 'bottom' can be a well or a group.
     std::string parent;
     if (this->schedule_.hasWell(bottom, this->report_step_)) {
-        parent = this->schedule_.getWell(bottom, this->report_step_).groupName();
+        parent = this->getWell(bottom).groupName();
     } else {
-        parent = this->schedule_.getGroup(bottom, this->report_step_).parent();
+        parent = this->getGroup(bottom).parent();
     }
 
     while (parent != top) {
-        parent = this->schedule_.getGroup(parent, this->report_step_).parent();
+        parent = this->getGroup(parent).parent();
         if (parent == top) {
             return true;
         } else if (parent == "FIELD") {
@@ -2146,8 +2206,7 @@ collectMasterGroupHierarchy_() const
             auto gname = mgname;
             while (true) {
                 hierarchy_groups.insert(gname);
-                const auto& group = this->schedule_.getGroup(
-                    gname, this->report_step_);
+                const auto& group = this->getGroup(gname);
                 if (group.is_field()) {
                     break;
                 }
@@ -2421,7 +2480,7 @@ GroupStateHelper<Scalar, IndexTraits>::isAutoChokeGroupUnderperforming_(const Gr
 
     // Find the ancestor group that has actual control
     const auto& control_group_name = this->controlGroup_(group);
-    const auto& control_group = this->schedule_.getGroup(control_group_name, this->report_step_);
+    const auto& control_group = this->getGroup(control_group_name);
 
     // Calculate target rate for this auto choke group using a guide rate ratio
     // formula. This is an approximation that ignores intermediate reductions.
@@ -2467,7 +2526,7 @@ GroupStateHelper<Scalar, IndexTraits>::isAutoChokeGroupUnderperforming_(const Gr
     {
         std::string current = group.name();
         while (current != control_group_name) {
-            const auto& g = this->schedule_.getGroup(current, this->report_step_);
+            const auto& g = this->getGroup(current);
             accumulated_efficiency *= g.getGroupEfficiencyFactor();
             current = g.parent();
         }
@@ -2500,7 +2559,7 @@ GroupStateHelper<Scalar, IndexTraits>::updateGroupControlledWellsRecursive_(
 {
     // NOTE: The number of group controlled wells (GCW) is only relevant for groups that are NOT under
     //   individual control. However, it is collected for all groups here.
-    const Group& group = this->schedule_.getGroup(group_name, this->report_step_);
+    const Group& group = this->getGroup(group_name);
     int num_wells = 0;
     // NOTE: If "group" is a reservoir coupling master group, it should have no child groups or wells.
     //   As a convention, we will assign GCW = 1 (GCW=Group Controlled Wells). This is consistent with
@@ -2550,7 +2609,7 @@ GroupStateHelper<Scalar, IndexTraits>::updateGroupControlledWellsRecursive_(
         //   under individual control or not.
         for (const std::string& child_well : group.wells()) {
             bool included = false;
-            const Well& well = this->schedule_.getWell(child_well, this->report_step_);
+            const Well& well = this->getWell(child_well);
             if (is_production_group && well.isProducer()) {
                 included = (this->wellState().isProductionGrup(child_well) || group.as_choke());
                 // Auto choke groups: exclude all wells if group is underperforming its target
@@ -2592,7 +2651,7 @@ GroupStateHelper<Scalar, IndexTraits>::updateGroupTargetReductionRecursive_(
     const int np = this->numPhases();
     for (const std::string& sub_group_name : group.groups()) {
         std::vector<Scalar> sub_group_target_reduction(np, 0.0);
-        const Group& sub_group = this->schedule_.getGroup(sub_group_name, this->report_step_);
+        const Group& sub_group = this->getGroup(sub_group_name);
         this->updateGroupTargetReductionRecursive_(
             sub_group, is_injector, sub_group_target_reduction);
 
@@ -2667,7 +2726,7 @@ GroupStateHelper<Scalar, IndexTraits>::updateGroupTargetReductionRecursive_(
     }
 
     for (const std::string& well_name : group.wells()) {
-        const auto& well_tmp = this->schedule_.getWell(well_name, this->report_step_);
+        const auto& well_tmp = this->getWell(well_name);
 
         if (well_tmp.isProducer() && is_injector)
             continue;
@@ -41,11 +41,14 @@
 #include <opm/simulators/utils/ParallelCommunication.hpp>
 
 #include <algorithm>
+#include <array>
+#include <bitset>
 #include <map>
 #include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -114,6 +117,78 @@ public:
         GroupState<Scalar>* previous_state_ptr_ {nullptr};
     };
 
+    // RAII guard that enables memoization of the recursive group-tree rate
+    // sums in sumWellPhaseRates(). The outermost guard clears and activates
+    // the cache; nested guards are no-ops. See pushGroupRateCache().
+    class GroupRateCacheGuard
+    {
+    public:
+        explicit GroupRateCacheGuard(const GroupStateHelper& group_state_helper)
+            : group_state_helper_ {group_state_helper}
+            , was_active_ {group_state_helper.group_rate_cache_active_}
+        {
+            if (!was_active_) {
+                group_state_helper_.group_rate_cache_.clear();
+                group_state_helper_.group_rate_cache_state_ = group_state_helper_.well_state_;
+                group_state_helper_.group_rate_cache_active_ = true;
+            }
+        }
+
+        ~GroupRateCacheGuard()
+        {
+            if (!was_active_) {
+                group_state_helper_.group_rate_cache_active_ = false;
+                group_state_helper_.group_rate_cache_.clear();
+            }
+        }
+
+        // Delete copy and move operations
+        GroupRateCacheGuard(const GroupRateCacheGuard&) = delete;
+        GroupRateCacheGuard& operator=(const GroupRateCacheGuard&) = delete;
+        GroupRateCacheGuard(GroupRateCacheGuard&&) = delete;
+        GroupRateCacheGuard& operator=(GroupRateCacheGuard&&) = delete;
+
+    private:
+        const GroupStateHelper& group_state_helper_;
+        bool was_active_;
+    };
+
+    // RAII guard that enables memoization of the recursive guide-rate
+    // evaluations in FractionCalculator across constraint checks. The
+    // outermost guard clears and activates the cache; nested guards are
+    // no-ops. See pushGuideRateFractionCache().
+    class GuideRateFractionCacheGuard
+    {
+    public:
+        explicit GuideRateFractionCacheGuard(const GroupStateHelper& group_state_helper)
+            : group_state_helper_ {group_state_helper}
+            , was_active_ {group_state_helper.guide_rate_fraction_cache_active_}
+        {
+            if (!was_active_) {
+                group_state_helper_.guide_rate_fraction_cache_.clear();
+                group_state_helper_.guide_rate_fraction_cache_active_ = true;
+            }
+        }
+
+        ~GuideRateFractionCacheGuard()
+        {
+            if (!was_active_) {
+                group_state_helper_.guide_rate_fraction_cache_active_ = false;
+                group_state_helper_.guide_rate_fraction_cache_.clear();
+            }
+        }
+
+        // Delete copy and move operations
+        GuideRateFractionCacheGuard(const GuideRateFractionCacheGuard&) = delete;
+        GuideRateFractionCacheGuard& operator=(const GuideRateFractionCacheGuard&) = delete;
+        GuideRateFractionCacheGuard(GuideRateFractionCacheGuard&&) = delete;
+        GuideRateFractionCacheGuard& operator=(GuideRateFractionCacheGuard&&) = delete;
+
+    private:
+        const GroupStateHelper& group_state_helper_;
+        bool was_active_;
+    };
+
     /// @brief RAII guard that owns a DeferredLogger and auto-gathers on destruction
     ///
     /// @details This class provides a complete lifecycle for deferred logging in parallel
@@ -239,6 +314,18 @@ public:
         return *this->deferred_logger_;
     }
 
+    /// @brief Redirect logging to an externally owned logger.
+    ///
+    /// @details Intended for thread-local copies of the helper: each thread
+    /// points its copy at its own logger and the caller merges the collected
+    /// messages afterwards (see DeferredLogger::append()).  Unlike
+    /// pushLogger(), no gathering or logging happens when the logger goes out
+    /// of use; the caller owns the messages.
+    void setThreadLocalLogger(DeferredLogger* logger) const
+    {
+        this->deferred_logger_ = logger;
+    }
+
     std::vector<Scalar> getGroupRatesAvailableForHigherLevelControl(const Group& group, const bool is_injector) const;
 
     Scalar getInjectionGroupTarget(const Group& group,
@@ -328,6 +415,77 @@ public:
         return this->phase_usage_info_;
     }
 
+    /// @brief Enable memoization of group-tree rate sums for the current scope
+    ///
+    /// @details sumWellPhaseRates() walks the group tree recursively, and the
+    /// group update sequence re-evaluates the same subtrees many times while
+    /// the well state is unchanged. While the returned guard is alive, results
+    /// are cached per (group, rate kind) and reused instead of recomputed.
+    /// Switching the well state via pushWellState() is detected and clears the
+    /// cache, so nupcol-state queries never see stale values. The caller must
+    /// not mutate the rates of the active well state while the guard is alive.
+    /// Nested guards are no-ops; the outermost guard clears the cache on
+    /// destruction.
+    /// @return RAII guard that owns the cache activation
+    GroupRateCacheGuard pushGroupRateCache() const
+    {
+        return GroupRateCacheGuard(*this);
+    }
+
+    /// @brief Enable memoization of guide-rate fractions for the current scope
+    ///
+    /// @details Constraint checking evaluates the same per-group guide-rate
+    /// recursion once per well and constraint type against unchanged rates,
+    /// which is quadratic-ish in deep group trees. While the returned guard
+    /// is alive, FractionCalculator memoizes its recursive guide-rate
+    /// evaluations here, making one constraint sweep O(groups). A well or
+    /// group switching control changes the set of group-controlled wells,
+    /// so the caller must drop the entries via
+    /// invalidateGuideRateFractionCache() whenever that happens inside the
+    /// guarded scope. Nested guards are no-ops; the outermost guard clears
+    /// the cache on destruction.
+    /// @return RAII guard that owns the cache activation
+    GuideRateFractionCacheGuard pushGuideRateFractionCache() const
+    {
+        return GuideRateFractionCacheGuard(*this);
+    }
+
+    /// @brief Drop the memoized guide-rate fractions.
+    ///
+    /// @details Must be called when a well or group control switch changes
+    /// the set of group-controlled wells while a fraction cache guard is
+    /// alive.
+    void invalidateGuideRateFractionCache() const
+    {
+        guide_rate_fraction_cache_.clear();
+    }
+
+    /// @brief Whether guide-rate fraction memoization is currently active.
+    bool guideRateFractionCacheActive() const
+    {
+        return guide_rate_fraction_cache_active_;
+    }
+
+    /// @brief Lookup a memoized guide-rate evaluation.
+    /// @param key Composed lookup key, see FractionCalculator
+    std::optional<Scalar> cachedGuideRateFraction(const std::string& key) const
+    {
+        if (const auto it = guide_rate_fraction_cache_.find(key);
+            it != guide_rate_fraction_cache_.end())
+        {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    /// @brief Store a guide-rate evaluation under the given key.
+    void storeGuideRateFraction(const std::string& key, const Scalar value) const
+    {
+        if (guide_rate_fraction_cache_active_) {
+            guide_rate_fraction_cache_.try_emplace(key, value);
+        }
+    }
+
     GroupStateGuard pushGroupState(GroupState<Scalar>& group_state)
     {
         return GroupStateGuard(*this, group_state);
@@ -366,6 +524,26 @@ public:
         return this->schedule_;
     }
 
+    /// \brief O(1) access to a group of the current report step.
+    ///
+    /// Caches the pointers returned by the by-name Schedule lookup, which
+    /// otherwise shows up in the Newton loop on decks with many wells.
+    const Group& getGroup(const std::string& group_name) const;
+
+    /// \brief O(1) access to a well of the current report step.
+    /// \copydetails getGroup()
+    const Well& getWell(const std::string& well_name) const;
+
+    /// \brief Drop the cached schedule object pointers.
+    ///
+    /// Must be called whenever the schedule is modified within a report
+    /// step (i.e. by an ACTIONX), since that invalidates the pointers.
+    void invalidateScheduleCache()
+    {
+        group_cache_.clear();
+        well_cache_.clear();
+    }
+
     ReservoirCoupling::Proxy<Scalar>& rescoup() {
         return rescoup_;
     }
@@ -410,6 +588,7 @@ public:
     void setReportStep(int report_step)
     {
         report_step_ = report_step;
+        invalidateScheduleCache();
     }
 
     const SummaryState& summaryState() const
@@ -642,6 +821,13 @@ private:
 
     Scalar sumProductionRateForControlMode_(const Group& group, Group::ProductionCMode cmode) const;
 
+    //! \brief Recursive worker behind sumWellPhaseRates(), bypassing the cache.
+    Scalar sumWellPhaseRatesUncached_(bool res_rates,
+                                      const Group& group,
+                                      const int phase_pos,
+                                      const bool injector,
+                                      const bool network) const;
+
     int updateGroupControlledWellsRecursive_(const std::string& group_name,
                                              const bool is_production_group,
                                              const Phase injection_phase);
@@ -711,6 +897,34 @@ private:
     bool terminal_output_ {false};
     int report_step_ {0};
     ReservoirCoupling::Proxy<Scalar> rescoup_{};
+
+    // Memoized results of sumWellPhaseRates(), one entry per group. The flat
+    // index combines (phase_pos, res_rates, injector, network); see
+    // sumWellPhaseRates() for the layout. Only consulted while a
+    // GroupRateCacheGuard is alive and the well state matches the one the
+    // cache was filled from.
+    struct GroupRateCacheEntry
+    {
+        static constexpr int num_slots = 24; // 3 phases x 2 x 2 x 2 flags
+        std::array<Scalar, num_slots> values {};
+        std::bitset<num_slots> valid {};
+    };
+    mutable std::unordered_map<std::string, GroupRateCacheEntry> group_rate_cache_ {};
+    mutable const WellState<Scalar, IndexTraits>* group_rate_cache_state_ {nullptr};
+    mutable bool group_rate_cache_active_ {false};
+
+    // Memoized results of FractionCalculator's recursive guide-rate
+    // evaluations, keyed by the calculator's composed lookup key. Only
+    // consulted while a GuideRateFractionCacheGuard is alive; cleared by
+    // invalidateGuideRateFractionCache() when a control switches mid-scope.
+    mutable std::unordered_map<std::string, Scalar> guide_rate_fraction_cache_ {};
+    mutable bool guide_rate_fraction_cache_active_ {false};
+
+    // Pointer caches for the schedule objects of the current report step,
+    // filled lazily by getGroup()/getWell(). Cleared by setReportStep() and
+    // invalidateScheduleCache().
+    mutable std::unordered_map<std::string, const Group*> group_cache_ {};
+    mutable std::unordered_map<std::string, const Well*> well_cache_ {};
 };
 
 // -----------------------------------------------------------------------------
@@ -732,7 +946,7 @@ GroupStateHelper<Scalar, IndexTraits>::setRegionAveragePressureCalculator(
     const
 {
     for (const std::string& groupName : group.groups()) {
-        this->setRegionAveragePressureCalculator(this->schedule_.getGroup(groupName, this->report_step_),
+        this->setRegionAveragePressureCalculator(this->getGroup(groupName),
                                                  fp,
                                                  regional_average_pressure_calculator);
     }
@@ -766,7 +980,7 @@ GroupStateHelper<Scalar, IndexTraits>::updateGpMaintTargetForGroups(const Group&
 {
     OPM_TIMEFUNCTION();
     for (const std::string& group_name : group.groups()) {
-        const Group& group_tmp = this->schedule_.getGroup(group_name, this->report_step_);
+        const Group& group_tmp = this->getGroup(group_name);
         this->updateGpMaintTargetForGroups(group_tmp, regional_values, dt);
     }
     const auto& gpm = group.gpmaint();
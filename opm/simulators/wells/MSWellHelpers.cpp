@@ -52,17 +52,12 @@ namespace {
 
 template <typename ValueType, typename Scalar>
 ValueType haalandFormular(const ValueType& re,
-                          const Scalar diameter,
-                          const Scalar roughness)
+                          const Scalar roughness_pow)
 {
-    // We now guard for high roughness values (possible singularity) during input handling.
-    // Keepeing a check here in case of unforeseen future usage.
+    // The roughness validity check is performed when the roughness term is
+    // precomputed in frictionCoefficients().
     assert( re >= 4000. );
-    const Scalar rel_roughness = roughness/diameter;
-    if (rel_roughness > Opm::Segment::MAX_REL_ROUGHNESS) {
-        throw std::invalid_argument("Too large relative roughness in Haaland friction factor calculations.");
-    }
-    const ValueType value = -3.6 * log10(6.9 / re + std::pow(rel_roughness / 3.7, 10. / 9.) );
+    const ValueType value = -3.6 * log10(6.9 / re + roughness_pow);
     return 1.0 / (value*value);
 }
 
@@ -267,14 +262,35 @@ invDX(const MatrixType& D, VectorType x, DeferredLogger& deferred_logger)
     return y;
 }
 
+template <typename Scalar>
+FrictionCoefficients<Scalar>
+frictionCoefficients(const Scalar l, const Scalar diameter,
+                     const Scalar area, const Scalar roughness)
+{
+    // We now guard for high roughness values (possible singularity) during input handling.
+    // Keepeing a check here in case of unforeseen future usage.
+    const Scalar rel_roughness = roughness/diameter;
+    if (rel_roughness > Opm::Segment::MAX_REL_ROUGHNESS) {
+        throw std::invalid_argument("Too large relative roughness in Haaland friction factor calculations.");
+    }
+
+    FrictionCoefficients<Scalar> coef;
+    coef.reynolds = diameter / area;
+    coef.laminar = 32. * l / (area * diameter * diameter);
+    // \Note: a factor of 2 needs to be here based on the dimensional analysis
+    coef.turbulent = 2. * l / (area * area * diameter);
+    coef.roughness_pow = std::pow(rel_roughness / 3.7, 10. / 9.);
+    coef.transition = haalandFormular(Scalar{4000.}, coef.roughness_pow);
+    return coef;
+}
+
 template <typename ValueType, typename Scalar>
-ValueType frictionPressureLoss(const Scalar l, const Scalar diameter,
-                               const Scalar area, const Scalar roughness,
+ValueType frictionPressureLoss(const FrictionCoefficients<Scalar>& coef,
                                const ValueType& density,
                                const ValueType& w, const ValueType& mu)
 {
     // Reynolds number
-    const ValueType re = abs( diameter * w / (area * mu));
+    const ValueType re = abs(coef.reynolds * w / mu);
 
     constexpr Scalar re_value1 = 2000.;
     constexpr Scalar re_value2 = 4000.;
@@ -282,19 +298,27 @@ ValueType frictionPressureLoss(const Scalar l, const Scalar diameter,
     if (re < re_value1) {
         // not using the formula directly because of the division with very small w
         // might introduce inf/nan entries in Jacobian matrix
-        return 32.* mu * l * abs(w) / (area * diameter *diameter * density);
+        return coef.laminar * mu * abs(w) / density;
     }
 
     ValueType f;
     if (re > re_value2) {
-        f = haalandFormular(re, diameter, roughness);
+        f = haalandFormular(re, coef.roughness_pow);
     } else { // in between
         constexpr Scalar f1 = 16. / re_value1;
-        const ValueType f2 = haalandFormular(re_value2, diameter, roughness);
-        f = (f2 - f1) / (re_value2 - re_value1) * (re - re_value1) + f1;
+        f = (coef.transition - f1) / (re_value2 - re_value1) * (re - re_value1) + f1;
     }
-    // \Note: a factor of 2 needs to be here based on the dimensional analysis
-    return 2. * f * l * w * w / (area * area * diameter * density);
+    return f * coef.turbulent * w * w / density;
+}
+
+template <typename ValueType, typename Scalar>
+ValueType frictionPressureLoss(const Scalar l, const Scalar diameter,
+                               const Scalar area, const Scalar roughness,
+                               const ValueType& density,
+                               const ValueType& w, const ValueType& mu)
+{
+    return frictionPressureLoss(frictionCoefficients(l, diameter, area, roughness),
+                                density, w, mu);
 }
 
 template <typename ValueType, typename Scalar>
@@ -387,6 +411,11 @@ using Mat = Dune::BCRSMatrix<Dune::FieldMatrix<Scalar,M,N>>;
 
 #define INSTANTIATE_IMPL(T,...)                                    \
     template __VA_ARGS__                                           \
+    frictionPressureLoss(const FrictionCoefficients<T>&,           \
+                         const __VA_ARGS__&,                       \
+                         const __VA_ARGS__&,                       \
+                         const __VA_ARGS__&);                      \
+    template __VA_ARGS__                                           \
     frictionPressureLoss(const T,                                  \
                          const T,                                  \
                          const T,                                  \
@@ -410,7 +439,10 @@ using Mat = Dune::BCRSMatrix<Dune::FieldMatrix<Scalar,M,N>>;
 #define INSTANTIATE_EVAL(T,Dim) \
     INSTANTIATE_IMPL(T, DenseAd::Evaluation<T,Dim>)
 
-#define INSTANTIATE_TYPE(T) \
+#define INSTANTIATE_TYPE(T)                          \
+    template FrictionCoefficients<T>                 \
+    frictionCoefficients(const T, const T,           \
+                         const T, const T);          \
     INSTANTIATE_UMF(T,2)    \
     INSTANTIATE_UMF(T,3)    \
     INSTANTIATE_UMF(T,4)    \
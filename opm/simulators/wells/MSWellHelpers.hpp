@@ -92,15 +92,46 @@ namespace mswellhelpers
     VectorType
     invDX(const MatrixType& D, VectorType x, DeferredLogger& deferred_logger);
 
-    // calculating the friction pressure loss
+    /// \brief Solution-independent coefficients of the friction pressure
+    ///        loss correlation for one segment.
+    ///
+    /// The geometric factors and the roughness-dependent term of the
+    /// Haaland friction factor only depend on the segment geometry, so
+    /// they are computed once with frictionCoefficients() and reused for
+    /// every linearization instead of being re-derived in each call.
+    template <typename Scalar>
+    struct FrictionCoefficients
+    {
+        Scalar reynolds = 0.0;      //!< diameter / area; Reynolds number per unit (w / mu)
+        Scalar laminar = 0.0;       //!< 32 l / (area diameter^2)
+        Scalar turbulent = 0.0;     //!< 2 l / (area^2 diameter)
+        Scalar roughness_pow = 0.0; //!< pow(rel_roughness / 3.7, 10/9) of the Haaland formula
+        Scalar transition = 0.0;    //!< Haaland friction factor at Re = 4000
+    };
+
+    // precompute the friction pressure loss coefficients of a segment
     // l is the segment length
     // area is the segment cross area
     // diameter is the segment inner diameter
+    // roughness is the absolute roughness
+    // throws for too large relative roughness values
+    template <typename Scalar>
+    FrictionCoefficients<Scalar>
+    frictionCoefficients(const Scalar l, const Scalar diameter,
+                         const Scalar area, const Scalar roughness);
+
+    // calculating the friction pressure loss
+    // coef holds the precomputed coefficients of the segment
     // w is mass flow rate through the segment
     // density is density
-    // roughness is the absolute roughness
     // mu is the average phase viscosity
     template <typename ValueType, typename Scalar>
+    ValueType frictionPressureLoss(const FrictionCoefficients<Scalar>& coef,
+                                   const ValueType& density,
+                                   const ValueType& w, const ValueType& mu);
+
+    // convenience overload computing the coefficients on the fly
+    template <typename ValueType, typename Scalar>
     ValueType frictionPressureLoss(const Scalar l, const Scalar diameter,
                                    const Scalar area, const Scalar roughness,
                                    const ValueType& density,
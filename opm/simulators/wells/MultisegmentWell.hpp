@@ -127,7 +127,8 @@ namespace Opm {
                                        WellStateType& well_state) override; // const?
 
         void calculateExplicitQuantities(const Simulator& simulator,
-                                         const GroupStateHelperType& groupStateHelper) override; // should be const?
+                                         const GroupStateHelperType& groupStateHelper,
+                                         const bool reuse_connection_pressures = false) override; // should be const?
 
         void updateIPRImplicit(const Simulator& simulator,
                                const GroupStateHelperType& groupStateHelper,
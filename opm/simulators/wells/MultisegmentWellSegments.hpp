@@ -22,6 +22,7 @@
 #ifndef OPM_MULTISEGMENTWELL_SEGMENTS_HEADER_INCLUDED
 #define OPM_MULTISEGMENTWELL_SEGMENTS_HEADER_INCLUDED
 
+#include <opm/simulators/wells/MSWellHelpers.hpp>
 #include <opm/simulators/wells/MultisegmentWellPrimaryVariables.hpp>
 #include <opm/simulators/wells/ParallelWellInfo.hpp>
 
@@ -116,6 +117,12 @@ public:
         return upwinding_segments_[seg];
     }
 
+    //! \brief Index of the outlet segment (the top segment refers to itself).
+    int outlet_segment(const int seg) const
+    {
+        return outlet_segment_indices_[seg];
+    }
+
     Scalar getRefDensity() const
     {
         return densities_[0].value();
@@ -158,6 +165,19 @@ private:
 
     std::vector<Scalar> depth_diffs_;
 
+    // the index of the outlet segment of each segment; the top segment refers
+    // to itself. It keeps the segment-number lookups of the parser objects out
+    // of the per-iteration evaluation loops.
+    std::vector<int> outlet_segment_indices_;
+
+    // the solution-independent coefficients of the friction pressure drop
+    // correlation, precomputed from the geometry of the regular segments
+    std::vector<mswellhelpers::FrictionCoefficients<Scalar>> friction_coefficients_;
+
+    // ditto for the additional pipe friction of valve segments (WSEGVALV);
+    // only filled for segments that actually are valves
+    std::vector<mswellhelpers::FrictionCoefficients<Scalar>> valve_friction_coefficients_;
+
     std::vector<Scalar> surface_densities_;
 
     // the densities of segment fluids
@@ -0,0 +1,38 @@
+/*
+  Copyright 2017 SINTEF Digital, Mathematics and Cybernetics.
+  Copyright 2017 Statoil ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Instantiations of MultisegmentWellSegments for the two-phase
+// index configurations. The instantiations are sharded across
+// MultisegmentWellSegments1-3.cpp so the groups compile in parallel.
+
+#include <config.h>
+#include <opm/simulators/wells/MultisegmentWellSegments_impl.hpp>
+
+namespace Opm {
+
+#include <opm/simulators/utils/InstantiationIndicesMacros.hpp>
+
+INSTANTIATE_TYPE_INDICES_TWOPHASE(MultisegmentWellSegments, double)
+
+#if FLOW_INSTANTIATE_FLOAT
+INSTANTIATE_TYPE_INDICES_TWOPHASE(MultisegmentWellSegments, float)
+#endif
+
+} // namespace Opm
@@ -18,7 +18,9 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <config.h>
+#ifndef OPM_MULTISEGMENT_WELL_SEGMENTS_IMPL_HEADER_INCLUDED
+#define OPM_MULTISEGMENT_WELL_SEGMENTS_IMPL_HEADER_INCLUDED
+
 #include <opm/simulators/wells/MultisegmentWellSegments.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
@@ -91,6 +93,9 @@ MultisegmentWellSegments(const int numSegments,
     // local information. This is an exception and intentionally, since here, we only need the local entries.
     , inlets_(well.wellEcl().getSegments().size())
     , depth_diffs_(numSegments, 0.0)
+    , outlet_segment_indices_(numSegments, 0)
+    , friction_coefficients_(numSegments)
+    , valve_friction_coefficients_(numSegments)
     , surface_densities_(surfaceDensities<FluidSystem>(well.pvtRegionIdx(), well.numConservationQuantities()))
     , densities_(numSegments, 0.0)
     , mass_rates_(numSegments, 0.0)
@@ -153,9 +158,41 @@ MultisegmentWellSegments(const int numSegments,
     for (int seg = 1; seg < numSegments; ++seg) {
         const Scalar segment_depth = segment_set[seg].depth();
         const int outlet_segment_number = segment_set[seg].outletSegment();
-        const Segment& outlet_segment = segment_set[segment_set.segmentNumberToIndex(outlet_segment_number)];
+        const int outlet_segment_index = segment_set.segmentNumberToIndex(outlet_segment_number);
+        const Segment& outlet_segment = segment_set[outlet_segment_index];
         const Scalar outlet_depth = outlet_segment.depth();
         depth_diffs_[seg] = segment_depth - outlet_depth;
+        outlet_segment_indices_[seg] = outlet_segment_index;
+
+        // precompute the solution-independent coefficients of the friction
+        // pressure drop correlations; the segment evaluation is the hottest
+        // part of the well assembly and should not redo the geometry
+        // processing in every linearization
+        switch (segment_set[seg].segmentType()) {
+        case Segment::SegmentType::SICD:
+        case Segment::SegmentType::AICD:
+            // the ICD pressure drops do not use the pipe friction correlation
+            break;
+        case Segment::SegmentType::VALVE: {
+            const Valve& valve = segment_set[seg].valve();
+            valve_friction_coefficients_[seg] =
+                mswellhelpers::frictionCoefficients(valve.pipeAdditionalLength(),
+                                                    valve.pipeDiameter(),
+                                                    valve.pipeCrossArea(),
+                                                    valve.pipeRoughness());
+            break;
+        }
+        default: {
+            const Scalar length = segment_set[seg].totalLength() - outlet_segment.totalLength();
+            assert(length > 0.);
+            friction_coefficients_[seg] =
+                mswellhelpers::frictionCoefficients(length,
+                                                    segment_set[seg].internalDiameter(),
+                                                    segment_set[seg].crossArea(),
+                                                    segment_set[seg].roughness());
+            break;
+        }
+        }
     }
 }
 
@@ -226,9 +263,7 @@ updateUpwindingSegments(const PrimaryVariables& primary_variables)
         if (primary_variables.eval(seg)[primary_variables.WQTotal] <= 0.) {
             upwinding_segments_[seg] = seg;
         } else {
-            const auto& segment_set = well_.wellEcl().getSegments();
-            const int outlet_segment_index = segment_set.segmentNumberToIndex(segment_set[seg].outletSegment());
-            upwinding_segments_[seg] = outlet_segment_index;
+            upwinding_segments_[seg] = outlet_segment_indices_[seg];
         }
     }
 }
@@ -311,17 +346,9 @@ getFrictionPressureLoss(const int seg,
         }
     }
 
-    const auto& segment_set = well_.wellEcl().getSegments();
-    const int outlet_segment_index = segment_set.segmentNumberToIndex(segment_set[seg].outletSegment());
-    const Scalar length = segment_set[seg].totalLength() - segment_set[outlet_segment_index].totalLength();
-    assert(length > 0.);
-    const Scalar roughness = segment_set[seg].roughness();
-    const Scalar area = segment_set[seg].crossArea();
-    const Scalar diameter = segment_set[seg].internalDiameter();
-
     const Scalar sign = mass_rate < 0. ? 1.0 : - 1.0;
 
-    return sign * mswellhelpers::frictionPressureLoss(length, diameter, area, roughness, density, mass_rate, visc);
+    return sign * mswellhelpers::frictionPressureLoss(friction_coefficients_[seg], density, mass_rate, visc);
 }
 
 template<class FluidSystem, class Indices>
@@ -584,13 +611,8 @@ pressureDropValve(const int seg,
         }
     }
 
-    const Scalar additional_length = valve.pipeAdditionalLength();
-    const Scalar roughness = valve.pipeRoughness();
-    const Scalar diameter = valve.pipeDiameter();
-    const Scalar area = valve.pipeCrossArea();
-
     const EvalWell friction_pressure_loss =
-        mswellhelpers::frictionPressureLoss(additional_length, diameter, area, roughness, density, mass_rate, visc);
+        mswellhelpers::frictionPressureLoss(valve_friction_coefficients_[seg], density, mass_rate, visc);
 
     const ValveUDAEval uda_eval {summary_state, this->well_.name(), static_cast<std::size_t>(segment_set[seg].segmentNumber())};
     const Scalar area_con = valve.conCrossArea(uda_eval);
@@ -918,12 +940,6 @@ PhaseCalcResult::clear()
     vol_ratio = 0.0;
 }
 
-#include <opm/simulators/utils/InstantiationIndicesMacros.hpp>
-
-INSTANTIATE_TYPE_INDICES(MultisegmentWellSegments, double)
-
-#if FLOW_INSTANTIATE_FLOAT
-INSTANTIATE_TYPE_INDICES(MultisegmentWellSegments, float)
-#endif
-
 } // namespace Opm
+
+#endif // OPM_MULTISEGMENT_WELL_SEGMENTS_IMPL_HEADER_INCLUDED
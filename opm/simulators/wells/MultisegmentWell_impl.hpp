@@ -761,7 +761,8 @@ namespace Opm
     void
     MultisegmentWell<TypeTag>::
     calculateExplicitQuantities(const Simulator& simulator,
-                                const GroupStateHelperType& groupStateHelper)
+                                const GroupStateHelperType& groupStateHelper,
+                                const bool /* reuse_connection_pressures */)
     {
         auto& deferred_logger = groupStateHelper.deferredLogger();
         updatePrimaryVariables(groupStateHelper);
@@ -1924,9 +1925,13 @@ namespace Opm
             }
         }
         // Accumulate dissolved gas and vaporized oil flow rates across all ranks sharing this well.
+        // The guard also keeps the assembly free of MPI calls for wells local to a
+        // single rank, so such wells can be assembled from worker threads.
         {
             const auto& comm = this->parallel_well_info_.communication();
-            comm.sum(ws.phase_mixing_rates.data(), ws.phase_mixing_rates.size());
+            if (comm.size() > 1) {
+                comm.sum(ws.phase_mixing_rates.data(), ws.phase_mixing_rates.size());
+            }
         }
 
         if (this->parallel_well_info_.communication().size() > 1) {
@@ -2011,7 +2016,9 @@ namespace Opm
             }
         }
 
-        this->parallel_well_info_.communication().sum(this->ipr_a_.data(), this->ipr_a_.size());
+        if (this->parallel_well_info_.communication().size() > 1) {
+            this->parallel_well_info_.communication().sum(this->ipr_a_.data(), this->ipr_a_.size());
+        }
         this->linSys_.createSolver();
     }
 
@@ -223,9 +223,38 @@ defineCommunication()
 {
     assert (this->calculators_.numCalculators() == this->wellConnSrc_.size());
 
-    this->pruneInactiveWBPCells();
+    // Both the prune decisions and the reservoir level gather structure
+    // depend only on the wells' WBP contributing cells.  When those are
+    // unchanged since the previous call--i.e., no completion changes on
+    // any rank--reuse the previous prune result and keep the existing
+    // reservoir level structure instead of re-gathering every well's
+    // contributing cells across all ranks.  The decision is made
+    // collectively so that all ranks agree on whether the collective
+    // rebuild steps run.
+    auto wbpCells = this->calculators_.allWBPCells();
 
-    this->defineReservoirCommunication();
+    const bool changedLocally = ! this->reservoirStructureDefined_
+        || (wbpCells != this->prevWBPCells_);
+
+    if (this->reservoirSrc_.comm().max(static_cast<int>(changedLocally)) > 0) {
+        this->prevWBPCells_ = std::move(wbpCells);
+
+        this->pruneInactiveWBPCells();
+
+        this->defineReservoirCommunication();
+
+        this->reservoirStructureDefined_ = true;
+    }
+    else {
+        // Unchanged cell set.  The freshly created calculator objects
+        // still need the prune mask applied.
+        this->calculators_.pruneInactiveWBPCells
+            ([this]([[maybe_unused]] const std::vector<std::size_t>& globalWBPCellIdx)
+        {
+            assert (globalWBPCellIdx.size() == this->prevActiveWBPCells_.size());
+            return this->prevActiveWBPCells_;
+        });
+    }
 
     const auto numWells = this->calculators_.numCalculators();
     for (auto well = 0*numWells; well < numWells; ++well) {
@@ -294,6 +323,8 @@ pruneInactiveWBPCellsSerial()
             isActive[cellIdx] = localWBPCellIdx[cellIdx] >= 0;
         }
 
+        this->prevActiveWBPCells_ = isActive;
+
         return isActive;
     });
 }
@@ -335,6 +366,8 @@ pruneInactiveWBPCellsParallel()
             isActive[cellIdx] = *begin >= 0;
         }
 
+        this->prevActiveWBPCells_ = isActive;
+
         return isActive;
     });
 }
@@ -335,6 +335,20 @@ private:
     /// Local connection indices for each well on rank.
     std::vector<LocalConnSet> localConnSet_{};
 
+    /// WBP contributing cells, across all wells on rank, at the previous
+    /// call to defineCommunication().  Used to detect report steps without
+    /// completion changes, for which the prune result and the reservoir
+    /// level gather structure can be kept.
+    std::vector<std::size_t> prevWBPCells_{};
+
+    /// Prune result matching \c prevWBPCells_.
+    std::vector<bool> prevActiveWBPCells_{};
+
+    /// Whether or not the reservoir level gather structure has been
+    /// defined.  Guards against reusing a structure that was never built,
+    /// e.g., on the first call to defineCommunication().
+    bool reservoirStructureDefined_{false};
+
     /// Eliminate inactive cells from the source locations backing \c
     /// reservoirSrc_.
     void pruneInactiveWBPCells();
@@ -22,8 +22,11 @@
 #ifndef OPM_RATECONVERTER_HPP_HEADER_INCLUDED
 #define OPM_RATECONVERTER_HPP_HEADER_INCLUDED
 
+#include <opm/grid/utility/ElementChunks.hpp>
 #include <opm/grid/utility/RegionMapping.hpp>
 
+#include <opm/models/parallel/threadmanager.hpp>
+
 #include <opm/simulators/wells/RegionAttributeHelpers.hpp>
 
 #include <opm/simulators/utils/DeferredLoggingErrorHelpers.hpp>
@@ -32,8 +35,11 @@
 #include <dune/grid/common/gridenums.hh>
 #include <dune/grid/common/rangegenerators.hh>
 
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <functional>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -117,12 +123,26 @@ namespace Opm {
                     attributes_hpv.insert({reg, Attributes()});
                 }
 
-                ElementContext elemCtx( simulator );
                 const auto& gridView = simulator.gridView();
                 const auto& comm = gridView.comm();
 
+                using GridViewType = std::remove_cv_t<std::remove_reference_t<decltype(gridView)>>;
+                const ElementChunks<GridViewType, Dune::Partitions::Interior>
+                    element_chunks(gridView, Dune::Partitions::interior,
+                                   ThreadManager::maxThreads());
+
                 OPM_BEGIN_PARALLEL_TRY_CATCH();
-                for (const auto& elem : elements(gridView, Dune::Partitions::interior)) {
+                // Threaded sweep with per-chunk partial sums, merged into
+                // the shared per-region attributes afterwards.
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+                for (const auto& chunk : element_chunks) {
+                    ElementContext elemCtx( simulator );
+                    std::unordered_map<RegionId, Attributes> chunk_pv;
+                    std::unordered_map<RegionId, Attributes> chunk_hpv;
+
+                    for (const auto& elem : chunk) {
                     elemCtx.updatePrimaryStencil(elem);
                     elemCtx.updatePrimaryIntensiveQuantities(/*timeIdx=*/0);
                     const unsigned cellIdx = elemCtx.globalSpaceIndex(/*spaceIdx=*/0, /*timeIdx=*/0);
@@ -145,7 +165,7 @@ namespace Opm {
                     // sum p, rs, rv, and T.
                     const Scalar hydrocarbonPV = pv_cell*hydrocarbon;
                     if (hydrocarbonPV > 0.) {
-                        auto& attr = attributes_hpv[reg];
+                        auto& attr = chunk_hpv[reg];
                         attr.pv += hydrocarbonPV;
                         if (FluidSystem::phaseIsActive(FluidSystem::oilPhaseIdx) && FluidSystem::phaseIsActive(FluidSystem::gasPhaseIdx)) {
                             attr.rs += fs.Rs().value() * hydrocarbonPV;
@@ -169,7 +189,7 @@ namespace Opm {
                     }
 
                     if (pv_cell > 0.) {
-                        auto& attr = attributes_pv[reg];
+                        auto& attr = chunk_pv[reg];
                         attr.pv += pv_cell;
                         if (FluidSystem::phaseIsActive(FluidSystem::oilPhaseIdx) && FluidSystem::phaseIsActive(FluidSystem::gasPhaseIdx)) {
                             attr.rs += fs.Rs().value() * pv_cell;
@@ -194,6 +214,24 @@ namespace Opm {
                             attr.rvw += fs.Rvw().value() * pv_cell;
                         }
                     }
+                    }
+
+                    // Merge this chunk's partials into the shared maps.
+#ifdef _OPENMP
+#pragma omp critical (rateConverterDefineState)
+#endif
+                    {
+                        for (const auto& [reg, attr] : chunk_hpv) {
+                            auto& dst = attributes_hpv[reg].data;
+                            std::ranges::transform(dst, attr.data, dst.begin(),
+                                                   std::plus<Scalar>{});
+                        }
+                        for (const auto& [reg, attr] : chunk_pv) {
+                            auto& dst = attributes_pv[reg].data;
+                            std::ranges::transform(dst, attr.data, dst.begin(),
+                                                   std::plus<Scalar>{});
+                        }
+                    }
                 }
 
                 OPM_END_PARALLEL_TRY_CATCH("SurfaceToReservoirVoidage::defineState() failed: ", simulator.vanguard().grid().comm());
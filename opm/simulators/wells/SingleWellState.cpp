@@ -28,6 +28,10 @@
 
 #include <opm/simulators/wells/PerforationData.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+
 namespace Opm {
 
 template<typename Scalar, typename IndexTraits>
@@ -90,6 +94,92 @@ void SingleWellState<Scalar, IndexTraits>::init_timestep(const SingleWellState&
     this->bhp = other.bhp;
     this->thp = other.thp;
     this->temperature = other.temperature;
+    this->solution_history = other.solution_history;
+}
+
+template<typename Scalar, typename IndexTraits>
+void SingleWellState<Scalar, IndexTraits>::record_solution_history(const double time)
+{
+    auto& hist = this->solution_history;
+    if (this->status != Well::Status::OPEN) {
+        hist = {};
+        return;
+    }
+
+    // extrapolating across a control switch would produce a bogus guess,
+    // so restart the history whenever the active control changes
+    if (hist.size > 0 && (hist.injection_cmode != this->injection_cmode ||
+                          hist.production_cmode != this->production_cmode))
+    {
+        hist = {};
+    }
+    hist.injection_cmode = this->injection_cmode;
+    hist.production_cmode = this->production_cmode;
+
+    for (int i = std::min(hist.size, 2); i > 0; --i) {
+        hist.bhp[i] = hist.bhp[i - 1];
+        hist.surface_rates[i] = hist.surface_rates[i - 1];
+        hist.time[i] = hist.time[i - 1];
+    }
+    hist.bhp[0] = this->bhp;
+    hist.surface_rates[0] = this->surface_rates;
+    hist.time[0] = time;
+    hist.size = std::min(hist.size + 1, 3);
+}
+
+template<typename Scalar, typename IndexTraits>
+void SingleWellState<Scalar, IndexTraits>::extrapolate_initial_guess(const double next_time)
+{
+    const auto& hist = this->solution_history;
+    if (hist.size < 2 ||
+        this->status != Well::Status::OPEN ||
+        hist.injection_cmode != this->injection_cmode ||
+        hist.production_cmode != this->production_cmode ||
+        hist.surface_rates[0].size() != this->surface_rates.size() ||
+        hist.surface_rates[1].size() != this->surface_rates.size())
+    {
+        return;
+    }
+
+    const double t0 = hist.time[0];
+    const double t1 = hist.time[1];
+    if (!(t1 < t0) || !(t0 < next_time)) {
+        return;
+    }
+
+    std::function<Scalar(Scalar, Scalar, Scalar)> extrapolate =
+        [t0, t1, next_time](const Scalar y0, const Scalar y1, Scalar)
+        {
+            return y0 + (y0 - y1) * Scalar((next_time - t0) / (t0 - t1));
+        };
+    if (hist.size > 2 && hist.time[2] < t1 &&
+        hist.surface_rates[2].size() == this->surface_rates.size())
+    {
+        // quadratic Lagrange extrapolation through the last three
+        // converged solutions
+        const double t2 = hist.time[2];
+        const Scalar l0 = (next_time - t1) * (next_time - t2) / ((t0 - t1) * (t0 - t2));
+        const Scalar l1 = (next_time - t0) * (next_time - t2) / ((t1 - t0) * (t1 - t2));
+        const Scalar l2 = (next_time - t0) * (next_time - t1) / ((t2 - t0) * (t2 - t1));
+        extrapolate = [l0, l1, l2](const Scalar y0, const Scalar y1, const Scalar y2)
+                      { return l0*y0 + l1*y1 + l2*y2; };
+    }
+
+    const Scalar bhp_guess = extrapolate(hist.bhp[0], hist.bhp[1], hist.bhp[2]);
+    if (bhp_guess > 0.0) {
+        this->bhp = bhp_guess;
+    }
+    for (std::size_t p = 0; p < this->surface_rates.size(); ++p) {
+        const Scalar rate_guess = extrapolate(hist.surface_rates[0][p],
+                                              hist.surface_rates[1][p],
+                                              hist.surface_rates[2][p]);
+        // never let the guess flip the flow direction of a phase
+        this->surface_rates[p] = rate_guess * hist.surface_rates[0][p] < 0.0
+            ? Scalar{0} : rate_guess;
+    }
+    // force the well primary variables to be rebuilt from the
+    // extrapolated bhp and rates instead of the stored values
+    this->primaryvar.clear();
 }
 
 template<typename Scalar, typename IndexTraits>
@@ -107,6 +197,8 @@ void SingleWellState<Scalar, IndexTraits>::shut()
 
     auto& connpi = this->perf_data.prod_index;
     connpi.assign(connpi.size(), 0);
+
+    this->solution_history = {};
 }
 
 template<typename Scalar, typename IndexTraits>
@@ -410,6 +502,7 @@ bool SingleWellState<Scalar, IndexTraits>::operator==(const SingleWellState& rhs
            this->production_cmode == rhs.production_cmode &&
            this->alq_state == rhs.alq_state &&
            this->primaryvar == rhs.primaryvar &&
+           this->solution_history == rhs.solution_history &&
            this->group_target == rhs.group_target &&
            this->was_shut_before_action_applied == rhs.was_shut_before_action_applied;
 }
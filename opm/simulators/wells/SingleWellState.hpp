@@ -84,6 +84,7 @@ public:
         serializer(filtrate_conc);
         serializer(perf_data);
         serializer(primaryvar);
+        serializer(solution_history);
         serializer(alq_state);
         serializer(group_target);
         serializer(was_shut_before_action_applied);
@@ -133,6 +134,37 @@ public:
         }
     };
 
+    /// Compact history of the last converged well solutions, used to
+    /// extrapolate the initial guess for the next time step.  Index 0 is
+    /// the most recent snapshot.
+    struct SolutionHistory {
+        std::array<Scalar,3> bhp{};
+        std::array<std::vector<Scalar>,3> surface_rates{};
+        std::array<double,3> time{};
+        int size{0};
+        WellInjectorCMode injection_cmode{WellInjectorCMode::CMODE_UNDEFINED};
+        WellProducerCMode production_cmode{WellProducerCMode::CMODE_UNDEFINED};
+
+        bool operator==(const SolutionHistory& other) const {
+            return bhp == other.bhp &&
+                   surface_rates == other.surface_rates &&
+                   time == other.time &&
+                   size == other.size &&
+                   injection_cmode == other.injection_cmode &&
+                   production_cmode == other.production_cmode;
+        }
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer) {
+            serializer(bhp);
+            serializer(surface_rates);
+            serializer(time);
+            serializer(size);
+            serializer(injection_cmode);
+            serializer(production_cmode);
+        }
+    };
+
     std::vector<Scalar> well_potentials;
     std::vector<Scalar> productivity_index;
     std::vector<Scalar> implicit_ipr_a;
@@ -148,6 +180,7 @@ public:
     WellInjectorCMode injection_cmode{WellInjectorCMode::CMODE_UNDEFINED};
     WellProducerCMode production_cmode{WellProducerCMode::CMODE_UNDEFINED};
     std::vector<Scalar> primaryvar;
+    SolutionHistory solution_history;
     ALQState<Scalar> alq_state;
     // This is used to indicate whether the well was shut before applying an action
     // if it was SHUT, even the action set the well to OPEN, the data in the well state
@@ -171,6 +204,16 @@ public:
     void update_type_and_targets(const Well& ecl_well, const SummaryState& st);
     bool updateStatus(WellStatus status);
     void init_timestep(const SingleWellState& other);
+
+    /// Push the current converged solution onto the solution history.
+    /// \param[in] time simulated time at which the solution converged
+    void record_solution_history(double time);
+
+    /// Replace bhp and surface rates by a polynomial extrapolation of the
+    /// solution history to \p next_time to warm start the well solve of
+    /// the coming time step.  A no-op unless at least two history entries
+    /// recorded under the current control mode are available.
+    void extrapolate_initial_guess(double next_time);
     void shut();
     void stop();
     void open();
@@ -170,7 +170,8 @@ namespace Opm
                                        WellStateType& well_state) override;
 
         void calculateExplicitQuantities(const Simulator& simulator,
-                                         const GroupStateHelperType& groupStateHelper) override; // should be const?
+                                         const GroupStateHelperType& groupStateHelper,
+                                         const bool reuse_connection_pressures = false) override; // should be const?
 
         void updateProductivityIndex(const Simulator& simulator,
                                      const WellProdIndexCalculator<Scalar>& wellPICalc,
@@ -270,8 +271,12 @@ namespace Opm
                                                     const GroupStateHelperType& groupStateHelper,
                                                     const WellConnectionProps& props);
 
+        // When \p allow_reuse is set, a previously computed set of
+        // connection pressure-drop properties is kept instead of being
+        // recomputed.
         void computeWellConnectionPressures(const Simulator& simulator,
-                                            const GroupStateHelperType& groupStateHelper);
+                                            const GroupStateHelperType& groupStateHelper,
+                                            const bool allow_reuse = false);
 
         template<class Value>
         void computePerfRate(const IntensiveQuantities& intQuants,
@@ -362,11 +367,15 @@ namespace Opm
                                                 WellStateType& well_state,
                                                 const bool solving_with_zero_rate);
 
+        // mob and Tw are scratch buffers that are (re-)initialized here; they
+        // are passed in to be reused across the perforations of a well.
         void calculateSinglePerf(const Simulator& simulator,
                                  const int perf,
                                  WellStateType& well_state,
                                  std::vector<RateVector>& connectionRates,
                                  std::vector<EvalWell>& cq_s,
+                                 std::vector<EvalWell>& mob,
+                                 std::vector<EvalWell>& Tw,
                                  EvalWell& water_flux_s,
                                  EvalWell& cq_s_zfrac_effective,
                                  DeferredLogger& deferred_logger) const;
@@ -460,6 +469,11 @@ namespace Opm
 
         // density of the first perforation, might not be from this rank
         Scalar cachedRefDensity{0};
+
+        // whether the connection pressure-drop properties have been
+        // computed at least once for this well object; guards the reuse
+        // path of computeWellConnectionPressures()
+        bool connection_pressures_computed_{false};
     };
 
 }
@@ -19,7 +19,8 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <config.h>
+#ifndef OPM_STANDARD_WELL_CONNECTIONS_IMPL_HEADER_INCLUDED
+#define OPM_STANDARD_WELL_CONNECTIONS_IMPL_HEADER_INCLUDED
 
 #include <opm/simulators/wells/StandardWellConnections.hpp>
 
@@ -871,12 +872,6 @@ connectionRatezFraction(Scalar& rate,
     return {well_.restrictEval(cq_s_zfrac_effective), cq_s_zfrac_effective};
 }
 
-#include <opm/simulators/utils/InstantiationIndicesMacros.hpp>
-
-INSTANTIATE_TYPE_INDICES(StandardWellConnections, double)
-
-#if FLOW_INSTANTIATE_FLOAT
-INSTANTIATE_TYPE_INDICES(StandardWellConnections, float)
-#endif
-
 } // namespace Opm
+
+#endif // OPM_STANDARD_WELL_CONNECTIONS_IMPL_HEADER_INCLUDED
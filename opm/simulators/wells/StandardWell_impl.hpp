@@ -391,13 +391,20 @@ namespace Opm
 
         auto& perf_data = ws.perf_data;
         auto& perf_rates = perf_data.phase_rates;
+
+        // AD scratch buffers reused across the perforation loop; allocating
+        // them per perforation is measurable for wells with many connections.
+        std::vector<EvalWell> cq_s(this->num_conservation_quantities_, 0.0);
+        std::vector<EvalWell> mob(this->num_conservation_quantities_, 0.0);
+        std::vector<EvalWell> Tw(this->num_conservation_quantities_, 0.0);
+
         for (int perf = 0; perf < this->number_of_local_perforations_; ++perf) {
             // Calculate perforation quantities.
-            std::vector<EvalWell> cq_s(this->num_conservation_quantities_, 0.0);
+            std::fill(cq_s.begin(), cq_s.end(), EvalWell{0.0});
             EvalWell water_flux_s{0.0};
             EvalWell cq_s_zfrac_effective{0.0};
             calculateSinglePerf(simulator, perf, well_state, connectionRates,
-                                cq_s, water_flux_s, cq_s_zfrac_effective, deferred_logger);
+                                cq_s, mob, Tw, water_flux_s, cq_s_zfrac_effective, deferred_logger);
 
             // Equation assembly for this perforation.
             if constexpr (has_polymer && Base::has_polymermw) {
@@ -440,10 +447,14 @@ namespace Opm
         this->connectionRates_ = connectionRates;
 
         // Accumulate dissolved gas and vaporized oil flow rates across all
-        // ranks sharing this well (this->index_of_well_).
+        // ranks sharing this well (this->index_of_well_).  Skip the reduction
+        // for wells local to a single rank; this also keeps the assembly free
+        // of MPI calls so such wells can be solved from worker threads.
         {
             const auto& comm = this->parallel_well_info_.communication();
-            comm.sum(ws.phase_mixing_rates.data(), ws.phase_mixing_rates.size());
+            if (comm.size() > 1) {
+                comm.sum(ws.phase_mixing_rates.data(), ws.phase_mixing_rates.size());
+            }
         }
 
         // accumulate resWell_ and duneD_ in parallel to get effects of all perforations (might be distributed)
@@ -506,6 +517,8 @@ namespace Opm
                         WellStateType& well_state,
                         std::vector<RateVector>& connectionRates,
                         std::vector<EvalWell>& cq_s,
+                        std::vector<EvalWell>& mob,
+                        std::vector<EvalWell>& Tw,
                         EvalWell& water_flux_s,
                         EvalWell& cq_s_zfrac_effective,
                         DeferredLogger& deferred_logger) const
@@ -514,14 +527,15 @@ namespace Opm
         const EvalWell& bhp = this->primary_variables_.eval(Bhp);
         const int cell_idx = this->well_cells_[perf];
         const auto& intQuants = simulator.model().intensiveQuantities(cell_idx, /*timeIdx=*/ 0);
-        std::vector<EvalWell> mob(this->num_conservation_quantities_, {0.});
+        std::fill(mob.begin(), mob.end(), EvalWell{0.});
         getMobility(simulator, perf, mob, deferred_logger);
 
         PerforationRates<Scalar> perf_rates;
         EvalWell trans_mult(0.0);
         getTransMult(trans_mult, simulator, cell_idx);
         const auto& wellstate_nupcol = simulator.problem().wellModel().nupcolWellState().well(this->index_of_well_);
-        std::vector<EvalWell> Tw(this->num_conservation_quantities_, this->well_index_[perf] * trans_mult);
+        const EvalWell base_Tw = this->well_index_[perf] * trans_mult;
+        std::fill(Tw.begin(), Tw.end(), base_Tw);
         this->getTw(Tw, perf, intQuants, trans_mult, wellstate_nupcol);
         computePerfRate(intQuants, mob, bhp, Tw, perf, allow_cf,
                         cq_s, perf_rates, deferred_logger);
@@ -1399,13 +1413,19 @@ namespace Opm
     void
     StandardWell<TypeTag>::
     computeWellConnectionPressures(const Simulator& simulator,
-                                   const GroupStateHelperType& groupStateHelper)
+                                   const GroupStateHelperType& groupStateHelper,
+                                   const bool allow_reuse)
     {
+         if (allow_reuse && this->connection_pressures_computed_) {
+             return;
+         }
+
          const auto& well_state = groupStateHelper.wellState();
          const auto props = computePropertiesForWellConnectionPressures
              (simulator, well_state);
 
          computeWellConnectionDensitesPressures(simulator, groupStateHelper, props);
+         this->connection_pressures_computed_ = true;
     }
 
 
@@ -1438,10 +1458,12 @@ namespace Opm
     void
     StandardWell<TypeTag>::
     calculateExplicitQuantities(const Simulator& simulator,
-                                const GroupStateHelperType& groupStateHelper)
+                                const GroupStateHelperType& groupStateHelper,
+                                const bool reuse_connection_pressures)
     {
         updatePrimaryVariables(groupStateHelper);
-        computeWellConnectionPressures(simulator, groupStateHelper);
+        computeWellConnectionPressures(simulator, groupStateHelper,
+                                       reuse_connection_pressures);
         this->computeAccumWell();
     }
 
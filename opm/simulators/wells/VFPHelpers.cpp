@@ -29,6 +29,7 @@
 #include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
 #include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <stdexcept>
@@ -112,14 +113,11 @@ detail::InterpData<Scalar> VFPHelpers<Scalar>::findInterpData(const Scalar value
             retval.ind_[1] = nvalues-1;
         }
         else {
-            //Search internal intervals
-            for (int i=1; i<nvalues; ++i) {
-                if (values[i] >= value) {
-                    retval.ind_[0] = i-1;
-                    retval.ind_[1] = i;
-                    break;
-                }
-            }
+            //Search internal intervals; the axis is sorted so a binary
+            //search finds the bracket in O(log n)
+            const auto it = std::lower_bound(values.begin() + 1, values.end(), value);
+            retval.ind_[1] = it - values.begin();
+            retval.ind_[0] = retval.ind_[1] - 1;
         }
 
         const Scalar start = values[retval.ind_[0]];
@@ -141,6 +139,27 @@ detail::InterpData<Scalar> VFPHelpers<Scalar>::findInterpData(const Scalar value
     return retval;
 }
 
+template<class Scalar>
+detail::InterpData<Scalar> VFPHelpers<Scalar>::findInterpData(const Scalar value_in,
+                                                              const std::vector<double>& values,
+                                                              const detail::InterpData<Scalar>& hint)
+{
+    const Scalar value = value_in < 0.? 0. : value_in;
+
+    const int i0 = hint.ind_[0];
+    const int i1 = hint.ind_[1];
+    if (i1 > i0 && value >= values[i0] && value < values[i1]) {
+        //Value still inside the previous bracket; only the
+        //interpolation factor needs to be recomputed
+        detail::InterpData<Scalar> retval = hint;
+        retval.inv_dist_ = 1.0 / (values[i1] - values[i0]);
+        retval.factor_ = (value - values[i0]) * retval.inv_dist_;
+        return retval;
+    }
+
+    return findInterpData(value_in, values);
+}
+
 template<class Scalar>
 detail::VFPEvaluation<Scalar> VFPHelpers<Scalar>::
 interpolate(const VFPProdTable& table,
@@ -147,6 +147,17 @@ public:
     static detail::InterpData<Scalar> findInterpData(const Scalar value_in,
                                                      const std::vector<double>& values);
 
+    /**
+     * Overload of findInterpData() taking the result of a previous lookup on
+     * the same axis. If the value still falls inside the previous bracket
+     * only the interpolation factor is recomputed, skipping the axis search.
+     * Repeated lookups with nearly identical coordinates are the common case
+     * during THP and gas-lift iterations.
+     */
+    static detail::InterpData<Scalar> findInterpData(const Scalar value_in,
+                                                     const std::vector<double>& values,
+                                                     const detail::InterpData<Scalar>& hint);
+
     /**
      * Helper function which interpolates data using the indices etc. given in the inputs.
      */
@@ -95,7 +95,9 @@ bool VFPInjProperties<Scalar>::hasTable(const int table_id) const
 template<class Scalar>
 void VFPInjProperties<Scalar>::addTable(const VFPInjTable& new_table)
 {
-    this->m_tables.emplace( new_table.getTableNum(), new_table );
+    // insert_or_assign so that a swapped table (e.g. an ACTIONX updating
+    // VFPINJ) replaces the previous one of the same number.
+    this->m_tables.insert_or_assign( new_table.getTableNum(), std::cref(new_table) );
 }
 
 template<class Scalar>
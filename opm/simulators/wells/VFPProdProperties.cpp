@@ -126,9 +126,14 @@ bhpwithflo(const std::vector<Scalar>& flos,
     const auto alq_i = VFPHelpers<Scalar>::findInterpData( alq, table.getALQAxis()); //assume constant
 
     std::vector<Scalar> bhps(flos.size(), 0.);
+    detail::InterpData<Scalar> flo_i;
     for (std::size_t i = 0; i < flos.size(); ++i) {
-        // Value of FLO is negative in OPM for producers, but positive in VFP table
-        const auto flo_i = VFPHelpers<Scalar>::findInterpData(-flos[i], table.getFloAxis());
+        // Value of FLO is negative in OPM for producers, but positive in VFP table.
+        // Consecutive samples usually fall in the same or a neighboring interval,
+        // so reuse the previous bracket as a hint.
+        flo_i = (i == 0)
+            ? VFPHelpers<Scalar>::findInterpData(-flos[i], table.getFloAxis())
+            : VFPHelpers<Scalar>::findInterpData(-flos[i], table.getFloAxis(), flo_i);
         const detail::VFPEvaluation bhp_val = VFPHelpers<Scalar>::interpolate(table, flo_i, thp_i, wfr_i, gfr_i, alq_i);
 
         // TODO: this kind of breaks the conventions for the functions here by putting dp within the function
@@ -156,7 +161,9 @@ minimumBHP(const int table_id,
 template<class Scalar>
 void VFPProdProperties<Scalar>::addTable(const VFPProdTable& new_table)
 {
-    this->m_tables.emplace( new_table.getTableNum(), new_table );
+    // insert_or_assign so that a swapped table (e.g. an ACTIONX updating
+    // VFPPROD) replaces the previous one of the same number.
+    this->m_tables.insert_or_assign( new_table.getTableNum(), std::cref(new_table) );
 }
 
 template<class Scalar>
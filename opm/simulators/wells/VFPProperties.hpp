@@ -26,6 +26,8 @@
 #include <opm/simulators/wells/VFPHelpers.hpp>
 
 #include <cstddef>
+#include <map>
+#include <utility>
 
 namespace Opm {
 
@@ -52,13 +54,58 @@ public:
                   const WellState<Scalar, IndexTraits>& well_state)
         : well_state_(well_state)
     {
-        for (const auto& vfpinj : inj_tables)
-            this->m_inj.addTable( vfpinj );
-
-        for (const auto& vfpprod : prod_tables)
-            this->m_prod.addTable( vfpprod );
+        this->updateTables(inj_tables, prod_tables);
     };
 
+    /**
+     * Replace the table set with that of a new report step.
+     *
+     * Tables that still refer to the same objects as before (the common
+     * case) keep their version; tables that were added or swapped -- e.g.
+     * by an ACTIONX updating VFPPROD -- are assigned the new epoch as
+     * their version. This lets consumers detect cheaply whether the table
+     * they use actually changed, instead of re-running their setup after
+     * every schedule event.
+     */
+    void updateTables(const std::vector<std::reference_wrapper<const VFPInjTable>>& inj_tables,
+                      const std::vector<std::reference_wrapper<const VFPProdTable>>& prod_tables)
+    {
+        ++epoch_;
+
+        for (const auto& vfpinj : inj_tables) {
+            const VFPInjTable& table = vfpinj.get();
+            auto& entry = inj_table_epochs_[table.getTableNum()];
+            if (entry.first != &table) {
+                entry = std::make_pair(&table, epoch_);
+                this->m_inj.addTable(table);
+            }
+        }
+
+        for (const auto& vfpprod : prod_tables) {
+            const VFPProdTable& table = vfpprod.get();
+            auto& entry = prod_table_epochs_[table.getTableNum()];
+            if (entry.first != &table) {
+                entry = std::make_pair(&table, epoch_);
+                this->m_prod.addTable(table);
+            }
+        }
+    }
+
+    /**
+     * Returns the version of the given table, i.e. the epoch at which the
+     * table object was last replaced, or 0 if the table does not exist.
+     */
+    std::size_t tableVersion(const int table_id, const bool producer) const
+    {
+        if (producer) {
+            const auto it = prod_table_epochs_.find(table_id);
+            return it == prod_table_epochs_.end() ? 0 : it->second.second;
+        } else {
+            const auto it = inj_table_epochs_.find(table_id);
+            return it == inj_table_epochs_.end() ? 0 : it->second.second;
+        }
+    }
+
     /**
      * Returns the VFP properties for injection wells
      */
@@ -107,6 +154,12 @@ private:
     VFPInjProperties<Scalar> m_inj;
     VFPProdProperties<Scalar> m_prod;
     const WellState<Scalar, IndexTraits>& well_state_;
+
+    // Table address and the epoch at which it was last replaced, per
+    // table number.
+    std::size_t epoch_ = 0;
+    std::map<int, std::pair<const VFPInjTable*, std::size_t>> inj_table_epochs_;
+    std::map<int, std::pair<const VFPProdTable*, std::size_t>> prod_table_epochs_;
 };
 
 } // namespace Opm
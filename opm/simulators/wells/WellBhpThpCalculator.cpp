@@ -366,23 +366,26 @@ calculateBhpFromThp(const WellState<Scalar, IndexTraits>& well_state,
     const EvalWell liquid = rates[Oil];
     const EvalWell vapour = rates[Gas];
     const Scalar thp_limit = well_.getTHPConstraint(summaryState);
+    // Read the table number directly off the well instead of constructing the
+    // injection/production controls: this function is called per well per
+    // Newton iteration, and evaluating the UDA-valued control targets just to
+    // obtain the constant table id is a measurable per-call overhead.
+    const int table_id = well.vfp_table_number();
     Scalar vfp_ref_depth;
     EvalWell bhp_tab;
     if (well_.isInjector() )
     {
-        const auto& controls = well.injectionControls(summaryState);
-        vfp_ref_depth = well_.vfpProperties()->getInj()->getTable(controls.vfp_table_number).getDatumDepth();
+        vfp_ref_depth = well_.vfpProperties()->getInj()->getTable(table_id).getDatumDepth();
         bhp_tab = well_.vfpProperties()->getInj()->bhp(
-               controls.vfp_table_number, aqua, liquid, vapour, thp_limit);
+               table_id, aqua, liquid, vapour, thp_limit);
     }
     else if (well_.isProducer()) {
-        const auto& controls = well.productionControls(summaryState);
-        vfp_ref_depth = well_.vfpProperties()->getProd()->getTable(controls.vfp_table_number).getDatumDepth();
-        const auto& wfr =  well_.vfpProperties()->getExplicitWFR(controls.vfp_table_number, well_.indexOfWell());
-        const auto& gfr = well_.vfpProperties()->getExplicitGFR(controls.vfp_table_number, well_.indexOfWell());
+        vfp_ref_depth = well_.vfpProperties()->getProd()->getTable(table_id).getDatumDepth();
+        const auto& wfr =  well_.vfpProperties()->getExplicitWFR(table_id, well_.indexOfWell());
+        const auto& gfr = well_.vfpProperties()->getExplicitGFR(table_id, well_.indexOfWell());
         const bool use_vfpexplicit = well_.useVfpExplicit();
 
-        bhp_tab = well_.vfpProperties()->getProd()->bhp(controls.vfp_table_number,
+        bhp_tab = well_.vfpProperties()->getProd()->bhp(table_id,
                                                       aqua, liquid, vapour,
                                                       thp_limit,
                                                       well_.getALQ(well_state),
@@ -417,15 +420,15 @@ calculateMinimumBhpFromThp(const WellState<Scalar, IndexTraits>& well_state,
 
     const Scalar thp_limit = well_.getTHPConstraint(summaryState);
 
-    const auto& controls = well.productionControls(summaryState);
-    const auto& wfr =  well_.vfpProperties()->getExplicitWFR(controls.vfp_table_number, well_.indexOfWell());
-    const auto& gfr = well_.vfpProperties()->getExplicitGFR(controls.vfp_table_number, well_.indexOfWell());
+    const int table_id = well.vfp_table_number();
+    const auto& wfr =  well_.vfpProperties()->getExplicitWFR(table_id, well_.indexOfWell());
+    const auto& gfr = well_.vfpProperties()->getExplicitGFR(table_id, well_.indexOfWell());
 
-    const Scalar bhp_min = well_.vfpProperties()->getProd()->minimumBHP(controls.vfp_table_number,
+    const Scalar bhp_min = well_.vfpProperties()->getProd()->minimumBHP(table_id,
                                                                         thp_limit, wfr, gfr,
                                                                         well_.getALQ(well_state));
 
-    const Scalar vfp_ref_depth = well_.vfpProperties()->getProd()->getTable(controls.vfp_table_number).getDatumDepth();
+    const Scalar vfp_ref_depth = well_.vfpProperties()->getProd()->getTable(table_id).getDatumDepth();
     const auto bhp_adjustment = getVfpBhpAdjustment(bhp_min, thp_limit);
     const Scalar dp_hydro = wellhelpers::computeHydrostaticCorrection(well_.refDepth(), vfp_ref_depth,
                                                                       rho, well_.gravity());
@@ -909,11 +912,11 @@ isStableSolution(const WellState<Scalar, IndexTraits>& well_state,
     const Scalar vapour = rates[Gas];
     const Scalar thp = well_.getTHPConstraint(summaryState);
 
-    const auto& controls = well.productionControls(summaryState);
-    const auto& wfr =  well_.vfpProperties()->getExplicitWFR(controls.vfp_table_number, well_.indexOfWell());
-    const auto& gfr = well_.vfpProperties()->getExplicitGFR(controls.vfp_table_number, well_.indexOfWell());
+    const int table_id = well.vfp_table_number();
+    const auto& wfr =  well_.vfpProperties()->getExplicitWFR(table_id, well_.indexOfWell());
+    const auto& gfr = well_.vfpProperties()->getExplicitGFR(table_id, well_.indexOfWell());
 
-    const auto& table = well_.vfpProperties()->getProd()->getTable(controls.vfp_table_number);
+    const auto& table = well_.vfpProperties()->getProd()->getTable(table_id);
     const bool use_vfpexplicit = well_.useVfpExplicit();
 
     auto bhp = VFPHelpers<double>::bhp(table, aqua, liquid, vapour, thp,
@@ -949,9 +952,9 @@ estimateStableBhp(const WellState<Scalar, IndexTraits>& well_state,
                   const Scalar alq) const
 {
     // Given a *converged* well_state with ipr, estimate bhp of the stable solution
-    const auto& controls = well.productionControls(summaryState);
+    const int table_id = well.vfp_table_number();
     const Scalar thp = well_.getTHPConstraint(summaryState);
-    const auto& table = well_.vfpProperties()->getProd()->getTable(controls.vfp_table_number);
+    const auto& table = well_.vfpProperties()->getProd()->getTable(table_id);
 
     const Scalar aqua = rates[IndexTraits::waterPhaseIdx];
     const Scalar liquid = rates[IndexTraits::oilPhaseIdx];
@@ -959,8 +962,8 @@ estimateStableBhp(const WellState<Scalar, IndexTraits>& well_state,
     Scalar flo = detail::getFlo(table, aqua, liquid, vapour);
     Scalar wfr, gfr;
     if (well_.useVfpExplicit() || -flo < table.getFloAxis().front()) {
-        wfr =  well_.vfpProperties()->getExplicitWFR(controls.vfp_table_number, well_.indexOfWell());
-        gfr = well_.vfpProperties()->getExplicitGFR(controls.vfp_table_number, well_.indexOfWell());
+        wfr =  well_.vfpProperties()->getExplicitWFR(table_id, well_.indexOfWell());
+        gfr = well_.vfpProperties()->getExplicitGFR(table_id, well_.indexOfWell());
     } else {
         wfr = detail::getWFR(table, aqua, liquid, vapour);
         gfr = detail::getGFR(table, aqua, liquid, vapour);
@@ -968,7 +971,7 @@ estimateStableBhp(const WellState<Scalar, IndexTraits>& well_state,
 
     auto ipr = getFloIPR(well_state, well, summaryState);
 
-    const Scalar vfp_ref_depth = well_.vfpProperties()->getProd()->getTable(controls.vfp_table_number).getDatumDepth();
+    const Scalar vfp_ref_depth = table.getDatumDepth();
 
     const Scalar dp_hydro = wellhelpers::computeHydrostaticCorrection(well_.refDepth(), vfp_ref_depth,
                                                                       rho, well_.gravity());
@@ -991,11 +994,10 @@ template<typename Scalar, typename IndexTraits>
 std::pair<Scalar, Scalar> WellBhpThpCalculator<Scalar, IndexTraits>::
 getFloIPR(const WellState<Scalar, IndexTraits>& well_state,
           const Well& well,
-          const SummaryState& summary_state) const
+          const SummaryState& /* summary_state */) const
 {
     // Convert ipr_a's and ipr_b's to our particular choice of FLO
-    const auto& controls = well.productionControls(summary_state);
-    const auto& table = well_.vfpProperties()->getProd()->getTable(controls.vfp_table_number);
+    const auto& table = well_.vfpProperties()->getProd()->getTable(well.vfp_table_number());
     const auto& ipr_a = well_state.well(well_.indexOfWell()).implicit_ipr_a;
     const auto& pu = well_.phaseUsage();
     const Scalar& aqua_a = pu.phaseIsActive(IndexTraits::waterPhaseIdx) ?
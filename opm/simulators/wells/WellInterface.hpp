@@ -260,8 +260,13 @@ public:
 
     virtual void updatePrimaryVariables(const GroupStateHelperType& groupStateHelper) = 0;
 
+    /// \param reuse_connection_pressures Keep the connection pressure-drop
+    ///   properties computed on a previous time step instead of
+    ///   recomputing them.  Only honoured by well types that cache these
+    ///   properties, and only if a previous computation exists.
     virtual void calculateExplicitQuantities(const Simulator& simulator,
-                                             const GroupStateHelperType& groupStateHelper) = 0; // should be const?
+                                             const GroupStateHelperType& groupStateHelper,
+                                             const bool reuse_connection_pressures = false) = 0; // should be const?
 
     virtual void updateProductivityIndex(const Simulator& simulator,
                                          const WellProdIndexCalculator<Scalar>& wellPICalc,
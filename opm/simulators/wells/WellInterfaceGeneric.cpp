@@ -587,6 +587,17 @@ isVFPActive(DeferredLogger& deferred_logger) const
     }
 }
 
+template<typename Scalar, typename IndexTraits>
+std::size_t WellInterfaceGeneric<Scalar, IndexTraits>::
+vfpTableVersion() const
+{
+    const int table_id = well_ecl_.vfp_table_number();
+    if (table_id <= 0 || vfp_properties_ == nullptr) {
+        return 0;
+    }
+    return vfp_properties_->tableVersion(table_id, isProducer());
+}
+
 template<typename Scalar, typename IndexTraits>
 bool WellInterfaceGeneric<Scalar, IndexTraits>::isOperableAndSolvable() const
 {
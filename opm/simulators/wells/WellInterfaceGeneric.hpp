@@ -28,6 +28,7 @@
 #include <opm/simulators/flow/BlackoilModelParameters.hpp>
 #include <opm/simulators/wells/RuntimePerforation.hpp>
 
+#include <cstddef>
 #include <map>
 #include <optional>
 #include <string>
@@ -172,6 +173,11 @@ public:
     // whether a well is specified with a non-zero and valid VFP table number
     bool isVFPActive(DeferredLogger& deferred_logger) const;
 
+    // version of the VFP table used by this well, bumped whenever the
+    // schedule swaps the table (e.g. an ACTIONX updating VFPPROD);
+    // 0 if the well does not use a VFP table
+    std::size_t vfpTableVersion() const;
+
     void reportWellSwitching(const SingleWellState<Scalar, IndexTraits>& ws,
                              DeferredLogger& deferred_logger) const;
 
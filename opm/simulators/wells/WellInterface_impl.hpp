@@ -902,8 +902,10 @@ namespace Opm
         if (!this->isOperableAndSolvable() && !this->wellIsStopped())
             return;
 
-        // keep a copy of the original well state
-        const WellStateType well_state0 = well_state;
+        // keep a copy of the original state of this well; the solve only
+        // modifies the well's own entry, so restoring that on failure
+        // suffices and avoids copying the state of all the other wells
+        const auto well_state0 = well_state.well(this->indexOfWell());
         const double dt = simulator.timeStepSize();
         bool converged = iterateWellEquations(simulator, dt, groupStateHelper, well_state);
 
@@ -946,7 +948,7 @@ namespace Opm
             const int max_iter = this->param_.max_welleq_iter_;
             deferred_logger.debug("Compute initial well solution for well " + this->name() + ". Failed to converge in "
                                   + std::to_string(max_iter) + " iterations");
-            well_state = well_state0;
+            well_state.well(this->indexOfWell()) = well_state0;
         }
     }
 
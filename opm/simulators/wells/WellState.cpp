@@ -24,6 +24,8 @@
 
 #include <opm/common/ErrorMacros.hpp>
 
+#include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
+
 #include <opm/input/eclipse/Schedule/MSW/WellSegments.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
@@ -529,9 +531,9 @@ report(const int* globalCellIdxMap,
         return {};
     }
 
-    using rt = data::Rates::opt;
-
-    data::Wells res;
+    // Indices of the wells which appear in the report.
+    std::vector<std::size_t> reported_wells;
+    reported_wells.reserve(this->size());
     for (std::size_t well_index = 0; well_index < this->size(); ++well_index) {
         const auto& ws = this->well(well_index);
         if ((ws.status == Well::Status::SHUT) && !wasDynamicallyClosed(well_index))
@@ -539,115 +541,158 @@ report(const int* globalCellIdxMap,
             continue;
         }
 
-        const auto& reservoir_rates = ws.reservoir_rates;
-        const auto& well_potentials = ws.well_potentials;
-        const auto& wpi = ws.productivity_index;
-        const auto& wv = ws.surface_rates;
-        const auto& wname = this->name(well_index);
+        reported_wells.push_back(well_index);
+    }
 
-        auto dummyWell = data::Well{};
-        auto& well = ws.parallel_info.get().isOwner() ? res[wname] : dummyWell;
+    // Assemble the per-well records in parallel.  The records are
+    // independent of each other, only the communication needed for
+    // distributed wells and the insertion into the string-keyed result
+    // map must remain serial.
+    const std::size_t num_reported = reported_wells.size();
+    std::vector<data::Well> well_data(num_reported);
+    std::vector<std::vector<data::Connection>> distributed_connections(num_reported);
 
-        well.bhp = ws.bhp;
-        well.thp = ws.thp;
-        well.temperature = ws.temperature;
-        well.efficiency_scaling_factor = ws.efficiency_scaling_factor;
-        well.filtrate.rate = ws.sum_filtrate_rate();
-        well.filtrate.total = ws.sum_filtrate_total();
-        well.filtrate.concentration = ws.filtrate_conc;
-
-        const auto& pu = this->phaseUsageInfo_;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (std::size_t i = 0; i < num_reported; ++i) {
+        this->reportWell_(reported_wells[i], globalCellIdxMap,
+                          well_data[i], distributed_connections[i]);
+    }
 
-        if (pu.phaseIsActive(waterPhaseIdx)) {
-            const int phase_pos = pu.canonicalToActivePhaseIdx(waterPhaseIdx);
-            well.rates.set(rt::wat, wv[phase_pos]);
-            well.rates.set(rt::reservoir_water, reservoir_rates[phase_pos]);
-            well.rates.set(rt::productivity_index_water, wpi[phase_pos]);
-            well.rates.set(rt::well_potential_water, well_potentials[phase_pos]);
-            well.rates.set(rt::mass_wat, ws.sum_wat_mass_rates());
+    data::Wells res;
+    for (std::size_t i = 0; i < num_reported; ++i) {
+        const auto well_index = reported_wells[i];
+        const auto& pwinfo = this->well(well_index).parallel_info.get();
+
+        if (pwinfo.communication().size() > 1) {
+            gatherVectorsOnRoot(distributed_connections[i],
+                                well_data[i].connections,
+                                pwinfo.communication());
         }
 
-        if (pu.phaseIsActive(oilPhaseIdx)) {
-            const int phase_pos = pu.canonicalToActivePhaseIdx(oilPhaseIdx);
-            well.rates.set(rt::oil, wv[phase_pos]);
-            well.rates.set(rt::reservoir_oil, reservoir_rates[phase_pos]);
-            well.rates.set(rt::productivity_index_oil, wpi[phase_pos]);
-            well.rates.set(rt::well_potential_oil, well_potentials[phase_pos]);
+        if (pwinfo.isOwner()) {
+            res.emplace(this->name(well_index), std::move(well_data[i]));
         }
+    }
 
-        if (pu.phaseIsActive(gasPhaseIdx)) {
-            const int phase_pos = pu.canonicalToActivePhaseIdx(gasPhaseIdx);
-            well.rates.set(rt::gas, wv[phase_pos]);
-            well.rates.set(rt::reservoir_gas, reservoir_rates[phase_pos]);
-            well.rates.set(rt::productivity_index_gas, wpi[phase_pos]);
-            well.rates.set(rt::well_potential_gas, well_potentials[phase_pos]);
-        }
+    return res;
+}
 
-        if (pu.hasSolvent() || pu.hasZFraction()) {
-            well.rates.set(rt::solvent, ws.sum_solvent_rates());
-        }
+template<typename Scalar, typename IndexTraits>
+void WellState<Scalar, IndexTraits>::
+reportWell_(const std::size_t well_index,
+            const int* globalCellIdxMap,
+            data::Well& well,
+            std::vector<data::Connection>& distributedConnections) const
+{
+    using rt = data::Rates::opt;
 
-        if (pu.hasPolymer()) {
-            well.rates.set(rt::polymer, ws.sum_polymer_rates());
-        }
+    const auto& ws = this->well(well_index);
 
-        if (pu.hasBrine()) {
-            well.rates.set(rt::brine, ws.sum_brine_rates());
-        }
+    const auto& reservoir_rates = ws.reservoir_rates;
+    const auto& well_potentials = ws.well_potentials;
+    const auto& wpi = ws.productivity_index;
+    const auto& wv = ws.surface_rates;
 
-        if (pu.hasEnergy()) {
-            well.rates.set(rt::energy,  ws.energy_rate);
-        }
+    well.bhp = ws.bhp;
+    well.thp = ws.thp;
+    well.temperature = ws.temperature;
+    well.efficiency_scaling_factor = ws.efficiency_scaling_factor;
 
-        if (pu.hasBiofilm() || pu.hasMICP()) {
-            well.rates.set(rt::microbial, ws.sum_microbial_rates());
-            if (pu.hasMICP()) {
-                well.rates.set(rt::oxygen, ws.sum_oxygen_rates());
-                well.rates.set(rt::urea, ws.sum_urea_rates());
-            }
-        }
+    if (this->filtrate_output_requested_) {
+        well.filtrate.rate = ws.sum_filtrate_rate();
+        well.filtrate.total = ws.sum_filtrate_total();
+        well.filtrate.concentration = ws.filtrate_conc;
+    }
 
-        if (ws.producer) {
-            well.rates.set(rt::alq, ws.alq_state.get());
-        }
-        else {
-            well.rates.set(rt::alq, 0.0);
-        }
+    const auto& pu = this->phaseUsageInfo_;
 
-        well.rates.set(rt::dissolved_gas,
-                       ws.phase_mixing_rates[ws.dissolved_gas] +
-                       ws.phase_mixing_rates[ws.dissolved_gas_in_water]);
-        well.rates.set(rt::vaporized_oil, ws.phase_mixing_rates[ws.vaporized_oil]);
-        well.rates.set(rt::vaporized_water, ws.phase_mixing_rates[ws.vaporized_water]);
+    if (pu.phaseIsActive(waterPhaseIdx)) {
+        const int phase_pos = pu.canonicalToActivePhaseIdx(waterPhaseIdx);
+        well.rates.set(rt::wat, wv[phase_pos]);
+        well.rates.set(rt::reservoir_water, reservoir_rates[phase_pos]);
+        well.rates.set(rt::productivity_index_water, wpi[phase_pos]);
+        well.rates.set(rt::well_potential_water, well_potentials[phase_pos]);
+        well.rates.set(rt::mass_wat, ws.sum_wat_mass_rates());
+    }
 
-        {
-            auto& curr = well.current_control;
+    if (pu.phaseIsActive(oilPhaseIdx)) {
+        const int phase_pos = pu.canonicalToActivePhaseIdx(oilPhaseIdx);
+        well.rates.set(rt::oil, wv[phase_pos]);
+        well.rates.set(rt::reservoir_oil, reservoir_rates[phase_pos]);
+        well.rates.set(rt::productivity_index_oil, wpi[phase_pos]);
+        well.rates.set(rt::well_potential_oil, well_potentials[phase_pos]);
+    }
 
-            curr.isProducer = ws.producer;
-            curr.prod = ws.production_cmode;
-            curr.inj  = ws.injection_cmode;
-        }
+    if (pu.phaseIsActive(gasPhaseIdx)) {
+        const int phase_pos = pu.canonicalToActivePhaseIdx(gasPhaseIdx);
+        well.rates.set(rt::gas, wv[phase_pos]);
+        well.rates.set(rt::reservoir_gas, reservoir_rates[phase_pos]);
+        well.rates.set(rt::productivity_index_gas, wpi[phase_pos]);
+        well.rates.set(rt::well_potential_gas, well_potentials[phase_pos]);
+    }
 
-        if (const auto& pwinfo = ws.parallel_info.get();
-            pwinfo.communication().size() == 1)
-        {
-            reportConnections(well.connections, well_index, globalCellIdxMap);
-        }
-        else {
-            std::vector<data::Connection> connections;
+    if (pu.hasSolvent() || pu.hasZFraction()) {
+        well.rates.set(rt::solvent, ws.sum_solvent_rates());
+    }
 
-            reportConnections(connections, well_index, globalCellIdxMap);
-            gatherVectorsOnRoot(connections, well.connections, pwinfo.communication());
-        }
+    if (pu.hasPolymer()) {
+        well.rates.set(rt::polymer, ws.sum_polymer_rates());
+    }
+
+    if (pu.hasBrine()) {
+        well.rates.set(rt::brine, ws.sum_brine_rates());
+    }
+
+    if (pu.hasEnergy()) {
+        well.rates.set(rt::energy,  ws.energy_rate);
+    }
 
-        const auto nseg = ws.segments.size();
-        for (auto seg_ix = 0*nseg; seg_ix < nseg; ++seg_ix) {
-            const auto seg_no = ws.segments.segment_number()[seg_ix];
-            well.segments[seg_no] = this->reportSegmentResults(well_index, seg_ix, seg_no);
+    if (pu.hasBiofilm() || pu.hasMICP()) {
+        well.rates.set(rt::microbial, ws.sum_microbial_rates());
+        if (pu.hasMICP()) {
+            well.rates.set(rt::oxygen, ws.sum_oxygen_rates());
+            well.rates.set(rt::urea, ws.sum_urea_rates());
         }
     }
 
-    return res;
+    if (ws.producer) {
+        well.rates.set(rt::alq, ws.alq_state.get());
+    }
+    else {
+        well.rates.set(rt::alq, 0.0);
+    }
+
+    well.rates.set(rt::dissolved_gas,
+                   ws.phase_mixing_rates[ws.dissolved_gas] +
+                   ws.phase_mixing_rates[ws.dissolved_gas_in_water]);
+    well.rates.set(rt::vaporized_oil, ws.phase_mixing_rates[ws.vaporized_oil]);
+    well.rates.set(rt::vaporized_water, ws.phase_mixing_rates[ws.vaporized_water]);
+
+    {
+        auto& curr = well.current_control;
+
+        curr.isProducer = ws.producer;
+        curr.prod = ws.production_cmode;
+        curr.inj  = ws.injection_cmode;
+    }
+
+    if (ws.parallel_info.get().communication().size() == 1)
+    {
+        reportConnections(well.connections, well_index, globalCellIdxMap);
+    }
+    else {
+        // The connection results of the other ranks are gathered by
+        // the caller, outside of the threaded assembly.
+        reportConnections(distributedConnections, well_index, globalCellIdxMap);
+    }
+
+    const auto nseg = ws.segments.size();
+    for (auto seg_ix = 0*nseg; seg_ix < nseg; ++seg_ix) {
+        const auto seg_no = ws.segments.segment_number()[seg_ix];
+        well.segments[seg_no] = this->reportSegmentResults(well_index, seg_ix, seg_no);
+    }
 }
 
 template<typename Scalar, typename IndexTraits>
@@ -670,7 +715,7 @@ reportConnections(std::vector<data::Connection>& connections,
     this->reportConnectionFactors(well_index, connections);
     this->reportConnectionPressuresAndRates(well_index, connections);
 
-    if (! ws.producer) {
+    if (! ws.producer && this->filtrate_output_requested_) {
         this->reportConnectionFilterCake(well_index, connections);
     }
 
@@ -680,6 +725,21 @@ reportConnections(std::vector<data::Connection>& connections,
     }
 }
 
+template<typename Scalar, typename IndexTraits>
+void WellState<Scalar, IndexTraits>::
+resolveOutputRequests(const SummaryConfig& summary_config)
+{
+    // Filtrate injection diagnostics are only assembled when some summary
+    // vector asks for them.  The summary configuration already includes
+    // the keywords required by UDQs and ACTIONX conditions, so a single
+    // lookup at well model creation covers those consumers as well.
+    this->filtrate_output_requested_ =
+        summary_config.hasKeyword("WINJFVR") ||
+        summary_config.hasKeyword("WINJFVT") ||
+        summary_config.hasKeyword("CINJFVR") ||
+        summary_config.hasKeyword("CINJFVT");
+}
+
 template<typename Scalar, typename IndexTraits>
 void WellState<Scalar, IndexTraits>::
 initWellStateMSWell(const std::vector<Well>& wells_ecl,
@@ -996,38 +1056,54 @@ void WellState<Scalar, IndexTraits>::updateStatus(int well_index, WellStatus sta
 template<typename Scalar, typename IndexTraits>
 void WellState<Scalar, IndexTraits>::communicateGroupRates(const Parallel::Communication& comm)
 {
-    // Compute the size of the data.
-    std::size_t sz = std::accumulate(this->well_rates.begin(), this->well_rates.end(), std::size_t{0},
-                     [](const std::size_t acc, const auto& rates)
-                     { return acc + rates.second.second.size(); });
-
     // Make a vector and collect all data into it.
-    std::vector<Scalar> data(sz);
-    auto pos = data.begin();
+    std::vector<Scalar> data(this->data_size());
+    this->collect(data.data());
+
+    // Communicate it with a single sum() call.
+    comm.sum(data.data(), data.size());
+
+    this->distribute(data.data());
+}
+
+template<typename Scalar, typename IndexTraits>
+std::size_t WellState<Scalar, IndexTraits>::data_size() const
+{
+    return std::accumulate(this->well_rates.begin(), this->well_rates.end(), std::size_t{0},
+                           [](const std::size_t acc, const auto& rates)
+                           { return acc + rates.second.second.size(); });
+}
+
+template<typename Scalar, typename IndexTraits>
+std::size_t WellState<Scalar, IndexTraits>::collect(Scalar* data) const
+{
+    std::size_t pos = 0;
     std::ranges::for_each(this->well_rates,
-                          [&pos](const auto& input)
+                          [data, &pos](const auto& input)
                           {
                               const auto& [owner, rates] = input.second;
                               if (owner) {
-                                  std::ranges::copy(rates, pos);
+                                  std::ranges::copy(rates, data + pos);
+                              } else {
+                                  std::fill_n(data + pos, rates.size(), Scalar{0});
                               }
                               pos += rates.size();
                           });
+    return pos;
+}
 
-    assert(pos == data.end());
-
-    // Communicate it with a single sum() call.
-    comm.sum(data.data(), data.size());
-
-    pos = data.begin();
+template<typename Scalar, typename IndexTraits>
+std::size_t WellState<Scalar, IndexTraits>::distribute(const Scalar* data)
+{
+    std::size_t pos = 0;
     std::ranges::for_each(this->well_rates,
-                          [&pos](auto& input)
+                          [data, &pos](auto& input)
                           {
                               auto& rates = input.second.second;
-                              std::copy_n(pos, rates.size(), rates.begin());
+                              std::copy_n(data + pos, rates.size(), rates.begin());
                               pos += rates.size();
                           });
-    assert(pos == data.end());
+    return pos;
 }
 
 template<typename Scalar, typename IndexTraits>
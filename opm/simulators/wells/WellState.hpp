@@ -57,6 +57,7 @@ template<class Scalar> class ParallelWellInfo;
 template<class Scalar> struct PerforationData;
 template<class Scalar> class ConnFracStatistics;
 class Schedule;
+class SummaryConfig;
 enum class WellStatus : std::uint8_t;
 
 /// The state of a set of wells, tailored for use by the fully
@@ -164,6 +165,12 @@ public:
                            std::size_t well_index,
                            const int* globalCellIdxMap) const;
 
+    /// Resolve, from the summary configuration, which optional report
+    /// quantities actually have a consumer.  Called once when the well
+    /// model is created; report() skips assembling the quantities nobody
+    /// requested.
+    void resolveOutputRequests(const SummaryConfig& summary_config);
+
     /// init the MS well related.
     void initWellStateMSWell(const std::vector<Well>& wells_ecl,
                              const WellState* prev_well_state);
@@ -179,6 +186,15 @@ public:
 
     void communicateGroupRates(const Parallel::Communication& comm);
 
+    /// Number of scalars exchanged between ranks by communicateGroupRates().
+    std::size_t data_size() const;
+    /// Flatten the well rates into data; entries for wells not owned by
+    /// this rank are zeroed. Returns the number of scalars written.
+    std::size_t collect(Scalar* data) const;
+    /// Scatter (summed) data back into the well rates; returns the
+    /// number of scalars read.
+    std::size_t distribute(const Scalar* data);
+
     void updateGlobalIsGrup(const Parallel::Communication& comm,
                             const std::vector<WellStatus>& well_status);
     void updateEfficiencyScalingFactor(const std::string& wellName,
@@ -364,11 +380,26 @@ private:
     // Keep track of permanently inactive well names
     std::vector<std::string> permanently_inactive_well_names_;
 
+    // Whether some summary vector (including those required by UDQs or
+    // ACTIONX conditions) consumes filtrate injection quantities.
+    // Resolved once in resolveOutputRequests(); defaults to true so that
+    // reports stay complete if no resolution has taken place.
+    bool filtrate_output_requested_{true};
+
     data::Segment
     reportSegmentResults(const int         well_id,
                          const int         seg_ix,
                          const int         seg_no) const;
 
+    /// Assemble the report record of a single well.  Thread safe.  For
+    /// wells distributed over several ranks the local connection results
+    /// are returned through \p distributedConnections; gathering them on
+    /// the owning rank involves communication and is left to the caller.
+    void reportWell_(std::size_t well_index,
+                     const int* globalCellIdxMap,
+                     data::Well& well,
+                     std::vector<data::Connection>& distributedConnections) const;
+
 
     /// Allocate and initialize if wells is non-null.
     /// Also tries to give useful initial values to the bhp() and
@@ -35,6 +35,7 @@
 
 #include <opm/simulators/linalg/gpuistl/GpuPressureTransferPolicy.hpp>
 #include <opm/simulators/linalg/gpuistl/GpuSparseMatrixWrapper.hpp>
+#include <opm/simulators/linalg/gpuistl/GpuToCpuPressureTransferPolicy.hpp>
 #include <opm/simulators/linalg/gpuistl/GpuVector.hpp>
 #include <opm/simulators/linalg/gpuistl/detail/cpr_amg_operations.hpp>
 
@@ -379,6 +380,107 @@ testProlongation(int pressureVarIndex)
     }
 }
 
+/**
+ * @brief Test the hybrid (GPU fine level, CPU coarse level) transfer policy
+ *        against the pure CPU implementation
+ */
+template <int blockSize, bool transpose>
+void
+testHybridPolicy(int pressureVarIndex)
+{
+    TestFixture<blockSize> fixture;
+
+    // Calculate weights for CPU
+    auto cpuWeights = Opm::Amg::getQuasiImpesWeights<typename TestFixture<blockSize>::MatrixType,
+                                                     typename TestFixture<blockSize>::VectorType>(
+        fixture.matrix, pressureVarIndex, transpose, false);
+
+    // Calculate quasiimpes weights for GPU
+    auto gpuMatrix = fixture.createGpuMatrix();
+    typename TestFixture<blockSize>::GpuVectorType gpuWeights(fixture.N * blockSize);
+    auto diagonalIndices = Opm::Amg::precomputeDiagonalIndices(gpuMatrix);
+    typename TestFixture<blockSize>::GpuVectorIntType gpuDiagonalIndices(diagonalIndices);
+    Opm::gpuistl::detail::getQuasiImpesWeights<typename TestFixture<blockSize>::Scalar, transpose>(
+        gpuMatrix, pressureVarIndex, gpuWeights, gpuDiagonalIndices);
+
+    // Create empty property tree
+    Opm::PropertyTree prm;
+
+    // Create CPU transfer policy
+    auto cpuPolicy = Opm::PressureTransferPolicy<typename TestFixture<blockSize>::CpuOperatorType,
+                                                 typename TestFixture<blockSize>::CommInfo,
+                                                 typename TestFixture<blockSize>::Scalar,
+                                                 transpose>(
+        typename TestFixture<blockSize>::CommInfo(), cpuWeights, prm, pressureVarIndex);
+
+    // Create hybrid transfer policy; its fine level lives on the GPU
+    auto hybridPolicy = Opm::gpuistl::GpuToCpuPressureTransferPolicy<typename TestFixture<blockSize>::GpuOperatorType,
+                                                                     typename TestFixture<blockSize>::CommInfo,
+                                                                     typename TestFixture<blockSize>::Scalar,
+                                                                     transpose>(
+        typename TestFixture<blockSize>::CommInfo(), gpuWeights, prm, pressureVarIndex);
+
+    // Create operators
+    typename TestFixture<blockSize>::CpuOperatorType cpuOperator(fixture.matrix);
+    typename TestFixture<blockSize>::GpuOperatorType gpuOperator(gpuMatrix);
+
+    // Create coarse level systems
+    cpuPolicy.createCoarseLevelSystem(cpuOperator);
+    hybridPolicy.createCoarseLevelSystem(gpuOperator);
+
+    // The hybrid coarse matrix lives on the CPU; compare it entry by entry
+    const auto& cpuCoarseMatrix = cpuPolicy.getCoarseLevelOperator()->getmat();
+    const auto& hybridCoarseMatrix = hybridPolicy.getCoarseLevelOperator()->getmat();
+    BOOST_REQUIRE_EQUAL(cpuCoarseMatrix.nonzeroes(), hybridCoarseMatrix.nonzeroes());
+    for (auto row = cpuCoarseMatrix.begin(); row != cpuCoarseMatrix.end(); ++row) {
+        for (auto col = row->begin(); col != row->end(); ++col) {
+            BOOST_CHECK_CLOSE((*col)[0][0], hybridCoarseMatrix[row.index()][col.index()][0][0], 1e-10);
+        }
+    }
+
+    // Create fine vector and its GPU copy
+    typename TestFixture<blockSize>::VectorType fineVector(fixture.N);
+    for (int i = 0; i < fixture.N; ++i) {
+        for (int j = 0; j < blockSize; ++j) {
+            fineVector[i][j] = fixture.distribution(fixture.generator);
+        }
+    }
+    typename TestFixture<blockSize>::GpuVectorType gpuFineVector(fineVector);
+
+    // Restriction: the hybrid coarse rhs ends up on the CPU
+    cpuPolicy.moveToCoarseLevel(fineVector);
+    hybridPolicy.moveToCoarseLevel(gpuFineVector);
+
+    const auto& cpuCoarseRhs = cpuPolicy.getCoarseLevelRhs();
+    const auto& hybridCoarseRhs = hybridPolicy.getCoarseLevelRhs();
+    for (int i = 0; i < fixture.N; ++i) {
+        BOOST_CHECK_CLOSE(cpuCoarseRhs[i][0], hybridCoarseRhs[i][0], 1e-10);
+    }
+
+    // Prolongation: the hybrid coarse lhs is filled on the CPU
+    auto& cpuCoarseLhs = cpuPolicy.getCoarseLevelLhs();
+    auto& hybridCoarseLhs = hybridPolicy.getCoarseLevelLhs();
+    for (int i = 0; i < fixture.N; ++i) {
+        cpuCoarseLhs[i][0] = fixture.distribution(fixture.generator);
+        hybridCoarseLhs[i][0] = cpuCoarseLhs[i][0];
+    }
+
+    typename TestFixture<blockSize>::VectorType cpuFineResult(fixture.N);
+    cpuFineResult = 0.0;
+    typename TestFixture<blockSize>::GpuVectorType gpuFineResult(fixture.N * blockSize);
+    gpuFineResult = 0.0;
+
+    cpuPolicy.moveToFineLevel(cpuFineResult);
+    hybridPolicy.moveToFineLevel(gpuFineResult);
+
+    std::vector<double> gpuFineResultData = gpuFineResult.asStdVector();
+    for (int i = 0; i < fixture.N; ++i) {
+        for (int j = 0; j < blockSize; ++j) {
+            BOOST_CHECK_CLOSE(cpuFineResult[i][j], gpuFineResultData[i * blockSize + j], 1e-10);
+        }
+    }
+}
+
 /**
  * @brief Helper function to run a test function for all valid parameter combinations
  */
@@ -462,7 +564,20 @@ BOOST_AUTO_TEST_CASE(TestRestriction)
     runTestForAllCombinations<RestrictionTestRunner>();
 }
 
+template <int blockSize, bool transpose>
+struct HybridPolicyTestRunner {
+    static void run(int pressureVarIndex)
+    {
+        testHybridPolicy<blockSize, transpose>(pressureVarIndex);
+    }
+};
+
 BOOST_AUTO_TEST_CASE(TestProlongation)
 {
     runTestForAllCombinations<ProlongationTestRunner>();
 }
+
+BOOST_AUTO_TEST_CASE(TestHybridPolicy)
+{
+    runTestForAllCombinations<HybridPolicyTestRunner>();
+}
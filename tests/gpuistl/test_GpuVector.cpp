@@ -154,6 +154,54 @@ BOOST_AUTO_TEST_CASE(TestDot)
     BOOST_CHECK_EQUAL(correctAnswer, dot);
 }
 
+BOOST_AUTO_TEST_CASE(TestAxpyDot)
+{
+    std::vector<double> dataX {{1, 2, 3, 4, 5, 6, 7}};
+    std::vector<double> dataY {{8, 9, 10, 11, 12, 13, 14}};
+    std::vector<double> dataZ {{2, 1, 2, 1, 2, 1, 2}};
+    auto x = Opm::gpuistl::GpuVector<double>(dataX.data(), dataX.size());
+    auto y = Opm::gpuistl::GpuVector<double>(dataY.data(), dataY.size());
+    auto z = Opm::gpuistl::GpuVector<double>(dataZ.data(), dataZ.size());
+    const double alpha = 0.5;
+
+    auto dot = x.axpyDot(alpha, y, z);
+
+    double correctAnswer = 0.0;
+    for (size_t i = 0; i < dataX.size(); ++i) {
+        dataX[i] += alpha * dataY[i];
+        correctAnswer += dataX[i] * dataZ[i];
+    }
+    BOOST_CHECK_CLOSE(correctAnswer, dot, 1e-13);
+
+    // the vector update must have happened as well
+    std::vector<double> output(dataX.size());
+    x.copyToHost(output.data(), output.size());
+    BOOST_CHECK_EQUAL_COLLECTIONS(output.begin(), output.end(), dataX.begin(), dataX.end());
+}
+
+BOOST_AUTO_TEST_CASE(TestAxpyTwoNorm)
+{
+    std::vector<double> dataX {{1, 2, 3, 4, 5, 6, 7}};
+    std::vector<double> dataY {{8, 9, 10, 11, 12, 13, 14}};
+    auto x = Opm::gpuistl::GpuVector<double>(dataX.data(), dataX.size());
+    auto y = Opm::gpuistl::GpuVector<double>(dataY.data(), dataY.size());
+    const double alpha = -0.25;
+
+    auto norm = x.axpyTwoNorm(alpha, y);
+
+    double correctAnswer = 0.0;
+    for (size_t i = 0; i < dataX.size(); ++i) {
+        dataX[i] += alpha * dataY[i];
+        correctAnswer += dataX[i] * dataX[i];
+    }
+    correctAnswer = std::sqrt(correctAnswer);
+    BOOST_CHECK_CLOSE(correctAnswer, norm, 1e-13);
+
+    std::vector<double> output(dataX.size());
+    x.copyToHost(output.data(), output.size());
+    BOOST_CHECK_EQUAL_COLLECTIONS(output.begin(), output.end(), dataX.begin(), dataX.end());
+}
+
 BOOST_AUTO_TEST_CASE(Assigment)
 {
     std::vector<double> data {{1, 2, 3, 4, 5, 6, 7}};
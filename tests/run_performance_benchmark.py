@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+"""Performance regression benchmark driver.
+
+Runs a simulator on a deck a number of times, parses the timing trailer
+printed from SimulatorReport (assembly, linear solve, well assembly,
+output, ...), and compares the best repetition against a stored JSON
+baseline.  The run fails if any watched timing exceeds its baseline by
+more than the given threshold, so performance regressions surface in the
+same way result regressions do.
+
+Baselines are machine specific.  Create or refresh them with --update on
+the machine that runs the benchmarks.
+"""
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+# trailer lines as printed by SimulatorReportSingle::reportFullyImplicit()
+TIMING_PATTERNS = {
+    'simulation_time': r'^Simulation time:\s+([0-9.]+) s',
+    'assembly_time': r'^\s+Assembly time:\s+([0-9.]+) s',
+    'well_assembly_time': r'^\s+Well assembly:\s+([0-9.]+) s',
+    'linear_solve_time': r'^\s+Linear solve time:\s+([0-9.]+) s',
+    'linear_setup_time': r'^\s+Linear setup:\s+([0-9.]+) s',
+    'update_time': r'^\s+Props/update time:\s+([0-9.]+) s',
+    'output_write_time': r'^\s+Output write time:\s+([0-9.]+) s',
+}
+
+COUNTER_PATTERNS = {
+    'linearizations': r'^Overall Linearizations:\s+([0-9]+)',
+    'newton_iterations': r'^Overall Newton Iterations:\s+([0-9]+)',
+    'linear_iterations': r'^Overall Linear Iterations:\s+([0-9]+)',
+}
+
+# timings shorter than this are dominated by noise and never flagged
+MIN_COMPARABLE_SECONDS = 0.5
+
+
+def parse_trailer(output):
+    """Extract timings and iteration counts from simulator stdout."""
+    metrics = {}
+    for line in output.splitlines():
+        for name, pattern in TIMING_PATTERNS.items():
+            match = re.match(pattern, line)
+            if match:
+                metrics[name] = float(match.group(1))
+        for name, pattern in COUNTER_PATTERNS.items():
+            match = re.match(pattern, line)
+            if match:
+                metrics[name] = int(match.group(1))
+    return metrics
+
+
+def run_case(simulator, deck, output_dir, sim_args, repeats):
+    """Run the simulator repeatedly, keeping the best time per metric."""
+    best = {}
+    for rep in range(repeats):
+        cmd = [simulator, deck, '--output-dir=' + output_dir] + sim_args
+        print('[{}/{}] {}'.format(rep + 1, repeats, ' '.join(cmd)))
+        result = subprocess.run(cmd, stdout=subprocess.PIPE,
+                                stderr=subprocess.STDOUT,
+                                universal_newlines=True)
+        if result.returncode != 0:
+            sys.stdout.write(result.stdout)
+            sys.exit('Simulator failed with exit code {}'
+                     .format(result.returncode))
+
+        metrics = parse_trailer(result.stdout)
+        if 'simulation_time' not in metrics:
+            sys.stdout.write(result.stdout)
+            sys.exit('Could not find the timing trailer in simulator output')
+
+        for name, value in metrics.items():
+            if name in TIMING_PATTERNS:
+                best[name] = min(best.get(name, value), value)
+            else:
+                # iteration counts must not vary between repetitions
+                best[name] = value
+
+    return best
+
+
+def compare(metrics, baseline, threshold):
+    """Return a list of regression messages, empty when all is well."""
+    failures = []
+    for name in TIMING_PATTERNS:
+        if name not in metrics or name not in baseline:
+            continue
+        ref = baseline[name]
+        if ref < MIN_COMPARABLE_SECONDS:
+            continue
+        limit = ref * (1.0 + threshold / 100.0)
+        status = 'REGRESSION' if metrics[name] > limit else 'ok'
+        print('  {:20s} {:9.2f} s (baseline {:9.2f} s) {}'
+              .format(name, metrics[name], ref, status))
+        if metrics[name] > limit:
+            failures.append('{}: {:.2f} s exceeds baseline {:.2f} s '
+                            'by more than {:g}%'
+                            .format(name, metrics[name], ref, threshold))
+
+    for name in COUNTER_PATTERNS:
+        if name in metrics and name in baseline \
+           and metrics[name] != baseline[name]:
+            # changed iteration counts make the timings incomparable;
+            # mention it but let the timing comparison decide
+            print('  note: {} changed from {} to {}'
+                  .format(name, baseline[name], metrics[name]))
+
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('--simulator', required=True,
+                        help='path to the simulator binary')
+    parser.add_argument('--deck', required=True,
+                        help='path to the .DATA file to run')
+    parser.add_argument('--output-dir', required=True,
+                        help='directory for simulator output')
+    parser.add_argument('--baseline', required=True,
+                        help='path to the JSON baseline file')
+    parser.add_argument('--threshold', type=float, default=10.0,
+                        help='allowed slowdown in percent (default 10)')
+    parser.add_argument('--repeats', type=int, default=3,
+                        help='repetitions per case; the best one counts')
+    parser.add_argument('--update', action='store_true',
+                        help='write the measured timings as the new baseline')
+    parser.add_argument('sim_args', nargs='*',
+                        help='extra arguments passed to the simulator')
+    args = parser.parse_args()
+
+    os.makedirs(args.output_dir, exist_ok=True)
+    metrics = run_case(args.simulator, args.deck, args.output_dir,
+                       args.sim_args, args.repeats)
+
+    if args.update or not os.path.exists(args.baseline):
+        os.makedirs(os.path.dirname(args.baseline), exist_ok=True)
+        with open(args.baseline, 'w') as f:
+            json.dump({'deck': os.path.basename(args.deck),
+                       'repeats': args.repeats,
+                       'metrics': metrics}, f, indent=2, sort_keys=True)
+            f.write('\n')
+        print('Wrote baseline {}'.format(args.baseline))
+        return 0
+
+    with open(args.baseline) as f:
+        baseline = json.load(f)['metrics']
+
+    print('Comparing against {} (threshold {:g}%)'
+          .format(args.baseline, args.threshold))
+    failures = compare(metrics, baseline, args.threshold)
+    for failure in failures:
+        print('REGRESSION: ' + failure)
+
+    return 1 if failures else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -22,6 +22,7 @@
 #endif // HAVE_CONFIG_H
 
 #include <stdexcept>
+#include <vector>
 
 #include <opm/simulators/wells/GroupState.hpp>
 #include <opm/json/JsonObject.hpp>
@@ -72,4 +73,12 @@ BOOST_AUTO_TEST_CASE(GroupStateCreate)
     TestCommunicator comm;
     gs.communicate_rates(comm);
     BOOST_CHECK(gs2 == gs);
+
+    // A collect()/distribute() round trip restores the state.
+    std::vector<double> buffer(gs.data_size());
+    BOOST_CHECK_EQUAL(gs.collect(buffer.data()), buffer.size());
+    gs.update_production_rates("AGROUP", {-1, -1, -1});
+    BOOST_CHECK(!(gs2 == gs));
+    BOOST_CHECK_EQUAL(gs.distribute(buffer.data()), buffer.size());
+    BOOST_CHECK(gs2 == gs);
 }
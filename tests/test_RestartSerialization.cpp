@@ -111,6 +111,7 @@ namespace Opm { using PerfD = PerfData<double>; }
 TEST_FOR_TYPE_NAMED(PerfD, PerfData)
 TEST_FOR_TYPE(PIDAndIterationCountTimeStepControl)
 TEST_FOR_TYPE(PIDTimeStepControl)
+TEST_FOR_TYPE(ResidualHistoryTimeStepControl)
 namespace Opm { using SegmState = SegmentState<double>; }
 TEST_FOR_TYPE_NAMED(SegmState, SegmentState)
 TEST_FOR_TYPE(SimpleIterationCountTimeStepControl)
@@ -124,6 +125,7 @@ TEST_FOR_TYPE_NAMED_OBJ(ATS, AdaptiveTimeSteppingPID, serializationTestObjectPID
 TEST_FOR_TYPE_NAMED_OBJ(ATS, AdaptiveTimeSteppingPIDIt, serializationTestObjectPIDIt)
 TEST_FOR_TYPE_NAMED_OBJ(ATS, AdaptiveTimeSteppingSimple, serializationTestObjectSimple)
 TEST_FOR_TYPE_NAMED_OBJ(ATS, AdaptiveTimeStepping3rdOrder, serializationTestObject3rdOrder)
+TEST_FOR_TYPE_NAMED_OBJ(ATS, AdaptiveTimeSteppingResidualHistory, serializationTestObjectResidualHistory)
 
 namespace Opm { using BPV = BlackOilPrimaryVariables<Properties::TTag::TestTypeTag>; }
 TEST_FOR_TYPE_NAMED(BPV, BlackoilPrimaryVariables)
@@ -317,7 +319,7 @@ public:
         if (deserialize) {
             active_wgstate_.well_state = WellState<double, IndexTraits>(dummy);
             last_valid_wgstate_.well_state = WellState<double, IndexTraits>(dummy);
-            nupcol_wgstate_.well_state = WellState<double, IndexTraits>(dummy);
+            nupcol_well_state_ = WellState<double, IndexTraits>(dummy);
         }
     }
 
@@ -332,7 +334,7 @@ public:
         genNetwork_.setNodePressures({{"test3", 4.0}});
         active_wgstate_ = WGState<double, IndexTraits>::serializationTestObject(dummy);
         last_valid_wgstate_ = WGState<double, IndexTraits>::serializationTestObject(dummy);
-        nupcol_wgstate_ = WGState<double, IndexTraits>::serializationTestObject(dummy);
+        nupcol_well_state_ = WellState<double, IndexTraits>::serializationTestObject(dummy);
         switched_prod_groups_ = {{"test4", {Group::ProductionCMode::NONE, Group::ProductionCMode::ORAT}}};
         const auto controls = {Group::InjectionCMode::NONE, Group::InjectionCMode::RATE, Group::InjectionCMode::RATE };
         switched_inj_groups_ = {{"test4", {controls, {}, controls} }};
@@ -345,7 +347,7 @@ public:
     void calcInjResvCoeff(const int, const int, std::vector<double>&) const override
     {}
 
-    void computePotentials(const std::size_t,
+    void computePotentials(const std::vector<std::size_t>&,
                            const WellState<double, IndexTraits>&,
                            std::string&,
                            ExceptionType::ExcEnum&) override
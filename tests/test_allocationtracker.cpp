@@ -0,0 +1,168 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/simulators/utils/AllocationTracker.hpp>
+
+#define BOOST_TEST_MODULE AllocationTrackerTest
+#include <boost/test/unit_test.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+// Reporting allocator for this test binary: every heap allocation is
+// forwarded to the tracker before being served.  This is the same
+// interposition a gate run of the full simulator would install.
+void* operator new(std::size_t size)
+{
+    Opm::AllocationTracker::record(size);
+    if (void* ptr = std::malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size)
+{
+    Opm::AllocationTracker::record(size);
+    if (void* ptr = std::malloc(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+using Tracker = Opm::AllocationTracker;
+using Subsystem = Tracker::Subsystem;
+
+namespace {
+
+std::uint64_t count(const std::array<std::uint64_t, Tracker::numSubsystems>& counts,
+                    const Subsystem subsystem)
+{
+    return counts[static_cast<std::size_t>(subsystem)];
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(DisarmedRecordsNothing)
+{
+    {
+        const Tracker::Scope scope(Subsystem::Assembly);
+        const auto data = std::make_unique<int[]>(128);
+        BOOST_REQUIRE(data != nullptr);
+    }
+
+    const auto counts = Tracker::takeCounts();
+    for (const auto c : counts) {
+        BOOST_CHECK_EQUAL(c, 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(AttributesToInnermostScope)
+{
+    Tracker::arm(/*faultOnAllocation=*/false);
+
+    {
+        const Tracker::Scope assemblyScope(Subsystem::Assembly);
+        const auto a = std::make_unique<int[]>(16);
+
+        {
+            const Tracker::Scope solveScope(Subsystem::LinearSolve);
+            const auto b = std::make_unique<int[]>(16);
+            const auto c = std::make_unique<int[]>(16);
+        }
+
+        // Back in the assembly scope after the nested one ends.
+        const auto d = std::make_unique<int[]>(16);
+    }
+
+    Tracker::disarm();
+
+    const auto counts = Tracker::takeCounts();
+    BOOST_CHECK_EQUAL(count(counts, Subsystem::Assembly), 2);
+    BOOST_CHECK_EQUAL(count(counts, Subsystem::LinearSolve), 2);
+    BOOST_CHECK_EQUAL(count(counts, Subsystem::Wells), 0);
+}
+
+BOOST_AUTO_TEST_CASE(IgnoresAllocationsOutsideScopes)
+{
+    Tracker::arm(/*faultOnAllocation=*/false);
+    const auto data = std::make_unique<int[]>(128);
+    Tracker::disarm();
+
+    const auto counts = Tracker::takeCounts();
+    for (const auto c : counts) {
+        BOOST_CHECK_EQUAL(c, 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(SteadyStateHotLoopIsAllocationFree)
+{
+    // Shaped like the stepping loop of the simulator: a workspace that
+    // grows to its working size during the first two steps and is reused
+    // afterwards.  The real gate arms the tracker after the warmup steps
+    // of a full simulation run in exactly this way.
+    std::vector<double> workspace;
+
+    const auto step = [&workspace](const std::size_t size) {
+        const Tracker::Scope scope(Subsystem::Assembly);
+        workspace.resize(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            workspace[i] = static_cast<double>(i);
+        }
+    };
+
+    // Warmup steps may allocate.
+    step(1000);
+    step(1000);
+
+    Tracker::arm(/*faultOnAllocation=*/false);
+    for (int i = 0; i < 10; ++i) {
+        step(1000);
+    }
+    Tracker::disarm();
+
+    const auto counts = Tracker::takeCounts();
+    BOOST_CHECK_EQUAL(count(counts, Subsystem::Assembly), 0);
+}
@@ -0,0 +1,170 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE TestEventProfiler
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/utils/EventProfiler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Opm::EventProfiler;
+
+namespace {
+
+void spin()
+{
+    const auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < std::chrono::milliseconds(5)) {
+        // burn a little wall clock time so that the recorded scopes
+        // round to a non-zero number of microseconds
+    }
+}
+
+bool hasLineStartingWith(const std::vector<std::string>& lines,
+                         const std::string& prefix)
+{
+    return std::any_of(lines.begin(), lines.end(),
+                       [&prefix](const std::string& line)
+                       { return line.rfind(prefix + ' ', 0) == 0; });
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(DisabledScopesRecordNothing)
+{
+    BOOST_CHECK(!EventProfiler::enabled());
+
+    {
+        const EventProfiler::Scope scope("neverRecorded");
+        spin();
+    }
+
+    BOOST_CHECK(EventProfiler::foldedStacks().empty());
+}
+
+BOOST_AUTO_TEST_CASE(NestedScopesFoldIntoStacks)
+{
+    EventProfiler::enable(/*eventsPerThread=*/128);
+    BOOST_CHECK(EventProfiler::enabled());
+
+    {
+        const EventProfiler::Scope outer("outer");
+        spin();
+
+        {
+            const EventProfiler::Scope inner("inner");
+            spin();
+        }
+    }
+
+    BOOST_CHECK_THROW(EventProfiler::foldedStacks(), std::logic_error);
+
+    EventProfiler::disable();
+    BOOST_CHECK(!EventProfiler::enabled());
+
+    const auto lines = EventProfiler::foldedStacks();
+    BOOST_CHECK(hasLineStartingWith(lines, "outer"));
+    BOOST_CHECK(hasLineStartingWith(lines, "outer;inner"));
+}
+
+BOOST_AUTO_TEST_CASE(RingBufferKeepsMostRecentEvents)
+{
+    EventProfiler::enable(/*eventsPerThread=*/4);
+
+    for (int i = 0; i < 100; ++i) {
+        const EventProfiler::Scope scope("wrapped");
+    }
+    {
+        const EventProfiler::Scope scope("recent");
+        spin();
+    }
+
+    EventProfiler::disable();
+
+    // only the most recent events survive the wrap-around
+    BOOST_CHECK(hasLineStartingWith(EventProfiler::foldedStacks(), "recent"));
+}
+
+BOOST_AUTO_TEST_CASE(ChromeTraceHoldsCompleteEvents)
+{
+    EventProfiler::enable(/*eventsPerThread=*/128);
+
+    {
+        const EventProfiler::Scope outer("outer");
+        spin();
+
+        {
+            const EventProfiler::Scope inner("inner");
+            spin();
+        }
+    }
+
+    BOOST_CHECK_THROW(EventProfiler::writeChromeTrace("unused.json", 0),
+                      std::logic_error);
+
+    EventProfiler::disable();
+
+    const auto fileName = (std::filesystem::temp_directory_path() /
+                           "test_eventprofiler_trace.json").string();
+    EventProfiler::writeChromeTrace(fileName, /*rank=*/3);
+
+    std::ostringstream contents;
+    contents << std::ifstream(fileName).rdbuf();
+    std::filesystem::remove(fileName);
+
+    const auto& trace = contents.str();
+    BOOST_CHECK(trace.find("\"traceEvents\"") != std::string::npos);
+    BOOST_CHECK(trace.find("\"name\":\"outer\"") != std::string::npos);
+    BOOST_CHECK(trace.find("\"name\":\"inner\"") != std::string::npos);
+    BOOST_CHECK(trace.find("\"ph\":\"X\"") != std::string::npos);
+    BOOST_CHECK(trace.find("\"pid\":3") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(EventsFromSeveralThreadsAreMerged)
+{
+    EventProfiler::enable(/*eventsPerThread=*/128);
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < 4; ++i) {
+        workers.emplace_back([]()
+        {
+            const EventProfiler::Scope scope("worker");
+            spin();
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    EventProfiler::disable();
+
+    BOOST_CHECK(hasLineStartingWith(EventProfiler::foldedStacks(), "worker"));
+}
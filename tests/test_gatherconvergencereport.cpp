@@ -106,6 +106,33 @@ BOOST_AUTO_TEST_CASE(EvenHaveFailure)
     }
 }
 
+BOOST_AUTO_TEST_CASE(AllConvergedReductionPath)
+{
+    auto cc = Dune::MPIHelper::getCommunication();
+    using CR = Opm::ConvergenceReport;
+    CR cr;
+    // All ranks converged; with collectAllReports == false the gather is
+    // replaced by a single reduction and the local report is returned.
+    CR global_cr = gatherConvergenceReport(cr, cc, /*collectAllReports=*/false);
+    BOOST_CHECK(global_cr.converged());
+    BOOST_CHECK(global_cr.wellFailures().empty());
+}
+
+BOOST_AUTO_TEST_CASE(FailureForcesFullGather)
+{
+    auto cc = Dune::MPIHelper::getCommunication();
+    using CR = Opm::ConvergenceReport;
+    CR cr;
+    if (cc.rank() == 0) {
+        cr.setWellFailed({CR::WellFailure::Type::ControlBHP, CR::Severity::Normal, -1, "WellRank0"});
+    }
+    // Any rank failing must still trigger the full gather on every rank.
+    CR global_cr = gatherConvergenceReport(cr, cc, /*collectAllReports=*/false);
+    BOOST_CHECK(!global_cr.converged());
+    BOOST_CHECK(global_cr.wellFailures().size() == std::size_t(1));
+    BOOST_CHECK(global_cr.wellFailures()[0].wellName() == "WellRank0");
+}
+
 namespace {
 
     class NProc_Is_Not
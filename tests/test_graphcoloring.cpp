@@ -395,3 +395,62 @@ BOOST_AUTO_TEST_CASE(TestColoredDiluParallelisms5x5Complex)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE(TestIndependentSetColoringLaplaceStencil)
+{
+    /*
+    5-point stencil on a 10x10 grid. The sparsity graph is bipartite, so the
+    greedy distance-1 coloring should recover the classical red-black
+    checkerboard with two colors of 50 rows each, and no row may share a
+    color with any of its stencil neighbours.
+    */
+    using Matrix = Dune::BCRSMatrix<Dune::FieldMatrix<double,1,1>>;
+    const int N = 10;
+    Matrix matrix(N*N, N*N, 5, 0.4, Matrix::implicit);
+    for (int j = 0; j < N; j++) {
+        for (int i = 0; i < N; i++) {
+            auto index = j * N + i;
+            matrix.entry(index,index) = 1;
+
+            if (i > 0) {
+                matrix.entry(index,index-1) = 1;
+            }
+            if (i  < N - 1) {
+                matrix.entry(index,index+1) = 1;
+            }
+
+            if (j > 0) {
+                matrix.entry(index,index-N) = 1;
+            }
+            if (j  < N - 1) {
+                matrix.entry(index,index+N) = 1;
+            }
+        }
+    }
+    matrix.compress();
+
+    const Opm::SparseTable<std::size_t> coloring = Opm::getMatrixIndependentSetColoring(matrix);
+
+    BOOST_CHECK_EQUAL(coloring.size(), 2);
+    BOOST_CHECK_EQUAL(coloring[0].size(), N*N/2);
+    BOOST_CHECK_EQUAL(coloring[1].size(), N*N/2);
+
+    std::vector<int> color(N*N, -1);
+    std::vector<std::size_t> allRows;
+    for (int c = 0; c < coloring.size(); ++c) {
+        for (const auto row : coloring[c]) {
+            color[row] = c;
+            allRows.push_back(row);
+        }
+    }
+    checkAllIndices(allRows);
+
+    // no row may have the color of one of its off-diagonal couplings
+    for (auto row = matrix.begin(); row != matrix.end(); ++row) {
+        for (auto elem = row->begin(); elem != row->end(); ++elem) {
+            if (elem.index() != row.index()) {
+                BOOST_CHECK(color[row.index()] != color[elem.index()]);
+            }
+        }
+    }
+}
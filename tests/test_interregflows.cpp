@@ -294,6 +294,51 @@ BOOST_AUTO_TEST_SUITE_END() // Single_FIP_Region
 
 // =====================================================================
 
+BOOST_AUTO_TEST_SUITE(Inter_Region_Predicate)
+
+BOOST_AUTO_TEST_CASE(SingleFIP)
+{
+    const auto same = Opm::InterRegFlowMapSingleFIP{ all_same_region() };
+    BOOST_CHECK_MESSAGE(! same.isInterRegion(0, 1),
+                        "There must not be an inter-region connection "
+                        "between cells in the same region");
+
+    const auto split = Opm::InterRegFlowMapSingleFIP{ left_right_split_region() };
+    BOOST_CHECK_MESSAGE(! split.isInterRegion(0, 2),
+                        "There must not be an inter-region connection "
+                        "between cells in the same region");
+    BOOST_CHECK_MESSAGE(split.isInterRegion(0, 1),
+                        "There must be an inter-region connection "
+                        "between cells in different regions");
+}
+
+BOOST_AUTO_TEST_CASE(MultiArray)
+{
+    const auto fipnum = all_same_region();
+    const auto fipspl = left_right_split_region();
+
+    const auto flows = Opm::InterRegFlowMap {
+        fipnum.size(),
+        {
+            { "FIPNUM", std::cref(fipnum) },
+            { "FIPSPL", std::cref(fipspl) },
+        }
+    };
+
+    BOOST_CHECK_MESSAGE(! flows.isInterRegion(0, 2),
+                        "There must not be an inter-region connection "
+                        "between cells in the same region in every "
+                        "region set");
+    BOOST_CHECK_MESSAGE(flows.isInterRegion(0, 1),
+                        "There must be an inter-region connection "
+                        "between cells in different regions in some "
+                        "region set");
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Inter_Region_Predicate
+
+// =====================================================================
+
 BOOST_AUTO_TEST_SUITE(Left_Right_Split_Region)
 
 BOOST_AUTO_TEST_CASE(AllInternal)
@@ -0,0 +1,155 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#include <opm/simulators/linalg/MatrixFreeOperator.hpp>
+
+#define BOOST_TEST_MODULE MatrixFreeOperatorTest
+#include <boost/test/unit_test.hpp>
+
+#include <dune/common/fvector.hh>
+#include <dune/istl/bvector.hh>
+
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+using Vector = Dune::BlockVector<Dune::FieldVector<double, 1>>;
+
+// Nonlinear residual R(u) = (u0^2 + u1, u1^2 - u0) with Jacobian
+// J(u) = [ 2 u0   1 ]
+//        [  -1  2 u1 ]
+Vector residual(const Vector& u)
+{
+    Vector r(2);
+    r[0] = u[0][0] * u[0][0] + u[1][0];
+    r[1] = u[1][0] * u[1][0] - u[0][0];
+    return r;
+}
+
+Vector analyticJacobianTimes(const Vector& u, const Vector& v)
+{
+    Vector jv(2);
+    jv[0] = 2.0 * u[0][0] * v[0][0] + v[1][0];
+    jv[1] = -v[0][0] + 2.0 * u[1][0] * v[1][0];
+    return jv;
+}
+
+Opm::MatrixFreeJacobianOperator<Vector> makeOperator(const Vector& u)
+{
+    auto evaluator = [u](const Vector& dx, Vector& out) {
+        Vector perturbed(u);
+        perturbed += dx;
+        out = residual(perturbed);
+    };
+
+    Opm::MatrixFreeJacobianOperator<Vector> op(evaluator, u.two_norm());
+    op.setBaseResidual(residual(u));
+    return op;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(MatchesAnalyticJacobian)
+{
+    Vector u(2);
+    u[0] = 3.0;
+    u[1] = -2.0;
+
+    const auto op = makeOperator(u);
+
+    Vector v(2);
+    v[0] = 0.5;
+    v[1] = 1.5;
+
+    Vector jv(2);
+    op.apply(v, jv);
+
+    const auto expected = analyticJacobianTimes(u, v);
+    BOOST_CHECK_CLOSE(jv[0][0], expected[0][0], 1e-4);
+    BOOST_CHECK_CLOSE(jv[1][0], expected[1][0], 1e-4);
+}
+
+BOOST_AUTO_TEST_CASE(ZeroDirectionGivesZero)
+{
+    Vector u(2);
+    u[0] = 1.0;
+    u[1] = 1.0;
+
+    const auto op = makeOperator(u);
+
+    Vector v(2);
+    v = 0.0;
+
+    Vector jv(2);
+    jv[0] = 42.0;
+    jv[1] = 42.0;
+    op.apply(v, jv);
+
+    BOOST_CHECK_EQUAL(jv[0][0], 0.0);
+    BOOST_CHECK_EQUAL(jv[1][0], 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(ApplyScaleAddConsistent)
+{
+    Vector u(2);
+    u[0] = -1.0;
+    u[1] = 4.0;
+
+    const auto op = makeOperator(u);
+
+    Vector v(2);
+    v[0] = 2.0;
+    v[1] = -3.0;
+
+    Vector jv(2);
+    op.apply(v, jv);
+
+    Vector y(2);
+    y[0] = 1.0;
+    y[1] = 2.0;
+    Vector expected(y);
+    expected.axpy(0.25, jv);
+
+    op.applyscaleadd(0.25, v, y);
+
+    BOOST_CHECK_CLOSE(y[0][0], expected[0][0], 1e-10);
+    BOOST_CHECK_CLOSE(y[1][0], expected[1][0], 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE(ThrowsWithoutBaseResidual)
+{
+    Vector u(2);
+    u = 1.0;
+
+    auto evaluator = [u](const Vector& dx, Vector& out) {
+        Vector perturbed(u);
+        perturbed += dx;
+        out = residual(perturbed);
+    };
+
+    const Opm::MatrixFreeJacobianOperator<Vector> op(evaluator, u.two_norm());
+
+    Vector v(2);
+    v = 1.0;
+    Vector jv(2);
+    BOOST_CHECK_THROW(op.apply(v, jv), std::logic_error);
+}
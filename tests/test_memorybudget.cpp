@@ -0,0 +1,145 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE TestMemoryBudget
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/simulators/utils/MemoryBudget.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using Opm::MemoryBudget;
+
+namespace {
+
+// The registry is a process-wide singleton, so every test cleans up the
+// caches it registered and disables the budget again on destruction.
+struct RegistryCleanup
+{
+    ~RegistryCleanup()
+    {
+        for (const auto id : handles) {
+            MemoryBudget::instance().unregisterCache(id);
+        }
+        MemoryBudget::instance().setBudget(0);
+    }
+
+    std::size_t add(const std::string& name,
+                    const int priority,
+                    const std::size_t held,
+                    std::vector<std::string>& releaseOrder)
+    {
+        const auto id = MemoryBudget::instance().registerCache(
+            name, priority,
+            [held]() { return held; },
+            [name, &releaseOrder]() { releaseOrder.push_back(name); });
+        handles.push_back(id);
+        return id;
+    }
+
+    std::vector<std::size_t> handles;
+};
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(NoBudgetMeansNoEviction)
+{
+    std::vector<std::string> releaseOrder;
+    RegistryCleanup cleanup;
+    cleanup.add("idle", 0, 1024, releaseOrder);
+
+    BOOST_CHECK_EQUAL(MemoryBudget::instance().budget(), 0U);
+    BOOST_CHECK(!MemoryBudget::instance().enforce());
+    BOOST_CHECK(releaseOrder.empty());
+}
+
+BOOST_AUTO_TEST_CASE(EvictsInAscendingPriorityOrder)
+{
+    if (MemoryBudget::currentResidentBytes() == 0) {
+        // Platform does not expose the resident size; enforcement is a no-op.
+        return;
+    }
+
+    std::vector<std::string> releaseOrder;
+    RegistryCleanup cleanup;
+    // Tiny per-cache sizes keep the projected release below the
+    // overshoot, so every cache must be visited, lowest priority first.
+    cleanup.add("last", 2, 1, releaseOrder);
+    cleanup.add("first", 0, 1, releaseOrder);
+    cleanup.add("middle", 1, 1, releaseOrder);
+    cleanup.add("empty", 0, 0, releaseOrder);
+
+    // A one-byte budget is always exceeded by a running process.
+    MemoryBudget::instance().setBudget(1);
+    BOOST_CHECK(MemoryBudget::instance().enforce());
+
+    const auto expected = std::vector<std::string>{"first", "middle", "last"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(releaseOrder.begin(), releaseOrder.end(),
+                                  expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(StopsWhenProjectedReleaseCoversOvershoot)
+{
+    if (MemoryBudget::currentResidentBytes() == 0) {
+        return;
+    }
+
+    std::vector<std::string> releaseOrder;
+    RegistryCleanup cleanup;
+    // The first cache claims far more than any plausible overshoot, so
+    // the higher-priority cache must survive the sweep.
+    cleanup.add("huge", 0, std::size_t(1) << 40, releaseOrder);
+    cleanup.add("kept", 1, 1024, releaseOrder);
+
+    MemoryBudget::instance().setBudget(1);
+    BOOST_CHECK(MemoryBudget::instance().enforce());
+
+    const auto expected = std::vector<std::string>{"huge"};
+    BOOST_CHECK_EQUAL_COLLECTIONS(releaseOrder.begin(), releaseOrder.end(),
+                                  expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(HandlesAreReusedAfterUnregister)
+{
+    std::vector<std::string> releaseOrder;
+    RegistryCleanup cleanup;
+    const auto first = cleanup.add("first", 0, 1, releaseOrder);
+    cleanup.add("second", 0, 1, releaseOrder);
+
+    MemoryBudget::instance().unregisterCache(first);
+    const auto reused = cleanup.add("third", 0, 1, releaseOrder);
+    BOOST_CHECK_EQUAL(first, reused);
+}
+
+BOOST_AUTO_TEST_CASE(ReportListsRegisteredCaches)
+{
+    std::vector<std::string> releaseOrder;
+    RegistryCleanup cleanup;
+    cleanup.add("solver-hierarchy", 0, std::size_t(3) << 20, releaseOrder);
+
+    MemoryBudget::instance().setBudget(std::size_t(512) << 20);
+    const auto report = MemoryBudget::instance().formatReport();
+    BOOST_CHECK(report.find("solver-hierarchy") != std::string::npos);
+    BOOST_CHECK(report.find("512 MiB") != std::string::npos);
+}